@@ -209,6 +209,58 @@ def generate_topics_list_file_from_files(files, outputdir, template_filename, te
     generate_by_template(tl_out_file, tl_template_file, tl_globals)
 
 
+def generate_footprint_report(files, outputdir, package, includepath):
+    """
+    Writes a report of the static RAM footprint of the topic node buffers
+    (message size times queue length, per instance), sorted by size
+    """
+    from px_generate_uorb_topic_helper import add_padding_bytes, sizeof_field_type
+
+    if includepath:
+        search_path = genmsg.command_line.includepath_to_dict(includepath)
+    else:
+        search_path = {}
+
+    entries = []
+    for filename in files:
+        msg_context = genmsg.msg_loader.MsgContext.create_default()
+        full_type_name = genmsg.gentools.compute_full_type_name(package, os.path.basename(filename))
+        spec = genmsg.msg_loader.load_msg_from_file(msg_context, filename, full_type_name)
+        genmsg.msg_loader.load_depends(msg_context, spec, search_path)
+
+        sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
+        struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
+        msg_size = struct_size - padding_end_size
+
+        queue_length = 1
+        for constant in spec.constants:
+            if constant.name == 'ORB_QUEUE_LENGTH':
+                queue_length = int(constant.val)
+
+        for topic in get_topics(filename):
+            entries.append((topic, msg_size, queue_length, msg_size * queue_length))
+
+    entries.sort(key=lambda entry: (-entry[3], entry[0]))
+
+    if not os.path.isdir(outputdir):
+        os.makedirs(outputdir)
+
+    total = sum(entry[3] for entry in entries)
+    name_width = max([len(entry[0]) for entry in entries] + [len('TOPIC')])
+
+    with open(os.path.join(outputdir, 'uORBTopicsFootprint.txt'), 'w') as report:
+        report.write('# uORB topic node buffer footprint (bytes per advertised instance)\n')
+        report.write('# queue length = 1 topics use twice the size if published with zero-copy loans\n')
+        report.write('%-*s %6s %5s %8s\n' % (name_width, 'TOPIC', 'SIZE', 'QUEUE', 'BUFFER'))
+
+        for topic, msg_size, queue_length, buffer_size in entries:
+            report.write('%-*s %6i %5i %8i\n' % (name_width, topic, msg_size, queue_length, buffer_size))
+
+        report.write('%-*s %6s %5s %8i\n' % (name_width, 'TOTAL (%i topics)' % len(entries), '', '', total))
+
+    return True
+
+
 def append_to_include_path(path_to_append, curr_include, package):
     for p in path_to_append:
         curr_include.append('%s:%s' % (package, p))
@@ -220,6 +272,7 @@ if __name__ == "__main__":
     parser.add_argument('--sources', help='Generate source files', action='store_true')
     parser.add_argument('--uorb-idl-header', help='Generate uORB compatible idl header', action='store_true')
     parser.add_argument('--json', help='Generate json files', action='store_true')
+    parser.add_argument('--footprint', help='Generate topic buffer footprint report', action='store_true')
     parser.add_argument('-f', dest='file',
                         help="files to convert",
                         nargs="+")
@@ -240,6 +293,10 @@ if __name__ == "__main__":
     if args.include_paths:
         append_to_include_path(args.include_paths, INCL_DEFAULT, args.package)
 
+    if args.footprint:
+        generate_footprint_report(args.file, args.outputdir, args.package, INCL_DEFAULT)
+        exit(0)
+
     if args.headers:
         generate_idx = 0
     elif args.sources:
@@ -96,6 +96,55 @@ def add_fields(msg_fields, name_prefix='', offset=0):
 
 fields, struct_size = add_fields(spec.parsed_fields())
 
+# get the offsets of the fields within the uORB struct (same layout as generated by the uorb msg.h.em template:
+# fields sorted by size, embedded types aligned to 8 bytes and padded to a multiple of 8)
+def add_uorb_offsets(msg_fields, name_prefix='', base_offset=0):
+	offsets = {}
+	offset = 0
+	for field in sorted(msg_fields, key=sizeof_field_type, reverse=True):
+		if field.is_header:
+			continue
+
+		array_size = field.array_len if field.is_array else 1
+
+		if field.is_builtin:
+			offsets[name_prefix+field.name] = base_offset + offset
+			offset += sizeof_field_type(field) * array_size
+		else:
+			offset = (offset + 7) & ~7
+			children_fields = get_children_fields(field.base_type, search_path)
+			child_offsets, child_size = add_uorb_offsets(children_fields)
+
+			for i in range(array_size):
+				sub_name_prefix = name_prefix+field.name
+				if array_size > 1:
+					sub_name_prefix += '['+str(i)+']'
+				for child_name, child_offset in child_offsets.items():
+					offsets[sub_name_prefix+'.'+child_name] = base_offset + offset + i * child_size + child_offset
+
+			offset += child_size * array_size
+	return offsets, (offset + 7) & ~7
+
+uorb_offsets, unused = add_uorb_offsets(spec.parsed_fields())
+
+# merge consecutive fields into spans that can be copied with a single memcpy, which is the case if the
+# uORB struct has the same layout as the CDR buffer (e.g. for messages with fields already sorted by size).
+# A span is a tuple (padding before, uORB offset, size, fields), fields are tuples (type, name, size, offset within span)
+spans = []
+for field_type, field_name, field_size, padding in fields:
+	uorb_offset = uorb_offsets[field_name]
+	if spans and padding == 0 and spans[-1][1] + spans[-1][2] == uorb_offset:
+		span_padding, span_offset, span_size, span_fields = spans[-1]
+		span_fields.append((field_type, field_name, field_size, span_size))
+		spans[-1] = (span_padding, span_offset, span_size + field_size, span_fields)
+	else:
+		spans.append((padding, uorb_offset, field_size, [(field_type, field_name, field_size, 0)]))
+
+has_merged_spans = any(len(span_fields) > 1 for span_padding, span_offset, span_size, span_fields in spans)
+
+def is_adjusted_timestamp(field_type, field_name):
+	return field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample')
+
 }@
 
 // auto-generated file
@@ -103,6 +152,7 @@ fields, struct_size = add_fields(spec.parsed_fields())
 #pragma once
 
 #include <ucdr/microcdr.h>
+#include <stddef.h>
 #include <string.h>
 #include <uORB/topics/@(topic).h>
 
@@ -127,27 +177,31 @@ static inline constexpr int ucdr_topic_size_@(topic)()
 static inline bool ucdr_serialize_@(topic)(const void* data, ucdrBuffer& buf, int64_t time_offset = 0)
 {
 	const @(uorb_struct)& topic = *static_cast<const @(uorb_struct)*>(data);
+@[if has_merged_spans]@
+	const uint8_t *topic_bytes = static_cast<const uint8_t*>(data);
+@[end if]@
 @{
-for field_type, field_name, field_size, padding in fields:
-	if padding > 0:
-		print('\tbuf.iterator += {:}; // padding'.format(padding))
-		print('\tbuf.offset += {:}; // padding'.format(padding))
+for span_padding, span_offset, span_size, span_fields in spans:
+	if span_padding > 0:
+		print('\tbuf.iterator += {:}; // padding'.format(span_padding))
+		print('\tbuf.offset += {:}; // padding'.format(span_padding))
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
-
-	if field_type == 'uint64' and field_name == 'timestamp':
-		print('\tconst uint64_t timestamp_adjusted = topic.timestamp + time_offset;')
-		print('\tmemcpy(buf.iterator, &timestamp_adjusted, sizeof(topic.{0}));'.format(field_name))
-
-	elif field_type == 'uint64' and field_name == 'timestamp_sample':
-		print('\tconst uint64_t timestamp_sample_adjusted = topic.timestamp_sample + time_offset;')
-		print('\tmemcpy(buf.iterator, &timestamp_sample_adjusted, sizeof(topic.{0}));'.format(field_name))
+	for field_type, field_name, field_size, field_offset in span_fields:
+		print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+		print('\tstatic_assert(offsetof({0}, {1}) == {2}, "layout mismatch");'.format(uorb_struct, field_name, span_offset + field_offset))
 
+	if len(span_fields) == 1:
+		print('\tmemcpy(buf.iterator, &topic.{0}, sizeof(topic.{0}));'.format(span_fields[0][1]))
 	else:
-		print('\tmemcpy(buf.iterator, &topic.{0}, sizeof(topic.{0}));'.format(field_name))
+		print('\tmemcpy(buf.iterator, topic_bytes + {0}, {1}); // {2} ... {3}'.format(span_offset, span_size, span_fields[0][1], span_fields[-1][1]))
+
+	for field_type, field_name, field_size, field_offset in span_fields:
+		if is_adjusted_timestamp(field_type, field_name):
+			print('\tconst uint64_t {0}_adjusted = topic.{0} + time_offset;'.format(field_name))
+			print('\tmemcpy(buf.iterator + {0}, &{1}_adjusted, sizeof(topic.{1}));'.format(field_offset, field_name))
 
-	print('\tbuf.iterator += sizeof(topic.{:});'.format(field_name))
-	print('\tbuf.offset += sizeof(topic.{:});'.format(field_name))
+	print('\tbuf.iterator += {:};'.format(span_size))
+	print('\tbuf.offset += {:};'.format(span_size))
 
 }@
 	return true;
@@ -155,21 +209,30 @@ for field_type, field_name, field_size, padding in fields:
 
 static inline bool ucdr_deserialize_@(topic)(ucdrBuffer& buf, @(uorb_struct)& topic, int64_t time_offset = 0)
 {
+@[if has_merged_spans]@
+	uint8_t *topic_bytes = reinterpret_cast<uint8_t*>(&topic);
+@[end if]@
 @{
-for field_type, field_name, field_size, padding in fields:
-	if padding > 0:
-		print('\tbuf.iterator += {:}; // padding'.format(padding))
-		print('\tbuf.offset += {:}; // padding'.format(padding))
+for span_padding, span_offset, span_size, span_fields in spans:
+	if span_padding > 0:
+		print('\tbuf.iterator += {:}; // padding'.format(span_padding))
+		print('\tbuf.offset += {:}; // padding'.format(span_padding))
+
+	for field_type, field_name, field_size, field_offset in span_fields:
+		print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
-	print('\tmemcpy(&topic.{0}, buf.iterator, sizeof(topic.{0}));'.format(field_name))
+	if len(span_fields) == 1:
+		print('\tmemcpy(&topic.{0}, buf.iterator, sizeof(topic.{0}));'.format(span_fields[0][1]))
+	else:
+		print('\tmemcpy(topic_bytes + {0}, buf.iterator, {1}); // {2} ... {3}'.format(span_offset, span_size, span_fields[0][1], span_fields[-1][1]))
 
-	if field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample'):
-		print('\tif (topic.{0} == 0) topic.{0} = hrt_absolute_time();'.format(field_name, field_name))
-		print('\telse topic.{0} = math::min(topic.{0} - time_offset, hrt_absolute_time());'.format(field_name, field_name))
+	for field_type, field_name, field_size, field_offset in span_fields:
+		if is_adjusted_timestamp(field_type, field_name):
+			print('\tif (topic.{0} == 0) topic.{0} = hrt_absolute_time();'.format(field_name))
+			print('\telse topic.{0} = math::min(topic.{0} - time_offset, hrt_absolute_time());'.format(field_name))
 
-	print('\tbuf.iterator += sizeof(topic.{:});'.format(field_name))
-	print('\tbuf.offset += sizeof(topic.{:});'.format(field_name))
+	print('\tbuf.iterator += {:};'.format(span_size))
+	print('\tbuf.offset += {:};'.format(span_size))
 
 }@
 	return true;
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+Convert a file written by the 'profile' command into folded stacks
+("task;caller;function count" per line), the input format of flamegraph.pl
+(https://github.com/brendangregg/FlameGraph) and speedscope.
+
+The program counters are resolved with addr2line against the ELF file of the
+build. The stack only has two levels: the function of the link register is
+the caller if it differs from the sampled function (there is no unwinder on
+the target).
+
+Example:
+    Tools/profile_flamegraph.py -e build/px4_fmu-v6x_default/px4_fmu-v6x_default.elf profile.bin > profile.folded
+    flamegraph.pl profile.folded > profile.svg
+"""
+
+import argparse
+import collections
+import struct
+import subprocess
+import sys
+
+FILE_MAGIC = b'PX4PROF\0'
+FILE_VERSION = 1
+HEADER = struct.Struct('<8sII')
+TASK_RECORD = struct.Struct('<i16s')
+SAMPLE_RECORD = struct.Struct('<QiQQ')
+
+
+def read_profile(filename):
+    """ returns (interval_us, {pid: name}, [(timestamp, pid, pc, lr)]) """
+    with open(filename, 'rb') as f:
+        data = f.read()
+
+    magic, version, interval_us = HEADER.unpack_from(data, 0)
+
+    if magic != FILE_MAGIC or version != FILE_VERSION:
+        raise ValueError('{}: not a profile file or unsupported version {}'.format(filename, version))
+
+    tasks = {}
+    samples = []
+    pos = HEADER.size
+
+    while pos < len(data):
+        record_type = data[pos:pos + 1]
+        pos += 1
+
+        if record_type == b'T' and pos + TASK_RECORD.size <= len(data):
+            pid, name = TASK_RECORD.unpack_from(data, pos)
+            tasks[pid] = name.split(b'\0')[0].decode('utf-8', 'replace')
+            pos += TASK_RECORD.size
+
+        elif record_type == b'S' and pos + SAMPLE_RECORD.size <= len(data):
+            samples.append(SAMPLE_RECORD.unpack_from(data, pos))
+            pos += SAMPLE_RECORD.size
+
+        else:
+            # truncated file, e.g. the vehicle was powered off while sampling
+            break
+
+    return interval_us, tasks, samples
+
+
+def symbolize(addr2line, elf, addresses):
+    """ map addresses to function names with a single addr2line call """
+    addresses = sorted(addresses)
+
+    if not addresses:
+        return {}
+
+    result = subprocess.run([addr2line, '-f', '-C', '-e', elf] + ['{:x}'.format(a) for a in addresses],
+                            stdout=subprocess.PIPE, check=True, universal_newlines=True)
+    lines = result.stdout.splitlines()
+    # two lines per address: function, file:line
+    return {address: lines[2 * i] for i, address in enumerate(addresses)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('profile', help='file written by the profile command')
+    parser.add_argument('-e', '--elf', required=True, help='ELF file of the build that was profiled')
+    parser.add_argument('--addr2line', default='arm-none-eabi-addr2line',
+                        help='addr2line binary (use addr2line for SITL)')
+    parser.add_argument('--offset', type=lambda x: int(x, 0), default=0,
+                        help='load address to subtract, for position independent executables (SITL)')
+    parser.add_argument('--no-task', action='store_true', help='do not split the stacks by task')
+    args = parser.parse_args()
+
+    try:
+        interval_us, tasks, samples = read_profile(args.profile)
+
+    except (OSError, ValueError, struct.error) as e:
+        print('Error: {}'.format(e), file=sys.stderr)
+        return 1
+
+    def address(value):
+        # clear the Thumb bit, the link register points after the call
+        return (value & ~1) - args.offset
+
+    addresses = set()
+
+    for _, _, pc, lr in samples:
+        addresses.add(address(pc))
+
+        if lr:
+            addresses.add(address(lr) - 1)
+
+    symbols = symbolize(args.addr2line, args.elf, addresses)
+    stacks = collections.Counter()
+
+    for _, pid, pc, lr in samples:
+        function = symbols.get(address(pc), '??')
+        frames = [] if args.no_task else [tasks.get(pid, str(pid))]
+
+        if lr:
+            caller = symbols.get(address(lr) - 1, '??')
+
+            if caller != function:
+                frames.append(caller)
+
+        frames.append(function)
+        stacks[';'.join(f.replace(';', ':') for f in frames)] += 1
+
+    for stack, count in stacks.most_common():
+        print('{} {}'.format(stack, count))
+
+    print('{} samples at {} Hz'.format(len(samples), 1000000 // interval_us if interval_us else 0), file=sys.stderr)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
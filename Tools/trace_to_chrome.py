@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Convert a CSV file written by 'trace dump' into the Chrome trace event format
+(JSON), to be viewed with chrome://tracing or https://ui.perfetto.dev.
+
+Every work queue becomes a thread with the runs of its items as slices, the
+HRT callouts, uORB publications and interrupt handlers are shown on separate
+threads per CPU. The scheduling latency (from ScheduleNow() to the start of the
+run) is added to the arguments of every run.
+
+Example:
+    Tools/trace_to_chrome.py trace.csv -e build/px4_fmu-v6x_default/px4_fmu-v6x_default.elf -o trace.json
+"""
+
+import argparse
+import csv
+import json
+import subprocess
+import sys
+
+ADDRESS_EVENTS = ('hrt_callout', 'isr_enter', 'isr_exit')
+
+
+def symbolize(addr2line, elf, addresses):
+    """ map code addresses (hex strings) to function names with a single addr2line call """
+    addresses = sorted(addresses)
+
+    if not elf or not addresses:
+        return {}
+
+    result = subprocess.run([addr2line, '-f', '-C', '-e', elf] + addresses,
+                            stdout=subprocess.PIPE, check=True, universal_newlines=True)
+    lines = result.stdout.splitlines()
+    # two lines per address: function, file:line
+    return {address: lines[2 * i] for i, address in enumerate(addresses)}
+
+
+def convert(rows, symbols):
+    events = []
+    threads = {}
+    scheduled = {}
+
+    def thread(cpu, name):
+        key = (cpu, name)
+
+        if key not in threads:
+            threads[key] = len(threads) + 1
+            events.append({'name': 'thread_name', 'ph': 'M', 'pid': cpu, 'tid': threads[key],
+                           'args': {'name': name}})
+
+        return threads[key]
+
+    for row in sorted(rows, key=lambda r: int(r['timestamp'])):
+        ts = int(row['timestamp'])
+        cpu = int(row['cpu'])
+        event = row['event']
+        name = symbols.get(row['name'], row['name'])
+        arg = int(row['arg'])
+
+        if event == 'wq_add':
+            # items are scheduled from any thread, show it on the queue they run on
+            scheduled[name] = ts
+            events.append({'name': 'schedule ' + name, 'ph': 'i', 's': 't', 'ts': ts, 'pid': cpu,
+                           'tid': thread(cpu, row['context'])})
+
+        elif event == 'run_start':
+            args = {'worker': arg}
+
+            if name in scheduled:
+                args['latency_us'] = ts - scheduled.pop(name)
+
+            events.append({'name': name, 'ph': 'B', 'ts': ts, 'pid': cpu, 'tid': thread(cpu, row['context']),
+                           'args': args})
+
+        elif event == 'run_end':
+            events.append({'name': name, 'ph': 'E', 'ts': ts, 'pid': cpu, 'tid': thread(cpu, row['context'])})
+
+        elif event == 'hrt_callout':
+            events.append({'name': name, 'ph': 'i', 's': 't', 'ts': ts, 'pid': cpu, 'tid': thread(cpu, 'hrt'),
+                           'args': {'lateness_us': arg}})
+
+        elif event == 'publish':
+            events.append({'name': name, 'ph': 'i', 's': 't', 'ts': ts, 'pid': cpu, 'tid': thread(cpu, 'uORB'),
+                           'args': {'instance': arg}})
+
+        elif event in ('isr_enter', 'isr_exit'):
+            events.append({'name': 'irq {} {}'.format(arg, name), 'ph': 'B' if event == 'isr_enter' else 'E',
+                           'ts': ts, 'pid': cpu, 'tid': thread(cpu, 'irq')})
+
+    for cpu in sorted(set(cpu for cpu, _ in threads)):
+        events.append({'name': 'process_name', 'ph': 'M', 'pid': cpu, 'args': {'name': 'CPU {}'.format(cpu)}})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('trace', help='CSV file written by trace dump')
+    parser.add_argument('-o', '--output', help='output JSON file (default: stdout)')
+    parser.add_argument('-e', '--elf', help='ELF file of the build, to resolve HRT callouts and interrupt handlers')
+    parser.add_argument('--addr2line', default='arm-none-eabi-addr2line',
+                        help='addr2line binary (use addr2line for SITL)')
+    args = parser.parse_args()
+
+    try:
+        with open(args.trace, newline='') as f:
+            rows = list(csv.DictReader(f))
+
+    except OSError as e:
+        print('Error: {}'.format(e), file=sys.stderr)
+        return 1
+
+    symbols = symbolize(args.addr2line, args.elf,
+                        set(row['name'] for row in rows if row['event'] in ADDRESS_EVENTS))
+    trace = convert(rows, symbols)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(trace, f)
+
+    else:
+        json.dump(trace, sys.stdout)
+        print()
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Convert a ULog file containing delta compressed data messages ('Z', written by
+the logger if SDLOG_COMPRESS is enabled) into a standard ULog file, where every
+sample is a plain data message ('D').
+
+The encoding is described in src/modules/logger/delta_compression.h.
+"""
+
+import argparse
+import struct
+import sys
+
+ULOG_HEADER_LEN = 16
+ULOG_MSG_HEADER_LEN = 3
+MSG_TYPE_DATA = ord('D')
+MSG_TYPE_DATA_COMPRESSED = ord('Z')
+
+
+def decode(encoded, previous):
+    """ decode a delta compressed message relative to the previous sample """
+    out = bytearray(previous)
+    pos = 0
+    i = 0
+
+    while i < len(encoded):
+        c = encoded[i]
+        i += 1
+
+        if c & 0x80:
+            pos += (c & 0x7f) + 1
+
+        else:
+            n = c + 1
+
+            if i + n > len(encoded) or pos + n > len(out):
+                raise ValueError('corrupt compressed message')
+
+            for k in range(n):
+                out[pos + k] ^= encoded[i + k]
+
+            i += n
+            pos += n
+
+        if pos > len(out):
+            raise ValueError('corrupt compressed message')
+
+    if pos != len(out):
+        raise ValueError('corrupt compressed message')
+
+    return bytes(out)
+
+
+def convert(data):
+    """ returns the converted log and the number of decompressed messages """
+    if len(data) < ULOG_HEADER_LEN or data[0:7] != b'ULog\x01\x12\x35':
+        raise ValueError('not a ULog file')
+
+    out = bytearray(data[0:ULOG_HEADER_LEN])
+    previous = {}  # msg_id -> last (reconstructed) sample
+    num_decompressed = 0
+    offset = ULOG_HEADER_LEN
+
+    while offset + ULOG_MSG_HEADER_LEN <= len(data):
+        msg_size, msg_type = struct.unpack_from('<HB', data, offset)
+        end = offset + ULOG_MSG_HEADER_LEN + msg_size
+
+        if end > len(data):
+            # truncated last message (e.g. power loss)
+            break
+
+        payload = data[offset + ULOG_MSG_HEADER_LEN:end]
+
+        if msg_type == MSG_TYPE_DATA and msg_size >= 2:
+            msg_id, = struct.unpack_from('<H', payload, 0)
+            previous[msg_id] = payload[2:]
+            out += data[offset:end]
+
+        elif msg_type == MSG_TYPE_DATA_COMPRESSED and msg_size >= 2:
+            msg_id, = struct.unpack_from('<H', payload, 0)
+
+            if msg_id not in previous:
+                raise ValueError('compressed message without a previous sample (msg_id {})'.format(msg_id))
+
+            sample = decode(payload[2:], previous[msg_id])
+            previous[msg_id] = sample
+            out += struct.pack('<HBH', len(sample) + 2, MSG_TYPE_DATA, msg_id)
+            out += sample
+            num_decompressed += 1
+
+        else:
+            out += data[offset:end]
+
+        offset = end
+
+    return out, num_decompressed
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description='Convert delta compressed data messages of a ULog file into plain data messages')
+    parser.add_argument('input', help='input .ulg file')
+    parser.add_argument('output', help='output .ulg file')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    try:
+        converted, num_decompressed = convert(data)
+
+    except ValueError as e:
+        print('Error: {}'.format(e))
+        sys.exit(1)
+
+    with open(args.output, 'wb') as f:
+        f.write(converted)
+
+    print('Decompressed {} messages'.format(num_decompressed))
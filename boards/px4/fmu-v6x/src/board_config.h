@@ -428,6 +428,9 @@
 /* This board provides a DMA pool and APIs */
 #define BOARD_DMA_ALLOC_POOL_SIZE 5120
 
+/* Boot-time arena for long-lived module allocations (see px4_platform_common/arena.h) */
+#define BOARD_ARENA_SIZE (96 * 1024)
+
 /* This board provides the board_on_reset interface */
 
 #define BOARD_HAS_ON_RESET 1
@@ -52,5 +52,8 @@
 #define BOARD_ARMED_LED        LED_BLUE
 #define BOARD_ARMED_STATE_LED  LED_GREEN
 
+/* Boot-time arena for long-lived module allocations (see px4_platform_common/arena.h) */
+#define BOARD_ARENA_SIZE (1024 * 1024)
+
 #include <system_config.h>
 #include <px4_platform_common/board_common.h>
@@ -79,6 +79,11 @@ ssize_t Serial::readAtLeast(uint8_t *buffer, size_t buffer_size, size_t characte
 	return _impl.readAtLeast(buffer, buffer_size, character_count, timeout_ms);
 }
 
+ssize_t Serial::readUntilIdle(uint8_t *buffer, size_t buffer_size, uint32_t idle_us, uint32_t timeout_ms)
+{
+	return _impl.readUntilIdle(buffer, buffer_size, idle_us, timeout_ms);
+}
+
 ssize_t Serial::write(const void *buffer, size_t buffer_size)
 {
 	return _impl.write(buffer, buffer_size);
@@ -0,0 +1,247 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <px4_platform_common/arena.h>
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace
+{
+
+struct BlockHeader {
+	uint32_t size;   ///< usable block size [bytes]
+	uint8_t owner;   ///< index into owners[]
+	bool heap;       ///< allocated from the heap instead of the arena
+};
+
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+struct Owner {
+	const char *name;
+	uint32_t arena_bytes;
+	uint32_t heap_bytes;
+	uint16_t blocks;
+};
+
+static constexpr size_t ALIGNMENT = alignof(max_align_t);
+static constexpr size_t HEADER_SIZE = (sizeof(BlockHeader) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+static constexpr int MAX_OWNERS = 24; ///< the last entry collects all others
+
+static pthread_mutex_t arena_mutex = PTHREAD_MUTEX_INITIALIZER;
+static Owner owners[MAX_OWNERS] {};
+
+#if defined(BOARD_ARENA_SIZE)
+alignas(max_align_t) static uint8_t arena[BOARD_ARENA_SIZE];
+static size_t arena_used{0};
+static FreeBlock *free_blocks{nullptr};
+#endif // BOARD_ARENA_SIZE
+
+static uint8_t owner_index(const char *name)
+{
+	if (name == nullptr) {
+		name = "unknown";
+	}
+
+	for (int i = 0; i < MAX_OWNERS - 1; ++i) {
+		if (owners[i].name == nullptr) {
+			owners[i].name = name;
+			return i;
+		}
+
+		if (owners[i].name == name || strcmp(owners[i].name, name) == 0) {
+			return i;
+		}
+	}
+
+	owners[MAX_OWNERS - 1].name = "other";
+	return MAX_OWNERS - 1;
+}
+
+static inline BlockHeader *header_of(void *ptr)
+{
+	return reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(ptr) - HEADER_SIZE);
+}
+
+#if defined(BOARD_ARENA_SIZE)
+static BlockHeader *arena_block(size_t size)
+{
+	// reuse the smallest freed block that fits
+	FreeBlock **best = nullptr;
+
+	for (FreeBlock **block = &free_blocks; *block != nullptr; block = &(*block)->next) {
+		const uint32_t block_size = header_of(*block)->size;
+
+		if (block_size >= size && (best == nullptr || block_size < header_of(*best)->size)) {
+			best = block;
+		}
+	}
+
+	if (best) {
+		FreeBlock *block = *best;
+		*best = block->next;
+		return header_of(block);
+	}
+
+	if (arena_used + HEADER_SIZE + size > BOARD_ARENA_SIZE) {
+		return nullptr;
+	}
+
+	BlockHeader *header = reinterpret_cast<BlockHeader *>(&arena[arena_used]);
+	header->size = size;
+	arena_used += HEADER_SIZE + size;
+	return header;
+}
+#endif // BOARD_ARENA_SIZE
+
+} // namespace
+
+void *px4_arena_alloc(size_t size, const char *owner)
+{
+	size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+	if (size < sizeof(FreeBlock)) {
+		size = sizeof(FreeBlock);
+	}
+
+	if (size > UINT32_MAX - HEADER_SIZE) {
+		return nullptr;
+	}
+
+	pthread_mutex_lock(&arena_mutex);
+
+	BlockHeader *header = nullptr;
+
+#if defined(BOARD_ARENA_SIZE)
+	header = arena_block(size);
+
+	if (header) {
+		header->heap = false;
+	}
+
+#endif // BOARD_ARENA_SIZE
+
+	if (header == nullptr) {
+		header = static_cast<BlockHeader *>(malloc(HEADER_SIZE + size));
+
+		if (header == nullptr) {
+			pthread_mutex_unlock(&arena_mutex);
+			return nullptr;
+		}
+
+		header->size = size;
+		header->heap = true;
+	}
+
+	header->owner = owner_index(owner);
+	Owner &stats = owners[header->owner];
+
+	if (header->heap) {
+		stats.heap_bytes += header->size;
+
+	} else {
+		stats.arena_bytes += header->size;
+	}
+
+	++stats.blocks;
+
+	pthread_mutex_unlock(&arena_mutex);
+
+	return reinterpret_cast<uint8_t *>(header) + HEADER_SIZE;
+}
+
+void px4_arena_free(void *ptr)
+{
+	if (ptr == nullptr) {
+		return;
+	}
+
+	BlockHeader *header = header_of(ptr);
+
+	pthread_mutex_lock(&arena_mutex);
+
+	Owner &stats = owners[header->owner];
+	--stats.blocks;
+
+	if (header->heap) {
+		stats.heap_bytes -= header->size;
+		free(header);
+
+	} else {
+		stats.arena_bytes -= header->size;
+#if defined(BOARD_ARENA_SIZE)
+		FreeBlock *block = static_cast<FreeBlock *>(ptr);
+		block->next = free_blocks;
+		free_blocks = block;
+#endif // BOARD_ARENA_SIZE
+	}
+
+	pthread_mutex_unlock(&arena_mutex);
+}
+
+void px4_arena_print_status(FILE *out)
+{
+	pthread_mutex_lock(&arena_mutex);
+
+#if defined(BOARD_ARENA_SIZE)
+	size_t free_bytes = 0;
+	int num_free_blocks = 0;
+
+	for (FreeBlock *block = free_blocks; block != nullptr; block = block->next) {
+		free_bytes += header_of(block)->size;
+		++num_free_blocks;
+	}
+
+	fprintf(out, "arena: %zu bytes, %zu used, %zu unused, %i freed blocks (%zu bytes)\n", (size_t)BOARD_ARENA_SIZE,
+		arena_used, (size_t)BOARD_ARENA_SIZE - arena_used, num_free_blocks, free_bytes);
+#else
+	fprintf(out, "arena: not enabled on this board (BOARD_ARENA_SIZE), using the heap\n");
+#endif // BOARD_ARENA_SIZE
+
+	fprintf(out, "%-16s %10s %10s %7s\n", "owner", "arena", "heap", "blocks");
+
+	for (int i = 0; i < MAX_OWNERS; ++i) {
+		if (owners[i].name) {
+			fprintf(out, "%-16s %10" PRIu32 " %10" PRIu32 " %7u\n", owners[i].name, owners[i].arena_bytes, owners[i].heap_bytes,
+				owners[i].blocks);
+		}
+	}
+
+	pthread_mutex_unlock(&arena_mutex);
+}
@@ -600,6 +600,95 @@ static void initializer_trampoline(void *argument)
 	data->instance = data->instantiate(data->config, data->runtime_instance);
 }
 
+/**
+ * A pending probe of one bus (device), scheduled on the work queue of that bus.
+ * The iterator state needed after the probe finished is copied, since the iterator moves on.
+ */
+struct I2CSPIDriverProbe {
+	I2CSPIDriverProbe(const BusCLIArguments &cli, const BusInstanceIterator &iterator, const px4::wq_config_t &wq_config,
+			  I2CSPIDriverBase::instantiate_method instantiate, int runtime_instance)
+		: config{cli, iterator, wq_config},
+		  initializing{config, instantiate, runtime_instance},
+		  initializer(wq_config, initializer_trampoline, &initializing),
+		  devid(iterator.devid()),
+		  external(iterator.external()),
+		  external_bus_index(iterator.externalBusIndex())
+	{}
+
+	I2CSPIDriverConfig config;
+	I2CSPIDriverInitializing initializing;
+	px4::WorkItemSingleShot initializer;
+	const uint32_t devid;
+	const bool external;
+	const int external_bus_index;
+};
+
+/**
+ * Register the instance of a finished probe and print some info that we are running.
+ * @return true if an instance got started
+ */
+static bool register_probed_instance(const I2CSPIDriverProbe &probe, const BusCLIArguments &cli,
+				     BusInstanceIterator &iterator)
+{
+	I2CSPIDriverBase *instance = probe.initializing.instance;
+	const I2CSPIDriverConfig &config = probe.config;
+
+	if (!instance) {
+		PX4_DEBUG("instantiate failed (no device on bus %i (devid 0x%" PRIx32 ")?)", config.bus, probe.devid);
+		return false;
+	}
+
+	// instances are numbered in bus order, independent of which probe finished first
+	switch (config.bus_type) {
+#if defined(CONFIG_I2C)
+
+	case BOARD_I2C_BUS:
+		PX4_INFO_RAW("%s #%i on I2C bus %d", instance->ItemName(),
+			     iterator.runningInstancesCount(), config.bus);
+
+		if (probe.external) {
+			PX4_INFO_RAW(" (external)");
+		}
+
+		if (cli.i2c_address != 0) {
+			PX4_INFO_RAW(" address 0x%X", cli.i2c_address);
+		}
+
+		if (cli.rotation != 0) {
+			PX4_INFO_RAW(" rotation %d", cli.rotation);
+		}
+
+		PX4_INFO_RAW("\n");
+
+		break;
+#endif // CONFIG_I2C
+#if defined(CONFIG_SPI)
+
+	case BOARD_SPI_BUS:
+		PX4_INFO_RAW("%s #%i on SPI bus %d", instance->ItemName(),
+			     iterator.runningInstancesCount(), config.bus);
+
+		if (probe.external) {
+			PX4_INFO_RAW(" (external, equal to '-b %i')", probe.external_bus_index);
+		}
+
+		if (cli.rotation != 0) {
+			PX4_INFO_RAW(" rotation %d", cli.rotation);
+		}
+
+		PX4_INFO_RAW("\n");
+
+		break;
+#endif // CONFIG_SPI
+
+	case BOARD_INVALID_BUS:
+		break;
+	}
+
+	iterator.addInstance(instance);
+	return true;
+}
+
 int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterator &iterator,
 				   void(*print_usage)(), instantiate_method instantiate)
 {
@@ -609,8 +698,34 @@ int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterat
 		return -1;
 	}
 
+	// Probing a bus can take a while (device resets, timeouts on empty buses). Each bus has its own work queue,
+	// so all probes are scheduled first and run in parallel, then collected in bus order.
+	static constexpr int MAX_PARALLEL_PROBES = 8;
+	I2CSPIDriverProbe *probes[MAX_PARALLEL_PROBES] {};
+	int num_probes = 0;
 	bool started = false;
 
+	auto finish_pending_probes = [&]() {
+		for (int i = 0; i < num_probes; ++i) {
+			probes[i]->initializer.wait();
+
+#if defined(CONFIG_I2C)
+			const I2CSPIDriverBase *instance = probes[i]->initializing.instance;
+
+			if (instance && cli.i2c_address != 0 && instance->_i2c_address == 0) {
+				PX4_ERR("Bug: driver %s does not pass the I2C address to I2CSPIDriverBase", instance->ItemName());
+			}
+
+#endif // CONFIG_I2C
+
+			started |= register_probed_instance(*probes[i], cli, iterator);
+			delete probes[i];
+			probes[i] = nullptr;
+		}
+
+		num_probes = 0;
+	};
+
 	while (iterator.next()) {
 		if (iterator.instance()) {
 			PX4_WARN("Already running on bus %i", iterator.bus());
@@ -635,79 +750,27 @@ int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterat
 		case BOARD_INVALID_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_UNKNOWN; break;
 		}
 
-
-		const px4::wq_config_t &wq_config = px4::device_bus_to_wq(device_id.devid);
-		I2CSPIDriverConfig driver_config{cli, iterator, wq_config};
-		const int runtime_instance = iterator.runningInstancesCount();
-		I2CSPIDriverInitializing initializer_data{driver_config, instantiate, runtime_instance};
-		// initialize the object and bus on the work queue thread - this will also probe for the device
-		px4::WorkItemSingleShot initializer(wq_config, initializer_trampoline, &initializer_data);
-		initializer.ScheduleNow();
-		initializer.wait();
-		I2CSPIDriverBase *instance = initializer_data.instance;
-
-		if (!instance) {
-			PX4_DEBUG("instantiate failed (no device on bus %i (devid 0x%x)?)", iterator.bus(), iterator.devid());
-			continue;
-		}
-
-#if defined(CONFIG_I2C)
-
-		if (cli.i2c_address != 0 && instance->_i2c_address == 0) {
-			PX4_ERR("Bug: driver %s does not pass the I2C address to I2CSPIDriverBase", instance->ItemName());
+		if (num_probes == MAX_PARALLEL_PROBES) {
+			finish_pending_probes();
 		}
 
-#endif // CONFIG_I2C
-
-		iterator.addInstance(instance);
-		started = true;
-
-		// print some info that we are running
-		switch (iterator.busType()) {
-#if defined(CONFIG_I2C)
-
-		case BOARD_I2C_BUS:
-			PX4_INFO_RAW("%s #%i on I2C bus %d", instance->ItemName(), runtime_instance, iterator.bus());
-
-			if (iterator.external()) {
-				PX4_INFO_RAW(" (external)");
-			}
-
-			if (cli.i2c_address != 0) {
-				PX4_INFO_RAW(" address 0x%X", cli.i2c_address);
-			}
-
-			if (cli.rotation != 0) {
-				PX4_INFO_RAW(" rotation %d", cli.rotation);
-			}
-
-			PX4_INFO_RAW("\n");
-
-			break;
-#endif // CONFIG_I2C
-#if defined(CONFIG_SPI)
-
-		case BOARD_SPI_BUS:
-			PX4_INFO_RAW("%s #%i on SPI bus %d", instance->ItemName(), runtime_instance, iterator.bus());
-
-			if (iterator.external()) {
-				PX4_INFO_RAW(" (external, equal to '-b %i')", iterator.externalBusIndex());
-			}
-
-			if (cli.rotation != 0) {
-				PX4_INFO_RAW(" rotation %d", cli.rotation);
-			}
-
-			PX4_INFO_RAW("\n");
-
-			break;
-#endif // CONFIG_SPI
+		const px4::wq_config_t &wq_config = px4::device_bus_to_wq(device_id.devid);
+		// the instance index is only a hint here, the final one is assigned in register_probed_instance()
+		const int runtime_instance = iterator.runningInstancesCount() + num_probes;
+		I2CSPIDriverProbe *probe = new I2CSPIDriverProbe(cli, iterator, wq_config, instantiate, runtime_instance);
 
-		case BOARD_INVALID_BUS:
+		if (probe == nullptr) {
+			PX4_ERR("alloc failed");
 			break;
 		}
+
+		// initialize the object and bus on the work queue thread - this will also probe for the device
+		probe->initializer.ScheduleNow();
+		probes[num_probes++] = probe;
 	}
 
+	finish_pending_probes();
+
 	if (!started && !cli.quiet_start) {
 		static constexpr char no_instance_started[] {"no instance started (no device on bus?)"};
 
@@ -64,6 +64,11 @@ public:
 	ssize_t read(uint8_t *buffer, size_t buffer_size);
 	ssize_t readAtLeast(uint8_t *buffer, size_t buffer_size, size_t character_count = 1, uint32_t timeout_ms = 0);
 
+	// Wait up to timeout_ms for data, then read once the line has been idle for idle_us
+	// (the end of a frame) or buffer_size bytes are available. This wakes up a few times per frame
+	// instead of once per few characters, with RX DMA the data only shows up at the end of the frame anyway.
+	ssize_t readUntilIdle(uint8_t *buffer, size_t buffer_size, uint32_t idle_us, uint32_t timeout_ms);
+
 	ssize_t write(const void *buffer, size_t buffer_size);
 
 	void flush();
@@ -0,0 +1,83 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file arena.h
+ * Boot-time arena for long-lived allocations of modules.
+ *
+ * Modules allocating large objects when they are started (e.g. estimator instances) can opt in to allocate
+ * them from a statically reserved memory region instead of the heap. This avoids heap fragmentation and the
+ * heap search on startup. Freed blocks are kept and reused for allocations of up to the same size (e.g. when a
+ * module is restarted). If the arena is exhausted, or the board does not define BOARD_ARENA_SIZE, the heap is used.
+ *
+ * Usage: add PX4_ARENA_ALLOCATED("module_name") to the class declaration.
+ */
+
+#pragma once
+
+#include <px4_platform_common/px4_config.h>
+
+#include <stddef.h>
+#include <stdio.h>
+
+__BEGIN_DECLS
+
+/**
+ * Allocate memory from the boot arena (or the heap as fallback)
+ * @param size number of bytes
+ * @param owner name used for the usage report, must be a static string
+ * @return pointer or nullptr if out of memory
+ */
+__EXPORT void *px4_arena_alloc(size_t size, const char *owner);
+
+/**
+ * Free memory returned by px4_arena_alloc(). Arena blocks are kept for reuse.
+ */
+__EXPORT void px4_arena_free(void *ptr);
+
+/**
+ * Print arena usage per owner
+ */
+__EXPORT void px4_arena_print_status(FILE *out);
+
+__END_DECLS
+
+#ifdef __cplusplus
+/**
+ * Use the arena for dynamic allocations (new/delete) of a class
+ */
+#define PX4_ARENA_ALLOCATED(owner) \
+	static void *operator new(size_t size) noexcept { return px4_arena_alloc(size, owner); } \
+	static void operator delete(void *ptr) noexcept { px4_arena_free(ptr); }
+#endif // __cplusplus
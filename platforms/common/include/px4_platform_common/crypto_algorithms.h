@@ -43,4 +43,5 @@ typedef enum {
 	CRYPTO_XCHACHA20 = 2,
 	CRYPTO_AES = 3,
 	CRYPTO_RSA_OAEP = 4,
+	CRYPTO_HMAC_SHA256 = 5,
 } px4_crypto_algorithm_t;
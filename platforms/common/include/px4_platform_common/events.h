@@ -92,8 +92,11 @@ constexpr unsigned sizeofArguments(const T &t, const Args &... args)
 
 /**
  * publish/send an event
+ * @param deduplicate drop the event if an identical one was sent shortly before.
+ *                    Disable it for events that are part of a group the receiver needs completely,
+ *                    like the health and arming check reports.
  */
-void send(event_s &event);
+void send(event_s &event, bool deduplicate = true);
 
 /**
  * Generate event ID from an event name
@@ -83,11 +83,14 @@ protected:
 	 */
 	virtual void updateParams()
 	{
+		const uint32_t instance = param_update_instance();
+
 		for (const auto &child : _children) {
 			child->updateParams();
 		}
 
 		updateParamsImpl();
+		_param_update_instance = instance;
 	}
 
 	/**
@@ -95,6 +98,9 @@ protected:
 	 */
 	virtual void updateParamsImpl() {}
 
+	/** notification instance of the last update, updateParamsImpl() only updates parameters that changed since then */
+	uint32_t _param_update_instance{param_update_instance()};
+
 private:
 	/** @list _children The module parameter list of inheriting classes. */
 	List<ModuleParams *> _children;
@@ -60,9 +60,9 @@ inline static param_t param_handle(px4::params p)
 	do_not_explicitly_use_this_namespace::PAIR(x);
 
 #define _CALL_UPDATE(x) \
-	STRIP(x).update();
+	if (param_changed_since(STRIP(x).handle(), _param_update_instance)) { STRIP(x).update(); }
 
-// define the parameter update method, which will update all parameters.
+// define the parameter update method, which will update all parameters that changed since the last update.
 // It is marked as 'final', so that wrong usages lead to a compile error (see below)
 #define _DEFINE_PARAMETER_UPDATE_METHOD(...) \
 	protected: \
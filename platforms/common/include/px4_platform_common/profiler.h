@@ -0,0 +1,171 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file profiler.h
+ *
+ * Sampling profiler: a periodic interrupt (the HRT on NuttX, SIGPROF on Linux)
+ * records the program counter and the task of the interrupted context into a
+ * lock-free ring buffer, which is drained by the profile command.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/defines.h>
+
+struct px4_profiler_sample_s {
+	uint64_t timestamp;	///< time of the sample [us]
+	uintptr_t pc;		///< program counter of the interrupted context
+	uintptr_t lr;		///< link register (return address) of the interrupted context, 0 if not available
+	int32_t pid;		///< task/thread id of the interrupted context
+};
+
+__BEGIN_DECLS
+
+/**
+ * Start sampling.
+ *
+ * @param interval_us sampling interval
+ * @param buffer_samples size of the ring buffer
+ * @return 0 on success, -errno otherwise (-ENOTSUP if the platform has no profiler)
+ */
+__EXPORT int px4_profiler_start(uint32_t interval_us, size_t buffer_samples);
+
+__EXPORT void px4_profiler_stop(void);
+
+__EXPORT bool px4_profiler_running(void);
+
+/**
+ * Remove the oldest samples from the ring buffer.
+ * @return number of samples copied into samples
+ */
+__EXPORT size_t px4_profiler_read(struct px4_profiler_sample_s *samples, size_t max_samples);
+
+/**
+ * @param recorded number of samples recorded since the start
+ * @param dropped number of samples lost because the ring buffer was full
+ */
+__EXPORT void px4_profiler_stats(uint32_t *recorded, uint32_t *dropped);
+
+/**
+ * Name of a task, as seen in the samples.
+ * @return 0 on success, -1 if the task does not exist (anymore)
+ */
+__EXPORT int px4_profiler_task_name(int32_t pid, char *name, size_t name_length);
+
+__END_DECLS
+
+#ifdef __cplusplus
+
+namespace px4
+{
+
+/**
+ * Single producer (interrupt or signal handler), single consumer ring buffer for the
+ * platform implementations. The producer never blocks, samples are dropped when full.
+ */
+class ProfilerBuffer
+{
+public:
+	ProfilerBuffer() = default;
+	~ProfilerBuffer() { delete[] _samples; }
+
+	// only while no producer is running
+	bool allocate(size_t size)
+	{
+		if ((_samples == nullptr) || (size != _size)) {
+			delete[] _samples;
+			_samples = new px4_profiler_sample_s[size];
+			_size = (_samples != nullptr) ? size : 0;
+		}
+
+		_head.store(0);
+		_tail.store(0);
+		_recorded.store(0);
+		_dropped.store(0);
+
+		return _samples != nullptr;
+	}
+
+	// producer
+	void push(const px4_profiler_sample_s &sample)
+	{
+		const uint32_t head = _head.load();
+
+		if (head - _tail.load() >= _size) {
+			_dropped.fetch_add(1);
+			return;
+		}
+
+		_samples[head % _size] = sample;
+		_head.store(head + 1);
+		_recorded.fetch_add(1);
+	}
+
+	// consumer
+	size_t read(px4_profiler_sample_s *samples, size_t max_samples)
+	{
+		const uint32_t head = _head.load();
+		uint32_t tail = _tail.load();
+		size_t count = 0;
+
+		while ((tail != head) && (count < max_samples)) {
+			samples[count++] = _samples[tail % _size];
+			tail++;
+		}
+
+		_tail.store(tail);
+		return count;
+	}
+
+	uint32_t recorded() const { return _recorded.load(); }
+	uint32_t dropped() const { return _dropped.load(); }
+
+private:
+	px4_profiler_sample_s *_samples{nullptr};
+	size_t _size{0};
+
+	px4::atomic<uint32_t> _head{0};
+	px4::atomic<uint32_t> _tail{0};
+	px4::atomic<uint32_t> _recorded{0};
+	px4::atomic<uint32_t> _dropped{0};
+};
+
+} // namespace px4
+
+#endif // __cplusplus
@@ -39,6 +39,7 @@
 #include <containers/IntrusiveQueue.hpp>
 #include <containers/IntrusiveSortedList.hpp>
 #include <px4_platform_common/defines.h>
+#include <px4_platform_common/vehicle_namespace.h>
 #include <drivers/drv_hrt.h>
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
@@ -72,6 +73,23 @@ public:
 
 	virtual void print_run_status();
 
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+	/**
+	 * Print the execution and queue wait time percentiles since the last reset.
+	 */
+	void print_runtime_statistics() const;
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+	/**
+	 * Set a deadline for each run, relative to the time the item is scheduled.
+	 * The WorkQueue runs pending items with a deadline earliest deadline first
+	 * (ahead of items without one), and counts the runs completing late
+	 * (misses) and schedule requests while a run is still pending (overruns).
+	 *
+	 * @param deadline_us		The relative deadline in microseconds, 0 to disable.
+	 */
+	void SetDeadline(uint32_t deadline_us) { _deadline_us = deadline_us; }
+
 	/**
 	 * Switch to a different WorkQueue.
 	 * NOTE: Caller is responsible for synchronization.
@@ -108,7 +126,7 @@ protected:
 		}
 	}
 
-	friend void WorkQueue::Run();
+	friend class WorkQueue;
 	virtual void Run() = 0;
 
 	/**
@@ -126,6 +144,11 @@ protected:
 	float average_rate() const;
 	float average_interval() const;
 
+	/**
+	 * Print the deadline statistics (if a deadline is set) and reset them.
+	 */
+	void print_deadline_status();
+
 	hrt_abstime	_time_first_run{0};
 	const char 	*_item_name;
 	uint32_t	_run_count{0};
@@ -134,6 +157,23 @@ private:
 
 	WorkQueue	*_wq{nullptr};
 
+	const uint8_t	_vehicle_namespace{px4::vehicle_namespace()};	///< namespace of the thread that created the item
+
+	// scheduling state, owned by the producer that set _queued until the WorkQueue takes the item
+	px4::atomic_bool _queued{false};	///< scheduled and not yet started
+	WorkItem	*_pending_next{nullptr};	///< link in the WorkQueue pending stack
+
+	// deadline scheduling
+	hrt_abstime	_deadline{0};		///< absolute deadline of the pending run, 0 if none
+	uint32_t	_deadline_us{0};
+	uint32_t	_deadline_misses{0};
+	px4::atomic<uint32_t> _overruns{0};
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+	hrt_abstime	_schedule_time{0};	///< time the pending run was scheduled
+	wq_runtime_stats_t _runtime_stats{};	///< updated by the WorkQueue running the item
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
 };
 
 } // namespace px4
@@ -67,11 +67,33 @@ public:
 
 	void Clear();
 
-	void Run();
+	/**
+	 * Process the queue until requested to stop. Called by each worker thread.
+	 * @param worker index of the worker thread (0...MAX_THREADS-1)
+	 */
+	void Run(unsigned worker = 0);
+
+	static constexpr unsigned MAX_THREADS = 4;
 
 	void request_stop() { _should_exit.store(true); }
 
-	void print_status(bool last = false);
+	void print_status(bool last = false, bool verbose = false);
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+	/**
+	 * Get the runtime statistics of an attached work item and reset them.
+	 * @param index	item index, decremented by the number of items if out of range
+	 * @return false if index is out of range
+	 */
+	bool get_runtime_statistics(unsigned &index, wq_runtime_stats_t &stats);
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+#if defined(__PX4_LINUX)
+	/**
+	 * Set the CPU affinity (0 for all CPUs) and scheduling policy of the work queue thread.
+	 */
+	int set_scheduling(uint32_t cpu_affinity, int policy);
+#endif // __PX4_LINUX
 
 	// WorkQueues sorted numerically by relative priority (-1 to -255)
 	bool operator<=(const WorkQueue &rhs) const { return _config.relative_priority >= rhs.get_config().relative_priority; }
@@ -82,6 +104,22 @@ private:
 
 	inline void SignalWorkerThread();
 
+	/**
+	 * Take the next item to run off the queue: the pending item with the earliest
+	 * deadline, or the first one if none has a deadline. Items being run by another
+	 * worker thread are skipped. Must be called locked.
+	 * @return item, nullptr if there is nothing to run
+	 */
+	WorkItem *PopNext();
+
+	bool is_running(const WorkItem *item) const;
+
+	/**
+	 * Move the items scheduled since the last call from the pending stack to the queue.
+	 * Must be called locked.
+	 */
+	void ProcessPending();
+
 #ifdef __PX4_NUTTX
 	// In NuttX work can be enqueued from an ISR
 	void work_lock() { _flags = enter_critical_section(); }
@@ -94,17 +132,33 @@ private:
 	px4_sem_t _qlock;
 #endif
 
+	px4::atomic<WorkItem *>		_pending{nullptr};	///< lock-free stack of newly scheduled items (multiple producers)
 	IntrusiveQueue<WorkItem *>	_q;
+	unsigned			_q_deadline_items{0};	///< number of queued items with a deadline
+	WorkItem			*_running_items[MAX_THREADS] {};	///< item being run by each worker, cleared if it detaches meanwhile
 	px4_sem_t			_process_lock;
 	px4_sem_t			_exit_lock;
 	const wq_config_t		&_config;
 	BlockingList<WorkItem *>	_work_items;
 	px4::atomic_bool		_should_exit{false};
 
+#if defined(__PX4_LINUX)
+	pthread_t			_thread;
+#endif // __PX4_LINUX
+
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 	int _lockstep_component {-1};
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+	// maximum number of consecutive chained items before falling back to the queue
+	static constexpr unsigned MAX_CHAIN_LENGTH = 4;
+
+	pthread_t			_worker_thread;		///< thread processing the queue (single threaded queues only)
+	WorkItem			*_chained{nullptr};	///< item to run right after the running item
+	unsigned			_chain_length{0};	///< consecutive chained items run so far
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 };
 
 } // namespace px4
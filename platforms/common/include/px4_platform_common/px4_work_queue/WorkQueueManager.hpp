@@ -33,6 +33,8 @@
 
 #pragma once
 
+#include <px4_platform_common/px4_config.h>
+
 #include <stdint.h>
 
 namespace px4
@@ -44,7 +46,41 @@ struct wq_config_t {
 	const char *name;
 	uint16_t stacksize;
 	int8_t relative_priority; // relative to max
+	uint8_t threads{1}; // number of worker threads sharing the queue (POSIX only)
+};
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+struct wq_runtime_stats_t {
+	// log2 bins: bin i counts times below 2^(i+1) us, the last bin all longer ones
+	static constexpr unsigned NUM_BINS = 16;
+
+	uint32_t runtime_bins[NUM_BINS];
+	uint32_t wait_bins[NUM_BINS];
+	uint32_t runtime_max_us;
+	uint32_t wait_max_us;
+
+	char item_name[24];
+	const char *wq_name;
+
+	static void add(uint32_t bins[NUM_BINS], uint32_t &max_us, uint32_t time_us)
+	{
+		const unsigned bin = (time_us < 2) ? 0 : (31 - __builtin_clz(time_us));
+		bins[(bin < NUM_BINS) ? bin : (NUM_BINS - 1)]++;
+
+		if (time_us > max_us) {
+			max_us = time_us;
+		}
+	}
+
+	/**
+	 * @param percent percentile (0-100)
+	 * @return upper bound in us of the bin containing the percentile, limited to the maximum
+	 */
+	static uint32_t percentile(const uint32_t bins[NUM_BINS], uint32_t max_us, unsigned percent);
+
+	static uint32_t count(const uint32_t bins[NUM_BINS]);
 };
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
 
 namespace wq_configurations
 {
@@ -91,6 +127,14 @@ static constexpr wq_config_t ttyUnknown{"wq:ttyUnknown", 1728, -32};
 
 static constexpr wq_config_t lp_default{"wq:lp_default", 2350, -50};
 
+// Low priority work spread over multiple threads on POSIX. Items on this queue never run
+// concurrently with themselves, but may run concurrently with any other item on the queue.
+#if defined(__PX4_POSIX)
+static constexpr wq_config_t lp_parallel{"wq:lp_parallel", 2350, -51, 4};
+#else
+static constexpr wq_config_t lp_parallel{"wq:lp_parallel", 2350, -51};
+#endif
+
 static constexpr wq_config_t test1{"wq:test1", 2000, 0};
 static constexpr wq_config_t test2{"wq:test2", 2000, 0};
 
@@ -108,8 +152,32 @@ int WorkQueueManagerStop();
 
 /**
  * Work queue manager status.
+ * @param verbose	Also print the execution and queue wait time statistics of each item.
+ */
+int WorkQueueManagerStatus(bool verbose = false);
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+/**
+ * Get the execution and queue wait time statistics of a work item and reset them.
+ *
+ * @param index		Index of the work item, counting over all work queues.
+ * @param stats		Output statistics.
+ * @return		false if index is out of range.
+ */
+bool WorkQueueManagerGetRuntimeStatistics(unsigned index, wq_runtime_stats_t &stats);
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+/**
+ * Pin a work queue thread to a set of CPUs and set its scheduling policy (Linux only).
+ * Takes effect immediately if the work queue is running, otherwise once it is created,
+ * so it can be called from the startup script before any module is started.
+ *
+ * @param name			The work queue name (eg "wq:rate_ctrl").
+ * @param cpu_affinity		Bitmask of the CPUs the thread may run on, 0 for all.
+ * @param policy		The scheduling policy (SCHED_FIFO, SCHED_RR or SCHED_OTHER).
+ * @return		PX4_OK on success.
  */
-int WorkQueueManagerStatus();
+int WorkQueueSetScheduling(const char *name, uint32_t cpu_affinity, int policy);
 
 /**
  * Create (or find) a work queue with a particular configuration.
@@ -0,0 +1,130 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file trace.h
+ *
+ * Scheduling trace: timestamped events of the work queues, HRT callouts,
+ * selected uORB topics and interrupt handlers, recorded into per-CPU
+ * lock-free rings (flight recorder, the oldest events are overwritten).
+ * Enabled with CONFIG_PX4_TRACE, controlled and exported with the trace command.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/defines.h>
+
+enum px4_trace_event_e {
+	PX4_TRACE_WQ_ADD = 0,		///< work item scheduled, name: item, context: queue
+	PX4_TRACE_WQ_RUN_START,		///< name: item, context: queue
+	PX4_TRACE_WQ_RUN_END,		///< name: item, context: queue
+	PX4_TRACE_HRT_CALLOUT,		///< name: callout function (address), arg: lateness [us]
+	PX4_TRACE_ORB_PUBLISH,		///< name: topic, arg: instance
+	PX4_TRACE_ISR_ENTER,		///< name: handler (address), arg: irq
+	PX4_TRACE_ISR_EXIT,		///< name: handler (address), arg: irq
+	PX4_TRACE_EVENT_COUNT
+};
+
+struct px4_trace_record_s {
+	uint64_t timestamp;	///< [us]
+	uintptr_t name;		///< name string (const char *) or code address, depending on the event
+	uintptr_t context;	///< name string (const char *) or 0, depending on the event
+	uint32_t arg;		///< event specific
+	uint32_t sequence;	///< index in the ring + 1, written last, 0 while the record is written
+	uint8_t event;		///< px4_trace_event_e
+	uint8_t cpu;
+};
+
+__BEGIN_DECLS
+
+/**
+ * Allocate the rings and start recording.
+ * @param records_per_cpu ring size
+ * @return 0 on success, -errno otherwise
+ */
+__EXPORT int px4_trace_start(size_t records_per_cpu);
+
+/**
+ * Stop recording, the recorded events stay available for px4_trace_read().
+ */
+__EXPORT void px4_trace_stop(void);
+
+__EXPORT bool px4_trace_running(void);
+
+/**
+ * Record an event, callable from any context including interrupts. No-op if not running.
+ */
+__EXPORT void px4_trace_record(uint8_t event, uintptr_t name, uintptr_t context, uint32_t arg);
+
+/**
+ * Select a uORB topic (by ORB_ID) for PX4_TRACE_ORB_PUBLISH events, all are deselected initially.
+ */
+__EXPORT void px4_trace_select_topic(uint16_t orb_id, bool selected);
+__EXPORT bool px4_trace_topic_selected(uint16_t orb_id);
+
+/**
+ * Number of rings (CPUs the events were recorded on).
+ */
+__EXPORT unsigned px4_trace_ring_count(void);
+
+/**
+ * Copy out the valid records of a ring after px4_trace_stop(), oldest first.
+ * @param ring ring index
+ * @param index position to start at, 0 for the oldest record, updated for the next call
+ * @return number of records copied
+ */
+__EXPORT size_t px4_trace_read(unsigned ring, size_t *index, struct px4_trace_record_s *records, size_t max_records);
+
+/**
+ * @return number of events recorded into a ring since the start, including overwritten ones
+ */
+__EXPORT uint32_t px4_trace_recorded(unsigned ring);
+
+__END_DECLS
+
+#if defined(CONFIG_PX4_TRACE)
+# define PX4_TRACE(event, name, context, arg) px4_trace_record((event), (uintptr_t)(name), (uintptr_t)(context), (arg))
+# define PX4_TRACE_TOPIC(meta, instance) do { \
+		if (px4_trace_topic_selected((meta)->o_id)) { \
+			px4_trace_record(PX4_TRACE_ORB_PUBLISH, (uintptr_t)(meta)->o_name, 0, (instance)); \
+		} \
+	} while (0)
+#else
+# define PX4_TRACE(event, name, context, arg)
+# define PX4_TRACE_TOPIC(meta, instance)
+#endif // CONFIG_PX4_TRACE
@@ -0,0 +1,83 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file vehicle_namespace.h
+ *
+ * Vehicle namespace of the calling thread, to run several vehicle instances within one process.
+ * uORB uses a separate set of topics per namespace. Threads spawned with px4_task_spawn_cmd()
+ * inherit the namespace of their parent and work items run in the namespace they were created in,
+ * so the work queue threads are shared between all vehicles.
+ */
+
+#pragma once
+
+#include <px4_platform_common/px4_config.h>
+
+#include <stdint.h>
+
+namespace px4
+{
+
+#if defined(CONFIG_ORB_NAMESPACES) && (CONFIG_ORB_NAMESPACES > 1)
+
+static constexpr uint8_t VEHICLE_NAMESPACES = CONFIG_ORB_NAMESPACES;
+
+namespace detail
+{
+inline thread_local uint8_t vehicle_namespace{0};
+} // namespace detail
+
+inline uint8_t vehicle_namespace() { return detail::vehicle_namespace; }
+
+inline bool set_vehicle_namespace(uint8_t vehicle_namespace)
+{
+	if (vehicle_namespace >= VEHICLE_NAMESPACES) {
+		return false;
+	}
+
+	detail::vehicle_namespace = vehicle_namespace;
+	return true;
+}
+
+#else
+
+static constexpr uint8_t VEHICLE_NAMESPACES = 1;
+
+inline uint8_t vehicle_namespace() { return 0; }
+inline bool set_vehicle_namespace(uint8_t vehicle_namespace) { return vehicle_namespace == 0; }
+
+#endif
+
+} // namespace px4
@@ -0,0 +1,216 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file px4_trace.cpp
+ *
+ * Per-CPU rings for the scheduling trace. Producers on the same CPU (tasks
+ * and nested interrupts) reserve a slot with an atomic increment of the head,
+ * fill it in and mark it valid by writing the sequence number last.
+ */
+
+#include <px4_platform_common/trace.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/atomic_bitset.h>
+
+#include <drivers/drv_hrt.h>
+
+#include <errno.h>
+#include <string.h>
+
+#if defined(__PX4_NUTTX) && defined(CONFIG_SMP)
+# include <nuttx/arch.h>
+static constexpr unsigned MAX_RINGS = CONFIG_SMP_NCPUS;
+#elif defined(__PX4_LINUX)
+# include <sched.h>
+# include <unistd.h>
+static constexpr unsigned MAX_RINGS = 16;
+#else
+static constexpr unsigned MAX_RINGS = 1;
+#endif
+
+// covers all ORB_IDs
+static constexpr size_t MAX_TOPICS = 512;
+
+struct TraceRing {
+	px4_trace_record_s *records{nullptr};
+	px4::atomic<uint32_t> head{0};
+};
+
+static TraceRing trace_rings[MAX_RINGS];
+static unsigned trace_ring_count{0};
+static size_t trace_ring_size{0};
+static px4::atomic_bool trace_running{false};
+static px4::AtomicBitset<MAX_TOPICS> trace_topics;
+
+static inline unsigned current_ring()
+{
+#if defined(__PX4_NUTTX) && defined(CONFIG_SMP)
+	return up_cpu_index();
+#elif defined(__PX4_LINUX)
+	const int cpu = sched_getcpu();
+	return (cpu > 0) ? (unsigned)cpu % trace_ring_count : 0;
+#else
+	return 0;
+#endif
+}
+
+int px4_trace_start(size_t records_per_cpu)
+{
+	if (trace_running.load()) {
+		return -EBUSY;
+	}
+
+	if (records_per_cpu == 0) {
+		return -EINVAL;
+	}
+
+	unsigned ring_count = MAX_RINGS;
+
+#if defined(__PX4_LINUX)
+	const long cpus = sysconf(_SC_NPROCESSORS_CONF);
+
+	if (cpus > 0 && (unsigned)cpus < ring_count) {
+		ring_count = cpus;
+	}
+
+#endif
+
+	if (records_per_cpu != trace_ring_size || ring_count != trace_ring_count) {
+		for (unsigned i = 0; i < MAX_RINGS; i++) {
+			delete[] trace_rings[i].records;
+			trace_rings[i].records = nullptr;
+		}
+
+		trace_ring_size = 0;
+		trace_ring_count = 0;
+
+		for (unsigned i = 0; i < ring_count; i++) {
+			trace_rings[i].records = new px4_trace_record_s[records_per_cpu];
+
+			if (trace_rings[i].records == nullptr) {
+				return -ENOMEM;
+			}
+		}
+
+		trace_ring_size = records_per_cpu;
+		trace_ring_count = ring_count;
+	}
+
+	for (unsigned i = 0; i < trace_ring_count; i++) {
+		memset(trace_rings[i].records, 0, trace_ring_size * sizeof(px4_trace_record_s));
+		trace_rings[i].head.store(0);
+	}
+
+	trace_running.store(true);
+	return 0;
+}
+
+void px4_trace_stop()
+{
+	trace_running.store(false);
+}
+
+bool px4_trace_running()
+{
+	return trace_running.load();
+}
+
+void px4_trace_record(uint8_t event, uintptr_t name, uintptr_t context, uint32_t arg)
+{
+	if (!trace_running.load()) {
+		return;
+	}
+
+	const unsigned ring_index = current_ring();
+	TraceRing &ring = trace_rings[ring_index];
+
+	const uint32_t index = ring.head.fetch_add(1);
+	px4_trace_record_s &record = ring.records[index % trace_ring_size];
+
+	__atomic_store_n(&record.sequence, 0, __ATOMIC_RELAXED);
+	record.timestamp = hrt_absolute_time();
+	record.name = name;
+	record.context = context;
+	record.arg = arg;
+	record.event = event;
+	record.cpu = ring_index;
+	__atomic_store_n(&record.sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+void px4_trace_select_topic(uint16_t orb_id, bool selected)
+{
+	if (orb_id < MAX_TOPICS) {
+		trace_topics.set(orb_id, selected);
+	}
+}
+
+bool px4_trace_topic_selected(uint16_t orb_id)
+{
+	return (orb_id < MAX_TOPICS) && trace_topics[orb_id];
+}
+
+unsigned px4_trace_ring_count()
+{
+	return trace_ring_count;
+}
+
+size_t px4_trace_read(unsigned ring_index, size_t *index, px4_trace_record_s *records, size_t max_records)
+{
+	if (ring_index >= trace_ring_count || trace_running.load()) {
+		return 0;
+	}
+
+	const TraceRing &ring = trace_rings[ring_index];
+	const uint32_t head = ring.head.load();
+	const uint32_t first = (head > trace_ring_size) ? head - trace_ring_size : 0;
+	size_t count = 0;
+
+	for (uint32_t i = first + *index; (i < head) && (count < max_records); i++) {
+		const px4_trace_record_s &record = ring.records[i % trace_ring_size];
+		(*index)++;
+
+		// skip records that were being written while stopping
+		if (__atomic_load_n(&record.sequence, __ATOMIC_ACQUIRE) == i + 1) {
+			records[count++] = record;
+		}
+	}
+
+	return count;
+}
+
+uint32_t px4_trace_recorded(unsigned ring_index)
+{
+	return (ring_index < trace_ring_count) ? trace_rings[ring_index].head.load() : 0;
+}
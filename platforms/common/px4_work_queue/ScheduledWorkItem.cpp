@@ -75,8 +75,10 @@ void ScheduledWorkItem::ScheduleClear()
 void ScheduledWorkItem::print_run_status()
 {
 	if (_call.period > 0) {
-		PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us (%" PRId64 " us)\n", _item_name, (double)average_rate(),
+		PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us (%" PRId64 " us)", _item_name, (double)average_rate(),
 			     (double)average_interval(), _call.period);
+		print_deadline_status();
+		PX4_INFO_RAW("\n");
 
 	} else {
 		WorkItem::print_run_status();
@@ -134,10 +134,71 @@ float WorkItem::average_interval() const
 
 void WorkItem::print_run_status()
 {
-	PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us\n", _item_name, (double)average_rate(), (double)average_interval());
+	PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us", _item_name, (double)average_rate(), (double)average_interval());
+	print_deadline_status();
+	PX4_INFO_RAW("\n");
 
 	// reset statistics
 	_run_count = 0;
 }
 
+void WorkItem::print_deadline_status()
+{
+	if (_deadline_us > 0) {
+		PX4_INFO_RAW(" deadline: %" PRIu32 " us, misses: %" PRIu32 ", overruns: %" PRIu32, _deadline_us, _deadline_misses,
+			     _overruns.load());
+
+		_deadline_misses = 0;
+		_overruns.store(0);
+	}
+}
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+void WorkItem::print_runtime_statistics() const
+{
+	const wq_runtime_stats_t &s = _runtime_stats;
+
+	PX4_INFO_RAW("run p50: %" PRIu32 " us, p99: %" PRIu32 " us, max: %" PRIu32 " us, "
+		     "wait p50: %" PRIu32 " us, p99: %" PRIu32 " us, max: %" PRIu32 " us\n",
+		     wq_runtime_stats_t::percentile(s.runtime_bins, s.runtime_max_us, 50),
+		     wq_runtime_stats_t::percentile(s.runtime_bins, s.runtime_max_us, 99), s.runtime_max_us,
+		     wq_runtime_stats_t::percentile(s.wait_bins, s.wait_max_us, 50),
+		     wq_runtime_stats_t::percentile(s.wait_bins, s.wait_max_us, 99), s.wait_max_us);
+}
+
+uint32_t wq_runtime_stats_t::count(const uint32_t bins[NUM_BINS])
+{
+	uint32_t total = 0;
+
+	for (unsigned i = 0; i < NUM_BINS; i++) {
+		total += bins[i];
+	}
+
+	return total;
+}
+
+uint32_t wq_runtime_stats_t::percentile(const uint32_t bins[NUM_BINS], uint32_t max_us, unsigned percent)
+{
+	const uint64_t total = count(bins);
+
+	if (total == 0) {
+		return 0;
+	}
+
+	// smallest bin with at least percent of the samples at or below it
+	const uint64_t threshold = (total * percent + 99) / 100;
+	uint64_t sum = 0;
+
+	for (unsigned i = 0; i < NUM_BINS - 1; i++) {
+		sum += bins[i];
+
+		if (sum >= threshold) {
+			return math::min((uint32_t)(2u << i), max_us);
+		}
+	}
+
+	return max_us;
+}
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
 } // namespace px4
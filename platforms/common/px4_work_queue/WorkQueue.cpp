@@ -39,6 +39,7 @@
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/time.h>
+#include <px4_platform_common/trace.h>
 #include <drivers/drv_hrt.h>
 
 namespace px4
@@ -54,6 +55,16 @@ WorkQueue::WorkQueue(const wq_config_t &config) :
 	pthread_setname_np(pthread_self(), _config.name);
 #endif
 
+#if defined(__PX4_LINUX)
+	// constructed within the work queue thread
+	_thread = pthread_self();
+#endif // __PX4_LINUX
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+	// constructed within the (first) work queue thread
+	_worker_thread = pthread_self();
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 #ifndef __PX4_NUTTX
 	px4_sem_init(&_qlock, 0, 1);
 #endif /* __PX4_NUTTX */
@@ -105,6 +116,21 @@ void WorkQueue::Detach(WorkItem *item)
 
 	_work_items.remove(item);
 
+	for (WorkItem *&running_item : _running_items) {
+		if (running_item == item) {
+			// the item is being deleted from within its Run()
+			running_item = nullptr;
+		}
+	}
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	if (_chained == item) {
+		_chained = nullptr;
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 	if (_work_items.size() == 0) {
 		// shutdown, no active WorkItems
 		PX4_DEBUG("stopping: %s, last active WorkItem closing", _config.name);
@@ -128,9 +154,44 @@ void WorkQueue::Detach(WorkItem *item)
 
 void WorkQueue::Add(WorkItem *item)
 {
-	work_lock();
+	bool expected = false;
+
+	if (!item->_queued.compare_exchange(&expected, true)) {
+		// previous run still pending
+		item->_overruns.fetch_add(1);
+		return;
+	}
+
+	PX4_TRACE(PX4_TRACE_WQ_ADD, item->ItemName(), _config.name, 0);
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+	item->_schedule_time = hrt_absolute_time();
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+	if (item->_deadline_us > 0) {
+		item->_deadline = hrt_absolute_time() + item->_deadline_us;
+	}
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	if ((_config.threads <= 1) && pthread_equal(pthread_self(), _worker_thread)) {
+		// scheduled by the item currently running on this queue
+		work_lock();
+
+		if ((_chained == nullptr) && (_chain_length < MAX_CHAIN_LENGTH)) {
+			_chained = item;
+			work_unlock();
+			return;
+		}
+
+		work_unlock();
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
+	// keep registration and push atomic, so that the worker can't unregister in between
+	work_lock();
 
 	if (_lockstep_component == -1) {
 		_lockstep_component = px4_lockstep_register_component();
@@ -138,12 +199,50 @@ void WorkQueue::Add(WorkItem *item)
 
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
-	_q.push(item);
+	// push onto the pending stack, the worker moves it to the run queue
+	WorkItem *head = _pending.load();
+
+	do {
+		item->_pending_next = head;
+	} while (!_pending.compare_exchange(&head, item));
+
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
 	work_unlock();
+#endif // ENABLE_LOCKSTEP_SCHEDULER
 
 	SignalWorkerThread();
 }
 
+void WorkQueue::ProcessPending()
+{
+	WorkItem *head = _pending.load();
+
+	while ((head != nullptr) && !_pending.compare_exchange(&head, nullptr)) {}
+
+	// reverse the stack to keep the scheduling order
+	WorkItem *fifo = nullptr;
+
+	while (head != nullptr) {
+		WorkItem *next = head->_pending_next;
+		head->_pending_next = fifo;
+		fifo = head;
+		head = next;
+	}
+
+	while (fifo != nullptr) {
+		WorkItem *next = fifo->_pending_next;
+		fifo->_pending_next = nullptr;
+
+		_q.push(fifo);
+
+		if (fifo->_deadline != 0) {
+			_q_deadline_items++;
+		}
+
+		fifo = next;
+	}
+}
+
 void WorkQueue::SignalWorkerThread()
 {
 	int sem_val;
@@ -156,7 +255,28 @@ void WorkQueue::SignalWorkerThread()
 void WorkQueue::Remove(WorkItem *item)
 {
 	work_lock();
-	_q.remove(item);
+
+	ProcessPending();
+
+	if (_q.remove(item)) {
+		if (item->_deadline != 0) {
+			item->_deadline = 0;
+			_q_deadline_items--;
+		}
+
+		item->_queued.store(false);
+	}
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	if (_chained == item) {
+		_chained = nullptr;
+		item->_deadline = 0;
+		item->_queued.store(false);
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 	work_unlock();
 }
 
@@ -164,14 +284,82 @@ void WorkQueue::Clear()
 {
 	work_lock();
 
+	ProcessPending();
+
 	while (!_q.empty()) {
-		_q.pop();
+		WorkItem *item = _q.pop();
+		item->_deadline = 0;
+		item->_queued.store(false);
 	}
 
+	_q_deadline_items = 0;
+
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+
+	if (_chained != nullptr) {
+		_chained->_deadline = 0;
+		_chained->_queued.store(false);
+		_chained = nullptr;
+	}
+
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
 	work_unlock();
 }
 
-void WorkQueue::Run()
+bool WorkQueue::is_running(const WorkItem *item) const
+{
+	for (const WorkItem *running_item : _running_items) {
+		if (running_item == item) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+WorkItem *WorkQueue::PopNext()
+{
+	ProcessPending();
+
+	if (_config.threads <= 1) {
+		if (_q_deadline_items == 0) {
+			return _q.pop();
+		}
+	}
+
+	WorkItem *next = nullptr;
+
+	for (WorkItem *item : _q) {
+		if ((_config.threads > 1) && is_running(item)) {
+			// never run an item concurrently with itself, the worker running it picks it up again
+			continue;
+		}
+
+		if (next == nullptr) {
+			next = item;
+
+			if (_q_deadline_items == 0) {
+				break;
+			}
+
+		} else if ((item->_deadline != 0) && ((next->_deadline == 0) || (item->_deadline < next->_deadline))) {
+			next = item;
+		}
+	}
+
+	if (next != nullptr) {
+		_q.remove(next);
+
+		if (next->_deadline != 0) {
+			_q_deadline_items--;
+		}
+	}
+
+	return next;
+}
+
+void WorkQueue::Run(unsigned worker)
 {
 	while (!should_exit()) {
 		// loop as the wait may be interrupted by a signal
@@ -180,14 +368,87 @@ void WorkQueue::Run()
 		work_lock();
 
 		// process queued work
-		while (!_q.empty()) {
-			WorkItem *work = _q.pop();
+		while (true) {
+#if defined(CONFIG_WORK_QUEUE_CHAINING)
+			WorkItem *work = _chained;
+
+			if (work != nullptr) {
+				_chained = nullptr;
+				_chain_length++;
+
+			} else {
+				_chain_length = 0;
+				work = PopNext();
+			}
+
+#else
+			WorkItem *work = PopNext();
+#endif // CONFIG_WORK_QUEUE_CHAINING
+
+			if (work == nullptr) {
+				// queue empty or only items currently run by other workers left
+				break;
+			}
+
+			if ((_config.threads > 1) && !_q.empty()) {
+				// wake another worker for the remaining items
+				SignalWorkerThread();
+			}
+
+			const hrt_abstime deadline = work->_deadline;
+			work->_deadline = 0;
+			_running_items[worker] = work;
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+			const hrt_abstime schedule_time = work->_schedule_time;
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+			// from here on the item can be scheduled again
+			work->_queued.store(false);
 
 			work_unlock(); // unlock work queue to run (item may requeue itself)
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+			const hrt_abstime run_start = hrt_absolute_time();
+			wq_runtime_stats_t::add(work->_runtime_stats.wait_bins, work->_runtime_stats.wait_max_us,
+						run_start - schedule_time);
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+			// the work queue threads are shared between all vehicle namespaces
+			px4::set_vehicle_namespace(work->_vehicle_namespace);
+
+#if defined(CONFIG_PX4_TRACE)
+			const char *item_name = work->ItemName();
+			PX4_TRACE(PX4_TRACE_WQ_RUN_START, item_name, _config.name, worker);
+#endif // CONFIG_PX4_TRACE
+
 			work->RunPreamble();
 			work->Run();
 			// Note: after Run() we cannot access work anymore, as it might have been deleted
+
+			PX4_TRACE(PX4_TRACE_WQ_RUN_END, item_name, _config.name, worker);
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+			const hrt_abstime run_end = hrt_absolute_time();
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
 			work_lock(); // re-lock
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+
+			if (_running_items[worker] != nullptr) {
+				wq_runtime_stats_t::add(work->_runtime_stats.runtime_bins, work->_runtime_stats.runtime_max_us,
+							run_end - run_start);
+			}
+
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+			// _running_items is cleared if the item detached (was deleted) during Run()
+			if ((deadline != 0) && (_running_items[worker] != nullptr) && (hrt_absolute_time() > deadline)) {
+				_running_items[worker]->_deadline_misses++;
+			}
+
+			_running_items[worker] = nullptr;
 		}
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
@@ -202,13 +463,108 @@ void WorkQueue::Run()
 		work_unlock();
 	}
 
+	if (_config.threads > 1) {
+		// wake the next worker so that it exits as well
+		SignalWorkerThread();
+	}
+
 	PX4_DEBUG("%s: exiting", _config.name);
 }
 
-void WorkQueue::print_status(bool last)
+#if defined(__PX4_LINUX)
+int WorkQueue::set_scheduling(uint32_t cpu_affinity, int policy)
+{
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+
+	for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if ((cpu_affinity == 0) || ((cpu < 32) && (cpu_affinity & (1u << cpu)))) {
+			CPU_SET(cpu, &cpuset);
+		}
+	}
+
+	int ret = pthread_setaffinity_np(_thread, sizeof(cpuset), &cpuset);
+
+	if (ret != 0) {
+		PX4_ERR("%s: setting CPU affinity 0x%" PRIx32 " failed (%i)", get_name(), cpu_affinity, ret);
+		return PX4_ERROR;
+	}
+
+	sched_param param{};
+
+	if (policy != SCHED_OTHER) {
+		param.sched_priority = sched_get_priority_max(policy) + _config.relative_priority;
+	}
+
+	ret = pthread_setschedparam(_thread, policy, &param);
+
+	if (ret != 0) {
+		PX4_ERR("%s: setting sched policy %i failed (%i)", get_name(), policy, ret);
+		return PX4_ERROR;
+	}
+
+	return PX4_OK;
+}
+#endif // __PX4_LINUX
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+bool WorkQueue::get_runtime_statistics(unsigned &index, wq_runtime_stats_t &stats)
+{
+	LockGuard lg{_work_items.mutex()};
+
+	for (WorkItem *item : _work_items) {
+		if (index == 0) {
+			work_lock();
+			stats = item->_runtime_stats;
+			item->_runtime_stats = {};
+			work_unlock();
+
+			strncpy(stats.item_name, item->ItemName(), sizeof(stats.item_name) - 1);
+			stats.item_name[sizeof(stats.item_name) - 1] = '\0';
+			stats.wq_name = get_name();
+			return true;
+		}
+
+		index--;
+	}
+
+	return false;
+}
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
+void WorkQueue::print_status(bool last, bool verbose)
 {
 	const size_t num_items = _work_items.size();
-	PX4_INFO_RAW("%-16s\n", get_name());
+
+#if defined(__PX4_LINUX)
+	// report the actual placement of the thread
+	cpu_set_t cpuset;
+	uint32_t cpu_affinity = 0;
+
+	if (pthread_getaffinity_np(_thread, sizeof(cpuset), &cpuset) == 0) {
+		for (unsigned cpu = 0; cpu < 32; cpu++) {
+			if (CPU_ISSET(cpu, &cpuset)) {
+				cpu_affinity |= (1u << cpu);
+			}
+		}
+	}
+
+	int policy = SCHED_OTHER;
+	sched_param param{};
+	pthread_getschedparam(_thread, &policy, &param);
+
+	PX4_INFO_RAW("%-16s (CPUs: 0x%" PRIx32 ", %s, priority: %d)", get_name(), cpu_affinity,
+		     (policy == SCHED_FIFO) ? "SCHED_FIFO" : ((policy == SCHED_RR) ? "SCHED_RR" : "SCHED_OTHER"),
+		     param.sched_priority);
+#else
+	PX4_INFO_RAW("%-16s", get_name());
+#endif // __PX4_LINUX
+
+	if (_config.threads > 1) {
+		PX4_INFO_RAW(" %u threads", (unsigned)_config.threads);
+	}
+
+	PX4_INFO_RAW("\n");
 	unsigned i = 0;
 
 	for (WorkItem *item : _work_items) {
@@ -229,6 +585,17 @@ void WorkQueue::print_status(bool last)
 		}
 
 		item->print_run_status();
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+
+		if (verbose) {
+			PX4_INFO_RAW("%s%s", last ? "    " : "|   ", (i < num_items) ? "|      " : "       ");
+			item->print_runtime_statistics();
+		}
+
+#else
+		(void)verbose;
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
 	}
 }
 
@@ -63,6 +63,34 @@ static BlockingQueue<const wq_config_t *, 1> *_wq_manager_create_queue{nullptr};
 static px4::atomic_bool _wq_manager_should_exit{true};
 static px4::atomic_bool _wq_manager_running{false};
 
+#if defined(__PX4_LINUX)
+// scheduling applied to work queues when they are created (see WorkQueueSetScheduling)
+struct wq_scheduling_t {
+	char name[24];
+	uint32_t cpu_affinity;
+	int policy;
+};
+
+static constexpr int WQ_SCHEDULING_MAX = 8;
+static wq_scheduling_t _wq_scheduling[WQ_SCHEDULING_MAX] {};
+static pthread_mutex_t _wq_scheduling_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void
+WorkQueueApplyScheduling(WorkQueue &wq)
+{
+	pthread_mutex_lock(&_wq_scheduling_mutex);
+
+	for (const wq_scheduling_t &scheduling : _wq_scheduling) {
+		if (strcmp(scheduling.name, wq.get_name()) == 0) {
+			wq.set_scheduling(scheduling.cpu_affinity, scheduling.policy);
+			break;
+		}
+	}
+
+	pthread_mutex_unlock(&_wq_scheduling_mutex);
+}
+#endif // __PX4_LINUX
+
 
 static WorkQueue *
 FindWorkQueueByName(const char *name)
@@ -84,6 +112,56 @@ FindWorkQueueByName(const char *name)
 	return nullptr;
 }
 
+int
+WorkQueueSetScheduling(const char *name, uint32_t cpu_affinity, int policy)
+{
+#if defined(__PX4_LINUX)
+
+	if ((name == nullptr) || (strlen(name) >= sizeof(wq_scheduling_t::name))) {
+		return PX4_ERROR;
+	}
+
+	pthread_mutex_lock(&_wq_scheduling_mutex);
+
+	wq_scheduling_t *entry = nullptr;
+
+	for (wq_scheduling_t &scheduling : _wq_scheduling) {
+		if ((strcmp(scheduling.name, name) == 0) || ((entry == nullptr) && (scheduling.name[0] == '\0'))) {
+			entry = &scheduling;
+		}
+	}
+
+	if (entry != nullptr) {
+		strncpy(entry->name, name, sizeof(entry->name) - 1);
+		entry->cpu_affinity = cpu_affinity;
+		entry->policy = policy;
+	}
+
+	pthread_mutex_unlock(&_wq_scheduling_mutex);
+
+	if (entry == nullptr) {
+		PX4_ERR("too many work queue scheduling entries");
+		return PX4_ERROR;
+	}
+
+	// apply immediately if already running
+	if (_wq_manager_running.load()) {
+		LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+		for (WorkQueue *wq : *_wq_manager_wqs_list) {
+			if (strcmp(wq->get_name(), name) == 0) {
+				return wq->set_scheduling(cpu_affinity, policy);
+			}
+		}
+	}
+
+	return PX4_OK;
+#else
+	PX4_ERR("not supported");
+	return PX4_ERROR;
+#endif // __PX4_LINUX
+}
+
 WorkQueue *
 WorkQueueFindOrCreate(const wq_config_t &new_wq)
 {
@@ -226,17 +304,98 @@ const wq_config_t &ins_instance_to_wq(uint8_t instance)
 	return wq_configurations::INS0;
 }
 
+static size_t
+WorkQueueStackSize(const wq_config_t *wq)
+{
+#if defined(__PX4_NUTTX) || defined(__PX4_QURT)
+	return math::max(PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
+#elif defined(__PX4_POSIX)
+	// On posix system , the desired stacksize round to the nearest multiplier of the system pagesize
+	// It is a requirement of the  pthread_attr_setstacksize* function
+	const unsigned int page_size = sysconf(_SC_PAGESIZE);
+	const size_t stacksize_adj = math::max((int)PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
+	return (stacksize_adj + page_size - (stacksize_adj % page_size));
+#endif
+}
+
+#if !defined(__PX4_NUTTX)
+struct wq_worker_t {
+	WorkQueue *wq;
+	unsigned index;
+};
+
+static void *
+WorkQueueWorker(void *context)
+{
+	wq_worker_t *worker = static_cast<wq_worker_t *>(context);
+
+#ifdef __PX4_DARWIN
+	pthread_setname_np(worker->wq->get_name());
+#else
+	pthread_setname_np(pthread_self(), worker->wq->get_name());
+#endif
+
+	worker->wq->Run(worker->index);
+
+	return nullptr;
+}
+#endif // !__PX4_NUTTX
+
 static void *
 WorkQueueRunner(void *context)
 {
 	wq_config_t *config = static_cast<wq_config_t *>(context);
 	WorkQueue wq(*config);
 
+#if defined(__PX4_LINUX)
+	WorkQueueApplyScheduling(wq);
+#endif // __PX4_LINUX
+
+#if !defined(__PX4_NUTTX)
+	// additional worker threads sharing the queue, inheriting priority and CPU affinity of this thread
+	wq_worker_t workers[WorkQueue::MAX_THREADS - 1] {};
+	pthread_t worker_threads[WorkQueue::MAX_THREADS - 1] {};
+	unsigned num_workers = 0;
+
+	if (config->threads > 1) {
+		const unsigned num_threads = math::min((unsigned)config->threads, WorkQueue::MAX_THREADS);
+
+		pthread_attr_t attr;
+		pthread_attr_init(&attr);
+		pthread_attr_setstacksize(&attr, WorkQueueStackSize(config));
+
+		for (unsigned i = 1; i < num_threads; i++) {
+			workers[num_workers].wq = &wq;
+			workers[num_workers].index = i;
+
+			int ret_create = pthread_create(&worker_threads[num_workers], &attr, WorkQueueWorker, &workers[num_workers]);
+
+			if (ret_create == 0) {
+				num_workers++;
+
+			} else {
+				PX4_ERR("failed to create worker %u for %s (%i)", i, config->name, ret_create);
+			}
+		}
+
+		pthread_attr_destroy(&attr);
+	}
+
+#endif // !__PX4_NUTTX
+
 	// add to work queue list
 	_wq_manager_wqs_list->add(&wq);
 
 	wq.Run();
 
+#if !defined(__PX4_NUTTX)
+
+	for (unsigned i = 0; i < num_workers; i++) {
+		pthread_join(worker_threads[i], nullptr);
+	}
+
+#endif // !__PX4_NUTTX
+
 	// remove from work queue list
 	_wq_manager_wqs_list->remove(&wq);
 
@@ -269,15 +428,7 @@ WorkQueueManagerRun(int, char **)
 			// create new work queue
 
 			// stack size
-#if defined(__PX4_NUTTX) || defined(__PX4_QURT)
-			const size_t stacksize = math::max(PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
-#elif defined(__PX4_POSIX)
-			// On posix system , the desired stacksize round to the nearest multiplier of the system pagesize
-			// It is a requirement of the  pthread_attr_setstacksize* function
-			const unsigned int page_size = sysconf(_SC_PAGESIZE);
-			const size_t stacksize_adj = math::max((int)PTHREAD_STACK_MIN, PX4_STACK_ADJUSTED(wq->stacksize));
-			const size_t stacksize = (stacksize_adj + page_size - (stacksize_adj % page_size));
-#endif
+			const size_t stacksize = WorkQueueStackSize(wq);
 
 			// priority
 			int sched_priority = sched_get_priority_max(SCHED_FIFO) + wq->relative_priority;
@@ -462,7 +613,7 @@ WorkQueueManagerStop()
 }
 
 int
-WorkQueueManagerStatus()
+WorkQueueManagerStatus(bool verbose)
 {
 	if (!_wq_manager_should_exit.load() && _wq_manager_running.load()) {
 
@@ -484,7 +635,7 @@ WorkQueueManagerStatus()
 				PX4_INFO_RAW("\\__ %zu) ", i);
 			}
 
-			wq->print_status(last_wq);
+			wq->print_status(last_wq, verbose);
 		}
 
 	} else {
@@ -494,4 +645,24 @@ WorkQueueManagerStatus()
 	return PX4_OK;
 }
 
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+bool
+WorkQueueManagerGetRuntimeStatistics(unsigned index, wq_runtime_stats_t &stats)
+{
+	if (_wq_manager_should_exit.load() || !_wq_manager_running.load()) {
+		return false;
+	}
+
+	LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+	for (WorkQueue *wq : *_wq_manager_wqs_list) {
+		if (wq->get_runtime_statistics(index, stats)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif // CONFIG_WORK_QUEUE_RUNTIME_STATISTICS
+
 } // namespace px4
@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file PublicationLoaned.hpp
+ *
+ */
+
+#pragma once
+
+#include "Publication.hpp"
+
+namespace uORB
+{
+
+/**
+ * Zero-copy uORB publication: the message is filled in directly in the topic buffer.
+ *
+ * Intended for large topics. The instance must have a single publisher, and the buffer
+ * must not have been allocated by a regular publication before (needs additional slots).
+ * Otherwise (or in the userspace of protected builds) this falls back to copying
+ * from a local message.
+ */
+template<typename T>
+class PublicationLoaned : public PublicationBase
+{
+public:
+
+	/**
+	 * Constructor
+	 *
+	 * @param meta The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 */
+	PublicationLoaned(ORB_ID id) : PublicationBase(id) {}
+	PublicationLoaned(const orb_metadata *meta) : PublicationBase(static_cast<ORB_ID>(meta->o_id)) {}
+
+	bool advertise()
+	{
+		if (!advertised()) {
+			if (_multi) {
+				int instance = 0;
+				_handle = orb_advertise_multi(get_topic(), nullptr, &instance);
+
+			} else {
+				_handle = orb_advertise(get_topic(), nullptr);
+			}
+		}
+
+		return advertised();
+	}
+
+	/**
+	 * Get the message to fill in. Calling it again before publish() returns the same message.
+	 * The content is not cleared, all fields must be set.
+	 */
+	T &loan()
+	{
+		if (_loaned == nullptr) {
+			if (!advertised()) {
+				advertise();
+			}
+
+			_loaned = static_cast<T *>(Manager::orb_loan(_handle));
+
+			if (_loaned == nullptr) {
+				_loaned = &_fallback;
+			}
+		}
+
+		return *_loaned;
+	}
+
+	/**
+	 * Publish the loaned message
+	 */
+	bool publish()
+	{
+		if (_loaned == nullptr) {
+			return false;
+		}
+
+		const bool fallback = (_loaned == &_fallback);
+		_loaned = nullptr;
+
+		if (fallback) {
+			return (Manager::orb_publish(get_topic(), _handle, &_fallback) == PX4_OK);
+		}
+
+		return (Manager::orb_publish_loaned(get_topic(), _handle) == PX4_OK);
+	}
+
+	bool zero_copy() const { return (_loaned != nullptr) && (_loaned != &_fallback); }
+
+protected:
+	PublicationLoaned(ORB_ID id, bool multi) : PublicationBase(id), _multi(multi) {}
+
+private:
+	T *_loaned{nullptr};
+	T _fallback{};
+
+	const bool _multi{false};
+};
+
+/**
+ * Zero-copy uORB publication of a new multi-instance (see PublicationMulti).
+ */
+template<typename T>
+class PublicationMultiLoaned : public PublicationLoaned<T>
+{
+public:
+	PublicationMultiLoaned(ORB_ID id) : PublicationLoaned<T>(id, true) {}
+	PublicationMultiLoaned(const orb_metadata *meta) : PublicationLoaned<T>(static_cast<ORB_ID>(meta->o_id), true) {}
+
+	int get_instance()
+	{
+		// advertise if not already advertised
+		if (this->advertise()) {
+			return Manager::orb_get_instance(this->_handle);
+		}
+
+		return -1;
+	}
+};
+
+} // namespace uORB
@@ -171,6 +171,82 @@ public:
 		return valid() ? Manager::orb_data_copy(_node, dst, _last_generation, false) : false;
 	}
 
+	/**
+	 * Copy all unread messages of a queued topic in one locked operation (oldest first).
+	 * @param dst array with space for at least max messages
+	 * @param max maximum number of messages to copy, the remaining ones stay unread
+	 * @param lost optional, set to the number of messages overwritten before they could be read
+	 * @return number of messages copied
+	 */
+	unsigned copy_all(void *dst, unsigned max, unsigned *lost = nullptr)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		if (!valid()) {
+			if (lost) {
+				*lost = 0;
+			}
+
+			return 0;
+		}
+
+		return Manager::orb_data_copy_all(_node, dst, max, _last_generation, lost);
+	}
+
+	template<typename T, size_t N>
+	unsigned copy_all(T(&dst)[N], unsigned *lost = nullptr)
+	{
+		return copy_all(dst, N, lost);
+	}
+
+	/**
+	 * Borrow the data in place instead of copying it (zero-copy).
+	 * The publisher does not wait for borrowers, so once done with the data
+	 * check borrow_valid() and fall back to copy() if it was overwritten.
+	 * Not supported in the userspace of protected builds (returns nullptr).
+	 * @param only_if_updated only borrow if there is new data
+	 * @return pointer to the data, nullptr if there is nothing to borrow
+	 */
+	const void *borrow(bool only_if_updated = true)
+	{
+		if (!valid()) {
+			subscribe();
+		}
+
+		return valid() ? Manager::orb_data_borrow(_node, _last_generation, only_if_updated) : nullptr;
+	}
+
+	/**
+	 * Check if the data returned by the last borrow() is still intact.
+	 */
+	bool borrow_valid() const { return valid() && Manager::orb_data_borrow_valid(_node, _last_generation); }
+
+	/**
+	 * Borrow the next message in place (see borrow()), or copy it into dst where borrowing is
+	 * not supported (userspace of protected builds).
+	 * Once done with the data check borrow_valid(data, dst).
+	 * @return pointer to the message (borrowed or dst), nullptr if there is no update
+	 */
+	template<typename T>
+	const T *borrow_or_update(T *dst)
+	{
+		const T *data = static_cast<const T *>(borrow());
+
+		if ((data == nullptr) && update(dst)) {
+			data = dst;
+		}
+
+		return data;
+	}
+
+	/**
+	 * Check if the data returned by borrow_or_update() is still intact.
+	 */
+	template<typename T>
+	bool borrow_valid(const T *data, const T *dst) const { return (data == dst) || borrow_valid(); }
+
 	/**
 	 * Change subscription instance
 	 * @param instance The new multi-Subscription instance
@@ -0,0 +1,245 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SubscriptionCallbackSet.hpp
+ *
+ * Group of subscription callbacks that only fires once per coherent set of publications.
+ */
+
+#pragma once
+
+#include <uORB/SubscriptionCallback.hpp>
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+namespace uORB
+{
+
+class SubscriptionCallbackSetMember;
+
+/**
+ * Collects publications of several topics and calls call() once the set is complete.
+ *
+ * The set is complete if any of the configured conditions is met:
+ *  - all required members have a new publication
+ *  - the number of publications (over all members) reaches set_required_publications()
+ *  - the oldest pending publication is older than set_deadline() (checked on each publication)
+ * Without required members and publication count it fires on every publication.
+ *
+ * The set must be declared before its members.
+ */
+class SubscriptionCallbackSet
+{
+public:
+	static constexpr uint8_t MAX_MEMBERS = 8;
+
+	SubscriptionCallbackSet() = default;
+	virtual ~SubscriptionCallbackSet() = default;
+
+	// no copy, assignment, move, move assignment
+	SubscriptionCallbackSet(const SubscriptionCallbackSet &) = delete;
+	SubscriptionCallbackSet &operator=(const SubscriptionCallbackSet &) = delete;
+	SubscriptionCallbackSet(SubscriptionCallbackSet &&) = delete;
+	SubscriptionCallbackSet &operator=(SubscriptionCallbackSet &&) = delete;
+
+	bool registerCallbacks();
+	void unregisterCallbacks();
+
+	/**
+	 * Fire after this many publications of any member (0 to disable).
+	 */
+	void set_required_publications(uint8_t required_publications) { _required_publications = required_publications; }
+
+	/**
+	 * Fire on the next publication once the oldest pending one is older than this (0 to disable).
+	 */
+	void set_deadline(hrt_abstime deadline_us) { _deadline_us = deadline_us; }
+
+	/**
+	 * Clear the pending state, eg. after handling a set outside of call().
+	 */
+	void reset()
+	{
+		_pending.store(0);
+		_publications.store(0);
+		_first_pending_time.store(0);
+	}
+
+	uint8_t member_count() const { return _member_count; }
+
+	virtual void call() = 0;
+
+protected:
+	friend class SubscriptionCallbackSetMember;
+
+	/**
+	 * Member registration, returns the member index or -1 if full.
+	 */
+	int add(SubscriptionCallbackSetMember *member, bool required)
+	{
+		if (_member_count >= MAX_MEMBERS) {
+			return -1;
+		}
+
+		const int index = _member_count++;
+		_members[index] = member;
+
+		if (required) {
+			_required_mask |= (1u << index);
+		}
+
+		return index;
+	}
+
+	void notify(int index)
+	{
+		const uint32_t bit = (1u << index);
+		const uint32_t pending = _pending.fetch_or(bit) | bit;
+		const uint32_t publications = _publications.fetch_add(1) + 1;
+
+		hrt_abstime expected = 0;
+		const hrt_abstime now = hrt_absolute_time();
+		_first_pending_time.compare_exchange(&expected, now);
+
+		bool complete = false;
+
+		if ((_required_mask != 0) && ((pending & _required_mask) == _required_mask)) {
+			complete = true;
+
+		} else if ((_required_publications != 0) && (publications >= _required_publications)) {
+			complete = true;
+
+		} else if ((_deadline_us != 0) && (expected != 0) && (now - expected >= _deadline_us)) {
+			complete = true;
+
+		} else if ((_required_mask == 0) && (_required_publications == 0)) {
+			complete = true;
+		}
+
+		// only the caller that consumes the pending state fires (members might publish concurrently)
+		if (complete && (_pending.fetch_and(0) != 0)) {
+			_publications.store(0);
+			_first_pending_time.store(0);
+			call();
+		}
+	}
+
+private:
+	SubscriptionCallbackSetMember *_members[MAX_MEMBERS] {};
+	uint8_t _member_count{0};
+	uint32_t _required_mask{0};
+
+	uint8_t _required_publications{0};
+	hrt_abstime _deadline_us{0};
+
+	px4::atomic<uint32_t> _pending{0};
+	px4::atomic<uint32_t> _publications{0};
+	px4::atomic<hrt_abstime> _first_pending_time{0};
+};
+
+// Subscription belonging to a SubscriptionCallbackSet
+class SubscriptionCallbackSetMember : public SubscriptionCallback
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param set The set this subscription belongs to.
+	 * @param meta The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 * @param required The set is only complete once this topic was published.
+	 * @param instance The instance for multi sub.
+	 */
+	SubscriptionCallbackSetMember(SubscriptionCallbackSet *set, const orb_metadata *meta, bool required = true,
+				      uint8_t instance = 0) :
+		SubscriptionCallback(meta, 0, instance),	// interval 0
+		_set(set),
+		_index(set->add(this, required))
+	{
+	}
+
+	virtual ~SubscriptionCallbackSetMember() = default;
+
+	void call() override
+	{
+		if ((_index >= 0) && updated()) {
+			_set->notify(_index);
+		}
+	}
+
+	bool valid_member() const { return _index >= 0; }
+
+private:
+	SubscriptionCallbackSet *_set;
+	const int _index;
+};
+
+inline bool SubscriptionCallbackSet::registerCallbacks()
+{
+	for (int i = 0; i < _member_count; i++) {
+		if (!_members[i]->registerCallback()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline void SubscriptionCallbackSet::unregisterCallbacks()
+{
+	for (int i = 0; i < _member_count; i++) {
+		_members[i]->unregisterCallback();
+	}
+}
+
+// SubscriptionCallbackSet that schedules a WorkItem once per complete set
+class SubscriptionCallbackWorkItemSet : public SubscriptionCallbackSet
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param work_item The WorkItem that will be scheduled once the set is complete.
+	 */
+	explicit SubscriptionCallbackWorkItemSet(px4::WorkItem *work_item) : _work_item(work_item) {}
+
+	virtual ~SubscriptionCallbackWorkItemSet() = default;
+
+	void call() override { _work_item->ScheduleNow(); }
+
+private:
+	px4::WorkItem *_work_item;
+};
+
+} // namespace uORB
@@ -57,21 +57,40 @@ bool SubscriptionInterval::update(void *dst)
 bool SubscriptionInterval::copy(void *dst)
 {
 	if (_subscription.copy(dst)) {
-		const hrt_abstime now = hrt_absolute_time();
+		interval_update();
+		return true;
+	}
+
+	return false;
+}
 
-		// make sure we don't set a timestamp before the timer started counting (now - _interval_us would wrap because it's unsigned)
-		if (now > _interval_us) {
-			// shift last update time forward, but don't let it get further behind than the interval
-			_last_update = math::constrain(_last_update + _interval_us, now - _interval_us, now);
+const void *SubscriptionInterval::borrow()
+{
+	if (updated()) {
+		const void *data = _subscription.borrow();
 
-		} else {
-			_last_update = now;
+		if (data != nullptr) {
+			interval_update();
 		}
 
-		return true;
+		return data;
 	}
 
-	return false;
+	return nullptr;
+}
+
+void SubscriptionInterval::interval_update()
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	// make sure we don't set a timestamp before the timer started counting (now - _interval_us would wrap because it's unsigned)
+	if (now > _interval_us) {
+		// shift last update time forward, but don't let it get further behind than the interval
+		_last_update = math::constrain(_last_update + _interval_us, now - _interval_us, now);
+
+	} else {
+		_last_update = now;
+	}
 }
 
 } // namespace uORB
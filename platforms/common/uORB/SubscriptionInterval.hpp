@@ -109,6 +109,41 @@ public:
 	 */
 	bool copy(void *dst);
 
+	/**
+	 * Borrow the data in place if updated (see Subscription::borrow()).
+	 * @return pointer to the data, nullptr if not updated or borrowing is not supported
+	 */
+	const void *borrow();
+
+	/**
+	 * Check if the data returned by the last borrow() is still intact.
+	 */
+	bool borrow_valid() const { return _subscription.borrow_valid(); }
+
+	/**
+	 * Borrow the next message in place, or copy it into dst where borrowing is
+	 * not supported (userspace of protected builds).
+	 * Once done with the data check borrow_valid(data, dst).
+	 * @return pointer to the message (borrowed or dst), nullptr if there is no update
+	 */
+	template<typename T>
+	const T *borrow_or_update(T *dst)
+	{
+		const T *data = static_cast<const T *>(borrow());
+
+		if ((data == nullptr) && update(dst)) {
+			data = dst;
+		}
+
+		return data;
+	}
+
+	/**
+	 * Check if the data returned by borrow_or_update() is still intact.
+	 */
+	template<typename T>
+	bool borrow_valid(const T *data, const T *dst) const { return (data == dst) || borrow_valid(); }
+
 	bool		valid() const { return _subscription.valid(); }
 
 	uint8_t		get_instance() const { return _subscription.get_instance(); }
@@ -135,6 +170,8 @@ public:
 	void		set_last_update(hrt_abstime t) { _last_update = t; }
 protected:
 
+	void		interval_update();
+
 	Subscription	_subscription;
 	uint64_t	_last_update{0};	// last subscription update in microseconds
 	uint32_t	_interval_us{0};	// maximum update interval in microseconds
@@ -84,7 +84,8 @@ int uorb_status(void)
 #if !defined(__PX4_NUTTX) || defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
 
 	if (g_dev != nullptr) {
-		g_dev->printStatistics();
+		// topics of the vehicle namespace of the caller
+		uORB::Manager::get_instance()->get_device_master()->printStatistics();
 
 	} else {
 		PX4_INFO("uorb is not running");
@@ -101,7 +102,7 @@ int uorb_top(char **topic_filter, int num_filters)
 #if !defined(__PX4_NUTTX) || defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
 
 	if (g_dev != nullptr) {
-		g_dev->showTop(topic_filter, num_filters);
+		uORB::Manager::get_instance()->get_device_master()->showTop(topic_filter, num_filters);
 
 	} else {
 		PX4_INFO("uorb is not running");
@@ -113,6 +114,82 @@ int uorb_top(char **topic_filter, int num_filters)
 	return OK;
 }
 
+#ifdef CONFIG_ORB_COMMUNICATOR
+int uorb_remote(char **argv, int argc)
+{
+	if (argc < 1) {
+		return PX4_ERROR;
+	}
+
+	const orb_metadata *meta = nullptr;
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if (strcmp(orb_get_topics()[i]->o_name, argv[0]) == 0) {
+			meta = orb_get_topics()[i];
+		}
+	}
+
+	if (meta == nullptr) {
+		PX4_ERR("unknown topic %s", argv[0]);
+		return PX4_ERROR;
+	}
+
+	if (argc == 1) {
+		uORB::Manager::get_instance()->orb_print_remote_delivery(meta);
+		return PX4_OK;
+	}
+
+	if (argc == 2 && strcmp(argv[1], "full") == 0) {
+		return uORB::Manager::get_instance()->orb_set_remote_delivery(meta, nullptr);
+	}
+
+	uORB::RemoteDelivery::Config config{};
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "delta") == 0) {
+			config.on_change = false;
+
+		} else if (strcmp(argv[i], "onchange") == 0) {
+			config.on_change = true;
+
+		} else if (strcmp(argv[i], "keepalive") == 0 && i + 1 < argc) {
+			config.keepalive_us = strtoul(argv[++i], nullptr, 10) * 1000;
+
+		} else if (strcmp(argv[i], "fields") == 0 && i + 1 < argc) {
+			// comma separated list
+			char *saveptr = nullptr;
+
+			for (char *field = strtok_r(argv[++i], ",", &saveptr); field; field = strtok_r(nullptr, ",", &saveptr)) {
+				if (config.num_fields == uORB::RemoteDelivery::MAX_FIELDS) {
+					PX4_ERR("too many fields (max %i)", uORB::RemoteDelivery::MAX_FIELDS);
+					return PX4_ERROR;
+				}
+
+				if (!uORB::RemoteDelivery::find_field(meta, field, config.field_offset[config.num_fields],
+								      config.field_size[config.num_fields])) {
+					PX4_ERR("%s has no field %s", meta->o_name, field);
+					return PX4_ERROR;
+				}
+
+				config.num_fields++;
+			}
+
+		} else {
+			PX4_ERR("unknown argument %s", argv[i]);
+			return PX4_ERROR;
+		}
+	}
+
+	const int ret = uORB::Manager::get_instance()->orb_set_remote_delivery(meta, &config);
+
+	if (ret != PX4_OK) {
+		PX4_ERR("failed to configure %s (%i)", meta->o_name, ret);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
 orb_advert_t orb_advertise(const struct orb_metadata *meta, const void *data)
 {
 	return uORB::Manager::get_instance()->orb_advertise(meta, data);
@@ -121,6 +121,9 @@ __BEGIN_DECLS
 int uorb_start(void);
 int uorb_status(void);
 int uorb_top(char **topic_filter, int num_filters);
+#ifdef CONFIG_ORB_COMMUNICATOR
+int uorb_remote(char **argv, int argc);
+#endif /* CONFIG_ORB_COMMUNICATOR */
 
 /**
  * ORB topic advertiser handle.
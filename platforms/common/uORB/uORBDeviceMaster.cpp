@@ -36,11 +36,16 @@
 #include "uORBManager.hpp"
 #include "uORBUtils.hpp"
 
+#include <containers/Bitset.hpp>
 #include <px4_platform_common/sem.hpp>
 #include <systemlib/px4_macros.h>
 
 #include <math.h>
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+#include <uORB/topics/uorb_topic_stats.h>
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 #ifndef __PX4_QURT // QuRT has no poll()
 #include <poll.h>
 #endif // PX4_QURT
@@ -95,25 +100,34 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 			*instance = group_tries;
 		}
 
-		/* construct the new node, passing the ownership of path to it */
-		uORB::DeviceNode *node = new uORB::DeviceNode(meta, group_tries, nodepath);
+		/* check the lookup table first, so that existing nodes are not created and registered again */
+		uORB::DeviceNode *existing_node = getDeviceNodeLocked(meta, group_tries);
+		uORB::DeviceNode *node = nullptr;
 
-		/* if we didn't get a device, that's bad */
-		if (node == nullptr) {
-			return -ENOMEM;
-		}
+		if (existing_node != nullptr) {
+			ret = -EEXIST;
 
-		/* initialise the node - this may fail if e.g. a node with this name already exists */
-		ret = node->init();
+		} else {
+			/* construct the new node, passing the ownership of path to it */
+			node = new uORB::DeviceNode(meta, group_tries, nodepath);
 
-		/* if init failed, discard the node and its name */
-		if (ret != PX4_OK) {
-			delete node;
+			/* if we didn't get a device, that's bad */
+			if (node == nullptr) {
+				return -ENOMEM;
+			}
 
-			if (ret == -EEXIST) {
-				/* if the node exists already, get the existing one and check if it's advertised. */
-				uORB::DeviceNode *existing_node = getDeviceNodeLocked(meta, group_tries);
+			/* initialise the node - this may fail if e.g. a node with this name already exists */
+			ret = node->init();
+
+			/* if init failed, discard the node and its name */
+			if (ret != PX4_OK) {
+				delete node;
+				node = nullptr;
+			}
+		}
 
+		if (ret != PX4_OK) {
+			if (ret == -EEXIST) {
 				/*
 				 * We can claim an existing node in these cases:
 				 * - The node is not advertised (yet). It means there is already one or more subscribers or it was
@@ -150,6 +164,8 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 
 			// add to the node map.
 			_node_list.add(node);
+			node->_next_instance = _node_table[meta->o_id];
+			_node_table[meta->o_id] = node;
 			_node_exists[node->get_instance()].set((orb_id_size_t)node->id(), true);
 		}
 
@@ -192,18 +208,27 @@ void uORB::DeviceMaster::printStatistics()
 		cur_node = cur_node->next;
 		delete prev;
 	}
+
+#if CONFIG_ORB_DATA_ARENA_SIZE > 0
+	PX4_INFO_RAW("data arena: %zu / %i bytes used\n", DeviceNode::data_arena_used(), CONFIG_ORB_DATA_ARENA_SIZE);
+#endif // CONFIG_ORB_DATA_ARENA_SIZE
 }
 
 int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node, int &num_topics,
 		size_t &max_topic_name_length, char **topic_filter, int num_filters)
 {
-	DeviceNodeStatisticsData *cur_node = nullptr;
 	num_topics = 0;
 	DeviceNodeStatisticsData *last_node = *first_node;
 
+	// nodes that are already in the list
+	px4::Bitset<ORB_TOPICS_COUNT> added[ORB_MULTI_MAX_INSTANCES];
+
 	if (last_node) {
+		added[last_node->node->get_instance()].set(last_node->node->get_meta()->o_id);
+
 		while (last_node->next) {
 			last_node = last_node->next;
+			added[last_node->node->get_instance()].set(last_node->node->get_meta()->o_id);
 		}
 	}
 
@@ -212,13 +237,7 @@ int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node,
 		++num_topics;
 
 		//check if already added
-		cur_node = *first_node;
-
-		while (cur_node && cur_node->node != node) {
-			cur_node = cur_node->next;
-		}
-
-		if (cur_node) {
+		if (added[node->get_instance()][node->get_meta()->o_id]) {
 			continue;
 		}
 
@@ -265,24 +284,60 @@ int uORB::DeviceMaster::addNewDeviceNodes(DeviceNodeStatisticsData **first_node,
 
 #define CLEAR_LINE "\033[K"
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+bool uORB::DeviceMaster::getTopicStatistics(unsigned index, uorb_topic_stats_s &stats)
+{
+	DeviceNode *node = nullptr;
+	unsigned i = 0;
+
+	lock();
+
+	for (DeviceNode *cur : _node_list) {
+		if (i++ == index) {
+			node = cur;
+			break;
+		}
+	}
+
+	/* a DeviceNode is never deleted, so it's safe to unlock here and still access the DeviceNode */
+	unlock();
+
+	if (node == nullptr) {
+		return false;
+	}
+
+	node->get_statistics(stats);
+	return true;
+}
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 {
 	bool print_active_only = true;
 	bool only_once = false; // if true, run only once, then exit
+	bool show_latency = false; // if true, print the interval, callback and latency statistics
 
 	if (topic_filter && num_filters > 0) {
 		bool show_all = false;
+		int num_options = 0;
 
 		for (int i = 0; i < num_filters; ++i) {
 			if (!strcmp("-a", topic_filter[i])) {
 				show_all = true;
+				num_options++;
 
 			} else if (!strcmp("-1", topic_filter[i])) {
 				only_once = true;
+				num_options++;
+
+			} else if (!strcmp("-l", topic_filter[i])) {
+				show_latency = true;
+				num_options++;
 			}
 		}
 
-		print_active_only = only_once ? (num_filters == 1) : false; // print non-active if -a or some filter given
+		// print non-active if -a or some filter given
+		print_active_only = !show_all && (num_filters == num_options);
 
 		if (show_all || print_active_only) {
 			num_filters = 0;
@@ -384,16 +439,34 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 
 			PX4_INFO_RAW(CLEAR_LINE "update: 1s, topics: %i, total publications: %i, %.1f kB/s\n",
 				     num_topics, total_msgs, (double)(total_size / 1000.f));
-			PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+			PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE%s\n", (int)max_topic_name_length - 2, "TOPIC NAME",
+				     show_latency ? " INTV_MIN INTV_AVG INTV_MAX CB/P | LATENCY <100us <500us <1ms <5ms <20ms >20ms" : "");
 			cur_node = first_node;
 
 			while (cur_node) {
 
 				if (!print_active_only || (cur_node->pub_msg_delta > 0 && cur_node->node->subscriber_count() > 0)) {
-					PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i \n", (int)max_topic_name_length,
+					PX4_INFO_RAW(CLEAR_LINE "%-*s %2i %4i %4i %2i %4i ", (int)max_topic_name_length,
 						     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
 						     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
 						     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size);
+
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+
+					if (show_latency) {
+						uorb_topic_stats_s stats;
+						cur_node->node->get_statistics(stats);
+						PX4_INFO_RAW("%8u %8u %8u %4.1f |         %6u %6u %4u %4u %5u %5u",
+							     (unsigned)stats.interval_min_us, (unsigned)stats.interval_avg_us,
+							     (unsigned)stats.interval_max_us, (double)stats.callbacks_avg,
+							     (unsigned)stats.copy_latency[0], (unsigned)stats.copy_latency[1],
+							     (unsigned)stats.copy_latency[2], (unsigned)stats.copy_latency[3],
+							     (unsigned)stats.copy_latency[4], (unsigned)stats.copy_latency[5]);
+					}
+
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
+					PX4_INFO_RAW("\n");
 				}
 
 				cur_node = cur_node->next;
@@ -449,8 +522,12 @@ uORB::DeviceNode *uORB::DeviceMaster::getDeviceNode(const char *nodepath)
 
 uORB::DeviceNode *uORB::DeviceMaster::getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance)
 {
-	for (uORB::DeviceNode *node : _node_list) {
-		if ((strcmp(node->get_name(), meta->o_name) == 0) && (node->get_instance() == instance)) {
+	if (meta->o_id >= ORB_TOPICS_COUNT) {
+		return nullptr;
+	}
+
+	for (uORB::DeviceNode *node = _node_table[meta->o_id]; node != nullptr; node = node->_next_instance) {
+		if (node->get_instance() == instance) {
 			return node;
 		}
 	}
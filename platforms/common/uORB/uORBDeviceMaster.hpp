@@ -47,6 +47,8 @@ class DeviceMaster;
 class Manager;
 }
 
+struct uorb_topic_stats_s;
+
 #include <string.h>
 #include <stdlib.h>
 
@@ -111,10 +113,20 @@ public:
 	 * Exited when the user presses the enter key.
 	 * @param topic_filter list of topic filters: if set, each string can be a substring for topics to match.
 	 *        Or it can be '-a', which means to print all topics instead of only ones currently publishing with subscribers.
+	 *        '-l' additionally prints the publication interval, callback and copy latency statistics.
 	 * @param num_filters
 	 */
 	void showTop(char **topic_filter, int num_filters);
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+	/**
+	 * Get the statistics of the node at a given position in the node list, and reset them.
+	 * @param index position in the node list (0...number of nodes - 1)
+	 * @return false if index is out of range
+	 */
+	bool getTopicStatistics(unsigned index, uorb_topic_stats_s &stats);
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 private:
 	// Private constructor, uORB::Manager takes care of its creation
 	DeviceMaster();
@@ -142,6 +154,12 @@ private:
 	IntrusiveSortedList<uORB::DeviceNode *> _node_list;
 	AtomicBitset<ORB_TOPICS_COUNT> _node_exists[ORB_MULTI_MAX_INSTANCES];
 
+	/**
+	 * Nodes indexed by ORB_ID (the IDs are dense and known at build time), each entry
+	 * is the head of a list of all instances of that topic.
+	 */
+	uORB::DeviceNode *_node_table[ORB_TOPICS_COUNT] {};
+
 	px4_sem_t	_lock; /**< lock to protect access to all class members (also for derived classes) */
 
 	void		lock() { do {} while (px4_sem_wait(&_lock) != 0); }
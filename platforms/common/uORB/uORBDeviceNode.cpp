@@ -38,14 +38,52 @@
 
 #include "SubscriptionCallback.hpp"
 
+#include <px4_platform_common/trace.h>
+
 #ifdef CONFIG_ORB_COMMUNICATOR
 #include "uORBCommunicator.hpp"
 #endif /* CONFIG_ORB_COMMUNICATOR */
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+#include <uORB/topics/uorb_topic_stats.h>
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 #if defined(__PX4_NUTTX)
 #include <nuttx/mm/mm.h>
 #endif
 
+#if CONFIG_ORB_DATA_ARENA_SIZE > 0
+// Node buffers live until shutdown, so they are taken from a pre-reserved arena
+// (falling back to the heap once it is exhausted). This avoids heap fragmentation
+// and malloc time during the burst of advertisements at boot.
+static constexpr size_t ORB_ARENA_ALIGNMENT = 32; // match px4_cache_aligned_alloc()
+alignas(ORB_ARENA_ALIGNMENT) static uint8_t orb_data_arena[CONFIG_ORB_DATA_ARENA_SIZE];
+static px4::atomic<size_t> orb_data_arena_used{0};
+
+static void *orb_data_arena_alloc(size_t size)
+{
+	size = (size + ORB_ARENA_ALIGNMENT - 1) & ~(ORB_ARENA_ALIGNMENT - 1);
+	size_t used = orb_data_arena_used.load();
+
+	while (used + size <= sizeof(orb_data_arena)) {
+		if (orb_data_arena_used.compare_exchange(&used, used + size)) {
+			return &orb_data_arena[used];
+		}
+	}
+
+	return px4_cache_aligned_alloc(size);
+}
+
+static void orb_data_arena_free(void *data)
+{
+	if ((data < (void *)orb_data_arena) || (data >= (void *)(orb_data_arena + sizeof(orb_data_arena)))) {
+		free(data);
+	}
+}
+
+size_t uORB::DeviceNode::data_arena_used() { return orb_data_arena_used.load(); }
+#endif // CONFIG_ORB_DATA_ARENA_SIZE
+
 static uORB::SubscriptionInterval *filp_to_subscription(cdev::file_t *filp) { return static_cast<uORB::SubscriptionInterval *>(filp->f_priv); }
 
 uORB::DeviceNode::DeviceNode(const struct orb_metadata *meta, const uint8_t instance, const char *path) :
@@ -57,7 +95,15 @@ uORB::DeviceNode::DeviceNode(const struct orb_metadata *meta, const uint8_t inst
 
 uORB::DeviceNode::~DeviceNode()
 {
+#if CONFIG_ORB_DATA_ARENA_SIZE > 0
+	orb_data_arena_free(_data);
+#else
 	free(_data);
+#endif // CONFIG_ORB_DATA_ARENA_SIZE
+
+#ifdef CONFIG_ORB_COMMUNICATOR
+	delete _remote_delivery;
+#endif /* CONFIG_ORB_COMMUNICATOR */
 
 	const char *devname = get_devname();
 
@@ -148,6 +194,61 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 	 *
 	 * Note that filp will usually be NULL.
 	 */
+	if (!allocate_data(false)) {
+		/* failed or could not allocate */
+		return -ENOMEM;
+	}
+
+	/* If write size does not match, that is an error */
+	if (_meta->o_size != buflen) {
+		return -EIO;
+	}
+
+	/* Perform an atomic copy. */
+	ATOMIC_ENTER;
+
+	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
+	const unsigned generation = _generation.load();
+
+	if (_write_generation.load() != generation) {
+		/* a loaned slot is still being filled in by the publisher */
+		ATOMIC_LEAVE;
+		return -EBUSY;
+	}
+
+	// claim the slot before writing, lock-free readers check it
+	_write_generation.store(generation + 1);
+
+	memcpy(slot(generation), buffer, _meta->o_size);
+
+	_generation.store(generation + 1);
+
+	PX4_TRACE_TOPIC(_meta, _instance);
+
+	// callbacks
+	unsigned callbacks = 0;
+
+	for (auto item : _callbacks) {
+		item->call();
+		callbacks++;
+	}
+
+	update_publication_statistics(callbacks);
+
+	/* Mark at least one data has been published */
+	_data_valid = true;
+
+	ATOMIC_LEAVE;
+
+	/* notify any poll waiters */
+	poll_notify(POLLIN);
+
+	return _meta->o_size;
+}
+
+bool
+uORB::DeviceNode::allocate_data(bool loan_slots)
+{
 	if (nullptr == _data) {
 
 #ifdef __PX4_NUTTX
@@ -159,12 +260,20 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 
 			/* re-check size */
 			if (nullptr == _data) {
-				const size_t data_size = _meta->o_size * _meta->o_queue;
-				_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+				_loan_slots = loan_slots;
+
+				const size_t data_size = _meta->o_size * queue_slots();
+#if CONFIG_ORB_DATA_ARENA_SIZE > 0
+				uint8_t *data = (uint8_t *) orb_data_arena_alloc(data_size);
+#else
+				uint8_t *data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+#endif // CONFIG_ORB_DATA_ARENA_SIZE
 
-				if (_data) {
-					memset(_data, 0, data_size);
+				if (data) {
+					memset(data, 0, data_size);
 				}
+
+				_data = data;
 			}
 
 			unlock();
@@ -173,39 +282,67 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		}
 
 #endif /* __PX4_NUTTX */
+	}
 
-		/* failed or could not allocate */
-		if (nullptr == _data) {
-			return -ENOMEM;
-		}
+	return (nullptr != _data);
+}
+
+unsigned
+uORB::DeviceNode::copy_all(void *dst, unsigned max, unsigned &generation, unsigned *lost)
+{
+	if (lost) {
+		*lost = 0;
 	}
 
-	/* If write size does not match, that is an error */
-	if (_meta->o_size != buflen) {
-		return -EIO;
+	if ((dst == nullptr) || (_data == nullptr) || (max == 0)) {
+		return 0;
 	}
 
-	/* Perform an atomic copy. */
 	ATOMIC_ENTER;
-	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
-	unsigned generation = _generation.fetch_add(1);
+	const unsigned current_generation = _generation.load();
+	unsigned available = current_generation - generation;
 
-	memcpy(_data + (_meta->o_size * (generation % _meta->o_queue)), buffer, _meta->o_size);
+	if (available > _meta->o_queue) {
+		// Reader is too far behind: some messages are lost
+		if (lost) {
+			*lost = available - _meta->o_queue;
+		}
 
-	// callbacks
-	for (auto item : _callbacks) {
-		item->call();
+		generation = current_generation - _meta->o_queue;
+		available = _meta->o_queue;
 	}
 
-	/* Mark at least one data has been published */
-	_data_valid = true;
+	const unsigned count = math::min(available, max);
+
+	for (unsigned i = 0; i < count; i++) {
+		memcpy((uint8_t *)dst + i * _meta->o_size, slot(generation + i), _meta->o_size);
+	}
 
 	ATOMIC_LEAVE;
 
-	/* notify any poll waiters */
-	poll_notify(POLLIN);
+	generation += count;
 
-	return _meta->o_size;
+	if (count > 0 && generation == current_generation) {
+		update_copy_statistics();
+	}
+
+	return count;
+}
+
+void *
+uORB::DeviceNode::loan()
+{
+	if (!allocate_data(true) || !_loan_slots) {
+		// the buffer was allocated by a regular publication first
+		return nullptr;
+	}
+
+	ATOMIC_ENTER;
+	const unsigned generation = _generation.load();
+	_write_generation.store(generation + 1);
+	ATOMIC_LEAVE;
+
+	return slot(generation);
 }
 
 int
@@ -280,7 +417,7 @@ uORB::DeviceNode::publish(const orb_metadata *meta, orb_advert_t handle, const v
 	uORBCommunicator::IChannel *ch = uORB::Manager::get_instance()->get_uorb_communicator();
 
 	if (ch != nullptr) {
-		if (ch->send_message(meta->o_name, meta->o_size, (uint8_t *)data) != 0) {
+		if (devnode->send_to_remote(ch, (const uint8_t *)data) != 0) {
 			PX4_ERR("Error Sending [%s] topic data over comm_channel", meta->o_name);
 			return PX4_ERROR;
 		}
@@ -291,6 +428,79 @@ uORB::DeviceNode::publish(const orb_metadata *meta, orb_advert_t handle, const v
 	return PX4_OK;
 }
 
+int
+uORB::DeviceNode::publish_loaned(const orb_metadata *meta, orb_advert_t handle)
+{
+	uORB::DeviceNode *devnode = (uORB::DeviceNode *)handle;
+
+	if ((devnode == nullptr) || (meta == nullptr) || (devnode->_data == nullptr)) {
+		errno = EFAULT;
+		return PX4_ERROR;
+	}
+
+	if (devnode->_meta->o_id != meta->o_id) {
+		errno = EINVAL;
+		return PX4_ERROR;
+	}
+
+	if (!devnode->commit_loan()) {
+		errno = EINVAL;
+		return PX4_ERROR;
+	}
+
+#ifdef CONFIG_ORB_COMMUNICATOR
+	uORBCommunicator::IChannel *ch = uORB::Manager::get_instance()->get_uorb_communicator();
+
+	if (ch != nullptr) {
+		// single publisher per loaned instance, so the latest slot is the one just committed
+		if (devnode->send_to_remote(ch, devnode->slot(devnode->_generation.load() - 1)) != 0) {
+			PX4_ERR("Error Sending [%s] topic data over comm_channel", meta->o_name);
+			return PX4_ERROR;
+		}
+	}
+
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
+	return PX4_OK;
+}
+
+bool
+uORB::DeviceNode::commit_loan()
+{
+	ATOMIC_ENTER;
+
+	const unsigned generation = _generation.load();
+
+	if (_write_generation.load() == generation) {
+		/* nothing loaned */
+		ATOMIC_LEAVE;
+		return false;
+	}
+
+	_generation.store(generation + 1);
+
+	PX4_TRACE_TOPIC(_meta, _instance);
+
+	// callbacks
+	unsigned callbacks = 0;
+
+	for (auto item : _callbacks) {
+		item->call();
+		callbacks++;
+	}
+
+	update_publication_statistics(callbacks);
+
+	_data_valid = true;
+
+	ATOMIC_LEAVE;
+
+	/* notify any poll waiters */
+	poll_notify(POLLIN);
+
+	return true;
+}
+
 int uORB::DeviceNode::unadvertise(orb_advert_t handle)
 {
 	if (handle == nullptr) {
@@ -364,6 +574,66 @@ uORB::DeviceNode::print_statistics(int max_topic_length)
 	return true;
 }
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+void
+uORB::DeviceNode::update_publication_statistics(unsigned callbacks)
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (_statistics.last_publication != 0) {
+		const uint32_t interval = math::min(now - _statistics.last_publication, (hrt_abstime)UINT32_MAX);
+
+		_statistics.interval_min_us = math::min(_statistics.interval_min_us, interval);
+		_statistics.interval_max_us = math::max(_statistics.interval_max_us, interval);
+		_statistics.interval_sum_us += interval;
+		_statistics.intervals++;
+	}
+
+	_statistics.last_publication = now;
+	_statistics.publications++;
+	_statistics.callbacks += callbacks;
+}
+
+void
+uORB::DeviceNode::get_statistics(uorb_topic_stats_s &stats)
+{
+	stats = {};
+
+	strncpy(stats.topic_name, _meta->o_name, sizeof(stats.topic_name) - 1);
+	stats.instance = _instance;
+	stats.subscribers = math::max(_subscriber_count, (int8_t)0);
+
+	ATOMIC_ENTER;
+
+	stats.publications = _generation.load();
+
+	if (_statistics.intervals > 0) {
+		stats.interval_min_us = _statistics.interval_min_us;
+		stats.interval_avg_us = _statistics.interval_sum_us / _statistics.intervals;
+		stats.interval_max_us = _statistics.interval_max_us;
+	}
+
+	if (_statistics.publications > 0) {
+		stats.callbacks_avg = (float)_statistics.callbacks / _statistics.publications;
+	}
+
+	_statistics.publications = 0;
+	_statistics.callbacks = 0;
+	_statistics.intervals = 0;
+	_statistics.interval_min_us = UINT32_MAX;
+	_statistics.interval_max_us = 0;
+	_statistics.interval_sum_us = 0;
+
+	ATOMIC_LEAVE;
+
+	static_assert(LATENCY_BINS == uorb_topic_stats_s::LATENCY_BINS, "latency bins mismatch");
+
+	for (int i = 0; i < LATENCY_BINS; i++) {
+		stats.copy_latency[i] = _statistics.copy_latency[i].fetch_and(0);
+	}
+}
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 void uORB::DeviceNode::add_internal_subscriber()
 {
 	lock();
@@ -414,7 +684,7 @@ int16_t uORB::DeviceNode::process_add_subscription()
 	if (_data != nullptr && ch != nullptr) { // _data will not be null if there is a publisher.
 		// Only send the most recent data to initialize the remote end.
 		if (_data_valid) {
-			ch->send_message(_meta->o_name, _meta->o_size, _data + (_meta->o_size * ((_generation.load() - 1) % _meta->o_queue)));
+			send_to_remote(ch, slot(_generation.load() - 1), true);
 		}
 	}
 
@@ -430,6 +700,20 @@ int16_t uORB::DeviceNode::process_received_message(int32_t length, uint8_t *data
 {
 	int16_t ret = -1;
 
+	// partial messages of a change driven remote delivery, or full ones in between
+	if ((length != (int32_t)(_meta->o_size) || _remote_delivery) && allocate_remote_delivery()) {
+		const uint8_t *message = _remote_delivery->decode(data, length,
+					 _data_valid ? slot(_generation.load() - 1) : nullptr);
+
+		if (message == nullptr) {
+			PX4_ERR("Received invalid partial '%s' with DataLength[%d]", _meta->o_name, (int)length);
+			return PX4_ERROR;
+		}
+
+		data = const_cast<uint8_t *>(message);
+		length = _meta->o_size;
+	}
+
 	if (length != (int32_t)(_meta->o_size)) {
 		PX4_ERR("Received '%s' with DataLength[%d] != ExpectedLen[%d]", _meta->o_name, (int)length, (int)_meta->o_size);
 		return PX4_ERROR;
@@ -449,6 +733,83 @@ int16_t uORB::DeviceNode::process_received_message(int32_t length, uint8_t *data
 
 	return PX4_OK;
 }
+
+bool uORB::DeviceNode::allocate_remote_delivery()
+{
+	lock();
+
+	if (_remote_delivery == nullptr) {
+		RemoteDelivery *remote_delivery = new RemoteDelivery(_meta->o_size);
+
+		if (remote_delivery && remote_delivery->init()) {
+			_remote_delivery = remote_delivery;
+
+		} else {
+			delete remote_delivery;
+		}
+	}
+
+	unlock();
+
+	return _remote_delivery != nullptr;
+}
+
+int16_t uORB::DeviceNode::send_to_remote(uORBCommunicator::IChannel *ch, const uint8_t *data, bool force_full)
+{
+	if (_remote_delivery == nullptr) {
+		return ch->send_message(_meta->o_name, _meta->o_size, const_cast<uint8_t *>(data));
+	}
+
+	int16_t ret = 0;
+
+	_remote_delivery->lock();
+	const uint8_t *out = nullptr;
+	const int length = _remote_delivery->encode(data, hrt_absolute_time(), force_full, out);
+
+	if (length > 0) {
+		ret = ch->send_message(_meta->o_name, length, const_cast<uint8_t *>(out));
+	}
+
+	_remote_delivery->unlock();
+
+	return ret;
+}
+
+int uORB::DeviceNode::configure_remote_delivery(const RemoteDelivery::Config *config)
+{
+	if (config == nullptr) {
+		if (_remote_delivery) {
+			_remote_delivery->configure(RemoteDelivery::Config{});
+		}
+
+		return PX4_OK;
+	}
+
+	for (int i = 0; i < config->num_fields; i++) {
+		if (config->field_offset[i] + config->field_size[i] > _meta->o_size) {
+			return -EINVAL;
+		}
+	}
+
+	if (!allocate_remote_delivery()) {
+		return -ENOMEM;
+	}
+
+	RemoteDelivery::Config enabled_config = *config;
+	enabled_config.enabled = true;
+	_remote_delivery->configure(enabled_config);
+	return PX4_OK;
+}
+
+void uORB::DeviceNode::print_remote_delivery() const
+{
+	if (_remote_delivery) {
+		_remote_delivery->print_status(_meta->o_name);
+
+	} else {
+		PX4_INFO_RAW("%s: full messages\n", _meta->o_name);
+	}
+}
 #endif /* CONFIG_ORB_COMMUNICATOR */
 
 unsigned uORB::DeviceNode::get_initial_generation()
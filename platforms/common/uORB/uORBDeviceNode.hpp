@@ -36,6 +36,11 @@
 #include "uORBCommon.hpp"
 #include "uORBDeviceMaster.hpp"
 
+#ifdef CONFIG_ORB_COMMUNICATOR
+#include "uORBCommunicator.hpp"
+#include "uORBRemoteDelivery.hpp"
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
 #include <lib/cdev/CDev.hpp>
 
 #include <containers/IntrusiveSortedList.hpp>
@@ -56,6 +61,8 @@ namespace uORBTest
 class UnitTest;
 }
 
+struct uorb_topic_stats_s;
+
 /**
  * Per-object device instance.
  */
@@ -151,6 +158,15 @@ public:
 	 * processed the received data message from remote.
 	 */
 	int16_t process_received_message(int32_t length, uint8_t *data);
+
+	/**
+	 * Configure how publications are sent to the remote side (see RemoteDelivery).
+	 * @param config nullptr to send every publication as a whole
+	 * @return 0 on success, otherwise failure
+	 */
+	int configure_remote_delivery(const RemoteDelivery::Config *config);
+
+	void print_remote_delivery() const;
 #endif /* CONFIG_ORB_COMMUNICATOR */
 
 	/**
@@ -226,10 +242,20 @@ public:
 	{
 		if ((dst != nullptr) && (_data != nullptr)) {
 			if (_meta->o_queue == 1) {
+#if defined(CONFIG_ORB_SEQLOCK)
+
+				if (copy_seqlock(dst, generation)) {
+					update_copy_statistics();
+					return true;
+				}
+
+				// writer kept interfering, fall back to the locked copy
+#endif // CONFIG_ORB_SEQLOCK
 				ATOMIC_ENTER;
-				memcpy(dst, _data, _meta->o_size);
 				generation = _generation.load();
+				memcpy(dst, slot(generation - 1), _meta->o_size);
 				ATOMIC_LEAVE;
+				update_copy_statistics();
 				return true;
 
 			} else {
@@ -249,11 +275,15 @@ public:
 					generation = current_generation - _meta->o_queue;
 				}
 
-				memcpy(dst, _data + (_meta->o_size * (generation % _meta->o_queue)), _meta->o_size);
+				memcpy(dst, slot(generation), _meta->o_size);
 				ATOMIC_LEAVE;
 
 				++generation;
 
+				if (generation == current_generation) {
+					update_copy_statistics();
+				}
+
 				return true;
 			}
 		}
@@ -262,6 +292,93 @@ public:
 
 	}
 
+	/**
+	 * Copies all unread messages (oldest first) in a single critical section.
+	 * @param dst array with space for at least max messages
+	 * @param max maximum number of messages to copy
+	 * @param generation
+	 *   The generation of the subscriber, advanced past the last copied message.
+	 * @param lost
+	 *   Optional, set to the number of messages overwritten before they could be read.
+	 * @return number of messages copied
+	 */
+	unsigned copy_all(void *dst, unsigned max, unsigned &generation, unsigned *lost);
+
+	/**
+	 * Get a pointer to the data in the node buffer instead of copying it.
+	 * Selects the same message as copy() and advances the generation the same way.
+	 * The publisher does not wait for borrowers, so the data may be overwritten
+	 * at any time; check with borrow_valid() after using it.
+	 *
+	 * @param generation
+	 *   The generation of the subscriber, updated to the borrowed one.
+	 * @return
+	 *   pointer to the data, nullptr if nothing was published yet.
+	 */
+	const void *borrow(unsigned &generation)
+	{
+		if (_data == nullptr) {
+			return nullptr;
+		}
+
+		const unsigned current_generation = _generation.load();
+
+		if (_meta->o_queue == 1) {
+			generation = current_generation;
+
+		} else {
+			if (current_generation == generation) {
+				--generation;
+			}
+
+			if (!is_in_range(current_generation - _meta->o_queue, generation, current_generation - 1)) {
+				generation = current_generation - _meta->o_queue;
+			}
+
+			++generation;
+		}
+
+		return slot(generation - 1);
+	}
+
+	/**
+	 * Check if the message previously returned by borrow() has not been (partially) overwritten.
+	 * @param generation
+	 *   The generation of the subscriber as updated by borrow().
+	 */
+	bool borrow_valid(unsigned generation) const { return slot_valid(generation - 1); }
+
+	/**
+	 * Loan the next slot of the node buffer to a publisher, who then fills in the
+	 * message in place and calls publish_loaned(). Calling it again before publishing
+	 * returns the same slot.
+	 * Only possible if the node buffer was allocated by a loan (it needs additional
+	 * slots, so that the loaned one never aliases readable data) and if this instance
+	 * has a single publisher.
+	 *
+	 * @return pointer to the slot, nullptr if loaning is not possible
+	 */
+	void *loan();
+
+	/**
+	 * Publish a message previously obtained from loan().
+	 */
+	static int publish_loaned(const orb_metadata *meta, orb_advert_t handle);
+
+#if CONFIG_ORB_DATA_ARENA_SIZE > 0
+	/**
+	 * Number of bytes of the pre-reserved data arena in use by node buffers.
+	 */
+	static size_t data_arena_used();
+#endif // CONFIG_ORB_DATA_ARENA_SIZE
+
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+	/**
+	 * Fill in the statistics collected since the previous call and reset them.
+	 */
+	void get_statistics(uorb_topic_stats_s &stats);
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 	// add item to list of work items to schedule on node update
 	bool register_callback(SubscriptionCallback *callback_sub);
 
@@ -276,6 +393,7 @@ protected:
 
 private:
 	friend uORBTest::UnitTest;
+	friend class uORB::DeviceMaster;
 
 	const orb_metadata *_meta; /**< object metadata information */
 
@@ -284,11 +402,122 @@ private:
 	px4::atomic<unsigned>  _generation{0};  /**< object generation count */
 	List<uORB::SubscriptionCallback *>	_callbacks;
 
+	DeviceNode *_next_instance{nullptr}; /**< next instance of the same topic (DeviceMaster lookup table) */
+
 	const uint8_t _instance; /**< orb multi instance identifier */
 	bool _advertised{false};  /**< has ever been advertised (not necessarily published data yet) */
 
 	int8_t _subscriber_count{0};
 
+	/**
+	 * Number of generations claimed by writers. Differs from _generation while a
+	 * write (or a loan) is in progress.
+	 */
+	px4::atomic<unsigned> _write_generation{0};
+
+	/**
+	 * Buffer has twice the queue size, so that a loaned slot never aliases data
+	 * readers can see. Doubling (instead of a single extra slot) keeps the slot
+	 * count a power of 2, so the index stays consistent across generation wrap-around.
+	 */
+	bool _loan_slots{false};
+
+	unsigned queue_slots() const { return _loan_slots ? (_meta->o_queue * 2) : _meta->o_queue; }
+
+	uint8_t *slot(unsigned generation) const { return _data + (_meta->o_size * (generation % queue_slots())); }
+
+	/**
+	 * A slot is reused once a writer claims a generation queue_slots() ahead of it.
+	 */
+	bool slot_valid(unsigned generation) const { return (_write_generation.load() - generation) <= queue_slots(); }
+
+	bool allocate_data(bool loan_slots);
+
+#ifdef CONFIG_ORB_COMMUNICATOR
+	/**
+	 * Allocated on first use, only freed with the node, as publishers may use it concurrently.
+	 */
+	RemoteDelivery *_remote_delivery{nullptr};
+
+	bool allocate_remote_delivery();
+
+	int16_t send_to_remote(uORBCommunicator::IChannel *ch, const uint8_t *data, bool force_full = false);
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
+	bool commit_loan();
+
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+	static constexpr int LATENCY_BINS = 6;
+
+	struct Statistics {
+		hrt_abstime last_publication{0};
+		uint32_t publications{0};
+		uint32_t callbacks{0};
+		uint32_t intervals{0};
+		uint32_t interval_min_us{UINT32_MAX};
+		uint32_t interval_max_us{0};
+		uint64_t interval_sum_us{0};
+		px4::atomic<uint32_t> copy_latency[LATENCY_BINS] {};
+	};
+
+	Statistics _statistics{};
+
+	/**
+	 * Called on each publication from within the critical section.
+	 */
+	void update_publication_statistics(unsigned callbacks);
+
+	/**
+	 * Called after copying the latest message, can be called concurrently.
+	 */
+	void update_copy_statistics()
+	{
+		// upper bounds of the latency bins
+		static constexpr hrt_abstime bins[LATENCY_BINS - 1] {100, 500, 1000, 5000, 20000};
+
+		const hrt_abstime latency = hrt_absolute_time() - _statistics.last_publication;
+		int bin = 0;
+
+		while ((bin < LATENCY_BINS - 1) && (latency >= bins[bin])) {
+			bin++;
+		}
+
+		_statistics.copy_latency[bin].fetch_add(1);
+	}
+#else
+	void update_publication_statistics(unsigned callbacks) {}
+	void update_copy_statistics() {}
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
+#if defined(CONFIG_ORB_SEQLOCK)
+	static constexpr int SEQLOCK_MAX_RETRIES = 3;
+
+	/**
+	 * Lock-free copy of single-slot data. Retries on a torn read.
+	 * @return false if the writer interfered on every attempt
+	 */
+	bool copy_seqlock(void *dst, unsigned &generation)
+	{
+		for (int i = 0; i < SEQLOCK_MAX_RETRIES; i++) {
+			const unsigned current_generation = _generation.load();
+
+			if (!slot_valid(current_generation - 1)) {
+				// write in progress
+				continue;
+			}
+
+			memcpy(dst, slot(current_generation - 1), _meta->o_size);
+
+			if (slot_valid(current_generation - 1)) {
+				generation = current_generation;
+				return true;
+			}
+		}
+
+		return false;
+	}
+#endif // CONFIG_ORB_SEQLOCK
+
 
 // Determine the data range
 	static inline bool is_in_range(unsigned left, unsigned value, unsigned right)
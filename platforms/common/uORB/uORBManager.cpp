@@ -97,21 +97,25 @@ uORB::Manager::Manager()
 
 uORB::Manager::~Manager()
 {
-	delete _device_master;
+	for (DeviceMaster *device_master : _device_master) {
+		delete device_master;
+	}
 }
 
 uORB::DeviceMaster *uORB::Manager::get_device_master()
 {
-	if (!_device_master) {
-		_device_master = new DeviceMaster();
+	DeviceMaster *&device_master = _device_master[px4::vehicle_namespace()];
+
+	if (!device_master) {
+		device_master = new DeviceMaster();
 
-		if (_device_master == nullptr) {
+		if (device_master == nullptr) {
 			PX4_ERR("Failed to allocate DeviceMaster");
 			errno = ENOMEM;
 		}
 	}
 
-	return _device_master;
+	return device_master;
 }
 
 #if defined(__PX4_NUTTX) && !defined(CONFIG_BUILD_FLAT) && defined(__KERNEL__)
@@ -185,6 +189,12 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case ORBIOCDEVDATACOPYALL: {
+			orbiocdevdatacopyall_t *data = (orbiocdevdatacopyall_t *)arg;
+			data->ret = uORB::Manager::orb_data_copy_all(data->handle, data->dst, data->max, data->generation, &data->lost);
+		}
+		break;
+
 	case ORBIOCDEVREGCALLBACK: {
 			orbiocdevregcallback_t *data = (orbiocdevregcallback_t *)arg;
 			data->registered = uORB::Manager::register_callback(data->handle, data->callback_sub);
@@ -217,6 +227,15 @@ int	uORB::Manager::orb_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+
+	case ORBIOCDEVTOPICSTATS: {
+			orbiocdevtopicstats_t *data = (orbiocdevtopicstats_t *)arg;
+			data->ret = orb_get_topic_statistics(data->index, data->stats);
+		}
+		break;
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 	case ORBIOCDEVUPDATESAVAIL: {
 			orbiocdevupdatesavail_t *data = (orbiocdevupdatesavail_t *)arg;
 			data->ret = updates_available(data->handle, data->last_generation);
@@ -458,7 +477,61 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return static_cast<DeviceNode *>(node_handle)->copy(dst, generation);
 }
 
+unsigned uORB::Manager::orb_data_copy_all(void *node_handle, void *dst, unsigned max, unsigned &generation,
+		unsigned *lost)
+{
+	if (!is_advertised(node_handle)) {
+		if (lost) {
+			*lost = 0;
+		}
+
+		return 0;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->copy_all(dst, max, generation, lost);
+}
+
 // add item to list of work items to schedule on node update
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+	if (handle == nullptr) {
+		return nullptr;
+	}
+
+#ifdef ORB_USE_PUBLISHER_RULES
+
+	if (handle == _Instance) {
+		return nullptr;
+	}
+
+#endif /* ORB_USE_PUBLISHER_RULES */
+
+	return static_cast<DeviceNode *>(handle)->loan();
+}
+
+int uORB::Manager::orb_publish_loaned(const struct orb_metadata *meta, orb_advert_t handle)
+{
+	return uORB::DeviceNode::publish_loaned(meta, handle);
+}
+
+const void *uORB::Manager::orb_data_borrow(void *node_handle, unsigned &generation, bool only_if_updated)
+{
+	if (!is_advertised(node_handle)) {
+		return nullptr;
+	}
+
+	if (only_if_updated && !static_cast<const uORB::DeviceNode *>(node_handle)->updates_available(generation)) {
+		return nullptr;
+	}
+
+	return static_cast<DeviceNode *>(node_handle)->borrow(generation);
+}
+
+bool uORB::Manager::orb_data_borrow_valid(const void *node_handle, unsigned generation)
+{
+	return static_cast<const uORB::DeviceNode *>(node_handle)->borrow_valid(generation);
+}
+
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
 	return static_cast<DeviceNode *>(node_handle)->register_callback(callback_sub);
@@ -479,6 +552,19 @@ uint8_t uORB::Manager::orb_get_instance(const void *node_handle)
 	return -1;
 }
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+bool uORB::Manager::orb_get_topic_statistics(unsigned index, uorb_topic_stats_s *stats)
+{
+	uORB::DeviceMaster *dev = uORB::Manager::get_instance()->get_device_master();
+
+	if (dev == nullptr || stats == nullptr) {
+		return false;
+	}
+
+	return dev->getTopicStatistics(index, *stats);
+}
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 /* These are optimized by inlining in NuttX Flat build */
 #if !defined(CONFIG_BUILD_FLAT)
 unsigned uORB::Manager::updates_available(const void *node_handle, unsigned last_generation)
@@ -533,8 +619,10 @@ int uORB::Manager::node_open(const struct orb_metadata *meta, bool advertiser, i
 
 		ret = PX4_ERROR;
 
-		if (get_device_master()) {
-			ret = _device_master->advertise(meta, advertiser, instance);
+		DeviceMaster *device_master = get_device_master();
+
+		if (device_master) {
+			ret = device_master->advertise(meta, advertiser, instance);
 		}
 
 		/* it's OK if it already exists */
@@ -588,6 +676,42 @@ uORBCommunicator::IChannel *uORB::Manager::get_uorb_communicator()
 	return temp;
 }
 
+int uORB::Manager::orb_set_remote_delivery(const struct orb_metadata *meta, const RemoteDelivery::Config *config)
+{
+	DeviceMaster *device_master = get_device_master();
+
+	if (device_master == nullptr) {
+		return -ENOMEM;
+	}
+
+	uORB::DeviceNode *node = device_master->getDeviceNode(meta, 0);
+
+	if (node == nullptr) {
+		// not advertised yet, create the node so that the configuration applies from the first publication
+		device_master->advertise(meta, false, nullptr);
+		node = device_master->getDeviceNode(meta, 0);
+	}
+
+	if (node == nullptr) {
+		return -ENOENT;
+	}
+
+	return node->configure_remote_delivery(config);
+}
+
+void uORB::Manager::orb_print_remote_delivery(const struct orb_metadata *meta)
+{
+	DeviceMaster *device_master = get_device_master();
+	uORB::DeviceNode *node = device_master ? device_master->getDeviceNode(meta, 0) : nullptr;
+
+	if (node) {
+		node->print_remote_delivery();
+
+	} else {
+		PX4_INFO_RAW("%s: not advertised\n", meta->o_name);
+	}
+}
+
 int16_t uORB::Manager::process_remote_topic(const char *topic_name)
 {
 	PX4_DEBUG("entering process_remote_topic: name: %s", topic_name);
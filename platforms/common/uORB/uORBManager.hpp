@@ -41,10 +41,12 @@
 #include <uORB/topics/uORBTopics.hpp> // For ORB_ID enum
 #include <stdint.h>
 #include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/vehicle_namespace.h>
 
 #ifdef CONFIG_ORB_COMMUNICATOR
 #include "ORBSet.hpp"
 #include "uORBCommunicator.hpp"
+#include "uORBRemoteDelivery.hpp"
 #endif /* CONFIG_ORB_COMMUNICATOR */
 
 namespace uORB
@@ -115,6 +117,16 @@ typedef struct {
 	bool ret;
 } orbiocdevdatacopy_t;
 
+#define ORBIOCDEVDATACOPYALL	_ORBIOCDEV(47)
+typedef struct {
+	void *handle;
+	void *dst;
+	unsigned max;
+	unsigned generation;
+	unsigned lost;
+	unsigned ret;
+} orbiocdevdatacopyall_t;
+
 #define ORBIOCDEVREGCALLBACK	_ORBIOCDEV(38)
 typedef struct {
 	void *handle;
@@ -153,6 +165,13 @@ typedef enum {
 } orbiocdevmastercmd_t;
 #define ORBIOCDEVMASTERCMD	_ORBIOCDEV(45)
 
+#define ORBIOCDEVTOPICSTATS	_ORBIOCDEV(46)
+typedef struct {
+	unsigned index;
+	struct uorb_topic_stats_s *stats;
+	bool ret;
+} orbiocdevtopicstats_t;
+
 
 /**
  * This is implemented as a singleton.  This class manages creating the
@@ -187,7 +206,7 @@ public:
 	static uORB::Manager *get_instance() { return _Instance; }
 
 	/**
-	 * Get the DeviceMaster. If it does not exist,
+	 * Get the DeviceMaster of the vehicle namespace of the calling thread. If it does not exist,
 	 * it will be created and initialized.
 	 * Note: the first call to this is not thread-safe.
 	 * @return nullptr if initialization failed (and errno will be set)
@@ -442,12 +461,46 @@ public:
 
 	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated);
 
+	/**
+	 * Copy all unread messages of a topic in one go.
+	 * @see uORB::DeviceNode::copy_all()
+	 * @return number of messages copied
+	 */
+	static unsigned orb_data_copy_all(void *node_handle, void *dst, unsigned max, unsigned &generation, unsigned *lost);
+
+	/**
+	 * Loan the next message slot of a topic to the publisher (zero-copy publication).
+	 * Not available in the userspace of protected builds.
+	 * @return pointer to fill in and publish with orb_publish_loaned(), nullptr if not supported
+	 */
+	static void *orb_loan(orb_advert_t handle);
+
+	static int orb_publish_loaned(const struct orb_metadata *meta, orb_advert_t handle);
+
+	/**
+	 * Get a pointer to the data instead of copying it.
+	 * Not available in the userspace of protected builds.
+	 * @return pointer to the data, nullptr if not updated or not supported
+	 */
+	static const void *orb_data_borrow(void *node_handle, unsigned &generation, bool only_if_updated);
+
+	static bool orb_data_borrow_valid(const void *node_handle, unsigned generation);
+
 	static bool register_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
 	static void unregister_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
 	static uint8_t orb_get_instance(const void *node_handle);
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+	/**
+	 * Get the publication and copy latency statistics of the node at a given index
+	 * and reset them. Iterate index from 0 until false is returned to get all nodes.
+	 * @return false if index is out of range
+	 */
+	static bool orb_get_topic_statistics(unsigned index, struct uorb_topic_stats_s *stats);
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 #if defined(CONFIG_BUILD_FLAT)
 	/* These are optimized by inlining in NuttX Flat build */
 	static unsigned updates_available(const void *node_handle, unsigned last_generation) { return is_advertised(node_handle) ? static_cast<const DeviceNode *>(node_handle)->updates_available(last_generation) : 0; }
@@ -476,6 +529,20 @@ public:
 	 */
 	uORBCommunicator::IChannel *get_uorb_communicator();
 
+	/**
+	 * Configure how publications of a topic are sent to the remote side,
+	 * e.g. only on change or only some of the fields (see RemoteDelivery).
+	 * @param meta topic, only instance 0 is shared with the remote side
+	 * @param config nullptr to send every publication as a whole
+	 * @return 0 on success, otherwise failure
+	 */
+	int orb_set_remote_delivery(const struct orb_metadata *meta, const RemoteDelivery::Config *config);
+
+	/**
+	 * Print the remote delivery configuration and statistics of a topic
+	 */
+	void orb_print_remote_delivery(const struct orb_metadata *meta);
+
 #endif /* CONFIG_ORB_COMMUNICATOR */
 
 private: // class methods
@@ -500,7 +567,7 @@ private: // data members
 	ORBSet _remote_topics;
 #endif /* CONFIG_ORB_COMMUNICATOR */
 
-	DeviceMaster *_device_master{nullptr};
+	DeviceMaster *_device_master[px4::VEHICLE_NAMESPACES] {};	///< one per vehicle namespace
 
 private: //class methods
 	Manager();
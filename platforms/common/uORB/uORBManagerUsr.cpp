@@ -302,6 +302,42 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return data.ret;
 }
 
+unsigned uORB::Manager::orb_data_copy_all(void *node_handle, void *dst, unsigned max, unsigned &generation,
+		unsigned *lost)
+{
+	orbiocdevdatacopyall_t data = {node_handle, dst, max, generation, 0, 0};
+	boardctl(ORBIOCDEVDATACOPYALL, reinterpret_cast<unsigned long>(&data));
+	generation = data.generation;
+
+	if (lost) {
+		*lost = data.lost;
+	}
+
+	return data.ret;
+}
+
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+	// the node buffer lives in kernel memory
+	return nullptr;
+}
+
+int uORB::Manager::orb_publish_loaned(const struct orb_metadata *meta, orb_advert_t handle)
+{
+	return PX4_ERROR;
+}
+
+const void *uORB::Manager::orb_data_borrow(void *node_handle, unsigned &generation, bool only_if_updated)
+{
+	// the node buffer lives in kernel memory
+	return nullptr;
+}
+
+bool uORB::Manager::orb_data_borrow_valid(const void *node_handle, unsigned generation)
+{
+	return false;
+}
+
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
 	orbiocdevregcallback_t data = {node_handle, callback_sub, false};
@@ -324,6 +360,16 @@ uint8_t uORB::Manager::orb_get_instance(const void *node_handle)
 	return data.instance;
 }
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+bool uORB::Manager::orb_get_topic_statistics(unsigned index, uorb_topic_stats_s *stats)
+{
+	orbiocdevtopicstats_t data = {index, stats, false};
+	boardctl(ORBIOCDEVTOPICSTATS, reinterpret_cast<unsigned long>(&data));
+
+	return data.ret;
+}
+#endif // CONFIG_ORB_TOPIC_STATISTICS
+
 unsigned uORB::Manager::updates_available(const void *node_handle, unsigned last_generation)
 {
 	orbiocdevupdatesavail_t data = {node_handle, last_generation, 0};
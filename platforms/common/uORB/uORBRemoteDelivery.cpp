@@ -0,0 +1,289 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "uORBRemoteDelivery.hpp"
+#include "uORBMessageFields.hpp"
+
+#include <px4_platform_common/log.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace uORB
+{
+
+// the timestamp is the first field of every message
+static constexpr int TIMESTAMP_SIZE = sizeof(uint64_t);
+
+RemoteDelivery::~RemoteDelivery()
+{
+	delete[] _last;
+	delete[] _encoded;
+	pthread_mutex_destroy(&_mutex);
+}
+
+bool RemoteDelivery::init()
+{
+	_last = new uint8_t[_message_size];
+	_encoded = new uint8_t[_message_size];
+	return (_last != nullptr) && (_encoded != nullptr);
+}
+
+void RemoteDelivery::configure(const Config &config)
+{
+	lock();
+	_config = config;
+	_last_valid = false; // start over with a full message
+	unlock();
+}
+
+bool RemoteDelivery::add_run(int offset, int length, const uint8_t *data, int &index)
+{
+	// a partial message needs to be smaller than a full one
+	if (index + RUN_HEADER_SIZE + length >= _message_size) {
+		return false;
+	}
+
+	const uint16_t run[2] {(uint16_t)offset, (uint16_t)length};
+	memcpy(&_encoded[index], run, sizeof(run));
+	memcpy(&_encoded[index + RUN_HEADER_SIZE], &data[offset], length);
+	index += RUN_HEADER_SIZE + length;
+	return true;
+}
+
+int RemoteDelivery::encode(const uint8_t *data, hrt_abstime now, bool force_full, const uint8_t *&out)
+{
+	out = data;
+
+	if (!_config.enabled || _message_size <= TIMESTAMP_SIZE) {
+		return _message_size;
+	}
+
+	_bytes_full += _message_size;
+
+	const bool keepalive = !_last_valid || force_full
+			       || ((_config.keepalive_us > 0) && (now - _last_full >= _config.keepalive_us));
+
+	// ranges to compare and send, the whole message or the selected fields
+	const int num_ranges = (_config.num_fields > 0) ? _config.num_fields : 1;
+	const uint16_t whole_offset = TIMESTAMP_SIZE;
+	const uint16_t whole_size = _message_size - TIMESTAMP_SIZE;
+	const uint16_t *range_offset = (_config.num_fields > 0) ? _config.field_offset : &whole_offset;
+	const uint16_t *range_size = (_config.num_fields > 0) ? _config.field_size : &whole_size;
+
+	const uint16_t header[2] {PARTIAL_MAGIC, _message_size};
+	memcpy(_encoded, header, sizeof(header));
+	int index = PARTIAL_HEADER_SIZE;
+	bool partial = add_run(0, TIMESTAMP_SIZE, data, index);
+	bool changed = false;
+
+	for (int r = 0; partial && (r < num_ranges); r++) {
+		const int end = range_offset[r] + range_size[r];
+		int i = range_offset[r];
+
+		if (keepalive) {
+			partial = (_config.num_fields > 0) && add_run(i, end - i, data, index);
+			continue;
+		}
+
+		while (i < end) {
+			if (data[i] == _last[i]) {
+				i++;
+				continue;
+			}
+
+			// extend the run over short unchanged gaps, a new run costs a header
+			int run_end = i + 1;
+
+			for (int k = run_end; (k < end) && (k < run_end + RUN_HEADER_SIZE); k++) {
+				if (data[k] != _last[k]) {
+					run_end = k + 1;
+				}
+			}
+
+			changed = true;
+			partial = add_run(i, run_end - i, data, index);
+
+			if (!partial) {
+				break;
+			}
+
+			i = run_end;
+		}
+	}
+
+	if (!keepalive && !changed && _config.on_change) {
+		_skipped++;
+		return 0;
+	}
+
+	memcpy(_last, data, _message_size);
+	_last_valid = true;
+
+	if (keepalive) {
+		_last_full = now;
+	}
+
+	if (partial) {
+		out = _encoded;
+		_sent_partial++;
+		_bytes_sent += index;
+		return index;
+	}
+
+	_sent_full++;
+	_bytes_sent += _message_size;
+	return _message_size;
+}
+
+const uint8_t *RemoteDelivery::decode(const uint8_t *msg, int32_t length, const uint8_t *latest)
+{
+	if (length == _message_size) {
+		memcpy(_last, msg, _message_size);
+		_last_valid = true;
+		return _last;
+	}
+
+	uint16_t header[2];
+
+	if (length < PARTIAL_HEADER_SIZE) {
+		return nullptr;
+	}
+
+	memcpy(header, msg, sizeof(header));
+
+	if ((header[0] != PARTIAL_MAGIC) || (header[1] != _message_size)) {
+		return nullptr;
+	}
+
+	if (!_last_valid) {
+		if (latest) {
+			memcpy(_last, latest, _message_size);
+
+		} else {
+			memset(_last, 0, _message_size);
+		}
+
+		_last_valid = true;
+	}
+
+	int index = PARTIAL_HEADER_SIZE;
+
+	while (index + RUN_HEADER_SIZE <= length) {
+		uint16_t run[2];
+		memcpy(run, &msg[index], sizeof(run));
+		index += RUN_HEADER_SIZE;
+
+		if ((run[0] + run[1] > _message_size) || (index + run[1] > length)) {
+			return nullptr;
+		}
+
+		memcpy(&_last[run[0]], &msg[index], run[1]);
+		index += run[1];
+	}
+
+	return (index == length) ? _last : nullptr;
+}
+
+void RemoteDelivery::print_status(const char *name) const
+{
+	if (!_config.enabled) {
+		PX4_INFO_RAW("%s: full messages\n", name);
+		return;
+	}
+
+	PX4_INFO_RAW("%s: %s, keepalive %" PRIu32 " ms, %s\n", name, _config.on_change ? "on change" : "every update",
+		     _config.keepalive_us / 1000, _config.num_fields > 0 ? "selected fields" : "all fields");
+	PX4_INFO_RAW("    sent: %" PRIu32 " full, %" PRIu32 " partial, %" PRIu32 " skipped, %" PRIu64 " of %" PRIu64 " bytes\n",
+		     _sent_full, _sent_partial, _skipped, _bytes_sent, _bytes_full);
+}
+
+bool RemoteDelivery::find_field(const orb_metadata *meta, const char *field_name, uint16_t &offset, uint16_t &size)
+{
+	char format_buffer[128];
+	MessageFormatReader format_reader(format_buffer, sizeof(format_buffer));
+
+	if (!format_reader.readUntilFormat(meta->o_id)) {
+		return false;
+	}
+
+	static constexpr struct {
+		const char *c_type;
+		uint8_t size;
+	} type_sizes[] = {
+		{"int8_t", 1}, {"uint8_t", 1}, {"bool", 1}, {"char", 1},
+		{"int16_t", 2}, {"uint16_t", 2},
+		{"int32_t", 4}, {"uint32_t", 4}, {"float", 4},
+		{"int64_t", 8}, {"uint64_t", 8}, {"double", 8},
+	};
+
+	int data_offset = 0;
+	int field_length = 0;
+
+	while (format_reader.readNextField(field_length)) {
+		// "<type>[<array size>] <name>"
+		const char *c_type = orb_get_c_type(format_buffer[0]);
+
+		if (!c_type) {
+			// nested message, its size is not known here
+			return false;
+		}
+
+		const char *name = strchr(format_buffer, ' ');
+		const char *array = strchr(format_buffer, '[');
+		const int array_size = (array && (!name || array < name)) ? atoi(array + 1) : 1;
+		int type_size = 0;
+
+		for (const auto &type : type_sizes) {
+			if (strcmp(c_type, type.c_type) == 0) {
+				type_size = type.size;
+			}
+		}
+
+		if (!name || type_size == 0) {
+			return false;
+		}
+
+		if (strcmp(name + 1, field_name) == 0) {
+			offset = data_offset;
+			size = type_size * array_size;
+			return true;
+		}
+
+		data_offset += type_size * array_size;
+	}
+
+	return false;
+}
+
+} // namespace uORB
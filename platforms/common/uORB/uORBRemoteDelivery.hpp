@@ -0,0 +1,138 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include <drivers/drv_hrt.h>
+#include <uORB/uORB.h>
+
+namespace uORB
+{
+
+/**
+ * Change driven and field filtered delivery of a topic to the remote side of a uORBCommunicator::IChannel.
+ *
+ * Instead of every publication as a whole, only the bytes that changed since the previous one are sent
+ * (within the selected fields, if any), with a full copy every keepalive interval.
+ * The remote side reassembles the message on top of the last one it received.
+ *
+ * A partial message is sent with the same topic name, it is distinguished from a full one by its length,
+ * which is always smaller than the message size:
+ *   uint16_t magic, uint16_t message size, then runs of: uint16_t offset, uint16_t length, <length> bytes
+ */
+class RemoteDelivery
+{
+public:
+	static constexpr int MAX_FIELDS = 16;
+	static constexpr uint16_t PARTIAL_MAGIC = 0xD17A;
+	static constexpr int PARTIAL_HEADER_SIZE = 2 * sizeof(uint16_t);
+	static constexpr int RUN_HEADER_SIZE = 2 * sizeof(uint16_t);
+
+	struct Config {
+		bool enabled{false};      ///< false: send every publication as a whole (default)
+		bool on_change{false};    ///< skip publications where nothing but the timestamp changed
+		uint32_t keepalive_us{1000000}; ///< interval of full messages, 0: only the first one
+		uint8_t num_fields{0};    ///< 0: the whole message
+		uint16_t field_offset[MAX_FIELDS] {};
+		uint16_t field_size[MAX_FIELDS] {};
+	};
+
+	explicit RemoteDelivery(uint16_t message_size) : _message_size(message_size) {}
+	~RemoteDelivery();
+
+	/**
+	 * Allocate the buffers
+	 * @return false if out of memory
+	 */
+	bool init();
+
+	void configure(const Config &config);
+
+	const Config &config() const { return _config; }
+
+	void lock() { pthread_mutex_lock(&_mutex); }
+	void unlock() { pthread_mutex_unlock(&_mutex); }
+
+	/**
+	 * Encode a publication for the remote side. Call with lock() held, until the result has been sent.
+	 * @param data the message (message_size bytes)
+	 * @param now current time
+	 * @param force_full send the whole message (e.g. to initialize a new remote subscriber)
+	 * @param out set to the bytes to send
+	 * @return number of bytes to send, 0 if the publication is skipped
+	 */
+	int encode(const uint8_t *data, hrt_abstime now, bool force_full, const uint8_t *&out);
+
+	/**
+	 * Reassemble a received (full or partial) message. Not thread-safe, only called from the channel receive path.
+	 * @param msg received bytes
+	 * @param length received length
+	 * @param latest latest local sample to start from if nothing was received yet, can be nullptr
+	 * @return complete message, nullptr if invalid
+	 */
+	const uint8_t *decode(const uint8_t *msg, int32_t length, const uint8_t *latest);
+
+	void print_status(const char *name) const;
+
+	/**
+	 * Look up the offset and size of a (non-nested) field of a message
+	 * @return true if found
+	 */
+	static bool find_field(const orb_metadata *meta, const char *field_name, uint16_t &offset, uint16_t &size);
+
+private:
+	bool add_run(int offset, int length, const uint8_t *data, int &index);
+
+	const uint16_t _message_size;
+
+	Config _config{};
+
+	uint8_t *_last{nullptr};    ///< last message sent (or received)
+	bool _last_valid{false};
+	uint8_t *_encoded{nullptr}; ///< partial message being sent
+	hrt_abstime _last_full{0};
+
+	pthread_mutex_t _mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	uint32_t _sent_full{0};
+	uint32_t _sent_partial{0};
+	uint32_t _skipped{0};
+	uint64_t _bytes_sent{0};
+	uint64_t _bytes_full{0};     ///< bytes that would have been sent without partial messages
+};
+
+} // namespace uORB
@@ -0,0 +1,186 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "uORBRemoteDelivery.hpp"
+
+#include <gtest/gtest.h>
+#include <px4_platform_common/param.h>
+#include <uORB/topics/failsafe_flags.h>
+#include <uORB/topics/vehicle_status.h>
+
+// To run: make tests TESTFILTER=uORBRemoteDelivery
+
+using uORB::RemoteDelivery;
+
+class uORBRemoteDeliveryTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		param_control_autosave(false);
+	}
+
+	// encode on the sending side, decode on the receiving one
+	int transfer(RemoteDelivery &tx, RemoteDelivery &rx, const vehicle_status_s &status, hrt_abstime now,
+		     vehicle_status_s &received)
+	{
+		const uint8_t *out = nullptr;
+		const int length = tx.encode((const uint8_t *)&status, now, false, out);
+
+		if (length > 0) {
+			const uint8_t *message = rx.decode(out, length, nullptr);
+			EXPECT_NE(message, nullptr);
+
+			if (message) {
+				memcpy(&received, message, sizeof(received));
+			}
+		}
+
+		return length;
+	}
+};
+
+TEST_F(uORBRemoteDeliveryTest, disabled_sends_full)
+{
+	RemoteDelivery tx(sizeof(vehicle_status_s));
+	ASSERT_TRUE(tx.init());
+
+	vehicle_status_s status{};
+	const uint8_t *out = nullptr;
+	EXPECT_EQ(tx.encode((const uint8_t *)&status, 1000, false, out), (int)sizeof(status));
+	EXPECT_EQ(out, (const uint8_t *)&status);
+}
+
+TEST_F(uORBRemoteDeliveryTest, delta_round_trip)
+{
+	RemoteDelivery tx(sizeof(vehicle_status_s));
+	RemoteDelivery rx(sizeof(vehicle_status_s));
+	ASSERT_TRUE(tx.init());
+	ASSERT_TRUE(rx.init());
+
+	RemoteDelivery::Config config{};
+	config.enabled = true;
+	tx.configure(config);
+
+	vehicle_status_s status{};
+	vehicle_status_s received{};
+	status.timestamp = 1000;
+	status.nav_state = vehicle_status_s::NAVIGATION_STATE_POSCTL;
+
+	// first one in full
+	EXPECT_EQ(transfer(tx, rx, status, 1000, received), (int)sizeof(status));
+	EXPECT_EQ(memcmp(&status, &received, sizeof(status)), 0);
+
+	// then only the changes
+	status.timestamp = 2000;
+	status.arming_state = vehicle_status_s::ARMING_STATE_ARMED;
+	status.armed_time = 1500;
+	const int length = transfer(tx, rx, status, 2000, received);
+	EXPECT_GT(length, 0);
+	EXPECT_LT(length, (int)sizeof(status) / 2);
+	EXPECT_EQ(memcmp(&status, &received, sizeof(status)), 0);
+
+	// unchanged still sends the timestamp
+	status.timestamp = 3000;
+	EXPECT_EQ(transfer(tx, rx, status, 3000, received),
+		  RemoteDelivery::PARTIAL_HEADER_SIZE + RemoteDelivery::RUN_HEADER_SIZE + (int)sizeof(uint64_t));
+	EXPECT_EQ(received.timestamp, 3000u);
+}
+
+TEST_F(uORBRemoteDeliveryTest, on_change_and_keepalive)
+{
+	RemoteDelivery tx(sizeof(vehicle_status_s));
+	RemoteDelivery rx(sizeof(vehicle_status_s));
+	ASSERT_TRUE(tx.init());
+	ASSERT_TRUE(rx.init());
+
+	RemoteDelivery::Config config{};
+	config.enabled = true;
+	config.on_change = true;
+	config.keepalive_us = 1000000;
+	tx.configure(config);
+
+	vehicle_status_s status{};
+	vehicle_status_s received{};
+
+	EXPECT_EQ(transfer(tx, rx, status, 1000, received), (int)sizeof(status));
+
+	// nothing changed but the timestamp
+	for (hrt_abstime t = 2000; t < 1000000; t += 100000) {
+		status.timestamp = t;
+		EXPECT_EQ(transfer(tx, rx, status, t, received), 0);
+	}
+
+	// keepalive
+	status.timestamp = 1001000;
+	EXPECT_EQ(transfer(tx, rx, status, 1001000, received), (int)sizeof(status));
+	EXPECT_EQ(received.timestamp, 1001000u);
+}
+
+TEST_F(uORBRemoteDeliveryTest, field_filter)
+{
+	RemoteDelivery tx(sizeof(failsafe_flags_s));
+	RemoteDelivery rx(sizeof(failsafe_flags_s));
+	ASSERT_TRUE(tx.init());
+	ASSERT_TRUE(rx.init());
+
+	RemoteDelivery::Config config{};
+	config.enabled = true;
+	config.num_fields = 1;
+	ASSERT_TRUE(RemoteDelivery::find_field(ORB_ID(failsafe_flags), "attitude_invalid", config.field_offset[0],
+					       config.field_size[0]));
+	EXPECT_EQ(config.field_offset[0], offsetof(failsafe_flags_s, attitude_invalid));
+	EXPECT_EQ(config.field_size[0], sizeof(bool));
+	EXPECT_FALSE(RemoteDelivery::find_field(ORB_ID(failsafe_flags), "no_such_field", config.field_offset[1],
+			config.field_size[1]));
+	tx.configure(config);
+
+	failsafe_flags_s flags{};
+	flags.timestamp = 1000;
+	flags.attitude_invalid = true;
+	flags.battery_warning = 2;
+
+	const uint8_t *out = nullptr;
+	int length = tx.encode((const uint8_t *)&flags, 1000, false, out);
+	EXPECT_LT(length, (int)sizeof(flags));
+
+	const failsafe_flags_s *received = (const failsafe_flags_s *)rx.decode(out, length, nullptr);
+	ASSERT_NE(received, nullptr);
+	EXPECT_EQ(received->timestamp, 1000u);
+	EXPECT_TRUE(received->attitude_invalid);
+	EXPECT_EQ(received->battery_warning, 0); // not selected
+
+	// truncated messages are rejected
+	EXPECT_EQ(rx.decode(out, length - 1, nullptr), nullptr);
+}
@@ -35,6 +35,17 @@
 #include <stdio.h>
 #include <errno.h>
 
+#include <px4_platform_common/vehicle_namespace.h>
+
+const char *uORB::Utils::object_dir()
+{
+	// topics of vehicle namespace n > 0 live in /obj<n>
+	static constexpr const char *dirs[] {"obj", "obj1", "obj2", "obj3", "obj4", "obj5", "obj6", "obj7", "obj8"};
+	static_assert(px4::VEHICLE_NAMESPACES <= sizeof(dirs) / sizeof(dirs[0]), "too many vehicle namespaces");
+
+	return dirs[px4::vehicle_namespace()];
+}
+
 int uORB::Utils::node_mkpath(char *buf, const struct orb_metadata *meta, int *instance)
 {
 	unsigned len;
@@ -45,7 +56,7 @@ int uORB::Utils::node_mkpath(char *buf, const struct orb_metadata *meta, int *in
 		index = *instance;
 	}
 
-	len = snprintf(buf, orb_maxpath, "/%s/%s%d", "obj", meta->o_name, index);
+	len = snprintf(buf, orb_maxpath, "/%s/%s%d", object_dir(), meta->o_name, index);
 
 	if (len >= orb_maxpath) {
 		return -ENAMETOOLONG;
@@ -62,7 +73,7 @@ int uORB::Utils::node_mkpath(char *buf, const char *orbMsgName)
 
 	unsigned index = 0;
 
-	len = snprintf(buf, orb_maxpath, "/%s/%s%d", "obj", orbMsgName, index);
+	len = snprintf(buf, orb_maxpath, "/%s/%s%d", object_dir(), orbMsgName, index);
 
 	if (len >= orb_maxpath) {
 		return -ENAMETOOLONG;
@@ -50,6 +50,11 @@ public:
 	 */
 	static int node_mkpath(char *buf, const char *orbMsgName);
 
+	/**
+	 * directory of the topic nodes of the vehicle namespace of the calling thread
+	 */
+	static const char *object_dir();
+
 };
 
 #endif // _uORBUtils_hpp_
@@ -39,7 +39,9 @@
 #include <errno.h>
 #include <math.h>
 #include <lib/cdev/CDev.hpp>
+#include <uORB/PublicationLoaned.hpp>
 #include <uORB/PublicationMulti.hpp>
+#include <uORB/SubscriptionCallbackSet.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
 
 uORBTest::UnitTest &uORBTest::UnitTest::instance()
@@ -171,6 +173,18 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
+	ret = test_loan();
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	ret = test_callback_set();
+
+	if (ret != OK) {
+		return ret;
+	}
+
 	ret = test_SubscriptionMulti();
 
 	if (ret != OK) {
@@ -213,6 +227,12 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
+	ret = test_copy_all();
+
+	if (ret != OK) {
+		return ret;
+	}
+
 	return test_queue_poll_notify();
 }
 
@@ -821,6 +841,178 @@ int uORBTest::UnitTest::test_SubscriptionMulti()
 	return test_note("PASS orb SubscriptionMulti");
 }
 
+int uORBTest::UnitTest::test_loan()
+{
+	test_note("Testing orb loan/borrow");
+
+	uORB::PublicationLoaned<orb_test_large_s> pub{ORB_ID(orb_test_large)};
+	uORB::Subscription sub{ORB_ID(orb_test_large)};
+
+	for (int i = 0; i < 10; i++) {
+		orb_test_large_s &msg = pub.loan();
+		msg.val = i;
+		msg.junk[sizeof(msg.junk) - 1] = i;
+		msg.timestamp = hrt_absolute_time();
+
+		if (!pub.publish()) {
+			return test_fail("loaned publish %d failed", i);
+		}
+
+		const orb_test_large_s *borrowed = static_cast<const orb_test_large_s *>(sub.borrow());
+
+		if (borrowed == nullptr) {
+			// not supported (eg. protected build), the subscription must still work
+			orb_test_large_s copy{};
+
+			if (!sub.update(&copy) || (copy.val != i)) {
+				return test_fail("copy %d mismatch", i);
+			}
+
+			continue;
+		}
+
+		if ((borrowed->val != i) || (borrowed->junk[sizeof(borrowed->junk) - 1] != i)) {
+			return test_fail("borrow %d mismatch: %d", i, borrowed->val);
+		}
+
+		if (!sub.borrow_valid()) {
+			return test_fail("borrow %d invalid without publication", i);
+		}
+
+		if (sub.borrow() != nullptr) {
+			return test_fail("borrow %d without update", i);
+		}
+	}
+
+	// a borrowed message gets eventually overwritten
+	const orb_test_large_s *borrowed = static_cast<const orb_test_large_s *>(sub.borrow(false));
+
+	if (borrowed != nullptr) {
+		for (int i = 0; i < 4; i++) {
+			pub.loan().val = 100 + i;
+			pub.publish();
+		}
+
+		if (sub.borrow_valid()) {
+			return test_fail("borrowed message overwritten but still valid");
+		}
+	}
+
+	// a regular publication on an instance with an outstanding loan is rejected
+	pub.loan().val = 1000;
+
+	if (pub.zero_copy()) {
+		orb_test_large_s msg{};
+		uORB::Publication<orb_test_large_s> pub_copy{ORB_ID(orb_test_large)};
+
+		if (pub_copy.publish(msg)) {
+			return test_fail("publish with outstanding loan succeeded");
+		}
+	}
+
+	pub.publish();
+
+	// multi-instance loan, borrowed or copied through a SubscriptionInterval
+	uORB::PublicationMultiLoaned<orb_test_large_s> pub_multi{ORB_ID(orb_test_large)};
+	const int instance = pub_multi.get_instance();
+
+	if (instance < 0) {
+		return test_fail("multi loaned advertise failed");
+	}
+
+	uORB::SubscriptionInterval sub_multi{ORB_ID(orb_test_large), 0, (uint8_t)instance};
+	pub_multi.loan().val = 2000;
+	pub_multi.publish();
+
+	orb_test_large_s copy{};
+	const orb_test_large_s *data = sub_multi.borrow_or_update(&copy);
+
+	if ((data == nullptr) || (data->val != 2000) || !sub_multi.borrow_valid(data, &copy)) {
+		return test_fail("multi loaned borrow_or_update failed");
+	}
+
+	if (sub_multi.borrow_or_update(&copy) != nullptr) {
+		return test_fail("multi loaned borrow_or_update without update");
+	}
+
+	return test_note("PASS orb loan/borrow");
+}
+
+class CallbackSetCounter : public uORB::SubscriptionCallbackSet
+{
+public:
+	void call() override { calls++; }
+
+	int calls{0};
+};
+
+int uORBTest::UnitTest::test_callback_set()
+{
+	test_note("Testing orb SubscriptionCallbackSet");
+
+	uORB::Publication<orb_test_s> pub_a{ORB_ID(orb_test)};
+	uORB::Publication<orb_test_medium_s> pub_b{ORB_ID(orb_test_medium)};
+
+	orb_test_s a{};
+	orb_test_medium_s b{};
+
+	pub_a.publish(a);
+	pub_b.publish(b);
+
+	CallbackSetCounter set;
+	uORB::SubscriptionCallbackSetMember sub_a{&set, ORB_ID(orb_test)};
+	uORB::SubscriptionCallbackSetMember sub_b{&set, ORB_ID(orb_test_medium)};
+
+	if (!set.registerCallbacks()) {
+		return test_fail("register callbacks failed");
+	}
+
+	// wait for all required members
+	for (int i = 0; i < 5; i++) {
+		sub_a.update(&a);
+		sub_b.update(&b);
+
+		pub_a.publish(a);
+
+		if (set.calls != i) {
+			return test_fail("set complete with one member (%d calls)", set.calls);
+		}
+
+		pub_a.publish(a);
+		sub_a.update(&a);
+		pub_b.publish(b);
+
+		if (set.calls != i + 1) {
+			return test_fail("set not complete (%d calls, expected %d)", set.calls, i + 1);
+		}
+	}
+
+	// fire after N publications
+	set.set_required_publications(3);
+	set.calls = 0;
+
+	for (int i = 0; i < 3; i++) {
+		sub_a.update(&a);
+		pub_a.publish(a);
+	}
+
+	if (set.calls != 1) {
+		return test_fail("required publications: %d calls, expected 1", set.calls);
+	}
+
+	set.unregisterCallbacks();
+	set.calls = 0;
+
+	pub_a.publish(a);
+	pub_b.publish(b);
+
+	if (set.calls != 0) {
+		return test_fail("called after unregister");
+	}
+
+	return test_note("PASS orb SubscriptionCallbackSet");
+}
+
 int uORBTest::UnitTest::test_queue()
 {
 	test_note("Testing orb queuing");
@@ -976,6 +1168,92 @@ int uORBTest::UnitTest::pub_test_queue_main()
 	return 0;
 }
 
+int uORBTest::UnitTest::test_copy_all()
+{
+	test_note("Testing copy_all");
+
+	uORB::Publication<orb_test_medium_s> pub{ORB_ID(orb_test_medium_queue)};
+	uORB::Subscription sub{ORB_ID(orb_test_medium_queue)};
+
+	const int queue_size = orb_get_queue_size(ORB_ID(orb_test_medium_queue));
+	orb_test_medium_s t{};
+	orb_test_medium_s buffer[16] {};
+	unsigned lost = 0;
+
+	if (queue_size > 16) {
+		return test_fail("queue too large: %d", queue_size);
+	}
+
+	pub.publish(t);
+
+	if (!sub.subscribe()) {
+		return test_fail("subscribe failed");
+	}
+
+	// drain everything published so far
+	sub.copy_all(buffer);
+
+	for (int i = 0; i < 3; i++) {
+		t.val = i;
+		pub.publish(t);
+	}
+
+	unsigned copied = sub.copy_all(buffer, &lost);
+
+	if (copied != 3 || lost != 0) {
+		return test_fail("copied %u (lost %u), expected 3 (lost 0)", copied, lost);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		if (buffer[i].val != i) {
+			return test_fail("wrong element %d: %d", i, buffer[i].val);
+		}
+	}
+
+	if (sub.copy_all(buffer, &lost) != 0) {
+		return test_fail("spurious copy");
+	}
+
+	test_note("  Testing overflow...");
+	const int overflow_by = 2;
+
+	for (int i = 0; i < queue_size + overflow_by; i++) {
+		t.val = i;
+		pub.publish(t);
+	}
+
+	copied = sub.copy_all(buffer, &lost);
+
+	if ((int)copied != queue_size || lost != overflow_by) {
+		return test_fail("copied %u (lost %u), expected %d (lost %d)", copied, lost, queue_size, overflow_by);
+	}
+
+	if (buffer[0].val != overflow_by || buffer[queue_size - 1].val != queue_size + overflow_by - 1) {
+		return test_fail("wrong elements after overflow: %d ... %d", buffer[0].val, buffer[queue_size - 1].val);
+	}
+
+	test_note("  Testing partial copy...");
+
+	for (int i = 0; i < 5; i++) {
+		t.val = i;
+		pub.publish(t);
+	}
+
+	copied = sub.copy_all(buffer, 2, &lost);
+
+	if (copied != 2 || buffer[1].val != 1) {
+		return test_fail("partial copy: copied %u, last %d", copied, buffer[1].val);
+	}
+
+	copied = sub.copy_all(buffer, &lost);
+
+	if (copied != 3 || lost != 0 || buffer[0].val != 2) {
+		return test_fail("remaining copy: copied %u (lost %u), first %d", copied, lost, buffer[0].val);
+	}
+
+	return test_note("PASS copy_all");
+}
+
 int uORBTest::UnitTest::test_queue_poll_notify()
 {
 	test_note("Testing orb queuing (poll & notify)");
@@ -76,6 +76,7 @@ public:
 	static void set_generation(uORB::DeviceNode &node, unsigned generation)
 	{
 		node._generation.store(generation);
+		node._write_generation.store(generation);
 	}
 
 private:
@@ -108,8 +109,13 @@ private:
 
 	int test_SubscriptionMulti();
 
+	int test_loan();
+
+	int test_callback_set();
+
 	/* queuing tests */
 	int test_queue();
+	int test_copy_all();
 	static int pub_test_queue_entry(int argc, char *argv[]);
 	int pub_test_queue_main();
 	int test_queue_poll_notify();
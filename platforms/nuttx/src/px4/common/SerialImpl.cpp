@@ -331,6 +331,56 @@ ssize_t SerialImpl::readAtLeast(uint8_t *buffer, size_t buffer_size, size_t char
 	return total_bytes_read;
 }
 
+ssize_t SerialImpl::readUntilIdle(uint8_t *buffer, size_t buffer_size, uint32_t idle_us, uint32_t timeout_ms)
+{
+	if (!_open) {
+		PX4_ERR("Cannot readUntilIdle from serial device until it has been opened");
+		return -1;
+	}
+
+	// wait for the start of a frame
+	pollfd fds[1];
+	fds[0].fd = _serial_fd;
+	fds[0].events = POLLIN;
+
+	int ret = poll(fds, sizeof(fds) / sizeof(fds[0]), timeout_ms);
+
+	if (ret <= 0) {
+		return ret;
+	}
+
+	if (!(fds[0].revents & POLLIN)) {
+		PX4_ERR("Got a poll error");
+		return -1;
+	}
+
+	// a gap shorter than 2 characters can't be told apart from the transmission of a character
+	const uint32_t character_time_us = (_baudrate > 0) ? 10000000 / _baudrate : 0;
+
+	if (idle_us < 2 * character_time_us) {
+		idle_us = 2 * character_time_us;
+	}
+
+	const hrt_abstime start_time_us = hrt_absolute_time();
+	const hrt_abstime timeout_us = timeout_ms * 1000;
+	int bytes_available = 0;
+
+	// the frame is complete when the line was idle for idle_us or the buffer is full
+	while (hrt_elapsed_time(&start_time_us) < timeout_us) {
+		int bytes_before = bytes_available;
+
+		if ((::ioctl(_serial_fd, FIONREAD, (unsigned long)&bytes_available) != 0)
+		    || (bytes_available >= (int)buffer_size)
+		    || ((bytes_available > 0) && (bytes_available == bytes_before))) {
+			break;
+		}
+
+		px4_usleep(idle_us);
+	}
+
+	return read(buffer, buffer_size);
+}
+
 ssize_t SerialImpl::write(const void *buffer, size_t buffer_size)
 {
 	if (!_open) {
@@ -42,6 +42,7 @@
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform/cpuload.h>
+#include <px4_platform_common/trace.h>
 
 #include <drivers/drv_hrt.h>
 
@@ -215,15 +216,19 @@ void sched_note_resume(FAR struct tcb_s *tcb)
 #endif
 }
 
-#ifdef CONFIG_SEGGER_SYSVIEW
-
 #ifdef CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER
 void sched_note_irqhandler(int irq, FAR void *handler, bool enter)
 {
+	PX4_TRACE(enter ? PX4_TRACE_ISR_ENTER : PX4_TRACE_ISR_EXIT, handler, 0, irq);
+
+#ifdef CONFIG_SEGGER_SYSVIEW
 	sysview_sched_note_irqhandler(irq, handler, enter);
+#endif
 }
 #endif
 
+#ifdef CONFIG_SEGGER_SYSVIEW
+
 #ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
 void sched_note_syscall_enter(int nr);
 {
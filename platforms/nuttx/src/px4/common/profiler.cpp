@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file profiler.cpp
+ *
+ * Sampling profiler for NuttX: a HRT callout runs in the timer interrupt and
+ * records the registers saved on entry to the interrupt, i.e. the program
+ * counter of the task (or nested interrupt handler) that got interrupted.
+ */
+
+#include <px4_platform_common/profiler.h>
+
+#include <drivers/drv_hrt.h>
+#include <errno.h>
+#include <nuttx/sched.h>
+#include <sched.h>
+#include <string.h>
+
+#include "arm_internal.h"
+
+static px4::ProfilerBuffer profiler_buffer;
+static struct hrt_call profiler_call;
+static px4::atomic_bool profiler_running{false};
+
+static void profiler_sample(void *arg)
+{
+	px4_profiler_sample_s sample{};
+	sample.timestamp = hrt_absolute_time();
+
+	const uint32_t *regs = (const uint32_t *)CURRENT_REGS;
+
+	if (regs != nullptr) {
+		sample.pc = regs[REG_PC];
+		sample.lr = regs[REG_LR];
+	}
+
+	sample.pid = nxsched_self()->pid;
+
+	profiler_buffer.push(sample);
+}
+
+int px4_profiler_start(uint32_t interval_us, size_t buffer_samples)
+{
+	if (profiler_running.load()) {
+		return -EBUSY;
+	}
+
+	if (interval_us == 0 || buffer_samples == 0) {
+		return -EINVAL;
+	}
+
+	if (!profiler_buffer.allocate(buffer_samples)) {
+		return -ENOMEM;
+	}
+
+	profiler_running.store(true);
+	hrt_call_every(&profiler_call, interval_us, interval_us, profiler_sample, nullptr);
+	return 0;
+}
+
+void px4_profiler_stop()
+{
+	if (profiler_running.load()) {
+		hrt_cancel(&profiler_call);
+		profiler_running.store(false);
+	}
+}
+
+bool px4_profiler_running()
+{
+	return profiler_running.load();
+}
+
+size_t px4_profiler_read(px4_profiler_sample_s *samples, size_t max_samples)
+{
+	return profiler_buffer.read(samples, max_samples);
+}
+
+void px4_profiler_stats(uint32_t *recorded, uint32_t *dropped)
+{
+	*recorded = profiler_buffer.recorded();
+	*dropped = profiler_buffer.dropped();
+}
+
+int px4_profiler_task_name(int32_t pid, char *name, size_t name_length)
+{
+	int ret = -1;
+
+	sched_lock();
+	FAR struct tcb_s *tcb = nxsched_get_tcb(pid);
+
+	if (tcb != nullptr && name_length > 0) {
+		strncpy(name, tcb->name, name_length - 1);
+		name[name_length - 1] = '\0';
+		ret = 0;
+	}
+
+	sched_unlock();
+	return ret;
+}
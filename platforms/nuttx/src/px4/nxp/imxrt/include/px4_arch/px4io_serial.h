@@ -58,6 +58,16 @@ public:
 	virtual int	read(unsigned offset, void *data, unsigned count = 1);
 	virtual int	write(unsigned address, void *data, unsigned count = 1);
 
+	/**
+	 * Write registers and get the IO status registers back in the reply of
+	 * the same transaction (PKT_CODE_WRITE_STATUS).
+	 *
+	 * @param status Buffer for PX4IO_P_STATUS_REPLY_COUNT registers from PX4IO_P_STATUS_FLAGS on.
+	 * @return The number of registers written, or a negative error.
+	 */
+	int		write_status(unsigned address, const void *data, unsigned count,
+				     uint16_t (&status)[PX4IO_P_STATUS_REPLY_COUNT]);
+
 protected:
 	/**
 	 * Does the PX4IO_serial instance initialization.
@@ -71,6 +81,12 @@ protected:
 	 */
 	virtual int	_bus_exchange(IOPacket *_packet) = 0;
 
+	/**
+	 * Write transaction shared by write() and write_status().
+	 */
+	int		_write(unsigned address, const void *data, unsigned count, uint8_t code,
+			       uint16_t *status, unsigned status_count);
+
 	/**
 	 * Performance counters.
 	 */
@@ -63,6 +63,7 @@
 
 #include <board_config.h>
 #include <drivers/drv_hrt.h>
+#include <px4_platform_common/trace.h>
 
 
 #include "kinetis.h"
@@ -751,6 +752,7 @@ hrt_call_invoke(void)
 		/* invoke the callout (if there is one) */
 		if (call->callout) {
 			hrtinfo("call %p: %p(%p)\n", call, call->callout, call->arg);
+			PX4_TRACE(PX4_TRACE_HRT_CALLOUT, call->callout, 0, (uint32_t)(now - deadline));
 			call->callout(call->arg);
 		}
 
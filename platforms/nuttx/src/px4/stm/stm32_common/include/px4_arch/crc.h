@@ -0,0 +1,109 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file crc.h
+ *
+ * CRC32 on the CRC calculation unit of the STM32F7 and STM32H7, configured for
+ * the reflected polynomial 0xEDB88320 without inversion (crc32part()).
+ *
+ * The unit is not reentrant, the caller has to serialize the calls (see
+ * px4_crc32()). The chip micro_hal.h provides the clock enable register and bit.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chip.h>
+#include <arm_internal.h>
+
+__BEGIN_DECLS
+
+#define PX4_ARCH_CRC_DR                 (STM32_CRC_BASE + 0x00)
+#define PX4_ARCH_CRC_CR                 (STM32_CRC_BASE + 0x08)
+#define PX4_ARCH_CRC_INIT               (STM32_CRC_BASE + 0x10)
+#define PX4_ARCH_CRC_POL                (STM32_CRC_BASE + 0x14)
+
+#define PX4_ARCH_CRC_CR_RESET           (1 << 0)
+#define PX4_ARCH_CRC_CR_REV_IN_BYTE     (1 << 5)
+#define PX4_ARCH_CRC_CR_REV_IN_WORD     (3 << 5)
+#define PX4_ARCH_CRC_CR_REV_OUT         (1 << 7)
+
+#define PX4_ARCH_CRC_POLYNOMIAL         0x04C11DB7u
+
+static inline uint32_t px4_arch_crc_rbit(uint32_t value)
+{
+	uint32_t result;
+	__asm__("rbit %0, %1" : "=r"(result) : "r"(value));
+	return result;
+}
+
+static inline uint32_t px4_arch_crc32(uint32_t crc, const uint8_t *src, size_t len)
+{
+	if ((getreg32(PX4_ARCH_CRC_RCC_ENR) & PX4_ARCH_CRC_RCC_EN) == 0) {
+		modifyreg32(PX4_ARCH_CRC_RCC_ENR, 0, PX4_ARCH_CRC_RCC_EN);
+	}
+
+	// the unit works on the unreflected register, the input and output reversal
+	// make it match the reflected software CRC
+	putreg32(PX4_ARCH_CRC_POLYNOMIAL, PX4_ARCH_CRC_POL);
+	putreg32(px4_arch_crc_rbit(crc), PX4_ARCH_CRC_INIT);
+	putreg32(PX4_ARCH_CRC_CR_REV_OUT | PX4_ARCH_CRC_CR_REV_IN_BYTE | PX4_ARCH_CRC_CR_RESET, PX4_ARCH_CRC_CR);
+
+	while (len > 0 && ((uintptr_t)src & 3u) != 0) {
+		putreg8(*src++, PX4_ARCH_CRC_DR);
+		len--;
+	}
+
+	if (len >= 4) {
+		// a little endian word, reversed as a whole, is its bytes in order
+		putreg32(PX4_ARCH_CRC_CR_REV_OUT | PX4_ARCH_CRC_CR_REV_IN_WORD, PX4_ARCH_CRC_CR);
+
+		for (; len >= 4; len -= 4, src += 4) {
+			putreg32(*(const uint32_t *)src, PX4_ARCH_CRC_DR);
+		}
+
+		putreg32(PX4_ARCH_CRC_CR_REV_OUT | PX4_ARCH_CRC_CR_REV_IN_BYTE, PX4_ARCH_CRC_CR);
+	}
+
+	while (len-- > 0) {
+		putreg8(*src++, PX4_ARCH_CRC_DR);
+	}
+
+	return getreg32(PX4_ARCH_CRC_DR);
+}
+
+__END_DECLS
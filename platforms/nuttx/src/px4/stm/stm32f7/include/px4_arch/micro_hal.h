@@ -55,6 +55,11 @@ __BEGIN_DECLS
 #define PX4_NUMBER_I2C_BUSES STM32F7_NI2C
 #define PX4_ADC_INTERNAL_TEMP_SENSOR_CHANNEL 18
 
+// CRC calculation unit, see px4_arch/crc.h
+#define PX4_ARCH_HAS_HW_CRC32 1
+#define PX4_ARCH_CRC_RCC_ENR STM32_RCC_AHB1ENR
+#define PX4_ARCH_CRC_RCC_EN  RCC_AHB1ENR_CRCEN
+
 
 int stm32_flash_lock(void);
 int stm32_flash_unlock(void);
@@ -68,4 +68,9 @@ int stm32h7_flash_writeprotect(size_t block, bool enabled);
 #define  stm32_flash_lock() stm32h7_flash_lock(PX4_FLASH_BASE)
 #define PX4_ADC_INTERNAL_TEMP_SENSOR_CHANNEL (20) //Valid for ADC3 on H7x3
 
+// CRC calculation unit, see px4_arch/crc.h
+#define PX4_ARCH_HAS_HW_CRC32 1
+#define PX4_ARCH_CRC_RCC_ENR STM32_RCC_AHB4ENR
+#define PX4_ARCH_CRC_RCC_EN  RCC_AHB4ENR_CRCEN
+
 __END_DECLS
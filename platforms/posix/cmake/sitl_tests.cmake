@@ -102,6 +102,23 @@ sanitizer_fail_test_on_error(sitl-imu_filtering)
 
 
 
+# Microbenchmarks, the results are for tracking only (test/sitl_benchmark/microbench_report.py)
+if(CONFIG_SYSTEMCMDS_MICROBENCH)
+	add_test(NAME sitl-microbench
+		COMMAND $<TARGET_FILE:px4>
+			-s ${PX4_SOURCE_DIR}/posix-configs/SITL/init/test/test_microbench
+			-t ${PX4_SOURCE_DIR}/test_data
+			${PX4_SOURCE_DIR}/ROMFS/px4fmu_test
+		WORKING_DIRECTORY ${SITL_WORKING_DIR}
+	)
+
+	set_tests_properties(sitl-microbench PROPERTIES FAIL_REGULAR_EXPRESSION "FAIL")
+	set_tests_properties(sitl-microbench PROPERTIES PASS_REGULAR_EXPRESSION "all PASSED")
+	sanitizer_fail_test_on_error(sitl-microbench)
+endif()
+
+
+
 # # Shutdown test
 # add_test(NAME sitl-shutdown
 # 	COMMAND $<TARGET_FILE:px4>
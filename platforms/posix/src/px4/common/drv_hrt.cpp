@@ -44,9 +44,11 @@
 #include <px4_platform_common/workqueue.h>
 #include <px4_platform_common/tasks.h>
 #include <drivers/drv_hrt.h>
+#include <px4_platform_common/trace.h>
 
 #include <semaphore.h>
 #include <time.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 #include "hrt_work.h"
@@ -66,9 +68,21 @@ static constexpr unsigned HRT_INTERVAL_MIN = 50;
 static constexpr unsigned HRT_INTERVAL_MAX = 50000000;
 
 /*
- * Queue of callout entries.
+ * Queue of callout entries, a binary min-heap ordered by deadline. Entries with
+ * the same deadline are called in the order they were entered. Every queued
+ * entry knows its position in the heap, so entering and cancelling are both
+ * O(log n).
  */
-static struct sq_queue_s	callout_queue;
+struct callout_heap_node {
+	hrt_abstime	deadline;
+	uint64_t	sequence;
+	struct hrt_call	*call;
+};
+
+static callout_heap_node	*callout_heap;
+static int			callout_heap_size;
+static int			callout_heap_capacity;
+static uint64_t			callout_sequence;
 
 /* latency baseline (last compare value applied) */
 static uint64_t			latency_baseline;
@@ -100,6 +114,123 @@ static void hrt_unlock()
 	px4_sem_post(&_hrt_lock);
 }
 
+static inline bool callout_before(const callout_heap_node &a, const callout_heap_node &b)
+{
+	return (a.deadline < b.deadline) || ((a.deadline == b.deadline) && (a.sequence < b.sequence));
+}
+
+static inline void callout_heap_set(int index, const callout_heap_node &node)
+{
+	callout_heap[index] = node;
+	node.call->callout_index = index;
+}
+
+static void callout_sift_up(int index)
+{
+	const callout_heap_node node = callout_heap[index];
+
+	while (index > 0) {
+		const int parent = (index - 1) / 2;
+
+		if (!callout_before(node, callout_heap[parent])) {
+			break;
+		}
+
+		callout_heap_set(index, callout_heap[parent]);
+		index = parent;
+	}
+
+	callout_heap_set(index, node);
+}
+
+static void callout_sift_down(int index)
+{
+	const callout_heap_node node = callout_heap[index];
+
+	while (true) {
+		int child = 2 * index + 1;
+
+		if (child >= callout_heap_size) {
+			break;
+		}
+
+		if ((child + 1 < callout_heap_size) && callout_before(callout_heap[child + 1], callout_heap[child])) {
+			child++;
+		}
+
+		if (!callout_before(callout_heap[child], node)) {
+			break;
+		}
+
+		callout_heap_set(index, callout_heap[child]);
+		index = child;
+	}
+
+	callout_heap_set(index, node);
+}
+
+/*
+ * The entry may be uninitialised, so its index is only trusted if the heap points back to it.
+ */
+static bool callout_queued(const struct hrt_call *entry)
+{
+	const int index = entry->callout_index;
+	return (index >= 0) && (index < callout_heap_size) && (callout_heap[index].call == entry);
+}
+
+static struct hrt_call *callout_peek()
+{
+	return (callout_heap_size > 0) ? callout_heap[0].call : nullptr;
+}
+
+static void callout_remove(struct hrt_call *entry)
+{
+	if (!callout_queued(entry)) {
+		return;
+	}
+
+	const int index = entry->callout_index;
+	const int last = --callout_heap_size;
+
+	if (index != last) {
+		callout_heap_set(index, callout_heap[last]);
+
+		if ((index > 0) && callout_before(callout_heap[index], callout_heap[(index - 1) / 2])) {
+			callout_sift_up(index);
+
+		} else {
+			callout_sift_down(index);
+		}
+	}
+
+	entry->callout_index = -1;
+}
+
+static bool callout_insert(struct hrt_call *entry)
+{
+	/* a periodic callout may have already re-entered itself */
+	callout_remove(entry);
+
+	if (callout_heap_size >= callout_heap_capacity) {
+		const int capacity = (callout_heap_capacity > 0) ? 2 * callout_heap_capacity : 64;
+		callout_heap_node *heap = (callout_heap_node *)realloc(callout_heap, capacity * sizeof(callout_heap_node));
+
+		if (heap == nullptr) {
+			PX4_ERR("callout queue allocation failed");
+			return false;
+		}
+
+		callout_heap = heap;
+		callout_heap_capacity = capacity;
+	}
+
+	const int index = callout_heap_size++;
+	callout_heap_set(index, callout_heap_node{entry->deadline, callout_sequence++, entry});
+	callout_sift_up(index);
+
+	return true;
+}
+
 /*
  * Get absolute time.
  */
@@ -166,7 +297,7 @@ bool	hrt_called(struct hrt_call *entry)
 void	hrt_cancel(struct hrt_call *entry)
 {
 	hrt_lock();
-	sq_rem(&entry->link, &callout_queue);
+	callout_remove(entry);
 	entry->deadline = 0;
 
 	/* if this is a periodic call being removed by the callout, prevent it from
@@ -219,8 +350,6 @@ void	hrt_call_delay(struct hrt_call *entry, hrt_abstime delay)
  */
 void	hrt_init()
 {
-	sq_init(&callout_queue);
-
 	int sem_ret = px4_sem_init(&_hrt_lock, 0, 1);
 
 	if (sem_ret) {
@@ -233,26 +362,14 @@ void	hrt_init()
 static void
 hrt_call_enter(struct hrt_call *entry)
 {
-	struct hrt_call	*call, *next;
-
-	call = (struct hrt_call *)sq_peek(&callout_queue);
+	if (!callout_insert(entry)) {
+		entry->deadline = 0;
+		return;
+	}
 
-	if ((call == nullptr) || (entry->deadline < call->deadline)) {
-		sq_addfirst(&entry->link, &callout_queue);
-		//if (call != nullptr) PX4_INFO("call enter at head, reschedule (%lu %lu)", entry->deadline, call->deadline);
+	if (callout_peek() == entry) {
 		/* we changed the next deadline, reschedule the timer event */
 		hrt_call_reschedule();
-
-	} else {
-		do {
-			next = (struct hrt_call *)sq_next(&call->link);
-
-			if ((next == nullptr) || (entry->deadline < next->deadline)) {
-				//lldbg("call enter after head\n");
-				sq_addafter(&call->link, &entry->link, &callout_queue);
-				break;
-			}
-		} while ((call = next) != nullptr);
 	}
 }
 
@@ -291,7 +408,7 @@ hrt_call_reschedule()
 {
 	hrt_abstime	now = hrt_absolute_time();
 	hrt_abstime	delay = HRT_INTERVAL_MAX;
-	struct hrt_call	*next = (struct hrt_call *)sq_peek(&callout_queue);
+	struct hrt_call	*next = callout_peek();
 	hrt_abstime	deadline = now + HRT_INTERVAL_MAX;
 
 	/*
@@ -339,16 +456,7 @@ hrt_call_internal(struct hrt_call *entry, hrt_abstime deadline, hrt_abstime inte
 
 	//PX4_INFO("hrt_call_internal after lock");
 	/* if the entry is currently queued, remove it */
-	/* note that we are using a potentially uninitialised
-	   entry->link here, but it is safe as sq_rem() doesn't
-	   dereference the passed node unless it is found in the
-	   list. So we potentially waste a bit of time searching the
-	   queue for the uninitialised entry->link but we don't do
-	   anything actually unsafe.
-	*/
-	if (entry->deadline != 0) {
-		sq_rem(&entry->link, &callout_queue);
-	}
+	callout_remove(entry);
 
 #if 1
 
@@ -419,7 +527,7 @@ hrt_call_invoke()
 		/* get the current time */
 		hrt_abstime now = hrt_absolute_time();
 
-		call = (struct hrt_call *)sq_peek(&callout_queue);
+		call = callout_peek();
 
 		if (call == nullptr) {
 			break;
@@ -429,7 +537,7 @@ hrt_call_invoke()
 			break;
 		}
 
-		sq_rem(&call->link, &callout_queue);
+		callout_remove(call);
 		//PX4_INFO("call pop");
 
 		/* save the intended deadline for periodic calls */
@@ -444,6 +552,7 @@ hrt_call_invoke()
 			hrt_unlock();
 
 			//PX4_INFO("call %p: %p(%p)", call, call->callout, call->arg);
+			PX4_TRACE(PX4_TRACE_HRT_CALLOUT, call->callout, 0, (uint32_t)(now - deadline));
 			call->callout(call->arg);
 
 			hrt_lock();
@@ -543,4 +652,9 @@ void px4_lockstep_wait_for_components()
 {
 	lockstep_scheduler.components().wait_for_components();
 }
+
+hrt_abstime px4_lockstep_next_deadline()
+{
+	return lockstep_scheduler.next_deadline();
+}
 #endif
@@ -51,6 +51,14 @@ public:
 
 	void set_absolute_time(uint64_t time_us);
 	inline uint64_t get_absolute_time() const { return _time_us; }
+
+	/**
+	 * Earliest time a thread waits for (UINT64_MAX if there is none).
+	 * The time can be advanced up to here without waking up any thread. It can be earlier than
+	 * the actual next deadline if a thread got woken up by its condition in the meantime.
+	 */
+	inline uint64_t next_deadline() const { return _next_deadline_us; }
+
 	int cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *lock, uint64_t time_us);
 	int usleep_until(uint64_t timed_us);
 
@@ -77,12 +85,17 @@ private:
 
 			// If a thread quickly exits after a cond_timedwait(), the
 			// thread_local object can still be in the linked list. In that case
-			// we need to wait until it's removed.
+			// we remove it, as set_absolute_time() only cleans up the list once a deadline is due.
+			if (!removed && scheduler) {
+				scheduler->remove_timed_wait(this);
+			}
+
 			while (!removed) {
 				system_usleep(5000);
 			}
 		}
 
+		LockstepScheduler *scheduler{nullptr};
 		pthread_cond_t *passed_cond{nullptr};
 		pthread_mutex_t *passed_lock{nullptr};
 		uint64_t time_us{0};
@@ -93,9 +106,12 @@ private:
 		TimedWait *next{nullptr}; ///< linked list
 	};
 
+	void remove_timed_wait(TimedWait *timed_wait);
+
 	LockstepComponents _components;
 
 	std::atomic<uint64_t> _time_us{0};
+	std::atomic<uint64_t> _next_deadline_us{0}; ///< lower bound of the earliest time_us of the timed waits
 
 	TimedWait *_timed_waits{nullptr}; ///< head of linked list
 	std::mutex _timed_waits_mutex;
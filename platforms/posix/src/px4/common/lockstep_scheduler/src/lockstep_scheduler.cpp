@@ -55,12 +55,18 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 
 	_time_us = time_us;
 
+	// No timed wait is due yet, so there is nobody to wake up
+	if (time_us < _next_deadline_us) {
+		return;
+	}
+
 	{
 		std::unique_lock<std::mutex> lock_timed_waits(_timed_waits_mutex);
 		_setting_time = true;
 
 		TimedWait *timed_wait = _timed_waits;
 		TimedWait *timed_wait_prev = nullptr;
+		uint64_t next_deadline = UINT64_MAX;
 
 		while (timed_wait) {
 			// Clean up the ones that are already done from last iteration.
@@ -87,12 +93,16 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 				timed_wait->timeout = true;
 				pthread_cond_broadcast(timed_wait->passed_cond);
 				pthread_mutex_unlock(timed_wait->passed_lock);
+
+			} else if (!timed_wait->timeout && timed_wait->time_us < next_deadline) {
+				next_deadline = timed_wait->time_us;
 			}
 
 			timed_wait_prev = timed_wait;
 			timed_wait = timed_wait->next;
 		}
 
+		_next_deadline_us = next_deadline;
 		_setting_time = false;
 	}
 }
@@ -105,11 +115,18 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 	{
 		std::lock_guard<std::mutex> lock_timed_waits(_timed_waits_mutex);
 
+		// Lower the deadline before checking the time: either set_absolute_time() sees the new deadline,
+		// or we see the new time here.
+		if (time_us < _next_deadline_us) {
+			_next_deadline_us = time_us;
+		}
+
 		// The time has already passed.
 		if (time_us <= _time_us) {
 			return ETIMEDOUT;
 		}
 
+		timed_wait.scheduler = this;
 		timed_wait.time_us = time_us;
 		timed_wait.passed_cond = cond;
 		timed_wait.passed_lock = lock;
@@ -153,6 +170,23 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 	return result;
 }
 
+void LockstepScheduler::remove_timed_wait(TimedWait *timed_wait)
+{
+	std::lock_guard<std::mutex> lock_timed_waits(_timed_waits_mutex);
+
+	TimedWait **link = &_timed_waits;
+
+	while (*link && *link != timed_wait) {
+		link = &(*link)->next;
+	}
+
+	if (*link) {
+		*link = timed_wait->next;
+	}
+
+	timed_wait->removed = true;
+}
+
 int LockstepScheduler::usleep_until(uint64_t time_us)
 {
 	pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
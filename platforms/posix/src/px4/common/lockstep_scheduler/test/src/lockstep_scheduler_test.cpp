@@ -307,6 +307,31 @@ void test_usleep()
 	thread.join(ls);
 }
 
+void test_next_deadline()
+{
+	LockstepScheduler ls;
+	ls.set_absolute_time(some_time_us);
+
+	std::atomic<bool> usleep_triggered{false};
+
+	TestThread thread([&ls, &usleep_triggered]() {
+		// wait until the main thread sleeps
+		WAIT_FOR(ls.next_deadline() == some_time_us + 1000);
+
+		// advancing the time before the deadline does not wake it up
+		ls.set_absolute_time(some_time_us + 500);
+		EXPECT_EQ(ls.next_deadline(), some_time_us + 1000);
+		EXPECT_FALSE(usleep_triggered);
+
+		ls.set_absolute_time(some_time_us + 1500);
+		EXPECT_EQ(ls.next_deadline(), UINT64_MAX);
+	});
+
+	EXPECT_EQ(ls.usleep_until(some_time_us + 1000), 0);
+	usleep_triggered = true;
+	thread.join(ls);
+}
+
 TEST(LockstepScheduler, All)
 {
 	for (unsigned iteration = 1; iteration <= 100; ++iteration) {
@@ -316,5 +341,6 @@ TEST(LockstepScheduler, All)
 		test_locked_semaphore_getting_unlocked();
 		test_usleep();
 		test_multiple_semaphores_waiting();
+		test_next_deadline();
 	}
 }
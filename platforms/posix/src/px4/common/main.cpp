@@ -179,6 +179,25 @@ int main(int argc, char **argv)
 		argv[0] += path_length + strlen(prefix);
 
 		px4_daemon::Client client(instance);
+
+		if (argc >= 2 && strcmp(argv[1], "--batch") == 0) {
+			/* run every line of the file (or stdin) as a command over a single connection */
+			FILE *input = (argc >= 3 && strcmp(argv[2], "-") != 0) ? fopen(argv[2], "r") : stdin;
+
+			if (input == nullptr) {
+				PX4_ERR("failed to open %s: %s", argv[2], strerror(errno));
+				return PX4_ERROR;
+			}
+
+			ret = client.process_batch(input);
+
+			if (input != stdin) {
+				fclose(input);
+			}
+
+			return ret;
+		}
+
 		return client.process_args(argc, (const char **)argv);
 
 	} else {
@@ -633,6 +652,8 @@ void print_usage()
 	printf("\n");
 	printf("    px4-MODULE [--instance <instance>] command using symlink.\n");
 	printf("        e.g.: px4-commander status\n");
+	printf("    px4-MODULE [--instance <instance>] --batch [<file>|-]\n");
+	printf("        runs every line of the file (default stdin) as a command over a single connection\n");
 }
 
 int get_server_running(int instance, bool *is_server_running)
@@ -0,0 +1,223 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file profiler.cpp
+ *
+ * Sampling profiler for POSIX: on Linux, ITIMER_PROF delivers SIGPROF to the
+ * thread that is consuming CPU time, the handler records the program counter
+ * from the signal context. Other platforms are not supported.
+ */
+
+#include <px4_platform_common/profiler.h>
+
+#include <errno.h>
+
+#if defined(__linux__)
+
+#include <drivers/drv_hrt.h>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+static px4::ProfilerBuffer profiler_buffer;
+static px4::atomic_bool profiler_running{false};
+
+static void profiler_signal_handler(int signum, siginfo_t *info, void *context)
+{
+	if (!profiler_running.load()) {
+		return;
+	}
+
+	const int saved_errno = errno;
+	const ucontext_t *uc = (const ucontext_t *)context;
+
+	px4_profiler_sample_s sample{};
+	sample.timestamp = hrt_absolute_time();
+	sample.pid = (int32_t)syscall(SYS_gettid);
+
+#if defined(__x86_64__)
+	sample.pc = uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__i386__)
+	sample.pc = uc->uc_mcontext.gregs[REG_EIP];
+#elif defined(__aarch64__)
+	sample.pc = uc->uc_mcontext.pc;
+	sample.lr = uc->uc_mcontext.regs[30];
+#elif defined(__arm__)
+	sample.pc = uc->uc_mcontext.arm_pc;
+	sample.lr = uc->uc_mcontext.arm_lr;
+#else
+	(void)uc;
+#endif
+
+	profiler_buffer.push(sample);
+
+	errno = saved_errno;
+}
+
+int px4_profiler_start(uint32_t interval_us, size_t buffer_samples)
+{
+	if (profiler_running.load()) {
+		return -EBUSY;
+	}
+
+	if (interval_us == 0 || buffer_samples == 0) {
+		return -EINVAL;
+	}
+
+	if (!profiler_buffer.allocate(buffer_samples)) {
+		return -ENOMEM;
+	}
+
+	struct sigaction sa {};
+	sa.sa_sigaction = profiler_signal_handler;
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+
+	if (sigaction(SIGPROF, &sa, nullptr) != 0) {
+		return -errno;
+	}
+
+	profiler_running.store(true);
+
+	struct itimerval timer {};
+	timer.it_interval.tv_sec = interval_us / 1000000;
+	timer.it_interval.tv_usec = interval_us % 1000000;
+	timer.it_value = timer.it_interval;
+
+	if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+		profiler_running.store(false);
+		return -errno;
+	}
+
+	return 0;
+}
+
+void px4_profiler_stop()
+{
+	if (profiler_running.load()) {
+		struct itimerval timer {};
+		setitimer(ITIMER_PROF, &timer, nullptr);
+		profiler_running.store(false);
+		// the handler stays installed and ignores signals still in flight
+	}
+}
+
+bool px4_profiler_running()
+{
+	return profiler_running.load();
+}
+
+size_t px4_profiler_read(px4_profiler_sample_s *samples, size_t max_samples)
+{
+	return profiler_buffer.read(samples, max_samples);
+}
+
+void px4_profiler_stats(uint32_t *recorded, uint32_t *dropped)
+{
+	*recorded = profiler_buffer.recorded();
+	*dropped = profiler_buffer.dropped();
+}
+
+int px4_profiler_task_name(int32_t pid, char *name, size_t name_length)
+{
+	if (name_length == 0) {
+		return -1;
+	}
+
+	char path[64];
+	snprintf(path, sizeof(path), "/proc/self/task/%d/comm", (int)pid);
+
+	const int fd = open(path, O_RDONLY);
+
+	if (fd < 0) {
+		return -1;
+	}
+
+	const ssize_t len = read(fd, name, name_length - 1);
+	close(fd);
+
+	if (len <= 0) {
+		return -1;
+	}
+
+	name[len] = '\0';
+
+	// strip the trailing newline
+	if (name[len - 1] == '\n') {
+		name[len - 1] = '\0';
+	}
+
+	return 0;
+}
+
+#else
+
+int px4_profiler_start(uint32_t interval_us, size_t buffer_samples)
+{
+	return -ENOTSUP;
+}
+
+void px4_profiler_stop()
+{
+}
+
+bool px4_profiler_running()
+{
+	return false;
+}
+
+size_t px4_profiler_read(px4_profiler_sample_s *samples, size_t max_samples)
+{
+	return 0;
+}
+
+void px4_profiler_stats(uint32_t *recorded, uint32_t *dropped)
+{
+	*recorded = 0;
+	*dropped = 0;
+}
+
+int px4_profiler_task_name(int32_t pid, char *name, size_t name_length)
+{
+	return -1;
+}
+
+#endif
@@ -62,7 +62,7 @@ Client::Client(int instance_id) :
 {}
 
 int
-Client::process_args(const int argc, const char **argv)
+Client::_connect()
 {
 	std::string sock_path = get_socket_path(_instance_id);
 
@@ -82,6 +82,16 @@ Client::process_args(const int argc, const char **argv)
 		return -1;
 	}
 
+	return 0;
+}
+
+int
+Client::process_args(const int argc, const char **argv)
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
 	int ret = _send_cmds(argc, argv);
 
 	if (ret != 0) {
@@ -92,6 +102,52 @@ Client::process_args(const int argc, const char **argv)
 	return _listen();
 }
 
+int
+Client::process_batch(FILE *input)
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
+	const char flags = (isatty(STDOUT_FILENO) ? CMD_FLAG_ISATTY : 0) | CMD_FLAG_PERSISTENT;
+
+	int result = 0;
+	char line[1024];
+
+	while (fgets(line, sizeof(line), input) != nullptr) {
+		std::string cmd = line;
+
+		// Strip the line ending and leading whitespace.
+		while (!cmd.empty() && (cmd.back() == '\n' || cmd.back() == '\r')) {
+			cmd.pop_back();
+		}
+
+		cmd.erase(0, cmd.find_first_not_of(" \t"));
+
+		if (cmd.empty() || cmd[0] == '#') {
+			continue;
+		}
+
+		if (_send_cmd(cmd, flags) != 0) {
+			PX4_ERR("Could not send commands");
+			return -3;
+		}
+
+		int ret = _listen_persistent();
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (result == 0) {
+			result = ret;
+		}
+	}
+
+	// Closing our side ends the session on the server.
+	return result;
+}
+
 int
 Client::_send_cmds(const int argc, const char **argv)
 {
@@ -107,8 +163,16 @@ Client::_send_cmds(const int argc, const char **argv)
 		}
 	}
 
-	// Last byte is 'isatty'.
-	cmd_buf.push_back(isatty(STDOUT_FILENO));
+	return _send_cmd(cmd_buf, isatty(STDOUT_FILENO) ? CMD_FLAG_ISATTY : 0);
+}
+
+int
+Client::_send_cmd(const std::string &cmd, char flags)
+{
+	std::string cmd_buf = cmd;
+
+	// Last byte is the flags ('isatty', persistent connection).
+	cmd_buf.push_back(flags);
 
 	size_t n = cmd_buf.size();
 	const char *buf = cmd_buf.data();
@@ -177,6 +241,48 @@ Client::_listen()
 	}
 }
 
+int
+Client::_listen_persistent()
+{
+	char buffer[1024];
+	bool end_marker = false;
+
+	// The response ends at the first 0, followed by retval. The server only
+	// sends more once it got the next command, so nothing follows retval.
+	while (true) {
+		int n_read = read(_fd, buffer, sizeof buffer);
+
+		if (n_read < 0) {
+			PX4_ERR("unable to read from socket");
+			return -1;
+
+		} else if (n_read == 0) {
+			// Stream was abruptly ended.
+			return -1;
+		}
+
+		if (end_marker) {
+			return (unsigned char)buffer[0];
+		}
+
+		const char *end = (const char *)memchr(buffer, 0, n_read);
+
+		if (end == nullptr) {
+			fwrite(buffer, n_read, 1, stdout);
+			continue;
+		}
+
+		fwrite(buffer, end - buffer, 1, stdout);
+		fflush(stdout);
+
+		if (end + 1 < buffer + n_read) {
+			return (unsigned char)end[1];
+		}
+
+		end_marker = true;
+	}
+}
+
 Client::~Client()
 {
 	if (_fd >= 0) {
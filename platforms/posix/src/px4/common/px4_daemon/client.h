@@ -40,6 +40,9 @@
  * It the client dies, the connection gets closed automatically and the corresponding
  * thread in the server gets cancelled.
  *
+ * In batch mode the client keeps the connection open and runs one command line
+ * after the other, without the cost of a new connection per command.
+ *
  * @author Julian Oes <julian@oes.ch>
  * @author Beat Küng <beat-kueng@gmx.net>
  * @author Mara Bos <m-ou.se@m-ou.se>
@@ -47,6 +50,9 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdio.h>
+
+#include <string>
 
 #include "sock_protocol.h"
 
@@ -76,9 +82,21 @@ public:
 	 */
 	int process_args(const int argc, const char **argv);
 
+	/**
+	 * Send every line of the input to the server as a separate command, all on
+	 * the same connection. Empty lines and lines starting with '#' are skipped.
+	 *
+	 * @param input: stream to read the command lines from
+	 * @return 0 if all commands succeeded, otherwise the first non-zero return value
+	 */
+	int process_batch(FILE *input);
+
 private:
+	int _connect();
 	int _send_cmds(const int argc, const char **argv);
+	int _send_cmd(const std::string &cmd, char flags);
 	int _listen();
+	int _listen_persistent();
 
 	int _fd;
 	int _instance_id; ///< instance ID for running multiple instances of the px4 server
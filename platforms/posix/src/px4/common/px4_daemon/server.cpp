@@ -136,6 +136,16 @@ Server::_server_main()
 		return;
 	}
 
+	_lock();
+
+	for (int i = 0; i < WORKER_POOL_SIZE; i++) {
+		if (!_spawn_worker()) {
+			break;
+		}
+	}
+
+	_unlock();
+
 	// The list of file descriptors to watch.
 	std::vector<pollfd> poll_fds;
 
@@ -180,9 +190,19 @@ Server::_server_main()
 				// Set stream to line buffered.
 				setvbuf(thread_stdout, nullptr, _IOLBF, BUFSIZ);
 
-				// Start a new thread to handle the client.
-				pthread_t *thread = &_fd_to_thread[client];
-				ret = pthread_create(thread, nullptr, Server::_handle_client, thread_stdout);
+				// Hand the client to an idle worker, or start a new thread to handle it.
+				if (_dispatch_to_worker(thread_stdout)) {
+					ret = 0;
+
+				} else {
+					pthread_t *thread = &_fd_to_thread[client];
+					ret = pthread_create(thread, nullptr, Server::_handle_client, thread_stdout);
+
+					if (ret == 0) {
+						// We won't join the thread, so detach to automatically release resources at its end
+						pthread_detach(*thread);
+					}
+				}
 
 				if (ret != 0) {
 					PX4_ERR("could not start pthread (%i)", ret);
@@ -190,9 +210,6 @@ Server::_server_main()
 					fclose(thread_stdout);
 
 				} else {
-					// We won't join the thread, so detach to automatically release resources at its end
-					pthread_detach(*thread);
-
 					// Start listening for the client hanging up.
 					poll_fds.push_back(pollfd {client, POLLHUP, 0});
 
@@ -212,6 +229,16 @@ Server::_server_main()
 					// Thread is still running, so we cancel it.
 					// TODO: use a more graceful exit method to avoid resource leaks
 					pthread_cancel(thread->second);
+
+					// A cancelled worker is gone for good, replace it to keep the pool size.
+					for (auto worker = _workers.begin(); worker != _workers.end(); ++worker) {
+						if (pthread_equal((*worker)->thread, thread->second)) {
+							_workers.erase(worker);
+							_spawn_worker();
+							break;
+						}
+					}
+
 					_fd_to_thread.erase(thread);
 				}
 
@@ -232,68 +259,173 @@ Server::_server_main()
 	close(_fd);
 }
 
+bool
+Server::_spawn_worker()
+{
+	Worker *worker = new Worker{};
+	pthread_cond_init(&worker->cond, nullptr);
+
+	int ret = pthread_create(&worker->thread, nullptr, Server::_worker_main, worker);
+
+	if (ret != 0) {
+		PX4_ERR("could not start worker pthread (%i)", ret);
+		pthread_cond_destroy(&worker->cond);
+		delete worker;
+		return false;
+	}
+
+	// We won't join the thread, so detach to automatically release resources at its end
+	pthread_detach(worker->thread);
+	_workers.push_back(worker);
+	return true;
+}
+
+bool
+Server::_dispatch_to_worker(FILE *client)
+{
+	for (Worker *worker : _workers) {
+		if (worker->idle) {
+			worker->idle = false;
+			worker->client = client;
+			_fd_to_thread[fileno(client)] = worker->thread;
+			pthread_cond_signal(&worker->cond);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void
+*Server::_worker_main(void *arg)
+{
+	Worker *worker = (Worker *)arg;
+
+	// The worker gets cancelled if its client hangs up while a command is running.
+	pthread_cleanup_push(_worker_cleanup, worker);
+
+	while (true) {
+		FILE *out = nullptr;
+
+		_instance->_lock();
+		pthread_cleanup_push(_unlock_cleanup, nullptr);
+
+		worker->idle = true;
+
+		while (worker->client == nullptr) {
+			pthread_cond_wait(&worker->cond, &_instance->_mutex);
+		}
+
+		out = worker->client;
+		worker->client = nullptr;
+
+		pthread_cleanup_pop(1);
+
+		_serve_client(out);
+		_cleanup(fileno(out));
+	}
+
+	pthread_cleanup_pop(1);
+	return nullptr;
+}
+
+void
+Server::_worker_cleanup(void *arg)
+{
+	Worker *worker = (Worker *)arg;
+	pthread_cond_destroy(&worker->cond);
+	delete worker;
+}
+
+void
+Server::_unlock_cleanup(void *)
+{
+	_instance->_unlock();
+}
+
 void
 *Server::_handle_client(void *arg)
 {
 	FILE *out = (FILE *)arg;
+
+	_serve_client(out);
+	_cleanup(fileno(out));
+	return nullptr;
+}
+
+void
+Server::_serve_client(FILE *out)
+{
 	int fd = fileno(out);
 
-	// Read until the end of the incoming stream.
-	std::string cmd;
+	// Incoming stream, a persistent client may send the next command before we look at it.
+	std::string stream;
 
 	while (true) {
-		size_t n = cmd.size();
-		cmd.resize(n + 1024);
-		ssize_t n_read = read(fd, &cmd[n], cmd.size() - n);
+		// Read until the end of the next command.
+		size_t cmd_end = 0;
 
-		if (n_read <= 0) {
-			_cleanup(fd);
-			return nullptr;
-		}
+		while (true) {
+			while (cmd_end < stream.size() && (unsigned char)stream[cmd_end] > CMD_FLAG_MASK) {
+				cmd_end++;
+			}
 
-		cmd.resize(n + n_read);
+			if (cmd_end < stream.size()) {
+				break;
+			}
 
-		// Command ends in 0x00 (no tty) or 0x01 (tty).
-		if (!cmd.empty() && cmd.back() < 2) {
-			break;
+			size_t n = stream.size();
+			stream.resize(n + 1024);
+			ssize_t n_read = read(fd, &stream[n], stream.size() - n);
+
+			if (n_read <= 0) {
+				return;
+			}
+
+			stream.resize(n + n_read);
 		}
-	}
 
-	if (cmd.size() < 2) {
-		_cleanup(fd);
-		return nullptr;
-	}
+		// Command ends in the flags byte: 'isatty' and whether more commands follow.
+		const uint8_t flags = stream[cmd_end];
+		std::string cmd = stream.substr(0, cmd_end);
+		stream.erase(0, cmd_end + 1);
 
-	// Last byte is 'isatty'.
-	uint8_t isatty = cmd.back();
-	cmd.pop_back();
+		if (cmd.empty()) {
+			return;
+		}
+
+		// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
+		CmdThreadSpecificData *thread_data_ptr;
 
-	// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
-	CmdThreadSpecificData *thread_data_ptr;
+		if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
+			thread_data_ptr = new CmdThreadSpecificData;
+			(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
+		}
 
-	if ((thread_data_ptr = (CmdThreadSpecificData *)pthread_getspecific(_instance->_key)) == nullptr) {
-		thread_data_ptr = new CmdThreadSpecificData;
+		// A pool worker serves many clients, so this is updated with every command.
 		thread_data_ptr->thread_stdout = out;
-		thread_data_ptr->is_atty = isatty;
+		thread_data_ptr->is_atty = flags & CMD_FLAG_ISATTY;
 
-		(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
-	}
+		// Run the actual command.
+		int retval = Pxh::process_line(cmd, true);
 
-	// Run the actual command.
-	int retval = Pxh::process_line(cmd, true);
+		// Report return value.
+		char buf[2] = {0, (char)retval};
 
-	// Report return value.
-	char buf[2] = {0, (char)retval};
+		if (fwrite(buf, sizeof buf, 1, out) != 1) {
+			// Don't care it went wrong, as we're cleaning up anyway.
+		}
 
-	if (fwrite(buf, sizeof buf, 1, out) != 1) {
-		// Don't care it went wrong, as we're cleaning up anyway.
-	}
+		// Flush the FILE*'s buffer before we shut down the connection or wait for the next command.
+		fflush(out);
 
-	// Flush the FILE*'s buffer before we shut down the connection.
-	fflush(out);
+		// The server thread closes the FILE* after the hang up, so nothing may log to it anymore.
+		thread_data_ptr->thread_stdout = nullptr;
 
-	_cleanup(fd);
-	return nullptr;
+		if (!(flags & CMD_FLAG_PERSISTENT)) {
+			return;
+		}
+	}
 }
 
 void
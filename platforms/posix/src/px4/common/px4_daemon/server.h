@@ -37,7 +37,11 @@
  *
  * Once a client connects it will send a command and close its side of the connection.
  * The server will return the stdout of the executing command, as well as the return
- * value to the client.
+ * value to the client. A persistent client keeps the connection open and sends
+ * one command after the other (see sock_protocol.h).
+ *
+ * Clients are handed to a pool of pre-spawned worker threads. Only if all of them
+ * are busy (e.g. with long running commands) a dedicated thread is started.
  *
  * There should only every be one server running, therefore the static instance.
  * The Singleton implementation is not complete, but it should be obvious not
@@ -54,6 +58,7 @@
 #include <stdbool.h>
 #include <pthread.h>
 #include <map>
+#include <vector>
 
 #include "sock_protocol.h"
 
@@ -103,13 +108,30 @@ private:
 		pthread_mutex_unlock(&_mutex);
 	}
 
+	struct Worker {
+		pthread_t thread;
+		pthread_cond_t cond;
+		FILE *client{nullptr};	///< client to serve, set by the server thread
+		bool idle{false};
+	};
+
+	static constexpr int WORKER_POOL_SIZE = 4;
+
+	bool _spawn_worker();
+	bool _dispatch_to_worker(FILE *client);
+	static void *_worker_main(void *arg);
+	static void _worker_cleanup(void *arg);
+	static void _unlock_cleanup(void *arg);
+
 	static void *_handle_client(void *arg);
+	static void _serve_client(FILE *out);
 	static void _cleanup(int fd);
 
 	pthread_t _server_main_pthread;
 
 	std::map<int, pthread_t> _fd_to_thread;
-	pthread_mutex_t _mutex; ///< Protects _fd_to_thread.
+	std::vector<Worker *> _workers;
+	pthread_mutex_t _mutex; ///< Protects _fd_to_thread and _workers.
 
 	pthread_key_t _key;
 
@@ -44,4 +44,15 @@ namespace px4_daemon
 
 std::string get_socket_path(int instance_id);
 
+/*
+ * A command is terminated by a single flags byte (all command text is >= 0x04).
+ * Without CMD_FLAG_PERSISTENT the server closes the connection after the reply,
+ * and the reply is everything up to that, ending in {0, retval}.
+ * With CMD_FLAG_PERSISTENT the reply ends at the first {0, retval} and the server
+ * waits for the next command on the same connection until the client closes it.
+ */
+static constexpr char CMD_FLAG_ISATTY         = 0x01;
+static constexpr char CMD_FLAG_PERSISTENT     = 0x02;
+static constexpr char CMD_FLAG_MASK           = CMD_FLAG_ISATTY | CMD_FLAG_PERSISTENT;
+
 } // namespace px4_daemon
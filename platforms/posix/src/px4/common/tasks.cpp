@@ -57,6 +57,7 @@
 
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/posix.h>
+#include <px4_platform_common/vehicle_namespace.h>
 #include <systemlib/err.h>
 
 #define PX4_MAX_TASKS 50
@@ -74,6 +75,7 @@ static task_entry taskmap[PX4_MAX_TASKS] {};
 
 typedef struct {
 	px4_main_t entry;
+	uint8_t vehicle_namespace; // inherited from the spawning thread
 	char name[16]; //pthread_setname_np is restricted to 16 chars
 	int argc;
 	char *argv[];
@@ -95,6 +97,8 @@ static void *entry_adapter(void *ptr)
 		PX4_ERR("px4_task_spawn_cmd: failed to set name of thread %d %d\n", rv, errno);
 	}
 
+	px4::set_vehicle_namespace(data->vehicle_namespace);
+
 	data->entry(data->argc, data->argv);
 	free(ptr);
 	PX4_DEBUG("Before px4_task_exit");
@@ -138,6 +142,7 @@ px4_task_t px4_task_spawn_cmd(const char *name, int scheduler, int priority, int
 	strncpy(taskdata->name, name, 16);
 	taskdata->name[15] = '\0';
 	taskdata->entry = entry;
+	taskdata->vehicle_namespace = px4::vehicle_namespace();
 	taskdata->argc = argc + 1;
 
 	char *offset = (char *)taskdata + structsize;
@@ -239,6 +239,12 @@ ssize_t SerialImpl::readAtLeast(uint8_t *buffer, size_t buffer_size, size_t char
 	return -1;
 }
 
+ssize_t SerialImpl::readUntilIdle(uint8_t *buffer, size_t buffer_size, uint32_t idle_us, uint32_t timeout_ms)
+{
+	// no way to detect the idle line, return whatever arrives first
+	return readAtLeast(buffer, buffer_size, 1, timeout_ms);
+}
+
 ssize_t SerialImpl::write(const void *buffer, size_t buffer_size)
 {
 	if (!_open) {
@@ -94,6 +94,14 @@ CanardHandle::~CanardHandle()
 	delete static_cast<uint8_t *>(_cyphal_heap);
 	_cyphal_heap = nullptr;
 
+	perf_free(_rx_perf);
+	perf_free(_tx_perf);
+	perf_free(_rx_frames_perf);
+	perf_free(_rx_transfers_perf);
+	perf_free(_rx_errors_perf);
+	perf_free(_tx_frames_perf);
+	perf_free(_tx_errors_perf);
+	perf_free(_tx_expired_perf);
 }
 
 
@@ -116,7 +124,11 @@ void CanardHandle::receive()
 	CanardRxFrame received_frame{};
 	received_frame.frame.payload = &data;
 
+	perf_begin(_rx_perf);
+
 	while (_can_interface->receive(&received_frame) > 0) {
+		perf_count(_rx_frames_perf);
+
 		CanardRxTransfer receive{};
 		CanardRxSubscription *subscription = nullptr;
 		int32_t result = canardRxAccept(&_canard_instance, received_frame.timestamp_usec, &received_frame.frame, 0, &receive,
@@ -128,14 +140,17 @@ void CanardHandle::receive()
 			// the heap is sized correctly; for background, refer to the Robson's Proof and the documentation for O1Heap.
 			// Reception of an invalid frame is NOT an error.
 			PX4_ERR("Receive error %" PRId32" \n", result);
+			perf_count(_rx_errors_perf);
 
 		} else if (result == 1) {
 			// A transfer has been received, process it.
 			// PX4_INFO("received Port ID: %d", receive.metadata.port_id);
+			perf_count(_rx_transfers_perf);
 
 			if (subscription != nullptr) {
+				// libcanard already found the subscription, user_reference is the subscriber
 				UavcanBaseSubscriber *sub_instance = (UavcanBaseSubscriber *)subscription->user_reference;
-				sub_instance->callback(receive);
+				sub_instance->dispatch(receive);
 
 			} else {
 				PX4_ERR("No matching sub for %d", receive.metadata.port_id);
@@ -149,10 +164,13 @@ void CanardHandle::receive()
 		}
 	}
 
+	perf_end(_rx_perf);
 }
 
 void CanardHandle::transmit()
 {
+	perf_begin(_tx_perf);
+
 	// Look at the top of the TX queue.
 	for (const CanardTxQueueItem *ti = NULL; (ti = canardTxPeek(&_queue)) != NULL;) { // Peek at the top of the queue.
 		if ((0U == ti->tx_deadline_usec) || (ti->tx_deadline_usec > hrt_absolute_time())) { // Check the deadline.
@@ -161,17 +179,25 @@ void CanardHandle::transmit()
 
 			if (tx_res < 0) {
 				PX4_ERR("Transmit error %d, frame dropped, errno '%s'", tx_res, strerror(errno));
+				perf_count(_tx_errors_perf);
 
 			} else if (tx_res == 0) {
 				// Timeout - just exit and try again later
 				break;
+
+			} else {
+				perf_count(_tx_frames_perf);
 			}
 
+		} else {
+			perf_count(_tx_expired_perf);
 		}
 
 		// After the frame is transmitted or if it has timed out while waiting, pop it from the queue and deallocate:
 		_canard_instance.memory_free(&_canard_instance, canardTxPop(&_queue, ti));
 	}
+
+	perf_end(_tx_perf);
 }
 
 int32_t CanardHandle::TxPush(const CanardMicrosecond             tx_deadline_usec,
@@ -207,6 +233,18 @@ O1HeapDiagnostics CanardHandle::getO1HeapDiagnostics()
 	return o1heapGetDiagnostics(cyphal_allocator);
 }
 
+void CanardHandle::printInfo()
+{
+	perf_print_counter(_rx_perf);
+	perf_print_counter(_rx_frames_perf);
+	perf_print_counter(_rx_transfers_perf);
+	perf_print_counter(_rx_errors_perf);
+	perf_print_counter(_tx_perf);
+	perf_print_counter(_tx_frames_perf);
+	perf_print_counter(_tx_errors_perf);
+	perf_print_counter(_tx_expired_perf);
+}
+
 int32_t CanardHandle::mtu()
 {
 	return _queue.mtu_bytes;
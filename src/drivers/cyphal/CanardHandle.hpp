@@ -34,6 +34,7 @@
 #pragma once
 
 #include <canard.h>
+#include <lib/perf/perf_counter.h>
 #include "o1heap/o1heap.h"
 #include "CanardInterface.hpp"
 
@@ -71,6 +72,8 @@ public:
 	CanardTreeNode *getRxSubscriptions(CanardTransferKind kind);
 	O1HeapDiagnostics getO1HeapDiagnostics();
 
+	void printInfo();
+
 	int32_t mtu();
 	CanardNodeID node_id();
 	void set_node_id(CanardNodeID id);
@@ -84,4 +87,13 @@ private:
 
 	void *_cyphal_heap{nullptr};
 
+	perf_counter_t _rx_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": rx")};
+	perf_counter_t _tx_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": tx")};
+	perf_counter_t _rx_frames_perf{perf_alloc(PC_COUNT, MODULE_NAME": rx frames")};
+	perf_counter_t _rx_transfers_perf{perf_alloc(PC_COUNT, MODULE_NAME": rx transfers")};
+	perf_counter_t _rx_errors_perf{perf_alloc(PC_COUNT, MODULE_NAME": rx errors")};
+	perf_counter_t _tx_frames_perf{perf_alloc(PC_COUNT, MODULE_NAME": tx frames")};
+	perf_counter_t _tx_errors_perf{perf_alloc(PC_COUNT, MODULE_NAME": tx errors")};
+	perf_counter_t _tx_expired_perf{perf_alloc(PC_COUNT, MODULE_NAME": tx deadline expired")};
+
 };
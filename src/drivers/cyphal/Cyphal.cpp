@@ -251,6 +251,7 @@ void CyphalNode::print_info()
 
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_interval_perf);
+	_canard_handle.printInfo();
 
 	O1HeapDiagnostics heap_diagnostics = _canard_handle.getO1HeapDiagnostics();
 
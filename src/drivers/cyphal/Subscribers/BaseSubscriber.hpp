@@ -44,6 +44,7 @@
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/log.h>
 
+#include <drivers/drv_hrt.h>
 #include <lib/parameters/param.h>
 
 #include "../CanardHandle.hpp"
@@ -81,6 +82,21 @@ public:
 
 	virtual void callback(const CanardRxTransfer &msg) = 0;
 
+	// calls callback() and keeps track of its execution time
+	void dispatch(const CanardRxTransfer &msg)
+	{
+		const hrt_abstime start = hrt_absolute_time();
+		callback(msg);
+		const uint32_t elapsed = hrt_absolute_time() - start;
+
+		_transfers++;
+		_callback_total_us += elapsed;
+
+		if (elapsed > _callback_max_us) {
+			_callback_max_us = elapsed;
+		}
+	}
+
 	CanardPortID id(uint32_t instance = 0)
 	{
 		uint32_t i = 0;
@@ -146,6 +162,12 @@ public:
 
 			curSubj = curSubj->next;
 		}
+
+		// the transfers of all subjects are counted together, print them with the first one
+		if ((_transfers > 0) && (port_id == CANARD_PORT_ID_UNSET || port_id == _subj_sub._canard_sub.port_id)) {
+			PX4_INFO("  %" PRIu32 " transfers, callback avg %.1f us, max %" PRIu32 " us", _transfers,
+				 (double)_callback_total_us / _transfers, _callback_max_us);
+		}
 	}
 
 protected:
@@ -159,5 +181,9 @@ protected:
 	const char *_prefix_name;
 	SubjectSubscription _subj_sub;
 	uint8_t _instance {0};
+
+	uint32_t _transfers{0};
+	uint64_t _callback_total_us{0};
+	uint32_t _callback_max_us{0};
 	/// TODO: 'type' parameter? uavcan.pub.PORT_NAME.type (see 384.Access.1.0.uavcan)
 };
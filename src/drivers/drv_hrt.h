@@ -84,6 +84,9 @@ typedef struct hrt_call {
 	hrt_callout		usr_callout;
 	void			*usr_arg;
 #endif
+#if defined(__PX4_POSIX)
+	int			callout_index;	/**< position in the callout heap, only valid while queued */
+#endif
 } *hrt_call_t;
 
 
@@ -256,11 +259,18 @@ __EXPORT extern void px4_lockstep_unregister_component(int component);
 __EXPORT extern void px4_lockstep_progress(int component);
 __EXPORT extern void px4_lockstep_wait_for_components(void);
 
+/**
+ * Earliest time any thread waits for in lockstep, the simulation time can be advanced
+ * up to here without any thread becoming due.
+ */
+__EXPORT extern hrt_abstime px4_lockstep_next_deadline(void);
+
 #else
 static inline int px4_lockstep_register_component(void) { return 0; }
 static inline void px4_lockstep_unregister_component(int component) { (void)component; }
 static inline void px4_lockstep_progress(int component) {(void)component; }
 static inline void px4_lockstep_wait_for_components(void) { }
+static inline hrt_abstime px4_lockstep_next_deadline(void) { return 0; }
 #endif /* defined(ENABLE_LOCKSTEP_SCHEDULER) */
 
 
@@ -328,6 +328,31 @@ int DShot::handle_new_bdshot_erpm(void)
 	return num_erpms;
 }
 
+void DShot::publish_esc_rpm()
+{
+	esc_rpm_s esc_rpm{};
+	const int pole_pairs = math::max(_param_mot_pole_count.get() / 2, 1);
+	int esc_index = 0;
+	int erpm;
+
+	for (unsigned i = 0; (i < _num_outputs) && (esc_index < esc_rpm_s::CONNECTED_ESC_MAX); i++) {
+		if (_mixing_output.isFunctionSet(i)) {
+			if (up_bdshot_get_erpm(i, &erpm) == 0) {
+				esc_rpm.esc_online_flags |= 1 << esc_index;
+				esc_rpm.rpm[esc_index] = static_cast<float>(erpm) * 100.f / pole_pairs;
+			}
+
+			++esc_index;
+		}
+	}
+
+	if (esc_rpm.esc_online_flags != 0) {
+		esc_rpm.esc_count = esc_index;
+		esc_rpm.timestamp = hrt_absolute_time();
+		_esc_rpm_pub.publish(esc_rpm);
+	}
+}
+
 int DShot::send_command_thread_safe(const dshot_command_t command, const int num_repetitions, const int motor_index)
 {
 	Command cmd{};
@@ -562,6 +587,11 @@ void DShot::Run()
 		}
 	}
 
+	if (_bidirectional_dshot_enabled) {
+		// motor speeds at the output rate, for the rpm notch filters
+		publish_esc_rpm();
+	}
+
 
 	if (_parameter_update_sub.updated()) {
 		update_params();
@@ -36,6 +36,7 @@
 #include <lib/mixer_module/mixer_module.hpp>
 #include <px4_platform_common/getopt.h>
 #include <px4_platform_common/module.h>
+#include <uORB/topics/esc_rpm.h>
 #include <uORB/topics/esc_status.h>
 #include <uORB/topics/vehicle_command.h>
 #include <uORB/topics/vehicle_command_ack.h>
@@ -137,6 +138,11 @@ private:
 
 	int handle_new_bdshot_erpm(void);
 
+	/**
+	 * Publish the bidirectional DShot motor speeds as esc_rpm
+	 */
+	void publish_esc_rpm();
+
 	int request_esc_info();
 
 	void Run() override;
@@ -174,6 +180,7 @@ private:
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
 	uORB::Publication<vehicle_command_ack_s> _command_ack_pub{ORB_ID(vehicle_command_ack)};
+	uORB::PublicationMulti<esc_rpm_s> _esc_rpm_pub{ORB_ID(esc_rpm)};
 	uint16_t _esc_status_counter{0};
 
 	DEFINE_PARAMETERS(
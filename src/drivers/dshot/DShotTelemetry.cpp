@@ -33,6 +33,7 @@
 
 #include "DShotTelemetry.h"
 
+#include <lib/crc/px4_crc.h>
 #include <px4_platform_common/log.h>
 
 #include <unistd.h>
@@ -168,7 +169,7 @@ bool DShotTelemetry::decodeByte(uint8_t byte, bool &successful_decoding)
 
 	if (_frame_position == ESC_FRAME_SIZE) {
 		PX4_DEBUG("got ESC frame for motor %i", _current_motor_index_request);
-		uint8_t checksum = crc8(_frame_buffer, ESC_FRAME_SIZE - 1);
+		uint8_t checksum = px4_crc8_smbus(0, _frame_buffer, ESC_FRAME_SIZE - 1);
 		uint8_t checksum_data = _frame_buffer[ESC_FRAME_SIZE - 1];
 
 		if (checksum == checksum_data) {
@@ -201,30 +202,6 @@ void DShotTelemetry::printStatus() const
 	PX4_INFO("Number of CRC errors: %i", _num_checksum_errors);
 }
 
-uint8_t DShotTelemetry::updateCrc8(uint8_t crc, uint8_t crc_seed)
-{
-	uint8_t crc_u = crc ^ crc_seed;
-
-	for (int i = 0; i < 8; ++i) {
-		crc_u = (crc_u & 0x80) ? 0x7 ^ (crc_u << 1) : (crc_u << 1);
-	}
-
-	return crc_u;
-}
-
-
-uint8_t DShotTelemetry::crc8(const uint8_t *buf, uint8_t len)
-{
-	uint8_t crc = 0;
-
-	for (int i = 0; i < len; ++i) {
-		crc = updateCrc8(buf[i], crc);
-	}
-
-	return crc;
-}
-
-
 void DShotTelemetry::requestNextMotor()
 {
 	_current_motor_index_request = (_current_motor_index_request + 1) % _num_motors;
@@ -279,7 +256,7 @@ void DShotTelemetry::decodeAndPrintEscInfoPacket(const OutputBuffer &buffer)
 		return;
 	}
 
-	if (DShotTelemetry::crc8(data, packet_length - 1) != data[packet_length - 1]) {
+	if (px4_crc8_smbus(0, data, packet_length - 1) != data[packet_length - 1]) {
 		PX4_ERR("Checksum mismatch");
 		return;
 	}
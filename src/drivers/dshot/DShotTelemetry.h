@@ -122,9 +122,6 @@ private:
 	 */
 	bool decodeByte(uint8_t byte, bool &successful_decoding);
 
-	static inline uint8_t updateCrc8(uint8_t crc, uint8_t crc_seed);
-	static uint8_t crc8(const uint8_t *buf, uint8_t len);
-
 	int _uart_fd{-1};
 	int _num_motors{0};
 	uint8_t _frame_buffer[ESC_FRAME_SIZE];
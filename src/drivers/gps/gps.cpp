@@ -467,14 +467,14 @@ int GPS::callback(GPSCallbackType type, void *data1, int data2, void *user)
 int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 {
 	int ret = 0;
-	const size_t character_count = 32; // minimum bytes that we want to read
+	const uint32_t idle_us = 2000; // a gap without data ends a burst of messages
 	const int max_timeout = 50;
 	int timeout_adjusted = math::min(max_timeout, timeout);
 
 	handleInjectDataTopic();
 
 	if (_interface == GPSHelper::Interface::UART) {
-		ret = _uart.readAtLeast(buf, buf_length, math::min(character_count, buf_length), timeout_adjusted);
+		ret = _uart.readUntilIdle(buf, buf_length, idle_us, timeout_adjusted);
 
 		if (ret > 0) {
 			_num_bytes_read += ret;
@@ -509,6 +509,7 @@ int GPS::pollOrRead(uint8_t *buf, size_t buf_length, int timeout)
 				 * If more bytes are available, we'll go back to poll() again.
 				 */
 				unsigned baudrate = _baudrate == 0 ? 115200 : _baudrate;
+				const size_t character_count = 32; // minimum bytes that we want to read
 				const unsigned sleeptime = character_count * 1000000 / (baudrate / 10);
 
 				px4_usleep(sleeptime);
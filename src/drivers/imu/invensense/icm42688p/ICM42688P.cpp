@@ -78,6 +78,10 @@ ICM42688P::~ICM42688P()
 	perf_free(_fifo_overflow_perf);
 	perf_free(_fifo_reset_perf);
 	perf_free(_drdy_missed_perf);
+
+#if defined(ICM42688P_SPI_TRIGGER)
+	hrt_cancel(&_spi_trigger_timeout_call);
+#endif // ICM42688P_SPI_TRIGGER
 }
 
 int ICM42688P::init()
@@ -113,6 +117,9 @@ void ICM42688P::print_status()
 
 	PX4_INFO("FIFO empty interval: %d us (%.1f Hz)", _fifo_empty_interval_us, 1e6 / _fifo_empty_interval_us);
 	PX4_INFO("Clock input: %s", _enable_clock_input ? "enabled" : "disabled");
+#if defined(ICM42688P_SPI_TRIGGER)
+	PX4_INFO("SPI trigger: %s", _spi_trigger_enabled ? "enabled" : "disabled");
+#endif // ICM42688P_SPI_TRIGGER
 
 	perf_print_counter(_bad_register_perf);
 	perf_print_counter(_bad_transfer_perf);
@@ -217,11 +224,19 @@ void ICM42688P::RunImpl()
 		if (DataReadyInterruptConfigure()) {
 			_data_ready_interrupt_enabled = true;
 
+#if defined(ICM42688P_SPI_TRIGGER)
+			// the bus is held while waiting for the data ready interrupt, only possible if it's not shared
+			_spi_trigger_enabled = !px4_spi_bus_requires_locking(get_device_bus());
+#endif // ICM42688P_SPI_TRIGGER
+
 			// backup schedule as a watchdog timeout
 			ScheduleDelayed(100_ms);
 
 		} else {
 			_data_ready_interrupt_enabled = false;
+#if defined(ICM42688P_SPI_TRIGGER)
+			_spi_trigger_enabled = false;
+#endif // ICM42688P_SPI_TRIGGER
 			ScheduleOnInterval(_fifo_empty_interval_us, _fifo_empty_interval_us);
 		}
 
@@ -230,8 +245,23 @@ void ICM42688P::RunImpl()
 	case STATE::FIFO_READ: {
 			hrt_abstime timestamp_sample = now;
 			uint8_t samples = 0;
+			bool success = false;
+			bool triggered = false;
+
+#if defined(ICM42688P_SPI_TRIGGER)
+
+			if (_spi_trigger_enabled) {
+				// blocks until the FIFO transfer started by the data ready interrupt completed
+				triggered = true;
+				success = FIFOReadTriggered();
+
+				// arm the next transfer
+				ScheduleNow();
+			}
+
+#endif // ICM42688P_SPI_TRIGGER
 
-			if (_data_ready_interrupt_enabled) {
+			if (_data_ready_interrupt_enabled && !triggered) {
 				// scheduled from interrupt if _drdy_timestamp_sample was set as expected
 				const hrt_abstime drdy_timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
 
@@ -247,7 +277,7 @@ void ICM42688P::RunImpl()
 				ScheduleDelayed(_fifo_empty_interval_us * 2);
 			}
 
-			if (samples == 0) {
+			if ((samples == 0) && !triggered) {
 				// check current FIFO count
 				const uint16_t fifo_count = FIFOReadCount();
 
@@ -277,8 +307,6 @@ void ICM42688P::RunImpl()
 				}
 			}
 
-			bool success = false;
-
 			if (samples >= 1) {
 				if (FIFORead(timestamp_sample, samples)) {
 					success = true;
@@ -443,6 +471,21 @@ int ICM42688P::DataReadyInterruptCallback(int irq, void *context, void *arg)
 void ICM42688P::DataReady()
 {
 	_drdy_timestamp_sample.store(hrt_absolute_time());
+
+#if defined(ICM42688P_SPI_TRIGGER)
+
+	if (_spi_trigger_armed.load()) {
+		if (trigger() == PX4_OK) {
+			// the work item is already waiting for this transfer
+			return;
+		}
+
+		// not armed yet on the SPI side, the transfer will only start with the next interrupt
+		_spi_trigger_missed.store(true);
+	}
+
+#endif // ICM42688P_SPI_TRIGGER
+
 	ScheduleNow();
 }
 
@@ -541,6 +584,63 @@ bool ICM42688P::FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples)
 		return false;
 	}
 
+	return FIFOProcess(timestamp_sample, buffer, samples);
+}
+
+#if defined(ICM42688P_SPI_TRIGGER)
+bool ICM42688P::FIFOReadTriggered()
+{
+	FIFOTransferBuffer buffer{};
+	const uint8_t samples = _fifo_gyro_samples;
+	const size_t transfer_size = math::min(samples * sizeof(FIFO::DATA) + 4, FIFO::SIZE);
+	SelectRegisterBank(REG_BANK_SEL_BIT::BANK_SEL_0);
+
+	// release the transfer if the data ready interrupt doesn't arrive
+	hrt_call_after(&_spi_trigger_timeout_call, _fifo_empty_interval_us * 2, &SPITriggerTimeout, this);
+
+	_drdy_timestamp_sample.store(0);
+	_spi_trigger_missed.store(false);
+	_spi_trigger_armed.store(true);
+
+	const int ret = transfer_triggered((uint8_t *)&buffer, (uint8_t *)&buffer, transfer_size);
+
+	_spi_trigger_armed.store(false);
+	hrt_cancel(&_spi_trigger_timeout_call);
+
+	if (ret == -ENOTSUP) {
+		// fall back to regular transfers
+		_spi_trigger_enabled = false;
+		return false;
+
+	} else if (ret != PX4_OK) {
+		perf_count(_bad_transfer_perf);
+		return false;
+	}
+
+	const hrt_abstime timestamp_sample = _drdy_timestamp_sample.fetch_and(0);
+
+	if ((timestamp_sample == 0) || _spi_trigger_missed.load()) {
+		// released by the timeout or started an interrupt late, timestamps can't be trusted
+		perf_count(_drdy_missed_perf);
+		FIFOReset();
+		return false;
+	}
+
+	return FIFOProcess(timestamp_sample, buffer, samples);
+}
+
+void ICM42688P::SPITriggerTimeout(void *arg)
+{
+	ICM42688P *dev = static_cast<ICM42688P *>(arg);
+
+	if (dev->_spi_trigger_armed.load()) {
+		dev->trigger();
+	}
+}
+#endif // ICM42688P_SPI_TRIGGER
+
+bool ICM42688P::FIFOProcess(const hrt_abstime &timestamp_sample, const FIFOTransferBuffer &buffer, uint8_t samples)
+{
 	if (buffer.INT_STATUS & INT_STATUS_BIT::FIFO_FULL_INT) {
 		perf_count(_fifo_overflow_perf);
 		FIFOReset();
@@ -757,7 +857,7 @@ void ICM42688P::ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DA
 
 void ICM42688P::ProcessGyro(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples)
 {
-	sensor_gyro_fifo_s gyro{};
+	sensor_gyro_fifo_s &gyro = _px4_gyro.loanFIFO();
 	gyro.timestamp_sample = timestamp_sample;
 	gyro.samples = 0;
 
@@ -53,6 +53,10 @@
 
 using namespace InvenSense_ICM42688P;
 
+#if defined(CONFIG_ICM42688P_SPI_TRIGGER) && defined(CONFIG_SPI_TRIGGER) && defined(CONFIG_SPI_HWFEATURES)
+# define ICM42688P_SPI_TRIGGER
+#endif
+
 class ICM42688P : public device::SPI, public I2CSPIDriver<ICM42688P>
 {
 public:
@@ -136,6 +140,11 @@ private:
 
 	uint16_t FIFOReadCount();
 	bool FIFORead(const hrt_abstime &timestamp_sample, uint8_t samples);
+	bool FIFOProcess(const hrt_abstime &timestamp_sample, const FIFOTransferBuffer &buffer, uint8_t samples);
+#if defined(ICM42688P_SPI_TRIGGER)
+	bool FIFOReadTriggered();
+	static void SPITriggerTimeout(void *arg);
+#endif // ICM42688P_SPI_TRIGGER
 	void FIFOReset();
 
 	void ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples);
@@ -167,6 +176,13 @@ private:
 	px4::atomic<hrt_abstime> _drdy_timestamp_sample{0};
 	bool _data_ready_interrupt_enabled{false};
 
+#if defined(ICM42688P_SPI_TRIGGER)
+	struct hrt_call _spi_trigger_timeout_call {};
+	px4::atomic_bool _spi_trigger_armed{false};
+	px4::atomic_bool _spi_trigger_missed{false};
+	bool _spi_trigger_enabled{false};
+#endif // ICM42688P_SPI_TRIGGER
+
 	enum class STATE : uint8_t {
 		RESET,
 		WAIT_FOR_RESET,
@@ -207,15 +207,15 @@ int IRLOCK::read_device()
 		report.num_targets++;
 	}
 
-	// publish over uORB
-	if (report.num_targets > 0) {
+	// publish over uORB, one report per target
+	for (int i = 0; i < report.num_targets; i++) {
 		irlock_report_s orb_report{};
 		orb_report.timestamp = report.timestamp;
-		orb_report.signature = report.targets[0].signature;
-		orb_report.pos_x     = report.targets[0].pos_x;
-		orb_report.pos_y     = report.targets[0].pos_y;
-		orb_report.size_x    = report.targets[0].size_x;
-		orb_report.size_y    = report.targets[0].size_y;
+		orb_report.signature = report.targets[i].signature;
+		orb_report.pos_x     = report.targets[i].pos_x;
+		orb_report.pos_y     = report.targets[i].pos_y;
+		orb_report.size_x    = report.targets[i].size_x;
+		orb_report.size_y    = report.targets[i].size_y;
 
 		_irlock_report_topic.publish(orb_report);
 	}
@@ -108,7 +108,7 @@ public:
 	 * Initialize all class variables.
 	 */
 	PX4IO() = delete;
-	explicit PX4IO(device::Device *interface);
+	explicit PX4IO(PX4IO_serial *interface);
 
 	~PX4IO() override;
 
@@ -168,7 +168,7 @@ private:
 
 	static constexpr int PX4IO_MAX_ACTUATORS = 8;
 
-	device::Device *const _interface;
+	PX4IO_serial *const _interface;
 
 	unsigned		_hardware{0};		///< Hardware revision
 	unsigned		_max_actuators{0};		///< Maximum # of actuators supported by PX4IO
@@ -187,6 +187,18 @@ private:
 	perf_counter_t	_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": interval")};
 	perf_counter_t	_interface_read_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": interface read")};
 	perf_counter_t	_interface_write_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": interface write")};
+	perf_counter_t	_output_txn_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": output round trip")};
+	perf_counter_t	_output_regs_perf{perf_alloc(PC_COUNT, MODULE_NAME": output regs sent")};
+
+	/* outputs as last written to IO, only the changed range is sent */
+	static constexpr hrt_abstime OUTPUT_FULL_UPDATE_INTERVAL{100_ms};	///< resend all in case IO lost its state
+	uint16_t		_outputs_sent[PX4IO_MAX_ACTUATORS] {};
+	unsigned		_outputs_sent_count{0};
+	hrt_abstime		_outputs_full_update{0};
+
+	/* status registers from the reply to the last output write */
+	uint16_t		_status_reply[PX4IO_P_STATUS_REPLY_COUNT] {};
+	bool			_status_reply_valid{false};
 
 	/* cached IO state */
 	uint16_t		_status{0};		///< Various IO status flags
@@ -341,7 +353,7 @@ private:
 
 #define PX4IO_DEVICE_PATH	"/dev/px4io"
 
-PX4IO::PX4IO(device::Device *interface) :
+PX4IO::PX4IO(PX4IO_serial *interface) :
 	CDev(PX4IO_DEVICE_PATH),
 	OutputModuleInterface(MODULE_NAME, px4::serial_port_to_wq(PX4IO_SERIAL_DEVICE)),
 	_interface(interface)
@@ -358,6 +370,8 @@ PX4IO::~PX4IO()
 	perf_free(_interval_perf);
 	perf_free(_interface_read_perf);
 	perf_free(_interface_write_perf);
+	perf_free(_output_txn_perf);
+	perf_free(_output_regs_perf);
 }
 
 bool PX4IO::updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
@@ -371,8 +385,47 @@ bool PX4IO::updateOutputs(bool stop_motors, uint16_t outputs[MAX_ACTUATORS],
 	}
 
 	if (!_test_fmu_fail) {
-		/* output to the servos */
-		io_reg_set(PX4IO_PAGE_DIRECT_PWM, 0, outputs, num_outputs);
+		/* output to the servos, only the range that changed since the last write */
+		unsigned first = 0;
+		unsigned last = num_outputs;
+
+		if ((num_outputs == _outputs_sent_count) && (hrt_elapsed_time(&_outputs_full_update) < OUTPUT_FULL_UPDATE_INTERVAL)) {
+			while ((first < last) && (outputs[first] == _outputs_sent[first])) {
+				first++;
+			}
+
+			while ((last > first) && (outputs[last - 1] == _outputs_sent[last - 1])) {
+				last--;
+			}
+
+			if (first == last) {
+				// IO fires oneshot outputs and tracks the FMU on every write, so always send at least one register
+				first = 0;
+				last = math::min(num_outputs, 1u);
+			}
+
+		} else {
+			_outputs_full_update = hrt_absolute_time();
+		}
+
+		if (last > first) {
+			const unsigned count = last - first;
+
+			perf_begin(_output_txn_perf);
+			int ret = _interface->write_status((PX4IO_PAGE_DIRECT_PWM << 8) | first, &outputs[first], count, _status_reply);
+			perf_end(_output_txn_perf);
+
+			if (ret == (int)count) {
+				memcpy(&_outputs_sent[first], &outputs[first], count * sizeof(outputs[0]));
+				_outputs_sent_count = num_outputs;
+				_status_reply_valid = true;
+				perf_set_count(_output_regs_perf, perf_event_count(_output_regs_perf) + count);
+
+			} else {
+				// not known what IO got, send everything next time
+				_outputs_sent_count = 0;
+			}
+		}
 	}
 
 	return true;
@@ -921,11 +974,19 @@ int PX4IO::io_get_status()
 	 * STATUS_FLAGS, STATUS_ALARMS, STATUS_VBATT, STATUS_IBATT,
 	 * STATUS_VSERVO, STATUS_VRSSI
 	 * in that order */
-	uint16_t regs[6] {};
-	int ret = io_reg_get(PX4IO_PAGE_STATUS, PX4IO_P_STATUS_FLAGS, &regs[0], sizeof(regs) / sizeof(regs[0]));
+	uint16_t regs[PX4IO_P_STATUS_REPLY_COUNT] {};
 
-	if (ret != OK) {
-		return ret;
+	if (_status_reply_valid) {
+		// already got it with the last output write
+		memcpy(regs, _status_reply, sizeof(regs));
+		_status_reply_valid = false;
+
+	} else {
+		int ret = io_reg_get(PX4IO_PAGE_STATUS, PX4IO_P_STATUS_FLAGS, &regs[0], sizeof(regs) / sizeof(regs[0]));
+
+		if (ret != OK) {
+			return ret;
+		}
 	}
 
 	const uint16_t STATUS_FLAGS  = regs[0];
@@ -1021,7 +1082,7 @@ int PX4IO::io_get_status()
 	_alarms = STATUS_ALARMS;
 	_setup_arming = SETUP_ARMING;
 
-	return ret;
+	return OK;
 }
 
 int PX4IO::io_publish_raw_rc()
@@ -1296,6 +1357,13 @@ int PX4IO::print_status()
 
 	printf("\n");
 
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_interval_perf);
+	perf_print_counter(_output_txn_perf);
+	perf_print_counter(_output_regs_perf);
+	perf_print_counter(_interface_read_perf);
+	perf_print_counter(_interface_write_perf);
+
 	_mixing_output.printStatus();
 	return 0;
 }
@@ -1399,9 +1467,9 @@ int PX4IO::ioctl(file *filep, int cmd, unsigned long arg)
 	return ret;
 }
 
-static device::Device *get_interface()
+static PX4IO_serial *get_interface()
 {
-	device::Device *interface = PX4IO_serial_interface();
+	PX4IO_serial *interface = PX4IO_serial_interface();
 
 	if (interface != nullptr) {
 		if (interface->init() != OK) {
@@ -1424,7 +1492,7 @@ int PX4IO::checkcrc(int argc, char *argv[])
 		return 1;
 	}
 
-	device::Device *interface = get_interface();
+	PX4IO_serial *interface = get_interface();
 
 	if (interface == nullptr) {
 		PX4_ERR("interface allocation failed");
@@ -1516,7 +1584,7 @@ int PX4IO::bind(int argc, char *argv[])
 
 int PX4IO::task_spawn(int argc, char *argv[])
 {
-	device::Device *interface = get_interface();
+	PX4IO_serial *interface = get_interface();
 
 	if (interface == nullptr) {
 		PX4_ERR("Failed to create interface");
@@ -1574,7 +1642,7 @@ int PX4IO::custom_command(int argc, char *argv[])
 
 		while (ret != OK && retries < MAX_RETRIES) {
 
-			device::Device *interface = get_interface();
+			PX4IO_serial *interface = get_interface();
 
 			if (interface == nullptr) {
 				PX4_ERR("interface allocation failed");
@@ -39,11 +39,9 @@
 
 #include "px4io_driver.h"
 
-#include <px4_arch/px4io_serial.h>
-
 static PX4IO_serial *g_interface;
 
-device::Device
+PX4IO_serial
 *PX4IO_serial_interface()
 {
 	return new ArchPX4IOSerial();
@@ -96,6 +94,20 @@ PX4IO_serial::init(IOPacket *io_buffer)
 
 int
 PX4IO_serial::write(unsigned address, void *data, unsigned count)
+{
+	return _write(address, data, count, PKT_CODE_WRITE, nullptr, 0);
+}
+
+int
+PX4IO_serial::write_status(unsigned address, const void *data, unsigned count,
+			   uint16_t (&status)[PX4IO_P_STATUS_REPLY_COUNT])
+{
+	return _write(address, data, count, PKT_CODE_WRITE_STATUS, status, PX4IO_P_STATUS_REPLY_COUNT);
+}
+
+int
+PX4IO_serial::_write(unsigned address, const void *data, unsigned count, uint8_t code,
+		     uint16_t *status, unsigned status_count)
 {
 	uint8_t page = address >> 8;
 	uint8_t offset = address & 0xff;
@@ -110,7 +122,7 @@ PX4IO_serial::write(unsigned address, void *data, unsigned count)
 	int result;
 
 	for (unsigned retries = 0; retries < 3; retries++) {
-		_io_buffer_ptr->count_code = count | PKT_CODE_WRITE;
+		_io_buffer_ptr->count_code = count | code;
 		_io_buffer_ptr->page = page;
 		_io_buffer_ptr->offset = offset;
 		memcpy((void *)&_io_buffer_ptr->regs[0], (void *)values, (2 * count));
@@ -134,6 +146,17 @@ PX4IO_serial::write(unsigned address, void *data, unsigned count)
 				/* IO didn't like it - no point retrying */
 				result = -EINVAL;
 				perf_count(_pc_protoerrs);
+
+			} else if (status != nullptr) {
+
+				/* the registers were written, but without the status the caller has to read it */
+				if (PKT_COUNT(*_io_buffer_ptr) != status_count) {
+					result = -EIO;
+					perf_count(_pc_protoerrs);
+
+				} else {
+					memcpy(status, &_io_buffer_ptr->regs[0], (2 * status_count));
+				}
 			}
 
 			break;
@@ -182,8 +182,8 @@ void CrsfRc::Run()
 	const hrt_abstime time_now_us = hrt_absolute_time();
 	perf_count_interval(_cycle_interval_perf, time_now_us);
 
-	// Read all available data from the serial RC input UART
-	int new_bytes = _uart->readAtLeast(&_rcs_buf[0], RC_MAX_BUFFER_SIZE, 1, 100);
+	// Read all available data from the serial RC input UART, once the frame is complete
+	int new_bytes = _uart->readUntilIdle(&_rcs_buf[0], RC_MAX_BUFFER_SIZE, 100, 100);
 
 	if (new_bytes > 0) {
 		_bytes_rx += new_bytes;
@@ -86,6 +86,20 @@ typedef struct {
 	uint64_t ctr;
 } chacha20_context_t;
 
+#define SHA256_BLOCKLEN 64
+
+/*
+ * HMAC-SHA256 session context. The hash states after absorbing the inner and
+ * outer padded keys are computed once per key and kept here, so each MAC only
+ * costs the message blocks plus two compressions instead of four.
+ */
+typedef struct {
+	hash_state inner;
+	hash_state outer;
+	uint8_t key_idx;
+	bool key_valid;
+} hmac_sha256_context_t;
+
 static inline void initialize_tomcrypt(void)
 {
 	if (!tomcrypt_initialized) {
@@ -149,6 +163,67 @@ static const uint8_t *crypto_get_key_ptr(keystore_session_handle_t handle, uint8
 }
 
 
+/* Precompute the inner and outer hash states for the given key, if not already done */
+static bool hmac_sha256_setup(hmac_sha256_context_t *context, keystore_session_handle_t handle, uint8_t key_idx)
+{
+	if (context->key_valid && context->key_idx == key_idx) {
+		return true;
+	}
+
+	size_t key_sz;
+	const uint8_t *key = crypto_get_key_ptr(handle, key_idx, &key_sz);
+
+	if (key == NULL || key_sz == 0) {
+		return false;
+	}
+
+	uint8_t block[SHA256_BLOCKLEN] = {};
+
+	if (key_sz > SHA256_BLOCKLEN) {
+		hash_state md;
+		sha256_init(&md);
+		sha256_process(&md, key, key_sz);
+		sha256_done(&md, block);
+
+	} else {
+		memcpy(block, key, key_sz);
+	}
+
+	for (int i = 0; i < SHA256_BLOCKLEN; i++) {
+		block[i] ^= 0x36;
+	}
+
+	sha256_init(&context->inner);
+	sha256_process(&context->inner, block, SHA256_BLOCKLEN);
+
+	for (int i = 0; i < SHA256_BLOCKLEN; i++) {
+		block[i] ^= 0x36 ^ 0x5c;
+	}
+
+	sha256_init(&context->outer);
+	sha256_process(&context->outer, block, SHA256_BLOCKLEN);
+
+	zeromem(block, sizeof(block));
+
+	context->key_idx = key_idx;
+	context->key_valid = true;
+	return true;
+}
+
+static void hmac_sha256(const hmac_sha256_context_t *context, const uint8_t *message, size_t message_size,
+			uint8_t mac[SHA256_HASHLEN])
+{
+	hash_state md = context->inner;
+	sha256_process(&md, message, message_size);
+	sha256_done(&md, mac);
+
+	md = context->outer;
+	sha256_process(&md, mac, SHA256_HASHLEN);
+	sha256_done(&md, mac);
+
+	zeromem(&md, sizeof(md));
+}
+
 void crypto_init()
 {
 	keystore_init();
@@ -191,6 +266,20 @@ crypto_session_handle_t crypto_open(px4_crypto_algorithm_t algorithm)
 		}
 		break;
 
+	case CRYPTO_HMAC_SHA256: {
+			hmac_sha256_context_t *context = XMALLOC(sizeof(hmac_sha256_context_t));
+
+			if (!context) {
+				ret.handle = 0;
+				crypto_open_count--;
+
+			} else {
+				ret.context = context;
+				context->key_valid = false;
+			}
+		}
+		break;
+
 	default:
 		ret.context = NULL;
 	}
@@ -209,6 +298,12 @@ void crypto_close(crypto_session_handle_t *handle)
 	crypto_open_count--;
 	handle->handle = 0;
 	keystore_close(&handle->keystore_handle);
+
+	if (handle->algorithm == CRYPTO_HMAC_SHA256 && handle->context) {
+		/* the context holds key derived state */
+		zeromem(handle->context, sizeof(hmac_sha256_context_t));
+	}
+
 	XFREE(handle->context);
 	handle->context = NULL;
 }
@@ -236,6 +331,26 @@ bool crypto_signature_check(crypto_session_handle_t handle,
 		ret = crypto_ed25519_check(signature, public_key, message, message_size) == 0;
 		break;
 
+	case CRYPTO_HMAC_SHA256: {
+			hmac_sha256_context_t *context = handle.context;
+			uint8_t mac[SHA256_HASHLEN];
+
+			if (hmac_sha256_setup(context, handle.keystore_handle, key_index)) {
+				hmac_sha256(context, message, message_size, mac);
+
+				/* constant time comparison */
+				uint8_t diff = 0;
+
+				for (int i = 0; i < SHA256_HASHLEN; i++) {
+					diff |= mac[i] ^ signature[i];
+				}
+
+				ret = diff == 0;
+				zeromem(mac, sizeof(mac));
+			}
+		}
+		break;
+
 	default:
 		ret = false;
 	}
@@ -313,6 +428,25 @@ bool crypto_encrypt_data(crypto_session_handle_t handle,
 		}
 		break;
 
+	case CRYPTO_HMAC_SHA256: {
+			/* The MAC is written to cipher, truncated to *cipher_size if that is shorter */
+			hmac_sha256_context_t *context = handle.context;
+			uint8_t mac[SHA256_HASHLEN];
+
+			if (*cipher_size > 0 && hmac_sha256_setup(context, handle.keystore_handle, key_idx)) {
+				hmac_sha256(context, message, message_size, mac);
+
+				if (*cipher_size > SHA256_HASHLEN) {
+					*cipher_size = SHA256_HASHLEN;
+				}
+
+				memcpy(cipher, mac, *cipher_size);
+				zeromem(mac, sizeof(mac));
+				ret = true;
+			}
+		}
+		break;
+
 	default:
 		break;
 	}
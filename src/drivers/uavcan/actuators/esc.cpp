@@ -144,16 +144,29 @@ UavcanEscController::esc_status_sub_cb(const uavcan::ReceivedDataStructure<uavca
 		ref.esc_rpm         = msg.rpm;
 		ref.esc_errorcount  = msg.error_count;
 
-		_esc_status.esc_count = _rotor_count;
-		_esc_status.counter += 1;
-		_esc_status.esc_connectiontype = esc_status_s::ESC_CONNECTION_TYPE_CAN;
-		_esc_status.esc_online_flags = check_escs_status();
-		_esc_status.esc_armed_flags = (1 << _rotor_count) - 1;
-		_esc_status.timestamp = hrt_absolute_time();
-		_esc_status_pub.publish(_esc_status);
+		_esc_status_updated = true;
 	}
 }
 
+void
+UavcanEscController::publish_esc_status()
+{
+	// the status of all ESCs received since the last cycle goes into a single publication
+	if (!_esc_status_updated) {
+		return;
+	}
+
+	_esc_status_updated = false;
+
+	_esc_status.esc_count = _rotor_count;
+	_esc_status.counter += 1;
+	_esc_status.esc_connectiontype = esc_status_s::ESC_CONNECTION_TYPE_CAN;
+	_esc_status.esc_online_flags = check_escs_status();
+	_esc_status.esc_armed_flags = (1 << _rotor_count) - 1;
+	_esc_status.timestamp = hrt_absolute_time();
+	_esc_status_pub.publish(_esc_status);
+}
+
 uint8_t
 UavcanEscController::check_escs_status()
 {
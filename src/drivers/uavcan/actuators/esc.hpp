@@ -76,6 +76,11 @@ public:
 	 */
 	void set_rotor_count(uint8_t count);
 
+	/**
+	 * Publishes esc_status if any ESC status was received since the last call, once per node cycle
+	 */
+	void publish_esc_status();
+
 	static int max_output_value() { return uavcan::equipment::esc::RawCommand::FieldTypes::cmd::RawValueType::max(); }
 
 	esc_status_s &esc_status() { return _esc_status; }
@@ -98,6 +103,7 @@ private:
 		void (UavcanEscController::*)(const uavcan::TimerEvent &)> TimerCbBinder;
 
 	esc_status_s	_esc_status{};
+	bool		_esc_status_updated{false};
 
 	uORB::PublicationMulti<esc_status_s> _esc_status_pub{ORB_ID(esc_status)};
 
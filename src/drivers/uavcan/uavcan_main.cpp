@@ -757,6 +757,9 @@ UavcanNode::Run()
 
 	_node.spinOnce(); // expected to be non-blocking
 
+	// all frames received since the last cycle have been processed
+	_esc_controller.publish_esc_status();
+
 	// Publish status
 	constexpr hrt_abstime status_pub_interval = 100_ms;
 
@@ -34,6 +34,7 @@
 #pragma once
 
 #include <containers/IntrusiveSortedList.hpp>
+#include <drivers/drv_hrt.h>
 #include <uavcan/uavcan.hpp>
 
 #include <uavcan/node/publisher.hpp>
@@ -56,6 +57,30 @@ public:
 
 	virtual void BroadcastAnyUpdates() = 0;
 
+	/**
+	 * Limit the broadcast rate of the message, 0 broadcasts every uORB update.
+	 * Updates arriving in between stay in the uORB subscription, so the latest
+	 * sample is broadcast once the interval has elapsed.
+	 */
+	void SetMaxRate(float rate_hz) { _interval_us = (rate_hz > 0.f) ? (uint32_t)(1e6f / rate_hz) : 0; }
+
+	/**
+	 * @param throttle factor >= 1 stretching the interval while the bus is over its load budget
+	 */
+	bool BroadcastDue(hrt_abstime now, float throttle) const
+	{
+		return (_interval_us == 0) || (now >= _last_broadcast + (hrt_abstime)(_interval_us * throttle));
+	}
+
+	void BroadcastDone(hrt_abstime now)
+	{
+		_last_broadcast = now;
+		_broadcast_count++;
+	}
+
+	uint32_t interval_us() const { return _interval_us; }
+	uint32_t broadcast_count() const { return _broadcast_count; }
+
 	// sorted numerically by ID
 	bool operator<=(UavcanPublisherBase &rhs) { return id() <= rhs.id(); }
 
@@ -63,5 +88,9 @@ public:
 
 private:
 	uint16_t _id{0};
+
+	uint32_t _interval_us{0};
+	hrt_abstime _last_broadcast{0};
+	uint32_t _broadcast_count{0};
 };
 } // namespace uavcannode
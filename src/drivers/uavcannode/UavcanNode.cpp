@@ -358,61 +358,67 @@ int UavcanNode::init(uavcan::NodeID node_id, UAVCAN_DRIVER::BusEvent &bus_events
 		return PX4_ERROR;
 	}
 
+	int32_t tx_load_budget = 0;
+	param_get(param_find("CANNODE_TX_LOAD"), &tx_load_budget);
+	_tx_load_budget = tx_load_budget / 100.f;
+
+	// Maximum broadcast rates, 0 for messages carrying integrated or streamed data where
+	// every sample matters, and for those limiting their rate themselves.
 #if defined(CONFIG_UAVCANNODE_BATTERY_INFO)
-	_publisher_list.add(new BatteryInfo(this, _node));
+	add_publisher(new BatteryInfo(this, _node), 10.f);
 #endif // CONFIG_UAVCANNODE_BATTERY_INFO
 
 #if defined(CONFIG_UAVCANNODE_ESC_STATUS)
-	_publisher_list.add(new ESCStatus(this, _node));
+	add_publisher(new ESCStatus(this, _node), 50.f);
 #endif // CONFIG_UAVCANNODE_ESC_STATUS
 
 #if defined(CONFIG_UAVCANNODE_FLOW_MEASUREMENT)
-	_publisher_list.add(new FlowMeasurement(this, _node));
+	add_publisher(new FlowMeasurement(this, _node), 0.f);
 #endif // CONFIG_UAVCANNODE_FLOW_MEASUREMENT
 
 #if defined(UAVCANNODE_HYGROMETER_MEASUREMENT)
-	_publisher_list.add(new HygrometerMeasurement(this, _node));
+	add_publisher(new HygrometerMeasurement(this, _node), 0.f);
 #endif // UAVCANNODE_HYGROMETER_MEASUREMENT
 
 #if defined(CONFIG_UAVCANNODE_GNSS_FIX)
-	_publisher_list.add(new GnssFix2(this, _node));
-	_publisher_list.add(new GnssAuxiliary(this, _node));
+	add_publisher(new GnssFix2(this, _node), 10.f);
+	add_publisher(new GnssAuxiliary(this, _node), 5.f);
 #endif // CONFIG_UAVCANNODE_GNSS_FIX
 
 #if defined(CONFIG_UAVCANNODE_MAGNETIC_FIELD_STRENGTH)
-	_publisher_list.add(new MagneticFieldStrength2(this, _node));
+	add_publisher(new MagneticFieldStrength2(this, _node), 50.f);
 #endif // CONFIG_UAVCANNODE_MAGNETIC_FIELD_STRENGTH
 
 #if defined(CONFIG_UAVCANNODE_RANGE_SENSOR_MEASUREMENT)
-	_publisher_list.add(new RangeSensorMeasurement(this, _node));
+	add_publisher(new RangeSensorMeasurement(this, _node), 50.f);
 #endif // CONFIG_UAVCANNODE_RANGE_SENSOR_MEASUREMENT
 
 #if defined(CONFIG_UAVCANNODE_RAW_AIR_DATA)
-	_publisher_list.add(new RawAirData(this, _node));
+	add_publisher(new RawAirData(this, _node), 50.f);
 #endif // CONFIG_UAVCANNODE_RAW_AIR_DATA
 
 #if defined(CONFIG_UAVCANNODE_RTK_DATA)
-	_publisher_list.add(new RelPosHeadingPub(this, _node));
+	add_publisher(new RelPosHeadingPub(this, _node), 10.f);
 
 	int32_t cannode_pub_mbd = 0;
 	param_get(param_find("CANNODE_PUB_MBD"), &cannode_pub_mbd);
 
 	if (cannode_pub_mbd == 1) {
-		_publisher_list.add(new MovingBaselineDataPub(this, _node));
+		add_publisher(new MovingBaselineDataPub(this, _node), 0.f);
 	}
 
 #endif // CONFIG_UAVCANNODE_RTK_DATA
 
 #if defined(CONFIG_UAVCANNODE_SAFETY_BUTTON)
-	_publisher_list.add(new SafetyButton(this, _node));
+	add_publisher(new SafetyButton(this, _node), 10.f);
 #endif // CONFIG_UAVCANNODE_SAFETY_BUTTON
 
 #if defined(CONFIG_UAVCANNODE_STATIC_PRESSURE)
-	_publisher_list.add(new StaticPressure(this, _node));
+	add_publisher(new StaticPressure(this, _node), 50.f);
 #endif // CONFIG_UAVCANNODE_STATIC_PRESSURE
 
 #if defined(CONFIG_UAVCANNODE_STATIC_TEMPERATURE)
-	_publisher_list.add(new StaticTemperature(this, _node));
+	add_publisher(new StaticTemperature(this, _node), 0.f);
 #endif // CONFIG_UAVCANNODE_STATIC_TEMPERATURE
 
 #if defined(CONFIG_UAVCANNODE_ARMING_STATUS)
@@ -474,6 +480,69 @@ class RestartRequestHandler: public uavcan::IRestartRequestHandler
 	}
 } restart_request_handler;
 
+void UavcanNode::add_publisher(UavcanPublisherBase *publisher, float max_rate_hz)
+{
+	if (publisher) {
+		publisher->SetMaxRate(max_rate_hz);
+		_publisher_list.add(publisher);
+	}
+}
+
+void UavcanNode::update_tx_load(const hrt_abstime &now)
+{
+	if (now < _tx_load_timestamp + TX_LOAD_WINDOW) {
+		return;
+	}
+
+	uavcan::CanIOManager &can_io = _node.getDispatcher().getCanIOManager();
+	const unsigned num_ifaces = can_io.getCanDriver().getNumIfaces();
+	uint64_t tx_frames = 0;
+
+	for (unsigned i = 0; i < num_ifaces; i++) {
+		tx_frames += can_io.getIfacePerfCounters(i).frames_tx;
+	}
+
+	if ((_tx_load_timestamp != 0) && (num_ifaces > 0) && (_bitrate > 0)) {
+		// every interface carries the same frames, use the average
+		const float frames = (float)(tx_frames - _tx_frames_last) / num_ifaces;
+		const float frames_per_s = frames * 1e6f / (now - _tx_load_timestamp);
+		_tx_load = frames_per_s * bitPerFrame / _bitrate;
+
+		if ((_tx_load_budget > 0.f) && (_tx_load > _tx_load_budget)) {
+			_tx_throttle = math::min(_tx_throttle * _tx_load / _tx_load_budget, TX_THROTTLE_MAX);
+
+		} else if ((_tx_load < 0.8f * _tx_load_budget) || (_tx_load_budget <= 0.f)) {
+			// release slowly to avoid oscillating around the budget
+			_tx_throttle = math::max(_tx_throttle * 0.8f, 1.f);
+		}
+	}
+
+	_tx_frames_last = tx_frames;
+	_tx_load_timestamp = now;
+}
+
+void UavcanNode::broadcast_publishers()
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	update_tx_load(now);
+
+	const uavcan::TransferPerfCounter &transfer_perf = _node.getDispatcher().getTransferPerfCounter();
+
+	for (auto &publisher : _publisher_list) {
+		if (publisher->BroadcastDue(now, _tx_throttle)) {
+			const uint64_t tx_transfers = transfer_perf.getTxTransferCount();
+
+			publisher->BroadcastAnyUpdates();
+
+			// only a sent transfer starts the next interval
+			if (transfer_perf.getTxTransferCount() != tx_transfers) {
+				publisher->BroadcastDone(now);
+			}
+		}
+	}
+}
+
 void UavcanNode::Run()
 {
 	static  hrt_abstime up_time{0};
@@ -571,13 +640,14 @@ void UavcanNode::Run()
 		_parameter_update_sub.copy(&pupdate);
 
 		// update parameters from storage
+		int32_t tx_load_budget = 0;
+		param_get(param_find("CANNODE_TX_LOAD"), &tx_load_budget);
+		_tx_load_budget = tx_load_budget / 100.f;
 	}
 
 	_node.spinOnce();
 
-	for (auto &publisher : _publisher_list) {
-		publisher->BroadcastAnyUpdates();
-	}
+	broadcast_publishers();
 
 	if (_log_message_sub.updated()) {
 		log_message_s log_message;
@@ -701,11 +771,23 @@ void UavcanNode::PrintInfo()
 		printf("\tTX frames: %llu\n", iface_perf_cnt.frames_tx);
 	}
 
+	printf("\n");
+	printf("TX bus load: %.1f%% (budget %.0f%%), interval throttle: %.2f\n",
+	       (double)(_tx_load * 100.f), (double)(_tx_load_budget * 100.f), (double)_tx_throttle);
+
 	printf("\n");
 	printf("Publishers:\n");
 
 	for (const auto &publisher : _publisher_list) {
 		publisher->PrintInfo();
+
+		if (publisher->interval_us() > 0) {
+			const float max_rate_hz = 1e6f / (publisher->interval_us() * _tx_throttle);
+			printf("\t\tmax rate: %.1f Hz, broadcasts: %" PRIu32 "\n", (double)max_rate_hz, publisher->broadcast_count());
+
+		} else {
+			printf("\t\tbroadcasts: %" PRIu32 "\n", publisher->broadcast_count());
+		}
 	}
 
 	printf("\n");
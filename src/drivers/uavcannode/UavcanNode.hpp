@@ -150,6 +150,10 @@ private:
 	void fill_node_info();
 	int init(uavcan::NodeID node_id, UAVCAN_DRIVER::BusEvent &bus_events);
 
+	void add_publisher(UavcanPublisherBase *publisher, float max_rate_hz);
+	void broadcast_publishers();
+	void update_tx_load(const hrt_abstime &now);
+
 	px4::atomic_bool	_task_should_exit{false};	///< flag to indicate to tear down the CAN driver
 
 	enum {Booted, Interfaced, Allocation, Allocated,  Done}		_init_state{Booted};		///< State of the boot.
@@ -175,6 +179,15 @@ private:
 	IntrusiveSortedList<UavcanPublisherBase *> _publisher_list;
 	IntrusiveSortedList<UavcanSubscriberBase *> _subscriber_list;
 
+	static constexpr hrt_abstime TX_LOAD_WINDOW{1_s};
+	static constexpr float TX_THROTTLE_MAX{10.f};	///< longest stretch of the publisher intervals
+
+	float _tx_load_budget{0.f};	///< fraction of the bitrate the node may use, 0 disables throttling
+	float _tx_load{0.f};		///< fraction of the bitrate used by the node over the last window
+	float _tx_throttle{1.f};	///< factor applied to the publisher intervals
+	uint64_t _tx_frames_last{0};
+	hrt_abstime _tx_load_timestamp{0};
+
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	uORB::SubscriptionCallbackWorkItem _log_message_sub{this, ORB_ID(log_message)};
 
@@ -76,3 +76,17 @@ PARAM_DEFINE_INT32(CANNODE_SUB_RTCM, 0);
  * @group UAVCAN
  */
 PARAM_DEFINE_INT32(CANNODE_PUB_MBD, 0);
+
+/**
+ * CAN bus load budget of the node's publishers
+ *
+ * Share of the bitrate the node may use for its transmissions. Above it
+ * the broadcast intervals of the rate limited messages are stretched
+ * until the load is back within the budget. Set to 0 to disable.
+ *
+ * @unit %
+ * @min 0
+ * @max 100
+ * @group UAVCAN
+ */
+PARAM_DEFINE_INT32(CANNODE_TX_LOAD, 60);
@@ -56,11 +56,15 @@ public:
 		return sz;
 	}
 
-	void push(T newNode)
+	/**
+	 * Append a node.
+	 * @return false if the node is already queued (and nothing was changed)
+	 */
+	bool push(T newNode)
 	{
 		// error, node already queued or already inserted
 		if ((newNode->next_intrusive_queue_node() != nullptr) || (newNode == _tail)) {
-			return;
+			return false;
 		}
 
 		if (_head == nullptr) {
@@ -72,6 +76,7 @@ public:
 		}
 
 		_tail = newNode;
+		return true;
 	}
 
 	T pop()
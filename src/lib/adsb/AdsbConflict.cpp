@@ -41,55 +41,210 @@
 
 #include <float.h>
 
+#include <lib/mathlib/mathlib.h>
 
-void AdsbConflict::detect_traffic_conflict(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now,
-		float vz_now)
 
+AdsbTrafficTable::AdsbTrafficTable()
+{
+	for (auto &bucket : _buckets) {
+		bucket = -1;
+	}
+}
+
+int AdsbTrafficTable::find_bucket(uint32_t icao_address) const
+{
+	for (int bucket = home_bucket(icao_address);; bucket = (bucket + 1) & (NUM_BUCKETS - 1)) {
+		if (_buckets[bucket] < 0) {
+			return -1;
+		}
+
+		if (_aircraft[_buckets[bucket]].icao_address == icao_address) {
+			return bucket;
+		}
+	}
+}
+
+traffic_aircraft_s *AdsbTrafficTable::find(uint32_t icao_address)
+{
+	const int bucket = find_bucket(icao_address);
+	return (bucket >= 0) ? &_aircraft[_buckets[bucket]] : nullptr;
+}
+
+traffic_aircraft_s *AdsbTrafficTable::insert(uint32_t icao_address)
+{
+	int bucket = home_bucket(icao_address);
+
+	for (; _buckets[bucket] >= 0; bucket = (bucket + 1) & (NUM_BUCKETS - 1)) {
+		if (_aircraft[_buckets[bucket]].icao_address == icao_address) {
+			return &_aircraft[_buckets[bucket]];
+		}
+	}
+
+	if (_size >= CAPACITY) {
+		return nullptr;
+	}
+
+	traffic_aircraft_s &aircraft = _aircraft[_size];
+	aircraft = traffic_aircraft_s{};
+	aircraft.icao_address = icao_address;
+	_buckets[bucket] = _size++;
+
+	return &aircraft;
+}
+
+void AdsbTrafficTable::remove(uint32_t icao_address)
+{
+	int bucket = find_bucket(icao_address);
+
+	if (bucket < 0) {
+		return;
+	}
+
+	const int index = _buckets[bucket];
+	_buckets[bucket] = -1;
+
+	// shift the following entries of the probe sequence back, unless that moves them before their home bucket
+	for (int next = (bucket + 1) & (NUM_BUCKETS - 1); _buckets[next] >= 0; next = (next + 1) & (NUM_BUCKETS - 1)) {
+		const int home = home_bucket(_aircraft[_buckets[next]].icao_address);
+		const bool home_in_gap = (bucket <= next) ? (home > bucket && home <= next) : (home > bucket || home <= next);
+
+		if (!home_in_gap) {
+			_buckets[bucket] = _buckets[next];
+			_buckets[next] = -1;
+			bucket = next;
+		}
+	}
+
+	// keep the aircraft dense, the last one takes the free place
+	const int last = _size - 1;
+
+	if (index != last) {
+		_aircraft[index] = _aircraft[last];
+		_buckets[find_bucket(_aircraft[index].icao_address)] = index;
+	}
+
+	_size--;
+}
+
+int AdsbTrafficTable::remove_stale(hrt_abstime now, hrt_abstime timeout)
 {
+	int removed = 0;
+
+	for (int index = 0; index < _size;) {
+		if (now > _aircraft[index].timestamp + timeout) {
+			// the last aircraft moves to index, check that one next
+			remove(_aircraft[index].icao_address);
+			removed++;
+
+		} else {
+			index++;
+		}
+	}
+
+	return removed;
+}
+
+bool AdsbConflict::predict_conflict(const float rel_pos[3], const float rel_vel[3], float horizon, float hor_separation,
+				    float ver_separation, float &cpa_time, float &cpa_hor_distance, float &cpa_ver_distance)
+{
+	// horizontal: |p + v t|^2 < hor_separation^2, i.e. a t^2 + b t + c < 0
+	const float a = rel_vel[0] * rel_vel[0] + rel_vel[1] * rel_vel[1];
+	const float b = 2.f * (rel_pos[0] * rel_vel[0] + rel_pos[1] * rel_vel[1]);
+	const float c = rel_pos[0] * rel_pos[0] + rel_pos[1] * rel_pos[1] - hor_separation * hor_separation;
+
+	cpa_time = (a > FLT_EPSILON) ? math::constrain(-b / (2.f * a), 0.f, horizon) : 0.f;
+
+	const float cpa_n = rel_pos[0] + rel_vel[0] * cpa_time;
+	const float cpa_e = rel_pos[1] + rel_vel[1] * cpa_time;
+	cpa_hor_distance = sqrtf(cpa_n * cpa_n + cpa_e * cpa_e);
+	cpa_ver_distance = fabsf(rel_pos[2] + rel_vel[2] * cpa_time);
 
-	float d_hor, d_vert;
-	get_distance_to_point_global_wgs84(lat_now, lon_now, alt_now,
-					   _transponder_report.lat, _transponder_report.lon, _transponder_report.altitude, &d_hor, &d_vert);
+	float t_enter = 0.f;
+	float t_exit = horizon;
 
-	const float xyz_traffic_speed = sqrtf(_transponder_report.hor_velocity * _transponder_report.hor_velocity +
-					      _transponder_report.ver_velocity * _transponder_report.ver_velocity);
+	if (a > FLT_EPSILON) {
+		const float discriminant = b * b - 4.f * a * c;
 
-	const float hor_uav_speed = sqrtf(vx_now * vx_now + vy_now * vy_now);
-	const float xyz_uav_speed = sqrtf(hor_uav_speed * hor_uav_speed + vz_now * vz_now);
+		if (discriminant <= 0.f) {
+			return false;
+		}
 
-	//assume always pointing at each other
-	const float relative_uav_traffic_speed = xyz_traffic_speed + xyz_uav_speed;
+		const float sqrt_discriminant = sqrtf(discriminant);
+		t_enter = math::max(t_enter, (-b - sqrt_discriminant) / (2.f * a));
+		t_exit = math::min(t_exit, (-b + sqrt_discriminant) / (2.f * a));
 
+	} else if (c >= 0.f) {
+		// no horizontal relative motion and outside of the separation
+		return false;
+	}
 
-	// Predict until the vehicle would have passed this system at its current speed
-	const float prediction_distance = d_hor + TRAFFIC_TO_UAV_DISTANCE_EXTENSION;
+	// vertical: |p + v t| < ver_separation
+	if (fabsf(rel_vel[2]) > FLT_EPSILON) {
+		const float t0 = (-ver_separation - rel_pos[2]) / rel_vel[2];
+		const float t1 = (ver_separation - rel_pos[2]) / rel_vel[2];
+		t_enter = math::max(t_enter, math::min(t0, t1));
+		t_exit = math::min(t_exit, math::max(t0, t1));
 
-	double end_lat, end_lon;
-	waypoint_from_heading_and_distance(_transponder_report.lat, _transponder_report.lon,
-					   _transponder_report.heading, prediction_distance, &end_lat, &end_lon);
+	} else if (fabsf(rel_pos[2]) >= ver_separation) {
+		return false;
+	}
 
+	return t_enter < t_exit;
+}
 
-	const bool cs_distance_conflict_threshold = (!get_distance_to_line(_crosstrack_error, lat_now,
-			lon_now, _transponder_report.lat,
-			_transponder_report.lon, end_lat,
-			end_lon))
-			&& (!_crosstrack_error.past_end)
-			&& (fabsf(_crosstrack_error.distance) < _conflict_detection_params.crosstrack_separation);
+void AdsbConflict::detect_traffic_conflict(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now,
+		float vz_now)
+
+{
+	const hrt_abstime now = hrt_absolute_time();
 
-	const bool _crosstrack_separation_check = (fabsf(alt_now - _transponder_report.altitude) <
-			_conflict_detection_params.crosstrack_separation);
+	traffic_aircraft_s report_aircraft{};
+	traffic_aircraft_s *aircraft = _traffic_table.insert(_transponder_report.icao_address);
 
-	bool collision_time_check = false;
+	if (aircraft == nullptr) {
+		// table full, the report is still checked but its state not kept
+		aircraft = &report_aircraft;
+		aircraft->icao_address = _transponder_report.icao_address;
+	}
 
-	const float d_xyz = sqrtf(d_hor * d_hor + d_vert * d_vert);
+	aircraft->timestamp = now;
+	aircraft->lat = _transponder_report.lat;
+	aircraft->lon = _transponder_report.lon;
+	aircraft->altitude = _transponder_report.altitude;
+	aircraft->vel_n = _transponder_report.hor_velocity * cosf(_transponder_report.heading);
+	aircraft->vel_e = _transponder_report.hor_velocity * sinf(_transponder_report.heading);
+	aircraft->vel_u = _transponder_report.ver_velocity;
 
-	if (relative_uav_traffic_speed > FLT_EPSILON) {
-		const float time_to_collsion =  d_xyz / relative_uav_traffic_speed;
-		collision_time_check = (time_to_collsion < _conflict_detection_params.collision_time_threshold);
+	float rel_pos[3];
+	get_vector_to_next_waypoint(lat_now, lon_now, aircraft->lat, aircraft->lon, &rel_pos[0], &rel_pos[1]);
+	rel_pos[2] = aircraft->altitude - alt_now;
+
+	const float rel_vel[3] {aircraft->vel_n - vx_now, aircraft->vel_e - vy_now, aircraft->vel_u + vz_now};
+
+	const float horizon = _conflict_detection_params.collision_time_threshold;
+	const float hor_separation = _conflict_detection_params.crosstrack_separation;
+	const float ver_separation = _conflict_detection_params.vertical_separation;
+
+	// spatial pruning: traffic that can not close in to the separation within the horizon, even flying straight
+	// at the vehicle, is not predicted further
+	const float max_hor_closing = sqrtf(rel_vel[0] * rel_vel[0] + rel_vel[1] * rel_vel[1]) * horizon;
+	const float max_ver_closing = fabsf(rel_vel[2]) * horizon;
+
+	if ((fabsf(rel_pos[0]) > hor_separation + max_hor_closing) || (fabsf(rel_pos[1]) > hor_separation + max_hor_closing)
+	    || (fabsf(rel_pos[2]) > ver_separation + max_ver_closing)) {
+
+		aircraft->cpa_time = NAN;
+		aircraft->cpa_hor_distance = NAN;
+		aircraft->cpa_ver_distance = NAN;
+		aircraft->in_conflict = false;
+
+	} else {
+		aircraft->in_conflict = predict_conflict(rel_pos, rel_vel, horizon, hor_separation, ver_separation,
+					aircraft->cpa_time, aircraft->cpa_hor_distance, aircraft->cpa_ver_distance);
 	}
 
-	_conflict_detected = (cs_distance_conflict_threshold && _crosstrack_separation_check
-			      && collision_time_check);
+	_cpa_hor_distance = aircraft->cpa_hor_distance;
+	_conflict_detected = aircraft->in_conflict;
 }
 
 int AdsbConflict::find_icao_address_in_conflict_list(uint32_t icao_address)
@@ -157,6 +312,8 @@ void AdsbConflict::get_traffic_state()
 
 void AdsbConflict::remove_expired_conflicts()
 {
+	_traffic_table.remove_stale(hrt_absolute_time(), TRAFFIC_TABLE_TIMEOUT);
+
 	for (uint8_t traffic_index = 0; traffic_index < _traffic_buffer.timestamp.size();) {
 		if (hrt_elapsed_time(&_traffic_buffer.timestamp[traffic_index]) > TRAFFIC_CONFLICT_LIFETIME) {
 			events::send<uint32_t>(events::ID("navigator_traffic_expired"), events::Log::Notice,
@@ -182,7 +339,7 @@ bool AdsbConflict::handle_traffic_conflict()
 	case TRAFFIC_STATE::ADD_CONFLICT:
 	case TRAFFIC_STATE::REMIND_CONFLICT: {
 			take_action = send_traffic_warning((int)(math::degrees(_transponder_report.heading) + 180.f),
-							   (int)fabsf(_crosstrack_error.distance), _transponder_report.flags,
+							   (int)_cpa_hor_distance, _transponder_report.flags,
 							   _transponder_report.callsign,
 							   _transponder_report.icao_address);
 		}
@@ -60,12 +60,18 @@ static constexpr uint8_t UTM_CALLSIGN_LENGTH{9};
 
 static constexpr uint64_t CONFLICT_WARNING_TIMEOUT{60_s};
 
-static constexpr float TRAFFIC_TO_UAV_DISTANCE_EXTENSION{1000.0f};
-
 static constexpr uint64_t TRAFFIC_WARNING_TIMESTEP{60_s}; //limits the max warning rate when traffic conflict buffer is full
 
 static constexpr uint64_t TRAFFIC_CONFLICT_LIFETIME{120_s}; //limits the time a conflict can be in the buffer without being seen (as a conflict)
 
+#if defined(CONFIG_ADSB_TRAFFIC_TABLE_SIZE)
+static constexpr int ADSB_TRAFFIC_TABLE_SIZE{CONFIG_ADSB_TRAFFIC_TABLE_SIZE};
+#else
+static constexpr int ADSB_TRAFFIC_TABLE_SIZE{64};
+#endif
+
+static constexpr uint64_t TRAFFIC_TABLE_TIMEOUT{30_s}; //aircraft not heard from for this long are dropped from the traffic table
+
 struct traffic_data_s {
 	double lat_traffic;
 	double lon_traffic;
@@ -88,6 +94,78 @@ struct conflict_detection_params_s {
 	uint8_t traffic_avoidance_mode;
 };
 
+// state of an aircraft in the traffic table, velocities in NEU
+struct traffic_aircraft_s {
+	uint32_t icao_address;
+	hrt_abstime timestamp;		// time of the last report
+	double lat;
+	double lon;
+	float altitude;
+	float vel_n;
+	float vel_e;
+	float vel_u;
+	float cpa_time;			// time to the closest point of approach, 0 if it is now [s]
+	float cpa_hor_distance;		// horizontal separation at the closest point of approach [m]
+	float cpa_ver_distance;		// vertical separation at the closest point of approach [m]
+	bool in_conflict;
+};
+
+// smallest power of two not below count
+static constexpr int traffic_table_bucket_count(int count)
+{
+	return (count <= 1) ? 1 : 2 * traffic_table_bucket_count((count + 1) / 2);
+}
+
+/**
+ * Table of the aircraft in reception range, indexed by ICAO address.
+ *
+ * The aircraft are stored densely, an open addressing hash index with linear
+ * probing maps the ICAO addresses to them. The index has at least twice as
+ * many buckets as the capacity to keep the probe sequences short.
+ */
+class AdsbTrafficTable
+{
+public:
+	static constexpr int CAPACITY = ADSB_TRAFFIC_TABLE_SIZE;
+
+	AdsbTrafficTable();
+	~AdsbTrafficTable() = default;
+
+	traffic_aircraft_s *find(uint32_t icao_address);
+
+	/**
+	 * Find or add an aircraft
+	 * @return the aircraft, nullptr if it is new and the table is full
+	 */
+	traffic_aircraft_s *insert(uint32_t icao_address);
+
+	void remove(uint32_t icao_address);
+
+	/**
+	 * Drop the aircraft not heard from within timeout
+	 * @return number of aircraft dropped
+	 */
+	int remove_stale(hrt_abstime now, hrt_abstime timeout);
+
+	int size() const { return _size; }
+	const traffic_aircraft_s &operator[](int index) const { return _aircraft[index]; }
+
+private:
+	static constexpr int NUM_BUCKETS = traffic_table_bucket_count(2 * CAPACITY);
+
+	static int home_bucket(uint32_t icao_address)
+	{
+		// Fibonacci hashing, consecutive addresses spread over the buckets
+		return (icao_address * 2654435761u) & (NUM_BUCKETS - 1);
+	}
+
+	int find_bucket(uint32_t icao_address) const;
+
+	traffic_aircraft_s _aircraft[CAPACITY] {};
+	int16_t _buckets[NUM_BUCKETS];	// index into _aircraft, -1 if empty
+	int _size{0};
+};
+
 enum class TRAFFIC_STATE {
 	NO_CONFLICT = 0,
 	ADD_CONFLICT = 1,
@@ -134,6 +212,22 @@ public:
 
 	void remove_expired_conflicts();
 
+	/**
+	 * Predict a loss of separation of two constant velocity tracks, i.e. the other track entering the cylinder of
+	 * hor_separation radius and 2 * ver_separation height around this one within the horizon.
+	 * @param rel_pos position of the other track relative to this one, NEU [m]
+	 * @param rel_vel velocity of the other track relative to this one, NEU [m/s]
+	 * @param horizon prediction time [s]
+	 * @param cpa_time time of the horizontal closest point of approach within the horizon [s]
+	 * @param cpa_hor_distance horizontal separation at cpa_time [m]
+	 * @param cpa_ver_distance vertical separation at cpa_time [m]
+	 * @return true if the separation is lost within the horizon
+	 */
+	static bool predict_conflict(const float rel_pos[3], const float rel_vel[3], float horizon, float hor_separation,
+				     float ver_separation, float &cpa_time, float &cpa_hor_distance, float &cpa_ver_distance);
+
+	const AdsbTrafficTable &traffic_table() const { return _traffic_table; }
+
 	bool _conflict_detected{false};
 
 	TRAFFIC_STATE _traffic_state{TRAFFIC_STATE::NO_CONFLICT};
@@ -144,9 +238,11 @@ public:
 protected:
 	traffic_buffer_s _traffic_buffer;
 
+	AdsbTrafficTable _traffic_table;
+
 private:
 
-	crosstrack_error_s _crosstrack_error{};
+	float _cpa_hor_distance{NAN};	// of the last checked report
 
 	transponder_report_s tr{};
 
@@ -285,3 +285,78 @@ TEST_F(AdsbConflictTest, trafficReminder)
 	EXPECT_TRUE(adsb_conflict._traffic_state == TRAFFIC_STATE::ADD_CONFLICT);
 
 }
+
+TEST_F(AdsbConflictTest, trafficTable)
+{
+	AdsbTrafficTable traffic_table;
+
+	// fill the table, then every further aircraft is rejected
+	for (int i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		traffic_aircraft_s *aircraft = traffic_table.insert(1000 + 7 * i);
+		ASSERT_TRUE(aircraft != nullptr);
+		aircraft->timestamp = (i % 2) ? 10_s : 1_s;
+	}
+
+	EXPECT_EQ(traffic_table.size(), AdsbTrafficTable::CAPACITY);
+	EXPECT_TRUE(traffic_table.insert(1) == nullptr);
+
+	// known aircraft are found again, with their state
+	EXPECT_EQ(traffic_table.insert(1007), traffic_table.find(1007));
+	EXPECT_EQ(traffic_table.find(1007)->timestamp, 10_s);
+
+	traffic_table.remove(1000);
+	EXPECT_TRUE(traffic_table.find(1000) == nullptr);
+	EXPECT_EQ(traffic_table.size(), AdsbTrafficTable::CAPACITY - 1);
+
+	// the aircraft last reported at 1 s are dropped, all others are still found
+	EXPECT_EQ(traffic_table.remove_stale(20_s, 15_s), AdsbTrafficTable::CAPACITY / 2 - 1);
+
+	for (int i = 0; i < AdsbTrafficTable::CAPACITY; i++) {
+		EXPECT_EQ(traffic_table.find(1000 + 7 * i) != nullptr, (i % 2) == 1);
+	}
+
+	EXPECT_TRUE(traffic_table.insert(1) != nullptr);
+}
+
+TEST_F(AdsbConflictTest, predictConflict)
+{
+	float cpa_time;
+	float cpa_hor_distance;
+	float cpa_ver_distance;
+
+	// head on at the same altitude, closest point of approach after 50 s
+	const float head_on_pos[3] {5000.f, 0.f, 0.f};
+	const float head_on_vel[3] {-100.f, 0.f, 0.f};
+	EXPECT_TRUE(AdsbConflict::predict_conflict(head_on_pos, head_on_vel, 60.f, 500.f, 500.f,
+			cpa_time, cpa_hor_distance, cpa_ver_distance));
+	EXPECT_NEAR(cpa_time, 50.f, 1e-3f);
+	EXPECT_NEAR(cpa_hor_distance, 0.f, 1e-3f);
+
+	// the same track with a shorter horizon ends outside of the separation
+	EXPECT_FALSE(AdsbConflict::predict_conflict(head_on_pos, head_on_vel, 40.f, 500.f, 500.f,
+			cpa_time, cpa_hor_distance, cpa_ver_distance));
+
+	// flying away
+	const float away_vel[3] {100.f, 0.f, 0.f};
+	EXPECT_FALSE(AdsbConflict::predict_conflict(head_on_pos, away_vel, 60.f, 500.f, 500.f,
+			cpa_time, cpa_hor_distance, cpa_ver_distance));
+	EXPECT_NEAR(cpa_time, 0.f, 1e-3f);
+
+	// crossing 1000 m above, but descending through the vertical separation while horizontally close
+	const float descending_pos[3] {2000.f, 0.f, 1000.f};
+	const float descending_vel[3] {-50.f, 0.f, -20.f};
+	EXPECT_TRUE(AdsbConflict::predict_conflict(descending_pos, descending_vel, 60.f, 500.f, 500.f,
+			cpa_time, cpa_hor_distance, cpa_ver_distance));
+
+	// the same with a slower descent stays above the vertical separation while horizontally close
+	const float slow_descending_vel[3] {-50.f, 0.f, -5.f};
+	EXPECT_FALSE(AdsbConflict::predict_conflict(descending_pos, slow_descending_vel, 60.f, 500.f, 500.f,
+			cpa_time, cpa_hor_distance, cpa_ver_distance));
+
+	// passing abeam 600 m to the side
+	const float abeam_pos[3] {3000.f, 600.f, 0.f};
+	EXPECT_FALSE(AdsbConflict::predict_conflict(abeam_pos, head_on_vel, 60.f, 500.f, 500.f,
+			cpa_time, cpa_hor_distance, cpa_ver_distance));
+	EXPECT_NEAR(cpa_time, 30.f, 1e-3f);
+	EXPECT_NEAR(cpa_hor_distance, 600.f, 1e-2f);
+}
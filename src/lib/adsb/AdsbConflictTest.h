@@ -10,7 +10,7 @@ public:
 };
 
 
-// traffic dataset generated using notebook in adsb/test_adsb_helper.ipynb
+// traffic dataset generated using notebook in adsb/test_adsb_helper.ipynb, in_conflict from sampling the relative tracks
 traffic_data_s traffic_dataset[1940] = {
 
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 4.470000000000000000e+02, -3.141592653589793116e+00, 2.042375980563040798e+02, 2.042375980563040798e+02, 0},
@@ -135,7 +135,7 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 1.089000000000000000e+03, 7.215191127744797761e-01, 7.353086781646577208e+01, 7.353086781646577208e+01, 0},
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 1.057000000000000000e+03, 7.539822368615745063e-01, 2.762453376980698394e+01, 2.762453376980698394e+01, 0},
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 1.209000000000000000e+03, 7.864453609486692365e-01, 1.976500388415134424e+01, 1.976500388415134424e+01, 0},
-	{3.270694516059187151e+01, -9.638379328402535862e+01, 8.100000000000000000e+02, 8.189084850357639667e-01, 3.125282018524488308e+02, 3.125282018524488308e+02, 1},
+	{3.270694516059187151e+01, -9.638379328402535862e+01, 8.100000000000000000e+02, 8.189084850357639667e-01, 3.125282018524488308e+02, 3.125282018524488308e+02, 0},
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 1.305000000000000000e+03, 8.513716091228586968e-01, 6.668216903090860797e+02, 6.668216903090860797e+02, 0},
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 1.261000000000000000e+03, 8.838347332099534270e-01, 2.309862096999995984e+01, 2.309862096999995984e+01, 0},
 	{3.270694516059187151e+01, -9.638379328402535862e+01, 1.414000000000000000e+03, 9.162978572970477131e-01, 2.858366852107071736e+02, 2.858366852107071736e+02, 0},
@@ -269,27 +269,27 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.161000000000000000e+03, -1.226268332451204035e+00, 6.290371175952179073e+01, 6.290371175952179073e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.354000000000000000e+03, -1.193805208364109305e+00, 4.123412179251547371e+01, 4.123412179251547371e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.301000000000000000e+03, -1.161342084277014575e+00, 2.588352870386408267e+00, 2.588352870386408267e+00, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 8.730000000000000000e+02, -1.128878960189919844e+00, 5.577911961644056760e+01, 5.577911961644056760e+01, 1},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 9.280000000000000000e+02, -1.096415836102825114e+00, 2.860843317938946129e+01, 2.860843317938946129e+01, 1},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.034000000000000000e+03, -1.063952712015730384e+00, 5.001444791257822544e+02, 5.001444791257822544e+02, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 8.730000000000000000e+02, -1.128878960189919844e+00, 5.577911961644056760e+01, 5.577911961644056760e+01, 0},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 9.280000000000000000e+02, -1.096415836102825114e+00, 2.860843317938946129e+01, 2.860843317938946129e+01, 0},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.034000000000000000e+03, -1.063952712015730384e+00, 5.001444791257822544e+02, 5.001444791257822544e+02, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.606000000000000000e+03, -1.031489587928635654e+00, 4.945191336578585606e+01, 4.945191336578585606e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.343000000000000000e+03, -9.990264638415409237e-01, 5.119363096895791720e+00, 5.119363096895791720e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.359000000000000000e+03, -9.665633397544461936e-01, 1.813211349348813783e+00, 1.813211349348813783e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 7.440000000000000000e+02, -9.341002156673514634e-01, 1.801865136999160066e+00, 1.801865136999160066e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 2.660000000000000000e+02, -9.016370915802567332e-01, 2.728006695607728460e+00, 2.728006695607728460e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.829000000000000000e+03, -8.691739674931620030e-01, 3.311847009184587876e+01, 3.311847009184587876e+01, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.430000000000000000e+02, -8.367108434060672728e-01, 5.846418775626666502e+02, 5.846418775626666502e+02, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 9.930000000000000000e+02, -8.042477193189725426e-01, 6.250076562031060945e+01, 6.250076562031060945e+01, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.430000000000000000e+02, -8.367108434060672728e-01, 5.846418775626666502e+02, 5.846418775626666502e+02, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 9.930000000000000000e+02, -8.042477193189725426e-01, 6.250076562031060945e+01, 6.250076562031060945e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.011000000000000000e+03, -7.717845952318778124e-01, 3.496609264134554529e+00, 3.496609264134554529e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.290000000000000000e+03, -7.393214711447830823e-01, 3.357922707563754994e+00, 3.357922707563754994e+00, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 9.390000000000000000e+02, -7.068583470576883521e-01, 2.327743762138382166e+01, 2.327743762138382166e+01, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 9.390000000000000000e+02, -7.068583470576883521e-01, 2.327743762138382166e+01, 2.327743762138382166e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.845000000000000000e+03, -6.743952229705936219e-01, 1.213446661159511564e+01, 1.213446661159511564e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.241000000000000000e+03, -6.419320988834988917e-01, 3.497987360854011740e+00, 3.497987360854011740e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.860000000000000000e+02, -6.094689747964041615e-01, 3.884912042426451606e+00, 3.884912042426451606e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.817000000000000000e+03, -5.770058507093094313e-01, 2.309757130089655277e+02, 2.309757130089655277e+02, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 5.370000000000000000e+02, -5.445427266222147011e-01, 3.897142036080121130e+01, 3.897142036080121130e+01, 1},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.429000000000000000e+03, -5.120796025351199710e-01, 3.870362395880496820e+01, 3.870362395880496820e+01, 1},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 6.820000000000000000e+02, -4.796164784480252408e-01, 1.863580486967213901e+01, 1.863580486967213901e+01, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 5.370000000000000000e+02, -5.445427266222147011e-01, 3.897142036080121130e+01, 3.897142036080121130e+01, 0},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.429000000000000000e+03, -5.120796025351199710e-01, 3.870362395880496820e+01, 3.870362395880496820e+01, 0},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 6.820000000000000000e+02, -4.796164784480252408e-01, 1.863580486967213901e+01, 1.863580486967213901e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.327000000000000000e+03, -4.471533543609305106e-01, 2.125019021386089779e+00, 2.125019021386089779e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.810000000000000000e+03, -4.146902302738357804e-01, 2.237690324531151465e+00, 2.237690324531151465e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 6.930000000000000000e+02, -3.822271061867410502e-01, 1.824048153878497169e+00, 1.824048153878497169e+00, 0},
@@ -368,13 +368,13 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.052000000000000000e+03, 1.987580952171174253e+00, 2.042195452380260434e+01, 2.042195452380260434e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.988000000000000000e+03, 2.020044076258269428e+00, 5.303763332016389143e+01, 5.303763332016389143e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.652000000000000000e+03, 2.052507200345363714e+00, 7.197120189593371187e+00, 7.197120189593371187e+00, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 7.240000000000000000e+02, 2.084970324432458000e+00, 5.993329625508680181e+01, 5.993329625508680181e+01, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 7.240000000000000000e+02, 2.084970324432458000e+00, 5.993329625508680181e+01, 5.993329625508680181e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 3.730000000000000000e+02, 2.117433448519553174e+00, 3.125359734396627331e+01, 3.125359734396627331e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.524000000000000000e+03, 2.149896572606648348e+00, 2.734453996463849990e+01, 2.734453996463849990e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 2.600000000000000000e+01, 2.182359696693742634e+00, 2.321650494216593863e+00, 2.321650494216593863e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 2.330000000000000000e+02, 2.214822820780836921e+00, 6.391037755361468342e+00, 6.391037755361468342e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 2.530000000000000000e+02, 2.247285944867932095e+00, 5.140594596923332205e+01, 5.140594596923332205e+01, 0},
-	{3.260801978394081146e+01, -9.647988692840254998e+01, 7.200000000000000000e+02, 2.279749068955027269e+00, 2.080431826510148241e+01, 2.080431826510148241e+01, 1},
+	{3.260801978394081146e+01, -9.647988692840254998e+01, 7.200000000000000000e+02, 2.279749068955027269e+00, 2.080431826510148241e+01, 2.080431826510148241e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 4.100000000000000000e+01, 2.312212193042121555e+00, 1.108475774300120520e+01, 1.108475774300120520e+01, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 1.855000000000000000e+03, 2.344675317129215841e+00, 2.148072525227568530e+00, 2.148072525227568530e+00, 0},
 	{3.260801978394081146e+01, -9.647988692840254998e+01, 7.640000000000000000e+02, 2.377138441216311016e+00, 8.310068752826285987e+00, 8.310068752826285987e+00, 0},
@@ -668,7 +668,7 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 1.293000000000000000e+03, -8.691739674931620030e-01, 1.207688985326631581e+01, 1.207688985326631581e+01, 0},
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 1.085000000000000000e+03, -8.367108434060672728e-01, 7.674173971683030615e+00, 7.674173971683030615e+00, 0},
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 6.440000000000000000e+02, -8.042477193189725426e-01, 6.952754753346910732e+00, 6.952754753346910732e+00, 0},
-	{3.264399264817755864e+01, -9.652259521479238913e+01, 6.510000000000000000e+02, -7.717845952318778124e-01, 1.157743450186483898e+02, 1.157743450186483898e+02, 1},
+	{3.264399264817755864e+01, -9.652259521479238913e+01, 6.510000000000000000e+02, -7.717845952318778124e-01, 1.157743450186483898e+02, 1.157743450186483898e+02, 0},
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 1.648000000000000000e+03, -7.393214711447830823e-01, 1.004897441330968100e+01, 1.004897441330968100e+01, 0},
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 1.440000000000000000e+02, -7.068583470576883521e-01, 3.687291872483300637e+01, 3.687291872483300637e+01, 0},
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 1.748000000000000000e+03, -6.743952229705936219e-01, 7.084345435068421182e+01, 7.084345435068421182e+01, 0},
@@ -790,36 +790,36 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 7.330000000000000000e+02, 3.091327171132395080e+00, 5.367740856310985009e+01, 5.367740856310985009e+01, 0},
 	{3.264399264817755864e+01, -9.652259521479238913e+01, 7.960000000000000000e+02, 3.123790295219489366e+00, 1.001155332603287604e+02, 1.001155332603287604e+02, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.055000000000000000e+03, -3.141592653589793116e+00, 6.174126230548238503e+00, 6.174126230548238503e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.340000000000000000e+02, -3.109129529502698386e+00, 9.474860245955298410e+00, 9.474860245955298410e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.340000000000000000e+02, -3.109129529502698386e+00, 9.474860245955298410e+00, 9.474860245955298410e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.100000000000000000e+02, -3.076666405415603656e+00, 2.677063067368168348e+01, 2.677063067368168348e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.105000000000000000e+03, -3.044203281328508925e+00, 8.499465677961424159e-01, 8.499465677961424159e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.105000000000000000e+03, -3.044203281328508925e+00, 8.499465677961424159e-01, 8.499465677961424159e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.048000000000000000e+03, -3.011740157241414195e+00, 4.139990965912152099e+00, 4.139990965912152099e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.870000000000000000e+02, -2.979277033154319465e+00, 2.393006786760430415e+01, 2.393006786760430415e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.232000000000000000e+03, -2.946813909067224735e+00, 5.389032071408247582e+00, 5.389032071408247582e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.238000000000000000e+03, -2.914350784980130005e+00, 4.506634031876247448e+00, 4.506634031876247448e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.160000000000000000e+02, -2.881887660893035275e+00, 6.201793149391507942e-01, 6.201793149391507942e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.160000000000000000e+02, -2.881887660893035275e+00, 6.201793149391507942e-01, 6.201793149391507942e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.869000000000000000e+03, -2.849424536805940544e+00, 2.692519537224072668e+00, 2.692519537224072668e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.532000000000000000e+03, -2.816961412718845814e+00, 1.434485695036503472e+00, 1.434485695036503472e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.310000000000000000e+02, -2.784498288631751084e+00, 8.960836882408703019e+00, 8.960836882408703019e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.180000000000000000e+02, -2.752035164544656354e+00, 5.359044982099320231e-01, 5.359044982099320231e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.610000000000000000e+02, -2.719572040457561624e+00, 6.999700513267181901e-01, 6.999700513267181901e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.180000000000000000e+02, -2.752035164544656354e+00, 5.359044982099320231e-01, 5.359044982099320231e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.610000000000000000e+02, -2.719572040457561624e+00, 6.999700513267181901e-01, 6.999700513267181901e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.254000000000000000e+03, -2.687108916370466893e+00, 6.400201952595996779e+00, 6.400201952595996779e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.737000000000000000e+03, -2.654645792283372163e+00, 1.116395091354310836e+02, 1.116395091354310836e+02, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.032000000000000000e+03, -2.622182668196277433e+00, 8.386497083606082370e+00, 8.386497083606082370e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.860000000000000000e+02, -2.589719544109182703e+00, 1.789387482386435524e+00, 1.789387482386435524e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.860000000000000000e+02, -2.589719544109182703e+00, 1.789387482386435524e+00, 1.789387482386435524e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.304000000000000000e+03, -2.557256420022087973e+00, 8.388913967315460241e+00, 8.388913967315460241e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.457000000000000000e+03, -2.524793295934993242e+00, 9.744416294226523334e+00, 9.744416294226523334e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.566000000000000000e+03, -2.492330171847898512e+00, 1.315919297911508323e+01, 1.315919297911508323e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.764000000000000000e+03, -2.459867047760803782e+00, 4.500488254761920714e+00, 4.500488254761920714e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.610000000000000000e+02, -2.427403923673709052e+00, 5.950922735589723622e+00, 5.950922735589723622e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.250000000000000000e+03, -2.394940799586614322e+00, 3.813242232868325488e+01, 3.813242232868325488e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.840000000000000000e+02, -2.362477675499519592e+00, 2.478346909011530652e+00, 2.478346909011530652e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.840000000000000000e+02, -2.362477675499519592e+00, 2.478346909011530652e+00, 2.478346909011530652e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.534000000000000000e+03, -2.330014551412424861e+00, 1.857788998296851091e+01, 1.857788998296851091e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.890000000000000000e+02, -2.297551427325330131e+00, 1.352683675143601327e+00, 1.352683675143601327e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.737000000000000000e+03, -2.265088303238235401e+00, 9.318823800954180170e-01, 9.318823800954180170e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.194000000000000000e+03, -2.232625179151140671e+00, 1.165981853817610991e+00, 1.165981853817610991e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.194000000000000000e+03, -2.232625179151140671e+00, 1.165981853817610991e+00, 1.165981853817610991e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.529000000000000000e+03, -2.200162055064045941e+00, 9.024901419489713916e+00, 9.024901419489713916e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.308000000000000000e+03, -2.167698930976951210e+00, 7.448086293104938527e-01, 7.448086293104938527e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.308000000000000000e+03, -2.167698930976951210e+00, 7.448086293104938527e-01, 7.448086293104938527e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.992000000000000000e+03, -2.135235806889856480e+00, 1.548631076778011151e+00, 1.548631076778011151e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.598000000000000000e+03, -2.102772682802761750e+00, 8.825712460033937390e+00, 8.825712460033937390e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.492000000000000000e+03, -2.070309558715667020e+00, 1.003219816391203523e+01, 1.003219816391203523e+01, 1},
@@ -832,55 +832,55 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.800000000000000000e+03, -1.843067690106003909e+00, 1.304347826086956630e+01, 1.304347826086956630e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.534000000000000000e+03, -1.810604566018909178e+00, 8.201371777510090277e-01, 8.201371777510090277e-01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.351000000000000000e+03, -1.778141441931814448e+00, 1.874990196052799973e+01, 1.874990196052799973e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.420000000000000000e+02, -1.745678317844719718e+00, 1.459932614655153893e+00, 1.459932614655153893e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.420000000000000000e+02, -1.745678317844719718e+00, 1.459932614655153893e+00, 1.459932614655153893e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.090000000000000000e+02, -1.713215193757624988e+00, 1.872563031766683705e+00, 1.872563031766683705e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.359000000000000000e+03, -1.680752069670530258e+00, 8.079313863194076362e+01, 8.079313863194076362e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.291000000000000000e+03, -1.648288945583435527e+00, 7.102731290505018835e-01, 7.102731290505018835e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.291000000000000000e+03, -1.648288945583435527e+00, 7.102731290505018835e-01, 7.102731290505018835e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.719000000000000000e+03, -1.615825821496340797e+00, 3.213727583772302410e+01, 3.213727583772302410e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.290000000000000000e+02, -1.583362697409246067e+00, 6.640767135735916593e-01, 6.640767135735916593e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.830000000000000000e+02, -1.550899573322151337e+00, 3.478488269688588819e-01, 3.478488269688588819e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.290000000000000000e+02, -1.583362697409246067e+00, 6.640767135735916593e-01, 6.640767135735916593e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.830000000000000000e+02, -1.550899573322151337e+00, 3.478488269688588819e-01, 3.478488269688588819e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.757000000000000000e+03, -1.518436449235056607e+00, 9.603751650239621407e-01, 9.603751650239621407e-01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.850000000000000000e+02, -1.485973325147961877e+00, 2.099237776600492378e+00, 2.099237776600492378e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.714000000000000000e+03, -1.453510201060867146e+00, 4.451189490417393202e+00, 4.451189490417393202e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.197000000000000000e+03, -1.421047076973772416e+00, 1.860537281114984953e+00, 1.860537281114984953e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.197000000000000000e+03, -1.421047076973772416e+00, 1.860537281114984953e+00, 1.860537281114984953e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.550000000000000000e+02, -1.388583952886677686e+00, 9.550550429261512875e+00, 9.550550429261512875e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.940000000000000000e+02, -1.356120828799582956e+00, 1.264392110402400515e+00, 1.264392110402400515e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.120000000000000000e+02, -1.323657704712488226e+00, 2.342033183167951282e+00, 2.342033183167951282e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.120000000000000000e+02, -1.323657704712488226e+00, 2.342033183167951282e+00, 2.342033183167951282e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.905000000000000000e+03, -1.291194580625393495e+00, 3.943864316117459357e+00, 3.943864316117459357e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.064000000000000000e+03, -1.258731456538298765e+00, 1.206212293456592555e+01, 1.206212293456592555e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.200000000000000000e+02, -1.226268332451204035e+00, 8.465480182968336820e-01, 8.465480182968336820e-01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.962000000000000000e+03, -1.193805208364109305e+00, 1.489556540701213905e+00, 1.489556540701213905e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.329000000000000000e+03, -1.161342084277014575e+00, 5.478404379088524401e+00, 5.478404379088524401e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.080000000000000000e+03, -1.128878960189919844e+00, 4.330127018922193649e+00, 4.330127018922193649e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.450000000000000000e+02, -1.096415836102825114e+00, 5.469124494868339292e-01, 5.469124494868339292e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.450000000000000000e+02, -1.096415836102825114e+00, 5.469124494868339292e-01, 5.469124494868339292e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.524000000000000000e+03, -1.063952712015730384e+00, 1.830677459901884774e+01, 1.830677459901884774e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.619000000000000000e+03, -1.031489587928635654e+00, 8.442598533080108991e-01, 8.442598533080108991e-01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.960000000000000000e+02, -9.990264638415409237e-01, 2.869844781568296810e+01, 2.869844781568296810e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.540000000000000000e+02, -9.665633397544461936e-01, 1.056682260031030385e+00, 1.056682260031030385e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.570000000000000000e+02, -9.341002156673514634e-01, 2.871177457999115834e+00, 2.871177457999115834e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.540000000000000000e+02, -9.665633397544461936e-01, 1.056682260031030385e+00, 1.056682260031030385e+00, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.570000000000000000e+02, -9.341002156673514634e-01, 2.871177457999115834e+00, 2.871177457999115834e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.645000000000000000e+03, -9.016370915802567332e-01, 9.764873216929871091e+00, 9.764873216929871091e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.478000000000000000e+03, -8.691739674931620030e-01, 1.785166149639349698e+01, 1.785166149639349698e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.327000000000000000e+03, -8.367108434060672728e-01, 5.469045488554670209e-01, 5.469045488554670209e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.327000000000000000e+03, -8.367108434060672728e-01, 5.469045488554670209e-01, 5.469045488554670209e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.648000000000000000e+03, -8.042477193189725426e-01, 1.190361899275663582e+01, 1.190361899275663582e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.520000000000000000e+02, -7.717845952318778124e-01, 1.639339155844206530e+00, 1.639339155844206530e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.520000000000000000e+02, -7.717845952318778124e-01, 1.639339155844206530e+00, 1.639339155844206530e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.737000000000000000e+03, -7.393214711447830823e-01, 2.937881819353449586e+01, 2.937881819353449586e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.040000000000000000e+02, -7.068583470576883521e-01, 2.120385120173040505e+01, 2.120385120173040505e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.870000000000000000e+02, -6.743952229705936219e-01, 6.779847205136705668e+01, 6.779847205136705668e+01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.040000000000000000e+02, -7.068583470576883521e-01, 2.120385120173040505e+01, 2.120385120173040505e+01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.870000000000000000e+02, -6.743952229705936219e-01, 6.779847205136705668e+01, 6.779847205136705668e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.940000000000000000e+03, -6.419320988834988917e-01, 7.230397349615948599e+00, 7.230397349615948599e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.580000000000000000e+02, -6.094689747964041615e-01, 6.837002588994367525e-01, 6.837002588994367525e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.580000000000000000e+02, -6.094689747964041615e-01, 6.837002588994367525e-01, 6.837002588994367525e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.189000000000000000e+03, -5.770058507093094313e-01, 1.202710480539685101e+01, 1.202710480539685101e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.200000000000000000e+02, -5.445427266222147011e-01, 4.512966198114654937e+00, 4.512966198114654937e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.985000000000000000e+03, -5.120796025351199710e-01, 2.012906848684628613e+01, 2.012906848684628613e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.790000000000000000e+02, -4.796164784480252408e-01, 1.608382555378055656e+02, 1.608382555378055656e+02, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.460000000000000000e+02, -4.471533543609305106e-01, 9.182434379204387209e-01, 9.182434379204387209e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.260000000000000000e+02, -4.146902302738357804e-01, 3.231998812891275463e+01, 3.231998812891275463e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.218000000000000000e+03, -3.822271061867410502e-01, 1.014101951332949225e+00, 1.014101951332949225e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.790000000000000000e+02, -4.796164784480252408e-01, 1.608382555378055656e+02, 1.608382555378055656e+02, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.460000000000000000e+02, -4.471533543609305106e-01, 9.182434379204387209e-01, 9.182434379204387209e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.260000000000000000e+02, -4.146902302738357804e-01, 3.231998812891275463e+01, 3.231998812891275463e+01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.218000000000000000e+03, -3.822271061867410502e-01, 1.014101951332949225e+00, 1.014101951332949225e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.130000000000000000e+02, -3.497639820996463200e-01, 1.412275670485208146e+01, 1.412275670485208146e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.798000000000000000e+03, -3.173008580125515898e-01, 6.651853914047357819e+01, 6.651853914047357819e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.800000000000000000e+01, -2.848377339254568597e-01, 7.090289133737778116e+01, 7.090289133737778116e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.490000000000000000e+02, -2.523746098383621295e-01, 9.851577759225412789e-01, 9.851577759225412789e-01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.760000000000000000e+02, -2.199114857512673993e-01, 4.004441978048321715e+01, 4.004441978048321715e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.220000000000000000e+02, -1.874483616641726691e-01, 7.420902635014647331e+01, 7.420902635014647331e+01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.220000000000000000e+02, -1.874483616641726691e-01, 7.420902635014647331e+01, 7.420902635014647331e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.850000000000000000e+02, -1.549852375770779389e-01, 1.141918242575742681e+01, 1.141918242575742681e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.104000000000000000e+03, -1.225221134899832087e-01, 7.347983780340524795e+00, 7.347983780340524795e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.032000000000000000e+03, -9.005898940288847854e-02, 4.193248541803041185e+00, 4.193248541803041185e+00, 1},
@@ -890,47 +890,47 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.965000000000000000e+03, 3.979350694549044221e-02, 9.608977609191166280e+00, 9.608977609191166280e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.760000000000000000e+02, 7.225663103258517239e-02, 2.551234995056315569e+01, 2.551234995056315569e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.814000000000000000e+03, 1.047197551196799026e-01, 1.638016850407806313e+00, 1.638016850407806313e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.830000000000000000e+02, 1.371828792067746328e-01, 5.852953463634555931e+00, 5.852953463634555931e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.830000000000000000e+02, 1.371828792067746328e-01, 5.852953463634555931e+00, 5.852953463634555931e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.100000000000000000e+01, 1.696460032938693629e-01, 2.510695353257194284e+00, 2.510695353257194284e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.671000000000000000e+03, 2.021091273809640931e-01, 1.410680914229521798e+00, 1.410680914229521798e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.437000000000000000e+03, 2.345722514680588233e-01, 7.967147011001617374e-01, 7.967147011001617374e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.437000000000000000e+03, 2.345722514680588233e-01, 7.967147011001617374e-01, 7.967147011001617374e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.855000000000000000e+03, 2.670353755551535535e-01, 1.996233961731988416e+00, 1.996233961731988416e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.390000000000000000e+02, 2.994984996422482837e-01, 1.643796315402432384e+01, 1.643796315402432384e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.465000000000000000e+03, 3.319616237293430139e-01, 7.401035930208465174e+00, 7.401035930208465174e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.085000000000000000e+03, 3.644247478164377441e-01, 1.491686143604078829e+01, 1.491686143604078829e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.330000000000000000e+02, 3.968878719035324742e-01, 3.710012068745227043e-01, 3.710012068745227043e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.110000000000000000e+02, 4.293509959906272044e-01, 6.558209411182225335e-01, 6.558209411182225335e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.330000000000000000e+02, 3.968878719035324742e-01, 3.710012068745227043e-01, 3.710012068745227043e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 7.110000000000000000e+02, 4.293509959906272044e-01, 6.558209411182225335e-01, 6.558209411182225335e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.600000000000000000e+01, 4.618141200777219346e-01, 2.816557222140060990e+00, 2.816557222140060990e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.890000000000000000e+03, 4.942772441648166648e-01, 1.435523524112291582e+01, 1.435523524112291582e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.620000000000000000e+02, 5.267403682519113950e-01, 5.306086091587634890e+00, 5.306086091587634890e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.620000000000000000e+02, 5.267403682519113950e-01, 5.306086091587634890e+00, 5.306086091587634890e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.730000000000000000e+02, 5.592034923390061252e-01, 3.779934034869750104e+00, 3.779934034869750104e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.500000000000000000e+01, 5.916666164261008554e-01, 5.166699853869253012e+00, 5.166699853869253012e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.860000000000000000e+02, 6.241297405131955855e-01, 4.146806713262599864e+00, 4.146806713262599864e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.488000000000000000e+03, 6.565928646002903157e-01, 2.144292005937881385e+00, 2.144292005937881385e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.670000000000000000e+02, 6.890559886873850459e-01, 9.282003843545514332e-01, 9.282003843545514332e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.488000000000000000e+03, 6.565928646002903157e-01, 2.144292005937881385e+00, 2.144292005937881385e+00, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.670000000000000000e+02, 6.890559886873850459e-01, 9.282003843545514332e-01, 9.282003843545514332e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.800000000000000000e+01, 7.215191127744797761e-01, 1.505432869642482530e+01, 1.505432869642482530e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.100000000000000000e+01, 7.539822368615745063e-01, 7.665633684944838322e+00, 7.665633684944838322e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.294000000000000000e+03, 7.864453609486692365e-01, 5.746519964855324458e-01, 5.746519964855324458e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.620000000000000000e+02, 8.189084850357639667e-01, 4.699804598630258567e+00, 4.699804598630258567e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.294000000000000000e+03, 7.864453609486692365e-01, 5.746519964855324458e-01, 5.746519964855324458e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.620000000000000000e+02, 8.189084850357639667e-01, 4.699804598630258567e+00, 4.699804598630258567e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.190000000000000000e+02, 8.513716091228586968e-01, 1.066388332629281877e+01, 1.066388332629281877e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.200000000000000000e+01, 8.838347332099534270e-01, 1.701965767218217795e+00, 1.701965767218217795e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.800000000000000000e+01, 9.162978572970477131e-01, 1.553645618374638993e+00, 1.553645618374638993e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.560000000000000000e+02, 9.487609813841428874e-01, 4.179295385953233355e-01, 4.179295385953233355e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.470000000000000000e+02, 9.812241054712380617e-01, 6.522108981490821744e-01, 6.522108981490821744e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.680000000000000000e+02, 1.013687229558332348e+00, 4.102462456537178781e+00, 4.102462456537178781e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.560000000000000000e+02, 9.487609813841428874e-01, 4.179295385953233355e-01, 4.179295385953233355e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.470000000000000000e+02, 9.812241054712380617e-01, 6.522108981490821744e-01, 6.522108981490821744e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.680000000000000000e+02, 1.013687229558332348e+00, 4.102462456537178781e+00, 4.102462456537178781e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 4.400000000000000000e+01, 1.046150353645426634e+00, 2.357724325448142810e+00, 2.357724325448142810e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.001000000000000000e+03, 1.078613477732521808e+00, 1.117325418972590967e+00, 1.117325418972590967e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.400000000000000000e+01, 1.111076601819616982e+00, 1.576795942484126201e+01, 1.576795942484126201e+01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.001000000000000000e+03, 1.078613477732521808e+00, 1.117325418972590967e+00, 1.117325418972590967e+00, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.400000000000000000e+01, 1.111076601819616982e+00, 1.576795942484126201e+01, 1.576795942484126201e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.093000000000000000e+03, 1.143539725906711269e+00, 5.263346131502278702e+00, 5.263346131502278702e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.900000000000000000e+03, 1.176002849993805555e+00, 3.924018842390098172e+01, 3.924018842390098172e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.806000000000000000e+03, 1.208465974080900729e+00, 3.178956082246683934e+01, 3.178956082246683934e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.088000000000000000e+03, 1.240929098167995903e+00, 6.036208627820655037e-01, 6.036208627820655037e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.088000000000000000e+03, 1.240929098167995903e+00, 6.036208627820655037e-01, 6.036208627820655037e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.681000000000000000e+03, 1.273392222255090189e+00, 1.489776041242852145e+01, 1.489776041242852145e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.910000000000000000e+02, 1.305855346342184475e+00, 1.026159066048595525e+00, 1.026159066048595525e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.850000000000000000e+02, 1.338318470429279650e+00, 1.079496410369205392e+02, 1.079496410369205392e+02, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.917000000000000000e+03, 1.370781594516374824e+00, 2.609848495908839894e+01, 2.609848495908839894e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.070000000000000000e+02, 1.403244718603469110e+00, 1.275962698546006857e+00, 1.275962698546006857e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.240000000000000000e+02, 1.435707842690563396e+00, 4.217804103321139420e-01, 4.217804103321139420e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.070000000000000000e+02, 1.403244718603469110e+00, 1.275962698546006857e+00, 1.275962698546006857e+00, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.240000000000000000e+02, 1.435707842690563396e+00, 4.217804103321139420e-01, 4.217804103321139420e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.538000000000000000e+03, 1.468170966777658570e+00, 9.466805581907453693e-01, 9.466805581907453693e-01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.610000000000000000e+02, 1.500634090864753745e+00, 2.601555357430969195e+01, 2.601555357430969195e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.680000000000000000e+02, 1.533097214951848031e+00, 4.414159036554981697e+01, 4.414159036554981697e+01, 1},
@@ -941,112 +941,112 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.500000000000000000e+01, 1.695412835387321238e+00, 2.120074408122641696e+00, 2.120074408122641696e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.724000000000000000e+03, 1.727875959474416412e+00, 1.616545079198098023e+01, 1.616545079198098023e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.981000000000000000e+03, 1.760339083561511586e+00, 7.762670113350425005e+00, 7.762670113350425005e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.453000000000000000e+03, 1.792802207648605872e+00, 1.547664385361961381e+00, 1.547664385361961381e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.265000000000000000e+03, 1.825265331735700158e+00, 4.955996342601742821e-01, 4.955996342601742821e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.940000000000000000e+02, 1.857728455822795333e+00, 1.222249822294596733e+01, 1.222249822294596733e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.098000000000000000e+03, 1.890191579909890507e+00, 5.027668156492912654e-01, 5.027668156492912654e-01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.338000000000000000e+03, 1.922654703996984793e+00, 1.045785327846543211e+00, 1.045785327846543211e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.453000000000000000e+03, 1.792802207648605872e+00, 1.547664385361961381e+00, 1.547664385361961381e+00, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.265000000000000000e+03, 1.825265331735700158e+00, 4.955996342601742821e-01, 4.955996342601742821e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 2.940000000000000000e+02, 1.857728455822795333e+00, 1.222249822294596733e+01, 1.222249822294596733e+01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.098000000000000000e+03, 1.890191579909890507e+00, 5.027668156492912654e-01, 5.027668156492912654e-01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.338000000000000000e+03, 1.922654703996984793e+00, 1.045785327846543211e+00, 1.045785327846543211e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.134000000000000000e+03, 1.955117828084079079e+00, 1.702382597677660669e+01, 1.702382597677660669e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.180000000000000000e+02, 1.987580952171174253e+00, 6.941181455631311170e-01, 6.941181455631311170e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.180000000000000000e+02, 1.987580952171174253e+00, 6.941181455631311170e-01, 6.941181455631311170e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.481000000000000000e+03, 2.020044076258269428e+00, 1.793471286694701305e+01, 1.793471286694701305e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.023000000000000000e+03, 2.052507200345363714e+00, 7.431857795199382499e-01, 7.431857795199382499e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.023000000000000000e+03, 2.052507200345363714e+00, 7.431857795199382499e-01, 7.431857795199382499e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.700000000000000000e+01, 2.084970324432458000e+00, 2.572312663162934498e+00, 2.572312663162934498e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.910000000000000000e+02, 2.117433448519553174e+00, 1.082149487249844810e+01, 1.082149487249844810e+01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.910000000000000000e+02, 2.117433448519553174e+00, 1.082149487249844810e+01, 1.082149487249844810e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.900000000000000000e+01, 2.149896572606648348e+00, 6.268588927525695631e+00, 6.268588927525695631e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.140000000000000000e+02, 2.182359696693742634e+00, 2.098753916017788157e+01, 2.098753916017788157e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.030000000000000000e+02, 2.214822820780836921e+00, 9.197372974568416293e-01, 9.197372974568416293e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.140000000000000000e+02, 2.182359696693742634e+00, 2.098753916017788157e+01, 2.098753916017788157e+01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.030000000000000000e+02, 2.214822820780836921e+00, 9.197372974568416293e-01, 9.197372974568416293e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.665000000000000000e+03, 2.247285944867932095e+00, 1.110851484580162385e+01, 1.110851484580162385e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.758000000000000000e+03, 2.279749068955027269e+00, 1.079406901739544011e+01, 1.079406901739544011e+01, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.818000000000000000e+03, 2.312212193042121555e+00, 1.200028834717003612e+00, 1.200028834717003612e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.050000000000000000e+02, 2.344675317129215841e+00, 2.885700682850161769e+01, 2.885700682850161769e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.630000000000000000e+02, 2.377138441216311016e+00, 7.582048247096675908e+00, 7.582048247096675908e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.050000000000000000e+02, 2.344675317129215841e+00, 2.885700682850161769e+01, 2.885700682850161769e+01, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.630000000000000000e+02, 2.377138441216311016e+00, 7.582048247096675908e+00, 7.582048247096675908e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.588000000000000000e+03, 2.409601565303406190e+00, 9.227610741681727902e+00, 9.227610741681727902e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.516000000000000000e+03, 2.442064689390500476e+00, 7.850689235138156086e+00, 7.850689235138156086e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.487000000000000000e+03, 2.474527813477594762e+00, 1.971419278382783968e+00, 1.971419278382783968e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.487000000000000000e+03, 2.474527813477594762e+00, 1.971419278382783968e+00, 1.971419278382783968e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.374000000000000000e+03, 2.506990937564689936e+00, 4.736699962063487135e+01, 4.736699962063487135e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.659000000000000000e+03, 2.539454061651785111e+00, 1.152477792403598222e+01, 1.152477792403598222e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.350000000000000000e+02, 2.571917185738879397e+00, 1.929531103086389088e+00, 1.929531103086389088e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.350000000000000000e+02, 2.571917185738879397e+00, 1.929531103086389088e+00, 1.929531103086389088e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.710000000000000000e+03, 2.604380309825973683e+00, 1.217154292881879707e+00, 1.217154292881879707e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.580000000000000000e+02, 2.636843433913068857e+00, 7.421105039008678261e+01, 7.421105039008678261e+01, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.260000000000000000e+03, 2.669306558000164031e+00, 7.943320296611768860e-01, 7.943320296611768860e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.260000000000000000e+03, 2.669306558000164031e+00, 7.943320296611768860e-01, 7.943320296611768860e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.580000000000000000e+02, 2.701769682087258317e+00, 6.871393554637665879e+00, 6.871393554637665879e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.170000000000000000e+02, 2.734232806174352604e+00, 6.513545081693225214e+00, 6.513545081693225214e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.640000000000000000e+03, 2.766695930261447778e+00, 9.162456945817023524e+00, 9.162456945817023524e+00, 0},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 6.680000000000000000e+02, 2.799159054348542952e+00, 5.818911973990820385e+00, 5.818911973990820385e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.730000000000000000e+02, 2.831622178435637238e+00, 1.568964411202888876e+01, 1.568964411202888876e+01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 3.730000000000000000e+02, 2.831622178435637238e+00, 1.568964411202888876e+01, 1.568964411202888876e+01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 8.550000000000000000e+02, 2.864085302522731524e+00, 8.026780748449123593e+00, 8.026780748449123593e+00, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.081000000000000000e+03, 2.896548426609826699e+00, 4.316175512044652662e-01, 4.316175512044652662e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.081000000000000000e+03, 2.896548426609826699e+00, 4.316175512044652662e-01, 4.316175512044652662e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.204000000000000000e+03, 2.929011550696921873e+00, 4.566532994949706215e+00, 4.566532994949706215e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.664000000000000000e+03, 2.961474674784016159e+00, 3.925700480214331378e+01, 3.925700480214331378e+01, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.620000000000000000e+02, 2.993937798871110445e+00, 3.104568117350024359e+00, 3.104568117350024359e+00, 0},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.400000000000000000e+02, 3.026400922958205619e+00, 1.358852889112938334e+00, 1.358852889112938334e+00, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 9.620000000000000000e+02, 2.993937798871110445e+00, 3.104568117350024359e+00, 3.104568117350024359e+00, 1},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.400000000000000000e+02, 3.026400922958205619e+00, 1.358852889112938334e+00, 1.358852889112938334e+00, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.400000000000000000e+03, 3.058864047045300794e+00, 1.154700538379251640e+02, 1.154700538379251640e+02, 1},
-	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.990000000000000000e+02, 3.091327171132395080e+00, 5.982547447331441060e-01, 5.982547447331441060e-01, 0},
+	{3.261881164321184201e+01, -9.649269941431950315e+01, 5.990000000000000000e+02, 3.091327171132395080e+00, 5.982547447331441060e-01, 5.982547447331441060e-01, 1},
 	{3.261881164321184201e+01, -9.649269941431950315e+01, 1.876000000000000000e+03, 3.123790295219489366e+00, 1.141952990630566767e+01, 1.141952990630566767e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.050000000000000000e+02, -3.141592653589793116e+00, 4.995863127948433902e-01, 4.995863127948433902e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.407000000000000000e+03, -3.109129529502698386e+00, 3.197693999365831541e+00, 3.197693999365831541e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.390000000000000000e+02, -3.076666405415603656e+00, 8.815264538792293436e+00, 8.815264538792293436e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.870000000000000000e+02, -3.044203281328508925e+00, 1.242280064207872847e+00, 1.242280064207872847e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.900000000000000000e+02, -3.011740157241414195e+00, 4.091117805436453381e+01, 4.091117805436453381e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.050000000000000000e+02, -3.141592653589793116e+00, 4.995863127948433902e-01, 4.995863127948433902e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.407000000000000000e+03, -3.109129529502698386e+00, 3.197693999365831541e+00, 3.197693999365831541e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.390000000000000000e+02, -3.076666405415603656e+00, 8.815264538792293436e+00, 8.815264538792293436e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.870000000000000000e+02, -3.044203281328508925e+00, 1.242280064207872847e+00, 1.242280064207872847e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.900000000000000000e+02, -3.011740157241414195e+00, 4.091117805436453381e+01, 4.091117805436453381e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.952000000000000000e+03, -2.979277033154319465e+00, 1.121942759482655418e+02, 1.121942759482655418e+02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.140000000000000000e+02, -2.946813909067224735e+00, 1.077284939362577187e+00, 1.077284939362577187e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.140000000000000000e+02, -2.946813909067224735e+00, 1.077284939362577187e+00, 1.077284939362577187e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 9.260000000000000000e+02, -2.914350784980130005e+00, 5.232590180780452016e+01, 5.232590180780452016e+01, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.820000000000000000e+02, -2.881887660893035275e+00, 9.803616051027049139e+00, 9.803616051027049139e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.680000000000000000e+02, -2.849424536805940544e+00, 1.522999221017179217e+00, 1.522999221017179217e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.820000000000000000e+02, -2.881887660893035275e+00, 9.803616051027049139e+00, 9.803616051027049139e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.680000000000000000e+02, -2.849424536805940544e+00, 1.522999221017179217e+00, 1.522999221017179217e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.600000000000000000e+01, -2.816961412718845814e+00, 1.600119570572374972e+00, 1.600119570572374972e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.328000000000000000e+03, -2.784498288631751084e+00, 9.954121211553115245e-01, 9.954121211553115245e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.328000000000000000e+03, -2.784498288631751084e+00, 9.954121211553115245e-01, 9.954121211553115245e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.742000000000000000e+03, -2.752035164544656354e+00, 9.369164850721753979e+00, 9.369164850721753979e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.780000000000000000e+02, -2.719572040457561624e+00, 4.846462208132516492e-01, 4.846462208132516492e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.880000000000000000e+02, -2.687108916370466893e+00, 1.972455758046685048e+00, 1.972455758046685048e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.780000000000000000e+02, -2.719572040457561624e+00, 4.846462208132516492e-01, 4.846462208132516492e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.880000000000000000e+02, -2.687108916370466893e+00, 1.972455758046685048e+00, 1.972455758046685048e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.070000000000000000e+02, -2.654645792283372163e+00, 2.670169892766343533e+00, 2.670169892766343533e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.560000000000000000e+02, -2.622182668196277433e+00, 9.293403409880338639e-01, 9.293403409880338639e-01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.998000000000000000e+03, -2.589719544109182703e+00, 2.822770270496697975e+01, 2.822770270496697975e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.100000000000000000e+02, -2.557256420022087973e+00, 1.165416731955606089e+01, 1.165416731955606089e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.083000000000000000e+03, -2.524793295934993242e+00, 2.729761062255043891e-01, 2.729761062255043891e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.100000000000000000e+02, -2.557256420022087973e+00, 1.165416731955606089e+01, 1.165416731955606089e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.083000000000000000e+03, -2.524793295934993242e+00, 2.729761062255043891e-01, 2.729761062255043891e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.170000000000000000e+02, -2.492330171847898512e+00, 1.214737913983893858e+00, 1.214737913983893858e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.470000000000000000e+02, -2.459867047760803782e+00, 4.617407281148155107e+02, 4.617407281148155107e+02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.510000000000000000e+02, -2.427403923673709052e+00, 6.684019889531785941e-01, 6.684019889531785941e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.830000000000000000e+02, -2.394940799586614322e+00, 6.196172980905848560e-01, 6.196172980905848560e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.470000000000000000e+02, -2.459867047760803782e+00, 4.617407281148155107e+02, 4.617407281148155107e+02, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.510000000000000000e+02, -2.427403923673709052e+00, 6.684019889531785941e-01, 6.684019889531785941e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.830000000000000000e+02, -2.394940799586614322e+00, 6.196172980905848560e-01, 6.196172980905848560e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.580000000000000000e+02, -2.362477675499519592e+00, 1.206145360092915508e+00, 1.206145360092915508e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.620000000000000000e+02, -2.330014551412424861e+00, 9.318657223494144048e+00, 9.318657223494144048e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.630000000000000000e+02, -2.297551427325330131e+00, 8.985132719560095182e+00, 8.985132719560095182e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.620000000000000000e+02, -2.330014551412424861e+00, 9.318657223494144048e+00, 9.318657223494144048e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.630000000000000000e+02, -2.297551427325330131e+00, 8.985132719560095182e+00, 8.985132719560095182e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.060000000000000000e+02, -2.265088303238235401e+00, 1.024492914704517643e+00, 1.024492914704517643e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.320000000000000000e+02, -2.232625179151140671e+00, 5.142594772265800529e-01, 5.142594772265800529e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.190000000000000000e+02, -2.200162055064045941e+00, 6.652041571162335964e-01, 6.652041571162335964e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.520000000000000000e+02, -2.167698930976951210e+00, 4.407632269396146540e+01, 4.407632269396146540e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.218000000000000000e+03, -2.135235806889856480e+00, 3.402853825577645819e-01, 3.402853825577645819e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.690000000000000000e+02, -2.102772682802761750e+00, 7.530974661417699778e-01, 7.530974661417699778e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.240000000000000000e+02, -2.070309558715667020e+00, 7.684166177056123148e-01, 7.684166177056123148e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.780000000000000000e+02, -2.037846434628572290e+00, 1.128775962628066676e+00, 1.128775962628066676e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.054000000000000000e+03, -2.005383310541477559e+00, 1.631784879661263565e-01, 1.631784879661263565e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.034000000000000000e+03, -1.972920186454382829e+00, 5.565192259338568731e-02, 5.565192259338568731e-02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.670000000000000000e+02, -1.940457062367288099e+00, 1.369813834252079410e+01, 1.369813834252079410e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.960000000000000000e+02, -1.907993938280193369e+00, 2.535831215289687246e-01, 2.535831215289687246e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.320000000000000000e+02, -2.232625179151140671e+00, 5.142594772265800529e-01, 5.142594772265800529e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.190000000000000000e+02, -2.200162055064045941e+00, 6.652041571162335964e-01, 6.652041571162335964e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.520000000000000000e+02, -2.167698930976951210e+00, 4.407632269396146540e+01, 4.407632269396146540e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.218000000000000000e+03, -2.135235806889856480e+00, 3.402853825577645819e-01, 3.402853825577645819e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.690000000000000000e+02, -2.102772682802761750e+00, 7.530974661417699778e-01, 7.530974661417699778e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.240000000000000000e+02, -2.070309558715667020e+00, 7.684166177056123148e-01, 7.684166177056123148e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.780000000000000000e+02, -2.037846434628572290e+00, 1.128775962628066676e+00, 1.128775962628066676e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.054000000000000000e+03, -2.005383310541477559e+00, 1.631784879661263565e-01, 1.631784879661263565e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.034000000000000000e+03, -1.972920186454382829e+00, 5.565192259338568731e-02, 5.565192259338568731e-02, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.670000000000000000e+02, -1.940457062367288099e+00, 1.369813834252079410e+01, 1.369813834252079410e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.960000000000000000e+02, -1.907993938280193369e+00, 2.535831215289687246e-01, 2.535831215289687246e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.947000000000000000e+03, -1.875530814193098639e+00, 1.800080972536721946e+00, 1.800080972536721946e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.050000000000000000e+02, -1.843067690106003909e+00, 8.046387510053817360e-01, 8.046387510053817360e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.034000000000000000e+03, -1.810604566018909178e+00, 5.501517290696250617e-02, 5.501517290696250617e-02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.243000000000000000e+03, -1.778141441931814448e+00, 4.211444799713995879e-01, 4.211444799713995879e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.042000000000000000e+03, -1.745678317844719718e+00, 8.048369867163955582e-02, 8.048369867163955582e-02, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.050000000000000000e+02, -1.843067690106003909e+00, 8.046387510053817360e-01, 8.046387510053817360e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.034000000000000000e+03, -1.810604566018909178e+00, 5.501517290696250617e-02, 5.501517290696250617e-02, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.243000000000000000e+03, -1.778141441931814448e+00, 4.211444799713995879e-01, 4.211444799713995879e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.042000000000000000e+03, -1.745678317844719718e+00, 8.048369867163955582e-02, 8.048369867163955582e-02, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.490000000000000000e+02, -1.713215193757624988e+00, 3.069579148387845180e+00, 3.069579148387845180e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.320000000000000000e+03, -1.680752069670530258e+00, 1.528879526889832530e+00, 1.528879526889832530e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.320000000000000000e+03, -1.680752069670530258e+00, 1.528879526889832530e+00, 1.528879526889832530e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.971000000000000000e+03, -1.648288945583435527e+00, 5.492805476257101027e+00, 5.492805476257101027e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.180000000000000000e+02, -1.615825821496340797e+00, 1.417427684105760921e+00, 1.417427684105760921e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.090000000000000000e+02, -1.583362697409246067e+00, 1.816956989918476495e+01, 1.816956989918476495e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.090000000000000000e+02, -1.583362697409246067e+00, 1.816956989918476495e+01, 1.816956989918476495e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.843000000000000000e+03, -1.550899573322151337e+00, 1.862784426688311257e+01, 1.862784426688311257e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.821000000000000000e+03, -1.518436449235056607e+00, 1.612596298205987821e+01, 1.612596298205987821e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.620000000000000000e+02, -1.485973325147961877e+00, 2.255670631985086629e+02, 2.255670631985086629e+02, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.620000000000000000e+02, -1.485973325147961877e+00, 2.255670631985086629e+02, 2.255670631985086629e+02, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.830000000000000000e+02, -1.453510201060867146e+00, 1.891774485487890178e+00, 1.891774485487890178e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.850000000000000000e+02, -1.421047076973772416e+00, 1.297955015015847424e+00, 1.297955015015847424e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.633000000000000000e+03, -1.388583952886677686e+00, 4.069078113555314502e+01, 4.069078113555314502e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.856000000000000000e+03, -1.356120828799582956e+00, 1.592851064988643905e+01, 1.592851064988643905e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.000000000000000000e+02, -1.323657704712488226e+00, 1.607060866333062776e+00, 1.607060866333062776e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.000000000000000000e+02, -1.323657704712488226e+00, 1.607060866333062776e+00, 1.607060866333062776e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.959000000000000000e+03, -1.291194580625393495e+00, 3.390577015789495476e+02, 3.390577015789495476e+02, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.995000000000000000e+03, -1.258731456538298765e+00, 7.035712472806147844e+02, 7.035712472806147844e+02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.100000000000000000e+02, -1.226268332451204035e+00, 2.406127241537557637e+00, 2.406127241537557637e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.100000000000000000e+02, -1.226268332451204035e+00, 2.406127241537557637e+00, 2.406127241537557637e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.632000000000000000e+03, -1.193805208364109305e+00, 2.692117383794566443e+00, 2.692117383794566443e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 9.940000000000000000e+02, -1.161342084277014575e+00, 1.178511301977579195e-01, 1.178511301977579195e-01, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 9.640000000000000000e+02, -1.128878960189919844e+00, 6.089914861893711007e-02, 6.089914861893711007e-02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.210000000000000000e+02, -1.096415836102825114e+00, 2.531442276647840051e-01, 2.531442276647840051e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 9.640000000000000000e+02, -1.128878960189919844e+00, 6.089914861893711007e-02, 6.089914861893711007e-02, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.210000000000000000e+02, -1.096415836102825114e+00, 2.531442276647840051e-01, 2.531442276647840051e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.040000000000000000e+02, -1.063952712015730384e+00, 1.025240433195795609e+00, 1.025240433195795609e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.777000000000000000e+03, -1.031489587928635654e+00, 2.747109844909737220e+01, 2.747109844909737220e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.372000000000000000e+03, -9.990264638415409237e-01, 8.768124086713189058e+01, 8.768124086713189058e+01, 1},
@@ -1055,46 +1055,46 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.177000000000000000e+03, -9.016370915802567332e-01, 2.503158005400377917e+01, 2.503158005400377917e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.700000000000000000e+01, -8.691739674931620030e-01, 1.803319807886362813e+00, 1.803319807886362813e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.660000000000000000e+02, -8.367108434060672728e-01, 1.054967898943793614e+00, 1.054967898943793614e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.367000000000000000e+03, -8.042477193189725426e-01, 5.884539426200973145e-01, 5.884539426200973145e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.367000000000000000e+03, -8.042477193189725426e-01, 5.884539426200973145e-01, 5.884539426200973145e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.162000000000000000e+03, -7.717845952318778124e-01, 5.727564927611035195e+00, 5.727564927611035195e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.110000000000000000e+02, -7.393214711447830823e-01, 1.621823402198214970e+00, 1.621823402198214970e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.730000000000000000e+02, -7.068583470576883521e-01, 2.383634149483684350e+00, 2.383634149483684350e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.360000000000000000e+02, -6.743952229705936219e-01, 7.101678495033724170e-01, 7.101678495033724170e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.730000000000000000e+02, -7.068583470576883521e-01, 2.383634149483684350e+00, 2.383634149483684350e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.360000000000000000e+02, -6.743952229705936219e-01, 7.101678495033724170e-01, 7.101678495033724170e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.660000000000000000e+02, -6.419320988834988917e-01, 7.672108575874040604e+00, 7.672108575874040604e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.190000000000000000e+02, -6.094689747964041615e-01, 1.200544339362377499e+01, 1.200544339362377499e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.190000000000000000e+02, -6.094689747964041615e-01, 1.200544339362377499e+01, 1.200544339362377499e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.295000000000000000e+03, -5.770058507093094313e-01, 1.227038237941361665e+01, 1.227038237941361665e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.660000000000000000e+02, -5.445427266222147011e-01, 1.394928831977098227e+01, 1.394928831977098227e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.200000000000000000e+01, -5.120796025351199710e-01, 4.067943717649667335e+00, 4.067943717649667335e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.250000000000000000e+02, -4.796164784480252408e-01, 2.690080145818387081e+01, 2.690080145818387081e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.400000000000000000e+01, -4.471533543609305106e-01, 4.318065410445850461e+01, 4.318065410445850461e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.374000000000000000e+03, -4.146902302738357804e-01, 1.005543483512428837e+00, 1.005543483512428837e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.250000000000000000e+02, -4.796164784480252408e-01, 2.690080145818387081e+01, 2.690080145818387081e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.400000000000000000e+01, -4.471533543609305106e-01, 4.318065410445850461e+01, 4.318065410445850461e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.374000000000000000e+03, -4.146902302738357804e-01, 1.005543483512428837e+00, 1.005543483512428837e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.176000000000000000e+03, -3.822271061867410502e-01, 2.348128179034572938e+00, 2.348128179034572938e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.760000000000000000e+02, -3.497639820996463200e-01, 5.091168824543141902e+00, 5.091168824543141902e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.209000000000000000e+03, -3.173008580125515898e-01, 3.284118161510853895e-01, 3.284118161510853895e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.209000000000000000e+03, -3.173008580125515898e-01, 3.284118161510853895e-01, 3.284118161510853895e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.260000000000000000e+02, -2.848377339254568597e-01, 2.861315812243238721e+00, 2.861315812243238721e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 9.970000000000000000e+02, -2.523746098383621295e-01, 3.595458209423123275e-02, 3.595458209423123275e-02, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.242000000000000000e+03, -2.199114857512673993e-01, 2.900336288934652451e+00, 2.900336288934652451e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.759000000000000000e+03, -1.874483616641726691e-01, 1.219759197546794560e+01, 1.219759197546794560e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.933000000000000000e+03, -1.549852375770779389e-01, 1.385988711863547884e+00, 1.385988711863547884e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.060000000000000000e+02, -1.225221134899832087e-01, 2.202625304462625611e+00, 2.202625304462625611e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.479000000000000000e+03, -9.005898940288847854e-02, 7.283960176093683403e-01, 7.283960176093683403e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.479000000000000000e+03, -9.005898940288847854e-02, 7.283960176093683403e-01, 7.283960176093683403e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.120000000000000000e+02, -5.759586531579374835e-02, 2.195492383544245474e+00, 2.195492383544245474e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.190000000000000000e+02, -2.513274122869901817e-02, 1.132656498591542515e+01, 1.132656498591542515e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.390000000000000000e+02, 7.330382858395712020e-03, 2.641396560812857564e-01, 2.641396560812857564e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.190000000000000000e+02, -2.513274122869901817e-02, 1.132656498591542515e+01, 1.132656498591542515e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.390000000000000000e+02, 7.330382858395712020e-03, 2.641396560812857564e-01, 2.641396560812857564e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.732000000000000000e+03, 3.979350694549044221e-02, 3.697158313061091661e+01, 3.697158313061091661e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.284000000000000000e+03, 7.225663103258517239e-02, 4.140584038288236957e-01, 4.140584038288236957e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.284000000000000000e+03, 7.225663103258517239e-02, 4.140584038288236957e-01, 4.140584038288236957e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.797000000000000000e+03, 1.047197551196799026e-01, 2.561655020934901827e+01, 2.561655020934901827e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.901000000000000000e+03, 1.371828792067746328e-01, 1.557709559533201338e+00, 1.557709559533201338e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.708000000000000000e+03, 1.696460032938693629e-01, 9.816305903530894383e+00, 9.816305903530894383e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.000000000000000000e+02, 2.021091273809640931e-01, 3.616914481772621759e-01, 3.616914481772621759e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.020000000000000000e+02, 2.345722514680588233e-01, 1.763838581959776519e+01, 1.763838581959776519e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.000000000000000000e+02, 2.021091273809640931e-01, 3.616914481772621759e-01, 3.616914481772621759e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.020000000000000000e+02, 2.345722514680588233e-01, 1.763838581959776519e+01, 1.763838581959776519e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.649000000000000000e+03, 2.670353755551535535e-01, 5.883491038334223155e+00, 5.883491038334223155e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.910000000000000000e+03, 2.994984996422482837e-01, 2.726555808812535009e+00, 2.726555808812535009e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.545000000000000000e+03, 3.319616237293430139e-01, 1.376332841952387298e+01, 1.376332841952387298e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.724000000000000000e+03, 3.644247478164377441e-01, 1.248647096534293688e+01, 1.248647096534293688e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.313000000000000000e+03, 3.968878719035324742e-01, 8.227673699308155619e-01, 8.227673699308155619e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.000000000000000000e+02, 4.293509959906272044e-01, 1.596692731711559077e+01, 1.596692731711559077e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.328000000000000000e+03, 4.618141200777219346e-01, 4.503515033576457882e-01, 4.503515033576457882e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.313000000000000000e+03, 3.968878719035324742e-01, 8.227673699308155619e-01, 8.227673699308155619e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.000000000000000000e+02, 4.293509959906272044e-01, 1.596692731711559077e+01, 1.596692731711559077e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.328000000000000000e+03, 4.618141200777219346e-01, 4.503515033576457882e-01, 4.503515033576457882e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.327000000000000000e+03, 4.942772441648166648e-01, 7.973238532689691738e+00, 7.973238532689691738e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.105000000000000000e+03, 5.267403682519113950e-01, 1.258410373298092910e+00, 1.258410373298092910e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.964000000000000000e+03, 5.592034923390061252e-01, 2.487777142568729172e+00, 2.487777142568729172e+00, 0},
@@ -1103,183 +1103,183 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 9.250000000000000000e+02, 6.565928646002903157e-01, 3.535533905932737753e+00, 3.535533905932737753e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.860000000000000000e+02, 6.890559886873850459e-01, 7.511480339940141970e-01, 7.511480339940141970e-01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.386000000000000000e+03, 7.215191127744797761e-01, 4.873986027464416892e+00, 4.873986027464416892e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.810000000000000000e+02, 7.539822368615745063e-01, 4.885059466241448156e-01, 4.885059466241448156e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.810000000000000000e+02, 7.539822368615745063e-01, 4.885059466241448156e-01, 4.885059466241448156e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.320000000000000000e+02, 7.864453609486692365e-01, 1.493354467323414259e+00, 1.493354467323414259e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.458000000000000000e+03, 8.189084850357639667e-01, 5.997313070063680307e+00, 5.997313070063680307e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.370000000000000000e+02, 8.513716091228586968e-01, 4.666904755831213336e+00, 4.666904755831213336e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.860000000000000000e+02, 8.838347332099534270e-01, 2.795791427152964914e+01, 2.795791427152964914e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.860000000000000000e+02, 8.838347332099534270e-01, 2.795791427152964914e+01, 2.795791427152964914e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.621000000000000000e+03, 9.162978572970477131e-01, 1.016465997955662059e+00, 1.016465997955662059e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.710000000000000000e+02, 9.487609813841428874e-01, 2.739889219826047162e-01, 2.739889219826047162e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.090000000000000000e+02, 9.812241054712380617e-01, 6.847917742851968859e-01, 6.847917742851968859e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.710000000000000000e+02, 9.487609813841428874e-01, 2.739889219826047162e-01, 2.739889219826047162e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.090000000000000000e+02, 9.812241054712380617e-01, 6.847917742851968859e-01, 6.847917742851968859e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.083000000000000000e+03, 1.013687229558332348e+00, 8.384266119783349680e+00, 8.384266119783349680e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.880000000000000000e+02, 1.046150353645426634e+00, 1.461041826027833279e+00, 1.461041826027833279e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.320000000000000000e+02, 1.078613477732521808e+00, 1.749434554935606556e+01, 1.749434554935606556e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.880000000000000000e+02, 1.046150353645426634e+00, 1.461041826027833279e+00, 1.461041826027833279e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.320000000000000000e+02, 1.078613477732521808e+00, 1.749434554935606556e+01, 1.749434554935606556e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.140000000000000000e+02, 1.111076601819616982e+00, 9.043523569912160553e+00, 9.043523569912160553e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.360000000000000000e+02, 1.143539725906711269e+00, 2.873561600141075978e+00, 2.873561600141075978e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.750000000000000000e+02, 1.176002849993805555e+00, 1.535166038102372710e+01, 1.535166038102372710e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.013000000000000000e+03, 1.208465974080900729e+00, 6.087674275115972228e-02, 6.087674275115972228e-02, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.750000000000000000e+02, 1.176002849993805555e+00, 1.535166038102372710e+01, 1.535166038102372710e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.013000000000000000e+03, 1.208465974080900729e+00, 6.087674275115972228e-02, 6.087674275115972228e-02, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.996000000000000000e+03, 1.240929098167995903e+00, 1.547864514421541493e+00, 1.547864514421541493e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.093000000000000000e+03, 1.273392222255090189e+00, 1.596139093455070934e-01, 1.596139093455070934e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.093000000000000000e+03, 1.273392222255090189e+00, 1.596139093455070934e-01, 1.596139093455070934e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.812000000000000000e+03, 1.305855346342184475e+00, 1.125824914359758111e+01, 1.125824914359758111e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.750000000000000000e+02, 1.338318470429279650e+00, 1.066477320802379669e+00, 1.066477320802379669e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.200000000000000000e+01, 1.370781594516374824e+00, 2.207997948995413040e+01, 2.207997948995413040e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.200000000000000000e+01, 1.370781594516374824e+00, 2.207997948995413040e+01, 2.207997948995413040e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.400000000000000000e+01, 1.403244718603469110e+00, 2.500810083269797257e+00, 2.500810083269797257e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.170000000000000000e+02, 1.435707842690563396e+00, 8.004448763031717817e+00, 8.004448763031717817e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.190000000000000000e+02, 1.468170966777658570e+00, 1.605132393293462911e+01, 1.605132393293462911e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.190000000000000000e+02, 1.468170966777658570e+00, 1.605132393293462911e+01, 1.605132393293462911e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.009000000000000000e+03, 1.500634090864753745e+00, 1.060660171779821193e+00, 1.060660171779821193e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 8.560000000000000000e+02, 1.533097214951848031e+00, 3.394112549695427816e+01, 3.394112549695427816e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.664000000000000000e+03, 1.565560339038942317e+00, 2.041386533512467594e+01, 2.041386533512467594e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.630000000000000000e+02, 1.598023463126037491e+00, 2.502372331199059730e+01, 2.502372331199059730e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.440000000000000000e+02, 1.630486587213132665e+00, 1.630804828682487884e+00, 1.630804828682487884e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.630000000000000000e+02, 1.598023463126037491e+00, 2.502372331199059730e+01, 2.502372331199059730e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 7.440000000000000000e+02, 1.630486587213132665e+00, 1.630804828682487884e+00, 1.630804828682487884e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.836000000000000000e+03, 1.662949711300226951e+00, 1.316572982342881337e+00, 1.316572982342881337e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.720000000000000000e+02, 1.695412835387321238e+00, 1.159655121145937962e+01, 1.159655121145937962e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.799000000000000000e+03, 1.727875959474416412e+00, 2.344308374141292450e+00, 2.344308374141292450e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.900000000000000000e+02, 1.760339083561511586e+00, 1.188251064803840240e+00, 1.188251064803840240e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.600000000000000000e+02, 1.792802207648605872e+00, 2.048171366195516985e+00, 2.048171366195516985e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.040000000000000000e+02, 1.825265331735700158e+00, 2.111892253143822131e+02, 2.111892253143822131e+02, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.110000000000000000e+02, 1.857728455822795333e+00, 1.687512502340901888e+00, 1.687512502340901888e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.040000000000000000e+02, 1.825265331735700158e+00, 2.111892253143822131e+02, 2.111892253143822131e+02, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.110000000000000000e+02, 1.857728455822795333e+00, 1.687512502340901888e+00, 1.687512502340901888e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.150000000000000000e+02, 1.890191579909890507e+00, 6.858935777509510778e+00, 6.858935777509510778e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.053000000000000000e+03, 1.922654703996984793e+00, 1.367761292076168644e-01, 1.367761292076168644e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.053000000000000000e+03, 1.922654703996984793e+00, 1.367761292076168644e-01, 1.367761292076168644e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.630000000000000000e+02, 1.955117828084079079e+00, 1.261834619211829267e+00, 1.261834619211829267e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.090000000000000000e+02, 1.987580952171174253e+00, 3.471894295625948530e+02, 3.471894295625948530e+02, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.090000000000000000e+02, 2.020044076258269428e+00, 9.215958381464670168e+00, 9.215958381464670168e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.894000000000000000e+03, 2.052507200345363714e+00, 1.149369931601406236e+01, 1.149369931601406236e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.915000000000000000e+03, 2.084970324432458000e+00, 1.617506761964227380e+01, 1.617506761964227380e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.190000000000000000e+02, 2.117433448519553174e+00, 5.882263834761454202e-01, 5.882263834761454202e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.190000000000000000e+02, 2.117433448519553174e+00, 5.882263834761454202e-01, 5.882263834761454202e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.775000000000000000e+03, 2.149896572606648348e+00, 2.740038777097871616e+02, 2.740038777097871616e+02, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.607000000000000000e+03, 2.182359696693742634e+00, 1.089375167970137781e+00, 1.089375167970137781e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.860000000000000000e+03, 2.214822820780836921e+00, 1.372712938646570846e+00, 1.372712938646570846e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.580000000000000000e+02, 2.247285944867932095e+00, 1.215069203589944991e+01, 1.215069203589944991e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.580000000000000000e+02, 2.247285944867932095e+00, 1.215069203589944991e+01, 1.215069203589944991e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.682000000000000000e+03, 2.279749068955027269e+00, 9.801764731081817894e-01, 9.801764731081817894e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.290000000000000000e+02, 2.312212193042121555e+00, 7.269057710597707889e+00, 7.269057710597707889e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.540000000000000000e+02, 2.344675317129215841e+00, 5.818627756627309244e-01, 5.818627756627309244e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.660000000000000000e+02, 2.377138441216311016e+00, 2.680577525043548093e+01, 2.680577525043548093e+01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.290000000000000000e+02, 2.312212193042121555e+00, 7.269057710597707889e+00, 7.269057710597707889e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.540000000000000000e+02, 2.344675317129215841e+00, 5.818627756627309244e-01, 5.818627756627309244e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.660000000000000000e+02, 2.377138441216311016e+00, 2.680577525043548093e+01, 2.680577525043548093e+01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.918000000000000000e+03, 2.409601565303406190e+00, 1.838878258156517287e+00, 1.838878258156517287e+00, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 2.440000000000000000e+02, 2.442064689390500476e+00, 1.060660171779821193e+00, 1.060660171779821193e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.380000000000000000e+02, 2.474527813477594762e+00, 1.602395205753385898e+00, 1.602395205753385898e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.310000000000000000e+02, 2.506990937564689936e+00, 8.560505499896713388e+00, 8.560505499896713388e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.380000000000000000e+02, 2.474527813477594762e+00, 1.602395205753385898e+00, 1.602395205753385898e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.310000000000000000e+02, 2.506990937564689936e+00, 8.560505499896713388e+00, 8.560505499896713388e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.700000000000000000e+01, 2.539454061651785111e+00, 1.462817354428046279e+00, 1.462817354428046279e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.250000000000000000e+02, 2.571917185738879397e+00, 1.289992100813296183e+01, 1.289992100813296183e+01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.460000000000000000e+02, 2.604380309825973683e+00, 1.009517228486454643e+00, 1.009517228486454643e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.073000000000000000e+03, 2.636843433913068857e+00, 1.192119977520045560e-01, 1.192119977520045560e-01, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.250000000000000000e+02, 2.571917185738879397e+00, 1.289992100813296183e+01, 1.289992100813296183e+01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 5.460000000000000000e+02, 2.604380309825973683e+00, 1.009517228486454643e+00, 1.009517228486454643e+00, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.073000000000000000e+03, 2.636843433913068857e+00, 1.192119977520045560e-01, 1.192119977520045560e-01, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.662000000000000000e+03, 2.669306558000164031e+00, 8.700830653261979464e-01, 8.700830653261979464e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.380000000000000000e+03, 2.701769682087258317e+00, 6.011198587268189453e-01, 6.011198587268189453e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.232000000000000000e+03, 2.734232806174352604e+00, 6.509871953780913545e-01, 6.509871953780913545e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.259000000000000000e+03, 2.766695930261447778e+00, 2.474873734152916338e+00, 2.474873734152916338e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.380000000000000000e+03, 2.701769682087258317e+00, 6.011198587268189453e-01, 6.011198587268189453e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.232000000000000000e+03, 2.734232806174352604e+00, 6.509871953780913545e-01, 6.509871953780913545e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.259000000000000000e+03, 2.766695930261447778e+00, 2.474873734152916338e+00, 2.474873734152916338e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.810000000000000000e+03, 2.799159054348542952e+00, 1.789864039878448443e+00, 1.789864039878448443e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.330000000000000000e+02, 2.831622178435637238e+00, 8.018590898655448385e+00, 8.018590898655448385e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.330000000000000000e+02, 2.831622178435637238e+00, 8.018590898655448385e+00, 8.018590898655448385e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.460000000000000000e+02, 2.864085302522731524e+00, 5.441647837826909750e+00, 5.441647837826909750e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1, 2.896548426609826699e+00, 2.147111472356720174e+00, 2.147111472356720174e+00, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.900000000000000000e+01, 2.929011550696921873e+00, 8.711918163080412114e+00, 8.711918163080412114e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 3.900000000000000000e+01, 2.929011550696921873e+00, 8.711918163080412114e+00, 8.711918163080412114e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.463000000000000000e+03, 2.961474674784016159e+00, 7.613731155566779485e+00, 7.613731155566779485e+00, 1},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.367000000000000000e+03, 2.993937798871110445e+00, 9.042097167089301335e-01, 9.042097167089301335e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.840000000000000000e+02, 3.026400922958205619e+00, 4.084931313618812010e-01, 4.084931313618812010e-01, 0},
-	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.810000000000000000e+02, 3.058864047045300794e+00, 6.327386541996865787e+00, 6.327386541996865787e+00, 0},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.367000000000000000e+03, 2.993937798871110445e+00, 9.042097167089301335e-01, 9.042097167089301335e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 6.840000000000000000e+02, 3.026400922958205619e+00, 4.084931313618812010e-01, 4.084931313618812010e-01, 1},
+	{3.261701300000000003e+01, -9.649056400000000622e+01, 4.810000000000000000e+02, 3.058864047045300794e+00, 6.327386541996865787e+00, 6.327386541996865787e+00, 1},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.618000000000000000e+03, 3.091327171132395080e+00, 1.213866641036906557e+01, 1.213866641036906557e+01, 0},
 	{3.261701300000000003e+01, -9.649056400000000622e+01, 1.979000000000000000e+03, 3.123790295219489366e+00, 9.889393411166143721e+01, 9.889393411166143721e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.300000000000000000e+02, -3.141592653589793116e+00, 4.496092053105674502e+00, 4.496092053105674502e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.210000000000000000e+02, -3.109129529502698386e+00, 3.563912967143428201e+00, 3.563912967143428201e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.210000000000000000e+02, -3.109129529502698386e+00, 3.563912967143428201e+00, 3.563912967143428201e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.020000000000000000e+03, -3.076666405415603656e+00, 1.606237840420901009e+00, 1.606237840420901009e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.218000000000000000e+03, -3.044203281328508925e+00, 4.374740361354296225e-01, 4.374740361354296225e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.520000000000000000e+02, -3.011740157241414195e+00, 4.240254768199785751e+00, 4.240254768199785751e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.760000000000000000e+02, -2.979277033154319465e+00, 4.646336532891946480e-01, 4.646336532891946480e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.218000000000000000e+03, -3.044203281328508925e+00, 4.374740361354296225e-01, 4.374740361354296225e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.520000000000000000e+02, -3.011740157241414195e+00, 4.240254768199785751e+00, 4.240254768199785751e+00, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.760000000000000000e+02, -2.979277033154319465e+00, 4.646336532891946480e-01, 4.646336532891946480e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.190000000000000000e+02, -2.946813909067224735e+00, 3.754779991033441622e+00, 3.754779991033441622e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.060000000000000000e+02, -2.914350784980130005e+00, 6.174917619692436688e+00, 6.174917619692436688e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.100000000000000000e+02, -2.881887660893035275e+00, 1.144521495717635950e+00, 1.144521495717635950e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.175000000000000000e+03, -2.849424536805940544e+00, 6.893978946285640452e-01, 6.893978946285640452e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.680000000000000000e+02, -2.816961412718845814e+00, 1.598151898323330045e+00, 1.598151898323330045e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.175000000000000000e+03, -2.849424536805940544e+00, 6.893978946285640452e-01, 6.893978946285640452e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.680000000000000000e+02, -2.816961412718845814e+00, 1.598151898323330045e+00, 1.598151898323330045e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.352000000000000000e+03, -2.784498288631751084e+00, 6.696285290098574094e+00, 6.696285290098574094e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.724000000000000000e+03, -2.752035164544656354e+00, 5.180135133372486962e+02, 5.180135133372486962e+02, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.616000000000000000e+03, -2.719572040457561624e+00, 1.924756631560790510e+01, 1.924756631560790510e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.827000000000000000e+03, -2.687108916370466893e+00, 1.053744689143418345e+00, 1.053744689143418345e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.821000000000000000e+03, -2.654645792283372163e+00, 3.067502137713169930e+00, 3.067502137713169930e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.320000000000000000e+03, -2.622182668196277433e+00, 6.443206889358540357e-01, 6.443206889358540357e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.320000000000000000e+03, -2.622182668196277433e+00, 6.443206889358540357e-01, 6.443206889358540357e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.580000000000000000e+03, -2.589719544109182703e+00, 9.492548186571411861e+00, 9.492548186571411861e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.906000000000000000e+03, -2.557256420022087973e+00, 1.290996514325271072e+01, 1.290996514325271072e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.766000000000000000e+03, -2.524793295934993242e+00, 1.563951040519765634e+01, 1.563951040519765634e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.689000000000000000e+03, -2.492330171847898512e+00, 9.089671161920707121e-01, 9.089671161920707121e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.400000000000000000e+01, -2.459867047760803782e+00, 6.123440938362990948e+01, 6.123440938362990948e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.400000000000000000e+01, -2.459867047760803782e+00, 6.123440938362990948e+01, 6.123440938362990948e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.200000000000000000e+01, -2.427403923673709052e+00, 1.544909759244862402e+00, 1.544909759244862402e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.287000000000000000e+03, -2.394940799586614322e+00, 1.432859394953451382e+00, 1.432859394953451382e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.400000000000000000e+01, -2.362477675499519592e+00, 4.443712161895477664e+01, 4.443712161895477664e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.550000000000000000e+02, -2.330014551412424861e+00, 3.774637719015758730e-01, 3.774637719015758730e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.309000000000000000e+03, -2.297551427325330131e+00, 1.144623443979868815e+00, 1.144623443979868815e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.287000000000000000e+03, -2.394940799586614322e+00, 1.432859394953451382e+00, 1.432859394953451382e+00, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.400000000000000000e+01, -2.362477675499519592e+00, 4.443712161895477664e+01, 4.443712161895477664e+01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.550000000000000000e+02, -2.330014551412424861e+00, 3.774637719015758730e-01, 3.774637719015758730e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.309000000000000000e+03, -2.297551427325330131e+00, 1.144623443979868815e+00, 1.144623443979868815e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.160000000000000000e+02, -2.265088303238235401e+00, 1.660148991674003938e+01, 1.660148991674003938e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.550000000000000000e+02, -2.232625179151140671e+00, 2.663134460790517632e+00, 2.663134460790517632e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.960000000000000000e+03, -2.200162055064045941e+00, 2.255480411687404096e+00, 2.255480411687404096e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.101000000000000000e+03, -2.167698930976951210e+00, 1.283599100647490054e+00, 1.283599100647490054e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.101000000000000000e+03, -2.167698930976951210e+00, 1.283599100647490054e+00, 1.283599100647490054e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.650000000000000000e+02, -2.135235806889856480e+00, 9.924642822603239267e+00, 9.924642822603239267e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.744000000000000000e+03, -2.102772682802761750e+00, 2.799970320380887756e+01, 2.799970320380887756e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.001000000000000000e+03, -2.070309558715667020e+00, 1.581202074372532529e+01, 1.581202074372532529e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.931000000000000000e+03, -2.037846434628572290e+00, 1.782382737818156260e+00, 1.782382737818156260e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.501000000000000000e+03, -2.005383310541477559e+00, 1.544572412816466178e+00, 1.544572412816466178e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.516000000000000000e+03, -1.972920186454382829e+00, 1.060606906114381687e+00, 1.060606906114381687e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.291000000000000000e+03, -1.940457062367288099e+00, 6.407922365113163377e-01, 6.407922365113163377e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.291000000000000000e+03, -1.940457062367288099e+00, 6.407922365113163377e-01, 6.407922365113163377e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.257000000000000000e+03, -1.907993938280193369e+00, 6.193060948049033065e+00, 6.193060948049033065e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.740000000000000000e+02, -1.875530814193098639e+00, 3.970446378487492378e+00, 3.970446378487492378e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.550000000000000000e+03, -1.843067690106003909e+00, 1.009828744681141366e+00, 1.009828744681141366e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.950000000000000000e+02, -1.810604566018909178e+00, 3.901261144511485868e-01, 3.901261144511485868e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.150000000000000000e+02, -1.778141441931814448e+00, 1.684577098265318185e+01, 1.684577098265318185e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.950000000000000000e+02, -1.810604566018909178e+00, 3.901261144511485868e-01, 3.901261144511485868e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.150000000000000000e+02, -1.778141441931814448e+00, 1.684577098265318185e+01, 1.684577098265318185e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.207000000000000000e+03, -1.745678317844719718e+00, 1.663565448066291097e+01, 1.663565448066291097e+01, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.100000000000000000e+01, -1.713215193757624988e+00, 1.497410621535875386e+01, 1.497410621535875386e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.100000000000000000e+01, -1.713215193757624988e+00, 1.497410621535875386e+01, 1.497410621535875386e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1, -1.680752069670530258e+00, 3.384808331005128679e+00, 3.384808331005128679e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.710000000000000000e+02, -1.648288945583435527e+00, 1.848432877213154413e+01, 1.848432877213154413e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.710000000000000000e+02, -1.648288945583435527e+00, 1.848432877213154413e+01, 1.848432877213154413e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.801000000000000000e+03, -1.615825821496340797e+00, 5.106100824014347062e+00, 5.106100824014347062e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.136000000000000000e+03, -1.583362697409246067e+00, 1.064025329294688627e+00, 1.064025329294688627e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.136000000000000000e+03, -1.583362697409246067e+00, 1.064025329294688627e+00, 1.064025329294688627e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.160000000000000000e+02, -1.550899573322151337e+00, 1.756260231286923812e+01, 1.756260231286923812e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.936000000000000000e+03, -1.518436449235056607e+00, 1.380034832886794183e+00, 1.380034832886794183e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.400000000000000000e+03, -1.485973325147961877e+00, 2.744705636558582018e+00, 2.744705636558582018e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.400000000000000000e+03, -1.485973325147961877e+00, 2.744705636558582018e+00, 2.744705636558582018e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.817000000000000000e+03, -1.453510201060867146e+00, 1.098098819688070549e+00, 1.098098819688070549e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.664000000000000000e+03, -1.421047076973772416e+00, 5.951601675179548323e+01, 5.951601675179548323e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.070000000000000000e+02, -1.388583952886677686e+00, 8.534037731343822486e+00, 8.534037731343822486e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.070000000000000000e+02, -1.388583952886677686e+00, 8.534037731343822486e+00, 8.534037731343822486e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.697000000000000000e+03, -1.356120828799582956e+00, 1.349064280860386988e+00, 1.349064280860386988e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.160000000000000000e+02, -1.323657704712488226e+00, 1.274090179353081176e+01, 1.274090179353081176e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.160000000000000000e+02, -1.323657704712488226e+00, 1.274090179353081176e+01, 1.274090179353081176e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.390000000000000000e+02, -1.291194580625393495e+00, 8.301863240072093753e-01, 8.301863240072093753e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.400000000000000000e+02, -1.258731456538298765e+00, 5.625860572543209814e-01, 5.625860572543209814e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.620000000000000000e+02, -1.226268332451204035e+00, 1.229592262447146478e+00, 1.229592262447146478e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.400000000000000000e+02, -1.258731456538298765e+00, 5.625860572543209814e-01, 5.625860572543209814e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.620000000000000000e+02, -1.226268332451204035e+00, 1.229592262447146478e+00, 1.229592262447146478e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.580000000000000000e+02, -1.193805208364109305e+00, 1.277967135727675796e+01, 1.277967135727675796e+01, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.036000000000000000e+03, -1.161342084277014575e+00, 1.694983656558866625e-01, 1.694983656558866625e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.036000000000000000e+03, -1.161342084277014575e+00, 1.694983656558866625e-01, 1.694983656558866625e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.962000000000000000e+03, -1.128878960189919844e+00, 4.201320880781101330e+00, 4.201320880781101330e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.660000000000000000e+02, -1.096415836102825114e+00, 7.335175526188858264e+00, 7.335175526188858264e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.650000000000000000e+02, -1.063952712015730384e+00, 2.044640691064215865e+00, 2.044640691064215865e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.650000000000000000e+02, -1.063952712015730384e+00, 2.044640691064215865e+00, 2.044640691064215865e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.870000000000000000e+02, -1.031489587928635654e+00, 3.037525720055716860e+00, 3.037525720055716860e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.050000000000000000e+02, -9.990264638415409237e-01, 7.715622002549675784e-01, 7.715622002549675784e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.450000000000000000e+02, -9.665633397544461936e-01, 1.021421088336021477e+01, 1.021421088336021477e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.050000000000000000e+02, -9.990264638415409237e-01, 7.715622002549675784e-01, 7.715622002549675784e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.450000000000000000e+02, -9.665633397544461936e-01, 1.021421088336021477e+01, 1.021421088336021477e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.322000000000000000e+03, -9.341002156673514634e-01, 9.640912819852692550e+00, 9.640912819852692550e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.982000000000000000e+03, -9.016370915802567332e-01, 4.159909486848904159e+00, 4.159909486848904159e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.470000000000000000e+02, -8.691739674931620030e-01, 2.181909523024881992e+01, 2.181909523024881992e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.260000000000000000e+03, -8.367108434060672728e-01, 5.266446341102500206e+00, 5.266446341102500206e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.689000000000000000e+03, -8.042477193189725426e-01, 8.674325906718705070e-01, 8.674325906718705070e-01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.270000000000000000e+02, -7.717845952318778124e-01, 3.307072924470162878e+00, 3.307072924470162878e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.780000000000000000e+02, -7.393214711447830823e-01, 6.274268765564174899e-01, 6.274268765564174899e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.780000000000000000e+02, -7.393214711447830823e-01, 6.274268765564174899e-01, 6.274268765564174899e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.755000000000000000e+03, -7.068583470576883521e-01, 1.948329998285850406e+00, 1.948329998285850406e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.739000000000000000e+03, -6.743952229705936219e-01, 9.034159732790900676e-01, 9.034159732790900676e-01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.040000000000000000e+02, -6.419320988834988917e-01, 1.139683092364016836e+01, 1.139683092364016836e+01, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.360000000000000000e+02, -6.094689747964041615e-01, 3.211667742557020944e+01, 3.211667742557020944e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.360000000000000000e+02, -6.094689747964041615e-01, 3.211667742557020944e+01, 3.211667742557020944e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.102000000000000000e+03, -5.770058507093094313e-01, 4.458917407223915497e+00, 4.458917407223915497e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.661000000000000000e+03, -5.445427266222147011e-01, 9.855226424285168374e-01, 9.855226424285168374e-01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.300000000000000000e+02, -5.120796025351199710e-01, 1.132812260238002633e+00, 1.132812260238002633e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.800000000000000000e+01, -4.796164784480252408e-01, 1.556398417198453465e+01, 1.556398417198453465e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.110000000000000000e+02, -4.471533543609305106e-01, 7.057980068307653454e+00, 7.057980068307653454e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.420000000000000000e+03, -4.146902302738357804e-01, 4.878209320834701046e+00, 4.878209320834701046e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.580000000000000000e+02, -3.822271061867410502e-01, 2.852963390869314608e+00, 2.852963390869314608e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.420000000000000000e+03, -4.146902302738357804e-01, 4.878209320834701046e+00, 4.878209320834701046e+00, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.580000000000000000e+02, -3.822271061867410502e-01, 2.852963390869314608e+00, 2.852963390869314608e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.770000000000000000e+02, -3.497639820996463200e-01, 1.546888004995836923e+02, 1.546888004995836923e+02, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.500000000000000000e+02, -3.173008580125515898e-01, 1.571733945162320512e-01, 1.571733945162320512e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.080000000000000000e+02, -2.848377339254568597e-01, 1.709209331867639348e-01, 1.709209331867639348e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.620000000000000000e+02, -2.523746098383621295e-01, 4.798174584031198719e+01, 4.798174584031198719e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.500000000000000000e+02, -3.173008580125515898e-01, 1.571733945162320512e-01, 1.571733945162320512e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.080000000000000000e+02, -2.848377339254568597e-01, 1.709209331867639348e-01, 1.709209331867639348e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.620000000000000000e+02, -2.523746098383621295e-01, 4.798174584031198719e+01, 4.798174584031198719e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.850000000000000000e+02, -2.199114857512673993e-01, 1.487572743652623597e+00, 1.487572743652623597e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.750000000000000000e+02, -1.874483616641726691e-01, 2.025231468252456146e+00, 2.025231468252456146e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.170000000000000000e+03, -1.549852375770779389e-01, 2.997394702070449668e+00, 2.997394702070449668e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.170000000000000000e+02, -1.225221134899832087e-01, 3.075849388110490357e-01, 3.075849388110490357e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.400000000000000000e+02, -9.005898940288847854e-02, 5.431850513407009373e+01, 5.431850513407009373e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.170000000000000000e+02, -1.225221134899832087e-01, 3.075849388110490357e-01, 3.075849388110490357e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.400000000000000000e+02, -9.005898940288847854e-02, 5.431850513407009373e+01, 5.431850513407009373e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.007000000000000000e+03, -5.759586531579374835e-02, 4.400652308549352298e+00, 4.400652308549352298e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.480000000000000000e+02, -2.513274122869901817e-02, 6.555597661875883775e-01, 6.555597661875883775e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.480000000000000000e+02, -2.513274122869901817e-02, 6.555597661875883775e-01, 6.555597661875883775e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.655000000000000000e+03, 7.330382858395712020e-03, 1.957723752644040971e+01, 1.957723752644040971e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.670000000000000000e+02, 3.979350694549044221e-02, 2.771504127346748003e+00, 2.771504127346748003e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.670000000000000000e+02, 3.979350694549044221e-02, 2.771504127346748003e+00, 2.771504127346748003e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.000000000000000000e+01, 7.225663103258517239e-02, 2.971350281483841016e+01, 2.971350281483841016e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.224000000000000000e+03, 1.047197551196799026e-01, 4.784470862248194067e-01, 4.784470862248194067e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.224000000000000000e+03, 1.047197551196799026e-01, 4.784470862248194067e-01, 4.784470862248194067e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.300000000000000000e+02, 1.371828792067746328e-01, 1.554490948116361348e+00, 1.554490948116361348e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.059000000000000000e+03, 1.696460032938693629e-01, 7.575389551706083191e-01, 7.575389551706083191e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.059000000000000000e+03, 1.696460032938693629e-01, 7.575389551706083191e-01, 7.575389551706083191e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.915000000000000000e+03, 2.021091273809640931e-01, 2.450431482343054856e+00, 2.450431482343054856e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.884000000000000000e+03, 2.345722514680588233e-01, 7.326301182799713985e+00, 7.326301182799713985e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.281000000000000000e+03, 2.670353755551535535e-01, 3.687015652706886026e+00, 3.687015652706886026e+00, 1},
@@ -1288,89 +1288,89 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.629000000000000000e+03, 3.644247478164377441e-01, 9.611524036075733690e+00, 9.611524036075733690e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.920000000000000000e+03, 3.968878719035324742e-01, 4.680888194105290268e+01, 4.680888194105290268e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.586000000000000000e+03, 4.293509959906272044e-01, 2.197077248869506505e+00, 2.197077248869506505e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.350000000000000000e+02, 4.618141200777219346e-01, 8.821259693550493886e-01, 8.821259693550493886e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.350000000000000000e+02, 4.618141200777219346e-01, 8.821259693550493886e-01, 8.821259693550493886e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.860000000000000000e+02, 4.942772441648166648e-01, 9.642007888750946387e-01, 9.642007888750946387e-01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.654000000000000000e+03, 5.267403682519113950e-01, 7.951808309207613057e+00, 7.951808309207613057e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.972000000000000000e+03, 5.592034923390061252e-01, 1.773947632770843885e+00, 1.773947632770843885e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.270000000000000000e+02, 5.916666164261008554e-01, 5.489507745769079960e+00, 5.489507745769079960e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.900000000000000000e+01, 6.241297405131955855e-01, 4.607580710090708465e+00, 4.607580710090708465e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.000000000000000000e+02, 6.565928646002903157e-01, 6.000685831859129404e-01, 6.000685831859129404e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.000000000000000000e+02, 6.565928646002903157e-01, 6.000685831859129404e-01, 6.000685831859129404e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.166000000000000000e+03, 6.890559886873850459e-01, 2.358671942711265146e+01, 2.358671942711265146e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.968000000000000000e+03, 7.215191127744797761e-01, 1.565976710507292147e+01, 1.565976710507292147e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.890000000000000000e+02, 7.539822368615745063e-01, 1.673232437566118946e+00, 1.673232437566118946e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.890000000000000000e+02, 7.539822368615745063e-01, 1.673232437566118946e+00, 1.673232437566118946e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.217000000000000000e+03, 7.864453609486692365e-01, 3.319439114594957996e+00, 3.319439114594957996e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.700000000000000000e+01, 8.189084850357639667e-01, 2.238239635666088745e+01, 2.238239635666088745e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.049000000000000000e+03, 8.513716091228586968e-01, 1.233089698311373050e+00, 1.233089698311373050e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.049000000000000000e+03, 8.513716091228586968e-01, 1.233089698311373050e+00, 1.233089698311373050e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.920000000000000000e+02, 8.838347332099534270e-01, 3.994720058678168151e+00, 3.994720058678168151e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.700000000000000000e+03, 9.162978572970477131e-01, 1.601432720108899588e+00, 1.601432720108899588e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.995000000000000000e+03, 9.487609813841428874e-01, 2.219432415915904677e+00, 2.219432415915904677e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.620000000000000000e+02, 9.812241054712380617e-01, 2.399087292015599360e+01, 2.399087292015599360e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.620000000000000000e+02, 9.812241054712380617e-01, 2.399087292015599360e+01, 2.399087292015599360e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.000000000000000000e+00, 1.013687229558332348e+00, 1.365590450357100494e+01, 1.365590450357100494e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.969000000000000000e+03, 1.046150353645426634e+00, 1.815084722120831051e+00, 1.815084722120831051e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.459000000000000000e+03, 1.078613477732521808e+00, 1.265347131492867039e+00, 1.265347131492867039e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.459000000000000000e+03, 1.078613477732521808e+00, 1.265347131492867039e+00, 1.265347131492867039e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.500000000000000000e+01, 1.111076601819616982e+00, 4.345431828688349896e+01, 4.345431828688349896e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.494000000000000000e+03, 1.143539725906711269e+00, 9.183210819029778094e+00, 9.183210819029778094e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.260000000000000000e+02, 1.176002849993805555e+00, 6.942864602350854453e-01, 6.942864602350854453e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.260000000000000000e+02, 1.176002849993805555e+00, 6.942864602350854453e-01, 6.942864602350854453e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.521000000000000000e+03, 1.208465974080900729e+00, 1.752510368183169298e+00, 1.752510368183169298e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.420000000000000000e+02, 1.240929098167995903e+00, 4.866088255937152107e-01, 4.866088255937152107e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.420000000000000000e+02, 1.240929098167995903e+00, 4.866088255937152107e-01, 4.866088255937152107e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.180000000000000000e+02, 1.273392222255090189e+00, 1.259837454948021573e+00, 1.259837454948021573e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.850000000000000000e+02, 1.305855346342184475e+00, 6.269296843394426277e-01, 6.269296843394426277e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.850000000000000000e+02, 1.305855346342184475e+00, 6.269296843394426277e-01, 6.269296843394426277e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.920000000000000000e+02, 1.338318470429279650e+00, 1.373976892090984236e+01, 1.373976892090984236e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.787000000000000000e+03, 1.370781594516374824e+00, 2.443828305423565084e+01, 2.443828305423565084e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.850000000000000000e+02, 1.403244718603469110e+00, 1.218392913848815340e+01, 1.218392913848815340e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.850000000000000000e+02, 1.403244718603469110e+00, 1.218392913848815340e+01, 1.218392913848815340e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.910000000000000000e+03, 1.435707842690563396e+00, 1.473421553520975458e+01, 1.473421553520975458e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.053000000000000000e+03, 1.468170966777658570e+00, 1.939911295532286417e-01, 1.939911295532286417e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.154000000000000000e+03, 1.500634090864753745e+00, 5.902016182106789577e-01, 5.902016182106789577e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.053000000000000000e+03, 1.468170966777658570e+00, 1.939911295532286417e-01, 1.939911295532286417e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.154000000000000000e+03, 1.500634090864753745e+00, 5.902016182106789577e-01, 5.902016182106789577e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.643000000000000000e+03, 1.533097214951848031e+00, 9.634480237798974667e-01, 9.634480237798974667e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.390000000000000000e+02, 1.565560339038942317e+00, 4.722541312651922851e+01, 4.722541312651922851e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.390000000000000000e+02, 1.565560339038942317e+00, 4.722541312651922851e+01, 4.722541312651922851e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.170000000000000000e+02, 1.598023463126037491e+00, 1.362841837179133320e+00, 1.362841837179133320e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 5.970000000000000000e+02, 1.630486587213132665e+00, 3.285856334633614040e+01, 3.285856334633614040e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.018000000000000000e+03, 1.662949711300226951e+00, 3.481520212029148631e+00, 3.481520212029148631e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.890000000000000000e+02, 1.695412835387321238e+00, 8.612074086374557069e+00, 8.612074086374557069e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 3.890000000000000000e+02, 1.695412835387321238e+00, 8.612074086374557069e+00, 8.612074086374557069e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.211000000000000000e+03, 1.727875959474416412e+00, 8.886869769138558084e+00, 8.886869769138558084e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.550000000000000000e+02, 1.760339083561511586e+00, 1.072442380935824113e+00, 1.072442380935824113e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.910000000000000000e+02, 1.792802207648605872e+00, 1.289247750943785498e+01, 1.289247750943785498e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.894000000000000000e+03, 1.825265331735700158e+00, 9.954339113547419515e+00, 9.954339113547419515e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 8.500000000000000000e+01, 1.857728455822795333e+00, 2.536244257989309414e+00, 2.536244257989309414e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.486000000000000000e+03, 1.890191579909890507e+00, 1.533174425342896274e+00, 1.533174425342896274e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.486000000000000000e+03, 1.890191579909890507e+00, 1.533174425342896274e+00, 1.533174425342896274e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.684000000000000000e+03, 1.922654703996984793e+00, 2.450397926868205616e+02, 2.450397926868205616e+02, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.751000000000000000e+03, 1.955117828084079079e+00, 1.089025666261823178e+00, 1.089025666261823178e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.831000000000000000e+03, 1.987580952171174253e+00, 1.076043694914923687e+00, 1.076043694914923687e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.146000000000000000e+03, 2.020044076258269428e+00, 2.174427518232470435e-01, 2.174427518232470435e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.146000000000000000e+03, 2.020044076258269428e+00, 2.174427518232470435e-01, 2.174427518232470435e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.605000000000000000e+03, 2.052507200345363714e+00, 7.250718355216031341e+01, 7.250718355216031341e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.390000000000000000e+02, 2.084970324432458000e+00, 7.548797492278568333e-01, 7.548797492278568333e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.390000000000000000e+02, 2.084970324432458000e+00, 7.548797492278568333e-01, 7.548797492278568333e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.978000000000000000e+03, 2.117433448519553174e+00, 1.179753551796372513e+01, 1.179753551796372513e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.512000000000000000e+03, 2.149896572606648348e+00, 7.562649621955023882e+00, 7.562649621955023882e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.510000000000000000e+02, 2.182359696693742634e+00, 2.522986339527910182e+00, 2.522986339527910182e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.565000000000000000e+03, 2.214822820780836921e+00, 7.377938415831409857e-01, 7.377938415831409857e-01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.583000000000000000e+03, 2.247285944867932095e+00, 2.098776429255865423e+02, 2.098776429255865423e+02, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.012000000000000000e+03, 2.279749068955027269e+00, 2.252436417210676445e-01, 2.252436417210676445e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.012000000000000000e+03, 2.279749068955027269e+00, 2.252436417210676445e-01, 2.252436417210676445e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.663000000000000000e+03, 2.312212193042121555e+00, 2.916753725295790911e+00, 2.916753725295790911e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.154000000000000000e+03, 2.344675317129215841e+00, 2.803457686500725465e+00, 2.803457686500725465e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.502000000000000000e+03, 2.377138441216311016e+00, 2.424431204770856496e+01, 2.424431204770856496e+01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.930000000000000000e+02, 2.409601565303406190e+00, 7.452555449396317755e+00, 7.452555449396317755e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.770000000000000000e+02, 2.442064689390500476e+00, 4.739037614183972735e+00, 4.739037614183972735e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.710000000000000000e+02, 2.474527813477594762e+00, 3.017849595450048383e+00, 3.017849595450048383e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.610000000000000000e+02, 2.506990937564689936e+00, 3.398464879659086613e-01, 3.398464879659086613e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.450000000000000000e+02, 2.539454061651785111e+00, 4.448088783641857447e+01, 4.448088783641857447e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 7.610000000000000000e+02, 2.506990937564689936e+00, 3.398464879659086613e-01, 3.398464879659086613e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.450000000000000000e+02, 2.539454061651785111e+00, 4.448088783641857447e+01, 4.448088783641857447e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.648000000000000000e+03, 2.571917185738879397e+00, 4.894476506942117666e+00, 4.894476506942117666e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.700000000000000000e+01, 2.604380309825973683e+00, 1.706261869038478451e+01, 1.706261869038478451e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.700000000000000000e+01, 2.604380309825973683e+00, 1.706261869038478451e+01, 1.706261869038478451e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.796000000000000000e+03, 2.636843433913068857e+00, 1.765161223159078530e+00, 1.765161223159078530e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.670000000000000000e+02, 2.669306558000164031e+00, 1.948670381037573840e-01, 1.948670381037573840e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.100000000000000000e+01, 2.701769682087258317e+00, 1.620365421598859612e+01, 1.620365421598859612e+01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.670000000000000000e+02, 2.669306558000164031e+00, 1.948670381037573840e-01, 1.948670381037573840e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 2.100000000000000000e+01, 2.701769682087258317e+00, 1.620365421598859612e+01, 1.620365421598859612e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.810000000000000000e+02, 2.734232806174352604e+00, 4.051184299164527047e+00, 4.051184299164527047e+00, 1},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.350000000000000000e+02, 2.766695930261447778e+00, 6.457668579489117544e-01, 6.457668579489117544e-01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.160000000000000000e+02, 2.799159054348542952e+00, 5.065659749235142506e+00, 5.065659749235142506e+00, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 6.350000000000000000e+02, 2.766695930261447778e+00, 6.457668579489117544e-01, 6.457668579489117544e-01, 1},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 4.160000000000000000e+02, 2.799159054348542952e+00, 5.065659749235142506e+00, 5.065659749235142506e+00, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.341000000000000000e+03, 2.831622178435637238e+00, 1.103273184767418869e+01, 1.103273184767418869e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.855000000000000000e+03, 2.864085302522731524e+00, 2.154499285859778013e+00, 2.154499285859778013e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.600000000000000000e+02, 2.896548426609826699e+00, 2.171042791170226138e+00, 2.171042791170226138e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.531000000000000000e+03, 2.929011550696921873e+00, 9.135863520629767365e+00, 9.135863520629767365e+00, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.020000000000000000e+02, 2.961474674784016159e+00, 4.273515967789081049e-01, 4.273515967789081049e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 9.020000000000000000e+02, 2.961474674784016159e+00, 4.273515967789081049e-01, 4.273515967789081049e-01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.310000000000000000e+02, 2.993937798871110445e+00, 2.592219897795987382e+00, 2.592219897795987382e+00, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.296000000000000000e+03, 3.026400922958205619e+00, 2.796705651297611794e+01, 2.796705651297611794e+01, 1},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.782000000000000000e+03, 3.058864047045300794e+00, 9.451444050263695384e-01, 9.451444050263695384e-01, 0},
 	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.720000000000000000e+03, 3.091327171132395080e+00, 1.472052572264389170e+01, 1.472052572264389170e+01, 0},
-	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.263000000000000000e+03, 3.123790295219489366e+00, 5.001868340274644442e-01, 5.001868340274644442e-01, 0},
+	{3.261791232160592102e+01, -9.649003014642013909e+01, 1.263000000000000000e+03, 3.123790295219489366e+00, 5.001868340274644442e-01, 5.001868340274644442e-01, 1},
 	{1.135559575326857527e+02, -8.581349240253584298e+01, 2.790000000000000000e+02, -3.141592653589793116e+00, 2.462740099126627028e+05, 2.462740099126627028e+05, 0},
 	{1.135559575326857527e+02, -8.581349240253584298e+01, 9.240000000000000000e+02, -3.109129529502698386e+00, 3.701227883039516746e+04, 3.701227883039516746e+04, 0},
 	{1.135559575326857527e+02, -8.581349240253584298e+01, 1.132000000000000000e+03, -3.076666405415603656e+00, 4.001952648820712930e+05, 4.001952648820712930e+05, 0},
@@ -1596,19 +1596,19 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 9.310000000000000000e+02, -2.232625179151140671e+00, 1.014610266233758651e+01, 1.014610266233758651e+01, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.450000000000000000e+02, -2.200162055064045941e+00, 1.944198430197576544e+00, 1.944198430197576544e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.889000000000000000e+03, -2.167698930976951210e+00, 1.262593500680913827e+01, 1.262593500680913827e+01, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.600000000000000000e+01, -2.135235806889856480e+00, 2.350928821930865098e+01, 2.350928821930865098e+01, 0},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.600000000000000000e+01, -2.135235806889856480e+00, 2.350928821930865098e+01, 2.350928821930865098e+01, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.773000000000000000e+03, -2.102772682802761750e+00, 1.527964730713772701e+00, 1.527964730713772701e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.483000000000000000e+03, -2.070309558715667020e+00, 1.836475631995584124e+01, 1.836475631995584124e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.483000000000000000e+03, -2.070309558715667020e+00, 1.836475631995584124e+01, 1.836475631995584124e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.503000000000000000e+03, -2.037846434628572290e+00, 3.342732789201074866e+02, 3.342732789201074866e+02, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.310000000000000000e+02, -2.005383310541477559e+00, 2.444400579802860296e+00, 2.444400579802860296e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.710000000000000000e+02, -1.972920186454382829e+00, 1.942925872837638401e+00, 1.942925872837638401e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.552000000000000000e+03, -1.940457062367288099e+00, 2.102770617215973470e+00, 2.102770617215973470e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.843000000000000000e+03, -1.907993938280193369e+00, 5.592211202847906293e+00, 5.592211202847906293e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.700000000000000000e+02, -1.875530814193098639e+00, 9.932245748821060261e-01, 9.932245748821060261e-01, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 9.200000000000000000e+01, -1.843067690106003909e+00, 2.853228191209232634e+01, 2.853228191209232634e+01, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 4.170000000000000000e+02, -1.810604566018909178e+00, 3.685693310634432152e+01, 3.685693310634432152e+01, 0},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 9.200000000000000000e+01, -1.843067690106003909e+00, 2.853228191209232634e+01, 2.853228191209232634e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 4.170000000000000000e+02, -1.810604566018909178e+00, 3.685693310634432152e+01, 3.685693310634432152e+01, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 9.050000000000000000e+02, -1.778141441931814448e+00, 2.000192357631752849e+00, 2.000192357631752849e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 3.670000000000000000e+02, -1.745678317844719718e+00, 2.405536438209896346e+02, 2.405536438209896346e+02, 0},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 3.670000000000000000e+02, -1.745678317844719718e+00, 2.405536438209896346e+02, 2.405536438209896346e+02, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.965000000000000000e+03, -1.713215193757624988e+00, 3.532277521983465007e+00, 3.532277521983465007e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.808000000000000000e+03, -1.680752069670530258e+00, 3.351207286602512880e+01, 3.351207286602512880e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.162000000000000000e+03, -1.648288945583435527e+00, 2.012393462026044855e+00, 2.012393462026044855e+00, 0},
@@ -1618,10 +1618,10 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.961000000000000000e+03, -1.518436449235056607e+00, 5.896177669567897084e+01, 5.896177669567897084e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 8.160000000000000000e+02, -1.485973325147961877e+00, 3.416720538579988187e+01, 3.416720538579988187e+01, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.385000000000000000e+03, -1.453510201060867146e+00, 3.377108073963643875e+00, 3.377108073963643875e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.346000000000000000e+03, -1.421047076973772416e+00, 1.370424823742938614e+01, 1.370424823742938614e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.346000000000000000e+03, -1.421047076973772416e+00, 1.370424823742938614e+01, 1.370424823742938614e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.330000000000000000e+02, -1.388583952886677686e+00, 3.510214950190343330e+01, 3.510214950190343330e+01, 1},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.040000000000000000e+02, -1.356120828799582956e+00, 3.034365246469118205e+01, 3.034365246469118205e+01, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.223000000000000000e+03, -1.323657704712488226e+00, 2.798260311510538756e+01, 2.798260311510538756e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.040000000000000000e+02, -1.356120828799582956e+00, 3.034365246469118205e+01, 3.034365246469118205e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.223000000000000000e+03, -1.323657704712488226e+00, 2.798260311510538756e+01, 2.798260311510538756e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.040000000000000000e+02, -1.291194580625393495e+00, 1.270606110955191381e+00, 1.270606110955191381e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.370000000000000000e+02, -1.258731456538298765e+00, 3.655507456712510983e+00, 3.655507456712510983e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.879000000000000000e+03, -1.226268332451204035e+00, 3.113690509203768997e+00, 3.113690509203768997e+00, 0},
@@ -1630,10 +1630,10 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.498000000000000000e+03, -1.128878960189919844e+00, 1.862213221534218643e+00, 1.862213221534218643e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 8.160000000000000000e+02, -1.096415836102825114e+00, 3.209074538997779058e+00, 3.209074538997779058e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.070000000000000000e+02, -1.063952712015730384e+00, 1.545655190243571298e+01, 1.545655190243571298e+01, 1},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 4.090000000000000000e+02, -1.031489587928635654e+00, 7.329444547745226579e+00, 7.329444547745226579e+00, 0},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 4.090000000000000000e+02, -1.031489587928635654e+00, 7.329444547745226579e+00, 7.329444547745226579e+00, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 2.590000000000000000e+02, -9.990264638415409237e-01, 2.554159844593117956e+00, 2.554159844593117956e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.176000000000000000e+03, -9.665633397544461936e-01, 1.740545307205446868e+00, 1.740545307205446868e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 2.490000000000000000e+02, -9.341002156673514634e-01, 6.468140403375439007e+01, 6.468140403375439007e+01, 0},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 2.490000000000000000e+02, -9.341002156673514634e-01, 6.468140403375439007e+01, 6.468140403375439007e+01, 1},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 4.900000000000000000e+02, -9.016370915802567332e-01, 2.796637365758305549e+01, 2.796637365758305549e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 8.200000000000000000e+01, -8.691739674931620030e-01, 1.445109205315501466e+00, 1.445109205315501466e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.800000000000000000e+01, -8.367108434060672728e-01, 1.599796702645657209e+00, 1.599796702645657209e+00, 0},
@@ -1699,13 +1699,13 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.891000000000000000e+03, 1.111076601819616982e+00, 4.234945395161548554e+00, 4.234945395161548554e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.207000000000000000e+03, 1.143539725906711269e+00, 1.076796225795660922e+00, 1.076796225795660922e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.636000000000000000e+03, 1.176002849993805555e+00, 1.412067502404773967e+00, 1.412067502404773967e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 9.770000000000000000e+02, 1.208465974080900729e+00, 1.887722025205099996e+01, 1.887722025205099996e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 9.770000000000000000e+02, 1.208465974080900729e+00, 1.887722025205099996e+01, 1.887722025205099996e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.470000000000000000e+03, 1.240929098167995903e+00, 1.755159725377145596e+00, 1.755159725377145596e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.800000000000000000e+02, 1.273392222255090189e+00, 3.669181192718615137e+01, 3.669181192718615137e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.800000000000000000e+02, 1.273392222255090189e+00, 3.669181192718615137e+01, 3.669181192718615137e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.964000000000000000e+03, 1.305855346342184475e+00, 2.953525200690035035e+02, 2.953525200690035035e+02, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 5.510000000000000000e+02, 1.338318470429279650e+00, 1.475086669256481819e+01, 1.475086669256481819e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 5.510000000000000000e+02, 1.338318470429279650e+00, 1.475086669256481819e+01, 1.475086669256481819e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.650000000000000000e+02, 1.370781594516374824e+00, 1.514745198979896834e+01, 1.514745198979896834e+01, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.201000000000000000e+03, 1.403244718603469110e+00, 1.535928216019401837e+01, 1.535928216019401837e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.201000000000000000e+03, 1.403244718603469110e+00, 1.535928216019401837e+01, 1.535928216019401837e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.260000000000000000e+02, 1.435707842690563396e+00, 3.033060054527885629e+00, 3.033060054527885629e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.140000000000000000e+03, 1.468170966777658570e+00, 1.257491948638477464e+00, 1.257491948638477464e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 2.600000000000000000e+01, 1.500634090864753745e+00, 1.591980059612582465e+01, 1.591980059612582465e+01, 0},
@@ -1716,14 +1716,14 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.463000000000000000e+03, 1.662949711300226951e+00, 1.575753465453069158e+00, 1.575753465453069158e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.740000000000000000e+02, 1.695412835387321238e+00, 2.406451478459961546e+00, 2.406451478459961546e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.732000000000000000e+03, 1.727875959474416412e+00, 1.889279769775920048e+00, 1.889279769775920048e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.370000000000000000e+03, 1.760339083561511586e+00, 1.247236946213509299e+02, 1.247236946213509299e+02, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.370000000000000000e+03, 1.760339083561511586e+00, 1.247236946213509299e+02, 1.247236946213509299e+02, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 5.890000000000000000e+02, 1.792802207648605872e+00, 5.784779830378197651e+00, 5.784779830378197651e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.150000000000000000e+02, 1.825265331735700158e+00, 2.512568407028950901e+01, 2.512568407028950901e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.150000000000000000e+02, 1.825265331735700158e+00, 2.512568407028950901e+01, 2.512568407028950901e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.808000000000000000e+03, 1.857728455822795333e+00, 5.256795743690216405e+00, 5.256795743690216405e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.935000000000000000e+03, 1.890191579909890507e+00, 3.075550048931877445e+00, 3.075550048931877445e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 3.060000000000000000e+02, 1.922654703996984793e+00, 1.950984938666307844e+00, 1.950984938666307844e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 7.000000000000000000e+02, 1.955117828084079079e+00, 5.349775279756652679e+00, 5.349775279756652679e+00, 0},
-	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.550000000000000000e+02, 1.987580952171174253e+00, 2.465643932119964532e+01, 2.465643932119964532e+01, 1},
+	{3.261728279648177420e+01, -9.648202234272204691e+01, 6.550000000000000000e+02, 1.987580952171174253e+00, 2.465643932119964532e+01, 2.465643932119964532e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.176000000000000000e+03, 2.020044076258269428e+00, 6.818842203522515355e+00, 6.818842203522515355e+00, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.850000000000000000e+03, 2.052507200345363714e+00, 3.931672657612954680e+01, 3.931672657612954680e+01, 0},
 	{3.261728279648177420e+01, -9.648202234272204691e+01, 1.305000000000000000e+03, 2.084970324432458000e+00, 4.120913591177585822e+00, 4.120913591177585822e+00, 0},
@@ -1808,8 +1808,8 @@ traffic_data_s traffic_dataset[1940] = {
 	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.760000000000000000e+02, -1.648288945583435527e+00, 1.845897557150775299e+02, 1.845897557150775299e+02, 0},
 	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.760000000000000000e+02, -1.615825821496340797e+00, 9.144813585884573826e+00, 9.144813585884573826e+00, 0},
 	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.927000000000000000e+03, -1.583362697409246067e+00, 9.790121463883149033e+01, 9.790121463883149033e+01, 0},
-	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.085000000000000000e+03, -1.550899573322151337e+00, 1.414317950570564619e+02, 1.414317950570564619e+02, 1},
-	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.199000000000000000e+03, -1.518436449235056607e+00, 1.904518335106647555e+02, 1.904518335106647555e+02, 1},
+	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.085000000000000000e+03, -1.550899573322151337e+00, 1.414317950570564619e+02, 1.414317950570564619e+02, 0},
+	{3.261703997964817603e+01, -9.641582449881775574e+01, 1.199000000000000000e+03, -1.518436449235056607e+00, 1.904518335106647555e+02, 1.904518335106647555e+02, 0},
 	{3.261703997964817603e+01, -9.641582449881775574e+01, 2.370000000000000000e+02, -1.485973325147961877e+00, 1.310280282337541848e+02, 1.310280282337541848e+02, 0},
 	{3.261703997964817603e+01, -9.641582449881775574e+01, 8.650000000000000000e+02, -1.453510201060867146e+00, 1.650222779573176979e+02, 1.650222779573176979e+02, 0},
 	{3.261703997964817603e+01, -9.641582449881775574e+01, 5.840000000000000000e+02, -1.421047076973772416e+00, 1.549525270672642137e+02, 1.549525270672642137e+02, 0},
@@ -111,6 +111,13 @@ void Battery::updateTemperature(const float temperature_c)
 	_temperature_c = temperature_c;
 }
 
+void Battery::integrateCurrent(const hrt_abstime &timestamp, const float current_a)
+{
+	_current_a = current_a;
+	sumDischarged(timestamp, current_a);
+	_current_integrated = true;
+}
+
 void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 {
 	// Require minimum voltage otherwise override connected status
@@ -129,7 +136,13 @@ void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 		resetInternalResistanceEstimation(_voltage_v, _current_a);
 	}
 
-	sumDischarged(timestamp, _current_a);
+	if (!_current_integrated) {
+		sumDischarged(timestamp, _current_a);
+	}
+
+	_current_integrated = false;
+	_last_status_update = timestamp;
+
 	_state_of_charge_volt_based =
 		calculateStateOfChargeVoltageBased(_voltage_v, _current_a);
 
@@ -137,6 +150,8 @@ void Battery::updateBatteryStatus(const hrt_abstime &timestamp)
 		estimateStateOfCharge();
 	}
 
+	_discharged_mah_loop = 0.f;
+
 	computeScale();
 
 	if (_connected && _battery_initialized) {
@@ -203,8 +218,9 @@ void Battery::sumDischarged(const hrt_abstime &timestamp, float current_a)
 	if (_last_timestamp != 0) {
 		const float dt = (timestamp - _last_timestamp) / 1e6;
 		// mAh since last loop: (current[A] * 1000 = [mA]) * (dt[s] / 3600 = [h])
-		_discharged_mah_loop = (current_a * 1e3f) * (dt / 3600.f);
-		_discharged_mah += _discharged_mah_loop;
+		const float discharged_mah = (current_a * 1e3f) * (dt / 3600.f);
+		_discharged_mah_loop += discharged_mah;
+		_discharged_mah += discharged_mah;
 	}
 
 	_last_timestamp = timestamp;
@@ -93,6 +93,21 @@ public:
 	void updateCurrent(const float current_a);
 	void updateTemperature(const float temperature_c);
 
+	/**
+	 * Integrate a current sample into the discharged capacity without running the estimation.
+	 * For sources that sample faster than the battery status needs to be updated,
+	 * the next updateBatteryStatus() then uses the integrated capacity and the latest current.
+	 *
+	 * @param timestamp Time at which the current was measured
+	 * @param current_a Measured current, negative if invalid
+	 */
+	void integrateCurrent(const hrt_abstime &timestamp, const float current_a);
+
+	/**
+	 * Timestamp of the last updateBatteryStatus() call, 0 if there was none
+	 */
+	hrt_abstime lastStatusUpdate() const { return _last_status_update; }
+
 	/**
 	 * Update state of charge calculations
 	 *
@@ -171,7 +186,9 @@ private:
 	_current_average_filter_a; ///< averaging filter for current. For FW, it is the current in level flight.
 	float _temperature_c{NAN};
 	float _discharged_mah{0.f};
-	float _discharged_mah_loop{0.f};
+	float _discharged_mah_loop{0.f}; ///< discharged since the last state of charge estimation
+	bool _current_integrated{false}; ///< current already integrated by integrateCurrent() since the last update
+	hrt_abstime _last_status_update{0};
 	float _state_of_charge_volt_based{-1.f}; // [0,1]
 	float _state_of_charge{-1.f}; // [0,1]
 	float _scale{1.f};
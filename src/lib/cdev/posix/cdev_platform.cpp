@@ -185,7 +185,7 @@ extern "C" {
 		mode_t mode;
 
 		if (!dev && (flags & PX4_F_WRONLY) != 0 &&
-		    strncmp(path, "/obj/", 5) != 0 &&
+		    strncmp(path, "/obj", 4) != 0 &&
 		    strncmp(path, "/dev/", 5) != 0) {
 			va_list p;
 			va_start(p, flags);
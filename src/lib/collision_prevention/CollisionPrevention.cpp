@@ -56,6 +56,8 @@ CollisionPrevention::CollisionPrevention(ModuleParams *parent) :
 	for (uint32_t i = 0 ; i < BIN_COUNT; i++) {
 		_obstacle_map_body_frame.distances[i] = UINT16_MAX;
 	}
+
+	geometry::binDirections(_bin_cos, _bin_sin, BIN_COUNT, math::radians((float)BIN_SIZE));
 }
 
 hrt_abstime CollisionPrevention::getTime()
@@ -151,32 +153,48 @@ void CollisionPrevention::_updateObstacleMap()
 
 void CollisionPrevention::_updateObstacleData()
 {
-	_obstacle_data_present = false;
-	_closest_dist = UINT16_MAX;
-	_closest_dist_dir.setZero();
+	const hrt_abstime now = getTime();
 
 	for (int i = 0; i < BIN_COUNT; i++) {
 		// if the data is stale, reset the bin
-		if (getTime() - _data_timestamps[i] > RANGE_STREAM_TIMEOUT_US) {
+		if (now - _data_timestamps[i] > RANGE_STREAM_TIMEOUT_US && _obstacle_map_body_frame.distances[i] != UINT16_MAX) {
 			_obstacle_map_body_frame.distances[i] = UINT16_MAX;
+			_map_changed = true;
 		}
+	}
+
+	if (_map_changed || _constraint_min_distance != _obstacle_map_body_frame.min_distance) {
+		_updateConstraintBins();
+	}
+
+	// check if there is avaliable data and the data of the map is not stale
+	_obstacle_data_present = _map_has_data && (now - _obstacle_map_body_frame.timestamp) < RANGE_STREAM_TIMEOUT_US;
+
+	const float angle = _vehicle_yaw + math::radians(_obstacle_map_body_frame.angle_offset);
+	_closest_dist = _obstacle_map_body_frame.distances[_closest_bin] * 0.01f;
+	geometry::rotateDirection(_bin_cos[_closest_bin], _bin_sin[_closest_bin], cosf(angle), sinf(angle),
+				  _closest_dist_dir(0), _closest_dist_dir(1));
+}
 
-		float angle = wrap_2pi(_vehicle_yaw + math::radians((float)i * BIN_SIZE +
-				       _obstacle_map_body_frame.angle_offset));
-		const Vector2f bin_direction = {cosf(angle), sinf(angle)};
+void CollisionPrevention::_updateConstraintBins()
+{
+	_map_has_data = false;
+	_num_constraint_bins = 0;
+
+	for (int i = 0; i < BIN_COUNT; i++) {
 		const uint16_t bin_distance = _obstacle_map_body_frame.distances[i];
 
-		// check if there is avaliable data and the data of the map is not stale
-		if (bin_distance < UINT16_MAX
-		    && (getTime() - _obstacle_map_body_frame.timestamp) < RANGE_STREAM_TIMEOUT_US) {
-			_obstacle_data_present = true;
-		}
+		_map_has_data |= bin_distance < UINT16_MAX;
 
-		if (bin_distance * 0.01f < _closest_dist) {
-			_closest_dist = bin_distance * 0.01f;
-			_closest_dist_dir = bin_direction;
+		// only consider bins which are between min and max values
+		if (bin_distance > _obstacle_map_body_frame.min_distance && bin_distance < UINT16_MAX) {
+			_constraint_bins[_num_constraint_bins++] = i;
 		}
 	}
+
+	_closest_bin = geometry::minIndex(_obstacle_map_body_frame.distances, BIN_COUNT);
+	_constraint_min_distance = _obstacle_map_body_frame.min_distance;
+	_map_changed = false;
 }
 
 void CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint_accel, const Vector2f &setpoint_vel)
@@ -226,99 +244,80 @@ void CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint_accel
 // TODO this gives false output if the offset is not a multiple of the resolution. to be fixed...
 void CollisionPrevention::_addObstacleSensorData(const obstacle_distance_s &obstacle, const float vehicle_yaw)
 {
-
-	float vehicle_orientation_deg = math::degrees(vehicle_yaw);
-
+	// Obstacle message arrives in body frame (front aligned)
+	// corresponding data index (shift by msg offset)
+	float vehicle_orientation_deg = 0.f;
 
 	if (obstacle.frame == obstacle.MAV_FRAME_GLOBAL || obstacle.frame == obstacle.MAV_FRAME_LOCAL_NED) {
 		// Obstacle message arrives in local_origin frame (north aligned)
 		// corresponding data index (convert to world frame and shift by msg offset)
-		for (int i = 0; i < BIN_COUNT; i++) {
-			for (int j = 0; (j < 360 / obstacle.increment) && (j < BIN_COUNT); j++) {
-				float bin_lower_angle = _wrap_360((float)i * _obstacle_map_body_frame.increment + _obstacle_map_body_frame.angle_offset
-								  - (float)_obstacle_map_body_frame.increment / 2.f);
-				float bin_upper_angle = _wrap_360((float)i * _obstacle_map_body_frame.increment + _obstacle_map_body_frame.angle_offset
-								  + (float)_obstacle_map_body_frame.increment / 2.f);
-				float msg_lower_angle = _wrap_360((float)j * obstacle.increment + obstacle.angle_offset - vehicle_orientation_deg -
-								  obstacle.increment / 2.f);
-				float msg_upper_angle = _wrap_360((float)j * obstacle.increment + obstacle.angle_offset - vehicle_orientation_deg +
-								  obstacle.increment / 2.f);
-
-				// if a bin stretches over the 0/360 degree line, adjust the angles
-				if (bin_lower_angle > bin_upper_angle) {
-					bin_lower_angle -= 360;
-				}
+		vehicle_orientation_deg = math::degrees(vehicle_yaw);
 
-				if (msg_lower_angle > msg_upper_angle) {
-					msg_lower_angle -= 360;
-				}
+	} else if (obstacle.frame != obstacle.MAV_FRAME_BODY_FRD) {
+		mavlink_log_critical(&_mavlink_log_pub, "Obstacle message received in unsupported frame %i\t",
+				     obstacle.frame);
+		events::send<uint8_t>(events::ID("col_prev_unsup_frame"), events::Log::Error,
+				      "Obstacle message received in unsupported frame {1}", obstacle.frame);
+		return;
+	}
 
-				// Check for overlaps.
-				if ((msg_lower_angle > bin_lower_angle && msg_lower_angle < bin_upper_angle) ||
-				    (msg_upper_angle > bin_lower_angle && msg_upper_angle < bin_upper_angle) ||
-				    (msg_lower_angle <= bin_lower_angle && msg_upper_angle >= bin_upper_angle) ||
-				    (msg_lower_angle >= bin_lower_angle && msg_upper_angle <= bin_upper_angle)) {
-					if (obstacle.distances[j] != UINT16_MAX) {
-						if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[j] * 0.01f)) {
-							_obstacle_map_body_frame.distances[i] = obstacle.distances[j];
-							_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
-							_data_maxranges[i] = obstacle.max_distance;
-							_data_fov[i] = 1;
-						}
-					}
-				}
+	const float map_increment = _obstacle_map_body_frame.increment;
+	const int msg_bin_count = math::min((int)ceilf(360.f / obstacle.increment), BIN_COUNT);
 
-			}
+	// only visit the map bins a message bin can overlap with instead of the whole map
+	const int candidate_count = math::min((int)ceilf(obstacle.increment / map_increment) + 4, BIN_COUNT);
+
+	for (int j = 0; j < msg_bin_count; j++) {
+		if (obstacle.distances[j] == UINT16_MAX) {
+			continue;
 		}
 
-	} else if (obstacle.frame == obstacle.MAV_FRAME_BODY_FRD) {
-		// Obstacle message arrives in body frame (front aligned)
-		// corresponding data index (shift by msg offset)
-		for (int i = 0; i < BIN_COUNT; i++) {
-			for (int j = 0; j < 360 / obstacle.increment; j++) {
-				float bin_lower_angle = _wrap_360((float)i * _obstacle_map_body_frame.increment + _obstacle_map_body_frame.angle_offset
-								  - (float)_obstacle_map_body_frame.increment / 2.f);
-				float bin_upper_angle = _wrap_360((float)i * _obstacle_map_body_frame.increment + _obstacle_map_body_frame.angle_offset
-								  + (float)_obstacle_map_body_frame.increment / 2.f);
-				float msg_lower_angle = _wrap_360((float)j * obstacle.increment + obstacle.angle_offset - obstacle.increment / 2.f);
-				float msg_upper_angle = _wrap_360((float)j * obstacle.increment + obstacle.angle_offset + obstacle.increment / 2.f);
-
-				// if a bin stretches over the 0/360 degree line, adjust the angles
-				if (bin_lower_angle > bin_upper_angle) {
-					bin_lower_angle -= 360;
-				}
+		const float msg_angle = (float)j * obstacle.increment + obstacle.angle_offset - vehicle_orientation_deg;
+		float msg_lower_angle = _wrap_360(msg_angle - obstacle.increment / 2.f);
+		float msg_upper_angle = _wrap_360(msg_angle + obstacle.increment / 2.f);
 
-				if (msg_lower_angle > msg_upper_angle) {
-					msg_lower_angle -= 360;
-				}
+		// if a bin stretches over the 0/360 degree line, adjust the angles
+		if (msg_lower_angle > msg_upper_angle) {
+			msg_lower_angle -= 360;
+		}
 
-				// Check for overlaps.
-				if ((msg_lower_angle > bin_lower_angle && msg_lower_angle < bin_upper_angle) ||
-				    (msg_upper_angle > bin_lower_angle && msg_upper_angle < bin_upper_angle) ||
-				    (msg_lower_angle <= bin_lower_angle && msg_upper_angle >= bin_upper_angle) ||
-				    (msg_lower_angle >= bin_lower_angle && msg_upper_angle <= bin_upper_angle)) {
-					if (obstacle.distances[j] != UINT16_MAX) {
-
-						if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[j] * 0.01f)) {
-							_obstacle_map_body_frame.distances[i] = obstacle.distances[j];
-							_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
-							_data_maxranges[i] = obstacle.max_distance;
-							_data_fov[i] = 1;
-						}
-					}
-				}
+		const int first_bin = (int)floorf((msg_angle - obstacle.increment / 2.f - _obstacle_map_body_frame.angle_offset)
+						  / map_increment) - 1;
+
+		for (int k = 0; k < candidate_count; k++) {
+			const int i = _wrap_bin(first_bin + k);
+			float bin_lower_angle = _wrap_360((float)i * map_increment + _obstacle_map_body_frame.angle_offset
+							  - map_increment / 2.f);
+			float bin_upper_angle = _wrap_360((float)i * map_increment + _obstacle_map_body_frame.angle_offset
+							  + map_increment / 2.f);
 
+			if (bin_lower_angle > bin_upper_angle) {
+				bin_lower_angle -= 360;
 			}
-		}
 
-	} else {
-		mavlink_log_critical(&_mavlink_log_pub, "Obstacle message received in unsupported frame %i\t",
-				     obstacle.frame);
-		events::send<uint8_t>(events::ID("col_prev_unsup_frame"), events::Log::Error,
-				      "Obstacle message received in unsupported frame {1}", obstacle.frame);
+			// Check for overlaps.
+			if ((msg_lower_angle > bin_lower_angle && msg_lower_angle < bin_upper_angle) ||
+			    (msg_upper_angle > bin_lower_angle && msg_upper_angle < bin_upper_angle) ||
+			    (msg_lower_angle <= bin_lower_angle && msg_upper_angle >= bin_upper_angle) ||
+			    (msg_lower_angle >= bin_lower_angle && msg_upper_angle <= bin_upper_angle)) {
+
+				if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[j] * 0.01f)) {
+					_updateBin(i, obstacle.distances[j], obstacle.max_distance);
+				}
+			}
+		}
 	}
 }
 
+void CollisionPrevention::_updateBin(int bin, uint16_t distance, uint16_t max_range)
+{
+	_map_changed |= _obstacle_map_body_frame.distances[bin] != distance;
+	_obstacle_map_body_frame.distances[bin] = distance;
+	_data_timestamps[bin] = _obstacle_map_body_frame.timestamp;
+	_data_maxranges[bin] = max_range;
+	_data_fov[bin] = 1;
+}
+
 bool
 CollisionPrevention::_enterData(int map_index, float sensor_range, float sensor_reading)
 {
@@ -354,18 +353,13 @@ CollisionPrevention::_enterData(int map_index, float sensor_range, float sensor_
 bool
 CollisionPrevention::_checkSetpointDirectionFeasability()
 {
-	bool setpoint_feasible = true;
-
-	for (int i = 0; i < BIN_COUNT; i++) {
-		// check if our setpoint is either pointing in a direction where data exists, or if not, wether we are allowed to go where there is no data
-		if ((_obstacle_map_body_frame.distances[i] == UINT16_MAX && i == _setpoint_index) && (!_param_cp_go_no_data.get()
-				|| (_param_cp_go_no_data.get() && _data_fov[i]))) {
-			setpoint_feasible =  false;
-
-		}
+	if (_setpoint_index < 0 || _setpoint_index >= BIN_COUNT) {
+		return true;
 	}
 
-	return setpoint_feasible;
+	// check if our setpoint is either pointing in a direction where data exists, or if not, wether we are allowed to go where there is no data
+	return !(_obstacle_map_body_frame.distances[_setpoint_index] == UINT16_MAX
+		 && (!_param_cp_go_no_data.get() || _data_fov[_setpoint_index]));
 }
 
 void
@@ -416,10 +410,7 @@ CollisionPrevention::_addDistanceSensorData(distance_sensor_s &distance_sensor,
 			int wrapped_bin = _wrap_bin(bin);
 
 			if (_enterData(wrapped_bin, distance_sensor.max_distance, distance_reading)) {
-				_obstacle_map_body_frame.distances[wrapped_bin] = static_cast<uint16_t>(100.0f * distance_reading + 0.5f);
-				_data_timestamps[wrapped_bin] = _obstacle_map_body_frame.timestamp;
-				_data_maxranges[wrapped_bin] = sensor_range;
-				_data_fov[wrapped_bin] = 1;
+				_updateBin(wrapped_bin, static_cast<uint16_t>(100.0f * distance_reading + 0.5f), sensor_range);
 			}
 		}
 	}
@@ -575,48 +566,49 @@ void CollisionPrevention::_getVelocityCompensationAcceleration(const float vehic
 		const Vector2f &setpoint_vel,
 		const hrt_abstime now, float &vel_comp_accel, Vector2f &vel_comp_accel_dir)
 {
-	for (int i = 0; i < BIN_COUNT; i++) {
+	// rotate the precomputed bin directions instead of a cosf() and sinf() per bin
+	const float angle = vehicle_yaw_angle_rad + math::radians(_obstacle_map_body_frame.angle_offset);
+	const float cos_angle = cosf(angle);
+	const float sin_angle = sinf(angle);
+
+	// only the bins between min and max values constrain the setpoint
+	for (int k = 0; k < _num_constraint_bins; k++) {
+		const int i = _constraint_bins[k];
 		const float max_range = _data_maxranges[i] * 0.01f;
 
 		// get the vector pointing into the direction of current bin
-		float bin_angle = wrap_2pi(vehicle_yaw_angle_rad
-					   + math::radians((float)i * BIN_SIZE + _obstacle_map_body_frame.angle_offset));
-
-		const Vector2f bin_direction = { cosf(bin_angle), sinf(bin_angle) };
-		float bin_distance = _obstacle_map_body_frame.distances[i];
+		Vector2f bin_direction;
+		geometry::rotateDirection(_bin_cos[i], _bin_sin[i], cos_angle, sin_angle, bin_direction(0), bin_direction(1));
 
-		// only consider bins which are between min and max values
-		if (bin_distance > _obstacle_map_body_frame.min_distance && bin_distance < UINT16_MAX) {
-			const float distance = bin_distance * 0.01f;
+		const float distance = _obstacle_map_body_frame.distances[i] * 0.01f;
 
-			// Assume current velocity is sufficiently close to the setpoint velocity, this breaks down if flying high
-			// acceleration maneuvers
-			const float curr_vel_parallel = math::max(0.f, setpoint_vel.dot(bin_direction));
-			float delay_distance = curr_vel_parallel * _param_cp_delay.get();
+		// Assume current velocity is sufficiently close to the setpoint velocity, this breaks down if flying high
+		// acceleration maneuvers
+		const float curr_vel_parallel = math::max(0.f, setpoint_vel.dot(bin_direction));
+		float delay_distance = curr_vel_parallel * _param_cp_delay.get();
 
-			const hrt_abstime data_age = now - _data_timestamps[i];
+		const hrt_abstime data_age = now - _data_timestamps[i];
 
-			if (distance < max_range) {
-				delay_distance += curr_vel_parallel * (data_age * 1e-6f);
-			}
+		if (distance < max_range) {
+			delay_distance += curr_vel_parallel * (data_age * 1e-6f);
+		}
 
-			const float stop_distance = distance - _min_dist_to_keep - delay_distance;
+		const float stop_distance = distance - _min_dist_to_keep - delay_distance;
 
-			float curr_acc_vel_constraint;
+		float curr_acc_vel_constraint;
 
-			if (stop_distance >= 0.f) {
-				const float max_vel = math::trajectory::computeMaxSpeedFromDistance(_param_mpc_jerk_max.get(),
-						      _param_mpc_acc_hor.get(), stop_distance, 0.f);
-				curr_acc_vel_constraint = _param_mpc_xy_vel_p_acc.get() * math::min(max_vel - curr_vel_parallel, 0.f);
+		if (stop_distance >= 0.f) {
+			const float max_vel = math::trajectory::computeMaxSpeedFromDistance(_param_mpc_jerk_max.get(),
+					      _param_mpc_acc_hor.get(), stop_distance, 0.f);
+			curr_acc_vel_constraint = _param_mpc_xy_vel_p_acc.get() * math::min(max_vel - curr_vel_parallel, 0.f);
 
-			} else {
-				curr_acc_vel_constraint = -1.f * _param_mpc_xy_vel_p_acc.get() * curr_vel_parallel;
-			}
+		} else {
+			curr_acc_vel_constraint = -1.f * _param_mpc_xy_vel_p_acc.get() * curr_vel_parallel;
+		}
 
-			if (curr_acc_vel_constraint < vel_comp_accel) {
-				vel_comp_accel = curr_acc_vel_constraint;
-				vel_comp_accel_dir = bin_direction;
-			}
+		if (curr_acc_vel_constraint < vel_comp_accel) {
+			vel_comp_accel = curr_acc_vel_constraint;
+			vel_comp_accel_dir = bin_direction;
 		}
 	}
 }
@@ -46,6 +46,7 @@
 
 #include <commander/px4_custom_mode.h>
 #include <drivers/drv_hrt.h>
+#include <lib/geo/geometry_kernels.h>
 #include <mathlib/mathlib.h>
 #include <matrix/matrix/math.hpp>
 #include <px4_platform_common/module_params.h>
@@ -151,6 +152,17 @@ protected:
 	 */
 	bool _enterData(int map_index, float sensor_range, float sensor_reading);
 
+	/**
+	 * Sets a bin of the internal map and flags the map as changed if its distance differs
+	 * @param bin, index of the bin in the internal map
+	 * @param distance, distance measurement in cm
+	 * @param max_range, max range of the sensor in cm
+	 */
+	void _updateBin(int bin, uint16_t distance, uint16_t max_range);
+
+	/** Selects the bins constraining the setpoint and the closest bin, only called when the map changed */
+	void _updateConstraintBins();
+
 	bool _checkSetpointDirectionFeasability();
 
 	void _transformSetpoint(const matrix::Vector2f &setpoint);
@@ -173,6 +185,16 @@ private:
 
 	float _min_dist_to_keep{};
 
+	float _bin_cos[BIN_COUNT] {};		/**< direction of each bin relative to the map orientation */
+	float _bin_sin[BIN_COUNT] {};
+
+	bool _map_changed{true};		/**< a bin of the obstacle map changed since the last _updateConstraintBins() */
+	bool _map_has_data{false};		/**< at least one bin contains a measurement */
+	int _closest_bin{0};			/**< index of the closest bin */
+	uint16_t _constraint_min_distance{0};	/**< min_distance the constraint bins were selected with */
+	uint8_t _constraint_bins[BIN_COUNT] {};	/**< bins between min and max distance, constraining the setpoint */
+	int _num_constraint_bins{0};
+
 	orb_advert_t _mavlink_log_pub{nullptr};	 	/**< Mavlink log uORB handle */
 
 	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
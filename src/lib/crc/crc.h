@@ -39,6 +39,10 @@
 /****************************************************************************
  * Included Files
  ****************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -58,6 +62,11 @@
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /****************************************************************************
  * Name: crc16_add
  *
@@ -135,3 +144,7 @@ uint32_t crc32_signature(uint32_t acc, size_t length,
  ****************************************************************************/
 
 uint64_t crc64_add_word(uint64_t crc, uint32_t value);
+
+#ifdef __cplusplus
+}
+#endif
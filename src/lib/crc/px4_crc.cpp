@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "px4_crc.h"
+
+#include <string.h>
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/micro_hal.h>
+
+#if defined(PX4_ARCH_HAS_HW_CRC32) && defined(CONFIG_BUILD_FLAT)
+# include <px4_arch/crc.h>
+# define PX4_CRC32_HW 1
+#endif
+
+#if defined(CONSTRAINED_FLASH)
+static constexpr int CRC32_SLICES = 1;
+#else
+static constexpr int CRC32_SLICES = 8;
+#endif
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "slice-by-8 assumes a little endian target");
+
+namespace
+{
+
+template<int Slices>
+struct Crc32Tables {
+	uint32_t table[Slices][256];
+
+	constexpr Crc32Tables() : table()
+	{
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t crc = i;
+
+			for (int bit = 0; bit < 8; bit++) {
+				crc = (crc >> 1) ^ ((crc & 1u) ? 0xEDB88320u : 0u);
+			}
+
+			table[0][i] = crc;
+		}
+
+		for (int slice = 1; slice < Slices; slice++) {
+			for (uint32_t i = 0; i < 256; i++) {
+				const uint32_t prev = table[slice - 1][i];
+				table[slice][i] = (prev >> 8) ^ table[0][prev & 0xFFu];
+			}
+		}
+	}
+};
+
+struct Crc8Table {
+	uint8_t table[256];
+
+	constexpr Crc8Table(uint8_t polynomial) : table()
+	{
+		for (unsigned i = 0; i < 256; i++) {
+			uint8_t crc = (uint8_t)i;
+
+			for (int bit = 0; bit < 8; bit++) {
+				crc = (crc & 0x80u) ? (uint8_t)((crc << 1) ^ polynomial) : (uint8_t)(crc << 1);
+			}
+
+			table[i] = crc;
+		}
+	}
+};
+
+constexpr Crc32Tables<CRC32_SLICES> crc32_tables{};
+constexpr Crc8Table crc8_smbus_table{0x07};
+
+#if defined(PX4_CRC32_HW)
+// below this the setup of the unit costs more than the table
+static constexpr size_t CRC32_HW_MIN_LEN = 64;
+
+// the unit holds the state of one CRC, the other threads use the software path meanwhile
+px4::atomic_bool crc32_hw_busy{false};
+#endif
+
+} // namespace
+
+uint32_t px4_crc32_sw(uint32_t crc, const uint8_t *src, size_t len)
+{
+	const auto &t = crc32_tables.table;
+
+#if !defined(CONSTRAINED_FLASH)
+
+	while (len >= 8) {
+		uint32_t one;
+		uint32_t two;
+		memcpy(&one, src, sizeof(one));
+		memcpy(&two, src + 4, sizeof(two));
+		one ^= crc;
+
+		crc = t[7][one & 0xFFu] ^ t[6][(one >> 8) & 0xFFu] ^ t[5][(one >> 16) & 0xFFu] ^ t[4][one >> 24]
+		      ^ t[3][two & 0xFFu] ^ t[2][(two >> 8) & 0xFFu] ^ t[1][(two >> 16) & 0xFFu] ^ t[0][two >> 24];
+
+		src += 8;
+		len -= 8;
+	}
+
+#endif
+
+	while (len-- > 0) {
+		crc = t[0][(crc ^ *src++) & 0xFFu] ^ (crc >> 8);
+	}
+
+	return crc;
+}
+
+uint32_t px4_crc32(uint32_t crc, const uint8_t *src, size_t len)
+{
+#if defined(PX4_CRC32_HW)
+	bool expected = false;
+
+	if (len >= CRC32_HW_MIN_LEN && crc32_hw_busy.compare_exchange(&expected, true)) {
+		crc = px4_arch_crc32(crc, src, len);
+		crc32_hw_busy.store(false);
+		return crc;
+	}
+
+#endif
+
+	return px4_crc32_sw(crc, src, len);
+}
+
+uint8_t px4_crc8_smbus(uint8_t crc, const uint8_t *src, size_t len)
+{
+	while (len-- > 0) {
+		crc = crc8_smbus_table.table[crc ^ *src++];
+	}
+
+	return crc;
+}
+
+bool px4_crc32_hw_available()
+{
+#if defined(PX4_CRC32_HW)
+	return true;
+#else
+	return false;
+#endif
+}
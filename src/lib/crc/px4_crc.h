@@ -0,0 +1,87 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file px4_crc.h
+ *
+ * Buffer CRCs for the hot consumers (file and parameter checksums, mission
+ * and geofence hashes, ESC telemetry).
+ *
+ * px4_crc32() computes the same value as crc32part() (reflected polynomial
+ * 0xEDB88320, no pre or post inversion). Large buffers go to the CRC unit of
+ * the MCU if the platform provides one (px4_arch/crc.h) and it is not in use
+ * by another thread, everything else to a slice-by-8 software implementation
+ * (byte table on CONSTRAINED_FLASH builds).
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <px4_platform_common/defines.h>
+
+__BEGIN_DECLS
+
+/**
+ * Continue a CRC32 over a buffer, drop-in replacement for crc32part().
+ *
+ * @param crc running CRC, 0 to start
+ * @param src data
+ * @param len number of bytes
+ * @return updated CRC
+ */
+__EXPORT uint32_t px4_crc32(uint32_t crc, const uint8_t *src, size_t len);
+
+/**
+ * px4_crc32() without the hardware backend.
+ */
+__EXPORT uint32_t px4_crc32_sw(uint32_t crc, const uint8_t *src, size_t len);
+
+/**
+ * CRC-8 with polynomial 0x07 (CRC-8/SMBUS, used by the DShot telemetry).
+ *
+ * @param crc running CRC, 0 to start
+ * @param src data
+ * @param len number of bytes
+ * @return updated CRC
+ */
+__EXPORT uint8_t px4_crc8_smbus(uint8_t crc, const uint8_t *src, size_t len);
+
+/**
+ * @return true if px4_crc32() can use a hardware CRC unit on this platform
+ */
+__EXPORT bool px4_crc32_hw_available(void);
+
+__END_DECLS
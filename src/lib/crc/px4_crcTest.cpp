@@ -0,0 +1,93 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the px4_crc library
+ * Run this test only using make tests TESTFILTER=px4_crc
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+
+#include "crc.h"
+#include "px4_crc.h"
+
+static const uint8_t check_input[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST(px4_crc, crc32_check_value)
+{
+	// CRC-32 (ISO-HDLC) with the inversion done by the caller
+	EXPECT_EQ(px4_crc32(0xFFFFFFFFu, check_input, sizeof(check_input)) ^ 0xFFFFFFFFu, 0xCBF43926u);
+	EXPECT_EQ(px4_crc32_sw(0xFFFFFFFFu, check_input, sizeof(check_input)) ^ 0xFFFFFFFFu, 0xCBF43926u);
+}
+
+TEST(px4_crc, crc32_matches_bitwise_reference)
+{
+	uint8_t buffer[1024 + 8];
+
+	for (size_t i = 0; i < sizeof(buffer); i++) {
+		buffer[i] = (uint8_t)rand();
+	}
+
+	// all offsets and the lengths around the slice size
+	for (size_t offset = 0; offset < 8; offset++) {
+		for (size_t len = 0; len <= 1024; len += (len < 32) ? 1 : 97) {
+			const uint32_t expected = crc32_signature(0x12345678u, len, buffer + offset);
+			EXPECT_EQ(px4_crc32(0x12345678u, buffer + offset, len), expected) << "offset " << offset << " len " << len;
+			EXPECT_EQ(px4_crc32_sw(0x12345678u, buffer + offset, len), expected) << "offset " << offset << " len " << len;
+		}
+	}
+}
+
+TEST(px4_crc, crc32_continues_over_parts)
+{
+	uint8_t buffer[300];
+
+	for (size_t i = 0; i < sizeof(buffer); i++) {
+		buffer[i] = (uint8_t)(i * 7);
+	}
+
+	const uint32_t whole = px4_crc32(0, buffer, sizeof(buffer));
+	uint32_t parts = px4_crc32(0, buffer, 3);
+	parts = px4_crc32(parts, buffer + 3, 100);
+	parts = px4_crc32(parts, buffer + 103, sizeof(buffer) - 103);
+	EXPECT_EQ(parts, whole);
+}
+
+TEST(px4_crc, crc8_smbus_check_value)
+{
+	EXPECT_EQ(px4_crc8_smbus(0, check_input, sizeof(check_input)), 0xF4);
+	EXPECT_EQ(px4_crc8_smbus(0, check_input, 0), 0);
+}
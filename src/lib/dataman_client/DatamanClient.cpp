@@ -183,6 +183,105 @@ bool DatamanClient::readSync(dm_item_t item, uint32_t index, uint8_t *buffer, ui
 	return success;
 }
 
+bool DatamanClient::readSync(dm_item_t item, uint32_t start_index, uint32_t count, uint8_t *buffer, uint32_t length,
+			     hrt_abstime timeout)
+{
+	if (length > g_per_item_size[item]) {
+		PX4_ERR("Length  %" PRIu32 " can't fit in data size for item  %" PRIi8, length, static_cast<uint8_t>(item));
+		return false;
+	}
+
+	if (count == 0 || count > DM_MAX_READ_RANGE) {
+		PX4_ERR("Range of %" PRIu32 " indexes not supported", count);
+		return false;
+	}
+
+	if (count == 1) {
+		return readSync(item, start_index, buffer, length, timeout);
+	}
+
+	const hrt_abstime start_time = hrt_absolute_time();
+
+	dataman_request_s request;
+	request.timestamp = start_time;
+	request.index = start_index;
+	request.data_length = length;
+	request.count = static_cast<uint8_t>(count);
+	request.client_id = _client_id;
+	request.request_type = DM_READ_RANGE;
+	request.item = static_cast<uint8_t>(item);
+
+	const uint32_t all_received = (1u << count) - 1u;
+	uint32_t received = 0;
+	uint8_t status = dataman_response_s::STATUS_SUCCESS;
+	int32_t ret = 0;
+
+	perf_begin(_sync_perf);
+	_dataman_request_pub.publish(request);
+
+	while ((received != all_received) && (hrt_elapsed_time(&start_time) < timeout)) {
+
+		ret = px4_poll(&_fds, 1, 100);
+
+		if (ret < 0) {
+			PX4_ERR("px4_poll returned error: %" PRIu32, ret);
+			break;
+
+		} else if (ret == 0) {
+
+			// No response received, request the whole range again
+			received = 0;
+			status = dataman_response_s::STATUS_SUCCESS;
+			_dataman_request_pub.publish(request);
+
+		} else {
+
+			bool updated = false;
+			orb_check(_dataman_response_sub, &updated);
+
+			while (updated && (received != all_received)) {
+				dataman_response_s response;
+				orb_copy(ORB_ID(dataman_response), _dataman_response_sub, &response);
+
+				const uint32_t offset = response.index - start_index;
+
+				if ((response.client_id == _client_id) && (response.request_type == DM_READ_RANGE) &&
+				    (response.item == request.item) && (response.index >= start_index) && (offset < count)) {
+
+					if (response.status == dataman_response_s::STATUS_SUCCESS) {
+						memcpy(buffer + offset * length, response.data, length);
+
+					} else {
+						status = response.status;
+					}
+
+					received |= (1u << offset);
+				}
+
+				orb_check(_dataman_response_sub, &updated);
+			}
+		}
+	}
+
+	perf_end(_sync_perf);
+
+	if (received != all_received) {
+		if (ret >= 0) {
+			PX4_ERR("timeout after %" PRIu32 " ms!", static_cast<uint32_t>(timeout / 1000));
+		}
+
+		return false;
+	}
+
+	if (status != dataman_response_s::STATUS_SUCCESS) {
+		PX4_ERR("readSync failed! status=%" PRIu8 ", item=%" PRIu8 ", index=%" PRIu32 ", count=%" PRIu32,
+			status, static_cast<uint8_t>(item), start_index, count);
+		return false;
+	}
+
+	return true;
+}
+
 bool DatamanClient::writeSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout)
 {
 	if (length > g_per_item_size[item]) {
@@ -284,6 +383,57 @@ bool DatamanClient::readAsync(dm_item_t item, uint32_t index, uint8_t *buffer, u
 	return success;
 }
 
+bool DatamanClient::readAsync(dm_item_t item, uint32_t start_index, uint32_t count, uint8_t *buffer, uint32_t length)
+{
+	if (length > g_per_item_size[item]) {
+		PX4_ERR("Length  %" PRIu32 " can't fit in data size for item  %" PRIi8, length, static_cast<uint8_t>(item));
+		return false;
+	}
+
+	if (count == 0 || count > DM_MAX_READ_RANGE) {
+		PX4_ERR("Range of %" PRIu32 " indexes not supported", count);
+		return false;
+	}
+
+	if (count == 1) {
+		return readAsync(item, start_index, buffer, length);
+	}
+
+	bool success = false;
+
+	if (_state == State::Idle) {
+
+		hrt_abstime timestamp = hrt_absolute_time();
+
+		dataman_request_s request;
+		request.timestamp = timestamp;
+		request.index = start_index;
+		request.data_length = length;
+		request.count = static_cast<uint8_t>(count);
+		request.client_id = _client_id;
+		request.request_type = DM_READ_RANGE;
+		request.item = static_cast<uint8_t>(item);
+
+		_active_request.timestamp = timestamp;
+		_active_request.request_type = DM_READ_RANGE;
+		_active_request.item = item;
+		_active_request.index = start_index;
+		_active_request.buffer = buffer;
+		_active_request.length = length;
+		_active_request.count = static_cast<uint8_t>(count);
+		_active_request.received = 0;
+
+		_response_status = dataman_response_s::STATUS_SUCCESS;
+		_state = State::RequestSent;
+
+		_dataman_request_pub.publish(request);
+
+		success = true;
+	}
+
+	return success;
+}
+
 bool DatamanClient::writeAsync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length)
 {
 	if (length > g_per_item_size[item]) {
@@ -353,6 +503,55 @@ bool DatamanClient::clearAsync(dm_item_t item)
 	return success;
 }
 
+bool DatamanClient::handleResponse(const dataman_response_s &response)
+{
+	if ((response.client_id != _client_id) ||
+	    (response.request_type != _active_request.request_type) ||
+	    (response.item != _active_request.item)) {
+		return false;
+	}
+
+	if (response.request_type == DM_READ_RANGE) {
+
+		const uint32_t offset = response.index - _active_request.index;
+
+		if ((response.index < _active_request.index) || (offset >= _active_request.count)) {
+			return false;
+		}
+
+		if (response.status == dataman_response_s::STATUS_SUCCESS) {
+			memcpy(_active_request.buffer + offset * _active_request.length, response.data, _active_request.length);
+
+		} else {
+			PX4_ERR("Async request type %" PRIu8 " failed! status=%" PRIu8 " item=%" PRIu8 " index=%" PRIu32,
+				response.request_type, response.status, static_cast<uint8_t>(_active_request.item), response.index);
+			_response_status = response.status;
+		}
+
+		_active_request.received |= (1u << offset);
+
+		return _active_request.received == ((1u << _active_request.count) - 1u);
+	}
+
+	if (response.index != _active_request.index) {
+		return false;
+	}
+
+	if (response.request_type == DM_READ) {
+		memcpy(_active_request.buffer, response.data, _active_request.length);
+	}
+
+	_response_status = response.status;
+
+	if (_response_status != dataman_response_s::STATUS_SUCCESS) {
+
+		PX4_ERR("Async request type %" PRIu8 " failed! status=%" PRIu8 " item=%" PRIu8 " index=%" PRIu32,
+			response.request_type, response.status, static_cast<uint8_t>(_active_request.item), _active_request.index);
+	}
+
+	return true;
+}
+
 void DatamanClient::update()
 {
 	if (_state == State::RequestSent) {
@@ -362,27 +561,15 @@ void DatamanClient::update()
 
 		dataman_response_s response;
 
-		if (updated) {
+		// a range read is answered with several responses at once
+		while (updated && (_state == State::RequestSent)) {
 			orb_copy(ORB_ID(dataman_response), _dataman_response_sub, &response);
 
-			if ((response.client_id == _client_id) &&
-			    (response.request_type == _active_request.request_type) &&
-			    (response.item == _active_request.item) &&
-			    (response.index == _active_request.index)) {
-
-				if (response.request_type == DM_READ) {
-					memcpy(_active_request.buffer, response.data, _active_request.length);
-				}
-
-				_response_status = response.status;
-
-				if (_response_status != dataman_response_s::STATUS_SUCCESS) {
-
-					PX4_ERR("Async request type %" PRIu8 " failed! status=%" PRIu8 " item=%" PRIu8 " index=%" PRIu32,
-						response.request_type, response.status, static_cast<uint8_t>(_active_request.item), _active_request.index);
-				}
-
+			if (handleResponse(response)) {
 				_state = State::ResponseReceived;
+
+			} else {
+				orb_check(_dataman_response_sub, &updated);
 			}
 		}
 
@@ -407,6 +594,12 @@ void DatamanClient::update()
 
 				if (_active_request.request_type == DM_WRITE) {
 					memcpy(request.data, _active_request.buffer, _active_request.length);
+
+				} else if (_active_request.request_type == DM_READ_RANGE) {
+					// request the whole range again, the indexes already received are overwritten
+					request.count = _active_request.count;
+					_active_request.received = 0;
+					_response_status = dataman_response_s::STATUS_SUCCESS;
 				}
 
 				_dataman_request_pub.publish(request);
@@ -607,27 +800,72 @@ void DatamanCache::update()
 			changeUpdateIndex();
 			break;
 
-		case State::RequestPrepared:
+		case State::RequestPrepared: {
+				const dm_item_t item = static_cast<dm_item_t>(_items[_update_index].response.item);
+				const uint32_t index = _items[_update_index].response.index;
 
-			success = _client.readAsync(static_cast<dm_item_t>(_items[_update_index].response.item),
-						    _items[_update_index].response.index,
-						    _items[_update_index].response.data,
-						    g_per_item_size[_items[_update_index].response.item]);
+				// Read the following prepared items with the consecutive indexes in the same request
+				uint32_t count = 1;
 
-			if (success) {
-				_items[_update_index].cache_state = State::RequestSent;
+				if (_single_reads > 0) {
+					--_single_reads;
 
-			} else {
-				_items[_update_index].cache_state = State::Error;
-			}
+				} else {
+					while ((count < DM_MAX_READ_RANGE) && (count < _item_counter)) {
+						const Item &next = _items[(_update_index + count) % _num_items];
+
+						if ((next.cache_state != State::RequestPrepared) ||
+						    (next.response.item != item) ||
+						    (next.response.index != index + count)) {
+							break;
+						}
+
+						++count;
+					}
+				}
+
+				if (count > 1) {
+					success = _client.readAsync(item, index, count, _range_buffer, g_per_item_size[item]);
+
+				} else {
+					success = _client.readAsync(item, index, _items[_update_index].response.data, g_per_item_size[item]);
+				}
+
+				_range_count = success ? count : 1;
 
+				for (uint32_t i = 0; i < _range_count; ++i) {
+					_items[(_update_index + i) % _num_items].cache_state = success ? State::RequestSent : State::Error;
+				}
+			}
 			break;
 
 		case State::RequestSent:
 
 			if (_client.lastOperationCompleted(response_success)) {
 
-				if (response_success) {
+				if (_range_count > 1) {
+
+					const uint32_t length = g_per_item_size[_items[_update_index].response.item];
+
+					if (response_success) {
+						for (uint32_t i = 0; i < _range_count; ++i) {
+							memcpy(_items[_update_index].response.data, &_range_buffer[i * length], length);
+							_items[_update_index].cache_state = State::ResponseReceived;
+							changeUpdateIndex();
+						}
+
+					} else {
+						// read the range again one by one to find the failing index
+						for (uint32_t i = 0; i < _range_count; ++i) {
+							_items[(_update_index + i) % _num_items].cache_state = State::RequestPrepared;
+						}
+
+						_single_reads = _range_count;
+					}
+
+					_range_count = 1;
+
+				} else if (response_success) {
 
 					_items[_update_index].cache_state = State::ResponseReceived;
 					changeUpdateIndex();
@@ -664,6 +902,8 @@ void DatamanCache::invalidate()
 	_update_index = 0;
 	_item_counter = 0;
 	_load_index = 0;
+	_range_count = 1;
+	_single_reads = 0;
 	_client.abortCurrentOperation();
 }
 
@@ -64,6 +64,21 @@ public:
 	 */
 	bool readSync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length, hrt_abstime timeout = 5000_ms);
 
+	/**
+	 * @brief Reads consecutive indexes of an item synchronously with a single request.
+	 *
+	 * @param[in] item The item to read data from.
+	 * @param[in] start_index The first index of the item to read data from.
+	 * @param[in] count The number of indexes to read, at most DM_MAX_READ_RANGE.
+	 * @param[out] buffer Pointer to the buffer to store the read data, at least count * length bytes.
+	 * @param[in] length The length of the data to read per index.
+	 * @param[in] timeout The timeout in microseconds for waiting for all the responses.
+	 *
+	 * @return true if all indexes were read successfully within the timeout, false otherwise.
+	 */
+	bool readSync(dm_item_t item, uint32_t start_index, uint32_t count, uint8_t *buffer, uint32_t length,
+		      hrt_abstime timeout = 5000_ms);
+
 	/**
 	 * @brief Write data to the dataman synchronously.
 	 *
@@ -103,6 +118,24 @@ public:
 	 */
 	bool readAsync(dm_item_t item, uint32_t index, uint8_t *buffer, uint32_t length);
 
+	/**
+	 * @brief Initiates an asynchronous request to read consecutive indexes of an item with a single request.
+	 *
+	 * Dataman answers every index with its own response, the data of index (start_index + i) is stored
+	 * at buffer + i * length.
+	 *
+	 * @param[in] item The item to read from.
+	 * @param[in] start_index The first index within the item to read from.
+	 * @param[in] count The number of indexes to read, at most DM_MAX_READ_RANGE.
+	 * @param[out] buffer The buffer to store the read data in, at least count * length bytes.
+	 * @param[in] length The length of the data to read per index.
+	 *
+	 * @return True if the read request was successfully queued, false otherwise.
+	 *
+	 * @note The operation only succeeds if all indexes were read successfully.
+	 */
+	bool readAsync(dm_item_t item, uint32_t start_index, uint32_t count, uint8_t *buffer, uint32_t length);
+
 	/**
 	 * @brief Initiates an asynchronous request to write the data to dataman for a specific item and index.
 	 *
@@ -168,8 +201,13 @@ private:
 		uint32_t index;
 		uint8_t *buffer;
 		uint32_t length;
+		uint8_t count;		///< number of indexes of a range read
+		uint8_t received;	///< bitmask of the indexes of a range read already received
 	};
 
+	/* Handle a response to the active request, returns true once the request is done */
+	bool handleResponse(const dataman_response_s &response);
+
 	/* Synchronous response/request handler */
 	bool syncHandler(const dataman_request_s &request, dataman_response_s &response,
 			 const hrt_abstime &start_time, hrt_abstime timeout);
@@ -299,6 +337,10 @@ private:
 	uint32_t _update_index{0};	///< index for tracking last index used by update function
 	uint32_t _item_counter{0};	///< number of items to process with update function
 	uint32_t _num_items{0};		///< number of items that cache can store
+	uint32_t _range_count{1};	///< number of items read with the request in flight
+	uint32_t _single_reads{0};	///< number of items to read one by one after a failed range read
+
+	uint8_t _range_buffer[DM_MAX_READ_RANGE * sizeof(dataman_response_s::data)] {};
 
 	DatamanClient _client{};
 
@@ -179,6 +179,31 @@ SPI::_transfer(uint8_t *send, uint8_t *recv, unsigned len)
 	return PX4_OK;
 }
 
+#if defined(CONFIG_SPI_TRIGGER) && defined(CONFIG_SPI_HWFEATURES)
+int
+SPI::transfer_triggered(uint8_t *send, uint8_t *recv, unsigned len)
+{
+	if ((send == nullptr) && (recv == nullptr)) {
+		return -EINVAL;
+	}
+
+	// the bus is held until triggered, not possible if it's shared with other devices
+	if ((_locking_mode != LOCK_NONE) || up_interrupt_context()) {
+		return -ENOTSUP;
+	}
+
+	if (SPI_HWFEATURES(_dev, HWFEAT_TRIGGER) != OK) {
+		return -ENOTSUP;
+	}
+
+	int result = _transfer(send, recv, len);
+
+	SPI_HWFEATURES(_dev, 0);
+
+	return result;
+}
+#endif // CONFIG_SPI_TRIGGER && CONFIG_SPI_HWFEATURES
+
 int
 SPI::transferhword(uint16_t *send, uint16_t *recv, unsigned len)
 {
@@ -139,6 +139,29 @@ protected:
 	 */
 	int		transferhword(uint16_t *send, uint16_t *recv, unsigned len);
 
+#if defined(CONFIG_SPI_TRIGGER) && defined(CONFIG_SPI_HWFEATURES)
+	/**
+	 * Perform a SPI transfer that is started by trigger() (DMA chained transfer).
+	 *
+	 * The device is selected and the transfer armed, then the calling thread
+	 * blocks until trigger() is called (eg. from the data ready interrupt) and
+	 * the transfer completed. The bus is held while waiting, so this is only
+	 * available on buses that don't require locking.
+	 *
+	 * @return		OK if the exchange was successful, -ENOTSUP if triggered
+	 *			transfers aren't available, -errno otherwise.
+	 */
+	int		transfer_triggered(uint8_t *send, uint8_t *recv, unsigned len);
+
+	/**
+	 * Start a transfer armed by transfer_triggered(). Safe to call from
+	 * interrupt context.
+	 *
+	 * @return		OK if a transfer was started, -errno otherwise (nothing armed).
+	 */
+	int		trigger() { return SPI_TRIGGER(_dev); }
+#endif // CONFIG_SPI_TRIGGER && CONFIG_SPI_HWFEATURES
+
 	/**
 	 * Set the SPI bus frequency
 	 * This is used to change frequency on the fly. Some sensors
@@ -146,7 +146,15 @@ void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 	sample.device_id = _device_id;
 	sample.scale = _scale;
 	sample.timestamp = hrt_absolute_time();
-	_sensor_fifo_pub.publish(sample);
+
+	sensor_gyro_fifo_s &loaned = _sensor_fifo_pub.loan();
+
+	if (&loaned != &sample) {
+		// not filled in through loanFIFO()
+		loaned = sample;
+	}
+
+	_sensor_fifo_pub.publish();
 
 
 	// publish
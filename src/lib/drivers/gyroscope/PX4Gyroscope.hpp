@@ -35,6 +35,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <lib/conversion/rotation.h>
+#include <uORB/PublicationLoaned.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fifo.h>
@@ -58,6 +59,13 @@ public:
 
 	void update(const hrt_abstime &timestamp_sample, float x, float y, float z);
 
+	/**
+	 * Message for the next FIFO publication, filled in directly in the topic buffer where possible.
+	 * Drivers fill in timestamp_sample, dt, samples and x, y, z (no need to clear it) and then pass
+	 * it to updateFIFO(), which publishes it without copying.
+	 */
+	sensor_gyro_fifo_s &loanFIFO() { return _sensor_fifo_pub.loan(); }
+
 	void updateFIFO(sensor_gyro_fifo_s &sample);
 
 	int get_instance() { return _sensor_pub.get_instance(); };
@@ -66,7 +74,7 @@ private:
 	void UpdateClipLimit();
 
 	uORB::PublicationMulti<sensor_gyro_s> _sensor_pub{ORB_ID(sensor_gyro)};
-	uORB::PublicationMulti<sensor_gyro_fifo_s>  _sensor_fifo_pub{ORB_ID(sensor_gyro_fifo)};
+	uORB::PublicationMultiLoaned<sensor_gyro_fifo_s> _sensor_fifo_pub{ORB_ID(sensor_gyro_fifo)};
 
 	uint32_t		_device_id{0};
 	const enum Rotation	_rotation;
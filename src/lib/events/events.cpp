@@ -38,23 +38,79 @@
 #include <px4_platform_common/events.h>
 #include <uORB/uORB.h>
 
+#include <string.h>
+
+using namespace time_literals;
+
 static orb_advert_t orb_event_pub = nullptr;
 static pthread_mutex_t publish_event_mutex = PTHREAD_MUTEX_INITIALIZER;
 static uint16_t event_sequence{events::initial_event_sequence};
 
+// Identical events (same id, log levels and arguments) are sent at most once within this window.
+// A burst of repeated events then costs a comparison instead of a publication, a log entry and
+// a mavlink transmission.
+static constexpr hrt_abstime duplicate_window{500_ms};
+static constexpr int num_recent_events = 8;
+
+struct RecentEvent {
+	hrt_abstime timestamp;
+	uint32_t id;
+	uint8_t log_levels;
+	uint8_t arguments[sizeof(event_s::arguments)];
+};
+
+static RecentEvent recent_events[num_recent_events] {};
+static int recent_events_next{0};
+
+/**
+ * Check if the event is a repetition of one sent within the duplicate window, store it otherwise.
+ * Must be called with publish_event_mutex held.
+ */
+static bool is_duplicate(const event_s &event)
+{
+	for (const RecentEvent &recent : recent_events) {
+		if (recent.id == event.id && recent.log_levels == event.log_levels
+		    && recent.timestamp != 0 && event.timestamp - recent.timestamp < duplicate_window
+		    && memcmp(recent.arguments, event.arguments, sizeof(recent.arguments)) == 0) {
+			return true;
+		}
+	}
+
+	// not a duplicate: replace the oldest entry
+	RecentEvent &recent = recent_events[recent_events_next];
+	recent.timestamp = event.timestamp;
+	recent.id = event.id;
+	recent.log_levels = event.log_levels;
+	memcpy(recent.arguments, event.arguments, sizeof(recent.arguments));
+	recent_events_next = (recent_events_next + 1) % num_recent_events;
+
+	return false;
+}
+
 namespace events
 {
 
-void send(event_s &event)
+void send(event_s &event, bool deduplicate)
 {
 	event.timestamp = hrt_absolute_time();
 
+	// protocol events carry state the receiver needs every time, they are never dropped
+	if ((event.log_levels & 0xF) == (uint8_t)Log::Protocol) {
+		deduplicate = false;
+	}
+
 	// We need some synchronization here because:
 	// - modifying orb_event_pub
 	// - the update of event_sequence needs to be atomic
 	// - we need to ensure ordering of the sequence numbers: the sequence we set here
 	//   has to be the one published next.
 	pthread_mutex_lock(&publish_event_mutex);
+
+	if (deduplicate && is_duplicate(event)) {
+		pthread_mutex_unlock(&publish_event_mutex);
+		return;
+	}
+
 	event.event_sequence = ++event_sequence; // Set the sequence here so we're able to detect uORB queue overflows
 
 	if (orb_event_pub != nullptr) {
@@ -50,7 +50,7 @@ static int events_ioctl(unsigned int cmd, unsigned long arg)
 	switch (cmd) {
 	case EVENTSIOCSEND: {
 			eventiocsend_t *data = (eventiocsend_t *)arg;
-			events::send(data->event);
+			events::send(data->event, data->deduplicate);
 		}
 		break;
 
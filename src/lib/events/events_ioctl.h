@@ -48,4 +48,5 @@
 #define EVENTSIOCSEND _EVENTSIOC(1)
 typedef struct eventiocsend {
 	event_s &event;
+	bool deduplicate;
 } eventiocsend_t;
@@ -44,9 +44,9 @@
 namespace events
 {
 
-void send(event_s &event)
+void send(event_s &event, bool deduplicate)
 {
-	eventiocsend_t data = {event};
+	eventiocsend_t data = {event, deduplicate};
 	boardctl(EVENTSIOCSEND, reinterpret_cast<unsigned long>(&data));
 }
 
@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file FieldSensorBiasEstimatorBatch.hpp
+ *
+ * FieldSensorBiasEstimator for several sensors sharing the same gyroscope data,
+ * with the states stored per axis over the sensors (structure of arrays). The
+ * sensors are updated together in lane independent loops the compiler can
+ * vectorize.
+ */
+
+#pragma once
+
+#include <matrix/matrix/math.hpp>
+
+template<int N>
+class FieldSensorBiasEstimatorBatch
+{
+public:
+	FieldSensorBiasEstimatorBatch() = default;
+	~FieldSensorBiasEstimatorBatch() = default;
+
+	// Set initial states
+	void setField(int i, const matrix::Vector3f &field)
+	{
+		_field_prev[0][i] = field(0);
+		_field_prev[1][i] = field(1);
+		_field_prev[2][i] = field(2);
+	}
+
+	void setBias(int i, const matrix::Vector3f &bias)
+	{
+		_state_bias[0][i] = bias(0);
+		_state_bias[1][i] = bias(1);
+		_state_bias[2][i] = bias(2);
+	}
+
+	void setLearningGain(float learning_gain) { _learning_gain = learning_gain; }
+
+	/**
+	 * Update the estimators of the active sensors, see FieldSensorBiasEstimator::updateEstimate().
+	 * @param gyro bias corrected gyroscope data in the same coordinate frame as the field sensor data
+	 * @param field biased field sensor data per axis, [axis][sensor]
+	 * @param dt time in seconds since the last update per sensor
+	 * @param active sensors to update, the others are left untouched
+	 */
+	void updateEstimate(const matrix::Vector3f &gyro, const float (&field)[3][N], const float (&dt)[N], const bool (&active)[N])
+	{
+		const float gx = gyro(0);
+		const float gy = gyro(1);
+		const float gz = gyro(2);
+
+		for (int i = 0; i < N; i++) {
+			// an inactive lane runs with dt = 0 and its previous field, which leaves its states unchanged
+			const float lane_dt = active[i] ? dt[i] : 0.f;
+			const float fx = active[i] ? field[0][i] : _field_prev[0][i];
+			const float fy = active[i] ? field[1][i] : _field_prev[1][i];
+			const float fz = active[i] ? field[2][i] : _field_prev[2][i];
+
+			// field_pred = field_prev + (-gyro % (field_prev - bias)) * dt
+			const float rx = _field_prev[0][i] - _state_bias[0][i];
+			const float ry = _field_prev[1][i] - _state_bias[1][i];
+			const float rz = _field_prev[2][i] - _state_bias[2][i];
+
+			const float innov_x = fx - (_field_prev[0][i] - (gy * rz - gz * ry) * lane_dt);
+			const float innov_y = fy - (_field_prev[1][i] - (gz * rx - gx * rz) * lane_dt);
+			const float innov_z = fz - (_field_prev[2][i] - (gx * ry - gy * rx) * lane_dt);
+
+			// bias += learning_gain * (-gyro % field_innov) * dt
+			const float gain = _learning_gain * lane_dt;
+			_state_bias[0][i] -= gain * (gy * innov_z - gz * innov_y);
+			_state_bias[1][i] -= gain * (gz * innov_x - gx * innov_z);
+			_state_bias[2][i] -= gain * (gx * innov_y - gy * innov_x);
+
+			_field_prev[0][i] = fx;
+			_field_prev[1][i] = fy;
+			_field_prev[2][i] = fz;
+		}
+	}
+
+	matrix::Vector3f getField(int i) const { return matrix::Vector3f{_field_prev[0][i], _field_prev[1][i], _field_prev[2][i]}; }
+	matrix::Vector3f getBias(int i) const { return matrix::Vector3f{_state_bias[0][i], _state_bias[1][i], _state_bias[2][i]}; }
+
+private:
+	// states, [axis][sensor]
+	float _field_prev[3][N] {};
+	float _state_bias[3][N] {};
+	float _learning_gain{20.f};
+};
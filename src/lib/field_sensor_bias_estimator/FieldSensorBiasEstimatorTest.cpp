@@ -38,6 +38,7 @@
 
 #include <gtest/gtest.h>
 #include <FieldSensorBiasEstimator.hpp>
+#include <FieldSensorBiasEstimatorBatch.hpp>
 
 using namespace matrix;
 
@@ -73,3 +74,56 @@ TEST(MagnetometerBiasEstimatorTest, constantZRotation)
 	// The Z bias is not observable due to pure yaw rotation
 	EXPECT_NEAR(bias_est(2), 0.f, 1e-3f) << "Estimated Z bias " << bias_est(2);
 }
+
+TEST(MagnetometerBiasEstimatorTest, batchMatchesSingle)
+{
+	static constexpr int N = 4;
+	FieldSensorBiasEstimator single[N];
+	FieldSensorBiasEstimatorBatch<N> batch;
+	batch.setLearningGain(100.f);
+
+	const Vector3f virtual_gyro = Vector3f(0.1f, -0.2f, 0.3f);
+	Vector3f virtual_unbiased_mag = Vector3f(0.9f, 0.f, 1.79f);
+	const Vector3f virtual_bias[N] {{0.2f, -0.4f, 0.5f}, {0.f, 0.f, 0.f}, {-0.1f, 0.3f, 0.f}, {0.05f, 0.05f, -0.2f}};
+
+	for (int lane = 0; lane < N; lane++) {
+		single[lane].setLearningGain(100.f);
+		single[lane].setField(virtual_unbiased_mag + virtual_bias[lane]);
+		batch.setField(lane, virtual_unbiased_mag + virtual_bias[lane]);
+	}
+
+	for (int i = 0; i <= 500; i++) {
+		const float dt = .01f;
+
+		float field[3][N];
+		float lane_dt[N];
+		bool active[N];
+
+		for (int lane = 0; lane < N; lane++) {
+			const Vector3f virtual_mag = virtual_unbiased_mag + virtual_bias[lane];
+			field[0][lane] = virtual_mag(0);
+			field[1][lane] = virtual_mag(1);
+			field[2][lane] = virtual_mag(2);
+			lane_dt[lane] = dt;
+
+			// the last lane skips every other sample
+			active[lane] = (lane < N - 1) || (i % 2 == 0);
+
+			if (active[lane]) {
+				single[lane].updateEstimate(virtual_gyro, virtual_mag, dt);
+			}
+		}
+
+		batch.updateEstimate(virtual_gyro, field, lane_dt, active);
+		virtual_unbiased_mag = Dcmf(AxisAnglef(-virtual_gyro * dt)) * virtual_unbiased_mag;
+	}
+
+	for (int lane = 0; lane < N; lane++) {
+		const Vector3f bias_single = single[lane].getBias();
+		const Vector3f bias_batch = batch.getBias(lane);
+
+		for (int axis = 0; axis < 3; axis++) {
+			EXPECT_NEAR(bias_batch(axis), bias_single(axis), 1e-5f) << "lane " << lane << " axis " << axis;
+		}
+	}
+}
@@ -0,0 +1,139 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file geometry_kernels.h
+ *
+ * Small branch free geometry kernels shared by the geofence and collision prevention.
+ * The loops only use selects and no divisions, such that the compiler can unroll and
+ * vectorize them where the target supports it.
+ */
+
+#pragma once
+
+#include <math.h>
+
+namespace geometry
+{
+
+/**
+ * PNPOLY edge test: does the edge (a, b) cross the ray from p towards +x.
+ * Division free version of
+ * (a_y >= p_y) != (b_y >= p_y) && p_x <= (b_x - a_x) * (p_y - a_y) / (b_y - a_y) + a_x
+ */
+template<typename T>
+inline bool edgeCrossesRay(T p_x, T p_y, T a_x, T a_y, T b_x, T b_y)
+{
+	const bool straddles = (a_y >= p_y) != (b_y >= p_y);
+	const T side = (b_x - a_x) * (p_y - a_y) - (p_x - a_x) * (b_y - a_y);
+	return straddles && (((b_y > a_y) ? side : -side) >= T(0));
+}
+
+/**
+ * Point in polygon test (PNPOLY, W. Randolph Franklin) for non-complex polygons.
+ * @param x, y polygon vertices
+ * @param count number of vertices
+ */
+template<typename T>
+inline bool insidePolygon(const T *x, const T *y, int count, T p_x, T p_y)
+{
+	bool inside = false;
+
+	for (int i = 0, j = count - 1; i < count; j = i++) {
+		inside ^= edgeCrossesRay(p_x, p_y, x[i], y[i], x[j], y[j]);
+	}
+
+	return inside;
+}
+
+/**
+ * Intersection of the segments a + t * d and b + u * e, t and u in [0, 1].
+ * @param epsilon parallel segments (|d x e| < epsilon) never intersect
+ * @param t parameter of the intersection along the first segment, only valid if true is returned
+ * @return true if the segments intersect
+ */
+template<typename T>
+inline bool segmentIntersection(T a_x, T a_y, T d_x, T d_y, T b_x, T b_y, T e_x, T e_y, T epsilon, T &t)
+{
+	const T denominator = d_x * e_y - d_y * e_x;
+
+	if (!(denominator >= epsilon || denominator <= -epsilon)) {
+		return false;
+	}
+
+	const T w_x = b_x - a_x;
+	const T w_y = b_y - a_y;
+	t = (w_x * e_y - w_y * e_x) / denominator;
+	const T u = (w_x * d_y - w_y * d_x) / denominator;
+
+	return t >= T(0) && t <= T(1) && u >= T(0) && u <= T(1);
+}
+
+/**
+ * Fill in the unit direction vectors of count bins, bin i pointing at i * increment [rad]
+ */
+inline void binDirections(float *x, float *y, int count, float increment)
+{
+	for (int i = 0; i < count; i++) {
+		x[i] = cosf(i * increment);
+		y[i] = sinf(i * increment);
+	}
+}
+
+/**
+ * Rotate a unit direction (x, y) by an angle given by its cosine and sine,
+ * replaces a cosf() and sinf() per bin by one per rotation.
+ */
+inline void rotateDirection(float x, float y, float cos_angle, float sin_angle, float &out_x, float &out_y)
+{
+	out_x = cos_angle * x - sin_angle * y;
+	out_y = sin_angle * x + cos_angle * y;
+}
+
+/**
+ * @return index of the first smallest value, -1 if count is 0
+ */
+template<typename T>
+inline int minIndex(const T *values, int count)
+{
+	int index = (count > 0) ? 0 : -1;
+
+	for (int i = 1; i < count; i++) {
+		index = (values[i] < values[index]) ? i : index;
+	}
+
+	return index;
+}
+
+} // namespace geometry
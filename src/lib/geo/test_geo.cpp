@@ -36,6 +36,7 @@
 #include <mathlib/mathlib.h>
 #include <memory>
 #include <lib/geo/geo.h>
+#include <lib/geo/geometry_kernels.h>
 
 class GeoTest : public ::testing::Test
 {
@@ -214,3 +215,70 @@ TEST_F(GeoTest, waypoint_from_line_and_negative_distance)
 	EXPECT_FLOAT_EQ(lat_start - lat_offset, lat_target);
 	EXPECT_DOUBLE_EQ(lon_start, lon_target);
 }
+
+TEST_F(GeoTest, kernel_edge_crosses_ray_matches_pnpoly)
+{
+	// GIVEN: a concave polygon and a grid of points, some of them exactly on the vertices
+	const double x[] {0.0, 4.0, 4.0, 2.0, 2.0, 0.0};
+	const double y[] {0.0, 0.0, 4.0, 4.0, 2.0, 2.0};
+	const int count = sizeof(x) / sizeof(x[0]);
+
+	for (double p_x = -1.0; p_x <= 5.0; p_x += 0.5) {
+		for (double p_y = -1.0; p_y <= 5.0; p_y += 0.5) {
+			// WHEN: we run the division free test and the original PNPOLY
+			bool inside = false;
+
+			for (int i = 0, j = count - 1; i < count; j = i++) {
+				if ((y[i] >= p_y) != (y[j] >= p_y) && (p_x <= (x[j] - x[i]) * (p_y - y[i]) / (y[j] - y[i]) + x[i])) {
+					inside = !inside;
+				}
+			}
+
+			// THEN: they should agree
+			EXPECT_EQ(inside, geometry::insidePolygon(x, y, count, p_x, p_y)) << p_x << ", " << p_y;
+		}
+	}
+}
+
+TEST_F(GeoTest, kernel_segment_intersection)
+{
+	float t = -1.f;
+
+	// crossing segments
+	EXPECT_TRUE(geometry::segmentIntersection(0.f, 0.f, 2.f, 0.f, 1.f, -1.f, 0.f, 2.f, FLT_EPSILON, t));
+	EXPECT_FLOAT_EQ(t, 0.5f);
+
+	// crossing lines outside of the segments
+	EXPECT_FALSE(geometry::segmentIntersection(0.f, 0.f, 2.f, 0.f, 3.f, -1.f, 0.f, 2.f, FLT_EPSILON, t));
+
+	// parallel
+	EXPECT_FALSE(geometry::segmentIntersection(0.f, 0.f, 2.f, 0.f, 0.f, 1.f, 2.f, 0.f, FLT_EPSILON, t));
+}
+
+TEST_F(GeoTest, kernel_rotated_bin_directions)
+{
+	// GIVEN: the unit vectors of 72 bins
+	static constexpr int count = 72;
+	float x[count];
+	float y[count];
+	geometry::binDirections(x, y, count, math::radians(5.f));
+
+	// WHEN: we rotate them
+	const float angle = math::radians(-37.f);
+
+	for (int i = 0; i < count; i++) {
+		float rotated_x;
+		float rotated_y;
+		geometry::rotateDirection(x[i], y[i], cosf(angle), sinf(angle), rotated_x, rotated_y);
+
+		// THEN: they should point into the direction of the rotated bin
+		const float bin_angle = angle + math::radians(i * 5.f);
+		EXPECT_NEAR(rotated_x, cosf(bin_angle), 1e-6f) << i;
+		EXPECT_NEAR(rotated_y, sinf(bin_angle), 1e-6f) << i;
+	}
+
+	// AND: the first of the equal minimum values is found
+	const uint16_t values[] {5, 3, 7, 3, 9};
+	EXPECT_EQ(geometry::minIndex(values, 5), 1);
+	EXPECT_EQ(geometry::minIndex(values, 0), -1);
+}
@@ -0,0 +1,223 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file CompactStorage.hpp
+ *
+ * 16 bit storage types for long float histories (sample windows, spectra,
+ * ring buffers of samples), converting on access. They can directly replace
+ * float as element type of arrays, RingBuffer<T> samples or the structs
+ * pushed into Ringbuffer:
+ *
+ * - float16: IEEE 754 half precision, ~3 significant digits over a large
+ *   dynamic range (6e-5 to 65504)
+ * - ScaledInt16<Range>: fixed point over [-Range, Range] with a constant
+ *   absolute resolution of Range / 32767, saturating
+ *
+ * The arithmetic is done in float, only the storage is compact.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace math
+{
+
+class float16
+{
+public:
+	float16() = default;
+	float16(float value) : _bits(fromFloat(value)) {}
+
+	operator float() const { return toFloat(_bits); }
+
+	float16 &operator=(float value)
+	{
+		_bits = fromFloat(value);
+		return *this;
+	}
+
+	float16 &operator+=(float value) { return *this = float(*this) + value; }
+	float16 &operator-=(float value) { return *this = float(*this) - value; }
+	float16 &operator*=(float value) { return *this = float(*this) * value; }
+
+	uint16_t bits() const { return _bits; }
+
+	static uint16_t fromFloat(float value)
+	{
+#if defined(__ARM_FP16_FORMAT_IEEE)
+		// converted by the FPU (vcvtb on Cortex-M4F/M7)
+		const __fp16 half = value;
+		uint16_t bits;
+		memcpy(&bits, &half, sizeof(bits));
+		return bits;
+#else
+		uint32_t f;
+		memcpy(&f, &value, sizeof(f));
+
+		const uint16_t sign = (f >> 16) & 0x8000u;
+		const uint32_t abs_f = f & 0x7fffffffu;
+
+		if (abs_f >= 0x7f800000u) {
+			// inf or NAN (keeping it a NAN)
+			return sign | 0x7c00u | ((abs_f > 0x7f800000u) ? 0x200u : 0u);
+		}
+
+		if (abs_f >= 0x477ff000u) {
+			// rounds to above the largest half
+			return sign | 0x7c00u;
+		}
+
+		if (abs_f < 0x38800000u) {
+			// subnormal half (or zero): align the mantissa with the implicit bit and round to nearest even
+			if (abs_f < 0x33000000u) {
+				return sign;
+			}
+
+			const uint32_t exponent = abs_f >> 23;
+			const uint32_t mantissa = (abs_f & 0x7fffffu) | 0x800000u;
+			const uint32_t shift = 126u - exponent;
+			const uint32_t half_mantissa = mantissa >> shift;
+			const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+			const uint32_t halfway = 1u << (shift - 1u);
+			const uint32_t round_up = (remainder > halfway) || ((remainder == halfway) && (half_mantissa & 1u));
+			return sign | static_cast<uint16_t>(half_mantissa + round_up);
+		}
+
+		// normal: rebias the exponent and round the mantissa to nearest even (a carry correctly bumps the exponent)
+		const uint32_t rebiased = abs_f - 0x38000000u;
+		const uint32_t round_up = ((rebiased & 0x1fffu) > 0x1000u) || (((rebiased & 0x1fffu) == 0x1000u) && (rebiased & 0x2000u));
+		return sign | static_cast<uint16_t>((rebiased >> 13) + round_up);
+#endif
+	}
+
+	static float toFloat(uint16_t bits)
+	{
+#if defined(__ARM_FP16_FORMAT_IEEE)
+		__fp16 half;
+		memcpy(&half, &bits, sizeof(bits));
+		return half;
+#else
+		const uint32_t sign = static_cast<uint32_t>(bits & 0x8000u) << 16;
+		const uint32_t exponent = (bits >> 10) & 0x1fu;
+		uint32_t mantissa = bits & 0x3ffu;
+		uint32_t f;
+
+		if (exponent == 0x1fu) {
+			// inf or NAN
+			f = sign | 0x7f800000u | (mantissa << 13);
+
+		} else if (exponent != 0) {
+			f = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+
+		} else if (mantissa != 0) {
+			// subnormal half, normalize
+			uint32_t e = 113u;
+
+			while ((mantissa & 0x400u) == 0) {
+				mantissa <<= 1;
+				e--;
+			}
+
+			f = sign | (e << 23) | ((mantissa & 0x3ffu) << 13);
+
+		} else {
+			f = sign;
+		}
+
+		float value;
+		memcpy(&value, &f, sizeof(value));
+		return value;
+#endif
+	}
+
+private:
+	uint16_t _bits{0};
+};
+
+static_assert(sizeof(float16) == 2, "float16 must be 2 bytes");
+
+template<int32_t Range>
+class ScaledInt16
+{
+	static_assert(Range > 0, "Range must be positive");
+
+public:
+	static constexpr float resolution = static_cast<float>(Range) / 32767.f;
+
+	ScaledInt16() = default;
+	ScaledInt16(float value) : _raw(fromFloat(value)) {}
+
+	operator float() const { return _raw * resolution; }
+
+	ScaledInt16 &operator=(float value)
+	{
+		_raw = fromFloat(value);
+		return *this;
+	}
+
+	ScaledInt16 &operator+=(float value) { return *this = float(*this) + value; }
+	ScaledInt16 &operator-=(float value) { return *this = float(*this) - value; }
+	ScaledInt16 &operator*=(float value) { return *this = float(*this) * value; }
+
+	int16_t raw() const { return _raw; }
+
+	static int16_t fromFloat(float value)
+	{
+		const float scaled = value * (32767.f / static_cast<float>(Range));
+
+		// saturate, NAN maps to 0
+		if (scaled >= 32767.f) {
+			return 32767;
+
+		} else if (scaled <= -32767.f) {
+			return -32767;
+
+		} else if (scaled >= 0.f) {
+			return static_cast<int16_t>(scaled + 0.5f);
+
+		} else if (scaled < 0.f) {
+			return static_cast<int16_t>(scaled - 0.5f);
+		}
+
+		return 0;
+	}
+
+private:
+	int16_t _raw{0};
+};
+
+} // namespace math
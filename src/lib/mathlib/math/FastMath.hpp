@@ -0,0 +1,212 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file FastMath.hpp
+ *
+ * Branch free float approximations of the trigonometric and exponential
+ * functions for the control loops, where the libm implementations are slow
+ * on the FPU-only Cortex-M targets. The polynomials are the single precision
+ * minimax ones from Cephes, the errors below are checked in FunctionsTest.
+ *
+ * - sin, cos, sincos: absolute error < 2e-7 for |x| <= 1000 (range reduction
+ *   to [-pi/4, pi/4], the error grows with |x| beyond)
+ * - tan: relative error < 1e-6 away from the poles
+ * - atan2: absolute error < 3e-7 rad for finite inputs, atan2(0, 0) = 0
+ * - exp: relative error < 3e-7 for x in [-87, 88], saturates outside
+ *
+ * NAN and infinite inputs are not handled, use the libm functions where they
+ * can occur. The array versions apply the same approximation element-wise
+ * and are written so that the compiler can vectorize them.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace math
+{
+
+namespace fast
+{
+
+namespace detail
+{
+
+inline float roundToInt(float x, int32_t &k)
+{
+	k = static_cast<int32_t>(x + (x >= 0.f ? 0.5f : -0.5f));
+	return static_cast<float>(k);
+}
+
+// sin(r) and cos(r) for r in [-pi/4, pi/4]
+inline float sinPoly(float r)
+{
+	const float r2 = r * r;
+	return r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+}
+
+inline float cosPoly(float r)
+{
+	const float r2 = r * r;
+	return 1.f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+}
+
+// x - k * pi/2 with k the nearest integer, pi/2 split in three parts to keep the reduction exact for moderate |x|
+inline float reduceHalfPi(float x, int32_t &quadrant)
+{
+	const float k = roundToInt(x * 0.63661977236758134f, quadrant);
+	return ((x - k * 1.5703125f) - k * 4.837512969970703125e-4f) - k * 7.54978995489188216e-8f;
+}
+
+// atan(x) for x in [0, 1]
+inline float atanUnit(float x)
+{
+	// above tan(pi/8) use atan(x) = pi/4 + atan((x - 1) / (x + 1))
+	const bool upper = x > 0.4142135623730950f;
+	const float y = upper ? (x - 1.f) / (x + 1.f) : x;
+	const float z = y * y;
+	const float poly = (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * y + y;
+	return upper ? poly + 0.78539816339744831f : poly;
+}
+
+} // namespace detail
+
+inline void sincos(float x, float &s, float &c)
+{
+	int32_t quadrant;
+	const float r = detail::reduceHalfPi(x, quadrant);
+	const float sin_r = detail::sinPoly(r);
+	const float cos_r = detail::cosPoly(r);
+
+	// sin(r + k pi/2) and cos(r + k pi/2) are (-)sin(r) or (-)cos(r), depending on the quadrant
+	const bool swap = quadrant & 1;
+	const float sin_unsigned = swap ? cos_r : sin_r;
+	const float cos_unsigned = swap ? sin_r : cos_r;
+	s = (quadrant & 2) ? -sin_unsigned : sin_unsigned;
+	c = ((quadrant + 1) & 2) ? -cos_unsigned : cos_unsigned;
+}
+
+inline float sin(float x)
+{
+	float s;
+	float c;
+	sincos(x, s, c);
+	return s;
+}
+
+inline float cos(float x)
+{
+	float s;
+	float c;
+	sincos(x, s, c);
+	return c;
+}
+
+inline float tan(float x)
+{
+	float s;
+	float c;
+	sincos(x, s, c);
+	return s / c;
+}
+
+inline float atan2(float y, float x)
+{
+	const float abs_x = x < 0.f ? -x : x;
+	const float abs_y = y < 0.f ? -y : y;
+	const bool steep = abs_y > abs_x;
+	const float num = steep ? abs_x : abs_y;
+	const float den = steep ? abs_y : abs_x;
+
+	// atan2(0, 0) = 0 like libm, without dividing by zero
+	float angle = detail::atanUnit(den > 0.f ? num / den : 0.f);
+	angle = steep ? 1.57079632679489662f - angle : angle;
+	angle = x < 0.f ? 3.14159265358979324f - angle : angle;
+	return y < 0.f ? -angle : angle;
+}
+
+inline float exp(float x)
+{
+	x = x > 88.f ? 88.f : (x < -87.f ? -87.f : x);
+
+	// exp(x) = 2^k * exp(r) with |r| <= ln(2) / 2
+	int32_t k;
+	const float kf = detail::roundToInt(x * 1.44269504088896341f, k);
+	const float r = (x - kf * 0.693359375f) - kf * -2.12194440e-4f;
+
+	const float r2 = r * r;
+	const float poly = 1.f + r + r2 * (5.0000001201e-1f + r * (1.6666665459e-1f + r * (4.1665795894e-2f + r *
+					   (8.3334519073e-3f + r * (1.3981999507e-3f + r * 1.9875691500e-4f)))));
+
+	const uint32_t bits = static_cast<uint32_t>(k + 127) << 23;
+	float scale;
+	memcpy(&scale, &bits, sizeof(scale));
+	return poly * scale;
+}
+
+// element-wise versions, in and out may be the same array
+
+inline void sin(const float in[], float out[], int n)
+{
+	for (int i = 0; i < n; i++) {
+		out[i] = sin(in[i]);
+	}
+}
+
+inline void cos(const float in[], float out[], int n)
+{
+	for (int i = 0; i < n; i++) {
+		out[i] = cos(in[i]);
+	}
+}
+
+inline void atan2(const float y[], const float x[], float out[], int n)
+{
+	for (int i = 0; i < n; i++) {
+		out[i] = atan2(y[i], x[i]);
+	}
+}
+
+inline void exp(const float in[], float out[], int n)
+{
+	for (int i = 0; i < n; i++) {
+		out[i] = exp(in[i]);
+	}
+}
+
+} // namespace fast
+
+} // namespace math
@@ -32,6 +32,8 @@
  ****************************************************************************/
 
 #include <gtest/gtest.h>
+#include <cmath>
+#include "FastMath.hpp"
 #include "Functions.hpp"
 
 using namespace math;
@@ -238,3 +240,113 @@ TEST(FunctionsTest, isFiniteVector3f)
 	EXPECT_FALSE(isFinite(matrix::Vector3f(NAN, NAN, 0.f)));
 	EXPECT_FALSE(isFinite(matrix::Vector3f(NAN, NAN, NAN)));
 }
+
+TEST(FunctionsTest, fastSinCos)
+{
+	float max_error = 0.f;
+
+	for (float x = -1000.f; x <= 1000.f; x += 0.00731f) {
+		float s;
+		float c;
+		fast::sincos(x, s, c);
+		max_error = fmaxf(max_error, fabsf(s - static_cast<float>(std::sin(static_cast<double>(x)))));
+		max_error = fmaxf(max_error, fabsf(c - static_cast<float>(std::cos(static_cast<double>(x)))));
+		ASSERT_EQ(fast::sin(x), s);
+		ASSERT_EQ(fast::cos(x), c);
+	}
+
+	EXPECT_LT(max_error, 2e-7f);
+
+	// exact at the special points
+	EXPECT_EQ(fast::sin(0.f), 0.f);
+	EXPECT_EQ(fast::cos(0.f), 1.f);
+	EXPECT_NEAR(fast::sin(M_PI_2_F), 1.f, 1e-7f);
+}
+
+TEST(FunctionsTest, fastTan)
+{
+	float max_error = 0.f;
+
+	for (float x = -1.5f; x <= 1.5f; x += 0.000137f) {
+		const double expected = std::tan(static_cast<double>(x));
+		max_error = fmaxf(max_error, static_cast<float>(fabs((static_cast<double>(fast::tan(x)) - expected) / expected)));
+	}
+
+	EXPECT_LT(max_error, 1e-6f);
+}
+
+TEST(FunctionsTest, fastAtan2)
+{
+	float max_error = 0.f;
+
+	for (float y = -10.f; y <= 10.f; y += 0.0173f) {
+		for (float x = -10.f; x <= 10.f; x += 0.0191f) {
+			const double expected = std::atan2(static_cast<double>(y), static_cast<double>(x));
+			max_error = fmaxf(max_error, static_cast<float>(fabs(static_cast<double>(fast::atan2(y, x)) - expected)));
+		}
+	}
+
+	EXPECT_LT(max_error, 3e-7f);
+
+	EXPECT_EQ(fast::atan2(0.f, 0.f), 0.f);
+	EXPECT_EQ(fast::atan2(0.f, 1.f), 0.f);
+	EXPECT_NEAR(fast::atan2(1.f, 0.f), M_PI_2_F, 1e-7f);
+	EXPECT_NEAR(fast::atan2(-1.f, 0.f), -M_PI_2_F, 1e-7f);
+	EXPECT_NEAR(fast::atan2(0.f, -1.f), M_PI_F, 1e-7f);
+	EXPECT_NEAR(fast::atan2(-1.f, -1.f), -0.75f * M_PI_F, 1e-7f);
+}
+
+TEST(FunctionsTest, fastExp)
+{
+	float max_error = 0.f;
+
+	for (float x = -87.f; x <= 88.f; x += 0.00937f) {
+		const double expected = std::exp(static_cast<double>(x));
+		max_error = fmaxf(max_error, static_cast<float>(fabs((static_cast<double>(fast::exp(x)) - expected) / expected)));
+	}
+
+	EXPECT_LT(max_error, 3e-7f);
+
+	EXPECT_EQ(fast::exp(0.f), 1.f);
+	EXPECT_EQ(fast::exp(200.f), fast::exp(88.f));
+	EXPECT_EQ(fast::exp(-200.f), fast::exp(-87.f));
+}
+
+TEST(FunctionsTest, fastArray)
+{
+	static constexpr int N = 37;
+	float in[N];
+	float x[N];
+	float out[N];
+
+	for (int i = 0; i < N; i++) {
+		in[i] = -5.f + 0.3f * i;
+		x[i] = 1.f - 0.1f * i;
+	}
+
+	fast::sin(in, out, N);
+
+	for (int i = 0; i < N; i++) {
+		EXPECT_EQ(out[i], fast::sin(in[i]));
+	}
+
+	fast::cos(in, out, N);
+
+	for (int i = 0; i < N; i++) {
+		EXPECT_EQ(out[i], fast::cos(in[i]));
+	}
+
+	fast::atan2(in, x, out, N);
+
+	for (int i = 0; i < N; i++) {
+		EXPECT_EQ(out[i], fast::atan2(in[i], x[i]));
+	}
+
+	// in place
+	memcpy(out, in, sizeof(in));
+	fast::exp(out, out, N);
+
+	for (int i = 0; i < N; i++) {
+		EXPECT_EQ(out[i], fast::exp(in[i]));
+	}
+}
@@ -84,21 +84,14 @@ public:
 		}
 
 		// covariance
-		//  Kahan summation (upper triangle only)
+		//  Kahan summation (upper triangle only, the matrix is stored packed)
 		{
 			// eg C(x,y) += dx * (y - mean_y)
-			matrix::SquareMatrix<Type, N> m2_change{};
-
-			for (size_t r = 0; r < N; r++) {
-				for (size_t c = r; c < N; c++) {
-					m2_change(r, c) = delta(r) * (new_value(c) - _mean(c));
-				}
-			}
-
 			for (size_t r = 0; r < N; r++) {
 				for (size_t c = r; c < N; c++) {
+					const Type m2_change = delta(r) * (new_value(c) - _mean(c));
 
-					const Type y = m2_change(r, c) - _M2_accum(r, c);
+					const Type y = m2_change - _M2_accum(r, c);
 					const Type t = _M2(r, c) + y;
 					_M2_accum(r, c) = (t - _M2(r, c)) - y;
 
@@ -110,13 +103,6 @@ public:
 					_M2(r, r) = 0;
 				}
 			}
-
-			// make symmetric
-			for (size_t r = 0; r < N; r++) {
-				for (size_t c = r + 1; c < N; c++) {
-					_M2(c, r) = _M2(r, c);
-				}
-			}
 		}
 
 		if (!_M2.isAllFinite()) {
@@ -142,7 +128,7 @@ public:
 
 	matrix::Vector<Type, N> mean() const { return _mean; }
 	matrix::Vector<Type, N> variance() const { return _M2.diag() / (_count - 1); }
-	matrix::SquareMatrix<Type, N> covariance() const { return _M2 / (_count - 1); }
+	matrix::SquareMatrix<Type, N> covariance() const { return (_M2 / (_count - 1)).toSquareMatrix(); }
 
 	Type covariance(int x, int y) const { return _M2(x, y) / (_count - 1); }
 
@@ -151,8 +137,8 @@ private:
 	matrix::Vector<Type, N> _mean{};
 	matrix::Vector<Type, N> _mean_accum{};  ///< kahan summation algorithm accumulator for mean
 
-	matrix::SquareMatrix<Type, N> _M2{};
-	matrix::SquareMatrix<Type, N> _M2_accum{};    ///< kahan summation algorithm accumulator for M2
+	matrix::SymmetricMatrix<Type, N> _M2{};
+	matrix::SymmetricMatrix<Type, N> _M2_accum{};    ///< kahan summation algorithm accumulator for M2
 
 	uint16_t _count{0};
 };
@@ -116,6 +116,28 @@ public:
 		}
 	}
 
+	// Filter the samples of three independent channels in place, interleaved (see NotchFilter::applyArray3())
+	static void applyArray3(LowPassFilter2p<T> *const filters[3], T *const samples[3], int num_samples)
+	{
+		LowPassFilter2p<T> f0{*filters[0]};
+		LowPassFilter2p<T> f1{*filters[1]};
+		LowPassFilter2p<T> f2{*filters[2]};
+
+		T *const s0 = samples[0];
+		T *const s1 = samples[1];
+		T *const s2 = samples[2];
+
+		for (int n = 0; n < num_samples; n++) {
+			s0[n] = f0.apply(s0[n]);
+			s1[n] = f1.apply(s1[n]);
+			s2[n] = f2.apply(s2[n]);
+		}
+
+		*filters[0] = f0;
+		*filters[1] = f1;
+		*filters[2] = f2;
+	}
+
 	// Return the cutoff frequency
 	float get_cutoff_freq() const { return _cutoff_freq; }
 
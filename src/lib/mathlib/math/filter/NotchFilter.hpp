@@ -42,6 +42,7 @@
 
 #pragma once
 
+#include <mathlib/math/FastMath.hpp>
 #include <mathlib/math/Functions.hpp>
 #include <cmath>
 #include <float.h>
@@ -87,6 +88,57 @@ public:
 		}
 	}
 
+	/**
+	 * Filter the samples of three independent channels (e.g. the gyro axes) in place, each
+	 * channel with its own filter. The three recursions run interleaved in a single loop on
+	 * local copies of the coefficients and delay elements, so the state can stay in registers
+	 * and an in-order core doesn't stall on the latency of a single channel's recursion.
+	 * Disabled filters are skipped.
+	 */
+	static void applyArray3(NotchFilter<T> *const filters[3], T *const samples[3], int num_samples)
+	{
+		const bool enabled[3] {
+			filters[0]->getNotchFreq() > 0.f,
+			filters[1]->getNotchFreq() > 0.f,
+			filters[2]->getNotchFreq() > 0.f
+		};
+
+		if (!enabled[0] || !enabled[1] || !enabled[2]) {
+			for (int i = 0; i < 3; i++) {
+				if (enabled[i]) {
+					filters[i]->applyArray(samples[i], num_samples);
+				}
+			}
+
+			return;
+		}
+
+		for (int i = 0; i < 3; i++) {
+			if (!filters[i]->_initialized) {
+				filters[i]->reset(samples[i][0]);
+			}
+		}
+
+		// local copies of the coefficients and delay elements, they can't alias the samples
+		Channel c0{*filters[0]};
+		Channel c1{*filters[1]};
+		Channel c2{*filters[2]};
+
+		T *const s0 = samples[0];
+		T *const s1 = samples[1];
+		T *const s2 = samples[2];
+
+		for (int n = 0; n < num_samples; n++) {
+			s0[n] = c0.apply(s0[n]);
+			s1[n] = c1.apply(s1[n]);
+			s2[n] = c2.apply(s2[n]);
+		}
+
+		c0.store(*filters[0]);
+		c1.store(*filters[1]);
+		c2.store(*filters[2]);
+	}
+
 	float getNotchFreq() const { return _notch_freq; }
 	float getBandwidth() const { return _bandwidth; }
 
@@ -187,6 +239,38 @@ protected:
 		return output;
 	}
 
+	// coefficients and delay elements of one filter used by applyArray3()
+	struct Channel {
+		explicit Channel(const NotchFilter<T> &filter) :
+			b0(filter._b0), b1(filter._b1), b2(filter._b2), a1(filter._a1), a2(filter._a2),
+			x1(filter._delay_element_1), x2(filter._delay_element_2),
+			y1(filter._delay_element_output_1), y2(filter._delay_element_output_2)
+		{}
+
+		inline T apply(const T &sample)
+		{
+			const T output = b0 * sample + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+
+			x2 = x1;
+			x1 = sample;
+			y2 = y1;
+			y1 = output;
+
+			return output;
+		}
+
+		void store(NotchFilter<T> &filter) const
+		{
+			filter._delay_element_1 = x1;
+			filter._delay_element_2 = x2;
+			filter._delay_element_output_1 = y1;
+			filter._delay_element_output_2 = y2;
+		}
+
+		const float b0, b1, b2, a1, a2;
+		T x1, x2, y1, y2;
+	};
+
 	T _delay_element_1{};
 	T _delay_element_2{};
 	T _delay_element_output_1{};
@@ -239,9 +323,11 @@ bool NotchFilter<T>::setParameters(float sample_freq, float notch_freq, float ba
 
 		if (notch_freq_diff > FLT_EPSILON) {
 			// only notch frequency has changed
+			//  this is the path of the dynamic notches (ESC RPM, FFT) that retune every update,
+			//  the fast cosine is accurate to 2e-7, far below the precision of the tracked frequency
 			_notch_freq = notch_freq_new;
 
-			const float beta = -cosf(2.f * M_PI_F * _notch_freq / _sample_freq);
+			const float beta = -math::fast::cos(2.f * M_PI_F * _notch_freq / _sample_freq);
 
 			_b1 = 2.f * beta * _b0;
 			_a1 = _b1;
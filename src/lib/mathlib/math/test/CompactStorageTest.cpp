@@ -0,0 +1,114 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cfloat>
+#include <mathlib/math/CompactStorage.hpp>
+
+using namespace math;
+
+TEST(CompactStorageTest, float16Exact)
+{
+	// values representable in half precision round trip exactly
+	const float values[] {0.f, 1.f, -1.f, 0.5f, 2048.f, -0.000060975552f, 65504.f, -65504.f, 0.099975586f, 5.9604645e-08f};
+
+	for (float value : values) {
+		EXPECT_EQ(float(float16(value)), value);
+	}
+
+	EXPECT_EQ(float16(1.f).bits(), 0x3c00);
+	EXPECT_EQ(float16(-2.f).bits(), 0xc000);
+	EXPECT_EQ(float16(65504.f).bits(), 0x7bff);
+	EXPECT_EQ(float16(5.9604645e-08f).bits(), 0x0001); // smallest subnormal
+}
+
+TEST(CompactStorageTest, float16Rounding)
+{
+	// relative error of at most half an ulp (2^-11) in the normal range
+	for (float value = 6.2e-5f; value < 65000.f; value *= 1.0007f) {
+		EXPECT_LE(fabsf(float(float16(value)) - value), value * 0.00048829f) << value;
+		EXPECT_EQ(float(float16(-value)), -float(float16(value)));
+	}
+
+	// ties to even
+	EXPECT_EQ(float(float16(1.f + 0.00048828125f)), 1.f);
+	EXPECT_EQ(float(float16(1.f + 3.f * 0.00048828125f)), 1.f + 4.f * 0.00048828125f);
+
+	// overflow and underflow
+	EXPECT_TRUE(std::isinf(float(float16(70000.f))));
+	EXPECT_TRUE(std::isinf(float(float16(-INFINITY))));
+	EXPECT_TRUE(std::isnan(float(float16(NAN))));
+	EXPECT_EQ(float(float16(1e-9f)), 0.f);
+}
+
+TEST(CompactStorageTest, float16Arithmetic)
+{
+	float16 buffer[4] {};
+	buffer[0] = 3.f;
+	buffer[0] += 0.5f;
+	buffer[1] = buffer[0] * 2.f;
+	buffer[2] -= 0.25f;
+
+	EXPECT_EQ(float(buffer[0]), 3.5f);
+	EXPECT_EQ(float(buffer[1]), 7.f);
+	EXPECT_EQ(float(buffer[2]), -0.25f);
+	EXPECT_EQ(float(buffer[3]), 0.f);
+	EXPECT_EQ(sizeof(buffer), 8u);
+}
+
+TEST(CompactStorageTest, ScaledInt16)
+{
+	using Angle = ScaledInt16<4>;
+
+	EXPECT_FLOAT_EQ(Angle::resolution, 4.f / 32767.f);
+
+	for (float value = -4.f; value <= 4.f; value += 0.0013f) {
+		EXPECT_LE(fabsf(float(Angle(value)) - value), 0.5f * Angle::resolution + FLT_EPSILON) << value;
+	}
+
+	EXPECT_EQ(Angle(0.f).raw(), 0);
+	EXPECT_EQ(Angle(4.f).raw(), 32767);
+	EXPECT_EQ(Angle(-4.f).raw(), -32767);
+
+	// saturating
+	EXPECT_EQ(Angle(100.f).raw(), 32767);
+	EXPECT_EQ(Angle(-100.f).raw(), -32767);
+	EXPECT_EQ(Angle(NAN).raw(), 0);
+
+	Angle angle{1.f};
+	angle += 1.f;
+	EXPECT_NEAR(float(angle), 2.f, Angle::resolution);
+	EXPECT_EQ(sizeof(angle), 2u);
+}
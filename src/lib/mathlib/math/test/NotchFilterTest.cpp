@@ -347,3 +347,59 @@ TEST_F(NotchFilterTest, setCoefficients)
 		EXPECT_EQ(b[i], b_new[i]);
 	}
 }
+
+TEST_F(NotchFilterTest, applyArray3SameAsApplyArray)
+{
+	// three channels with different filters, one of them disabled part of the time
+	NotchFilter<float> reference[3];
+	NotchFilter<float> interleaved[3];
+	const float notch_freq[3] {50.f, 80.f, 120.f};
+
+	for (int i = 0; i < 3; i++) {
+		reference[i].setParameters(_sample_freq, notch_freq[i], _bandwidth);
+		interleaved[i].setParameters(_sample_freq, notch_freq[i], _bandwidth);
+	}
+
+	NotchFilter<float> *const filters[3] {&interleaved[0], &interleaved[1], &interleaved[2]};
+
+	const int N = 8;
+	float t = 0.f;
+
+	for (int batch = 0; batch < 100; batch++) {
+		if (batch == 40) {
+			reference[2].disable();
+			interleaved[2].disable();
+
+		} else if (batch == 60) {
+			reference[2].setParameters(_sample_freq, notch_freq[2], _bandwidth);
+			interleaved[2].setParameters(_sample_freq, notch_freq[2], _bandwidth);
+		}
+
+		float data_reference[3][N];
+		float data_interleaved[3][N];
+
+		for (int n = 0; n < N; n++) {
+			for (int i = 0; i < 3; i++) {
+				data_reference[i][n] = sinf(2.f * M_PI_F * 25.f * (i + 1) * t) + 0.3f * sinf(2.f * M_PI_F * notch_freq[i] * t);
+				data_interleaved[i][n] = data_reference[i][n];
+			}
+
+			t += 1.f / _sample_freq;
+		}
+
+		for (int i = 0; i < 3; i++) {
+			if (reference[i].getNotchFreq() > 0.f) {
+				reference[i].applyArray(data_reference[i], N);
+			}
+		}
+
+		float *const samples[3] {data_interleaved[0], data_interleaved[1], data_interleaved[2]};
+		NotchFilter<float>::applyArray3(filters, samples, N);
+
+		for (int i = 0; i < 3; i++) {
+			for (int n = 0; n < N; n++) {
+				EXPECT_FLOAT_EQ(data_interleaved[i][n], data_reference[i][n]) << "batch " << batch << " channel " << i;
+			}
+		}
+	}
+}
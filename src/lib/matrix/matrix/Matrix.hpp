@@ -13,6 +13,7 @@
 #include <cstring>
 
 #include "helper_functions.hpp"
+#include "kernels.hpp"
 #include "Slice.hpp"
 
 namespace matrix
@@ -23,6 +24,9 @@ class Matrix
 {
 	Type _data[M][N] {};
 
+	template<typename, size_t, size_t>
+	friend class Matrix;
+
 public:
 
 	// Constructors
@@ -158,13 +162,22 @@ public:
 	template<size_t P>
 	Matrix<Type, M, P> operator*(const Matrix<Type, N, P> &other) const
 	{
+		Matrix<Type, M, P> res;
+		detail::multiply(_data, other._data, res._data);
+		return res;
+	}
+
+	// Using this function reduces the number of temporary variables needed to compute A * B.T
+	template<size_t P>
+	Matrix<Type, M, M> multiplyByTranspose(const Matrix<Type, P, N> &other) const
+	{
+		Matrix<Type, M, P> res;
 		const Matrix<Type, M, N> &self = *this;
-		Matrix<Type, M, P> res{};
 
 		for (size_t i = 0; i < M; i++) {
 			for (size_t k = 0; k < P; k++) {
 				for (size_t j = 0; j < N; j++) {
-					res(i, k) += self(i, j) * other(j, k);
+					res(i, k) += self(i, j) * other(k, j);
 				}
 			}
 		}
@@ -172,17 +185,18 @@ public:
 		return res;
 	}
 
-	// Using this function reduces the number of temporary variables needed to compute A * B.T
+	// Computes A.T * B without the temporary for the transpose
 	template<size_t P>
-	Matrix<Type, M, M> multiplyByTranspose(const Matrix<Type, P, N> &other) const
+	Matrix<Type, N, P> transposeMultiply(const Matrix<Type, M, P> &other) const
 	{
-		Matrix<Type, M, P> res;
+		Matrix<Type, N, P> res;
 		const Matrix<Type, M, N> &self = *this;
 
+		// the inner sum runs in the same order as in A.T() * B
 		for (size_t i = 0; i < M; i++) {
-			for (size_t k = 0; k < P; k++) {
-				for (size_t j = 0; j < N; j++) {
-					res(i, k) += self(i, j) * other(k, j);
+			for (size_t j = 0; j < N; j++) {
+				for (size_t k = 0; k < P; k++) {
+					res(j, k) += self(i, j) * other(i, k);
 				}
 			}
 		}
@@ -190,6 +204,39 @@ public:
 		return res;
 	}
 
+	// Fused this += A * B, the product is accumulated in place without a temporary.
+	// A and B must not be this matrix.
+	template<size_t K>
+	void addProduct(const Matrix<Type, M, K> &a, const Matrix<Type, K, N> &b)
+	{
+		Matrix<Type, M, N> &self = *this;
+		assert(static_cast<const void *>(&a) != this && static_cast<const void *>(&b) != this);
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t k = 0; k < K; k++) {
+				for (size_t j = 0; j < N; j++) {
+					self(i, j) += a(i, k) * b(k, j);
+				}
+			}
+		}
+	}
+
+	// Fused this -= A * B, see addProduct()
+	template<size_t K>
+	void subtractProduct(const Matrix<Type, M, K> &a, const Matrix<Type, K, N> &b)
+	{
+		Matrix<Type, M, N> &self = *this;
+		assert(static_cast<const void *>(&a) != this && static_cast<const void *>(&b) != this);
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t k = 0; k < K; k++) {
+				for (size_t j = 0; j < N; j++) {
+					self(i, j) -= a(i, k) * b(k, j);
+				}
+			}
+		}
+	}
+
 	// Element-wise multiplication
 	Matrix<Type, M, N> emult(const Matrix<Type, M, N> &other) const
 	{
@@ -451,14 +498,7 @@ public:
 	Matrix<Type, N, M> transpose() const
 	{
 		Matrix<Type, N, M> res;
-		const Matrix<Type, M, N> &self = *this;
-
-		for (size_t i = 0; i < M; i++) {
-			for (size_t j = 0; j < N; j++) {
-				res(j, i) = self(i, j);
-			}
-		}
-
+		detail::transpose(_data, res._data);
 		return res;
 	}
 
@@ -125,4 +125,103 @@ SquareMatrix<Type, N> fullRankCholesky(const SquareMatrix<Type, N> &A,
 	return L;
 }
 
+
+/**
+ * Pseudoinverse of a matrix with full row rank from its precomputed Gram matrix,
+ * res = G^T * (G * G^T)^-1 using a Cholesky factorisation of the Gram matrix.
+ *
+ * This allows callers to maintain G * G^T incrementally (e.g. rank one updates for changed columns).
+ * Rows of G without any entries (zero diagonal of the Gram matrix) are excluded, the corresponding
+ * columns of the result are zero as with geninv().
+ *
+ * @return false if the remaining rows are rank deficient, res is not modified in that case
+ */
+template<typename Type, size_t M, size_t N>
+bool pinvGram(const Matrix<Type, M, N> &G, const SquareMatrix<Type, M> &GGt, Matrix<Type, N, M> &res)
+{
+	// same tolerance as fullRankCholesky()
+	const Type tol = M * typeEpsilon<Type>() * GGt.diag().max();
+
+	if (!(tol > Type())) {
+		return false;
+	}
+
+	bool active[M] {};
+
+	for (size_t i = 0; i < M; i++) {
+		active[i] = (GGt(i, i) > tol);
+	}
+
+	// Cholesky factorisation GGt = L * L^T of the active rows/columns
+	SquareMatrix<Type, M> L;
+
+	for (size_t j = 0; j < M; j++) {
+		if (!active[j]) {
+			continue;
+		}
+
+		Type d = GGt(j, j);
+
+		for (size_t k = 0; k < j; k++) {
+			d -= L(j, k) * L(j, k);
+		}
+
+		if (!(d > tol)) {
+			// rank deficient
+			return false;
+		}
+
+		L(j, j) = std::sqrt(d);
+
+		for (size_t i = j + 1; i < M; i++) {
+			if (active[i]) {
+				Type v = GGt(i, j);
+
+				for (size_t k = 0; k < j; k++) {
+					v -= L(i, k) * L(j, k);
+				}
+
+				L(i, j) = v / L(j, j);
+			}
+		}
+	}
+
+	// solve (L * L^T) * res^T = G column by column
+	for (size_t n = 0; n < N; n++) {
+		Type x[M] {};
+
+		// forward substitution
+		for (size_t i = 0; i < M; i++) {
+			if (active[i]) {
+				Type v = G(i, n);
+
+				for (size_t k = 0; k < i; k++) {
+					v -= L(i, k) * x[k];
+				}
+
+				x[i] = v / L(i, i);
+			}
+		}
+
+		// back substitution
+		for (size_t i = M; i-- > 0;) {
+			if (active[i]) {
+				Type v = x[i];
+
+				for (size_t k = i + 1; k < M; k++) {
+					v -= L(k, i) * x[k];
+				}
+
+				x[i] = v / L(i, i);
+			}
+		}
+
+		for (size_t i = 0; i < M; i++) {
+			res(n, i) = x[i];
+		}
+	}
+
+	return true;
+}
+
 } // namespace matrix
@@ -0,0 +1,328 @@
+/**
+ * @file SymmetricMatrix.hpp
+ *
+ * A symmetric matrix with packed storage of the upper triangle, e.g. for
+ * covariances. It stores N * (N + 1) / 2 instead of N * N elements and the
+ * updates only touch the upper triangle.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+
+#include "SquareMatrix.hpp"
+
+namespace matrix
+{
+
+template <typename Type, size_t N>
+class SymmetricMatrix
+{
+public:
+	static constexpr size_t SIZE = N * (N + 1) / 2;
+
+	SymmetricMatrix() = default;
+
+	// takes the upper triangle of the square matrix
+	explicit SymmetricMatrix(const Matrix<Type, N, N> &other)
+	{
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = i; j < N; j++) {
+				_data[index(i, j)] = other(i, j);
+			}
+		}
+	}
+
+	// element (i, j) and (j, i) are the same storage
+	inline const Type &operator()(size_t i, size_t j) const
+	{
+		assert(i < N);
+		assert(j < N);
+
+		return _data[index(i, j)];
+	}
+
+	inline Type &operator()(size_t i, size_t j)
+	{
+		assert(i < N);
+		assert(j < N);
+
+		return _data[index(i, j)];
+	}
+
+	SquareMatrix<Type, N> toSquareMatrix() const
+	{
+		SquareMatrix<Type, N> res;
+
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = i; j < N; j++) {
+				res(i, j) = res(j, i) = _data[index(i, j)];
+			}
+		}
+
+		return res;
+	}
+
+	// copy of a block, compatible with SquareMatrix::slice() for reading
+	template<size_t P, size_t Q>
+	Matrix<Type, P, Q> slice(size_t x0, size_t y0) const
+	{
+		static_assert(P <= N, "Slice rows bigger than matrix");
+		static_assert(Q <= N, "Slice cols bigger than matrix");
+		assert(x0 + P <= N);
+		assert(y0 + Q <= N);
+
+		Matrix<Type, P, Q> res;
+
+		for (size_t i = 0; i < P; i++) {
+			for (size_t j = 0; j < Q; j++) {
+				res(i, j) = (*this)(x0 + i, y0 + j);
+			}
+		}
+
+		return res;
+	}
+
+	// writes the block and, if it is off the diagonal, its mirror
+	template<size_t P, size_t Q>
+	void setSlice(size_t x0, size_t y0, const Matrix<Type, P, Q> &in)
+	{
+		static_assert(P <= N, "Slice rows bigger than matrix");
+		static_assert(Q <= N, "Slice cols bigger than matrix");
+		assert(x0 + P <= N);
+		assert(y0 + Q <= N);
+
+		for (size_t i = 0; i < P; i++) {
+			for (size_t j = 0; j < Q; j++) {
+				(*this)(x0 + i, y0 + j) = in(i, j);
+			}
+		}
+	}
+
+	void zero()
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] = Type(0);
+		}
+	}
+
+	void setIdentity()
+	{
+		zero();
+
+		for (size_t i = 0; i < N; i++) {
+			_data[index(i, i)] = Type(1);
+		}
+	}
+
+	Vector<Type, N> diag() const
+	{
+		Vector<Type, N> res;
+
+		for (size_t i = 0; i < N; i++) {
+			res(i) = _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	template <size_t Width>
+	Type trace(size_t first) const
+	{
+		static_assert(Width <= N, "Width bigger than matrix");
+		assert(first + Width <= N);
+
+		Type res = 0;
+
+		for (size_t i = first; i < (first + Width); i++) {
+			res += _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	Type trace() const
+	{
+		return trace<N>(0);
+	}
+
+	// this += alpha * v * v.T
+	void rankOneUpdate(Type alpha, const Vector<Type, N> &v)
+	{
+		size_t idx = 0;
+
+		for (size_t i = 0; i < N; i++) {
+			const Type alpha_vi = alpha * v(i);
+
+			for (size_t j = i; j < N; j++) {
+				_data[idx++] += alpha_vi * v(j);
+			}
+		}
+	}
+
+	// this += alpha * A * A.T
+	template<size_t K>
+	void rankKUpdate(Type alpha, const Matrix<Type, N, K> &a)
+	{
+		size_t idx = 0;
+
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = i; j < N; j++) {
+				Type sum = 0;
+
+				for (size_t k = 0; k < K; k++) {
+					sum += a(i, k) * a(j, k);
+				}
+
+				_data[idx++] += alpha * sum;
+			}
+		}
+	}
+
+	Vector<Type, N> operator*(const Vector<Type, N> &v) const
+	{
+		Vector<Type, N> res;
+
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = 0; j < N; j++) {
+				res(i) += (*this)(i, j) * v(j);
+			}
+		}
+
+		return res;
+	}
+
+	SymmetricMatrix<Type, N> operator*(Type scalar) const
+	{
+		SymmetricMatrix<Type, N> res(*this);
+		res *= scalar;
+		return res;
+	}
+
+	SymmetricMatrix<Type, N> operator/(Type scalar) const
+	{
+		return (*this) * (Type(1) / scalar);
+	}
+
+	SymmetricMatrix<Type, N> operator+(const SymmetricMatrix<Type, N> &other) const
+	{
+		SymmetricMatrix<Type, N> res(*this);
+		res += other;
+		return res;
+	}
+
+	SymmetricMatrix<Type, N> operator-(const SymmetricMatrix<Type, N> &other) const
+	{
+		SymmetricMatrix<Type, N> res(*this);
+		res -= other;
+		return res;
+	}
+
+	void operator+=(const SymmetricMatrix<Type, N> &other)
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] += other._data[i];
+		}
+	}
+
+	void operator-=(const SymmetricMatrix<Type, N> &other)
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] -= other._data[i];
+		}
+	}
+
+	void operator*=(Type scalar)
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			_data[i] *= scalar;
+		}
+	}
+
+	bool operator==(const SymmetricMatrix<Type, N> &other) const
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			if (!isEqualF(_data[i], other._data[i])) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool operator!=(const SymmetricMatrix<Type, N> &other) const
+	{
+		return !(*this == other);
+	}
+
+	bool isAllFinite() const
+	{
+		for (size_t i = 0; i < SIZE; i++) {
+			if (!std::isfinite(_data[i])) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// zero all offdiagonal elements and keep corresponding diagonal elements
+	template <size_t Width>
+	void uncorrelateCovariance(size_t first)
+	{
+		static_assert(Width <= N, "Width bigger than matrix");
+		assert(first + Width <= N);
+
+		for (size_t idx = first; idx < first + Width; idx++) {
+			uncorrelate(idx, _data[index(idx, idx)]);
+		}
+	}
+
+	template <size_t Width>
+	void uncorrelateCovarianceSetVariance(size_t first, const Vector<Type, Width> &vec)
+	{
+		static_assert(Width <= N, "Width bigger than matrix");
+		assert(first + Width <= N);
+
+		for (size_t idx = first; idx < first + Width; idx++) {
+			uncorrelate(idx, vec(idx - first));
+		}
+	}
+
+	template <size_t Width>
+	void uncorrelateCovarianceSetVariance(size_t first, Type val)
+	{
+		static_assert(Width <= N, "Width bigger than matrix");
+		assert(first + Width <= N);
+
+		for (size_t idx = first; idx < first + Width; idx++) {
+			uncorrelate(idx, val);
+		}
+	}
+
+	// packed storage, row by row of the upper triangle
+	const Type *data() const { return _data; }
+
+	static constexpr size_t index(size_t i, size_t j)
+	{
+		return (i <= j) ? (i * (2 * N - i - 1) / 2 + j) : (j * (2 * N - j - 1) / 2 + i);
+	}
+
+private:
+	// zero row and column idx and set the diagonal element
+	void uncorrelate(size_t idx, Type variance)
+	{
+		for (size_t k = 0; k < N; k++) {
+			_data[index(idx, k)] = Type(0);
+		}
+
+		_data[index(idx, idx)] = variance;
+	}
+
+	Type _data[SIZE] {};
+};
+
+using SymmetricMatrix3f = SymmetricMatrix<float, 3>;
+
+} // namespace matrix
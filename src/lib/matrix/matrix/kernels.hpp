@@ -0,0 +1,266 @@
+/**
+ * @file kernels.hpp
+ *
+ * Compile time sized kernels behind Matrix::operator* and Matrix::transpose.
+ *
+ * The generic scalar loops are the reference implementation. For float
+ * matrices with at least 4 columns in the result, the multiplication is
+ * vectorized over the columns with the SIMD extension the target is built
+ * for (SSE/AVX, NEON or Helium/MVE). Every lane accumulates its element in
+ * the same order as the scalar loop, so both paths give the same result up
+ * to the floating point contraction the compiler applies to the scalar code.
+ *
+ * Define MATRIX_NO_SIMD to always use the scalar reference.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#if !defined(MATRIX_NO_SIMD)
+# if defined(__SSE__)
+#  include <xmmintrin.h>
+#  define MATRIX_SIMD_SSE 1
+#  if defined(__AVX__)
+#   include <immintrin.h>
+#   define MATRIX_SIMD_AVX 1
+#  endif
+# elif defined(__ARM_NEON)
+#  include <arm_neon.h>
+#  define MATRIX_SIMD_NEON 1
+# elif defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2)
+#  include <arm_mve.h>
+#  define MATRIX_SIMD_MVE 1
+# endif
+#endif
+
+namespace matrix
+{
+
+namespace detail
+{
+
+// scalar reference: res = a * b
+template<typename Type, size_t M, size_t N, size_t P>
+void multiplyReference(const Type(&a)[M][N], const Type(&b)[N][P], Type(&res)[M][P])
+{
+	for (size_t i = 0; i < M; i++) {
+		for (size_t k = 0; k < P; k++) {
+			Type sum{};
+
+			for (size_t j = 0; j < N; j++) {
+				sum += a[i][j] * b[j][k];
+			}
+
+			res[i][k] = sum;
+		}
+	}
+}
+
+// scalar reference: res = a^T
+template<typename Type, size_t M, size_t N>
+void transposeReference(const Type(&a)[M][N], Type(&res)[N][M])
+{
+	for (size_t i = 0; i < M; i++) {
+		for (size_t j = 0; j < N; j++) {
+			res[j][i] = a[i][j];
+		}
+	}
+}
+
+#if defined(MATRIX_SIMD_SSE) || defined(MATRIX_SIMD_NEON) || defined(MATRIX_SIMD_MVE)
+
+static constexpr size_t simd_lanes = 4;
+
+struct Simd4f {
+#if defined(MATRIX_SIMD_SSE)
+	using Register = __m128;
+	static inline Register zero() { return _mm_setzero_ps(); }
+	static inline Register set1(float x) { return _mm_set1_ps(x); }
+	static inline Register load(const float *p) { return _mm_loadu_ps(p); }
+	static inline void store(float *p, Register x) { _mm_storeu_ps(p, x); }
+	static inline Register add(Register x, Register y) { return _mm_add_ps(x, y); }
+	static inline Register mul(Register x, Register y) { return _mm_mul_ps(x, y); }
+#else
+	// NEON and MVE share the names of these intrinsics
+	using Register = float32x4_t;
+	static inline Register zero() { return vdupq_n_f32(0.f); }
+	static inline Register set1(float x) { return vdupq_n_f32(x); }
+	static inline Register load(const float *p) { return vld1q_f32(p); }
+	static inline void store(float *p, Register x) { vst1q_f32(p, x); }
+	static inline Register add(Register x, Register y) { return vaddq_f32(x, y); }
+	static inline Register mul(Register x, Register y) { return vmulq_f32(x, y); }
+#endif
+};
+
+#if defined(MATRIX_SIMD_AVX)
+struct Simd8f {
+	using Register = __m256;
+	static inline Register zero() { return _mm256_setzero_ps(); }
+	static inline Register set1(float x) { return _mm256_set1_ps(x); }
+	static inline Register load(const float *p) { return _mm256_loadu_ps(p); }
+	static inline void store(float *p, Register x) { _mm256_storeu_ps(p, x); }
+	static inline Register add(Register x, Register y) { return _mm256_add_ps(x, y); }
+	static inline Register mul(Register x, Register y) { return _mm256_mul_ps(x, y); }
+};
+#endif
+
+// columns [k, k + Lanes) of row i of a * b, accumulated in a register over j
+template<typename Simd, size_t Lanes, size_t M, size_t N, size_t P>
+inline void multiplyColumns(const float(&a)[M][N], const float(&b)[N][P], float(&res)[M][P], size_t i, size_t &k)
+{
+	for (; k + Lanes <= P; k += Lanes) {
+		typename Simd::Register sum = Simd::zero();
+
+		for (size_t j = 0; j < N; j++) {
+			sum = Simd::add(sum, Simd::mul(Simd::set1(a[i][j]), Simd::load(&b[j][k])));
+		}
+
+		Simd::store(&res[i][k], sum);
+	}
+}
+
+template<size_t M, size_t N, size_t P>
+void multiplySimd(const float(&a)[M][N], const float(&b)[N][P], float(&res)[M][P])
+{
+	for (size_t i = 0; i < M; i++) {
+		size_t k = 0;
+#if defined(MATRIX_SIMD_AVX)
+		multiplyColumns<Simd8f, 8>(a, b, res, i, k);
+#endif
+		multiplyColumns<Simd4f, simd_lanes>(a, b, res, i, k);
+
+		for (; k < P; k++) {
+			float sum = 0.f;
+
+			for (size_t j = 0; j < N; j++) {
+				sum += a[i][j] * b[j][k];
+			}
+
+			res[i][k] = sum;
+		}
+	}
+}
+
+#else
+
+static constexpr size_t simd_lanes = 0;
+
+#endif
+
+#if defined(MATRIX_SIMD_SSE) || defined(MATRIX_SIMD_NEON)
+
+// transpose the 4x4 block at (i, j) of a into (j, i) of res
+template<size_t M, size_t N>
+inline void transposeBlock4(const float(&a)[M][N], float(&res)[N][M], size_t i, size_t j)
+{
+#if defined(MATRIX_SIMD_SSE)
+	__m128 r0 = _mm_loadu_ps(&a[i][j]);
+	__m128 r1 = _mm_loadu_ps(&a[i + 1][j]);
+	__m128 r2 = _mm_loadu_ps(&a[i + 2][j]);
+	__m128 r3 = _mm_loadu_ps(&a[i + 3][j]);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_storeu_ps(&res[j][i], r0);
+	_mm_storeu_ps(&res[j + 1][i], r1);
+	_mm_storeu_ps(&res[j + 2][i], r2);
+	_mm_storeu_ps(&res[j + 3][i], r3);
+#else
+	const float32x4x2_t t01 = vtrnq_f32(vld1q_f32(&a[i][j]), vld1q_f32(&a[i + 1][j]));
+	const float32x4x2_t t23 = vtrnq_f32(vld1q_f32(&a[i + 2][j]), vld1q_f32(&a[i + 3][j]));
+	vst1q_f32(&res[j][i], vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+	vst1q_f32(&res[j + 1][i], vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+	vst1q_f32(&res[j + 2][i], vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+	vst1q_f32(&res[j + 3][i], vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+#endif
+}
+
+template<size_t M, size_t N>
+void transposeSimd(const float(&a)[M][N], float(&res)[N][M])
+{
+	size_t i = 0;
+
+	for (; i + 4 <= M; i += 4) {
+		size_t j = 0;
+
+		for (; j + 4 <= N; j += 4) {
+			transposeBlock4(a, res, i, j);
+		}
+
+		for (; j < N; j++) {
+			for (size_t r = i; r < i + 4; r++) {
+				res[j][r] = a[r][j];
+			}
+		}
+	}
+
+	for (; i < M; i++) {
+		for (size_t j = 0; j < N; j++) {
+			res[j][i] = a[i][j];
+		}
+	}
+}
+
+static constexpr bool simd_transpose = true;
+
+#else
+
+static constexpr bool simd_transpose = false;
+
+#endif
+
+/**
+ * Kernel selection by template specialization: the primary templates are the
+ * scalar reference, the float specializations below use the SIMD backend for
+ * the sizes it pays off.
+ */
+template<typename Type, size_t M, size_t N, size_t P, bool Simd = false>
+struct Multiply {
+	static void run(const Type(&a)[M][N], const Type(&b)[N][P], Type(&res)[M][P])
+	{
+		multiplyReference(a, b, res);
+	}
+};
+
+template<typename Type, size_t M, size_t N, bool Simd = false>
+struct Transpose {
+	static void run(const Type(&a)[M][N], Type(&res)[N][M])
+	{
+		transposeReference(a, res);
+	}
+};
+
+#if defined(MATRIX_SIMD_SSE) || defined(MATRIX_SIMD_NEON) || defined(MATRIX_SIMD_MVE)
+template<size_t M, size_t N, size_t P>
+struct Multiply<float, M, N, P, true> {
+	static void run(const float(&a)[M][N], const float(&b)[N][P], float(&res)[M][P])
+	{
+		multiplySimd(a, b, res);
+	}
+};
+#endif
+
+#if defined(MATRIX_SIMD_SSE) || defined(MATRIX_SIMD_NEON)
+template<size_t M, size_t N>
+struct Transpose<float, M, N, true> {
+	static void run(const float(&a)[M][N], float(&res)[N][M])
+	{
+		transposeSimd(a, res);
+	}
+};
+#endif
+
+template<typename Type, size_t M, size_t N, size_t P>
+inline void multiply(const Type(&a)[M][N], const Type(&b)[N][P], Type(&res)[M][P])
+{
+	Multiply<Type, M, N, P, (simd_lanes > 0) && (P >= simd_lanes)>::run(a, b, res);
+}
+
+template<typename Type, size_t M, size_t N>
+inline void transpose(const Type(&a)[M][N], Type(&res)[N][M])
+{
+	Transpose<Type, M, N, simd_transpose && (M >= 4) && (N >= 4)>::run(a, res);
+}
+
+} // namespace detail
+
+} // namespace matrix
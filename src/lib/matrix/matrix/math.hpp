@@ -14,6 +14,7 @@
 #include "Slice.hpp"
 #include "SparseVector.hpp"
 #include "SquareMatrix.hpp"
+#include "SymmetricMatrix.hpp"
 #include "Vector.hpp"
 #include "Vector2.hpp"
 #include "Vector3.hpp"
@@ -0,0 +1,206 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Compare the (SIMD) kernels behind operator* and transpose() against the
+ * scalar reference, for the sizes used in the control allocation and the EKF,
+ * and print their run time.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+namespace
+{
+
+template<typename Type, size_t M, size_t N>
+Matrix<Type, M, N> fill(Type seed)
+{
+	Matrix<Type, M, N> res;
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t j = 0; j < N; j++) {
+			res(i, j) = Type(std::sin(seed + Type(i * N + j)));
+		}
+	}
+
+	return res;
+}
+
+template<typename Type, size_t M, size_t N, size_t P>
+Matrix<Type, M, P> multiplyReference(const Matrix<Type, M, N> &a, const Matrix<Type, N, P> &b)
+{
+	Type a_data[M][N];
+	Type b_data[N][P];
+	Type res_data[M][P];
+	a.copyTo(&a_data[0][0]);
+	b.copyTo(&b_data[0][0]);
+	detail::multiplyReference(a_data, b_data, res_data);
+	return Matrix<Type, M, P>(res_data);
+}
+
+template<typename Type, size_t M, size_t N, size_t P>
+void expectSameProduct()
+{
+	const Matrix<Type, M, N> a = fill<Type, M, N>(Type(0.1));
+	const Matrix<Type, N, P> b = fill<Type, N, P>(Type(0.7));
+	const Matrix<Type, M, P> res = a * b;
+	const Matrix<Type, M, P> res_reference = multiplyReference(a, b);
+
+	EXPECT_TRUE(isEqual(res, res_reference, Type(1e-5))) << M << "x" << N << " * " << N << "x" << P;
+}
+
+template<typename Type, size_t M, size_t N>
+void expectSameTranspose()
+{
+	const Matrix<Type, M, N> a = fill<Type, M, N>(Type(0.3));
+	const Matrix<Type, N, M> res = a.transpose();
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t j = 0; j < N; j++) {
+			EXPECT_EQ(res(j, i), a(i, j)) << M << "x" << N << " (" << i << ", " << j << ")";
+		}
+	}
+}
+
+template<size_t M, size_t N, size_t P>
+void benchmarkProduct(int iterations)
+{
+	const Matrix<float, M, N> a = fill<float, M, N>(0.1f);
+	Matrix<float, N, P> b = fill<float, N, P>(0.7f);
+	float a_data[M][N];
+	float b_data[N][P];
+	float res_data[M][P];
+	a.copyTo(&a_data[0][0]);
+	b.copyTo(&b_data[0][0]);
+	volatile float sink = 0.f;
+
+	const auto t0 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i++) {
+		b_data[0][0] = float(i);
+		detail::multiplyReference(a_data, b_data, res_data);
+		sink = sink + res_data[M - 1][P - 1];
+	}
+
+	const auto t1 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i++) {
+		b(0, 0) = float(i);
+		const Matrix<float, M, P> res = a * b;
+		sink = sink + res(M - 1, P - 1);
+	}
+
+	const auto t2 = std::chrono::steady_clock::now();
+
+	const double reference_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+	const double kernel_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / iterations;
+	printf("%zux%zu * %zux%zu: reference %.1f ns, operator* %.1f ns\n", M, N, N, P, reference_ns, kernel_ns);
+}
+
+template<size_t M, size_t N>
+void benchmarkTranspose(int iterations)
+{
+	Matrix<float, M, N> a = fill<float, M, N>(0.3f);
+	float a_data[M][N];
+	float res_data[N][M];
+	a.copyTo(&a_data[0][0]);
+	volatile float sink = 0.f;
+
+	const auto t0 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i++) {
+		a_data[M - 1][0] = float(i);
+		detail::transposeReference(a_data, res_data);
+		sink = sink + res_data[0][M - 1];
+	}
+
+	const auto t1 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < iterations; i++) {
+		a(M - 1, 0) = float(i);
+		const Matrix<float, N, M> res = a.transpose();
+		sink = sink + res(0, M - 1);
+	}
+
+	const auto t2 = std::chrono::steady_clock::now();
+
+	const double reference_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+	const double kernel_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / iterations;
+	printf("%zux%zu transpose: reference %.1f ns, transpose() %.1f ns\n", M, N, reference_ns, kernel_ns);
+}
+
+} // namespace
+
+TEST(MatrixBenchmark, productSameAsReference)
+{
+	// below, at and above the SIMD width and with column remainders
+	expectSameProduct<float, 3, 3, 3>();
+	expectSameProduct<float, 4, 4, 4>();
+	expectSameProduct<float, 5, 7, 9>();
+	expectSameProduct<float, 6, 16, 6>();
+	expectSameProduct<float, 16, 6, 16>();
+	expectSameProduct<float, 6, 16, 1>();
+	expectSameProduct<float, 24, 24, 24>();
+	expectSameProduct<float, 24, 24, 1>();
+	expectSameProduct<float, 2, 3, 13>();
+	expectSameProduct<double, 6, 16, 16>();
+}
+
+TEST(MatrixBenchmark, transposeSameAsReference)
+{
+	expectSameTranspose<float, 3, 3>();
+	expectSameTranspose<float, 4, 4>();
+	expectSameTranspose<float, 6, 16>();
+	expectSameTranspose<float, 16, 6>();
+	expectSameTranspose<float, 5, 9>();
+	expectSameTranspose<float, 24, 24>();
+	expectSameTranspose<float, 1, 24>();
+	expectSameTranspose<double, 6, 16>();
+}
+
+TEST(MatrixBenchmark, benchmark)
+{
+	static constexpr int kIterations = 20000;
+
+	benchmarkProduct<3, 3, 3>(kIterations);
+	benchmarkProduct<6, 16, 16>(kIterations);
+	benchmarkProduct<16, 6, 16>(kIterations);
+	benchmarkProduct<24, 24, 24>(kIterations / 10);
+	benchmarkTranspose<6, 16>(kIterations);
+	benchmarkTranspose<24, 24>(kIterations);
+}
@@ -98,3 +98,38 @@ TEST(MatrixMultiplicationTest, Multiplication)
 	Matrix<float, 4, 2> m42_plus2 = m42 - (-2);
 	EXPECT_EQ(m42_plus2, m42_plus2_check);
 }
+
+TEST(MatrixMultiplicationTest, FusedProducts)
+{
+	float data_43[12] = {1, 3, 2,
+			     2, 2, 1,
+			     5, 2, 1,
+			     2, 3, 4
+			    };
+	float data_42[8] = {2, 3,
+			    1, 7,
+			    5, 4,
+			    -1, 2
+			   };
+	float data_32[6] = {2, 3,
+			    1, 7,
+			    5, 4
+			   };
+
+	const Matrix<float, 4, 3> m43(data_43);
+	const Matrix<float, 4, 2> m42(data_42);
+	const Matrix<float, 3, 2> m32(data_32);
+
+	// A.T * B
+	const Matrix<float, 3, 2> m32_check = m43.transpose() * m42;
+	EXPECT_EQ(m43.transposeMultiply(m42), m32_check);
+
+	// C += A * B and C -= A * B
+	Matrix<float, 4, 2> sum = m42;
+	sum.addProduct(m43, m32);
+	EXPECT_EQ(sum, m42 + m43 * m32);
+
+	Matrix<float, 4, 2> difference = m42;
+	difference.subtractProduct(m43, m32);
+	EXPECT_EQ(difference, m42 - m43 * m32);
+}
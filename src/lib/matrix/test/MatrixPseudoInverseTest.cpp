@@ -173,3 +173,35 @@ TEST(MatrixPseudoInverseTest, PseudoInverse)
 	Matrix<float, 6, 5> real_pinv_expected(real_pinv_expected_alloc);
 	EXPECT_EQ(real_pinv, real_pinv_expected);
 }
+
+TEST(MatrixPseudoInverseTest, PseudoInverseGram)
+{
+	// full row rank 6x16 with two all-zero rows (eg. no x/y thrust) and zero columns
+	Matrix<float, 6, 16> B;
+
+	for (size_t i = 0; i < 8; i++) {
+		B(0, i) = (i % 2 ? 1.f : -1.f) * (0.5f + 0.1f * i);
+		B(1, i) = (i < 4 ? 1.f : -1.f) * (0.7f - 0.05f * i);
+		B(2, i) = ((i / 2) % 2 ? 0.05f : -0.05f) + 0.01f * i;
+		B(5, i) = -(1.f + 0.02f * i);
+	}
+
+	Matrix<float, 16, 6> A_geninv;
+	EXPECT_TRUE(geninv(B, A_geninv));
+
+	const SquareMatrix<float, 6> BBt = B * B.transpose();
+	Matrix<float, 16, 6> A;
+	EXPECT_TRUE(pinvGram(B, BBt, A));
+
+	EXPECT_TRUE(isEqual(A, A_geninv, 1e-4f));
+
+	// rank deficient: not modified
+	Matrix<float, 6, 16> B_deficient = B;
+	B_deficient.row(1) = B.row(0);
+	Matrix<float, 16, 6> A_deficient = A;
+	EXPECT_FALSE(pinvGram(B_deficient, SquareMatrix<float, 6>(B_deficient * B_deficient.transpose()), A_deficient));
+	EXPECT_EQ(A_deficient, A);
+
+	// all zero
+	EXPECT_FALSE(pinvGram(Matrix<float, 6, 16>(), SquareMatrix<float, 6>(), A));
+}
@@ -0,0 +1,143 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+using SquareMatrix4 = SquareMatrix<float, 4>;
+using SymmetricMatrix4 = SymmetricMatrix<float, 4>;
+
+static SquareMatrix4 symmetricTestMatrix()
+{
+	float data[16] = {4, 1, 2, 0.5f,
+			  1, 3, 0, 0.2f,
+			  2, 0, 5, 1,
+			  0.5f, 0.2f, 1, 2
+			 };
+	return SquareMatrix4(data);
+}
+
+TEST(MatrixSymmetricTest, PackedStorage)
+{
+	static_assert(sizeof(SymmetricMatrix<float, 24>) == 24 * 25 / 2 * sizeof(float), "packed storage");
+
+	const SquareMatrix4 A = symmetricTestMatrix();
+	SymmetricMatrix4 S(A);
+	EXPECT_EQ(S.toSquareMatrix(), A);
+	EXPECT_FLOAT_EQ(S(3, 2), 1.f);
+
+	// (i, j) and (j, i) share their storage
+	S(0, 3) = 7.f;
+	EXPECT_FLOAT_EQ(S(3, 0), 7.f);
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = i; j < 4; j++) {
+			EXPECT_EQ(&S(i, j), &S.data()[SymmetricMatrix4::index(i, j)]);
+		}
+	}
+
+	EXPECT_EQ(S.diag(), A.diag());
+	EXPECT_FLOAT_EQ(S.trace(), A.trace());
+	EXPECT_FLOAT_EQ(S.trace<2>(1), A.trace<2>(1));
+}
+
+TEST(MatrixSymmetricTest, Slice)
+{
+	const SquareMatrix4 A = symmetricTestMatrix();
+	const SymmetricMatrix4 S(A);
+
+	const Matrix<float, 2, 3> block = S.slice<2, 3>(1, 0);
+	const Matrix<float, 2, 3> block_check = A.slice<2, 3>(1, 0);
+	EXPECT_EQ(block, block_check);
+
+	// an off diagonal block also sets its mirror
+	SymmetricMatrix4 S2(A);
+	SquareMatrix4 A2 = A;
+	const Matrix<float, 2, 2> update = ones<float, 2, 2>() * 3.f;
+	S2.setSlice(2, 0, update);
+	A2.slice<2, 2>(2, 0) = update;
+	A2.slice<2, 2>(0, 2) = update.transpose();
+	EXPECT_EQ(S2.toSquareMatrix(), A2);
+}
+
+TEST(MatrixSymmetricTest, Updates)
+{
+	const SquareMatrix4 A = symmetricTestMatrix();
+	const Vector<float, 4> v(Vector4f(1.f, -2.f, 0.5f, 3.f));
+	const Matrix<float, 4, 1> v_col = v;
+
+	SymmetricMatrix4 S(A);
+	S.rankOneUpdate(-0.5f, v);
+	EXPECT_EQ(S.toSquareMatrix(), SquareMatrix4(A - v_col * v_col.transpose() * 0.5f));
+
+	float data[8] = {1, 2,
+			 0, 1,
+			 -1, 3,
+			 2, 0.5f
+			};
+	const Matrix<float, 4, 2> K(data);
+	SymmetricMatrix4 S2(A);
+	S2.rankKUpdate(2.f, K);
+	EXPECT_EQ(S2.toSquareMatrix(), SquareMatrix4(A + K * K.transpose() * 2.f));
+
+	EXPECT_EQ(SymmetricMatrix4(A) * v, A * v);
+	EXPECT_EQ((S + S2).toSquareMatrix(), SquareMatrix4(S.toSquareMatrix() + S2.toSquareMatrix()));
+	EXPECT_EQ((S2 / 2.f).toSquareMatrix(), SquareMatrix4(S2.toSquareMatrix() / 2.f));
+	EXPECT_TRUE(S.isAllFinite());
+}
+
+TEST(MatrixSymmetricTest, Uncorrelate)
+{
+	const SquareMatrix4 A = symmetricTestMatrix();
+
+	SymmetricMatrix4 S(A);
+	SquareMatrix4 A_check = A;
+	S.uncorrelateCovariance<2>(1);
+	A_check.uncorrelateCovariance<2>(1);
+	EXPECT_EQ(S.toSquareMatrix(), A_check);
+
+	S = SymmetricMatrix4(A);
+	A_check = A;
+	S.uncorrelateCovarianceSetVariance<2>(2, Vector2f(9.f, 8.f));
+	A_check.uncorrelateCovarianceSetVariance<2>(2, Vector2f(9.f, 8.f));
+	EXPECT_EQ(S.toSquareMatrix(), A_check);
+
+	S = SymmetricMatrix4(A);
+	A_check = A;
+	S.uncorrelateCovarianceSetVariance<1>(0, 0.1f);
+	A_check.uncorrelateCovarianceSetVariance<1>(0, 0.1f);
+	EXPECT_EQ(S.toSquareMatrix(), A_check);
+}
@@ -68,6 +68,11 @@ public:
 
 	virtual bool getLatestSampleTimestamp(hrt_abstime &t) const { return false; }
 
+	/**
+	 * Get the publication timestamp of the latest control data (to split the control latency into stages)
+	 */
+	virtual bool getLatestPublicationTimestamp(hrt_abstime &t) const { return false; }
+
 	/**
 	 * Check whether the output (motor) is configured to be reversible
 	 */
@@ -522,19 +522,22 @@ MixingOutput::limitAndUpdateOutputs(float outputs[MAX_ACTUATORS], bool has_updat
 
 uint16_t MixingOutput::output_limit_calc_single(int i, float value) const
 {
-	// check for invalid / disabled channels
-	if (!PX4_ISFINITE(value)) {
-		return _disarmed_value[i];
-	}
-
-	if (_reverse_output_mask & (1 << i)) {
-		value = -1.f * value;
-	}
-
-	const float output = math::interpolate(value, -1.f, 1.f,
-					       static_cast<float>(_min_value[i]), static_cast<float>(_max_value[i]));
-
-	return math::constrain(lroundf(output), 0L, static_cast<long>(UINT16_MAX));
+	// Branch-free so that the loop over all channels compiles to straight-line code:
+	// invalid / disabled channels are selected at the end, the interval [-1, 1] is mapped
+	// around the center of [min, max] with the reversal folded into the sign.
+	const bool valid = PX4_ISFINITE(value);
+	const float sign = (_reverse_output_mask & (1 << i)) ? -1.f : 1.f;
+	const float value_constrained = math::constrain(valid ? value : 0.f, -1.f, 1.f) * sign;
+
+	const float min_value = static_cast<float>(_min_value[i]);
+	const float max_value = static_cast<float>(_max_value[i]);
+	const float output = 0.5f * (min_value + max_value) + 0.5f * (max_value - min_value) * value_constrained;
+
+	// non-negative, rounding to nearest equals lroundf()
+	const uint16_t output_rounded = static_cast<uint16_t>(math::constrain(output, 0.f,
+					static_cast<float>(UINT16_MAX)) + 0.5f);
+
+	return valid ? output_rounded : _disarmed_value[i];
 }
 
 void
@@ -648,7 +651,62 @@ MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_output
 
 		if (_function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
 			perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - timestamp_sample);
+			updateLatencyHistogram(actuator_outputs.timestamp, timestamp_sample);
+		}
+	}
+}
+
+void
+MixingOutput::updateLatencyHistogram(hrt_abstime now, hrt_abstime timestamp_sample)
+{
+	// only count new control data (the outputs might be updated at a fixed rate)
+	if (timestamp_sample > _control_latency_last_sample && now >= timestamp_sample) {
+		_control_latency_last_sample = timestamp_sample;
+
+		const uint32_t latency = now - timestamp_sample;
+
+		if (_control_latency.sample_count == 0 || latency < _control_latency.latency_min_us) {
+			_control_latency.latency_min_us = latency;
 		}
+
+		_control_latency.latency_max_us = math::max(_control_latency.latency_max_us, latency);
+		_control_latency_sum += latency;
+
+		const uint32_t bin = math::min(latency / control_latency_s::BIN_WIDTH_US, (uint32_t)control_latency_s::NUM_BINS - 1);
+
+		if (_control_latency.histogram[bin] < UINT16_MAX) {
+			_control_latency.histogram[bin]++;
+		}
+
+		hrt_abstime timestamp_published;
+
+		if (_function_allocated[0]->getLatestPublicationTimestamp(timestamp_published)
+		    && timestamp_published >= timestamp_sample) {
+			const uint32_t allocation_latency = timestamp_published - timestamp_sample;
+			_control_latency.allocation_latency_max_us = math::max(_control_latency.allocation_latency_max_us,
+					allocation_latency);
+			_allocation_latency_sum += allocation_latency;
+		}
+
+		_control_latency.sample_count++;
+	}
+
+	if (_control_latency_window_start == 0) {
+		_control_latency_window_start = now;
+
+	} else if (now - _control_latency_window_start >= CONTROL_LATENCY_WINDOW) {
+		if (_control_latency.sample_count > 0) {
+			_control_latency.window_us = now - _control_latency_window_start;
+			_control_latency.latency_mean_us = (float)_control_latency_sum / _control_latency.sample_count;
+			_control_latency.allocation_latency_mean_us = (float)_allocation_latency_sum / _control_latency.sample_count;
+			_control_latency.timestamp = hrt_absolute_time();
+			_control_latency_pub.publish(_control_latency);
+		}
+
+		_control_latency = {};
+		_control_latency_sum = 0;
+		_allocation_latency_sum = 0;
+		_control_latency_window_start = now;
 	}
 }
 
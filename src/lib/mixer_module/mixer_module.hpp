@@ -58,6 +58,7 @@
 #include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/actuator_armed.h>
 #include <uORB/topics/actuator_outputs.h>
+#include <uORB/topics/control_latency.h>
 #include <uORB/topics/parameter_update.h>
 
 using namespace time_literals;
@@ -216,6 +217,7 @@ private:
 	void setAndPublishActuatorOutputs(unsigned num_outputs, actuator_outputs_s &actuator_outputs);
 	void publishMixerStatus(const actuator_outputs_s &actuator_outputs);
 	void updateLatencyPerfCounter(const actuator_outputs_s &actuator_outputs);
+	void updateLatencyHistogram(hrt_abstime now, hrt_abstime timestamp_sample);
 
 	void cleanupFunctions();
 
@@ -257,6 +259,14 @@ private:
 	uORB::Subscription _armed_sub{ORB_ID(actuator_armed)};
 
 	uORB::PublicationMulti<actuator_outputs_s> _outputs_pub{ORB_ID(actuator_outputs)};
+	uORB::PublicationMulti<control_latency_s> _control_latency_pub{ORB_ID(control_latency)};
+
+	static constexpr hrt_abstime CONTROL_LATENCY_WINDOW{1_s};
+	control_latency_s _control_latency{}; ///< statistics of the current window
+	hrt_abstime _control_latency_window_start{0};
+	hrt_abstime _control_latency_last_sample{0}; ///< timestamp_sample of the last counted control update
+	uint64_t _control_latency_sum{0};
+	uint64_t _allocation_latency_sum{0};
 
 	actuator_armed_s _armed{};
 
@@ -82,7 +82,46 @@ bool PositionSmoothing::_isTurning(const Vector3f &target) const
 		&& pos_to_target.longerThan(_target_acceptance_radius));
 }
 
-float PositionSmoothing::_getMaxXYSpeed(const Vector3f(&waypoints)[3]) const
+void PositionSmoothing::setLookaheadWaypoints(const Vector3f waypoints[], int num_waypoints)
+{
+	_num_lookahead_waypoints = math::constrain(num_waypoints, 0, MAX_LOOKAHEAD_WAYPOINTS);
+
+	for (int i = 0; i < _num_lookahead_waypoints; i++) {
+		_lookahead_waypoints[i] = waypoints[i];
+	}
+
+	_lookahead_speed_at_next = NAN;
+}
+
+float PositionSmoothing::_getLookaheadSpeedAtNext(const Vector3f(&waypoints)[3],
+		const math::trajectory::VehicleDynamicLimits &config)
+{
+	if ((_num_lookahead_waypoints < 3)
+	    || (waypoints[1] != _lookahead_waypoints[0])
+	    || (waypoints[2] != _lookahead_waypoints[1])) {
+		// no lookahead for these waypoints, stop at the next one
+		return 0.f;
+	}
+
+	const bool limits_changed = !matrix::isEqualF(config.xy_accept_rad, _lookahead_limits.xy_accept_rad)
+				    || !matrix::isEqualF(config.max_acc_xy, _lookahead_limits.max_acc_xy)
+				    || !matrix::isEqualF(config.max_jerk, _lookahead_limits.max_jerk)
+				    || !matrix::isEqualF(config.max_speed_xy, _lookahead_limits.max_speed_xy)
+				    || !matrix::isEqualF(config.max_acc_xy_radius_scale, _lookahead_limits.max_acc_xy_radius_scale);
+
+	if (!PX4_ISFINITE(_lookahead_speed_at_next) || limits_changed) {
+		// backwards through the lookahead: speed leaving the next waypoint, then the speed to turn there
+		const float exit_speed = math::trajectory::computeXYSpeedFromWaypoints(&_lookahead_waypoints[1],
+					 _num_lookahead_waypoints - 1, config);
+		_lookahead_speed_at_next = math::trajectory::computeXYSpeedAtWaypoint(_lookahead_waypoints[0],
+					   _lookahead_waypoints[1], _lookahead_waypoints[2], exit_speed, config);
+		_lookahead_limits = config;
+	}
+
+	return _lookahead_speed_at_next;
+}
+
+float PositionSmoothing::_getMaxXYSpeed(const Vector3f(&waypoints)[3])
 {
 	Vector3f pos_traj(_trajectory[0].getCurrentPosition(),
 			  _trajectory[1].getCurrentPosition(),
@@ -101,7 +140,8 @@ float PositionSmoothing::_getMaxXYSpeed(const Vector3f(&waypoints)[3]) const
 
 	Vector3f pos_to_waypoints[3] = {pos_traj, waypoints[1], waypoints[2]};
 
-	return math::trajectory::computeXYSpeedFromWaypoints<3>(pos_to_waypoints, config);
+	return math::trajectory::computeXYSpeedFromWaypoints(pos_to_waypoints, 3, config,
+			_getLookaheadSpeedAtNext(waypoints, config));
 }
 
 float PositionSmoothing::_getMaxZSpeed(const Vector3f(&waypoints)[3]) const
@@ -319,3 +359,25 @@ void PositionSmoothing::_generateTrajectory(
 
 	VelocitySmoothing::timeSynchronization(_trajectory, 3);
 }
+
+void PositionSmoothing::evaluateTrajectory(const float times[], PositionSmoothingSetpoints out_setpoints[], int n) const
+{
+	static constexpr int batch_size = 8;
+	Trajectory traj[batch_size];
+
+	for (int first = 0; first < n; first += batch_size) {
+		const int count = math::min(n - first, batch_size);
+
+		for (int i = 0; i < 3; ++i) {
+			_trajectory[i].evaluate(&times[first], traj, count);
+
+			for (int k = 0; k < count; ++k) {
+				PositionSmoothingSetpoints &setpoints = out_setpoints[first + k];
+				setpoints.jerk(i) = traj[k].j;
+				setpoints.acceleration(i) = traj[k].a;
+				setpoints.velocity(i) = traj[k].v;
+				setpoints.position(i) = traj[k].x;
+			}
+		}
+	}
+}
@@ -35,6 +35,7 @@
 
 #include <cmath>
 #include <motion_planning/VelocitySmoothing.hpp>
+#include <motion_planning/TrajectoryConstraints.hpp>
 
 #include <matrix/matrix/math.hpp>
 #include <px4_defines.h>
@@ -363,6 +364,19 @@ public:
 		_target_acceptance_radius = radius;
 	}
 
+	static constexpr int MAX_LOOKAHEAD_WAYPOINTS = 8;
+
+	/**
+	 * @brief Set the waypoints following the target, so the next waypoint can be passed faster if
+	 * the path after it allows. Used while the target and next waypoint given to generateSetpoints()
+	 * are the first two of them. The speed at the next waypoint is computed once and only again
+	 * if the limits change.
+	 *
+	 * @param waypoints target, next waypoint and the ones after it, the vehicle stops at the last one
+	 * @param num_waypoints number of waypoints, at most MAX_LOOKAHEAD_WAYPOINTS, less than 3 disables the lookahead
+	 */
+	void setLookaheadWaypoints(const Vector3f waypoints[], int num_waypoints);
+
 	/**
 	 * @brief Set the current position in the trajectory to the given value.
 	 * Any coordinate with NAN will not be set
@@ -408,6 +422,15 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Evaluate the trajectory ahead of the current setpoints, e.g. as lookahead for avoidance or
+	 * time estimates. Assumes the last velocity setpoint and no time stretching.
+	 *
+	 * @param times Times from the current setpoints [s]
+	 * @param out_setpoints Output of the setpoints at the given times (without unsmoothed_velocity), same size as times
+	 * @param n Number of times
+	 */
+	void evaluateTrajectory(const float times[], PositionSmoothingSetpoints out_setpoints[], int n) const;
 
 private:
 	/* params, only modified from external */
@@ -422,6 +445,11 @@ private:
 	VelocitySmoothing _trajectory[3]; ///< Trajectories in x, y and z directions
 	float _max_speed_previous{0.f};
 
+	Vector3f _lookahead_waypoints[MAX_LOOKAHEAD_WAYPOINTS] {};
+	int _num_lookahead_waypoints{0};
+	math::trajectory::VehicleDynamicLimits _lookahead_limits{}; ///< limits _lookahead_speed_at_next was computed with
+	float _lookahead_speed_at_next{NAN}; ///< maximum XY speed at the next waypoint, NAN if not computed yet
+
 	/* Internal functions */
 	bool _isTurning(const Vector3f &target) const;
 
@@ -440,7 +468,8 @@ private:
 			const Vector3f &feedforward_velocity_setpoint);
 	const Vector3f _getL1Point(const Vector3f &position, const Vector3f(&waypoints)[3]) const;
 	const Vector3f _getCrossingPoint(const Vector3f &position, const Vector3f(&waypoints)[3]) const;
-	float _getMaxXYSpeed(const Vector3f(&waypoints)[3]) const;
+	float _getMaxXYSpeed(const Vector3f(&waypoints)[3]);
+	float _getLookaheadSpeedAtNext(const Vector3f(&waypoints)[3], const math::trajectory::VehicleDynamicLimits &config);
 	float _getMaxZSpeed(const Vector3f(&waypoints)[3]) const;
 
 	void _generateTrajectory(
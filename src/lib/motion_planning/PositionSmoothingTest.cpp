@@ -193,3 +193,39 @@ TEST_F(PositionSmoothingTest, reachesTargetInitialVelocity)
 	EXPECT_LT(fabsf(position(2) - TARGET(2)), Z_ACC_RAD);
 	EXPECT_LT(iteration, N_ITER) << "Took too long to converge\n";
 }
+
+TEST_F(PositionSmoothingTest, lookaheadAllowsHigherSpeed)
+{
+	const float DELTA_T = 0.02f;
+	const Vector3f INITIAL_POSITION{0.f, 0.f, 0.f};
+	const Vector3f FF_VELOCITY{0.f, 0.f, 0.f};
+	const Vector3f TARGET{2.f, 0.f, 0.f};
+	const Vector3f NEXT_TARGET{4.f, 0.f, 0.f};
+
+	Vector3f waypoints[3] = {INITIAL_POSITION, TARGET, NEXT_TARGET};
+	PositionSmoothing::PositionSmoothingSetpoints out;
+
+	// GIVEN: no lookahead, the vehicle has to stop at the next target
+	_position_smoothing.generateSetpoints(INITIAL_POSITION, waypoints, FF_VELOCITY, DELTA_T, false, out);
+	const float speed_without_lookahead = out.unsmoothed_velocity.xy().norm();
+
+	// WHEN: the path continues in a straight line after the next target
+	const Vector3f lookahead[] = {TARGET, NEXT_TARGET, {6.f, 0.f, 0.f}, {8.f, 0.f, 0.f}, {10.f, 0.f, 0.f}};
+	_position_smoothing.reset({0.f, 0.f, 0.f}, {0.f, 0.f, 0.f}, INITIAL_POSITION);
+	_position_smoothing.setLookaheadWaypoints(lookahead, 5);
+	_position_smoothing.generateSetpoints(INITIAL_POSITION, waypoints, FF_VELOCITY, DELTA_T, false, out);
+	const float speed_with_lookahead = out.unsmoothed_velocity.xy().norm();
+
+	// THEN: the vehicle is allowed to go faster, but not faster than the cruise speed
+	EXPECT_GT(speed_with_lookahead, speed_without_lookahead);
+	EXPECT_LE(speed_with_lookahead, CRUISE_SPEED);
+
+	// WHEN: the lookahead doesn't start at the current target
+	const Vector3f other_lookahead[] = {NEXT_TARGET, {6.f, 0.f, 0.f}, {8.f, 0.f, 0.f}};
+	_position_smoothing.reset({0.f, 0.f, 0.f}, {0.f, 0.f, 0.f}, INITIAL_POSITION);
+	_position_smoothing.setLookaheadWaypoints(other_lookahead, 3);
+	_position_smoothing.generateSetpoints(INITIAL_POSITION, waypoints, FF_VELOCITY, DELTA_T, false, out);
+
+	// THEN: it is ignored
+	EXPECT_FLOAT_EQ(out.unsmoothed_velocity.xy().norm(), speed_without_lookahead);
+}
@@ -66,9 +66,12 @@ struct VehicleDynamicLimits {
  * This is not exactly true in reality since Navigator switches the waypoint so we have to take in account that
  * the real acceptance radius is smaller.
  *
+ * @param exit_speed the maximum speed at the target to continue towards next_target
+ *
+ * @return the maximum speed at the target, zero if the vehicle has to stop there
  */
-inline float computeStartXYSpeedFromWaypoints(const Vector3f &start_position, const Vector3f &target,
-		const Vector3f &next_target, float exit_speed, const VehicleDynamicLimits &config)
+inline float computeXYSpeedAtWaypoint(const Vector3f &start_position, const Vector3f &target,
+				      const Vector3f &next_target, float exit_speed, const VehicleDynamicLimits &config)
 {
 	const float distance_target_next = (target - next_target).xy().norm();
 
@@ -88,6 +91,18 @@ inline float computeStartXYSpeedFromWaypoints(const Vector3f &start_position, co
 		speed_at_target = min(max_speed_in_turn, exit_speed, config.max_speed_xy);
 	}
 
+	return speed_at_target;
+}
+
+/*
+ * Compute the maximum speed at start_position such that the vehicle can still pass the target
+ * with the speed given by computeXYSpeedAtWaypoint()
+ */
+inline float computeStartXYSpeedFromWaypoints(const Vector3f &start_position, const Vector3f &target,
+		const Vector3f &next_target, float exit_speed, const VehicleDynamicLimits &config)
+{
+	const float speed_at_target = computeXYSpeedAtWaypoint(start_position, target, next_target, exit_speed, config);
+
 	float start_to_target = (start_position - target).xy().norm();
 	float max_speed = computeMaxSpeedFromDistance(config.max_jerk, config.max_acc_xy, start_to_target, speed_at_target);
 
@@ -100,28 +115,43 @@ inline float computeStartXYSpeedFromWaypoints(const Vector3f &start_position, co
  * The first waypoint should be the starting location, and the later waypoints the desired points to be followed.
  *
  * @param waypoints the list of waypoints to be followed, the first of which should be the starting location
+ * @param num_waypoints the number of waypoints, at least 2
  * @param config the vehicle dynamic limits
+ * @param final_speed the maximum speed at the last waypoint, zero to stop there
  *
  * @return the maximum speed at waypoint[0] which allows it to follow the trajectory while respecting the dynamic limits
  */
-template <int N>
-float computeXYSpeedFromWaypoints(const Vector3f waypoints[N], const VehicleDynamicLimits &config)
+inline float computeXYSpeedFromWaypoints(const Vector3f waypoints[], int num_waypoints,
+		const VehicleDynamicLimits &config, float final_speed = 0.f)
 {
-	static_assert(N >= 2, "Need at least 2 points to compute speed");
+	if (num_waypoints < 2) {
+		return 0.f;
+	}
 
-	float max_speed = 0.f;
+	// last segment: arrive at the last waypoint with at most final_speed
+	const float last_distance = (waypoints[num_waypoints - 2] - waypoints[num_waypoints - 1]).xy().norm();
+	float max_speed = min(config.max_speed_xy, computeMaxSpeedFromDistance(config.max_jerk, config.max_acc_xy,
+			      last_distance, min(final_speed, config.max_speed_xy)));
 
 	// go backwards through the waypoints
-	for (int i = (N - 2); i >= 0; i--) {
+	for (int i = (num_waypoints - 3); i >= 0; i--) {
 		max_speed = computeStartXYSpeedFromWaypoints(waypoints[i],
 				waypoints[i + 1],
-				waypoints[min(i + 2, N - 1)],
+				waypoints[i + 2],
 				max_speed, config);
 	}
 
 	return max_speed;
 }
 
+template <int N>
+float computeXYSpeedFromWaypoints(const Vector3f waypoints[N], const VehicleDynamicLimits &config)
+{
+	static_assert(N >= 2, "Need at least 2 points to compute speed");
+
+	return computeXYSpeedFromWaypoints(waypoints, N, config);
+}
+
 /*
  * Constrain the 3D vector given a maximum XY norm
  * If the XY norm of the 3D vector is larger than the maximum norm, the whole vector
@@ -53,6 +53,7 @@ void VelocitySmoothing::reset(float accel, float vel, float pos)
 	_state.x = pos;
 
 	_state_init = _state;
+	_durations_valid = false;
 }
 
 float VelocitySmoothing::saturateT1ForAccel(float a0, float j_max, float T1, float a_max) const
@@ -163,12 +164,49 @@ float VelocitySmoothing::computeT3(float T1, float a0, float j_max) const
 void VelocitySmoothing::updateDurations(float vel_setpoint)
 {
 	_vel_sp = math::constrain(vel_setpoint, -_max_vel, _max_vel);
+
+	// the current state is on the previous solution: its remaining part is the solution from here
+	bool unchanged = _durations_valid && (_vel_sp == _solved_vel_sp) && (_max_jerk == _solved_max_jerk)
+			 && (_max_accel == _solved_max_accel);
+
+	if (unchanged) {
+		consumeDurations(_local_time);
+
+		// once finished, solve again to remove the numerical drift from the setpoint
+		unchanged = (getTotalTime() > 0.f);
+	}
+
+	if (!unchanged) {
+		_state_init = _state;
+		_direction = computeDirection();
+		updateDurationsMinimizeTotalTime();
+
+		_durations_valid = true;
+		_solved_vel_sp = _vel_sp;
+		_solved_max_jerk = _max_jerk;
+		_solved_max_accel = _max_accel;
+	}
+
 	_local_time = 0.f;
 	_state_init = _state;
+}
+
+void VelocitySmoothing::consumeDurations(float t)
+{
+	const float t1 = math::min(t, _T1);
+	_T1 -= t1;
+	t -= t1;
 
-	_direction = computeDirection();
+	const float t2 = math::min(t, _T2);
+	_T2 -= t2;
+	t -= t2;
 
-	updateDurationsMinimizeTotalTime();
+	_T3 -= math::min(t, _T3);
+
+	if (_T1 > 0.f) {
+		// the acceleration limit applies to the current state, like in the solver
+		_T1 = math::max(saturateT1ForAccel(_state.a, _direction * _max_jerk, _T1, _max_accel), 0.f);
+	}
 }
 
 int VelocitySmoothing::computeDirection() const
@@ -240,26 +278,59 @@ Trajectory VelocitySmoothing::evaluatePoly(float j, float a0, float v0, float x0
 void VelocitySmoothing::updateTraj(float dt, float time_stretch)
 {
 	_local_time += dt * time_stretch;
-	float t_remain = _local_time;
+	_state = evaluateLocal(_local_time);
+}
+
+Trajectory VelocitySmoothing::evaluateLocal(float local_time) const
+{
+	float t_remain = local_time;
 
 	float t1 = math::min(t_remain, _T1);
-	_state = evaluatePoly(_max_jerk, _state_init.a, _state_init.v, _state_init.x, t1, _direction);
+	Trajectory state = evaluatePoly(_max_jerk, _state_init.a, _state_init.v, _state_init.x, t1, _direction);
 	t_remain -= t1;
 
 	if (t_remain > 0.f) {
 		float t2 = math::min(t_remain, _T2);
-		_state = evaluatePoly(0.f, _state.a, _state.v, _state.x, t2, 0.f);
+		state = evaluatePoly(0.f, state.a, state.v, state.x, t2, 0.f);
 		t_remain -= t2;
 	}
 
 	if (t_remain > 0.f) {
 		float t3 = math::min(t_remain, _T3);
-		_state = evaluatePoly(_max_jerk, _state.a, _state.v, _state.x, t3, -_direction);
+		state = evaluatePoly(_max_jerk, state.a, state.v, state.x, t3, -_direction);
 		t_remain -= t3;
 	}
 
 	if (t_remain > 0.f) {
-		_state = evaluatePoly(0.f, 0.f, _state.v, _state.x, t_remain, 0.f);
+		state = evaluatePoly(0.f, 0.f, state.v, state.x, t_remain, 0.f);
+	}
+
+	return state;
+}
+
+void VelocitySmoothing::evaluate(const float t[], Trajectory out[], int n) const
+{
+	// the state at the phase boundaries is the same for all times, only evaluate it once
+	Trajectory boundary[3];
+	boundary[0] = evaluatePoly(_max_jerk, _state_init.a, _state_init.v, _state_init.x, _T1, _direction);
+	boundary[1] = evaluatePoly(0.f, boundary[0].a, boundary[0].v, boundary[0].x, _T2, 0.f);
+	boundary[2] = evaluatePoly(_max_jerk, boundary[1].a, boundary[1].v, boundary[1].x, _T3, -_direction);
+
+	for (int i = 0; i < n; i++) {
+		const float local_time = _local_time + t[i];
+
+		if (local_time <= _T1) {
+			out[i] = evaluatePoly(_max_jerk, _state_init.a, _state_init.v, _state_init.x, local_time, _direction);
+
+		} else if (local_time <= _T1 + _T2) {
+			out[i] = evaluatePoly(0.f, boundary[0].a, boundary[0].v, boundary[0].x, local_time - _T1, 0.f);
+
+		} else if (local_time <= _T1 + _T2 + _T3) {
+			out[i] = evaluatePoly(_max_jerk, boundary[1].a, boundary[1].v, boundary[1].x, local_time - _T1 - _T2, -_direction);
+
+		} else {
+			out[i] = evaluatePoly(0.f, 0.f, boundary[2].v, boundary[2].x, local_time - _T1 - _T2 - _T3, 0.f);
+		}
 	}
 }
 
@@ -289,6 +360,9 @@ void VelocitySmoothing::timeSynchronization(VelocitySmoothing *traj, int n_traj)
 
 void VelocitySmoothing::updateDurationsGivenTotalTime(float T123)
 {
+	// the stretched solution is not the minimum time one, solve again on the next update
+	_durations_valid = false;
+
 	float jerk_max_T1 = _direction * _max_jerk;
 	float delta_v = _vel_sp - _state.v;
 
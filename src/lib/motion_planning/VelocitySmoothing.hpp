@@ -75,6 +75,8 @@ public:
 	/**
 	 * Compute T1, T2, T3 depending on the current state and velocity setpoint. This should be called on every cycle
 	 * and before updateTraj().
+	 * If the setpoint and the constraints did not change and the state follows the previous solution, the
+	 * remaining part of that solution is reused instead of solving again.
 	 * @param vel_setpoint velocity setpoint input
 	 */
 	void updateDurations(float vel_setpoint);
@@ -87,6 +89,21 @@ public:
 	 */
 	void updateTraj(float dt, float time_stretch = 1.f);
 
+	/**
+	 * Evaluate the trajectory ahead of the current state, without modifying it. After the end of the
+	 * profile, the velocity setpoint is kept.
+	 * @param t time from the current state [s]
+	 */
+	Trajectory evaluate(float t) const { return evaluateLocal(_local_time + t); }
+
+	/**
+	 * Evaluate the trajectory ahead of the current state at several times, see evaluate().
+	 * @param t array of times from the current state [s]
+	 * @param out array of resulting states, same size as t
+	 * @param n number of times
+	 */
+	void evaluate(const float t[], Trajectory out[], int n) const;
+
 	/**
 	 * Getters and setters
 	 */
@@ -100,11 +117,11 @@ public:
 	void setMaxVel(float max_vel) { _max_vel = max_vel; }
 
 	float getCurrentJerk() const { return _state.j; }
-	void setCurrentAcceleration(const float accel) { _state.a = _state_init.a = accel; }
+	void setCurrentAcceleration(const float accel) { _state.a = _state_init.a = accel; _durations_valid = false; }
 	float getCurrentAcceleration() const { return _state.a; }
-	void setCurrentVelocity(const float vel) { _state.v = _state_init.v = vel; }
+	void setCurrentVelocity(const float vel) { _state.v = _state_init.v = vel; _durations_valid = false; }
 	float getCurrentVelocity() const { return _state.v; }
-	void setCurrentPosition(const float pos) { _state.x = _state_init.x = pos; }
+	void setCurrentPosition(const float pos) { _state.x = _state_init.x = pos; _durations_valid = false; }
 	float getCurrentPosition() const { return _state.x; }
 
 	float getT1() const { return _T1; }
@@ -135,6 +152,16 @@ private:
 	 */
 	void updateDurationsGivenTotalTime(float T123);
 
+	/**
+	 * Remove the first t seconds of the durations, once the trajectory advanced along them
+	 */
+	void consumeDurations(float t);
+
+	/**
+	 * Trajectory state at the given time since the last updateDurations()
+	 */
+	Trajectory evaluateLocal(float local_time) const;
+
 	/**
 	 * Compute the direction of the jerk to be applied in order to drive the current state
 	 * to the desired one
@@ -210,4 +237,10 @@ private:
 	float _T3{0.f}; ///< Decreasing acceleration [s]
 
 	float _local_time{0.f}; ///< Current local time
+
+	/* Inputs of the last solution, to check if it can be reused */
+	bool _durations_valid{false}; ///< false after a state reset or a time synchronization
+	float _solved_vel_sp{0.f};
+	float _solved_max_jerk{0.f};
+	float _solved_max_accel{0.f};
 };
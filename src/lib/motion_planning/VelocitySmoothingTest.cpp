@@ -267,3 +267,45 @@ TEST_F(VelocitySmoothingTest, testZeroSetpoint)
 		EXPECT_FLOAT_EQ(_trajectories[i].getCurrentPosition(), 0.f);
 	}
 }
+
+TEST_F(VelocitySmoothingTest, testEvaluateAhead)
+{
+	// GIVEN: A set of constraints and a trajectory towards a constant setpoint
+	setConstraints(10.f, 3.f, 8.f);
+	setInitialConditions(Vector3f(0.5f, 0.f, -1.f), Vector3f(0.f, 1.f, 2.f), Vector3f(0.f, 0.f, 0.f));
+
+	const Vector3f velocity_setpoints(5.f, -2.f, 0.f);
+	updateTrajectories(0.f, velocity_setpoints);
+
+	// WHEN: We evaluate the trajectory ahead in one call, including after its end
+	static constexpr int n = 6;
+	const float times[n] = {0.f, 0.1f, 0.5f, 1.3f, 2.f, 4.f};
+	Trajectory ahead[3][n];
+
+	for (int i = 0; i < 3; i++) {
+		_trajectories[i].evaluate(times, ahead[i], n);
+
+		// THEN: It matches the single evaluations
+		for (int k = 0; k < n; k++) {
+			EXPECT_NEAR(ahead[i][k].v, _trajectories[i].evaluate(times[k]).v, 1e-5f);
+			EXPECT_NEAR(ahead[i][k].x, _trajectories[i].evaluate(times[k]).x, 1e-5f);
+		}
+	}
+
+	// AND: The trajectory generated with a constant setpoint
+	const float dt = 0.01f;
+	float t = 0.f;
+
+	for (int k = 0; k < n; k++) {
+		while (t < times[k] - dt / 2.f) {
+			updateTrajectories(dt, velocity_setpoints);
+			t += dt;
+		}
+
+		for (int i = 0; i < 3; i++) {
+			EXPECT_NEAR(ahead[i][k].a, _trajectories[i].getCurrentAcceleration(), 0.01f);
+			EXPECT_NEAR(ahead[i][k].v, _trajectories[i].getCurrentVelocity(), 0.01f);
+			EXPECT_NEAR(ahead[i][k].x, _trajectories[i].getCurrentPosition(), 0.01f);
+		}
+	}
+}
@@ -76,6 +76,56 @@ float NPFG::canRun(const vehicle_local_position_s &local_pos, const bool is_wind
 void NPFG::guideToPath(const matrix::Vector2f &curr_pos_local, const Vector2f &ground_vel, const Vector2f &wind_vel,
 		       const Vector2f &unit_path_tangent,
 		       const Vector2f &position_on_path, const float path_curvature)
+{
+	GuidanceSolution sol;
+	solve(curr_pos_local, ground_vel, wind_vel, unit_path_tangent, position_on_path, path_curvature, sol);
+
+	signed_track_error_ = sol.signed_track_error;
+	feas_on_track_ = sol.feas_on_track;
+	adapted_period_ = sol.adapted_period;
+	p_gain_ = sol.p_gain;
+	time_const_ = sol.time_const;
+	track_error_bound_ = sol.track_error_bound;
+	track_proximity_ = sol.track_proximity;
+	bearing_vec_ = sol.bearing_vec;
+	feas_ = sol.feas;
+	min_ground_speed_ref_ = sol.min_ground_speed_ref;
+	air_vel_ref_ = sol.air_vel_ref;
+	airspeed_ref_ = sol.airspeed_ref;
+	lateral_accel_ff_ = sol.lateral_accel_ff;
+	lateral_accel_ = sol.lateral_accel;
+
+	updateRollSetpoint();
+} // guideToPath
+
+void NPFG::evaluatePaths(const Vector2f &curr_pos_local, const Vector2f &ground_vel, const Vector2f &wind_vel,
+			 const PathCandidates &candidates, PathEvaluation &evaluation) const
+{
+	const int num = math::constrain(candidates.num, 0, MAX_PATH_CANDIDATES);
+
+	for (int i = 0; i < num; i++) {
+		const Vector2f unit_path_tangent{candidates.unit_path_tangent_x[i], candidates.unit_path_tangent_y[i]};
+		const Vector2f position_on_path{candidates.position_on_path_x[i], candidates.position_on_path_y[i]};
+
+		GuidanceSolution sol;
+		solve(curr_pos_local, ground_vel, wind_vel, unit_path_tangent, position_on_path, candidates.path_curvature[i], sol);
+
+		const float feas_combined = sol.feas * sol.feas_on_track;
+		const float lateral_accel_g = sol.lateral_accel / CONSTANTS_ONE_G;
+		const float airspeed_increment = math::max(sol.airspeed_ref - airspeed_nom_, 0.0f) / airspeed_nom_;
+
+		evaluation.lateral_accel[i] = sol.lateral_accel;
+		evaluation.airspeed_ref[i] = sol.airspeed_ref;
+		evaluation.signed_track_error[i] = sol.signed_track_error;
+		evaluation.bearing_feas[i] = feas_combined;
+		evaluation.cost[i] = lateral_accel_g * lateral_accel_g + airspeed_increment * airspeed_increment
+				     + sol.normalized_track_error + (1.0f - feas_combined);
+	}
+} // evaluatePaths
+
+void NPFG::solve(const Vector2f &curr_pos_local, const Vector2f &ground_vel, const Vector2f &wind_vel,
+		 const Vector2f &unit_path_tangent, const Vector2f &position_on_path, const float path_curvature,
+		 GuidanceSolution &sol) const
 {
 	const float ground_speed = ground_vel.norm();
 
@@ -85,69 +135,67 @@ void NPFG::guideToPath(const matrix::Vector2f &curr_pos_local, const Vector2f &g
 	const float wind_speed = wind_vel.norm();
 
 	const Vector2f path_pos_to_vehicle{curr_pos_local - position_on_path};
-	signed_track_error_ = unit_path_tangent.cross(path_pos_to_vehicle);
+	sol.signed_track_error = unit_path_tangent.cross(path_pos_to_vehicle);
 
 	// on-track wind triangle projections
 	const float wind_cross_upt = wind_vel.cross(unit_path_tangent);
 	const float wind_dot_upt = wind_vel.dot(unit_path_tangent);
 
 	// calculate the bearing feasibility on the track at the current closest point
-	feas_on_track_ = bearingFeasibility(wind_cross_upt, wind_dot_upt, airspeed, wind_speed);
+	sol.feas_on_track = bearingFeasibility(wind_cross_upt, wind_dot_upt, airspeed, wind_speed);
 
-	const float track_error = fabsf(signed_track_error_);
+	const float track_error = fabsf(sol.signed_track_error);
 
 	// update control parameters considering upper and lower stability bounds (if enabled)
-	// must be called before trackErrorBound() as it updates time_const_
-	adapted_period_ = adaptPeriod(ground_speed, airspeed, wind_speed, track_error,
-				      path_curvature, wind_vel, unit_path_tangent, feas_on_track_);
-	p_gain_ = pGain(adapted_period_, damping_);
-	time_const_ = timeConst(adapted_period_, damping_);
+	// must be called before trackErrorBound() as it updates time_const
+	sol.adapted_period = adaptPeriod(ground_speed, airspeed, wind_speed, track_error,
+					 path_curvature, wind_vel, unit_path_tangent, sol.feas_on_track);
+	sol.p_gain = pGain(sol.adapted_period, damping_);
+	sol.time_const = timeConst(sol.adapted_period, damping_);
 
 	// track error bound is dynamic depending on ground speed
-	track_error_bound_ = trackErrorBound(ground_speed, time_const_);
-	const float normalized_track_error = normalizedTrackError(track_error, track_error_bound_);
+	sol.track_error_bound = trackErrorBound(ground_speed, sol.time_const);
+	sol.normalized_track_error = normalizedTrackError(track_error, sol.track_error_bound);
 
 	// look ahead angle based solely on track proximity
-	const float look_ahead_ang = lookAheadAngle(normalized_track_error);
+	const float look_ahead_ang = lookAheadAngle(sol.normalized_track_error);
 
-	track_proximity_ = trackProximity(look_ahead_ang);
+	sol.track_proximity = trackProximity(look_ahead_ang);
 
-	bearing_vec_ = bearingVec(unit_path_tangent, look_ahead_ang, signed_track_error_);
+	sol.bearing_vec = bearingVec(unit_path_tangent, look_ahead_ang, sol.signed_track_error);
 
 	// wind triangle projections
-	const float wind_cross_bearing = wind_vel.cross(bearing_vec_);
-	const float wind_dot_bearing = wind_vel.dot(bearing_vec_);
+	const float wind_cross_bearing = wind_vel.cross(sol.bearing_vec);
+	const float wind_dot_bearing = wind_vel.dot(sol.bearing_vec);
 
 	// continuous representation of the bearing feasibility
-	feas_ = bearingFeasibility(wind_cross_bearing, wind_dot_bearing, airspeed, wind_speed);
+	sol.feas = bearingFeasibility(wind_cross_bearing, wind_dot_bearing, airspeed, wind_speed);
 
 	// we consider feasibility of both the current bearing as well as that on the track at the current closest point
-	const float feas_combined = feas_ * feas_on_track_;
+	const float feas_combined = sol.feas * sol.feas_on_track;
 
-	min_ground_speed_ref_ = minGroundSpeed(normalized_track_error, feas_combined);
+	sol.min_ground_speed_ref = minGroundSpeed(sol.normalized_track_error, feas_combined);
 
 	// reference air velocity with directional feedforward effect for following
 	// curvature in wind and magnitude incrementation depending on minimum ground
 	// speed violations and/or high wind conditions in general
-	air_vel_ref_ = refAirVelocity(wind_vel, bearing_vec_, wind_cross_bearing,
-				      wind_dot_bearing, wind_speed, min_ground_speed_ref_);
-	airspeed_ref_ = air_vel_ref_.norm();
+	sol.air_vel_ref = refAirVelocity(wind_vel, sol.bearing_vec, wind_cross_bearing,
+					 wind_dot_bearing, wind_speed, sol.min_ground_speed_ref);
+	sol.airspeed_ref = sol.air_vel_ref.norm();
 
 	// lateral acceleration demand based on heading error
-	const float lateral_accel = lateralAccel(air_vel, air_vel_ref_, airspeed);
+	const float lateral_accel = lateralAccel(air_vel, sol.air_vel_ref, airspeed, sol.p_gain);
 
 	// lateral acceleration needed to stay on curved track (assuming no heading error)
-	lateral_accel_ff_ = lateralAccelFF(unit_path_tangent, ground_vel, wind_dot_upt,
-					   wind_cross_upt, airspeed, wind_speed, signed_track_error_, path_curvature);
+	sol.lateral_accel_ff = lateralAccelFF(unit_path_tangent, ground_vel, wind_dot_upt,
+					      wind_cross_upt, airspeed, wind_speed, sol.signed_track_error, path_curvature);
 
 	// total lateral acceleration to drive aircaft towards track as well as account
 	// for path curvature. The full effect of the feed-forward acceleration is smoothly
 	// ramped in as the vehicle approaches the track and is further smoothly
 	// zeroed out as the bearing becomes infeasible.
-	lateral_accel_ = lateral_accel + feas_combined * track_proximity_ * lateral_accel_ff_;
-
-	updateRollSetpoint();
-} // guideToPath
+	sol.lateral_accel = lateral_accel + feas_combined * sol.track_proximity * sol.lateral_accel_ff;
+} // solve
 
 float NPFG::adaptPeriod(const float ground_speed, const float airspeed, const float wind_speed,
 			const float track_error, const float path_curvature, const Vector2f &wind_vel,
@@ -302,16 +350,16 @@ Vector2f NPFG::bearingVec(const Vector2f &unit_path_tangent, const float look_ah
 	return cos_look_ahead_ang * unit_track_error + sin_look_ahead_ang * unit_path_tangent;
 } // bearingVec
 
-float NPFG::minGroundSpeed(const float normalized_track_error, const float feas)
+float NPFG::minGroundSpeed(const float normalized_track_error, const float feas) const
 {
 	// minimum ground speed demand from track keeping logic
-	min_gsp_track_keeping_ = 0.0f;
+	float min_gsp_track_keeping = 0.0f;
 
 	if (en_track_keeping_ && en_wind_excess_regulation_) {
 		// zero out track keeping speed increment when bearing is feasible
 		// maximum track keeping speed increment is applied until we are within
 		// a user defined fraction of the normalized track error
-		min_gsp_track_keeping_ = (1.0f - feas) * min_gsp_track_keeping_max_ * math::constrain(
+		min_gsp_track_keeping = (1.0f - feas) * min_gsp_track_keeping_max_ * math::constrain(
 						 normalized_track_error / NTE_FRACTION, 0.0f,
 						 1.0f);
 	}
@@ -323,7 +371,7 @@ float NPFG::minGroundSpeed(const float normalized_track_error, const float feas)
 		min_gsp_desired = min_gsp_desired_;
 	}
 
-	return math::max(min_gsp_track_keeping_, min_gsp_desired);
+	return math::max(min_gsp_track_keeping, min_gsp_desired);
 } // minGroundSpeed
 
 Vector2f NPFG::refAirVelocity(const Vector2f &wind_vel, const Vector2f &bearing_vec,
@@ -474,7 +522,8 @@ float NPFG::lateralAccelFF(const Vector2f &unit_path_tangent, const Vector2f &gr
 	return airspeed * speed_ratio * path_frame_rate;
 } // lateralAccelFF
 
-float NPFG::lateralAccel(const Vector2f &air_vel, const Vector2f &air_vel_ref, const float airspeed) const
+float NPFG::lateralAccel(const Vector2f &air_vel, const Vector2f &air_vel_ref, const float airspeed,
+			 const float p_gain) const
 {
 	// lateral acceleration demand only from the heading error
 
@@ -483,12 +532,12 @@ float NPFG::lateralAccel(const Vector2f &air_vel, const Vector2f &air_vel_ref, c
 
 	if (dot_air_vel_err < 0.0f) {
 		// hold max lateral acceleration command above 90 deg heading error
-		return p_gain_ * ((cross_air_vel_err < 0.0f) ? -airspeed : airspeed);
+		return p_gain * ((cross_air_vel_err < 0.0f) ? -airspeed : airspeed);
 
 	} else {
 		// airspeed/airspeed_ref is used to scale any incremented airspeed reference back to the current airspeed
 		// for acceleration commands in a "feedback" sense (i.e. at the current vehicle airspeed)
-		return p_gain_ * cross_air_vel_err / airspeed_ref_;
+		return p_gain * cross_air_vel_err / air_vel_ref.norm();
 	}
 } // lateralAccel
 
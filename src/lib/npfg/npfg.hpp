@@ -101,6 +101,47 @@ public:
 			 const matrix::Vector2f &unit_path_tangent, const matrix::Vector2f &position_on_path,
 			 const float path_curvature);
 
+	static constexpr int MAX_PATH_CANDIDATES = 8;
+
+	/*
+	 * Candidate paths for evaluatePaths(), one array entry per candidate.
+	 */
+	struct PathCandidates {
+		int num{0};
+		float unit_path_tangent_x[MAX_PATH_CANDIDATES];
+		float unit_path_tangent_y[MAX_PATH_CANDIDATES];
+		float position_on_path_x[MAX_PATH_CANDIDATES]; // [m]
+		float position_on_path_y[MAX_PATH_CANDIDATES]; // [m]
+		float path_curvature[MAX_PATH_CANDIDATES]; // [m^-1]
+	};
+
+	/*
+	 * Guidance solutions of the candidate paths, same order as the candidates.
+	 */
+	struct PathEvaluation {
+		float lateral_accel[MAX_PATH_CANDIDATES]; // [m/s^2]
+		float airspeed_ref[MAX_PATH_CANDIDATES]; // [m/s]
+		float signed_track_error[MAX_PATH_CANDIDATES]; // [m]
+		float bearing_feas[MAX_PATH_CANDIDATES]; // combined bearing feasibility in [0,1]
+		float cost[MAX_PATH_CANDIDATES]; // guidance effort, see evaluatePaths()
+	};
+
+	/*
+	 * Computes the guidance solution for several candidate paths from the same vehicle state,
+	 * without changing the state of the controller, e.g. to choose between paths.
+	 *
+	 * The cost adds the squared lateral acceleration in g, the squared relative airspeed increment
+	 * over the nominal airspeed, the normalized track error and the bearing infeasibility.
+	 *
+	 * @param[in] curr_pos_local Current horizontal vehicle position in local coordinates [m]
+	 * @param[in] ground_vel Vehicle ground velocity vector [m/s]
+	 * @param[in] wind_vel Wind velocity vector [m/s]
+	 * @param[in] candidates Candidate paths, at most MAX_PATH_CANDIDATES
+	 * @param[out] evaluation Guidance solutions of the candidates
+	 */
+	void evaluatePaths(const matrix::Vector2f &curr_pos_local, const matrix::Vector2f &ground_vel,
+			   const matrix::Vector2f &wind_vel, const PathCandidates &candidates, PathEvaluation &evaluation) const;
+
 	/*
 	 * Set the nominal controller period [s].
 	 */
@@ -322,7 +363,6 @@ private:
 	 */
 
 	// speeds
-	float min_gsp_track_keeping_{0.0f}; // minimum forward ground speed demand from track keeping logic [m/s]
 	float min_ground_speed_ref_{0.0f}; // resultant minimum forward ground speed reference considering all active guidance logic [m/s]
 
 	//bearing feasibility
@@ -353,6 +393,34 @@ private:
 	float roll_lim_rad_{math::radians(30.0f)}; // maximum roll angle [rad]
 	float roll_setpoint_{0.0f}; // current roll angle setpoint [rad]
 
+	/*
+	 * Result of one guideToPath() evaluation, shared by guideToPath() and evaluatePaths()
+	 */
+	struct GuidanceSolution {
+		float signed_track_error;
+		float normalized_track_error;
+		float feas_on_track;
+		float adapted_period;
+		float p_gain;
+		float time_const;
+		float track_error_bound;
+		float track_proximity;
+		matrix::Vector2f bearing_vec;
+		float feas;
+		float min_ground_speed_ref;
+		matrix::Vector2f air_vel_ref;
+		float airspeed_ref;
+		float lateral_accel;
+		float lateral_accel_ff;
+	};
+
+	/*
+	 * Computes the guidance solution for a path from the current tuning, see guideToPath().
+	 */
+	void solve(const matrix::Vector2f &curr_pos_local, const matrix::Vector2f &ground_vel,
+		   const matrix::Vector2f &wind_vel, const matrix::Vector2f &unit_path_tangent,
+		   const matrix::Vector2f &position_on_path, const float path_curvature, GuidanceSolution &sol) const;
+
 	/*
 	 * Adapts the controller period considering user defined inputs, current flight
 	 * condition, path properties, and stability bounds.
@@ -489,7 +557,7 @@ private:
 	 * @param[in] feas Bearing feasibility
 	 * @return Minimum forward ground speed demand [m/s]
 	 */
-	float minGroundSpeed(const float normalized_track_error, const float feas);
+	float minGroundSpeed(const float normalized_track_error, const float feas) const;
 
 	/*
 	 * Determines a reference air velocity *without curvature compensation, but
@@ -595,10 +663,11 @@ private:
 	 * @param[in] air_vel Vechile air velocity vector [m/s]
 	 * @param[in] air_vel_ref Reference air velocity vector [m/s]
 	 * @param[in] airspeed Vehicle true airspeed [m/s]
+	 * @param[in] p_gain Proportional gain [rad/s]
 	 * @return Lateral acceleration demand [m/s^2]
 	 */
 	float lateralAccel(const matrix::Vector2f &air_vel, const matrix::Vector2f &air_vel_ref,
-			   const float airspeed) const;
+			   const float airspeed, const float p_gain) const;
 
 	/*******************************************************************************
 	 * PX4 POSITION SETPOINT INTERFACE FUNCTIONS
@@ -152,6 +152,57 @@ public:
 		return _n_slots * sizeof(Slot);
 	}
 
+	/**
+	 * Shrink the storage to the used slots (plus the grow size), e.g. after loading the parameters at boot.
+	 * This replaces the allocation (and the preallocated slots) with a single block of the right size,
+	 * so later changes only need to grow incrementally.
+	 */
+	void compact()
+	{
+		AtomicTransaction transaction;
+		int max_retries = 5;
+
+		while (max_retries-- > 0) {
+			const int n_slots = _next_slot + _n_grow;
+
+			if (n_slots >= _n_slots) {
+				return;
+			}
+
+			// As malloc uses locking, so we need to re-enable IRQ's during malloc/free
+			transaction.unlock();
+			Slot *new_slots = (Slot *) malloc(sizeof(Slot) * n_slots);
+			transaction.lock();
+
+			if (new_slots == nullptr) {
+				return;
+			}
+
+			if (_next_slot + _n_grow != n_slots || n_slots >= _n_slots) {
+				// changed in the meantime, retry
+				transaction.unlock();
+				free(new_slots);
+				transaction.lock();
+				continue;
+			}
+
+			Slot *previous_slots = _slots.load();
+			memcpy(new_slots, previous_slots, sizeof(Slot) * _next_slot);
+
+			for (int i = _next_slot; i < n_slots; i++) {
+				new_slots[i] = {UINT16_MAX, param_value_u{}};
+			}
+
+			_slots.store(new_slots);
+			_n_slots = n_slots;
+
+			transaction.unlock();
+			free(previous_slots);
+			transaction.lock();
+			return;
+		}
+	}
+
 private:
 	struct Slot {
 		param_t param;
@@ -79,6 +79,56 @@ TEST_F(ParameterTest, testParamReadWrite)
 }
 
 
+TEST_F(ParameterTest, testParamFind)
+{
+	// GIVEN: the name of every parameter
+	for (unsigned i = 0; i < param_count(); i++) {
+		const param_t param = param_for_index(i);
+
+		// WHEN: we look it up
+		// THEN: it should resolve to the same handle
+		EXPECT_EQ(param, param_find_no_notification(param_name(param))) << param_name(param);
+	}
+
+	// AND: unknown names should not be found
+	EXPECT_EQ(PARAM_INVALID, param_find_no_notification("CP_DIS"));
+	EXPECT_EQ(PARAM_INVALID, param_find_no_notification("CP_DIST_"));
+	EXPECT_EQ(PARAM_INVALID, param_find_no_notification(""));
+}
+
+TEST_F(ParameterTest, testParamChangedSince)
+{
+	// GIVEN: a parameter and the current notification instance
+	param_t param = param_handle(px4::params::CP_DIST);
+	param_t other_param = param_handle(px4::params::CP_DELAY);
+	param_notify_changes();
+	const uint32_t instance = param_update_instance();
+	EXPECT_FALSE(param_changed_since(param, instance));
+
+	// WHEN: we change the parameter without notification
+	float value = 42.f;
+	EXPECT_EQ(0, param_set_no_notification(param, &value));
+
+	// THEN: it should be reported as changed, but not the other one
+	EXPECT_TRUE(param_changed_since(param, instance));
+	EXPECT_FALSE(param_changed_since(other_param, instance));
+
+	// WHEN: the change is published
+	param_notify_changes();
+
+	// THEN: it is changed relative to the old instance, but not to the new one
+	EXPECT_TRUE(param_changed_since(param, instance));
+	EXPECT_FALSE(param_changed_since(param, param_update_instance()));
+
+	// WHEN: the history is exceeded
+	for (int i = 0; i < 10; i++) {
+		param_notify_changes();
+	}
+
+	// THEN: it should conservatively be reported as changed
+	EXPECT_TRUE(param_changed_since(other_param, instance));
+}
+
 TEST_F(ParameterTest, testUorbSendReceive)
 {
 	// GIVEN: a uOrb message
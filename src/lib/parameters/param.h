@@ -285,6 +285,25 @@ __EXPORT int		param_set_no_remote_update(param_t param, const void *val, bool no
  */
 __EXPORT void		param_notify_changes(void);
 
+/**
+ * Get the instance of the next parameter update notification. Changes happening from now on
+ * are part of this or a later notification.
+ *
+ * @return		The notification instance, to be passed to param_changed_since().
+ */
+__EXPORT uint32_t	param_update_instance(void);
+
+/**
+ * Check if a parameter might have changed since a given notification instance.
+ * Changes not yet published are included, and it conservatively returns true if the
+ * instance is too old to be tracked.
+ *
+ * @param param		A handle returned by param_find or passed by param_foreach.
+ * @param instance	A value previously returned by param_update_instance().
+ * @return		True if the parameter (possibly) changed, false if it is unchanged.
+ */
+__EXPORT bool		param_changed_since(param_t param, uint32_t instance);
+
 /**
  * Reset a parameter to its default value.
  *
@@ -444,6 +463,12 @@ __EXPORT uint32_t	param_hash_check(void);
  */
 __EXPORT void	param_print_status(void);
 
+/**
+ * Print the parameter calls per calling task (requires CONFIG_PARAM_ACCESS_PROFILER)
+ *
+ */
+__EXPORT void	param_print_access_profile(void);
+
 /**
  * Enable/disable the param autosaving.
  * Re-enabling with changed params will not cause an autosave.
@@ -47,7 +47,7 @@
 #include <parameters/px4_parameters.hpp>
 #include <lib/tinybson/tinybson.h>
 
-#include <crc32.h>
+#include <lib/crc/px4_crc.h>
 #include <float.h>
 #include <math.h>
 
@@ -95,29 +95,117 @@ static char *param_default_file = nullptr;
 static char *param_backup_file = nullptr;
 
 #include "autosave.h"
+#include "notify.h"
 static ParamAutosave *autosave_instance {nullptr};
+static ParamNotify *notify_instance {nullptr};
 
 static px4::AtomicBitset<param_info_count> params_active;  // params found
 static px4::AtomicBitset<param_info_count> params_unsaved;
 
+/*
+ * Changed parameters: params_changed collects the changes until the next parameter_update notification,
+ * which moves them into the history slot of its instance. This lets ModuleParams only update the parameters
+ * that changed since the last notification it handled (see param_changed_since()).
+ */
+static constexpr uint32_t PARAM_CHANGE_HISTORY = 4;
+static px4::AtomicBitset<param_info_count> params_changed;
+static px4::AtomicBitset<param_info_count> params_changed_history[PARAM_CHANGE_HISTORY]; // index: instance % PARAM_CHANGE_HISTORY
+static px4::atomic<uint32_t> param_change_history_start{0}; ///< oldest instance in the history
+static pthread_mutex_t notify_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 static ConstLayer firmware_defaults;
 static DynamicSparseLayer runtime_defaults{&firmware_defaults};
 DynamicSparseLayer user_config{&runtime_defaults};
 
+#if !defined(CONSTRAINED_MEMORY)
+/*
+ * Cache of the current value of every parameter (the result of user_config.get()), so that param_get()
+ * is a wait-free load instead of a lookup through the layers under a lock. Each value is a single 32 bit word,
+ * so no further synchronization is needed for readers. Writers refresh the entry from the layers after every
+ * change (param_value_cache_update()), so the last refresh always reflects the latest value.
+ */
+static px4::atomic<int32_t> param_value_cache[param_info_count];
+static px4::atomic_bool param_value_cache_valid{false};
+#endif // !CONSTRAINED_MEMORY
+
 /** parameter update topic handle */
 #if not defined(CONFIG_PARAM_REMOTE)
 static orb_advert_t param_topic = nullptr;
-static unsigned int param_instance = 0;
 #endif
+static px4::atomic<uint32_t> param_instance{0};
 
 static perf_counter_t param_export_perf;
 static perf_counter_t param_find_perf;
 static perf_counter_t param_get_perf;
 static perf_counter_t param_set_perf;
 
+#if defined(CONFIG_PARAM_ACCESS_PROFILER)
+enum class ParamAccess {
+	Find,
+	Get,
+	Set,
+	Count
+};
+
+/** parameter calls of a task (or work queue, as the work items share the thread) */
+struct param_access_profile_s {
+	char name[24];
+	uint32_t count[(int)ParamAccess::Count];
+};
+
+static constexpr int PARAM_ACCESS_PROFILE_SIZE = 32;
+static param_access_profile_s param_access_profile[PARAM_ACCESS_PROFILE_SIZE] {};
+static uint32_t param_access_profile_other[(int)ParamAccess::Count] {}; ///< calls not fitting into the table
+
+static void param_access_count(ParamAccess access)
+{
+	char thread_name[sizeof(param_access_profile_s::name)];
+	const char *name = thread_name;
+
+#if defined(__PX4_LINUX) || defined(__PX4_DARWIN)
+
+	// work queue threads are not PX4 tasks on POSIX
+	if (pthread_getname_np(pthread_self(), thread_name, sizeof(thread_name)) != 0) {
+		name = px4_get_taskname();
+	}
+
+#else
+	name = px4_get_taskname();
+#endif
+
+	const AtomicTransaction transaction;
+
+	for (auto &entry : param_access_profile) {
+		if (entry.name[0] == '\0') {
+			strncpy(entry.name, name, sizeof(entry.name) - 1);
+		}
+
+		if (strncmp(entry.name, name, sizeof(entry.name) - 1) == 0) {
+			entry.count[(int)access]++;
+			return;
+		}
+	}
+
+	param_access_profile_other[(int)access]++;
+}
+#else
+# define param_access_count(access)
+#endif // CONFIG_PARAM_ACCESS_PROFILER
+
 static pthread_mutex_t file_mutex  =
 	PTHREAD_MUTEX_INITIALIZER; ///< this protects against concurrent param saves (file or flash access).
 
+/*
+ * Parameter file journal: a save appends a BSON document with just the changed parameters after the full
+ * export (and the previous journal records), until the journal exceeds PARAM_JOURNAL_SIZE_MAX and the file
+ * is compacted with a full export again. A zero document length terminates the journal.
+ * Only accessed with file_mutex held (or during startup).
+ */
+static constexpr int32_t PARAM_JOURNAL_SIZE_MAX = 4096;
+static int32_t param_journal_start = -1; ///< end of the full export, -1 if the next save needs to be a full export
+static int32_t param_journal_end = -1; ///< end of the last journal record
+static px4::atomic_bool param_journal_compact{false}; ///< request a full export with the next save
+
 // Support for remote parameter node
 #if defined(CONFIG_PARAM_PRIMARY)
 # include "parameters_primary.h"
@@ -126,9 +214,27 @@ static pthread_mutex_t file_mutex  =
 # include "parameters_remote.h"
 #endif // CONFIG_PARAM_REMOTE
 
+// update the cached value after a change of a layer
+static void param_value_cache_update(param_t param)
+{
+#if !defined(CONSTRAINED_MEMORY)
+	const AtomicTransaction transaction;
+	param_value_cache[param].store(user_config.get(param).i);
+#endif // !CONSTRAINED_MEMORY
+}
+
 void
 param_init()
 {
+#if !defined(CONSTRAINED_MEMORY)
+
+	for (param_t param = 0; handle_in_range(param); param++) {
+		param_value_cache_update(param);
+	}
+
+	param_value_cache_valid.store(true);
+#endif // !CONSTRAINED_MEMORY
+
 	param_export_perf = perf_alloc(PC_ELAPSED, "param: export");
 	param_find_perf = perf_alloc(PC_COUNT, "param: find");
 	param_get_perf = perf_alloc(PC_COUNT, "param: get");
@@ -148,9 +254,21 @@ param_init()
 
 #if not defined(CONFIG_PARAM_REMOTE)
 	autosave_instance = new ParamAutosave();
+	notify_instance = new ParamNotify();
 #endif
 }
 
+// notify about a change with a short delay, so that consecutive changes are published together
+static void param_notify_changes_batched()
+{
+	if (notify_instance) {
+		notify_instance->request();
+
+	} else {
+		param_notify_changes();
+	}
+}
+
 
 void
 param_notify_changes()
@@ -158,8 +276,26 @@ param_notify_changes()
 // Don't send if this is a remote node. Only the primary
 // sends out update notices
 #if not defined(CONFIG_PARAM_REMOTE)
+	pthread_mutex_lock(&notify_mutex);
+
+	const uint32_t instance = param_instance.load();
+	px4::AtomicBitset<param_info_count> &history = params_changed_history[instance % PARAM_CHANGE_HISTORY];
+
+	// invalidate the slot before reusing it (checked again by param_changed_since() after reading it)
+	param_change_history_start.store(instance + 1 - PARAM_CHANGE_HISTORY);
+	history.reset();
+
+	for (param_t param = 0; handle_in_range(param); param++) {
+		if (params_changed[param]) {
+			history.set(param);
+			params_changed.set(param, false);
+		}
+	}
+
+	param_instance.store(instance + 1);
+
 	parameter_update_s pup {};
-	pup.instance = param_instance++;
+	pup.instance = instance;
 	pup.get_count = perf_event_count(param_get_perf);
 	pup.set_count = perf_event_count(param_set_perf);
 	pup.find_count = perf_event_count(param_find_perf);
@@ -176,13 +312,47 @@ param_notify_changes()
 		orb_publish(ORB_ID(parameter_update), param_topic, &pup);
 	}
 
+	pthread_mutex_unlock(&notify_mutex);
 #endif
 }
 
+uint32_t param_update_instance()
+{
+	return param_instance.load();
+}
+
+bool param_changed_since(param_t param, uint32_t instance)
+{
+	if (!handle_in_range(param) || params_changed[param]) {
+		return true;
+	}
+
+	const uint32_t current = param_instance.load();
+
+	// (signed difference to be robust against wrap-around)
+	if ((int32_t)(instance - param_change_history_start.load()) < 0 || (int32_t)(current - instance) < 0) {
+		return true;
+	}
+
+	bool changed = false;
+
+	for (uint32_t i = instance; i != current; i++) {
+		if (params_changed_history[i % PARAM_CHANGE_HISTORY][param]) {
+			changed = true;
+			break;
+		}
+	}
+
+	// the history might have been reused concurrently
+	return changed || (int32_t)(instance - param_change_history_start.load()) < 0;
+}
+
 static param_t param_find_internal(const char *name, bool notification)
 {
 	perf_count(param_find_perf);
+	param_access_count(ParamAccess::Find);
 
+#if defined(CONSTRAINED_FLASH)
 	param_t middle;
 	param_t front = 0;
 	param_t last = param_info_count;
@@ -212,6 +382,26 @@ static param_t param_find_internal(const char *name, bool notification)
 		}
 	}
 
+#else
+	/* look up the only candidate in the perfect hash generated by px_generate_params.py */
+	static constexpr unsigned num_buckets = sizeof(px4::parameters_hash_displacements) / sizeof(uint16_t);
+	static constexpr unsigned num_slots = sizeof(px4::parameters_hash_slots) / sizeof(uint16_t);
+	static_assert(num_slots == param_info_count, "parameter hash out of date");
+
+	const unsigned bucket = px4::param_name_hash(name, 0) % num_buckets;
+	const param_t param = px4::parameters_hash_slots[px4::param_name_hash(name,
+			      px4::parameters_hash_displacements[bucket]) % num_slots];
+
+	if (strcmp(name, param_name(param)) == 0) {
+		if (notification) {
+			param_set_used(param);
+		}
+
+		return param;
+	}
+
+#endif // CONSTRAINED_FLASH
+
 	/* not found */
 	return PARAM_INVALID;
 }
@@ -287,6 +477,7 @@ int
 param_get(param_t param, void *val)
 {
 	perf_count(param_get_perf);
+	param_access_count(ParamAccess::Get);
 
 	if (!handle_in_range(param)) {
 		PX4_ERR("get: param %" PRId16 " invalid", param);
@@ -301,7 +492,20 @@ param_get(param_t param, void *val)
 
 	if (val) {
 
+#if defined(CONSTRAINED_MEMORY)
 		auto retrieve_value = user_config.get(param);
+#else
+		param_value_u retrieve_value;
+
+		if (param_value_cache_valid.load()) {
+			retrieve_value.i = param_value_cache[param].load();
+
+		} else {
+			// before param_init()
+			retrieve_value = user_config.get(param);
+		}
+
+#endif // CONSTRAINED_MEMORY
 
 		switch (param_type(param)) {
 		case PARAM_TYPE_INT32:
@@ -412,6 +616,7 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 	int result = -1;
 	bool param_changed = false;
 	perf_begin(param_set_perf);
+	param_access_count(ParamAccess::Set);
 
 	const param_value_u user_config_value = user_config.get(param);
 	param_value_u new_value{};
@@ -434,7 +639,13 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 	}
 
 	if (user_config.store(param, new_value)) {
+		param_value_cache_update(param);
 		params_unsaved.set(param, !mark_saved);
+
+		if (param_changed) {
+			params_changed.set(param);
+		}
+
 		result = PX4_OK;
 
 	} else {
@@ -471,7 +682,7 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 	 * a thing has been set.
 	 */
 	if ((result == PX4_OK) && param_changed && notify_changes) {
-		param_notify_changes();
+		param_notify_changes_batched();
 	}
 
 	return result;
@@ -590,9 +801,14 @@ int param_set_default_value(param_t param, const void *val)
 	}
 
 
+	if (result == PX4_OK) {
+		param_value_cache_update(param);
+		params_changed.set(param);
+	}
+
 	if ((result == PX4_OK) && param_used(param)) {
 		// send notification if param is already in use
-		param_notify_changes();
+		param_notify_changes_batched();
 	}
 
 	return result;
@@ -609,6 +825,15 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 
 	if (handle_in_range(param)) {
 		user_config.reset(param);
+		param_value_cache_update(param);
+
+		if (param_found) {
+			params_changed.set(param);
+
+			if (autosave) {
+				params_unsaved.set(param, true);
+			}
+		}
 	}
 
 	if (autosave) {
@@ -616,7 +841,7 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 	}
 
 	if (param_found && notify) {
-		param_notify_changes();
+		param_notify_changes_batched();
 	}
 
 #if defined(CONFIG_PARAM_PRIMARY)
@@ -642,6 +867,8 @@ param_reset_all_internal(bool auto_save)
 	}
 
 	if (auto_save) {
+		// resets are not tracked individually
+		param_journal_compact.store(true);
 		param_autosave();
 	}
 
@@ -731,6 +958,8 @@ param_set_default_file(const char *filename)
 		param_default_file = strdup(filename);
 	}
 
+	param_journal_start = -1;
+
 #endif /* FLASH_BASED_PARAMS */
 
 	return 0;
@@ -769,8 +998,13 @@ const char *param_get_backup_file()
 	return param_backup_file;
 }
 
-static int param_export_internal(int fd, param_filter_func filter);
-static int param_verify(int fd);
+static int param_export_internal(int fd, param_filter_func filter, int32_t *document_size = nullptr);
+static int param_verify(int fd, off_t offset = 0);
+static int param_journal_append(const char *filename);
+static int param_journal_terminate(int fd, int32_t offset);
+static void param_journal_import(int fd);
+static int param_load_default_internal();
+static int param_import_callback(bson_decoder_t decoder, bson_node_t node);
 
 int param_save_default(bool blocking)
 {
@@ -796,16 +1030,43 @@ int param_save_default(bool blocking)
 	int res = PX4_ERROR;
 	const char *filename = param_get_default_file();
 
-	if (filename) {
+	bool full_export = true;
+
+	if (filename && (param_journal_start > 0) && !param_journal_compact.load()) {
+		perf_begin(param_export_perf);
+		res = param_journal_append(filename);
+		perf_end(param_export_perf);
+
+		if (res == PX4_OK) {
+			params_unsaved.reset();
+			full_export = false;
+
+		} else if (res != -EFBIG) {
+			PX4_ERR("parameter journal write to %s failed (%d)", filename, res);
+		}
+	}
+
+	if (!full_export) {
+		// the backup file is only updated with full exports
+
+	} else if (filename) {
 		static constexpr int MAX_ATTEMPTS = 3;
+		param_journal_compact.store(false);
+		param_journal_start = -1;
 
 		for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
 			// write parameters to file
 			int fd = ::open(filename, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+			int32_t document_size = 0;
 
 			if (fd > -1) {
 				perf_begin(param_export_perf);
-				res = param_export_internal(fd, nullptr);
+				res = param_export_internal(fd, nullptr, &document_size);
+
+				if (res == PX4_OK) {
+					res = param_journal_terminate(fd, document_size);
+				}
+
 				perf_end(param_export_perf);
 				::close(fd);
 
@@ -818,6 +1079,8 @@ int param_save_default(bool blocking)
 			}
 
 			if (res == PX4_OK) {
+				param_journal_start = document_size;
+				param_journal_end = document_size;
 				break;
 
 			} else {
@@ -835,7 +1098,7 @@ int param_save_default(bool blocking)
 	if (res != PX4_OK) {
 		PX4_ERR("param export failed (%d)", res);
 
-	} else {
+	} else if (full_export) {
 		params_unsaved.reset();
 
 		// backup file
@@ -873,6 +1136,18 @@ int param_save_default(bool blocking)
  */
 int
 param_load_default()
+{
+	const int res = param_load_default_internal();
+
+	// the layers keep their size after loading, as parameter changes after boot are rare
+	user_config.compact();
+	runtime_defaults.compact();
+
+	return res;
+}
+
+static int
+param_load_default_internal()
 {
 	int res = 0;
 	const char *filename = param_get_default_file();
@@ -894,6 +1169,11 @@ param_load_default()
 	}
 
 	int result = param_load(fd_load);
+
+	if (result == 0) {
+		param_journal_import(fd_load);
+	}
+
 	::close(fd_load);
 
 	if (result != 0) {
@@ -965,7 +1245,7 @@ static int param_verify_callback(bson_decoder_t decoder, bson_node_t node)
 	return -1;
 }
 
-static int param_verify(int fd)
+static int param_verify(int fd, off_t offset)
 {
 	PX4_DEBUG("param_verify");
 
@@ -973,14 +1253,15 @@ static int param_verify(int fd)
 		return -1;
 	}
 
-	if (lseek(fd, 0, SEEK_SET) != 0) {
+	if (lseek(fd, offset, SEEK_SET) != offset) {
 		PX4_ERR("verify: seek failed");
 		return -1;
 	}
 
 	bson_decoder_s decoder{};
+	uint8_t bson_buffer[256];
 
-	if (bson_decoder_init_file(&decoder, fd, param_verify_callback) == 0) {
+	if (bson_decoder_init_buf_file(&decoder, fd, bson_buffer, sizeof(bson_buffer), param_verify_callback) == 0) {
 		int result = -1;
 
 		do {
@@ -1049,7 +1330,7 @@ param_export(const char *filename, param_filter_func filter)
 }
 
 // internal parameter export, caller is responsible for locking
-static int param_export_internal(int fd, param_filter_func filter)
+static int param_export_internal(int fd, param_filter_func filter, int32_t *document_size)
 {
 	PX4_DEBUG("param_export_internal");
 	const auto changed_params = user_config.containedAsBitset();
@@ -1134,12 +1415,182 @@ out:
 		if (bson_encoder_fini(&encoder) != PX4_OK) {
 			PX4_ERR("BSON encoder finalize failed");
 			result = -1;
+
+		} else if (document_size) {
+			*document_size = encoder.total_document_size;
 		}
 	}
 
 	return result;
 }
 
+// write the journal terminator at offset, caller is responsible for locking
+static int param_journal_terminate(int fd, int32_t offset)
+{
+	const int32_t terminator = 0;
+
+	if ((lseek(fd, offset, SEEK_SET) != offset)
+	    || (::write(fd, &terminator, sizeof(terminator)) != sizeof(terminator))) {
+		PX4_ERR("journal terminator write failed %d", errno);
+		return -1;
+	}
+
+	return 0;
+}
+
+// append the unsaved parameters as journal record to the default file, caller is responsible for locking
+static int param_journal_append(const char *filename)
+{
+	bson_encoder_s encoder{};
+	int result = PX4_OK;
+	int num_changed = 0;
+
+	bson_encoder_init_buf(&encoder, nullptr, 0);
+
+	for (param_t param = 0; handle_in_range(param) && (result == PX4_OK); param++) {
+		if (!params_unsaved[param]) {
+			continue;
+		}
+
+		// the current value, which might be the default after a reset
+		const param_value_u value = user_config.get(param);
+
+		switch (param_type(param)) {
+		case PARAM_TYPE_INT32:
+			if (bson_encoder_append_int32(&encoder, param_name(param), value.i) != 0) {
+				result = PX4_ERROR;
+			}
+
+			break;
+
+		case PARAM_TYPE_FLOAT:
+			if (bson_encoder_append_double(&encoder, param_name(param), (double)value.f) != 0) {
+				result = PX4_ERROR;
+			}
+
+			break;
+
+		default:
+			break;
+		}
+
+		num_changed++;
+	}
+
+	if ((result == PX4_OK) && (bson_encoder_fini(&encoder) != PX4_OK)) {
+		result = PX4_ERROR;
+	}
+
+	uint8_t *data = (uint8_t *)bson_encoder_buf_data(&encoder);
+	const int size = bson_encoder_buf_size(&encoder);
+
+	if ((result == PX4_OK) && ((size <= 0) || (param_journal_end + size - param_journal_start > PARAM_JOURNAL_SIZE_MAX))) {
+		// compact the file instead
+		result = -EFBIG;
+	}
+
+	if ((result == PX4_OK) && (num_changed > 0)) {
+		int fd = ::open(filename, O_RDWR, PX4_O_MODE_666);
+
+		if (fd < 0) {
+			result = -errno;
+
+		} else {
+			// the record is only valid once complete, and each record is verified before the next is appended
+			if ((lseek(fd, param_journal_end, SEEK_SET) != param_journal_end)
+			    || (::write(fd, data, size) != size)
+			    || (param_journal_terminate(fd, param_journal_end + size) != 0)) {
+				result = PX4_ERROR;
+
+			} else {
+				::fsync(fd);
+				result = param_verify(fd, param_journal_end);
+			}
+
+			::close(fd);
+		}
+
+		if (result == PX4_OK) {
+			param_journal_end += size;
+		}
+	}
+
+	free(data);
+
+	return result;
+}
+
+static int param_journal_check_callback(bson_decoder_t decoder, bson_node_t node)
+{
+	return (node->type == BSON_EOO) ? 0 : 1;
+}
+
+// import the journal records following the full export in fd, called after param_load()
+static void param_journal_import(int fd)
+{
+	int32_t offset = 0;
+	int num_records = 0;
+
+	param_journal_start = -1;
+
+	if ((lseek(fd, 0, SEEK_SET) != 0) || (::read(fd, &offset, sizeof(offset)) != sizeof(offset)) || (offset <= 0)) {
+		return;
+	}
+
+	const int32_t journal_start = offset;
+
+	while (true) {
+		int32_t size = 0;
+
+		if ((lseek(fd, offset, SEEK_SET) != offset) || (::read(fd, &size, sizeof(size)) != sizeof(size))
+		    || (size <= (int32_t)sizeof(size)) || (size > PARAM_JOURNAL_SIZE_MAX)) {
+			// end of the journal
+			break;
+		}
+
+		// only apply complete records (a write might have been interrupted)
+		bool complete = false;
+
+		for (int pass = 0; pass < 2; pass++) {
+			bson_decoder_s decoder{};
+			uint8_t bson_buffer[256];
+
+			if ((lseek(fd, offset, SEEK_SET) != offset)
+			    || (bson_decoder_init_buf_file(&decoder, fd, bson_buffer, sizeof(bson_buffer),
+							   (pass == 0) ? param_journal_check_callback : param_import_callback) != 0)) {
+				break;
+			}
+
+			int result;
+
+			do {
+				result = bson_decoder_next(&decoder);
+			} while (result > 0);
+
+			complete = (result == 0) && (decoder.total_document_size == decoder.total_decoded_size) && (size == decoder.total_document_size);
+
+			if (!complete) {
+				break;
+			}
+		}
+
+		if (!complete) {
+			PX4_WARN("ignoring incomplete parameter journal record");
+			break;
+		}
+
+		offset += size;
+		num_records++;
+	}
+
+	if (num_records > 0) {
+		PX4_INFO("applied %d parameter journal records (%" PRId32 " bytes)", num_records, offset - journal_start);
+	}
+
+	param_journal_start = journal_start;
+	param_journal_end = offset;
+}
+
 static int
 param_import_callback(bson_decoder_t decoder, bson_node_t node)
 {
@@ -1206,8 +1657,9 @@ param_import_internal(int fd)
 
 	for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
 		bson_decoder_s decoder{};
+		uint8_t bson_buffer[256];
 
-		if (bson_decoder_init_file(&decoder, fd, param_import_callback) == 0) {
+		if (bson_decoder_init_buf_file(&decoder, fd, bson_buffer, sizeof(bson_buffer), param_import_callback) == 0) {
 			int result = -1;
 
 			do {
@@ -1309,8 +1761,8 @@ uint32_t param_hash_check()
 		const char *name = param_name(param);
 		auto value = user_config.get(param).i;
 		const void *val = (void *)&value;
-		param_hash = crc32part((const uint8_t *)name, strlen(name), param_hash);
-		param_hash = crc32part((const uint8_t *)val, param_size(param), param_hash);
+		param_hash = px4_crc32(param_hash, (const uint8_t *)name, strlen(name));
+		param_hash = px4_crc32(param_hash, (const uint8_t *)val, param_size(param));
 	}
 
 	return param_hash;
@@ -1378,3 +1830,45 @@ void param_print_status()
 #endif
 
 }
+
+void param_print_access_profile()
+{
+#if defined(CONFIG_PARAM_ACCESS_PROFILER)
+	// sort by the total number of calls (the counts are only read, so no locking needed)
+	auto total = [](int index) {
+		const param_access_profile_s &entry = param_access_profile[index];
+		return entry.count[(int)ParamAccess::Find] + entry.count[(int)ParamAccess::Get] + entry.count[(int)ParamAccess::Set];
+	};
+
+	uint8_t order[PARAM_ACCESS_PROFILE_SIZE];
+	int num_entries = 0;
+
+	for (int i = 0; i < PARAM_ACCESS_PROFILE_SIZE && param_access_profile[i].name[0] != '\0'; i++) {
+		int j = num_entries++;
+
+		for (; j > 0 && total(order[j - 1]) < total(i); j--) {
+			order[j] = order[j - 1];
+		}
+
+		order[j] = i;
+	}
+
+	PX4_INFO_RAW("%-24s %10s %10s %10s\n", "caller", "find", "get", "set");
+
+	for (int i = 0; i < num_entries; i++) {
+		const param_access_profile_s &entry = param_access_profile[order[i]];
+		PX4_INFO_RAW("%-24s %10" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n", entry.name,
+			     entry.count[(int)ParamAccess::Find], entry.count[(int)ParamAccess::Get], entry.count[(int)ParamAccess::Set]);
+	}
+
+	if (param_access_profile_other[(int)ParamAccess::Find] + param_access_profile_other[(int)ParamAccess::Get]
+	    + param_access_profile_other[(int)ParamAccess::Set] > 0) {
+		PX4_INFO_RAW("%-24s %10" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n", "(other)",
+			     param_access_profile_other[(int)ParamAccess::Find], param_access_profile_other[(int)ParamAccess::Get],
+			     param_access_profile_other[(int)ParamAccess::Set]);
+	}
+
+#else
+	PX4_INFO("access profiler not enabled (CONFIG_PARAM_ACCESS_PROFILER)");
+#endif // CONFIG_PARAM_ACCESS_PROFILER
+}
@@ -190,6 +190,18 @@ int	param_ioctl(unsigned int cmd, unsigned long arg)
 		}
 		break;
 
+	case PARAMIOCUPDATEINSTANCE: {
+			paramiocupdateinstance_t *data = (paramiocupdateinstance_t *)arg;
+			data->ret = param_update_instance();
+		}
+		break;
+
+	case PARAMIOCCHANGEDSINCE: {
+			paramiocchangedsince_t *data = (paramiocchangedsince_t *)arg;
+			data->ret = param_changed_since(data->param, data->instance);
+		}
+		break;
+
 	default:
 		ret = -ENOTTY;
 		break;
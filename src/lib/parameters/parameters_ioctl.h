@@ -161,4 +161,16 @@ typedef struct paramiochash {
 	uint32_t ret;
 } paramiochash_t;
 
+#define PARAMIOCUPDATEINSTANCE	_PARAMIOC(19)
+typedef struct paramiocupdateinstance {
+	uint32_t ret;
+} paramiocupdateinstance_t;
+
+#define PARAMIOCCHANGEDSINCE	_PARAMIOC(20)
+typedef struct paramiocchangedsince {
+	const param_t param;
+	const uint32_t instance;
+	bool ret;
+} paramiocchangedsince_t;
+
 int param_ioctl(unsigned int cmd, unsigned long arg);
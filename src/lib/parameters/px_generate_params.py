@@ -19,6 +19,65 @@ except ImportError as e:
 
 import os
 
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+HASH_BUCKET_SIZE = 4 # average number of names per bucket of the first level hash
+HASH_MAX_DISPLACEMENT = 0xffff
+
+
+def name_hash(name, seed):
+    """ FNV-1a hash of a name, must match param_name_hash() in the template """
+    h = FNV_OFFSET_BASIS ^ seed
+    for c in name.encode('ascii'):
+        h = ((h ^ c) * FNV_PRIME) & 0xffffffff
+    return h
+
+
+def perfect_hash(names):
+    """
+    Create a minimal perfect hash (hash and displace) for a list of names:
+    slots[name_hash(name, displacements[name_hash(name, 0) % len(displacements)]) % len(names)]
+    is the index of name in the list.
+
+    @return (displacements, slots)
+    """
+    num_slots = max(len(names), 1)
+    num_buckets = max((len(names) + HASH_BUCKET_SIZE - 1) // HASH_BUCKET_SIZE, 1)
+
+    while True:
+        buckets = [[] for _ in range(num_buckets)]
+        for index, name in enumerate(names):
+            buckets[name_hash(name, 0) % num_buckets].append(index)
+
+        displacements = [0] * num_buckets
+        slots = [None] * num_slots
+        success = True
+
+        # place the largest buckets first, while most of the slots are still free
+        for bucket in sorted(range(num_buckets), key=lambda b: len(buckets[b]), reverse=True):
+            if len(buckets[bucket]) == 0:
+                break
+
+            for displacement in range(1, HASH_MAX_DISPLACEMENT + 1):
+                bucket_slots = [name_hash(names[i], displacement) % num_slots for i in buckets[bucket]]
+
+                if len(set(bucket_slots)) == len(bucket_slots) and \
+                        all(slots[slot] is None for slot in bucket_slots):
+                    break
+            else:
+                success = False
+                break
+
+            displacements[bucket] = displacement
+            for i, slot in zip(buckets[bucket], bucket_slots):
+                slots[slot] = i
+
+        if success:
+            return displacements, [0 if slot is None else slot for slot in slots]
+
+        # smaller buckets are easier to place
+        num_buckets = num_buckets * 2
+
 def generate(xml_file, dest='.'):
     """
     Generate px4 param source from xml.
@@ -39,6 +98,8 @@ def generate(xml_file, dest='.'):
 
     params = sorted(params, key=lambda name: name.attrib["name"])
 
+    hash_displacements, hash_slots = perfect_hash([param.attrib["name"] for param in params])
+
     script_path = os.path.dirname(os.path.realpath(__file__))
 
     # for jinja docs see: http://jinja.pocoo.org/docs/2.9/api/
@@ -55,7 +116,8 @@ def generate(xml_file, dest='.'):
         template = env.get_template(template_file)
         with open(os.path.join(
                 dest, template_file.replace('.jinja','')), 'w') as fid:
-            fid.write(template.render(params=params))
+            fid.write(template.render(params=params,
+                hash_displacements=hash_displacements, hash_slots=hash_slots))
 
 if __name__ == "__main__":
     arg_parser = argparse.ArgumentParser()
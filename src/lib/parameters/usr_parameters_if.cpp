@@ -219,3 +219,17 @@ uint32_t param_hash_check()
 	boardctl(PARAMIOCHASH, reinterpret_cast<unsigned long>(&data));
 	return data.ret;
 }
+
+uint32_t param_update_instance()
+{
+	paramiocupdateinstance_t data = {0};
+	boardctl(PARAMIOCUPDATEINSTANCE, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
+
+bool param_changed_since(param_t param, uint32_t instance)
+{
+	paramiocchangedsince_t data = {param, instance, true};
+	boardctl(PARAMIOCCHANGEDSINCE, reinterpret_cast<unsigned long>(&data));
+	return data.ret;
+}
@@ -44,6 +44,7 @@
 #include <drivers/drv_hrt.h>
 #include <math.h>
 #include <pthread.h>
+#include <px4_platform_common/atomic.h>
 #include <systemlib/err.h>
 
 #include "perf_counter.h"
@@ -91,6 +92,91 @@ struct perf_ctr_interval : public perf_ctr_header {
 	float			M2{0.0f};
 };
 
+/**
+ * PC_HISTOGRAM counter.
+ *
+ * Log-scale buckets with 4 sub-buckets per power of 2: values 0-3 have their own bucket,
+ * above the bucket width is 25% of its lower bound. The buckets and the maximum are
+ * atomics, so recording a value never blocks.
+ */
+static constexpr int PERF_HISTOGRAM_BUCKETS = 124;
+
+struct perf_ctr_histogram : public perf_ctr_header {
+	uint64_t		time_start{0};
+	px4::atomic<uint32_t>	time_most{0};
+	px4::atomic<uint32_t>	buckets[PERF_HISTOGRAM_BUCKETS];
+};
+
+static inline int perf_histogram_bucket(uint32_t value)
+{
+	if (value < 4) {
+		return value;
+	}
+
+	const int msb = 31 - __builtin_clz(value);
+	return 4 * (msb - 1) + ((value >> (msb - 2)) & 3);
+}
+
+// largest value falling into the bucket
+static inline uint32_t perf_histogram_bucket_upper(int bucket)
+{
+	if (bucket < 4) {
+		return bucket;
+	}
+
+	const int msb = bucket / 4 + 1;
+	const uint64_t lower = (uint64_t)(4 + (bucket % 4)) << (msb - 2);
+	return (uint32_t)(lower + ((uint64_t)1 << (msb - 2)) - 1);
+}
+
+static void perf_histogram_record(struct perf_ctr_histogram *pch, uint32_t value)
+{
+	pch->buckets[perf_histogram_bucket(value)].fetch_add(1);
+
+	uint32_t most = pch->time_most.load();
+
+	while ((value > most) && !pch->time_most.compare_exchange(&most, value)) {}
+}
+
+static uint64_t perf_histogram_count(const struct perf_ctr_histogram *pch)
+{
+	uint64_t count = 0;
+
+	for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+		count += pch->buckets[i].load();
+	}
+
+	return count;
+}
+
+static uint32_t perf_histogram_percentile(const struct perf_ctr_histogram *pch, uint64_t count, float percentile)
+{
+	if (count == 0) {
+		return 0;
+	}
+
+	// smallest value with at least the given share of the events at or below it
+	uint64_t rank = (uint64_t)ceil((double)percentile / 100. * count);
+
+	if (rank == 0) {
+		rank = 1;
+	}
+
+	uint64_t cumulative = 0;
+
+	for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+		cumulative += pch->buckets[i].load();
+
+		if (cumulative >= rank) {
+			const uint32_t upper = perf_histogram_bucket_upper(i);
+			const uint32_t most = pch->time_most.load();
+			return (upper < most) ? upper : most;
+		}
+	}
+
+	return pch->time_most.load();
+}
+
 /**
  * List of all known counters.
  */
@@ -126,6 +212,10 @@ perf_alloc(enum perf_counter_type type, const char *name)
 		ctr = new perf_ctr_interval();
 		break;
 
+	case PC_HISTOGRAM:
+		ctr = new perf_ctr_histogram();
+		break;
+
 	default:
 		break;
 	}
@@ -194,6 +284,10 @@ perf_free(perf_counter_t handle)
 		delete (struct perf_ctr_interval *)handle;
 		break;
 
+	case PC_HISTOGRAM:
+		delete (struct perf_ctr_histogram *)handle;
+		break;
+
 	default:
 		break;
 	}
@@ -232,6 +326,10 @@ perf_begin(perf_counter_t handle)
 		((struct perf_ctr_elapsed *)handle)->time_start = hrt_absolute_time();
 		break;
 
+	case PC_HISTOGRAM:
+		((struct perf_ctr_histogram *)handle)->time_start = hrt_absolute_time();
+		break;
+
 	default:
 		break;
 	}
@@ -254,6 +352,17 @@ perf_end(perf_counter_t handle)
 		}
 		break;
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+
+			if (pch->time_start != 0) {
+				const hrt_abstime elapsed = hrt_elapsed_time(&pch->time_start);
+				pch->time_start = 0;
+				perf_set_elapsed(handle, elapsed);
+			}
+		}
+		break;
+
 	default:
 		break;
 	}
@@ -294,6 +403,13 @@ perf_set_elapsed(perf_counter_t handle, int64_t elapsed)
 		}
 		break;
 
+	case PC_HISTOGRAM:
+		if (elapsed >= 0) {
+			perf_histogram_record((struct perf_ctr_histogram *)handle, (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed);
+		}
+
+		break;
+
 	default:
 		break;
 	}
@@ -387,6 +503,10 @@ perf_cancel(perf_counter_t handle)
 		}
 		break;
 
+	case PC_HISTOGRAM:
+		((struct perf_ctr_histogram *)handle)->time_start = 0;
+		break;
+
 	default:
 		break;
 	}
@@ -424,6 +544,18 @@ perf_reset(perf_counter_t handle)
 			pci->time_most = 0;
 			break;
 		}
+
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			pch->time_start = 0;
+			pch->time_most.store(0);
+
+			for (int i = 0; i < PERF_HISTOGRAM_BUCKETS; i++) {
+				pch->buckets[i].store(0);
+			}
+
+			break;
+		}
 	}
 }
 
@@ -470,6 +602,20 @@ perf_print_counter(perf_counter_t handle)
 			break;
 		}
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			const uint64_t count = perf_histogram_count(pch);
+
+			PX4_INFO_RAW("%s: %" PRIu64 " events, p50 %" PRIu32 "us p99 %" PRIu32 "us p99.9 %" PRIu32 "us max %" PRIu32 "us\n",
+				     handle->name,
+				     count,
+				     perf_histogram_percentile(pch, count, 50.f),
+				     perf_histogram_percentile(pch, count, 99.f),
+				     perf_histogram_percentile(pch, count, 99.9f),
+				     pch->time_most.load());
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -522,6 +668,21 @@ perf_print_counter_buffer(char *buffer, int length, perf_counter_t handle)
 			break;
 		}
 
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+			const uint64_t count = perf_histogram_count(pch);
+
+			num_written = snprintf(buffer, length,
+					       "%s: %" PRIu64 " events, p50 %" PRIu32 "us p99 %" PRIu32 "us p99.9 %" PRIu32 "us max %" PRIu32 "us",
+					       handle->name,
+					       count,
+					       perf_histogram_percentile(pch, count, 50.f),
+					       perf_histogram_percentile(pch, count, 99.f),
+					       perf_histogram_percentile(pch, count, 99.9f),
+					       pch->time_most.load());
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -551,6 +712,9 @@ perf_event_count(perf_counter_t handle)
 			return pci->event_count;
 		}
 
+	case PC_HISTOGRAM:
+		return perf_histogram_count((struct perf_ctr_histogram *)handle);
+
 	default:
 		break;
 	}
@@ -583,6 +747,17 @@ perf_mean(perf_counter_t handle)
 	return 0.0f;
 }
 
+uint32_t
+perf_percentile(perf_counter_t handle, float percentile)
+{
+	if ((handle == nullptr) || (handle->type != PC_HISTOGRAM)) {
+		return 0;
+	}
+
+	const struct perf_ctr_histogram *pch = (const struct perf_ctr_histogram *)handle;
+	return perf_histogram_percentile(pch, perf_histogram_count(pch), percentile);
+}
+
 void
 perf_iterate_all(perf_callback cb, void *user)
 {
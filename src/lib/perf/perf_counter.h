@@ -48,7 +48,8 @@
 enum perf_counter_type {
 	PC_COUNT,		/**< count the number of times an event occurs */
 	PC_ELAPSED,		/**< measure the time elapsed performing an event */
-	PC_INTERVAL		/**< measure the interval between instances of an event */
+	PC_INTERVAL,		/**< measure the interval between instances of an event */
+	PC_HISTOGRAM		/**< distribution of the time elapsed performing an event (log-scale buckets, lock-free updates) */
 };
 
 struct perf_ctr_header;
@@ -120,6 +121,8 @@ __EXPORT extern void		perf_end(perf_counter_t handle);
  * This call applies to counters that operate over ranges of time; PC_ELAPSED etc.
  * If a call is made without a corresponding perf_begin call. It sets the
  * value provided as argument as a new measurement.
+ * For PC_HISTOGRAM counters this is lock-free and can be called concurrently and from
+ * interrupt context (unlike perf_begin/perf_end, which share a single start time).
  *
  * @param handle		The handle returned from perf_alloc.
  * @param elapsed		The time elapsed. Negative values lead to incrementing the overrun counter.
@@ -230,6 +233,18 @@ __EXPORT extern uint64_t	perf_event_count(perf_counter_t handle);
  */
 __EXPORT extern float		perf_mean(perf_counter_t handle);
 
+/**
+ * Return a percentile of a PC_HISTOGRAM counter
+ *
+ * The buckets have a relative width of 25%, the returned value is the upper bound
+ * of the bucket containing the percentile (at most the largest recorded value).
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param percentile		Percentile in [0, 100], e.g. 99.9
+ * @return			elapsed time [us], 0 if the counter is empty or not a histogram
+ */
+__EXPORT extern uint32_t	perf_percentile(perf_counter_t handle, float percentile);
+
 __END_DECLS
 
 #endif
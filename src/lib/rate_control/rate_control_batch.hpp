@@ -0,0 +1,182 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file rate_control_batch.hpp
+ *
+ * PID 3 axis angular rate control for a batch of N vehicles in structure of arrays layout,
+ * e.g. to run many simulated vehicles in one process.
+ * Same control law as RateControl, written without branches in the vehicle loops so they can be vectorized.
+ */
+
+#pragma once
+
+#include <matrix/matrix/math.hpp>
+
+#include <mathlib/mathlib.h>
+#include <px4_platform_common/defines.h>
+
+template<int N>
+class RateControlBatch
+{
+public:
+	static_assert(N > 0, "batch needs at least one vehicle");
+
+	RateControlBatch() = default;
+	~RateControlBatch() = default;
+
+	static constexpr int size() { return N; }
+
+	/**
+	 * Set the rate control PID gains of one vehicle
+	 * @see RateControl::setPidGains()
+	 */
+	void setPidGains(int vehicle, const matrix::Vector3f &P, const matrix::Vector3f &I, const matrix::Vector3f &D)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			_gain_p[axis][vehicle] = P(axis);
+			_gain_i[axis][vehicle] = I(axis);
+			_gain_d[axis][vehicle] = D(axis);
+		}
+	}
+
+	/**
+	 * Set the maximum absolute value of the integrator of one vehicle
+	 * @see RateControl::setIntegratorLimit()
+	 */
+	void setIntegratorLimit(int vehicle, const matrix::Vector3f &integrator_limit)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			_lim_int[axis][vehicle] = integrator_limit(axis);
+		}
+	}
+
+	/**
+	 * Set direct rate to torque feed forward gain of one vehicle
+	 * @see RateControl::setFeedForwardGain()
+	 */
+	void setFeedForwardGain(int vehicle, const matrix::Vector3f &FF)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			_gain_ff[axis][vehicle] = FF(axis);
+		}
+	}
+
+	/**
+	 * Set saturation status of one vehicle
+	 * @see RateControl::setSaturationStatus()
+	 */
+	void setSaturationStatus(int vehicle, const matrix::Vector3<bool> &saturation_positive,
+				 const matrix::Vector3<bool> &saturation_negative)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			_saturation_positive[axis][vehicle] = saturation_positive(axis);
+			_saturation_negative[axis][vehicle] = saturation_negative(axis);
+		}
+	}
+
+	/**
+	 * Set the integral term of one vehicle to 0
+	 * @see RateControl::resetIntegral()
+	 */
+	void resetIntegral(int vehicle)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			_rate_int[axis][vehicle] = 0.f;
+		}
+	}
+
+	/**
+	 * Run one control loop cycle for all vehicles of the batch
+	 * All arrays are indexed [axis][vehicle].
+	 * @param rate estimation of the current vehicle angular rates
+	 * @param rate_sp desired vehicle angular rate setpoints
+	 * @param angular_accel estimation of the current vehicle angular accelerations
+	 * @param dt time since the last update
+	 * @param landed per vehicle landed flag, the integrators are frozen if set
+	 * @param torque output [-1,1] normalized torques to apply to the vehicles
+	 */
+	void update(const float rate[3][N], const float rate_sp[3][N], const float angular_accel[3][N], const float dt,
+		    const bool landed[N], float torque[3][N])
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			for (int vehicle = 0; vehicle < N; vehicle++) {
+				const float rate_error = rate_sp[axis][vehicle] - rate[axis][vehicle];
+
+				// PID control with feed forward
+				torque[axis][vehicle] = _gain_p[axis][vehicle] * rate_error + _rate_int[axis][vehicle]
+							- _gain_d[axis][vehicle] * angular_accel[axis][vehicle]
+							+ _gain_ff[axis][vehicle] * rate_sp[axis][vehicle];
+
+				// prevent further control saturation
+				float rate_error_i = _saturation_positive[axis][vehicle] ? math::min(rate_error, 0.f) : rate_error;
+				rate_error_i = _saturation_negative[axis][vehicle] ? math::max(rate_error_i, 0.f) : rate_error_i;
+
+				// reduce the I gain with increasing rate error, see RateControl::updateIntegral()
+				float i_factor = rate_error_i / math::radians(400.f);
+				i_factor = math::max(0.0f, 1.f - i_factor * i_factor);
+
+				const float rate_i = _rate_int[axis][vehicle] + i_factor * _gain_i[axis][vehicle] * rate_error_i * dt;
+
+				// update integral only if not landed and do not propagate the result if invalid
+				const bool update_integral = !landed[vehicle] && PX4_ISFINITE(rate_i);
+				const float rate_i_constrained = math::constrain(rate_i, -_lim_int[axis][vehicle], _lim_int[axis][vehicle]);
+				_rate_int[axis][vehicle] = update_integral ? rate_i_constrained : _rate_int[axis][vehicle];
+			}
+		}
+	}
+
+	/**
+	 * @return integral term of one vehicle
+	 */
+	matrix::Vector3f getIntegral(int vehicle) const
+	{
+		return matrix::Vector3f(_rate_int[0][vehicle], _rate_int[1][vehicle], _rate_int[2][vehicle]);
+	}
+
+private:
+	// Gains
+	float _gain_p[3][N] {}; ///< rate control proportional gain for all axes x, y, z
+	float _gain_i[3][N] {}; ///< rate control integral gain
+	float _gain_d[3][N] {}; ///< rate control derivative gain
+	float _lim_int[3][N] {}; ///< integrator term maximum absolute value
+	float _gain_ff[3][N] {}; ///< direct rate to torque feed forward gain only useful for helicopters
+
+	// States
+	float _rate_int[3][N] {}; ///< integral term of the rate controllers
+
+	// Feedback from control allocation
+	bool _saturation_positive[3][N] {};
+	bool _saturation_negative[3][N] {};
+};
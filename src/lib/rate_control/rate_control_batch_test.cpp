@@ -0,0 +1,99 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <lib/rate_control/rate_control.hpp>
+#include <lib/rate_control/rate_control_batch.hpp>
+
+using namespace matrix;
+
+TEST(RateControlBatchTest, MatchesScalarController)
+{
+	static constexpr int N = 7;
+	RateControlBatch<N> batch;
+	RateControl scalar[N];
+	float rate[3][N];
+	float rate_sp[3][N];
+	float angular_accel[3][N];
+	bool landed[N];
+	float torque[3][N];
+
+	for (int vehicle = 0; vehicle < N; vehicle++) {
+		const Vector3f P(0.15f, 0.15f + 0.01f * vehicle, 0.2f);
+		const Vector3f I(0.2f, 0.2f, 0.1f * vehicle);
+		const Vector3f D(0.003f, 0.003f, 0.f);
+		const Vector3f integrator_limit(0.3f, 0.3f, 0.05f);
+		const Vector3f FF(0.f, 0.f, 0.01f * vehicle);
+		const Vector3<bool> saturation_positive(vehicle == 1, false, vehicle == 2);
+		const Vector3<bool> saturation_negative(false, vehicle == 3, false);
+
+		batch.setPidGains(vehicle, P, I, D);
+		batch.setIntegratorLimit(vehicle, integrator_limit);
+		batch.setFeedForwardGain(vehicle, FF);
+		batch.setSaturationStatus(vehicle, saturation_positive, saturation_negative);
+		scalar[vehicle].setPidGains(P, I, D);
+		scalar[vehicle].setIntegratorLimit(integrator_limit);
+		scalar[vehicle].setFeedForwardGain(FF);
+		scalar[vehicle].setSaturationStatus(saturation_positive, saturation_negative);
+
+		landed[vehicle] = (vehicle == 4);
+	}
+
+	for (int iteration = 0; iteration < 50; iteration++) {
+		for (int vehicle = 0; vehicle < N; vehicle++) {
+			for (int axis = 0; axis < 3; axis++) {
+				rate[axis][vehicle] = 0.1f * sinf(0.3f * iteration + vehicle + axis);
+				rate_sp[axis][vehicle] = (axis - 1) * 0.5f + 0.2f * vehicle;
+				angular_accel[axis][vehicle] = cosf(0.2f * iteration * (axis + 1));
+			}
+		}
+
+		batch.update(rate, rate_sp, angular_accel, 0.004f, landed, torque);
+
+		for (int vehicle = 0; vehicle < N; vehicle++) {
+			const Vector3f expected = scalar[vehicle].update(
+							  Vector3f(rate[0][vehicle], rate[1][vehicle], rate[2][vehicle]),
+							  Vector3f(rate_sp[0][vehicle], rate_sp[1][vehicle], rate_sp[2][vehicle]),
+							  Vector3f(angular_accel[0][vehicle], angular_accel[1][vehicle], angular_accel[2][vehicle]),
+							  0.004f, landed[vehicle]);
+
+			for (int axis = 0; axis < 3; axis++) {
+				EXPECT_FLOAT_EQ(torque[axis][vehicle], expected(axis));
+			}
+		}
+	}
+
+	// landed vehicle did not integrate
+	EXPECT_EQ(batch.getIntegral(4), Vector3f());
+}
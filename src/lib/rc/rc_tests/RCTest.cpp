@@ -15,6 +15,7 @@
 #include <lib/rc/sumd.h>
 #include <lib/rc/crsf.h>
 #include <lib/rc/ghst.hpp>
+#include <lib/rc/common_rc.h>
 
 #if defined(CONFIG_ARCH_BOARD_PX4_SITL)
 #define TEST_DATA_PATH "./test_data/"
@@ -38,6 +39,8 @@ private:
 	bool dsmTest22msDSMX16Ch();
 	bool dsmTestOrangeDsmx();
 	bool sbus2Test();
+	bool sbusBatchTest();
+	bool crc8Test();
 	bool st24Test();
 	bool sumdTest();
 };
@@ -51,6 +54,8 @@ bool RCTest::run_tests()
 	ut_run_test(dsmTest22msDSMX16Ch);
 	ut_run_test(dsmTestOrangeDsmx);
 	ut_run_test(sbus2Test);
+	ut_run_test(sbusBatchTest);
+	ut_run_test(crc8Test);
 	ut_run_test(st24Test);
 	ut_run_test(sumdTest);
 
@@ -396,6 +401,108 @@ bool RCTest::sbus2Test()
 	return true;
 }
 
+bool RCTest::sbusBatchTest()
+{
+	// frames with known channel values, several of them per parser call
+	static constexpr unsigned num_frames = 200;
+	static uint8_t stream[num_frames * SBUS_FRAME_SIZE];
+
+	for (unsigned frame = 0; frame < num_frames; frame++) {
+		uint8_t *f = &stream[frame * SBUS_FRAME_SIZE];
+		memset(f, 0, SBUS_FRAME_SIZE);
+		f[0] = 0x0f;
+
+		// pack 16 channels of 11 bits, least significant bit first
+		for (unsigned channel = 0; channel < 16; channel++) {
+			const unsigned raw = 200 + 100 * channel + frame % 8;
+
+			for (unsigned bit = 0; bit < 11; bit++) {
+				if (raw & (1u << bit)) {
+					const unsigned pos = channel * 11 + bit;
+					f[1 + pos / 8] |= 1u << (pos % 8);
+				}
+			}
+		}
+	}
+
+	uint16_t rc_values[18];
+	uint16_t num_values = 0;
+	unsigned sbus_frame_drops = 0;
+	bool sbus_failsafe = false;
+	bool sbus_frame_drop = false;
+	uint16_t max_channels = sizeof(rc_values) / sizeof(rc_values[0]);
+
+	static constexpr unsigned frames_per_call = 4;
+	static constexpr unsigned repetitions = 50;
+	unsigned decoded = 0;
+
+	const hrt_abstime start = hrt_absolute_time();
+
+	for (unsigned repetition = 0; repetition < repetitions; repetition++) {
+		for (unsigned frame = 0; frame < num_frames; frame += frames_per_call) {
+			if (sbus_parse(0, &stream[frame * SBUS_FRAME_SIZE], frames_per_call * SBUS_FRAME_SIZE, rc_values, &num_values,
+				       &sbus_failsafe, &sbus_frame_drop, &sbus_frame_drops, max_channels)) {
+				decoded++;
+			}
+		}
+	}
+
+	const hrt_abstime elapsed = hrt_elapsed_time(&start);
+
+	ut_compare("all calls decoded", decoded, repetitions * num_frames / frames_per_call);
+	ut_compare("num_values", num_values, 18);
+	ut_test(!sbus_failsafe && !sbus_frame_drop);
+
+	// the last decoded frame is the last one of the stream
+	for (unsigned channel = 0; channel < 16; channel++) {
+		const float raw = 200 + 100 * channel + (num_frames - 1) % 8;
+		const int expected = (int)(1000.f + (raw - 200.f) * (1000.f / 1600.f));
+		ut_test(abs(expected - (int)rc_values[channel]) <= 1);
+	}
+
+	PX4_INFO("SBUS: %u frames in %" PRIu64 " us (%.2f us per frame)", repetitions * num_frames, elapsed,
+		 (double)elapsed / (repetitions * num_frames));
+
+	return true;
+}
+
+bool RCTest::crc8Test()
+{
+	uint8_t buf[64];
+
+	for (unsigned i = 0; i < sizeof(buf); i++) {
+		buf[i] = i * 37 + 11;
+	}
+
+	// bitwise reference of CRC8 DVB-S2
+	uint8_t expected = 0;
+
+	for (unsigned i = 0; i < sizeof(buf); i++) {
+		expected ^= buf[i];
+
+		for (int bit = 0; bit < 8; ++bit) {
+			expected = (expected & 0x80) ? (expected << 1) ^ 0xD5 : expected << 1;
+		}
+	}
+
+	ut_compare("crc8_dvb_s2_buf", crc8_dvb_s2_buf(buf, sizeof(buf)), expected);
+
+	static constexpr unsigned repetitions = 1000;
+	uint8_t crc = 0;
+	const hrt_abstime start = hrt_absolute_time();
+
+	for (unsigned repetition = 0; repetition < repetitions; repetition++) {
+		buf[0] = repetition;
+		crc ^= crc8_dvb_s2_buf(buf, sizeof(buf));
+	}
+
+	const hrt_abstime elapsed = hrt_elapsed_time(&start);
+
+	PX4_INFO("CRC8: %u bytes in %" PRIu64 " us (crc %u)", repetitions * (unsigned)sizeof(buf), elapsed, crc);
+
+	return true;
+}
+
 bool RCTest::st24Test()
 {
 	const char *filepath = TEST_DATA_PATH "st24_data.txt";
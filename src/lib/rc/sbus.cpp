@@ -136,6 +136,29 @@ static bool
 sbus_decode(uint64_t frame_time, uint8_t *frame, uint16_t *values, uint16_t *num_values,
 	    bool *sbus_failsafe, bool *sbus_frame_drop, uint16_t max_values);
 
+/**
+ * Check the start and end markers of a frame, a frame passing this is always decoded by sbus_decode()
+ */
+static inline bool
+sbus_frame_complete(const uint8_t *frame)
+{
+	if (frame[0] != SBUS_START_SYMBOL) {
+		return false;
+	}
+
+	switch (frame[SBUS_FRAME_SIZE - 1]) {
+	case 0x00:
+	case 0x04:
+	case 0x14:
+	case 0x24:
+	case 0x34:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
 int
 sbus_init(const char *device, bool singlewire)
 {
@@ -333,6 +356,18 @@ sbus_parse(uint64_t now, uint8_t *frame, unsigned len, uint16_t *values,
 	/* keep decoding until we have consumed the buffer */
 	for (unsigned d = 0; d < len; d++) {
 
+		/* fast path: a complete frame starts here, decode it in place instead of byte by byte */
+		if (partial_frame_count == 0 && (len - d) >= SBUS_FRAME_SIZE
+		    && (sbus_decode_state == SBUS2_DECODE_STATE_DESYNC || sbus_decode_state == SBUS2_DECODE_STATE_SBUS_START
+			|| sbus_decode_state == SBUS2_DECODE_STATE_SBUS1_SYNC || sbus_decode_state == SBUS2_DECODE_STATE_SBUS2_SYNC)
+		    && sbus_frame_complete(&frame[d])) {
+
+			decode_ret = sbus_decode(now, &frame[d], values, num_values, sbus_failsafe, sbus_frame_drop, max_channels);
+			sbus_decode_state = SBUS2_DECODE_STATE_SBUS_START;
+			d += SBUS_FRAME_SIZE - 1;
+			continue;
+		}
+
 		/* overflow check */
 		if (partial_frame_count == sizeof(sbus_frame) / sizeof(sbus_frame[0])) {
 			partial_frame_count = 0;
@@ -528,42 +563,6 @@ sbus_parse(uint64_t now, uint8_t *frame, unsigned len, uint16_t *values,
 	return decode_ret;
 }
 
-/*
- * S.bus decoder matrix.
- *
- * Each channel value can come from up to 3 input bytes. Each row in the
- * matrix describes up to three bytes, and each entry gives:
- *
- * - byte offset in the data portion of the frame
- * - right shift applied to the data byte
- * - mask for the data byte
- * - left shift applied to the result into the channel value
- */
-struct sbus_bit_pick {
-	uint8_t byte;
-	uint8_t rshift;
-	uint8_t mask;
-	uint8_t lshift;
-};
-static const struct sbus_bit_pick sbus_decoder[SBUS_INPUT_CHANNELS][3] = {
-	/*  0 */ { { 0, 0, 0xff, 0}, { 1, 0, 0x07, 8}, { 0, 0, 0x00,  0} },
-	/*  1 */ { { 1, 3, 0x1f, 0}, { 2, 0, 0x3f, 5}, { 0, 0, 0x00,  0} },
-	/*  2 */ { { 2, 6, 0x03, 0}, { 3, 0, 0xff, 2}, { 4, 0, 0x01, 10} },
-	/*  3 */ { { 4, 1, 0x7f, 0}, { 5, 0, 0x0f, 7}, { 0, 0, 0x00,  0} },
-	/*  4 */ { { 5, 4, 0x0f, 0}, { 6, 0, 0x7f, 4}, { 0, 0, 0x00,  0} },
-	/*  5 */ { { 6, 7, 0x01, 0}, { 7, 0, 0xff, 1}, { 8, 0, 0x03,  9} },
-	/*  6 */ { { 8, 2, 0x3f, 0}, { 9, 0, 0x1f, 6}, { 0, 0, 0x00,  0} },
-	/*  7 */ { { 9, 5, 0x07, 0}, {10, 0, 0xff, 3}, { 0, 0, 0x00,  0} },
-	/*  8 */ { {11, 0, 0xff, 0}, {12, 0, 0x07, 8}, { 0, 0, 0x00,  0} },
-	/*  9 */ { {12, 3, 0x1f, 0}, {13, 0, 0x3f, 5}, { 0, 0, 0x00,  0} },
-	/* 10 */ { {13, 6, 0x03, 0}, {14, 0, 0xff, 2}, {15, 0, 0x01, 10} },
-	/* 11 */ { {15, 1, 0x7f, 0}, {16, 0, 0x0f, 7}, { 0, 0, 0x00,  0} },
-	/* 12 */ { {16, 4, 0x0f, 0}, {17, 0, 0x7f, 4}, { 0, 0, 0x00,  0} },
-	/* 13 */ { {17, 7, 0x01, 0}, {18, 0, 0xff, 1}, {19, 0, 0x03,  9} },
-	/* 14 */ { {19, 2, 0x3f, 0}, {20, 0, 0x1f, 6}, { 0, 0, 0x00,  0} },
-	/* 15 */ { {20, 5, 0x07, 0}, {21, 0, 0xff, 3}, { 0, 0, 0x00,  0} }
-};
-
 bool
 sbus_decode(uint64_t frame_time, uint8_t *frame, uint16_t *values, uint16_t *num_values,
 	    bool *sbus_failsafe, bool *sbus_frame_drop, uint16_t max_values)
@@ -624,23 +623,20 @@ sbus_decode(uint64_t frame_time, uint8_t *frame, uint16_t *values, uint16_t *num
 	unsigned chancount = (max_values > SBUS_INPUT_CHANNELS) ?
 			     SBUS_INPUT_CHANNELS : max_values;
 
-	/* use the decoder matrix to extract channel data */
-	for (unsigned channel = 0; channel < chancount; channel++) {
-		unsigned value = 0;
-
-		for (unsigned pick = 0; pick < 3; pick++) {
-			const struct sbus_bit_pick *decode = &sbus_decoder[channel][pick];
+	/* the channels are packed as consecutive 11 bit values, least significant bit first */
+	const uint8_t *data = &frame[1];
+	uint32_t bits = 0;
+	unsigned num_bits = 0;
 
-			if (decode->mask != 0) {
-				unsigned piece = frame[1 + decode->byte];
-				piece >>= decode->rshift;
-				piece &= decode->mask;
-				piece <<= decode->lshift;
-
-				value |= piece;
-			}
+	for (unsigned channel = 0; channel < chancount; channel++) {
+		while (num_bits < 11) {
+			bits |= (uint32_t)(*data++) << num_bits;
+			num_bits += 8;
 		}
 
+		const unsigned value = bits & 0x7ff;
+		bits >>= 11;
+		num_bits -= 11;
 
 		/* convert 0-2048 values to 1000-2000 ppm encoding in a not too sloppy fashion */
 		values[channel] = (uint16_t)(value * SBUS_SCALE_FACTOR + .5f) + SBUS_SCALE_OFFSET;
@@ -0,0 +1,95 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "RoverControlPipeline.hpp"
+
+RoverControlPipeline::RoverControlPipeline(px4::WorkItem *work_item) :
+	_vehicle_angular_velocity_sub{work_item, ORB_ID(vehicle_angular_velocity)},
+	_vehicle_local_position_sub{work_item, ORB_ID(vehicle_local_position)}
+{
+	_vehicle_angular_velocity_sub.set_interval_us(CONTROL_INTERVAL_MIN);
+}
+
+bool RoverControlPipeline::registerCallbacks()
+{
+	const bool angular_velocity_registered = _vehicle_angular_velocity_sub.registerCallback();
+	const bool local_position_registered = _vehicle_local_position_sub.registerCallback();
+
+	return angular_velocity_registered && local_position_registered;
+}
+
+void RoverControlPipeline::unregisterCallbacks()
+{
+	_vehicle_angular_velocity_sub.unregisterCallback();
+	_vehicle_local_position_sub.unregisterCallback();
+}
+
+void RoverControlPipeline::updateState()
+{
+	if (_vehicle_attitude_sub.updated()) {
+		vehicle_attitude_s vehicle_attitude{};
+		_vehicle_attitude_sub.copy(&vehicle_attitude);
+		_attitude = matrix::Quatf(vehicle_attitude.q);
+		_yaw = matrix::Eulerf(_attitude).psi();
+	}
+
+	vehicle_angular_velocity_s vehicle_angular_velocity;
+
+	if (_vehicle_angular_velocity_sub.update(&vehicle_angular_velocity)) {
+		_yaw_rate = vehicle_angular_velocity.xyz[2];
+	}
+
+	vehicle_local_position_s vehicle_local_position;
+	_local_position_updated = _vehicle_local_position_sub.update(&vehicle_local_position);
+
+	if (_local_position_updated) {
+		_position_ned = Vector2f(vehicle_local_position.x, vehicle_local_position.y);
+		const Vector3f velocity_in_local_frame(vehicle_local_position.vx, vehicle_local_position.vy,
+						       vehicle_local_position.vz);
+		const Vector3f velocity_in_body_frame = _attitude.rotateVectorInverse(velocity_in_local_frame);
+		// Apply threshold to the velocity measurement to cut off measurement noise when standing still
+		_forward_speed = fabsf(velocity_in_body_frame(0)) > SPEED_THRESHOLD ? velocity_in_body_frame(0) : 0.f;
+		_lateral_speed = fabsf(velocity_in_body_frame(1)) > SPEED_THRESHOLD ? velocity_in_body_frame(1) : 0.f;
+		_acceleration_ned = Vector3f(vehicle_local_position.ax, vehicle_local_position.ay, vehicle_local_position.az);
+	}
+}
+
+Vector2f RoverControlPipeline::courseControlTarget(PurePursuit &pure_pursuit, const Vector2f &start_position_ned,
+		const Vector2f &course_direction) const
+{
+	const float crosstrack_error = pure_pursuit.getCrosstrackError();
+	const float vector_scaling = sqrtf(_lookahead_max_sq + crosstrack_error * crosstrack_error)
+				     + pure_pursuit.getDistanceOnLineSegment();
+	return start_position_ned + vector_scaling * course_direction;
+}
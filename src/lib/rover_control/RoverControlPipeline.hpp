@@ -0,0 +1,116 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <lib/pure_pursuit/PurePursuit.hpp>
+#include <matrix/math.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_attitude.h>
+#include <uORB/topics/vehicle_local_position.h>
+
+/**
+ * @file RoverControlPipeline.hpp
+ *
+ * Vehicle state and scheduling shared by the rover modules (ackermann, differential and mecanum).
+ * The modules run on every new angular velocity or local position sample instead of a fixed
+ * interval, such that the controllers act on a sample right after it has been published. The
+ * angular velocity, which is published at the IMU rate, is limited to CONTROL_INTERVAL_MIN.
+ */
+class RoverControlPipeline
+{
+public:
+	/**
+	 * @param work_item Work item of the rover module, scheduled on new estimator samples.
+	 */
+	explicit RoverControlPipeline(px4::WorkItem *work_item);
+	~RoverControlPipeline() = default;
+
+	/**
+	 * @brief Register the estimator callbacks that schedule the rover module.
+	 * @return true if the rover module will be scheduled
+	 */
+	bool registerCallbacks();
+	void unregisterCallbacks();
+
+	/**
+	 * @brief Update the vehicle state from the latest estimator samples, call once per cycle.
+	 */
+	void updateState();
+
+	/**
+	 * @brief Construct a 'target waypoint' for course control s.t. it is never within the maximum lookahead of the rover.
+	 * @param pure_pursuit Pure pursuit instance of the course control.
+	 * @param start_position_ned Position at which the course control was engaged [m].
+	 * @param course_direction Unit vector of the course in NED frame.
+	 * @return North/East coordinates of the target waypoint in NED frame [m].
+	 */
+	Vector2f courseControlTarget(PurePursuit &pure_pursuit, const Vector2f &start_position_ned,
+				     const Vector2f &course_direction) const;
+
+	void setLookaheadMax(float lookahead_max) { _lookahead_max_sq = lookahead_max * lookahead_max; }
+
+	const matrix::Quatf &attitude() const { return _attitude; }
+	float yaw() const { return _yaw; }
+	float yawRate() const { return _yaw_rate; } ///< [rad/s] unfiltered, the modules apply their own threshold
+	const Vector2f &positionNed() const { return _position_ned; }
+	float forwardSpeed() const { return _forward_speed; } ///< [m/s] zero below SPEED_THRESHOLD
+	float lateralSpeed() const { return _lateral_speed; } ///< [m/s] zero below SPEED_THRESHOLD
+	const Vector3f &accelerationNed() const { return _acceleration_ned; } ///< [m/s^2] may be NAN
+	bool localPositionUpdated() const { return _local_position_updated; }
+
+	// [m/s] The minimum threshold for the speed measurement not to be interpreted as zero
+	static constexpr float SPEED_THRESHOLD = 0.1f;
+
+	// [us] Minimum interval between two control cycles triggered by the angular velocity (250 Hz)
+	static constexpr uint32_t CONTROL_INTERVAL_MIN = 4000;
+
+private:
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub;
+	uORB::SubscriptionCallbackWorkItem _vehicle_local_position_sub;
+	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
+
+	matrix::Quatf _attitude{};
+	float _yaw{0.f};
+	float _yaw_rate{0.f};
+	Vector2f _position_ned{};
+	float _forward_speed{0.f};
+	float _lateral_speed{0.f};
+	Vector3f _acceleration_ned{NAN, NAN, NAN};
+	bool _local_position_updated{false};
+
+	float _lookahead_max_sq{0.f};
+};
@@ -72,6 +72,19 @@ rtl_time_estimate_s RtlTimeEstimator::getEstimate() const
 		time_estimate.valid = false;
 	}
 
+	time_estimate.energy_estimate = NAN;
+	time_estimate.home_time_estimate = NAN;
+	time_estimate.safe_point_time_estimate = NAN;
+	time_estimate.mission_land_time_estimate = NAN;
+
+	const battery_status_s &battery_status = _battery_status_sub.get();
+
+	// The power draw so far is the best guess for the power during the return
+	if (time_estimate.valid && battery_status.connected && (battery_status.voltage_v > FLT_EPSILON)
+	    && (battery_status.current_average_a > FLT_EPSILON)) {
+		time_estimate.energy_estimate = _time_estimate * battery_status.voltage_v * battery_status.current_average_a / 3600.f;
+	}
+
 	time_estimate.timestamp = hrt_absolute_time();
 	return time_estimate;
 }
@@ -79,6 +92,7 @@ rtl_time_estimate_s RtlTimeEstimator::getEstimate() const
 void RtlTimeEstimator::update()
 {
 	_wind_sub.update();
+	_battery_status_sub.update();
 
 	if (_parameter_update_sub.updated()) {
 		parameter_update_s param_update;
@@ -90,6 +104,18 @@ void RtlTimeEstimator::update()
 	}
 }
 
+void RtlTimeEstimator::addDirectReturn(float alt, float return_alt, float hor_dist,
+				       const matrix::Vector2f &hor_direction, float destination_alt)
+{
+	if (alt < return_alt) {
+		addVertDistance(return_alt - alt);
+		alt = return_alt;
+	}
+
+	addDistance(hor_dist, hor_direction, 0.f);
+	addVertDistance(destination_alt - alt);
+}
+
 void RtlTimeEstimator::addVertDistance(float alt)
 {
 	if (PX4_ISFINITE(alt)) {
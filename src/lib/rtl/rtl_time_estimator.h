@@ -45,6 +45,7 @@
 
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionInterval.hpp>
+#include <uORB/topics/battery_status.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/rtl_time_estimate.h>
 #include <uORB/topics/vehicle_status.h>
@@ -68,6 +69,18 @@ public:
 	void addDistance(float hor_dist, const matrix::Vector2f &hor_direction, float vert_dist);
 	void addVertDistance(float alt);
 	void addWait(float time_s);
+
+	/**
+	 * @brief Add a direct return: climb to the return altitude if below, cruise, descend to the destination
+	 *
+	 * @param alt current altitude AMSL [m]
+	 * @param return_alt return altitude AMSL [m]
+	 * @param hor_dist horizontal distance to the destination [m]
+	 * @param hor_direction horizontal direction to the destination
+	 * @param destination_alt altitude AMSL of the destination [m]
+	 */
+	void addDirectReturn(float alt, float return_alt, float hor_dist, const matrix::Vector2f &hor_direction,
+			     float destination_alt);
 	void setVehicleType(uint8_t vehicle_type) { _vehicle_type = vehicle_type; };
 
 private:
@@ -134,6 +147,7 @@ private:
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s}; /**< Parameter update topic */
 	uORB::SubscriptionData<wind_s>		_wind_sub{ORB_ID(wind)};		/**< wind topic */
+	uORB::SubscriptionData<battery_status_s> _battery_status_sub{ORB_ID(battery_status)};	/**< battery status topic */
 };
 
 #endif /* RTL_TIME_ESTIMATOR_H_ */
@@ -88,15 +88,19 @@ void Accelerometer::SensorCorrectionsUpdate(bool force)
 					switch (i) {
 					case 0:
 						_thermal_offset = Vector3f{corrections.accel_offset_0};
+						UpdateCorrection();
 						return;
 					case 1:
 						_thermal_offset = Vector3f{corrections.accel_offset_1};
+						UpdateCorrection();
 						return;
 					case 2:
 						_thermal_offset = Vector3f{corrections.accel_offset_2};
+						UpdateCorrection();
 						return;
 					case 3:
 						_thermal_offset = Vector3f{corrections.accel_offset_3};
+						UpdateCorrection();
 						return;
 					}
 				}
@@ -105,6 +109,7 @@ void Accelerometer::SensorCorrectionsUpdate(bool force)
 
 		// zero thermal offset if not found
 		_thermal_offset.zero();
+		UpdateCorrection();
 	}
 }
 
@@ -113,6 +118,7 @@ bool Accelerometer::set_offset(const Vector3f &offset)
 	if (Vector3f(_offset - offset).longerThan(0.01f)) {
 		if (offset.isAllFinite()) {
 			_offset = offset;
+			UpdateCorrection();
 			_calibration_count++;
 			return true;
 		}
@@ -126,6 +132,7 @@ bool Accelerometer::set_scale(const Vector3f &scale)
 	if (Vector3f(_scale - scale).longerThan(0.01f)) {
 		if (scale.isAllFinite() && (scale(0) > 0.f) && (scale(1) > 0.f) && (scale(2) > 0.f)) {
 			_scale = scale;
+			UpdateCorrection();
 			_calibration_count++;
 			return true;
 		}
@@ -140,6 +147,14 @@ void Accelerometer::set_rotation(Rotation rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * get_rot_matrix(rotation);
+	UpdateCorrection();
+}
+
+void Accelerometer::UpdateCorrection()
+{
+	// fuse rotation, scale and offsets into a single affine transform
+	_correction_matrix = _rotation * matrix::diag(_scale);
+	_correction_offset = _correction_matrix * (_thermal_offset + _offset);
 }
 
 bool Accelerometer::set_calibration_index(int calibration_index)
@@ -232,6 +247,8 @@ void Accelerometer::Reset()
 
 	_thermal_offset.zero();
 
+	UpdateCorrection();
+
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
 	_calibration_index = -1;
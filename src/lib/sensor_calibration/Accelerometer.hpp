@@ -81,7 +81,8 @@ public:
 	// rotate corrected measurements from sensor to body frame
 	inline matrix::Vector3f Correct(const matrix::Vector3f &data) const
 	{
-		return _rotation * matrix::Vector3f{(data - _thermal_offset - _offset).emult(_scale)};
+		// equivalent to _rotation * (data - _thermal_offset - _offset).emult(_scale)
+		return _correction_matrix * data - _correction_offset;
 	}
 
 	// Compute sensor offset from bias (board frame)
@@ -100,6 +101,9 @@ public:
 	void SensorCorrectionsUpdate(bool force = false);
 
 private:
+	// recompute the cached transform used by Correct() after any calibration change
+	void UpdateCorrection();
+
 	uORB::Subscription _sensor_correction_sub{ORB_ID(sensor_correction)};
 
 	Rotation _rotation_enum{ROTATION_NONE};
@@ -109,6 +113,9 @@ private:
 	matrix::Vector3f _scale;
 	matrix::Vector3f _thermal_offset;
 
+	matrix::Matrix3f _correction_matrix;
+	matrix::Vector3f _correction_offset;
+
 	int8_t _calibration_index{-1};
 	uint32_t _device_id{0};
 	int32_t _priority{-1};
@@ -88,15 +88,19 @@ void Gyroscope::SensorCorrectionsUpdate(bool force)
 					switch (i) {
 					case 0:
 						_thermal_offset = Vector3f{corrections.gyro_offset_0};
+						UpdateCorrection();
 						return;
 					case 1:
 						_thermal_offset = Vector3f{corrections.gyro_offset_1};
+						UpdateCorrection();
 						return;
 					case 2:
 						_thermal_offset = Vector3f{corrections.gyro_offset_2};
+						UpdateCorrection();
 						return;
 					case 3:
 						_thermal_offset = Vector3f{corrections.gyro_offset_3};
+						UpdateCorrection();
 						return;
 					}
 				}
@@ -105,6 +109,7 @@ void Gyroscope::SensorCorrectionsUpdate(bool force)
 
 		// zero thermal offset if not found
 		_thermal_offset.zero();
+		UpdateCorrection();
 	}
 }
 
@@ -113,6 +118,7 @@ bool Gyroscope::set_offset(const Vector3f &offset)
 	if (Vector3f(_offset - offset).longerThan(0.01f) || (_calibration_count == 0)) {
 		if (offset.isAllFinite()) {
 			_offset = offset;
+			UpdateCorrection();
 			_calibration_count++;
 			return true;
 		}
@@ -127,6 +133,13 @@ void Gyroscope::set_rotation(Rotation rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * get_rot_matrix(rotation);
+	UpdateCorrection();
+}
+
+void Gyroscope::UpdateCorrection()
+{
+	// fuse rotation and offsets into a single affine transform
+	_correction_offset = _rotation * (_thermal_offset + _offset);
 }
 
 bool Gyroscope::set_calibration_index(int calibration_index)
@@ -215,6 +228,8 @@ void Gyroscope::Reset()
 
 	_thermal_offset.zero();
 
+	UpdateCorrection();
+
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
 	_calibration_index = -1;
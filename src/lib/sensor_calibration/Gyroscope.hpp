@@ -80,7 +80,8 @@ public:
 	// rotate corrected measurements from sensor to body frame
 	inline matrix::Vector3f Correct(const matrix::Vector3f &data) const
 	{
-		return _rotation * matrix::Vector3f{data - _thermal_offset - _offset};
+		// equivalent to _rotation * (data - _thermal_offset - _offset)
+		return _rotation * data - _correction_offset;
 	}
 
 	inline matrix::Vector3f Uncorrect(const matrix::Vector3f &corrected_data) const
@@ -104,6 +105,9 @@ public:
 	void SensorCorrectionsUpdate(bool force = false);
 
 private:
+	// recompute the cached transform used by Correct() after any calibration change
+	void UpdateCorrection();
+
 	uORB::Subscription _sensor_correction_sub{ORB_ID(sensor_correction)};
 
 	Rotation _rotation_enum{ROTATION_NONE};
@@ -112,6 +116,8 @@ private:
 	matrix::Vector3f _offset;
 	matrix::Vector3f _thermal_offset;
 
+	matrix::Vector3f _correction_offset;
+
 	int8_t _calibration_index{-1};
 	uint32_t _device_id{0};
 	int32_t _priority{-1};
@@ -113,6 +113,7 @@ bool Magnetometer::set_offset(const Vector3f &offset)
 	if (Vector3f(_offset - offset).longerThan(0.005f)) {
 		if (offset.isAllFinite()) {
 			_offset = offset;
+			UpdateCorrection();
 			_calibration_count++;
 			return true;
 		}
@@ -128,6 +129,7 @@ bool Magnetometer::set_scale(const Vector3f &scale)
 			_scale(0, 0) = scale(0);
 			_scale(1, 1) = scale(1);
 			_scale(2, 2) = scale(2);
+			UpdateCorrection();
 
 			_calibration_count++;
 			return true;
@@ -150,6 +152,7 @@ bool Magnetometer::set_offdiagonal(const Vector3f &offdiagonal)
 
 			_scale(1, 2) = offdiagonal(2);
 			_scale(2, 1) = offdiagonal(2);
+			UpdateCorrection();
 
 			_calibration_count++;
 			return true;
@@ -174,6 +177,8 @@ void Magnetometer::set_rotation(const Rotation rotation)
 
 	// clear any custom rotation
 	_rotation_custom_euler.zero();
+
+	UpdateCorrection();
 }
 
 void Magnetometer::set_custom_rotation(const Eulerf &rotation)
@@ -185,6 +190,7 @@ void Magnetometer::set_custom_rotation(const Eulerf &rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * Dcmf(_rotation_custom_euler);
+	UpdateCorrection();
 
 	// TODO: Note that ideally this shouldn't be necessary for an external sensors, as the definition of *rotation
 	// between sensor frame & vehicle's body frame isn't affected by the rotation of the Autopilot.
@@ -194,6 +200,14 @@ void Magnetometer::set_custom_rotation(const Eulerf &rotation)
 	// values properly (i.e. finding Vehicle's true Forward-Right-Down frame in a user's perspective)
 }
 
+void Magnetometer::UpdateCorrection()
+{
+	// fuse rotation, scale (including soft iron) and offsets into a single affine transform
+	_correction_matrix = _rotation * _scale;
+	_correction_offset = _correction_matrix * _offset;
+	_correction_power_compensation = _correction_matrix * _power_compensation;
+}
+
 bool Magnetometer::set_calibration_index(int calibration_index)
 {
 	if ((calibration_index >= 0) && (calibration_index < MAX_SENSOR_COUNT)) {
@@ -294,6 +308,7 @@ bool Magnetometer::ParametersLoad()
 
 		// CAL_MAGx_COMP{X,Y,Z}
 		_power_compensation = GetCalibrationParamsVector3f(SensorString(), "COMP", _calibration_index);
+		UpdateCorrection();
 
 		return true;
 	}
@@ -317,6 +332,8 @@ void Magnetometer::Reset()
 	_power_compensation.zero();
 	_power = 0.f;
 
+	UpdateCorrection();
+
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
 	_calibration_index = -1;
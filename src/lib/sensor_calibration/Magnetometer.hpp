@@ -96,7 +96,27 @@ public:
 	// rotate corrected measurements from sensor to body frame
 	inline matrix::Vector3f Correct(const matrix::Vector3f &data) const
 	{
-		return _rotation * (_scale * ((data + _power * _power_compensation) - _offset));
+		// equivalent to _rotation * (_scale * ((data + _power * _power_compensation) - _offset))
+		return _correction_matrix * data + _power * _correction_power_compensation - _correction_offset;
+	}
+
+	/**
+	 * Correct() for a batch of samples stored per axis, [axis][sample], in place
+	 */
+	template<size_t N>
+	void Correct(float (&data)[3][N], size_t count) const
+	{
+		const matrix::Vector3f constant_term = _power * _correction_power_compensation - _correction_offset;
+		const matrix::Matrix3f &m = _correction_matrix;
+
+		for (size_t i = 0; i < count && i < N; i++) {
+			const float x = data[0][i];
+			const float y = data[1][i];
+			const float z = data[2][i];
+			data[0][i] = m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + constant_term(0);
+			data[1][i] = m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + constant_term(1);
+			data[2][i] = m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + constant_term(2);
+		}
 	}
 
 	// Compute sensor offset from bias (board frame)
@@ -117,6 +137,9 @@ public:
 	void UpdatePower(float power) { _power = power; }
 
 private:
+	// recompute the cached transform used by Correct() after any calibration change
+	void UpdateCorrection();
+
 	uORB::Subscription _sensor_correction_sub{ORB_ID(sensor_correction)};
 
 	Rotation _rotation_enum{ROTATION_NONE};
@@ -133,6 +156,10 @@ private:
 	matrix::Vector3f _thermal_offset;
 	matrix::Vector3f _power_compensation;
 
+	matrix::Matrix3f _correction_matrix;
+	matrix::Vector3f _correction_offset;
+	matrix::Vector3f _correction_power_compensation;
+
 	float _power{0.f};
 
 	int8_t _calibration_index{-1};
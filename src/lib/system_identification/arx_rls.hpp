@@ -49,6 +49,9 @@
  * y  output of the system
  * e  white noise input
  *
+ * The covariance is updated as a symmetric rank one correction, O(n^2) per
+ * sample instead of the O(n^3) of the full matrix products.
+ *
  * References:
  * - Identification de systemes dynamiques, D.Bonvin and A.Karimi, epfl, 2011
  *
@@ -122,11 +125,24 @@ public:
 		}
 
 		const matrix::Vector < float, N + M + 1 > phi = constructDesignVector();
-		const matrix::Matrix < float, 1, N + M + 1 > phi_t = phi.transpose();
 
-		_P = (_P - _P * phi * phi_t * _P / (_lambda + (phi_t * _P * phi)(0, 0))) / _lambda;
-		_innovation = _y[N] - (phi_t * _theta_hat)(0, 0);
-		_theta_hat = _theta_hat + _P * phi * _innovation;
+		// P is symmetric: phi' * P = (P * phi)'
+		const matrix::Vector < float, N + M + 1 > p_phi = _P * phi;
+		const float gain_den = _lambda + phi.dot(p_phi);
+		const float inv_lambda = 1.f / _lambda;
+
+		for (size_t i = 0; i < N + M + 1; i++) {
+			const float p_phi_i = p_phi(i) / gain_den;
+
+			for (size_t j = i; j < N + M + 1; j++) {
+				_P(i, j) = (_P(i, j) - p_phi_i * p_phi(j)) * inv_lambda;
+				_P(j, i) = _P(i, j);
+			}
+		}
+
+		// the updated P * phi is p_phi / gain_den
+		_innovation = _y[N] - phi.dot(_theta_hat);
+		_theta_hat = _theta_hat + p_phi * (_innovation / gain_den);
 
 		for (size_t i = 0; i < N + M + 1; i++) {
 			_diff_theta_hat(i) = fabsf(_theta_hat(i) - theta_prev(i));
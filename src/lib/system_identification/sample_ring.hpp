@@ -0,0 +1,91 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file sample_ring.hpp
+ * @brief Fixed size single producer, single consumer sample queue
+ *
+ * Lets the control path hand the identification samples over to the model
+ * update running on another work queue without locking. push() and pop()
+ * fail instead of blocking when the ring is full or empty.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <px4_platform_common/atomic.h>
+
+template<typename T, uint32_t SIZE>
+class SampleRing final
+{
+public:
+	static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of 2");
+
+	bool push(const T &sample)
+	{
+		const uint32_t head = _head.load();
+
+		if (head - _tail.load() >= SIZE) {
+			return false;
+		}
+
+		_samples[head & (SIZE - 1)] = sample;
+		_head.store(head + 1);
+		return true;
+	}
+
+	bool pop(T &sample)
+	{
+		const uint32_t tail = _tail.load();
+
+		if (tail == _head.load()) {
+			return false;
+		}
+
+		sample = _samples[tail & (SIZE - 1)];
+		_tail.store(tail + 1);
+		return true;
+	}
+
+	uint32_t size() const { return _head.load() - _tail.load(); }
+
+	// consumer side, drops all queued samples
+	void clear() { _tail.store(_head.load()); }
+
+private:
+	T _samples[SIZE] {};
+	px4::atomic<uint32_t> _head{0};
+	px4::atomic<uint32_t> _tail{0};
+};
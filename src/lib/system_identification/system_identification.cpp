@@ -60,7 +60,12 @@ void SystemIdentification::update(float u, float y)
 
 void SystemIdentification::update()
 {
-	_rls.update(_u_hpf, _y_hpf);
+	updateModel(_u_hpf, _y_hpf);
+}
+
+void SystemIdentification::updateModel(float u_filt, float y_filt)
+{
+	_rls.update(u_filt, y_filt);
 	updateFitness();
 }
 
@@ -46,6 +46,7 @@
 #include <px4_platform_common/defines.h>
 
 #include "arx_rls.hpp"
+#include "sample_ring.hpp"
 
 class SystemIdentification final
 {
@@ -56,6 +57,7 @@ public:
 	void reset(const matrix::Vector<float, 5> &id_state_init = {});
 	void update(float u, float y); // update filters and model
 	void update(); // update model only (to be called after updateFilters)
+	void updateModel(float u_filt, float y_filt); // update model with a filtered sample
 	void updateFilters(float u, float y);
 	bool areFiltersInitialized() const { return _are_filters_initialized; }
 	void updateFitness();
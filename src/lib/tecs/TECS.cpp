@@ -312,6 +312,20 @@ TECSControl::STERateLimit TECSControl::_calculateTotalEnergyRateLimit(const Para
 	return limit;
 }
 
+void TECSControl::evaluateEnergyDemand(const float height_rate[], const float tas[], const float tas_rate[],
+				       float cost[], int num, const Param &param) const
+{
+	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
+
+	for (int i = 0; i < num; i++) {
+		// specific total energy rate: potential (g * h_dot) and kinetic (v * v_dot) part
+		const float ste_rate = height_rate[i] * CONSTANTS_ONE_G + tas[i] * tas_rate[i];
+
+		cost[i] = math::max(ste_rate - limit.STE_rate_max, 0.0f) / limit.STE_rate_max
+			  + math::max(limit.STE_rate_min - ste_rate, 0.0f) / -limit.STE_rate_min;
+	}
+}
+
 float TECSControl::_calcAirspeedControlOutput(const Setpoint &setpoint, const Input &input, const Param &param,
 		const Flag &flag) const
 {
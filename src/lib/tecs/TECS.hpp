@@ -302,6 +302,18 @@ public:
 	 * @param[in] flag is the current activated flags.
 	 */
 	void update(float dt, const Setpoint &setpoint, const Input &input, Param &param, const Flag &flag);
+	/**
+	 * @brief Evaluate the specific total energy rate demand of candidates, without changing the controller state.
+	 *
+	 * @param[in] height_rate is the demanded height rate of each candidate in [m/s].
+	 * @param[in] tas is the true airspeed of each candidate in [m/s].
+	 * @param[in] tas_rate is the demanded true airspeed rate of each candidate in [m/s²].
+	 * @param[out] cost is the specific total energy rate demand beyond the throttle limits, relative to the exceeded limit. Zero if achievable.
+	 * @param[in] num is the number of candidates.
+	 * @param[in] param is the current parameter set.
+	 */
+	void evaluateEnergyDemand(const float height_rate[], const float tas[], const float tas_rate[], float cost[], int num,
+				  const Param &param) const;
 	/**
 	 * @brief Reset the control loop integrals.
 	 *
@@ -595,6 +607,22 @@ public:
 		_control.resetIntegrals();
 	}
 
+	/**
+	 * @brief Evaluate the specific total energy rate demand of candidate climbs and airspeed changes against the
+	 * throttle limits, e.g. to choose between paths. Doesn't change the controller state.
+	 *
+	 * @param[in] height_rate is the demanded height rate of each candidate in [m/s].
+	 * @param[in] tas is the true airspeed of each candidate in [m/s].
+	 * @param[in] tas_rate is the demanded true airspeed rate of each candidate in [m/s²].
+	 * @param[out] cost is the demand beyond the throttle limits, relative to the exceeded limit. Zero if achievable.
+	 * @param[in] num is the number of candidates.
+	 */
+	void evaluateEnergyDemand(const float height_rate[], const float tas[], const float tas_rate[], float cost[],
+				  int num) const
+	{
+		_control.evaluateEnergyDemand(height_rate, tas, tas_rate, cost, num, _control_param);
+	}
+
 	void set_detect_underspeed_enabled(bool enabled) { _control_flag.detect_underspeed_enabled = enabled; };
 
 	// setters for parameters
@@ -0,0 +1,246 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainMapCache.cpp
+ */
+
+#include "TerrainMapCache.hpp"
+
+#include <containers/LockGuard.hpp>
+#include <lib/mathlib/mathlib.h>
+
+#include <math.h>
+#include <string.h>
+
+static TerrainMapCache terrain_map_cache;
+
+TerrainMapCache &TerrainMapCache::instance()
+{
+	return terrain_map_cache;
+}
+
+TerrainMapCache::CellIndex TerrainMapCache::cellIndex(double lat, double lon)
+{
+	const int32_t cell_lat = (int32_t)floor(lat / CELL_SIZE_DEG);
+	const int32_t cell_lon = (int32_t)floor(lon / CELL_SIZE_DEG);
+
+	// floor division, cells south and west of 0 belong to the negative tiles
+	CellIndex index;
+	index.tile_lat = (cell_lat >= 0) ? (cell_lat / TILE_CELLS) : -((-cell_lat - 1) / TILE_CELLS) - 1;
+	index.tile_lon = (cell_lon >= 0) ? (cell_lon / TILE_CELLS) : -((-cell_lon - 1) / TILE_CELLS) - 1;
+	index.row = cell_lat - index.tile_lat * TILE_CELLS;
+	index.col = cell_lon - index.tile_lon * TILE_CELLS;
+	return index;
+}
+
+TerrainMapCache::Tile *TerrainMapCache::findTile(int32_t tile_lat, int32_t tile_lon)
+{
+	for (Tile &tile : _tiles) {
+		if (tile.last_used != 0 && tile.tile_lat == tile_lat && tile.tile_lon == tile_lon) {
+			return &tile;
+		}
+	}
+
+	return nullptr;
+}
+
+TerrainMapCache::Tile &TerrainMapCache::allocateTile(int32_t tile_lat, int32_t tile_lon)
+{
+	// free slot, or evict the least recently used tile
+	Tile *oldest = &_tiles[0];
+
+	for (Tile &tile : _tiles) {
+		if (tile.last_used < oldest->last_used) {
+			oldest = &tile;
+		}
+	}
+
+	memset(oldest, 0, sizeof(Tile));
+	oldest->tile_lat = tile_lat;
+	oldest->tile_lon = tile_lon;
+	touch(*oldest);
+	return *oldest;
+}
+
+void TerrainMapCache::update(double lat, double lon, float terrain_alt)
+{
+	if (!PX4_ISFINITE(lat) || !PX4_ISFINITE(lon) || !PX4_ISFINITE(terrain_alt)) {
+		return;
+	}
+
+	const CellIndex index = cellIndex(lat, lon);
+
+	LockGuard lg{_mutex};
+
+	Tile *tile = findTile(index.tile_lat, index.tile_lon);
+
+	if (tile == nullptr) {
+		tile = &allocateTile(index.tile_lat, index.tile_lon);
+
+	} else {
+		touch(*tile);
+	}
+
+	int16_t &height = tile->height[index.row][index.col];
+	uint8_t &weight = tile->weight[index.row][index.col];
+
+	float height_m = terrain_alt;
+
+	if (weight > 0) {
+		// running average over the first samples, then a low pass to follow changes
+		const float gain = 1.f / (float)math::min((int)weight + 1, (int)WEIGHT_MAX_GAIN);
+		const float previous_m = height * HEIGHT_RESOLUTION;
+		height_m = previous_m + gain * (terrain_alt - previous_m);
+	}
+
+	height = (int16_t)math::constrain(roundf(height_m / HEIGHT_RESOLUTION), (float)INT16_MIN, (float)INT16_MAX);
+
+	if (weight < UINT8_MAX) {
+		weight++;
+	}
+
+	tile->modified = true;
+}
+
+bool TerrainMapCache::lookup(double lat, double lon, float &terrain_alt, uint8_t *weight)
+{
+	if (!PX4_ISFINITE(lat) || !PX4_ISFINITE(lon)) {
+		return false;
+	}
+
+	const CellIndex index = cellIndex(lat, lon);
+
+	LockGuard lg{_mutex};
+
+	Tile *tile = findTile(index.tile_lat, index.tile_lon);
+
+	if (tile == nullptr || tile->weight[index.row][index.col] == 0) {
+		return false;
+	}
+
+	touch(*tile);
+
+	terrain_alt = tile->height[index.row][index.col] * HEIGHT_RESOLUTION;
+
+	if (weight) {
+		*weight = tile->weight[index.row][index.col];
+	}
+
+	return true;
+}
+
+bool TerrainMapCache::takeModifiedTile(int slot, terrain_map_row_s (&rows)[TILE_CELLS])
+{
+	if (slot < 0 || slot >= NUM_TILES) {
+		return false;
+	}
+
+	LockGuard lg{_mutex};
+
+	Tile &tile = _tiles[slot];
+
+	if (tile.last_used == 0 || !tile.modified) {
+		return false;
+	}
+
+	for (int row = 0; row < TILE_CELLS; row++) {
+		rows[row].tile_lat = tile.tile_lat;
+		rows[row].tile_lon = tile.tile_lon;
+		memcpy(rows[row].height, tile.height[row], sizeof(rows[row].height));
+		memcpy(rows[row].weight, tile.weight[row], sizeof(rows[row].weight));
+	}
+
+	tile.modified = false;
+	return true;
+}
+
+void TerrainMapCache::restoreRow(const terrain_map_row_s &row, int row_index)
+{
+	if (row_index < 0 || row_index >= TILE_CELLS) {
+		return;
+	}
+
+	bool empty = true;
+
+	for (int col = 0; col < TILE_CELLS; col++) {
+		empty = empty && (row.weight[col] == 0);
+	}
+
+	if (empty) {
+		return;
+	}
+
+	LockGuard lg{_mutex};
+
+	Tile *tile = findTile(row.tile_lat, row.tile_lon);
+
+	if (tile == nullptr) {
+		tile = &allocateTile(row.tile_lat, row.tile_lon);
+	}
+
+	// cells measured in this flight take precedence over the stored ones
+	for (int col = 0; col < TILE_CELLS; col++) {
+		if (tile->weight[row_index][col] == 0) {
+			tile->height[row_index][col] = row.height[col];
+			tile->weight[row_index][col] = row.weight[col];
+		}
+	}
+
+	// the tile may have landed in a different slot than it was stored in, so it is saved again
+	tile->modified = true;
+}
+
+void TerrainMapCache::clear()
+{
+	LockGuard lg{_mutex};
+
+	memset(_tiles, 0, sizeof(_tiles));
+	_use_counter = 0;
+}
+
+int TerrainMapCache::numTilesUsed()
+{
+	LockGuard lg{_mutex};
+
+	int used = 0;
+
+	for (const Tile &tile : _tiles) {
+		if (tile.last_used != 0) {
+			used++;
+		}
+	}
+
+	return used;
+}
@@ -0,0 +1,149 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file TerrainMapCache.hpp
+ *
+ * Tiled cache of the terrain altitude under the flight path, fed by range
+ * finder based terrain estimates, so that repeated overflights of an area can
+ * use what was measured before: EKF2 as prior of its terrain state and
+ * navigator to look ahead of the vehicle.
+ *
+ * The map is a grid of CELL_SIZE_DEG in latitude and longitude, grouped into
+ * square tiles of TILE_CELLS cells. A fixed number of tiles is kept in RAM,
+ * the least recently used one is evicted when a new area is entered. The tile
+ * rows have the layout of the DM_KEY_TERRAIN_MAP dataman item to persist them.
+ *
+ * The cache is shared by all modules through instance(), every method locks.
+ */
+
+#pragma once
+
+#include <navigator/navigation.h>
+
+#include <pthread.h>
+#include <stdint.h>
+
+class TerrainMapCache
+{
+public:
+	static constexpr int TILE_CELLS = 16;			///< cells per tile side
+	static constexpr int NUM_TILES = 16;			///< tiles kept in RAM
+	static constexpr double CELL_SIZE_DEG = 1e-4;		///< ~11 m in latitude
+	static constexpr float HEIGHT_RESOLUTION = 0.25f;	///< resolution of the stored altitude [m]
+	static constexpr uint8_t WEIGHT_MAX_GAIN = 16;		///< samples over which a cell is averaged before it tracks changes
+
+	static_assert(sizeof(terrain_map_row_s::height) / sizeof(terrain_map_row_s::height[0]) == TILE_CELLS,
+		      "terrain_map_row_s does not match the tile size");
+
+	TerrainMapCache() = default;
+	~TerrainMapCache() = default;
+
+	// no copy, assignment, move, move assignment
+	TerrainMapCache(const TerrainMapCache &) = delete;
+	TerrainMapCache &operator=(const TerrainMapCache &) = delete;
+	TerrainMapCache(TerrainMapCache &&) = delete;
+	TerrainMapCache &operator=(TerrainMapCache &&) = delete;
+
+	/**
+	 * The cache shared by the modules of this process
+	 */
+	static TerrainMapCache &instance();
+
+	/**
+	 * Add a terrain altitude sample
+	 *
+	 * @param lat latitude [deg]
+	 * @param lon longitude [deg]
+	 * @param terrain_alt terrain altitude AMSL [m]
+	 */
+	void update(double lat, double lon, float terrain_alt);
+
+	/**
+	 * Terrain altitude of the cell at a position
+	 *
+	 * @param terrain_alt terrain altitude AMSL [m], set if the cell is known
+	 * @param weight number of samples of the cell (saturating), optional
+	 * @return true if the cell is known
+	 */
+	bool lookup(double lat, double lon, float &terrain_alt, uint8_t *weight = nullptr);
+
+	/**
+	 * Copy the rows of a tile that changed since the last call, and mark it saved
+	 *
+	 * @param slot tile slot, in [0, NUM_TILES)
+	 * @return true if the tile changed and rows was filled
+	 */
+	bool takeModifiedTile(int slot, terrain_map_row_s (&rows)[TILE_CELLS]);
+
+	/**
+	 * Restore a row persisted with takeModifiedTile()
+	 *
+	 * @param row_index row within its tile, in [0, TILE_CELLS)
+	 */
+	void restoreRow(const terrain_map_row_s &row, int row_index);
+
+	void clear();
+
+	int numTilesUsed();
+
+private:
+	struct Tile {
+		int32_t tile_lat;
+		int32_t tile_lon;
+		int16_t height[TILE_CELLS][TILE_CELLS];
+		uint8_t weight[TILE_CELLS][TILE_CELLS];
+		uint32_t last_used;	///< value of _use_counter at the last access, 0 if the slot is free
+		bool modified;
+	};
+
+	struct CellIndex {
+		int32_t tile_lat;
+		int32_t tile_lon;
+		int row;
+		int col;
+	};
+
+	static CellIndex cellIndex(double lat, double lon);
+
+	Tile *findTile(int32_t tile_lat, int32_t tile_lon);
+	Tile &allocateTile(int32_t tile_lat, int32_t tile_lon);
+
+	void touch(Tile &tile) { tile.last_used = ++_use_counter; }
+
+	Tile _tiles[NUM_TILES] {};
+	uint32_t _use_counter{0};
+
+	pthread_mutex_t _mutex = PTHREAD_MUTEX_INITIALIZER;
+};
@@ -40,7 +40,15 @@
 
 #include "Timesync.hpp"
 
+#include <lib/mathlib/mathlib.h>
+
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(__PX4_LINUX)
+#include <linux/net_tstamp.h>
+#include <time.h>
+#endif
 
 void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns, const int64_t originate_timestamp_ns)
 {
@@ -87,7 +95,7 @@ void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns,
 				}
 
 				// Perform filter update
-				add_sample(offset_us);
+				add_sample(offset_us, now_us);
 
 				// Increment sequence counter after filter update
 				_sequence++;
@@ -114,6 +122,7 @@ void Timesync::update(const uint64_t now_us, const int64_t remote_timestamp_ns,
 		tsync_status.remote_timestamp = remote_timestamp_ns / 1000ULL;
 		tsync_status.observed_offset = offset_us;
 		tsync_status.estimated_offset = (int64_t)_time_offset;
+		tsync_status.estimated_skew = (float)(_time_skew * 1e6);
 		tsync_status.round_trip_time = rtt_us;
 		tsync_status.timestamp = hrt_absolute_time();
 
@@ -125,18 +134,23 @@ uint64_t Timesync::sync_stamp(uint64_t usec)
 {
 	// Only return synchronised stamp if we have converged to a good value
 	if (sync_converged()) {
-		return usec + (int64_t)_time_offset;
+		// extrapolate the offset with the skew from the last sample to the requested time
+		const double dt = math::constrain((double)(usec + (int64_t)_time_offset) - (double)_time_last_sample,
+						 -(double)MAX_SKEW_EXTRAPOLATION, (double)MAX_SKEW_EXTRAPOLATION);
+		return usec + (int64_t)(_time_offset + _time_skew * dt);
 
 	} else {
 		return hrt_absolute_time();
 	}
 }
 
-void Timesync::add_sample(int64_t offset_us)
+void Timesync::add_sample(int64_t offset_us, uint64_t now_us)
 {
 	// Online exponential smoothing filter. The derivative of the estimate is also
 	// estimated in order to produce an estimate without steady state lag:
 	// https://en.wikipedia.org/wiki/Exponential_smoothing#Double_exponential_smoothing
+	// The derivative is a rate over the local time, so irregular timesync exchanges are
+	// extrapolated correctly.
 	double time_offset_prev = _time_offset;
 
 	if (_sequence == 0) {
@@ -144,12 +158,17 @@ void Timesync::add_sample(int64_t offset_us)
 		_time_offset = offset_us;
 
 	} else {
+		const double dt = (now_us > _time_last_sample) ? (double)(now_us - _time_last_sample) : 1.0;
+
 		// Update the clock offset estimate
-		_time_offset = _filter_alpha * offset_us + (1.0 - _filter_alpha) * (_time_offset + _time_skew);
+		_time_offset = _filter_alpha * offset_us + (1.0 - _filter_alpha) * (_time_offset + _time_skew * dt);
 
 		// Update the clock skew estimate
-		_time_skew = _filter_beta * (_time_offset - time_offset_prev) + (1.0 - _filter_beta) * _time_skew;
+		_time_skew = _filter_beta * (_time_offset - time_offset_prev) / dt + (1.0 - _filter_beta) * _time_skew;
+		_time_skew = math::constrain(_time_skew, -MAX_SKEW, MAX_SKEW);
 	}
+
+	_time_last_sample = now_us;
 }
 
 void Timesync::reset_filter()
@@ -158,8 +177,62 @@ void Timesync::reset_filter()
 	_sequence = 0;
 	_time_offset = 0.0;
 	_time_skew = 0.0;
+	_time_last_sample = 0;
 	_filter_alpha = ALPHA_GAIN_INITIAL;
 	_filter_beta = BETA_GAIN_INITIAL;
 	_high_deviation_count = 0;
 	_high_rtt_count = 0;
 }
+
+#if defined(__PX4_LINUX)
+bool Timesync::enable_rx_timestamping(int fd)
+{
+	const int flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE
+			  | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+
+	return setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0;
+}
+
+uint64_t Timesync::rx_timestamp(const struct msghdr &hdr)
+{
+#if defined(ENABLE_LOCKSTEP_SCHEDULER)
+	// hrt is the simulation time, the kernel timestamps can't be mapped to it
+	(void)hdr;
+	return 0;
+#else
+
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(const_cast<struct msghdr *>(&hdr), cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_TIMESTAMPING) {
+			continue;
+		}
+
+		// struct scm_timestamping: [0] software, [1] deprecated, [2] raw hardware
+		struct timespec stamps[3];
+		memcpy(stamps, CMSG_DATA(cmsg), sizeof(stamps));
+
+		// the kernel timestamps are CLOCK_REALTIME, map them to hrt by their age
+		struct timespec now_rt {};
+		clock_gettime(CLOCK_REALTIME, &now_rt);
+		const uint64_t now_hrt = hrt_absolute_time();
+		const int64_t now_rt_us = (int64_t)now_rt.tv_sec * 1000000 + now_rt.tv_nsec / 1000;
+
+		// prefer the hardware timestamp, if it is in sync with the system clock
+		static constexpr int preferred[] {2, 0};
+
+		for (const int index : preferred) {
+			if (stamps[index].tv_sec == 0 && stamps[index].tv_nsec == 0) {
+				continue;
+			}
+
+			const int64_t age = now_rt_us - ((int64_t)stamps[index].tv_sec * 1000000 + stamps[index].tv_nsec / 1000);
+
+			if (age >= 0 && (uint64_t)age < MAX_RX_TIMESTAMP_AGE && (uint64_t)age < now_hrt) {
+				return now_hrt - age;
+			}
+		}
+	}
+
+	return 0;
+#endif // ENABLE_LOCKSTEP_SCHEDULER
+}
+#endif // __PX4_LINUX
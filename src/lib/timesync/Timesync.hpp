@@ -48,6 +48,10 @@
 #include <math.h>
 #include <float.h>
 
+#if defined(__PX4_LINUX)
+#include <sys/socket.h>
+#endif
+
 using namespace time_literals;
 
 static constexpr time_t PX4_EPOCH_SECS = 1234567890ULL;
@@ -90,6 +94,19 @@ static constexpr uint64_t MAX_DEVIATION_SAMPLE = 100_ms;
 static constexpr uint32_t MAX_CONSECUTIVE_HIGH_RTT = 10;
 static constexpr uint32_t MAX_CONSECUTIVE_HIGH_DEVIATION = 10;
 
+// Clock skew model
+//
+// The skew is estimated as a rate (offset change per local time) so that sync_stamp() can
+// extrapolate the offset between the timesync exchanges. Crystal oscillators stay well within
+// MAX_SKEW, larger estimates are clamped. The extrapolation is limited to MAX_SKEW_EXTRAPOLATION
+// from the last sample in case the exchanges stop.
+static constexpr double MAX_SKEW = 500e-6;
+static constexpr uint64_t MAX_SKEW_EXTRAPOLATION = 10_s;
+
+// Receive timestamps older than this are considered invalid (e.g. a NIC hardware clock
+// that is not synchronised to the system clock) and the caller falls back to its own time.
+static constexpr uint64_t MAX_RX_TIMESTAMP_AGE = 100_ms;
+
 class Timesync
 {
 public:
@@ -106,6 +123,11 @@ public:
 
 	int64_t offset() const { return (int64_t)_time_offset; }
 
+	/**
+	 * Estimated skew of the local clock relative to the remote clock (offset change per local time)
+	 */
+	double skew() const { return _time_skew; }
+
 	/**
 	 * Return true if the timesync algorithm converged to a good estimate,
 	 * return false otherwise
@@ -117,13 +139,38 @@ public:
 	 */
 	void reset_filter();
 
+#if defined(__PX4_LINUX)
+	/**
+	 * Request kernel receive timestamps on a datagram socket, from the NIC if it supports
+	 * hardware timestamping (SO_TIMESTAMPING) and from the network stack otherwise.
+	 * Hardware receive timestamping has to be enabled on the interface (e.g. by ptp4l),
+	 * and the NIC clock synchronised to the system clock (e.g. by phc2sys).
+	 *
+	 * @return true if the socket option was accepted
+	 */
+	static bool enable_rx_timestamping(int fd);
+
+	/**
+	 * Local hrt time (usec) a datagram was received at, from the control messages returned by
+	 * recvmsg()/recvmmsg() on a socket set up with enable_rx_timestamping().
+	 *
+	 * @return the receive time, 0 if there is no usable timestamp
+	 */
+	static uint64_t rx_timestamp(const struct msghdr &hdr);
+
+	/**
+	 * Size of the control buffer to pass to recvmsg() for rx_timestamp()
+	 */
+	static constexpr size_t RX_TIMESTAMP_CONTROL_SIZE = 64;
+#endif
+
 
 private:
 
 	/**
 	 * Online exponential filter to smooth time offset
 	 */
-	void add_sample(int64_t offset_us);
+	void add_sample(int64_t offset_us, uint64_t now_us);
 	uORB::PublicationMulti<timesync_status_s>  _timesync_status_pub{ORB_ID(timesync_status)};
 
 	uint32_t _sequence{0};
@@ -131,6 +178,7 @@ private:
 	// Timesync statistics
 	double _time_offset{0};
 	double _time_skew{0};
+	uint64_t _time_last_sample{0};	///< local time of the last filter update (usec)
 
 	// Filter parameters
 	double _filter_alpha{ALPHA_GAIN_INITIAL};
@@ -59,6 +59,40 @@ read_x(bson_decoder_t decoder, void *p, size_t s)
 {
 	CODER_CHECK(decoder);
 
+	/* bson buffered file decoder */
+	if (decoder->fd > -1 && decoder->buf != nullptr) {
+		uint8_t *dst = (uint8_t *)p;
+
+		while (s > 0) {
+			if (decoder->bufpos >= decoder->buflen) {
+				// refill the buffer from disk
+				int ret = ::read(decoder->fd, decoder->buf, decoder->bufsize);
+
+				if (ret <= 0) {
+					return -1;
+				}
+
+				debug("read buffer (%d) from disk", ret);
+				decoder->buflen = ret;
+				decoder->bufpos = 0;
+			}
+
+			size_t n = decoder->buflen - decoder->bufpos;
+
+			if (n > s) {
+				n = s;
+			}
+
+			memcpy(dst, decoder->buf + decoder->bufpos, n);
+			decoder->bufpos += n;
+			decoder->total_decoded_size += n;
+			dst += n;
+			s -= n;
+		}
+
+		return 0;
+	}
+
 	if (decoder->fd > -1) {
 		int ret = ::read(decoder->fd, p, s);
 
@@ -114,6 +148,52 @@ read_double(bson_decoder_t decoder, double *d)
 	return read_x(decoder, d, sizeof(*d));
 }
 
+static int
+read_name(bson_decoder_t decoder)
+{
+	/* fast path: the terminated name is already in the buffer, copy it at once */
+	if (decoder->buf != nullptr) {
+		const unsigned end = (decoder->fd > -1) ? decoder->buflen : decoder->bufsize;
+
+		if (decoder->bufpos < end) {
+			const size_t available = end - decoder->bufpos;
+			const uint8_t *start = decoder->buf + decoder->bufpos;
+			const uint8_t *nul = (const uint8_t *)memchr(start, '\0', (available < BSON_MAXNAME) ? available : BSON_MAXNAME);
+
+			if (nul != nullptr) {
+				return read_x(decoder, decoder->node.name, nul - start + 1);
+			}
+
+			if (available >= BSON_MAXNAME) {
+				PX4_ERR("node name overflow, type:0x%02x, name:%.32s", decoder->node.type, (const char *)start);
+				CODER_KILL(decoder, "node name overflow");
+			}
+		}
+	}
+
+	/* the name continues past the buffered data */
+	unsigned nlen = 0;
+
+	for (;;) {
+		if (nlen >= BSON_MAXNAME) {
+			PX4_ERR("node name overflow, type:0x%02x, name:%.32s", decoder->node.type, decoder->node.name);
+			CODER_KILL(decoder, "node name overflow");
+		}
+
+		if (read_int8(decoder, (int8_t *)&decoder->node.name[nlen])) {
+			CODER_KILL(decoder, "read error on node name");
+		}
+
+		if (decoder->node.name[nlen] == '\0') {
+			break;
+		}
+
+		nlen++;
+	}
+
+	return 0;
+}
+
 int
 bson_decoder_init_file(bson_decoder_t decoder, int fd, bson_decoder_callback callback)
 {
@@ -133,6 +213,37 @@ bson_decoder_init_file(bson_decoder_t decoder, int fd, bson_decoder_callback cal
 	return 0;
 }
 
+int
+bson_decoder_init_buf_file(bson_decoder_t decoder, int fd, void *buf, unsigned bufsize, bson_decoder_callback callback)
+{
+	/* argument sanity */
+	if ((buf == nullptr) || (bufsize == 0) || (callback == nullptr)) {
+		return -1;
+	}
+
+	decoder->fd = fd;
+	decoder->buf = (uint8_t *)buf;
+	decoder->bufsize = bufsize;
+	decoder->bufpos = 0;
+	decoder->buflen = 0;
+	decoder->dead = false;
+	decoder->callback = callback;
+	decoder->nesting = 1;
+	decoder->pending = 0;
+	decoder->node.type = BSON_UNDEFINED;
+	decoder->total_decoded_size = 0;
+
+	// read document size
+	if (read_int32(decoder, &decoder->total_document_size)) {
+		CODER_KILL(decoder, "failed reading length");
+	}
+
+	debug("total document size = %" PRIi32, decoder->total_document_size);
+
+	/* ready for decoding */
+	return 0;
+}
+
 int
 bson_decoder_init_buf(bson_decoder_t decoder, void *buf, unsigned bufsize, bson_decoder_callback callback)
 {
@@ -181,7 +292,6 @@ int
 bson_decoder_next(bson_decoder_t decoder)
 {
 	int8_t	tbyte;
-	unsigned nlen;
 
 	CODER_CHECK(decoder);
 
@@ -204,11 +314,14 @@ bson_decoder_next(bson_decoder_t decoder)
 
 	/* if there are unread bytes pending in the stream, discard them */
 	while (decoder->pending > 0) {
-		if (read_int8(decoder, &tbyte)) {
+		uint8_t discard[16];
+		const size_t n = (decoder->pending < (int32_t)sizeof(discard)) ? decoder->pending : sizeof(discard);
+
+		if (read_x(decoder, discard, n)) {
 			CODER_KILL(decoder, "read error discarding pending bytes");
 		}
 
-		decoder->pending--;
+		decoder->pending -= n;
 	}
 
 	/* get the type byte */
@@ -232,23 +345,8 @@ bson_decoder_next(bson_decoder_t decoder)
 	} else {
 
 		/* get the node name */
-		nlen = 0;
-
-		for (;;) {
-			if (nlen >= BSON_MAXNAME) {
-				PX4_ERR("node name overflow, type:0x%02x, name:%.32s", decoder->node.type, decoder->node.name);
-				CODER_KILL(decoder, "node name overflow");
-			}
-
-			if (read_int8(decoder, (int8_t *)&decoder->node.name[nlen])) {
-				CODER_KILL(decoder, "read error on node name");
-			}
-
-			if (decoder->node.name[nlen] == '\0') {
-				break;
-			}
-
-			nlen++;
+		if (read_name(decoder)) {
+			return -1;
 		}
 
 		debug("got name '%s'", decoder->node.name);
@@ -374,8 +472,16 @@ write_x(bson_encoder_t encoder, const void *p, size_t s)
 				encoder->bufpos = 0;
 				encoder->total_document_size += ret;
 
-				if ((encoder->bufpos + s) > encoder->bufsize) {
-					CODER_KILL(encoder, "fixed-size buffer overflow");
+				if (s > encoder->bufsize) {
+					// larger than the whole buffer, write it directly
+					ret = ::write(encoder->fd, p, s);
+
+					if (ret != (int)s) {
+						CODER_KILL(encoder, "file write error");
+					}
+
+					encoder->total_document_size += ret;
+					return 0;
 				}
 
 				break;
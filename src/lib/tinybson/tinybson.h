@@ -111,6 +111,7 @@ struct bson_decoder_s {
 	uint8_t			*buf{nullptr};
 	size_t			bufsize{0};
 	unsigned		bufpos{0};
+	unsigned		buflen{0};	///< valid bytes in buf when reading a file through it
 
 	bool			dead{false};
 	bson_decoder_callback	callback;
@@ -139,6 +140,21 @@ struct bson_decoder_s {
  */
 __EXPORT int bson_decoder_init_file(bson_decoder_t decoder, int fd, bson_decoder_callback callback);
 
+/**
+ * Initialise the decoder to read from a file through a buffer.
+ *
+ * The file is read in chunks of the buffer size instead of with one read per field,
+ * the file position is therefore past the end of the document after decoding.
+ * @param decoder		Decoder state structure to be initialised.
+ * @param fd			File to read BSON data from.
+ * @param buf			Buffer pointer to use, can't be nullptr
+ * @param bufsize		Supplied buffer size
+ * @param callback		Callback to be invoked by bson_decoder_next
+ * @return			Zero on success.
+ */
+__EXPORT int bson_decoder_init_buf_file(bson_decoder_t decoder, int fd, void *buf, unsigned bufsize,
+					bson_decoder_callback callback);
+
 /**
  * Initialise the decoder to read from a buffer in memory.
  *
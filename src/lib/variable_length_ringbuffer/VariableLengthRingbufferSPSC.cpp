@@ -0,0 +1,237 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "VariableLengthRingbufferSPSC.hpp"
+
+#include <assert.h>
+#include <string.h>
+
+
+VariableLengthRingbufferSPSC::~VariableLengthRingbufferSPSC()
+{
+	deallocate();
+}
+
+bool VariableLengthRingbufferSPSC::allocate(size_t buffer_size)
+{
+	assert(_buffer == nullptr);
+
+	_size = align(buffer_size);
+	_buffer = new uint8_t[_size];
+
+	if (_buffer == nullptr) {
+		_size = 0;
+		return false;
+	}
+
+	_read.store(0);
+	_write.store(0);
+	_reserved = false;
+	_front = false;
+	return true;
+}
+
+void VariableLengthRingbufferSPSC::deallocate()
+{
+	delete[] _buffer;
+	_buffer = nullptr;
+	_size = 0;
+	_read.store(0);
+	_write.store(0);
+	_reserved = false;
+	_front = false;
+}
+
+uint8_t *VariableLengthRingbufferSPSC::reserve(size_t max_packet_len)
+{
+	_reserved = false;
+
+	if (_buffer == nullptr || max_packet_len == 0 || max_packet_len >= WRAP_MARKER) {
+		return nullptr;
+	}
+
+	const size_t required = record_size(max_packet_len);
+	const size_t write = _write.load();
+	const size_t read = _read.load();
+
+	// The write offset must never catch up with the read offset, as that
+	// would look like an empty buffer. Offsets are always aligned, so there
+	// is at least room for a header (the wrap marker) until the end.
+	if (write >= read) {
+		const size_t space_to_end = _size - write;
+
+		if (required < space_to_end || (required == space_to_end && read > 0)) {
+			_reserved_offset = write;
+			_reserved_wrap = false;
+
+		} else if (required < read) {
+			_reserved_offset = 0;
+			_reserved_wrap = true;
+
+		} else {
+			return nullptr;
+		}
+
+	} else {
+		if (required < read - write) {
+			_reserved_offset = write;
+			_reserved_wrap = false;
+
+		} else {
+			return nullptr;
+		}
+	}
+
+	_reserved_len = max_packet_len;
+	_reserved = true;
+	return _buffer + _reserved_offset + sizeof(Header);
+}
+
+bool VariableLengthRingbufferSPSC::commit(size_t packet_len)
+{
+	if (!_reserved || packet_len == 0 || packet_len > _reserved_len) {
+		return false;
+	}
+
+	_reserved = false;
+
+	const Header header{static_cast<uint32_t>(packet_len)};
+	memcpy(_buffer + _reserved_offset, &header, sizeof(header));
+
+	if (_reserved_wrap) {
+		// the consumer does not look past the write offset, so the marker
+		// only becomes visible together with the packet
+		const Header marker{WRAP_MARKER};
+		memcpy(_buffer + _write.load(), &marker, sizeof(marker));
+	}
+
+	size_t write = _reserved_offset + record_size(packet_len);
+
+	if (write == _size) {
+		write = 0;
+	}
+
+	// publishes the packet (sequentially consistent store)
+	_write.store(write);
+	return true;
+}
+
+bool VariableLengthRingbufferSPSC::push_back(const uint8_t *packet, size_t packet_len)
+{
+	if (packet_len == 0 || packet == nullptr) {
+		// Nothing to add, we better don't try.
+		return false;
+	}
+
+	uint8_t *dest = reserve(packet_len);
+
+	if (dest == nullptr) {
+		return false;
+	}
+
+	memcpy(dest, packet, packet_len);
+	return commit(packet_len);
+}
+
+const uint8_t *VariableLengthRingbufferSPSC::front(size_t &packet_len)
+{
+	packet_len = 0;
+
+	if (_buffer == nullptr) {
+		return nullptr;
+	}
+
+	size_t read = _read.load();
+	const size_t write = _write.load();
+
+	if (read == write) {
+		_front = false;
+		return nullptr;
+	}
+
+	Header header;
+	memcpy(&header, _buffer + read, sizeof(header));
+
+	if (header.len == WRAP_MARKER) {
+		// the producer committed the next packet at the start together with the marker
+		read = 0;
+		memcpy(&header, _buffer + read, sizeof(header));
+	}
+
+	assert(header.len != 0 && record_size(header.len) <= _size);
+
+	_front_offset = read;
+	_front_len = header.len;
+	_front = true;
+
+	packet_len = header.len;
+	return _buffer + read + sizeof(Header);
+}
+
+void VariableLengthRingbufferSPSC::pop()
+{
+	if (!_front) {
+		return;
+	}
+
+	_front = false;
+
+	size_t read = _front_offset + record_size(_front_len);
+
+	if (read == _size) {
+		read = 0;
+	}
+
+	// releases the space to the producer (sequentially consistent store)
+	_read.store(read);
+}
+
+size_t VariableLengthRingbufferSPSC::pop_front(uint8_t *buf, size_t max_buf_len)
+{
+	if (buf == nullptr) {
+		// User needs to supply a valid pointer.
+		return 0;
+	}
+
+	size_t packet_len;
+	const uint8_t *packet = front(packet_len);
+
+	if (packet == nullptr || packet_len > max_buf_len) {
+		return 0;
+	}
+
+	memcpy(buf, packet, packet_len);
+	pop();
+	return packet_len;
+}
@@ -0,0 +1,186 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <px4_platform_common/atomic.h>
+
+
+// Lock-free FIFO ringbuffer for packets of variable length, for exactly
+// one producer thread and one consumer thread.
+//
+// Every packet is stored contiguously (4 byte length header, payload,
+// padding to 4 bytes), so that it can be written and read in place:
+//
+//  producer: reserve() -> fill the returned memory -> commit()
+//  consumer: front()   -> use the returned packet  -> pop()
+//
+// If a packet does not fit at the end of the buffer, the remainder is
+// skipped with a wrap marker and the packet starts at the beginning.
+// The read and write offsets are only ever written by the consumer and
+// producer respectively, so no further locking is required as long as
+// there is only one thread on each side.
+
+class VariableLengthRingbufferSPSC
+{
+public:
+	/* @brief Constructor
+	 *
+	 * @note Does not allocate automatically.
+	 */
+	VariableLengthRingbufferSPSC() = default;
+
+	/*
+	 * @brief Destructor
+	 *
+	 * Automatically calls deallocate.
+	 */
+	~VariableLengthRingbufferSPSC();
+
+	/* @brief Allocate ringbuffer
+	 *
+	 * @note Each packet requires 4 bytes of overhead and is padded to
+	 * a multiple of 4 bytes. The size is rounded up to a multiple of 4.
+	 *
+	 * @note Must not be called concurrently with the other methods.
+	 *
+	 * @param buffer_size Number of bytes to allocate on heap.
+	 *
+	 * @returns false if allocation fails.
+	 */
+	bool allocate(size_t buffer_size);
+
+	/*
+	 * @brief Deallocate ringbuffer
+	 *
+	 * @note Must not be called concurrently with the other methods.
+	 */
+	void deallocate();
+
+	/*
+	 * @brief Reserve contiguous space for the next packet (producer)
+	 *
+	 * The packet only becomes visible to the consumer with commit().
+	 * Calling reserve() again replaces a previous reservation.
+	 *
+	 * @param max_packet_len Maximum length of the packet to be written.
+	 *
+	 * @returns pointer to write the packet to, nullptr if there is not enough space.
+	 */
+	uint8_t *reserve(size_t max_packet_len);
+
+	/*
+	 * @brief Publish the reserved packet (producer)
+	 *
+	 * @param packet_len Actual length, at most the length passed to reserve().
+	 *
+	 * @returns false if there is no reservation or packet_len is invalid.
+	 */
+	bool commit(size_t packet_len);
+
+	/*
+	 * @brief Copy packet into ringbuffer (producer)
+	 *
+	 * @param packet Pointer to packet to copy from.
+	 * @param packet_len Length of packet.
+	 *
+	 * @returns true if packet could be copied into buffer.
+	 */
+	bool push_back(const uint8_t *packet, size_t packet_len);
+
+	/*
+	 * @brief Access the oldest packet in place (consumer)
+	 *
+	 * The memory stays valid until pop() is called.
+	 *
+	 * @param packet_len Set to the length of the packet.
+	 *
+	 * @returns pointer to the packet, nullptr if the buffer is empty.
+	 */
+	const uint8_t *front(size_t &packet_len);
+
+	/*
+	 * @brief Release the packet returned by front() (consumer)
+	 */
+	void pop();
+
+	/*
+	 * @brief Get packet from ringbuffer (consumer)
+	 *
+	 * @param buf Pointer to where next packet can be copied into.
+	 * @param max_buf_len Max size of buf
+	 *
+	 * @returns 0 if packet is bigger than max_buf_len or buffer is empty.
+	 * A packet that is too big stays in the buffer.
+	 */
+	size_t pop_front(uint8_t *buf, size_t max_buf_len);
+
+	/*
+	 * @returns true if there is no packet to read.
+	 */
+	bool empty() const { return _read.load() == _write.load(); }
+
+private:
+	struct Header {
+		uint32_t len;
+	};
+
+	static constexpr uint32_t WRAP_MARKER = UINT32_MAX;
+
+	static constexpr size_t align(size_t len)
+	{
+		return (len + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+	}
+
+	size_t record_size(size_t packet_len) const { return align(sizeof(Header) + packet_len); }
+
+	uint8_t *_buffer{nullptr};
+	size_t _size{0};
+
+	px4::atomic<size_t> _read{0}; ///< written by the consumer only
+	px4::atomic<size_t> _write{0}; ///< written by the producer only
+
+	// producer state of the current reservation
+	size_t _reserved_offset{0};
+	size_t _reserved_len{0};
+	bool _reserved{false};
+	bool _reserved_wrap{false};
+
+	// consumer state of the packet returned by front()
+	size_t _front_offset{0};
+	size_t _front_len{0};
+	bool _front{false};
+};
@@ -0,0 +1,250 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+
+#include "VariableLengthRingbufferSPSC.hpp"
+
+static void paint(uint8_t *buf, size_t len, unsigned offset)
+{
+	for (size_t i = 0; i < len; ++i) {
+		buf[i] = (uint8_t)((i + offset) % UINT8_MAX);
+	}
+}
+
+static bool check(const uint8_t *buf, size_t len, unsigned offset)
+{
+	for (size_t i = 0; i < len; ++i) {
+		if (buf[i] != (uint8_t)((i + offset) % UINT8_MAX)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+TEST(VariableLengthRingbufferSPSC, AllocateAndDeallocate)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(100));
+	buf.deallocate();
+
+	ASSERT_TRUE(buf.allocate(1000));
+	EXPECT_TRUE(buf.empty());
+	// The second time we forget to clean up, but we expect no leak.
+}
+
+TEST(VariableLengthRingbufferSPSC, PushInvalid)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	uint8_t data[200] {};
+	EXPECT_FALSE(buf.push_back(nullptr, 0));
+	EXPECT_FALSE(buf.push_back(data, 0));
+	EXPECT_FALSE(buf.push_back(data, sizeof(data)));
+	EXPECT_FALSE(buf.commit(10));
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(VariableLengthRingbufferSPSC, PushAndPopSeveral)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	uint8_t data[20];
+	paint(data, sizeof(data), 0);
+
+	// 4 should fit (24 bytes each, one record less than full)
+	for (unsigned i = 0; i < 4; ++i) {
+		EXPECT_TRUE(buf.push_back(data, sizeof(data)));
+	}
+
+	EXPECT_FALSE(buf.push_back(data, sizeof(data)));
+
+	for (unsigned i = 0; i < 4; ++i) {
+		uint8_t out[20] {};
+		EXPECT_EQ(buf.pop_front(out, sizeof(out)), sizeof(data));
+		EXPECT_EQ(memcmp(data, out, sizeof(data)), 0);
+	}
+
+	uint8_t out[20];
+	EXPECT_EQ(buf.pop_front(out, sizeof(out)), 0);
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(VariableLengthRingbufferSPSC, PopTooSmallKeepsPacket)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	uint8_t data[30];
+	paint(data, sizeof(data), 3);
+	EXPECT_TRUE(buf.push_back(data, sizeof(data)));
+
+	uint8_t out[30] {};
+	EXPECT_EQ(buf.pop_front(out, 29), 0);
+	EXPECT_EQ(buf.pop_front(nullptr, 30), 0);
+	EXPECT_EQ(buf.pop_front(out, sizeof(out)), sizeof(data));
+	EXPECT_TRUE(check(out, sizeof(out), 3));
+}
+
+TEST(VariableLengthRingbufferSPSC, ReserveAndCommitShorter)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(64));
+
+	// nothing is visible before the commit
+	uint8_t *dest = buf.reserve(40);
+	ASSERT_NE(dest, nullptr);
+	paint(dest, 17, 5);
+	EXPECT_TRUE(buf.empty());
+
+	EXPECT_FALSE(buf.commit(41));
+	EXPECT_TRUE(buf.commit(17));
+	EXPECT_FALSE(buf.commit(17));
+
+	size_t len = 0;
+	const uint8_t *packet = buf.front(len);
+	ASSERT_NE(packet, nullptr);
+	EXPECT_EQ(len, 17);
+	EXPECT_TRUE(check(packet, len, 5));
+
+	// front() without pop() returns the same packet again
+	EXPECT_EQ(buf.front(len), packet);
+	buf.pop();
+	EXPECT_EQ(buf.front(len), nullptr);
+	EXPECT_EQ(len, 0);
+}
+
+TEST(VariableLengthRingbufferSPSC, WrapAround)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(100));
+
+	unsigned pushed = 0;
+	unsigned popped = 0;
+
+	// packets of varying size keep hitting the end of the buffer at different offsets
+	for (unsigned round = 0; round < 1000; ++round) {
+		const size_t len = 1 + (round * 7) % 45;
+		uint8_t data[45];
+		paint(data, len, pushed);
+
+		// when full, drain until the packet fits (a wrapped packet may need more than one)
+		while (!buf.push_back(data, len)) {
+			size_t out_len = 0;
+			const uint8_t *packet = buf.front(out_len);
+			ASSERT_NE(packet, nullptr);
+			EXPECT_TRUE(check(packet, out_len, popped));
+			buf.pop();
+			popped++;
+		}
+
+		pushed++;
+	}
+
+	uint8_t out[45];
+	size_t out_len;
+
+	while ((out_len = buf.pop_front(out, sizeof(out))) > 0) {
+		EXPECT_TRUE(check(out, out_len, popped));
+		popped++;
+	}
+
+	EXPECT_EQ(pushed, popped);
+	EXPECT_TRUE(buf.empty());
+}
+
+static constexpr unsigned THREAD_PACKETS = 100000;
+
+static void *producer_thread(void *arg)
+{
+	VariableLengthRingbufferSPSC *buf = static_cast<VariableLengthRingbufferSPSC *>(arg);
+
+	for (unsigned i = 0; i < THREAD_PACKETS;) {
+		const size_t len = 1 + i % 61;
+		uint8_t *dest = buf->reserve(len);
+
+		if (dest != nullptr) {
+			paint(dest, len, i);
+			buf->commit(len);
+			i++;
+
+		} else {
+			sched_yield();
+		}
+	}
+
+	return nullptr;
+}
+
+TEST(VariableLengthRingbufferSPSC, ProducerConsumerThreads)
+{
+	VariableLengthRingbufferSPSC buf;
+	ASSERT_TRUE(buf.allocate(256));
+
+	pthread_t producer;
+	ASSERT_EQ(pthread_create(&producer, nullptr, producer_thread, &buf), 0);
+
+	unsigned errors = 0;
+
+	for (unsigned i = 0; i < THREAD_PACKETS;) {
+		size_t len = 0;
+		const uint8_t *packet = buf.front(len);
+
+		if (packet != nullptr) {
+			if (len != 1 + i % 61 || !check(packet, len, i)) {
+				errors++;
+			}
+
+			buf.pop();
+			i++;
+
+		} else {
+			sched_yield();
+		}
+	}
+
+	pthread_join(producer, nullptr);
+
+	EXPECT_EQ(errors, 0);
+	EXPECT_TRUE(buf.empty());
+}
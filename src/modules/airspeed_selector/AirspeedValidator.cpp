@@ -50,18 +50,19 @@ AirspeedValidator::update_airspeed_validator(const airspeed_validator_update_dat
 	// get indicated airspeed from input data (raw airspeed)
 	_IAS = input_data.airspeed_indicated_raw;
 
-	update_CAS_scale_validated(input_data.gnss_valid, input_data.ground_velocity, input_data.airspeed_true_raw);
+	update_CAS_scale_validated(input_data.gnss_valid, input_data.ground_speed, input_data.course_over_ground,
+				   input_data.airspeed_true_raw);
 	update_CAS_scale_applied();
 	update_CAS_TAS(input_data.air_pressure_pa, input_data.air_temperature_celsius);
 	update_wind_estimator(input_data.timestamp, input_data.airspeed_true_raw, input_data.gnss_valid,
-			      input_data.ground_velocity, input_data.lpos_evh, input_data.lpos_evv, input_data.q_att);
+			      input_data.ground_velocity, input_data.hor_vel_variance, input_data.q_att);
 	update_in_fixed_wing_flight(input_data.in_fixed_wing_flight);
 	check_airspeed_data_stuck(input_data.timestamp);
 	check_load_factor(input_data.accel_z);
 	check_airspeed_innovation(input_data.timestamp, input_data.vel_test_ratio, input_data.hdg_test_ratio,
 				  input_data.ground_velocity, input_data.gnss_valid);
 	check_first_principle(input_data.timestamp, input_data.fixed_wing_tecs_throttle,
-			      input_data.fixed_wing_tecs_throttle_trim, input_data.tecs_timestamp, input_data.q_att);
+			      input_data.fixed_wing_tecs_throttle_trim, input_data.tecs_timestamp, input_data.pitch);
 	update_airspeed_valid_status(input_data.timestamp);
 }
 
@@ -74,14 +75,13 @@ AirspeedValidator::reset_airspeed_to_invalid(const uint64_t timestamp)
 
 void
 AirspeedValidator::update_wind_estimator(const uint64_t time_now_usec, float airspeed_true_raw, bool gnss_valid,
-		const matrix::Vector3f &vI, float lpos_evh, float lpos_evv, const Quatf &q_att)
+		const matrix::Vector3f &vI, float hor_vel_variance, const Quatf &q_att)
 {
 	_wind_estimator.update(time_now_usec);
 
 	if (gnss_valid && _in_fixed_wing_flight) {
 
 		// airspeed fusion (with raw TAS)
-		const float hor_vel_variance =  lpos_evh * lpos_evh;
 		_wind_estimator.fuse_airspeed(time_now_usec, airspeed_true_raw, vI, hor_vel_variance, q_att);
 
 		// sideslip fusion
@@ -111,7 +111,8 @@ AirspeedValidator::get_wind_estimator_states(uint64_t timestamp)
 }
 
 void
-AirspeedValidator::update_CAS_scale_validated(bool gnss_valid, const matrix::Vector3f &vI, float airspeed_true_raw)
+AirspeedValidator::update_CAS_scale_validated(bool gnss_valid, float ground_speed, float course_over_ground,
+		float airspeed_true_raw)
 {
 	if (!_in_fixed_wing_flight || !gnss_valid) {
 		return;
@@ -122,10 +123,9 @@ AirspeedValidator::update_CAS_scale_validated(bool gnss_valid, const matrix::Vec
 		reset_CAS_scale_check();
 	}
 
-	const float course_over_ground_rad = matrix::wrap_2pi(atan2f(vI(0), vI(1)));
-	const int segment_index = int(SCALE_CHECK_SAMPLES * course_over_ground_rad / (2.f * M_PI_F));
+	const int segment_index = int(SCALE_CHECK_SAMPLES * course_over_ground / (2.f * M_PI_F));
 
-	_scale_check_groundspeed(segment_index) = vI.norm();
+	_scale_check_groundspeed(segment_index) = ground_speed;
 	_scale_check_TAS(segment_index) = airspeed_true_raw;
 
 	// run check if all segments are filled
@@ -281,7 +281,7 @@ AirspeedValidator::check_load_factor(float accel_z)
 
 void
 AirspeedValidator::check_first_principle(const uint64_t timestamp, const float throttle_fw, const float throttle_trim,
-		const uint64_t tecs_timestamp, const Quatf &att_q)
+		const uint64_t tecs_timestamp, const float pitch)
 {
 	if (! _first_principle_check_enabled) {
 		_first_principle_check_failed = false;
@@ -289,7 +289,6 @@ AirspeedValidator::check_first_principle(const uint64_t timestamp, const float t
 		return;
 	}
 
-	const float pitch = matrix::Eulerf(att_q).theta();
 	const hrt_abstime tecs_dt = timestamp - tecs_timestamp; // return if TECS data is old (TECS not running)
 
 	if (!_in_fixed_wing_flight || tecs_dt > 500_ms || !PX4_ISFINITE(_IAS) || !PX4_ISFINITE(throttle_fw)
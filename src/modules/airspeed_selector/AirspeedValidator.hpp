@@ -71,6 +71,12 @@ struct airspeed_validator_update_data {
 	float fixed_wing_tecs_throttle;
 	float fixed_wing_tecs_throttle_trim;
 	uint64_t tecs_timestamp;
+
+	// vehicle terms that are the same for every sensor, computed once per cycle by the caller
+	float hor_vel_variance;		///< lpos_evh squared
+	float ground_speed;		///< norm of ground_velocity
+	float course_over_ground;	///< wrap_2pi(atan2f(ground_velocity(0), ground_velocity(1)))
+	float pitch;			///< pitch of q_att
 };
 
 class AirspeedValidator
@@ -206,9 +212,8 @@ private:
 	void update_in_fixed_wing_flight(bool in_fixed_wing_flight) { _in_fixed_wing_flight = in_fixed_wing_flight; }
 
 	void update_wind_estimator(const uint64_t timestamp, float airspeed_true_raw, bool gnss_valid,
-				   const matrix::Vector3f &vI,
-				   float lpos_evh, float lpos_evv, const Quatf &q_att);
-	void update_CAS_scale_validated(bool gnss_valid, const matrix::Vector3f &vI, float airspeed_true_raw);
+				   const matrix::Vector3f &vI, float hor_vel_variance, const Quatf &q_att);
+	void update_CAS_scale_validated(bool gnss_valid, float ground_speed, float course_over_ground, float airspeed_true_raw);
 	void update_CAS_scale_applied();
 	void update_CAS_TAS(float air_pressure_pa, float air_temperature_celsius);
 	void check_airspeed_data_stuck(uint64_t timestamp);
@@ -216,7 +221,7 @@ private:
 				       float estimator_status_hdg_test_ratio, const matrix::Vector3f &vI, bool gnss_valid);
 	void check_load_factor(float accel_z);
 	void check_first_principle(const uint64_t timestamp, const float throttle, const float throttle_trim,
-				   const uint64_t tecs_timestamp, const Quatf &att_q);
+				   const uint64_t tecs_timestamp, const float pitch);
 	void update_airspeed_valid_status(const uint64_t timestamp);
 	void reset();
 	void reset_CAS_scale_check();
@@ -95,6 +95,9 @@ public:
 	/** @see ModuleBase */
 	static int print_usage(const char *reason = nullptr);
 
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
 private:
 
 	void Run() override;
@@ -160,6 +163,7 @@ private:
 	hrt_abstime _time_last_airspeed_update[MAX_NUM_AIRSPEED_SENSORS] {};
 
 	perf_counter_t _perf_elapsed{};
+	perf_counter_t _perf_validator[MAX_NUM_AIRSPEED_SENSORS] {}; /**< time spent in each airspeed validator */
 
 	float _param_airspeed_scale[MAX_NUM_AIRSPEED_SENSORS] {}; /** array to save the airspeed scale params in */
 
@@ -225,6 +229,9 @@ AirspeedModule::AirspeedModule():
 	update_params();
 
 	_perf_elapsed = perf_alloc(PC_ELAPSED, MODULE_NAME": elapsed");
+	_perf_validator[0] = perf_alloc(PC_ELAPSED, MODULE_NAME": validator 1");
+	_perf_validator[1] = perf_alloc(PC_ELAPSED, MODULE_NAME": validator 2");
+	_perf_validator[2] = perf_alloc(PC_ELAPSED, MODULE_NAME": validator 3");
 	_airspeed_validated_pub.advertise();
 	_wind_est_pub[0].advertise();
 	_wind_est_pub[1].advertise();
@@ -235,6 +242,10 @@ AirspeedModule::~AirspeedModule()
 	ScheduleClear();
 
 	perf_free(_perf_elapsed);
+
+	for (int i = 0; i < MAX_NUM_AIRSPEED_SENSORS; i++) {
+		perf_free(_perf_validator[i]);
+	}
 }
 
 int
@@ -377,6 +388,12 @@ AirspeedModule::Run()
 		input_data.fixed_wing_tecs_throttle = _tecs_status.throttle_sp;
 		input_data.fixed_wing_tecs_throttle_trim = _tecs_status.throttle_trim;
 
+		// terms shared by all validators, so that each additional sensor only adds its own filter and checks
+		input_data.hor_vel_variance = _vehicle_local_position.evh * _vehicle_local_position.evh;
+		input_data.ground_speed = vI.norm();
+		input_data.course_over_ground = matrix::wrap_2pi(atan2f(vI(0), vI(1)));
+		input_data.pitch = matrix::Eulerf(_q_att).theta();
+
 		// iterate through all airspeed sensors, poll new data from them and update their validators
 		for (int i = 0; i < _number_of_airspeed_sensors; i++) {
 
@@ -412,7 +429,9 @@ AirspeedModule::Run()
 				input_data.in_fixed_wing_flight = (in_air_fixed_wing && !_in_takeoff_situation);
 
 				// push input data into airspeed validator
+				perf_begin(_perf_validator[i]);
 				_airspeed_validator[i].update_airspeed_validator(input_data);
+				perf_end(_perf_validator[i]);
 
 				_time_last_airspeed_update[i] = _time_now_usec;
 
@@ -755,6 +774,21 @@ void AirspeedModule::select_airspeed_and_publish()
 
 }
 
+int AirspeedModule::print_status()
+{
+	PX4_INFO_RAW("airspeed sensors: %" PRId32 ", selected index: %d\n", _number_of_airspeed_sensors, _valid_airspeed_index);
+
+	for (int i = 0; i < _number_of_airspeed_sensors; i++) {
+		PX4_INFO_RAW("validator %d: %s, CAS %.2f m/s, scale %.4f\n", i + 1,
+			     _airspeed_validator[i].get_airspeed_valid() ? "valid" : "invalid",
+			     (double)_airspeed_validator[i].get_CAS(), (double)_airspeed_validator[i].get_CAS_scale_validated());
+		perf_print_counter(_perf_validator[i]);
+	}
+
+	perf_print_counter(_perf_elapsed);
+	return 0;
+}
+
 int AirspeedModule::custom_command(int argc, char *argv[])
 {
 	if (!is_running()) {
@@ -57,6 +57,7 @@
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_combined.h>
 #include <uORB/topics/vehicle_attitude.h>
+#include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/sensor_gps.h>
 #include <uORB/topics/vehicle_local_position.h>
 #include <uORB/topics/vehicle_magnetometer.h>
@@ -102,6 +103,8 @@ private:
 
 	void update_sensors();
 
+	void update_vehicle_imu();
+
 	void update_visual_odometry();
 
 	void update_vehicle_attitude();
@@ -120,6 +123,7 @@ private:
 	const float _dt_max = 0.02f;
 
 	uORB::SubscriptionCallbackWorkItem _sensors_sub{this, ORB_ID(sensor_combined)};
+	uORB::SubscriptionCallbackWorkItem _vehicle_imu_sub{this, ORB_ID(vehicle_imu)};
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
@@ -136,6 +140,8 @@ private:
 	Vector3f    _gyro{};
 	Vector3f    _gyro_bias{};
 	Vector3f    _rates{};
+	Vector3f    _delta_angle{};	///< coning corrected delta angle of the last IMU integration period
+	float       _delta_angle_dt{};
 
 	Vector3f    _mag{};
 	Vector3f    _mocap_hdg{};
@@ -156,6 +162,7 @@ private:
 	bool        _data_good{false};
 	bool        _ext_hdg_good{false};
 	bool        _initialized{false};
+	bool        _use_delta_angles{false};	///< propagate with the vehicle_imu batches instead of sensor_combined
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::ATT_W_ACC>)       _param_att_w_acc,
@@ -167,6 +174,7 @@ private:
 		(ParamInt<px4::params::ATT_EXT_HDG_M>)     _param_att_ext_hdg_m,
 		(ParamInt<px4::params::ATT_ACC_COMP>)      _param_att_acc_comp,
 		(ParamFloat<px4::params::ATT_BIAS_MAX>)    _param_att_bias_mas,
+		(ParamInt<px4::params::ATT_IMU_BATCH>)     _param_att_imu_batch,
 		(ParamInt<px4::params::SYS_HAS_MAG>)       _param_sys_has_mag
 	)
 };
@@ -188,7 +196,9 @@ bool AttitudeEstimatorQ::init()
 		return false;
 	}
 
-	if (!_sensors_sub.registerCallback()) {
+	_use_delta_angles = (_param_att_imu_batch.get() == 1);
+
+	if (!(_use_delta_angles ? _vehicle_imu_sub.registerCallback() : _sensors_sub.registerCallback())) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -200,16 +210,24 @@ void AttitudeEstimatorQ::Run()
 {
 	if (should_exit()) {
 		_sensors_sub.unregisterCallback();
+		_vehicle_imu_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
 
-	if (_sensors_sub.updated()) {
+	if (_use_delta_angles ? _vehicle_imu_sub.updated() : _sensors_sub.updated()) {
 		_data_good = true;
 		_ext_hdg_good = false;
 
 		update_parameters();
-		update_sensors();
+
+		if (_use_delta_angles) {
+			update_vehicle_imu();
+
+		} else {
+			update_sensors();
+		}
+
 		update_magnetometer();
 		update_visual_odometry();
 		update_motion_capture_odometry();
@@ -311,12 +329,39 @@ void AttitudeEstimatorQ::update_sensors()
 	}
 }
 
+void AttitudeEstimatorQ::update_vehicle_imu()
+{
+	vehicle_imu_s imu;
+
+	if (_vehicle_imu_sub.update(&imu) && (imu.delta_angle_dt > 0) && (imu.delta_velocity_dt > 0)) {
+		// vehicle_imu integrates the gyro FIFO samples with coning correction,
+		// the filter only runs once per integration period
+		_imu_timestamp = imu.timestamp_sample;
+		_delta_angle = Vector3f(imu.delta_angle);
+		_delta_angle_dt = imu.delta_angle_dt * 1e-6f;
+		_gyro = _delta_angle / _delta_angle_dt;
+
+		_accel = Vector3f(imu.delta_velocity) / (imu.delta_velocity_dt * 1e-6f);
+
+		if (_accel.length() < 0.01f) {
+			PX4_ERR("degenerate accel!");
+			return;
+		}
+	}
+}
+
 void AttitudeEstimatorQ::update_vehicle_attitude()
 {
-	// time from previous iteration
-	hrt_abstime now = hrt_absolute_time();
-	const float dt = math::constrain((now - _imu_prev_timestamp) / 1e6f, _dt_min, _dt_max);
-	_imu_prev_timestamp = now;
+	float dt = _delta_angle_dt;
+
+	if (!_use_delta_angles) {
+		// time from previous iteration
+		hrt_abstime now = hrt_absolute_time();
+		dt = (now - _imu_prev_timestamp) / 1e6f;
+		_imu_prev_timestamp = now;
+	}
+
+	dt = math::constrain(dt, _dt_min, _dt_max);
 
 	if (update(dt)) {
 		vehicle_attitude_s vehicle_attitude{};
@@ -550,14 +595,36 @@ bool AttitudeEstimatorQ::update(float dt)
 
 	_rates = _gyro + _gyro_bias;
 
-	// Feed forward gyro
-	corr += _rates;
+	if (_use_delta_angles) {
+		// Rotation over the integration period, the delta angle replaces the gyro feed forward
+		const Vector3f rotation = _delta_angle + (corr + _gyro_bias) * dt;
 
-	// Apply correction to state
-	_q += _q.derivative1(corr) * dt;
+		// Second order quaternion increment, no trigonometric functions
+		const float rotation_norm_sq = rotation.norm_squared();
+		const Vector3f half_rotation = 0.5f * rotation;
+		_q = _q * Quatf(1.f - 0.125f * rotation_norm_sq, half_rotation(0), half_rotation(1), half_rotation(2));
 
-	// Normalize quaternion
-	_q.normalize();
+		// The increment keeps the norm within 1e-6 of 1 for typical rotations, a single
+		// Newton step renormalizes without square root and division
+		const float q_norm_sq = _q.norm_squared();
+
+		if (fabsf(q_norm_sq - 1.f) < 0.01f) {
+			_q *= 1.5f - 0.5f * q_norm_sq;
+
+		} else {
+			_q.normalize();
+		}
+
+	} else {
+		// Feed forward gyro
+		corr += _rates;
+
+		// Apply correction to state
+		_q += _q.derivative1(corr) * dt;
+
+		// Normalize quaternion
+		_q.normalize();
+	}
 
 	if (!_q.isAllFinite()) {
 		// Reset quaternion to last good state
@@ -144,3 +144,17 @@ PARAM_DEFINE_INT32(ATT_ACC_COMP, 0);
  * @decimal 3
  */
 PARAM_DEFINE_FLOAT(ATT_BIAS_MAX, 0.05f);
+
+/**
+ * Batched IMU integration
+ *
+ * Propagate the attitude with the coning corrected delta angles of vehicle_imu
+ * (instance 0), integrated from the gyro FIFO data, instead of every
+ * sensor_combined sample. The filter then runs once per IMU integration period
+ * (IMU_INTEG_RATE), which reduces the CPU load and the integration error.
+ *
+ * @group Attitude Q estimator
+ * @boolean
+ * @reboot_required true
+ */
+PARAM_DEFINE_INT32(ATT_IMU_BATCH, 0);
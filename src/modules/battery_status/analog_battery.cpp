@@ -50,7 +50,8 @@ static constexpr int DEFAULT_I_CHANNEL[1] = {-1};
 
 AnalogBattery::AnalogBattery(int index, ModuleParams *parent, const int sample_interval_us, const uint8_t source,
 			     const uint8_t priority) :
-	Battery(index, parent, sample_interval_us, source)
+	Battery(index, parent, sample_interval_us, source),
+	_sample_interval_us(sample_interval_us)
 {
 	Battery::setPriority(priority);
 	char param_name[17];
@@ -90,10 +91,14 @@ AnalogBattery::updateBatteryStatusADC(hrt_abstime timestamp, float voltage_raw,
 		}
 	}
 
+	// the capacity is integrated at the ADC rate, the estimation runs at the sample interval it is tuned for
 	Battery::setConnected(connected);
 	Battery::updateVoltage(voltage_v);
-	Battery::updateCurrent(current_a);
-	Battery::updateAndPublishBatteryStatus(timestamp);
+	Battery::integrateCurrent(timestamp, current_a);
+
+	if (timestamp >= lastStatusUpdate() + _sample_interval_us * 3 / 4) {
+		Battery::updateAndPublishBatteryStatus(timestamp);
+	}
 }
 
 bool AnalogBattery::is_valid()
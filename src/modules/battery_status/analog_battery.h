@@ -44,11 +44,11 @@ public:
 		      const uint8_t priority);
 
 	/**
-	 * Update current battery status message.
+	 * Integrate an ADC sample and update the battery status message once per sample interval.
 	 *
 	 * @param voltage_raw Battery voltage read from ADC, volts
 	 * @param current_raw Voltage of current sense resistor, volts
-	 * @param timestamp Time at which the ADC was read (use hrt_absolute_time())
+	 * @param timestamp Time at which the ADC was read
 	 * @param source The source as defined by param BAT%d_SOURCE
 	 * @param priority: The brick number -1. The term priority refers to the Vn connection on the LTC4417
 	 */
@@ -93,6 +93,8 @@ protected:
 	virtual void updateParams() override;
 
 private:
+	const hrt_abstime _sample_interval_us;
+
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 	uint8_t _arming_state{0};
 
@@ -174,16 +174,17 @@ BatteryStatus::adc_poll()
 	* Like in the FMUv4
 	*/
 
-	/* Per Brick readings with default unread channels at 0 */
-	float bat_current_adc_readings[BOARD_NUMBER_BRICKS] {};
-	float bat_voltage_adc_readings[BOARD_NUMBER_BRICKS] {};
-	bool has_bat_voltage_adc_channel[BOARD_NUMBER_BRICKS] {};
-
 	int selected_source = -1;
 
 	adc_report_s adc_report;
 
-	if (_adc_report_sub.update(&adc_report)) {
+	// all queued reports, so that current between two runs is integrated as well
+	while (_adc_report_sub.update(&adc_report)) {
+
+		/* Per Brick readings with default unread channels at 0 */
+		float bat_current_adc_readings[BOARD_NUMBER_BRICKS] {};
+		float bat_voltage_adc_readings[BOARD_NUMBER_BRICKS] {};
+		bool has_bat_voltage_adc_channel[BOARD_NUMBER_BRICKS] {};
 
 		/* Read add channels we got */
 		for (unsigned i = 0; i < PX4_MAX_ADC_CHANNELS; ++i) {
@@ -224,7 +225,7 @@ BatteryStatus::adc_poll()
 
 			if (has_bat_voltage_adc_channel[b]) { // Do not publish if no voltage channel configured
 				_analogBatteries[b]->updateBatteryStatusADC(
-					hrt_absolute_time(),
+					adc_report.timestamp,
 					bat_voltage_adc_readings[b],
 					bat_current_adc_readings[b]
 				);
@@ -49,7 +49,7 @@ CameraFeedback::CameraFeedback() :
 bool
 CameraFeedback::init()
 {
-	if (!_trigger_sub.registerCallback()) {
+	if (!_trigger_sub.registerCallback() || !_att_sub.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -64,24 +64,20 @@ CameraFeedback::Run()
 {
 	if (should_exit()) {
 		_trigger_sub.unregisterCallback();
+		_att_sub.unregisterCallback();
 		exit_and_cleanup();
 		return;
 	}
 
+	update_pose_history();
+
 	camera_trigger_s trig{};
 
 	while (_trigger_sub.update(&trig)) {
 
-		// update geotagging subscriptions
-		vehicle_global_position_s gpos{};
-		_gpos_sub.copy(&gpos);
-
-		vehicle_attitude_s att{};
-		_att_sub.copy(&att);
-
 		if (trig.timestamp == 0 ||
-		    gpos.timestamp == 0 ||
-		    att.timestamp == 0) {
+		    _position_history.empty() ||
+		    _attitude_history.empty()) {
 
 			// reject until we have valid data
 			continue;
@@ -92,65 +88,200 @@ CameraFeedback::Run()
 			continue;
 		}
 
-		camera_capture_s capture{};
+		if (_num_pending_triggers == MAX_PENDING_TRIGGERS) {
+			// make room, the oldest one gets the best pose available now
+			publish_capture(_pending_triggers[0]);
+			memmove(&_pending_triggers[0], &_pending_triggers[1], sizeof(_pending_triggers[0]) * (MAX_PENDING_TRIGGERS - 1));
+			_num_pending_triggers--;
+		}
 
-		// Fill timestamps
-		capture.timestamp = trig.timestamp;
-		capture.timestamp_utc = trig.timestamp_utc;
+		_pending_triggers[_num_pending_triggers++] = trig;
+	}
 
-		// Fill image sequence
-		capture.seq = trig.seq;
+	// a capture is published once the pose after its timestamp is known
+	const hrt_abstime now = hrt_absolute_time();
+	int num_published = 0;
 
-		// Fill position data
-		capture.lat = gpos.lat;
-		capture.lon = gpos.lon;
-		capture.alt = gpos.alt;
+	for (int i = 0; i < _num_pending_triggers; i++) {
+		const camera_trigger_s &pending = _pending_triggers[i];
 
-		if (gpos.terrain_alt_valid) {
-			capture.ground_distance = gpos.alt - gpos.terrain_alt;
+		const bool pose_available = (_position_history.newest_timestamp() >= pending.timestamp)
+					    && (_attitude_history.newest_timestamp() >= pending.timestamp);
 
-		} else {
-			capture.ground_distance = -1.0f;
+		if (!pose_available && (now < pending.timestamp + MAX_TRIGGER_DELAY)) {
+			// keep the order of the captures
+			break;
 		}
 
-		// Fill attitude data
-		gimbal_device_attitude_status_s gimbal{};
-
-		if (_gimbal_sub.copy(&gimbal) && (hrt_elapsed_time(&gimbal.timestamp) < 1_s)) {
-			if (gimbal.device_flags & gimbal_device_attitude_status_s::DEVICE_FLAGS_YAW_LOCK) {
-				// Gimbal yaw angle is absolute angle relative to North
-				capture.q[0] = gimbal.q[0];
-				capture.q[1] = gimbal.q[1];
-				capture.q[2] = gimbal.q[2];
-				capture.q[3] = gimbal.q[3];
-
-			} else {
-				// Gimbal quaternion frame is in the Earth frame rotated so that the x-axis is pointing
-				// forward (yaw relative to vehicle). Get heading from the vehicle attitude and combine it
-				// with the gimbal orientation.
-				const matrix::Eulerf euler_vehicle(matrix::Quatf(att.q));
-				const matrix::Quatf q_heading(matrix::Eulerf(0.0f, 0.0f, euler_vehicle(2)));
-				matrix::Quatf q_gimbal(gimbal.q);
-				q_gimbal = q_heading * q_gimbal;
-
-				capture.q[0] = q_gimbal(0);
-				capture.q[1] = q_gimbal(1);
-				capture.q[2] = q_gimbal(2);
-				capture.q[3] = q_gimbal(3);
-			}
+		publish_capture(pending);
+		num_published++;
+	}
+
+	if (num_published > 0) {
+		_num_pending_triggers -= num_published;
+		memmove(&_pending_triggers[0], &_pending_triggers[num_published], sizeof(_pending_triggers[0]) * _num_pending_triggers);
+	}
+}
+
+void
+CameraFeedback::update_pose_history()
+{
+	vehicle_attitude_s att;
+
+	if (_att_sub.update(&att)) {
+		const hrt_abstime timestamp = (att.timestamp_sample != 0) ? att.timestamp_sample : att.timestamp;
+		_attitude_history.push(timestamp, matrix::Quatf(att.q));
+	}
+
+	vehicle_global_position_s gpos;
+
+	if (_gpos_sub.update(&gpos)) {
+		const hrt_abstime timestamp = (gpos.timestamp_sample != 0) ? gpos.timestamp_sample : gpos.timestamp;
+		_position_history.push(timestamp, PositionSample{gpos.lat, gpos.lon, gpos.alt, gpos.terrain_alt, gpos.terrain_alt_valid});
+	}
+}
+
+static float interpolation_factor(hrt_abstime t, hrt_abstime t0, hrt_abstime t1)
+{
+	if (t1 <= t0 || t <= t0) {
+		return 0.f;
+	}
+
+	return math::min((float)(t - t0) / (float)(t1 - t0), 1.f);
+}
+
+bool
+CameraFeedback::interpolate_position(hrt_abstime t, PositionSample &pos) const
+{
+	int before;
+	int after;
+
+	if (!_position_history.find(t, before, after)) {
+		return false;
+	}
+
+	const hrt_abstime t0 = _position_history.timestamp(before);
+	const hrt_abstime t1 = _position_history.timestamp(after);
+	const PositionSample &p0 = _position_history.data(before);
+	const PositionSample &p1 = _position_history.data(after);
+
+	if (t1 - t0 > MAX_SAMPLE_INTERVAL) {
+		pos = ((t - t0) < (t1 - t)) ? p0 : p1;
+		return true;
+	}
+
+	const double k = interpolation_factor(t, t0, t1);
+
+	pos.lat = p0.lat + k * (p1.lat - p0.lat);
+	pos.lon = matrix::wrap(p0.lon + k * matrix::wrap(p1.lon - p0.lon, -180., 180.), -180., 180.);
+	pos.alt = p0.alt + (float)k * (p1.alt - p0.alt);
+	pos.terrain_alt_valid = p0.terrain_alt_valid && p1.terrain_alt_valid;
+	pos.terrain_alt = p0.terrain_alt + (float)k * (p1.terrain_alt - p0.terrain_alt);
+
+	return true;
+}
+
+bool
+CameraFeedback::interpolate_attitude(hrt_abstime t, matrix::Quatf &q) const
+{
+	int before;
+	int after;
+
+	if (!_attitude_history.find(t, before, after)) {
+		return false;
+	}
+
+	const hrt_abstime t0 = _attitude_history.timestamp(before);
+	const hrt_abstime t1 = _attitude_history.timestamp(after);
+	const matrix::Quatf &q0 = _attitude_history.data(before);
+	matrix::Quatf q1 = _attitude_history.data(after);
+
+	if (t1 - t0 > MAX_SAMPLE_INTERVAL) {
+		q = ((t - t0) < (t1 - t)) ? q0 : q1;
+		return true;
+	}
+
+	// normalized linear interpolation, accurate for the small rotation between two samples
+	if (q0.dot(q1) < 0.f) {
+		q1 = -q1;
+	}
+
+	const float k = interpolation_factor(t, t0, t1);
+
+	for (int i = 0; i < 4; i++) {
+		q(i) = q0(i) + k * (q1(i) - q0(i));
+	}
+
+	q.normalize();
+
+	return true;
+}
+
+void
+CameraFeedback::publish_capture(const camera_trigger_s &trig)
+{
+	PositionSample pos;
+	matrix::Quatf q_vehicle;
+
+	if (!interpolate_position(trig.timestamp, pos) || !interpolate_attitude(trig.timestamp, q_vehicle)) {
+		return;
+	}
+
+	camera_capture_s capture{};
+
+	// Fill timestamps
+	capture.timestamp = trig.timestamp;
+	capture.timestamp_utc = trig.timestamp_utc;
+
+	// Fill image sequence
+	capture.seq = trig.seq;
+
+	// Fill position data, interpolated at the capture time
+	capture.lat = pos.lat;
+	capture.lon = pos.lon;
+	capture.alt = pos.alt;
+
+	if (pos.terrain_alt_valid) {
+		capture.ground_distance = pos.alt - pos.terrain_alt;
+
+	} else {
+		capture.ground_distance = -1.0f;
+	}
+
+	// Fill attitude data
+	gimbal_device_attitude_status_s gimbal{};
+
+	if (_gimbal_sub.copy(&gimbal) && (hrt_elapsed_time(&gimbal.timestamp) < 1_s)) {
+		if (gimbal.device_flags & gimbal_device_attitude_status_s::DEVICE_FLAGS_YAW_LOCK) {
+			// Gimbal yaw angle is absolute angle relative to North
+			capture.q[0] = gimbal.q[0];
+			capture.q[1] = gimbal.q[1];
+			capture.q[2] = gimbal.q[2];
+			capture.q[3] = gimbal.q[3];
 
 		} else {
-			// No gimbal orientation, use vehicle attitude
-			capture.q[0] = att.q[0];
-			capture.q[1] = att.q[1];
-			capture.q[2] = att.q[2];
-			capture.q[3] = att.q[3];
+			// Gimbal quaternion frame is in the Earth frame rotated so that the x-axis is pointing
+			// forward (yaw relative to vehicle). Get heading from the vehicle attitude and combine it
+			// with the gimbal orientation.
+			const matrix::Eulerf euler_vehicle(q_vehicle);
+			const matrix::Quatf q_heading(matrix::Eulerf(0.0f, 0.0f, euler_vehicle(2)));
+			matrix::Quatf q_gimbal(gimbal.q);
+			q_gimbal = q_heading * q_gimbal;
+
+			capture.q[0] = q_gimbal(0);
+			capture.q[1] = q_gimbal(1);
+			capture.q[2] = q_gimbal(2);
+			capture.q[3] = q_gimbal(3);
 		}
 
-		capture.result = 1;
-
-		_capture_pub.publish(capture);
+	} else {
+		// No gimbal orientation, use vehicle attitude
+		q_vehicle.copyTo(capture.q);
 	}
+
+	capture.result = 1;
+
+	_capture_pub.publish(capture);
 }
 
 int
@@ -214,6 +345,10 @@ It discards topics from the `camera_trigger` module if camera capture is enabled
 For the topics that are not discarded it creates a `CameraCapture` topic with the timestamp information
 from the `CameraTrigger` and position information from the vehicle.
 
+The module keeps a short history of the estimated global position and attitude, and interpolates
+both at the capture timestamp. A capture is published once the estimator output after the capture
+time is available.
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("camera_feedback", "system");
@@ -57,6 +57,10 @@
 #include <uORB/topics/vehicle_global_position.h>
 #include <uORB/topics/gimbal_device_attitude_status.h>
 
+#include "SampleHistory.hpp"
+
+using namespace time_literals;
+
 class CameraFeedback : public ModuleBase<CameraFeedback>, public ModuleParams, public px4::WorkItem
 {
 public:
@@ -76,16 +80,48 @@ public:
 
 private:
 
+	// covers about 0.2 s of attitude at the usual estimator output rate
+	static constexpr int HISTORY_LENGTH = 50;
+	static constexpr int MAX_PENDING_TRIGGERS = 4;
+
+	// interpolate only between samples that are closer than this, otherwise take the nearest
+	static constexpr hrt_abstime MAX_SAMPLE_INTERVAL = 100_ms;
+
+	// publish with the newest pose if the samples after the capture do not arrive in time
+	static constexpr hrt_abstime MAX_TRIGGER_DELAY = 200_ms;
+
+	struct PositionSample {
+		double lat;
+		double lon;
+		float alt;
+		float terrain_alt;
+		bool terrain_alt_valid;
+	};
+
 	void Run() override;
 
+	void update_pose_history();
+	void publish_capture(const camera_trigger_s &trig);
+
+	bool interpolate_position(hrt_abstime t, PositionSample &pos) const;
+	bool interpolate_attitude(hrt_abstime t, matrix::Quatf &q) const;
+
 	uORB::SubscriptionCallbackWorkItem _trigger_sub{this, ORB_ID(camera_trigger)};
 
+	// the pose history is updated at the rate of the estimator output
+	uORB::SubscriptionCallbackWorkItem _att_sub{this, ORB_ID(vehicle_attitude)};
+
 	uORB::Subscription	_gpos_sub{ORB_ID(vehicle_global_position)};
-	uORB::Subscription	_att_sub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription	_gimbal_sub{ORB_ID(gimbal_device_attitude_status)};
 
 	uORB::Publication<camera_capture_s>	_capture_pub{ORB_ID(camera_capture)};
 
 	param_t _p_cam_cap_fback;
 	int32_t _cam_cap_fback{0};
+
+	SampleHistory<PositionSample, HISTORY_LENGTH> _position_history{};
+	SampleHistory<matrix::Quatf, HISTORY_LENGTH> _attitude_history{};
+
+	camera_trigger_s _pending_triggers[MAX_PENDING_TRIGGERS] {};
+	int _num_pending_triggers{0};
 };
@@ -0,0 +1,111 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file SampleHistory.hpp
+ *
+ * Fixed size history of timestamped samples, used to look up the
+ * vehicle pose around the capture time of an image.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+
+template<typename T, int N>
+class SampleHistory
+{
+public:
+	static_assert(N > 1, "history needs at least two samples");
+
+	// samples are expected in increasing time order, older ones are dropped
+	void push(hrt_abstime timestamp, const T &data)
+	{
+		if (_count > 0 && timestamp <= newest_timestamp()) {
+			return;
+		}
+
+		_timestamp[_head] = timestamp;
+		_data[_head] = data;
+		_head = (_head + 1) % N;
+
+		if (_count < N) {
+			_count++;
+		}
+	}
+
+	bool empty() const { return _count == 0; }
+
+	hrt_abstime newest_timestamp() const { return _timestamp[index(_count - 1)]; }
+
+	/**
+	 * Find the samples enclosing t. If t is outside the history both
+	 * point to the newest or the oldest sample.
+	 *
+	 * @return false if the history is empty
+	 */
+	bool find(hrt_abstime t, int &before, int &after) const
+	{
+		if (_count == 0) {
+			return false;
+		}
+
+		before = after = index(_count - 1);
+
+		for (int i = _count - 1; i >= 0; i--) {
+			before = index(i);
+
+			if (_timestamp[before] <= t) {
+				return true;
+			}
+
+			after = before;
+		}
+
+		// older than the oldest sample
+		return true;
+	}
+
+	hrt_abstime timestamp(int i) const { return _timestamp[i]; }
+	const T &data(int i) const { return _data[i]; }
+
+private:
+	// i-th sample from the oldest one
+	int index(int i) const { return (_head - _count + i + N) % N; }
+
+	hrt_abstime _timestamp[N] {};
+	T _data[N] {};
+	int _head{0};
+	int _count{0};
+};
@@ -490,6 +490,7 @@ int Commander::print_status()
 	_mode_management.printStatus();
 	perf_print_counter(_loop_perf);
 	perf_print_counter(_preflight_check_perf);
+	perf_print_counter(_trigger_latency_perf);
 	return 0;
 }
 
@@ -724,6 +725,49 @@ Commander::~Commander()
 {
 	perf_free(_loop_perf);
 	perf_free(_preflight_check_perf);
+	perf_free(_trigger_latency_perf);
+}
+
+Commander::MainLoopWakeup::MainLoopWakeup()
+{
+	px4_sem_init(&_sem, 0, 0);
+	px4_sem_setprotocol(&_sem, SEM_PRIO_NONE);
+}
+
+Commander::MainLoopWakeup::~MainLoopWakeup()
+{
+	unregisterCallbacks();
+	px4_sem_destroy(&_sem);
+}
+
+void Commander::MainLoopWakeup::call()
+{
+	hrt_abstime expected = 0;
+	_trigger_time.compare_exchange(&expected, hrt_absolute_time());
+
+	if (!_wakeup_pending.load()) {
+		_wakeup_pending.store(true);
+		px4_sem_post(&_sem);
+	}
+}
+
+void Commander::MainLoopWakeup::wait(hrt_abstime timeout_us)
+{
+	struct timespec ts;
+#if defined(__PX4_NUTTX)
+	px4_clock_gettime(CLOCK_REALTIME, &ts);
+#else
+	// lockstep aware, see px4_poll()
+	px4_clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+
+	const unsigned billion = (1000 * 1000 * 1000);
+	uint64_t nsecs = ts.tv_nsec + timeout_us * 1000;
+	ts.tv_sec += nsecs / billion;
+	ts.tv_nsec = nsecs % billion;
+
+	px4_sem_timedwait(&_sem, &ts);
+	_wakeup_pending.store(false);
 }
 
 bool
@@ -1500,6 +1544,7 @@ Commander::handle_command(const vehicle_command_s &cmd)
 	case vehicle_command_s::VEHICLE_CMD_DO_GO_AROUND:
 	case vehicle_command_s::VEHICLE_CMD_LOGGING_START:
 	case vehicle_command_s::VEHICLE_CMD_LOGGING_STOP:
+	case vehicle_command_s::VEHICLE_CMD_LOGGING_PRE_TRIGGER:
 	case vehicle_command_s::VEHICLE_CMD_NAV_DELAY:
 	case vehicle_command_s::VEHICLE_CMD_DO_SET_ROI:
 	case vehicle_command_s::VEHICLE_CMD_NAV_ROI:
@@ -1779,10 +1824,17 @@ void Commander::run()
 
 	arm_auth_init(&_mavlink_log_pub, &_vehicle_status.system_id);
 
+	if (!_main_loop_wakeup.registerCallbacks()) {
+		PX4_WARN("main loop wakeup callbacks not registered");
+	}
+
 	while (!should_exit()) {
 
 		perf_begin(_loop_perf);
 
+		// measures the reaction to commands and land detector changes
+		const hrt_abstime trigger_time = _main_loop_wakeup.takeTriggerTime();
+
 		const actuator_armed_s actuator_armed_prev{_actuator_armed};
 
 		/* update parameters */
@@ -1925,6 +1977,10 @@ void Commander::run()
 			_vehicle_status.timestamp = hrt_absolute_time();
 			_vehicle_status_pub.publish(_vehicle_status);
 
+			if ((trigger_time != 0) && (_status_changed || nav_state_or_failsafe_changed)) {
+				perf_set_elapsed(_trigger_latency_perf, _vehicle_status.timestamp - trigger_time);
+			}
+
 			// failure_detector_status publish
 			failure_detector_status_s fd_status{};
 			fd_status.fd_roll = _failure_detector.getStatusFlags().roll;
@@ -1954,9 +2010,9 @@ void Commander::run()
 
 		perf_end(_loop_perf);
 
-		// sleep if there are no vehicle_commands or action_requests to process
+		// sleep if there are no vehicle_commands or action_requests to process, they wake up the loop early
 		if (!_vehicle_command_sub.updated() && !_action_request_sub.updated()) {
-			px4_usleep(COMMANDER_MONITORING_INTERVAL);
+			_main_loop_wakeup.wait(COMMANDER_MONITORING_INTERVAL);
 		}
 	}
 
@@ -48,8 +48,10 @@
 #include <lib/hysteresis/hysteresis.h>
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
+#include <px4_platform_common/sem.h>
 
 // publications
 #include <uORB/Publication.hpp>
@@ -62,6 +64,7 @@
 
 // subscriptions
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallbackSet.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
 #include <uORB/topics/action_request.h>
@@ -303,6 +306,40 @@ private:
 
 	uORB::SubscriptionInterval				_parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
+	/**
+	 * Wakes up the main loop on publication of the topics that need an immediate reaction,
+	 * instead of waiting for the rest of the monitoring interval.
+	 */
+	class MainLoopWakeup : public uORB::SubscriptionCallbackSet
+	{
+	public:
+		MainLoopWakeup();
+		~MainLoopWakeup() override;
+
+		void call() override;
+
+		/**
+		 * Sleep until woken up or the timeout elapsed.
+		 */
+		void wait(hrt_abstime timeout_us);
+
+		/**
+		 * Time of the first trigger since the last call, 0 if none.
+		 */
+		hrt_abstime takeTriggerTime() { return _trigger_time.fetch_and(0); }
+
+	private:
+		px4_sem_t _sem;
+		px4::atomic_bool _wakeup_pending{false};
+		px4::atomic<hrt_abstime> _trigger_time{0};
+	};
+
+	MainLoopWakeup						_main_loop_wakeup{};
+	uORB::SubscriptionCallbackSetMember			_wakeup_action_request_sub{&_main_loop_wakeup, ORB_ID(action_request), false};
+	uORB::SubscriptionCallbackSetMember			_wakeup_vehicle_command_sub{&_main_loop_wakeup, ORB_ID(vehicle_command), false};
+	uORB::SubscriptionCallbackSetMember			_wakeup_vehicle_command_mode_executor_sub{&_main_loop_wakeup, ORB_ID(vehicle_command_mode_executor), false};
+	uORB::SubscriptionCallbackSetMember			_wakeup_vehicle_land_detected_sub{&_main_loop_wakeup, ORB_ID(vehicle_land_detected), false};
+
 	uORB::SubscriptionMultiArray<telemetry_status_s>	_telemetry_status_subs{ORB_ID::telemetry_status};
 
 #if defined(BOARD_HAS_POWER_CONTROL)
@@ -325,6 +362,7 @@ private:
 
 	perf_counter_t _loop_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 	perf_counter_t _preflight_check_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": preflight check")};
+	perf_counter_t _trigger_latency_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": trigger to status")};
 
 	// optional parameters
 	param_t _param_mav_type{PARAM_INVALID};
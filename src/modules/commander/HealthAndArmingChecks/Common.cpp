@@ -111,6 +111,61 @@ bool Report::addExternalEvent(const event_s &event, NavModes modes)
 
 
 
+void Report::runAndRecord(HealthAndArmingCheckBase &check, const Context &context, Fragment &fragment)
+{
+	Results &current = _results[_current_result];
+	const Results accumulated = current;
+	const int events_start = _next_buffer_idx;
+
+	// start from empty results, so the fragment only contains what this check reported
+	current.reset();
+	check.checkAndReport(context, *this);
+	fragment.results = current;
+
+	const unsigned events_size = _next_buffer_idx - events_start;
+	fragment.valid = !_buffer_overflowed && events_size <= sizeof(fragment.events);
+
+	if (fragment.valid) {
+		memcpy(fragment.events, _event_buffer + events_start, events_size);
+		fragment.events_size = events_size;
+	}
+
+	current = accumulated;
+	merge(current, fragment.results, true);
+}
+
+void Report::applyFragment(const Fragment &fragment)
+{
+	// same as addEvent(): if the events do not fit, the results are still merged
+	const bool events_fit = fragment.events_size <= sizeof(_event_buffer) - _next_buffer_idx;
+
+	if (events_fit) {
+		memcpy(_event_buffer + _next_buffer_idx, fragment.events, fragment.events_size);
+		_next_buffer_idx += fragment.events_size;
+
+	} else {
+		_buffer_overflowed = true;
+	}
+
+	merge(_results[_current_result], fragment.results, events_fit);
+}
+
+void Report::merge(Results &results, const Results &other, bool with_events)
+{
+	results.health.is_present = results.health.is_present | other.health.is_present;
+	results.health.error = results.health.error | other.health.error;
+	results.health.warning = results.health.warning | other.health.warning;
+	results.arming_checks.error = results.arming_checks.error | other.arming_checks.error;
+	results.arming_checks.warning = results.arming_checks.warning | other.arming_checks.warning;
+	results.arming_checks.can_arm = results.arming_checks.can_arm & other.arming_checks.can_arm;
+	results.arming_checks.can_run = results.arming_checks.can_run & other.arming_checks.can_run;
+
+	if (with_events) {
+		results.num_events += other.num_events;
+		results.event_id_hash ^= other.event_id_hash;
+	}
+}
+
 NavModes Report::reportedModes(NavModes required_modes)
 {
 	// Make sure optional checks are still shown in the UI
@@ -292,7 +347,7 @@ bool Report::report(bool force)
 		event.log_levels = header->log_levels;
 		memcpy(event.arguments, _event_buffer + offset + sizeof(EventBufferHeader), header->size);
 		memset(event.arguments + header->size, 0, sizeof(event.arguments) - header->size);
-		events::send(event);
+		events::send(event, false); // the report is only complete with all its events
 		offset += sizeof(EventBufferHeader) + header->size;
 #ifdef CONSOLE_PRINT_ARMING_CHECK_EVENT
 		const char *message;
@@ -54,6 +54,7 @@
 using namespace time_literals;
 
 class HealthAndArmingChecks;
+class HealthAndArmingCheckBase;
 
 using navigation_mode_group_t = events::px4::enums::navigation_mode_group_t;
 using health_component_t = events::px4::enums::health_component_t;
@@ -266,6 +267,8 @@ public:
 	bool modePreventsArming(uint8_t nav_state) const { return _failsafe_flags.mode_req_prevent_arming & (1u << nav_state); }
 
 	bool addExternalEvent(const event_s &event, NavModes modes);
+
+	struct Fragment;
 private:
 
 	/**
@@ -311,6 +314,14 @@ private:
 
 	NavModes reportedModes(NavModes required_modes);
 
+	/**
+	 * Run a check on its own and merge its results into the current ones. What it reported is stored in
+	 * the fragment, to be merged again with applyFragment() instead of running the check.
+	 */
+	void runAndRecord(HealthAndArmingCheckBase &check, const Context &context, Fragment &fragment);
+	void applyFragment(const Fragment &fragment);
+	static void merge(Results &results, const Results &other, bool with_events);
+
 	NavModes getModeGroup(uint8_t nav_state) const;
 
 	friend class HealthAndArmingChecks;
@@ -321,6 +332,7 @@ private:
 	FRIEND_TEST(ReporterTest, arming_checks_mode_category2);
 	FRIEND_TEST(ReporterTest, reporting);
 	FRIEND_TEST(ReporterTest, reporting_multiple);
+	FRIEND_TEST(ReporterTest, fragments);
 
 	/**
 	 * Reset current results.
@@ -365,6 +377,16 @@ private:
 	orb_advert_t *_mavlink_log_pub{nullptr}; ///< mavlink log publication for legacy reporting
 };
 
+/**
+ * Results and events of a single check, so the check does not need to run while its inputs did not change
+ */
+struct Report::Fragment {
+	Results results;
+	uint8_t events[2 * (sizeof(EventBufferHeader) + 1 + 1 + 4)]; ///< a check with more events always runs
+	uint8_t events_size{0};
+	bool valid{false};
+};
+
 template<typename... Args>
 void Report::healthFailure(NavModes required_modes, HealthComponentIndex component, uint32_t event_id,
 			   const events::LogLevels &log_levels, const char *message, Args... args)
@@ -418,5 +440,18 @@ public:
 
 	virtual void checkAndReport(const Context &context, Report &reporter) = 0;
 
+	/**
+	 * Whether the inputs of the check changed since it last ran. Checks that only depend on their own
+	 * subscriptions, parameters and the context can return false while their topics have no update, then
+	 * the results of the last run are reused. All checks still run on a context or parameter change and
+	 * at least every HealthAndArmingChecks::max_cache_age.
+	 */
+	virtual bool inputsUpdated() { return true; }
+
 	void updateParams() override { ModuleParams::updateParams(); }
+
+private:
+	friend class HealthAndArmingChecks;
+
+	Report::Fragment _fragment{};
 };
@@ -58,14 +58,23 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 
 	_context.setIsArmingRequest(is_arming_request);
 
-	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-		if (!_checks[i]) {
-			break;
-		}
+	// reuse the results of checks with unchanged inputs, unless anything else they might depend on changed
+	const hrt_abstime now = hrt_absolute_time();
+	vehicle_status_s status = _context.status();
+	status.timestamp = _last_status.timestamp;
+
+	const bool run_all = force_reporting || is_arming_request || _params_changed
+			     || (memcmp(&status, &_last_status, sizeof(status)) != 0)
+			     || (now > _last_run_all + max_cache_age);
 
-		_checks[i]->checkAndReport(_context, _reporter);
+	if (run_all) {
+		_last_status = status;
+		_last_run_all = now;
+		_params_changed = false;
 	}
 
+	runChecks(run_all);
+
 	const bool results_changed = _reporter.finalize();
 	const bool reported = _reporter.report(force_reporting);
 
@@ -80,13 +89,7 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 
 		_reporter.prepare(_context.status().vehicle_type);
 
-		for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-			if (!_checks[i]) {
-				break;
-			}
-
-			_checks[i]->checkAndReport(_context, _reporter);
-		}
+		runChecks(true);
 
 		_reporter.finalize();
 		_reporter.report(false);
@@ -100,8 +103,6 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 	}
 
 	// Check if we need to publish the failsafe flags
-	const hrt_abstime now = hrt_absolute_time();
-
 	if ((now > _failsafe_flags.timestamp + 500_ms) || results_changed) {
 		_failsafe_flags.timestamp = hrt_absolute_time();
 		_failsafe_flags_pub.publish(_failsafe_flags);
@@ -110,8 +111,28 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 	return reported;
 }
 
+void HealthAndArmingChecks::runChecks(bool run_all)
+{
+	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
+		if (!_checks[i]) {
+			break;
+		}
+
+		HealthAndArmingCheckBase &check = *_checks[i];
+
+		if (run_all || !check._fragment.valid || check.inputsUpdated()) {
+			_reporter.runAndRecord(check, _context, check._fragment);
+
+		} else {
+			_reporter.applyFragment(check._fragment);
+		}
+	}
+}
+
 void HealthAndArmingChecks::updateParams()
 {
+	_params_changed = true;
+
 	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
 		if (!_checks[i]) {
 			break;
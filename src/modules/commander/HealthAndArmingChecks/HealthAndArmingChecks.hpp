@@ -111,11 +111,25 @@ public:
 	ExternalChecks &externalChecks() { return _external_checks; }
 #endif
 
+	/**
+	 * Checks with unchanged inputs are run again at least this often
+	 */
+	static constexpr hrt_abstime max_cache_age = 1_s;
+
 protected:
 	void updateParams() override;
 private:
+	/**
+	 * Run all checks in order, or reuse the last results of the checks with unchanged inputs if run_all is false
+	 */
+	void runChecks(bool run_all);
+
 	failsafe_flags_s _failsafe_flags{};
 
+	vehicle_status_s _last_status{};
+	hrt_abstime _last_run_all{0};
+	bool _params_changed{true};
+
 	Context _context;
 	Report _reporter{_failsafe_flags};
 	orb_advert_t _mavlink_log_pub{nullptr};
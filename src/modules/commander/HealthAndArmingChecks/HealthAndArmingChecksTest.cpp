@@ -285,3 +285,65 @@ TEST_F(ReporterTest, reporting_multiple)
 		}
 	}
 }
+
+class TestCheck : public HealthAndArmingCheckBase
+{
+public:
+	void checkAndReport(const Context &context, Report &reporter) override
+	{
+		reporter.healthFailure(NavModes::PositionControl, health_component_t::local_position_estimate,
+				       events::ID("arming_test_fragments_fail1"), events::Log::Error, "");
+		reporter.armingCheckFailure<uint8_t>(NavModes::All, health_component_t::remote_control,
+						     events::ID("arming_test_fragments_fail2"), events::Log::Warning, "", 7);
+		reporter.setIsPresent(health_component_t::battery);
+	}
+};
+
+TEST_F(ReporterTest, fragments)
+{
+	failsafe_flags_s failsafe_flags{};
+	Report reporter{failsafe_flags, 0_s};
+	vehicle_status_s status{};
+	Context context{status};
+	TestCheck check;
+
+	// a check that ran before, with overlapping results
+	auto other_check = [&reporter]() {
+		reporter.healthFailure(NavModes::All, health_component_t::local_position_estimate,
+				       events::ID("arming_test_fragments_fail3"), events::Log::Warning, "");
+	};
+
+	// reference: run the checks directly
+	reporter.reset();
+	other_check();
+	check.checkAndReport(context, reporter);
+	const Report::Results expected = reporter._results[reporter._current_result];
+	uint8_t expected_events[sizeof(reporter._event_buffer)];
+	const int expected_events_size = reporter._next_buffer_idx;
+	memcpy(expected_events, reporter._event_buffer, expected_events_size);
+
+	// recording and then replaying the fragment of the second check must give the same results and events
+	Report::Fragment fragment{};
+
+	for (int i = 0; i < 2; ++i) {
+		reporter.reset();
+		other_check();
+
+		if (i == 0) {
+			reporter.runAndRecord(check, context, fragment);
+			ASSERT_TRUE(fragment.valid);
+
+		} else {
+			reporter.applyFragment(fragment);
+		}
+
+		Report::Results &results = reporter._results[reporter._current_result];
+		ASSERT_FALSE(results != expected);
+		ASSERT_EQ(reporter._next_buffer_idx, expected_events_size);
+		ASSERT_EQ(memcmp(reporter._event_buffer, expected_events, expected_events_size), 0);
+	}
+
+	// the fragment only holds what the check reported itself
+	ASSERT_EQ(fragment.results.num_events, 2);
+	ASSERT_EQ((uint64_t)fragment.results.health.warning, 0);
+}
@@ -43,6 +43,9 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	// only depends on the context and parameters
+	bool inputsUpdated() override { return false; }
+
 private:
 	DEFINE_PARAMETERS_CUSTOM_PARENT(HealthAndArmingCheckBase,
 					(ParamBool<px4::params::COM_PARACHUTE>) _param_com_parachute
@@ -46,6 +46,9 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	// only depends on the context and parameters
+	bool inputsUpdated() override { return false; }
+
 private:
 	void updateParams() override;
 
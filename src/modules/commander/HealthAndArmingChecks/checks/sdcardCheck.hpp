@@ -43,6 +43,9 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	// only depends on the parameters, the SD card is checked on the regular full runs
+	bool inputsUpdated() override { return false; }
+
 private:
 #ifdef PX4_STORAGEDIR
 	bool _sdcard_detected {false};
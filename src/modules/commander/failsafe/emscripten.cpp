@@ -66,6 +66,7 @@ public:
 	}
 
 	FailsafeBase &current() { return _failsafe; }
+	const Failsafe &failsafe() const { return _failsafe; }
 	std::map<param_t, Param> &params() { return _used_params; }
 private:
 	std::map<param_t, Param> _used_params;
@@ -202,6 +203,26 @@ std::string action_str(int action)
 	return FailsafeBase::actionStr((FailsafeBase::Action)action);
 }
 
+// compiled failsafe policy for the current parameters, as JSON list of rules
+std::string get_policy_table()
+{
+	const Failsafe &failsafe = failsafe_instance.failsafe();
+	std::string ret = "[";
+
+	for (int i = 0; i < failsafe.policyRuleCount(); ++i) {
+		const Failsafe::PolicyRule &rule = failsafe.policyRule(i);
+		char buffer[256];
+		snprintf(buffer, sizeof(buffer),
+			 "%s{\"flag\": \"%s\", \"gate\": %i, \"mode_mask\": %u, \"action\": \"%s\", \"clear_condition\": %i, "
+			 "\"can_be_deferred\": %s}", i == 0 ? "" : ", ", rule.flag_name, (int)rule.gate, (unsigned)rule.mode_mask,
+			 FailsafeBase::actionStr(rule.options.action), (int)rule.options.clear_condition,
+			 rule.options.can_be_deferred ? "true" : "false");
+		ret += buffer;
+	}
+
+	return ret + "]";
+}
+
 EMSCRIPTEN_BINDINGS(failsafe)
 {
 	class_<failsafe_flags_s>("state")
@@ -218,5 +239,6 @@ EMSCRIPTEN_BINDINGS(failsafe)
 	function("get_param_value_float", &get_param_value_float);
 	function("user_takeover_active", &user_takeover_active);
 	function("selected_action", &selected_action);
+	function("get_policy_table", &get_policy_table);
 	register_vector<std::string>("vector<string>");
 }
@@ -441,6 +441,140 @@ FailsafeBase::ActionOptions Failsafe::fromRemainingFlightTimeLowActParam(int par
 	return options;
 }
 
+#define POLICY_FLAG(flag_name) #flag_name, (uint16_t)offsetof(failsafe_flags_s, flag_name)
+
+void Failsafe::updateParams()
+{
+	FailsafeBase::updateParams();
+	compilePolicy();
+}
+
+void Failsafe::compilePolicy()
+{
+	using Gate = PolicyRule::Gate;
+	static constexpr uint32_t all_modes = UINT32_MAX;
+	static_assert(vehicle_status_s::NAVIGATION_STATE_MAX <= 32, "mode mask too small");
+
+	_num_policy_rules = 0;
+
+	// Manual control (RC) loss
+	uint32_t rc_loss_modes = all_modes;
+
+	if (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Mission) {
+		rc_loss_modes &= ~(1u << vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION);
+	}
+
+	if (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Hold) {
+		rc_loss_modes &= ~((1u << vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER)
+				   | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF)
+				   | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_VTOL_TAKEOFF));
+	}
+
+	if (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Offboard) {
+		rc_loss_modes &= ~(1u << vehicle_status_s::NAVIGATION_STATE_OFFBOARD);
+	}
+
+	if (_param_com_rc_in_mode.get() != int32_t(RcInMode::StickInputDisabled)) {
+		addPolicyRule(POLICY_FLAG(manual_control_signal_lost), Gate::ManualControlLoss, rc_loss_modes,
+			      fromNavDllOrRclActParam(_param_nav_rcl_act.get()).causedBy(Cause::ManualControlLoss));
+	}
+
+	// GCS connection loss
+	if (_param_nav_dll_act.get() != int32_t(gcs_connection_loss_failsafe_mode::Disabled)) {
+		const uint32_t gcs_loss_modes = all_modes & ~((1u << vehicle_status_s::NAVIGATION_STATE_AUTO_LAND)
+						| (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_PRECLAND));
+		addPolicyRule(POLICY_FLAG(gcs_connection_lost), Gate::LinkLoss, gcs_loss_modes,
+			      fromNavDllOrRclActParam(_param_nav_dll_act.get()).causedBy(Cause::GCSConnectionLoss));
+	}
+
+	// VTOL transition failure (quadchute)
+	addPolicyRule(POLICY_FLAG(vtol_fixed_wing_system_failure), Gate::None,
+		      (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION) | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER)
+		      | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF) | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_VTOL_TAKEOFF),
+		      fromQuadchuteActParam(_param_com_qc_act.get()));
+
+	// Mission
+	addPolicyRule(POLICY_FLAG(mission_failure), Gate::None, 1u << vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION,
+		      Action::RTL);
+
+	endPolicySection(PolicySection::LinkAndMission);
+
+	addPolicyRule(POLICY_FLAG(wind_limit_exceeded), Gate::None, all_modes,
+		      ActionOptions(fromHighWindLimitActParam(_param_com_wind_max_act.get()).cannotBeDeferred()));
+	addPolicyRule(POLICY_FLAG(flight_time_limit_exceeded), Gate::None, all_modes,
+		      ActionOptions(Action::RTL).cannotBeDeferred());
+
+	// Low Position Accuracy Failsafe (only in auto mission and auto loiter)
+	addPolicyRule(POLICY_FLAG(local_position_accuracy_low), Gate::None,
+		      (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION) | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER),
+		      fromPosLowActParam(_param_com_pos_low_act.get()));
+
+	const uint32_t navigator_land_modes = (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF)
+					      | (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_RTL);
+	addPolicyRule(POLICY_FLAG(navigator_failure), Gate::None, navigator_land_modes,
+		      ActionOptions(Action::Land).clearOn(ClearCondition::OnModeChangeOrDisarm));
+	addPolicyRule(POLICY_FLAG(navigator_failure), Gate::None, all_modes & ~navigator_land_modes,
+		      ActionOptions(Action::Hold).clearOn(ClearCondition::OnModeChangeOrDisarm));
+
+	addPolicyRule(POLICY_FLAG(geofence_breached), Gate::None, all_modes,
+		      fromGfActParam(_param_gf_action.get()).cannotBeDeferred());
+
+	// Battery flight time remaining failsafe
+	addPolicyRule(POLICY_FLAG(battery_low_remaining_time), Gate::None, all_modes,
+		      ActionOptions(fromRemainingFlightTimeLowActParam(_param_com_fltt_low_act.get())));
+
+	endPolicySection(PolicySection::Flight);
+
+	addPolicyRule(POLICY_FLAG(fd_imbalanced_prop), Gate::None, all_modes,
+		      fromImbalancedPropActParam(_param_com_imb_prop_act.get()));
+	addPolicyRule(POLICY_FLAG(fd_motor_failure), Gate::None, all_modes,
+		      fromActuatorFailureActParam(_param_com_actuator_failure_act.get()));
+
+	endPolicySection(PolicySection::FailureDetector);
+}
+
+void Failsafe::addPolicyRule(const char *flag_name, uint16_t flag_offset, PolicyRule::Gate gate, uint32_t mode_mask,
+			     const ActionOptions &options)
+{
+	if (_num_policy_rules >= max_num_policy_rules) {
+		PX4_ERR("too many failsafe policy rules");
+		return;
+	}
+
+	PolicyRule &rule = _policy_rules[_num_policy_rules++];
+	rule.flag_name = flag_name;
+	rule.flag_offset = flag_offset;
+	rule.gate = gate;
+	rule.mode_mask = mode_mask;
+	rule.options = options;
+}
+
+void Failsafe::checkPolicySection(PolicySection section, bool ignore_link_failsafe,
+				  const failsafe_flags_s &status_flags, uint8_t user_intended_mode)
+{
+	const int first = (section == PolicySection::LinkAndMission) ? 0 : _policy_section_end[(int)section - 1];
+	const uint32_t mode_bit = 1u << user_intended_mode;
+
+	// the flags are all bools, addressed by their offset
+	const uint8_t *cur_flags = reinterpret_cast<const uint8_t *>(&status_flags);
+	const uint8_t *last_flags = reinterpret_cast<const uint8_t *>(&lastStatusFlags());
+
+	for (int i = first; i < _policy_section_end[(int)section]; ++i) {
+		const PolicyRule &rule = _policy_rules[i];
+
+		if (!(rule.mode_mask & mode_bit)) {
+			continue;
+		}
+
+		if ((rule.gate != PolicyRule::Gate::None && ignore_link_failsafe)
+		    || (rule.gate == PolicyRule::Gate::ManualControlLoss && _manual_control_lost_at_arming)) {
+			continue;
+		}
+
+		checkFailsafe(rule.flag_offset, last_flags[rule.flag_offset] != 0, cur_flags[rule.flag_offset] != 0, rule.options);
+	}
+}
+
 void Failsafe::checkStateAndMode(const hrt_abstime &time_us, const State &state,
 				 const failsafe_flags_s &status_flags)
 {
@@ -460,46 +594,14 @@ void Failsafe::checkStateAndMode(const hrt_abstime &time_us, const State &state,
 		_manual_control_lost_at_arming = false;
 	}
 
-	const bool rc_loss_ignored_mission = state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION
-					     && (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Mission);
-	const bool rc_loss_ignored_loiter = state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER
-					    && (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Hold);
-	const bool rc_loss_ignored_offboard = state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_OFFBOARD
-					      && (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Offboard);
-	const bool rc_loss_ignored_takeoff = (state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF ||
-					      state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_VTOL_TAKEOFF)
-					     && (_param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Hold);
-	const bool rc_loss_ignored = rc_loss_ignored_mission || rc_loss_ignored_loiter || rc_loss_ignored_offboard ||
-				     rc_loss_ignored_takeoff || ignore_link_failsafe || _manual_control_lost_at_arming;
-
-	if (_param_com_rc_in_mode.get() != int32_t(RcInMode::StickInputDisabled) && !rc_loss_ignored) {
-		CHECK_FAILSAFE(status_flags, manual_control_signal_lost,
-			       fromNavDllOrRclActParam(_param_nav_rcl_act.get()).causedBy(Cause::ManualControlLoss));
-	}
-
-	// GCS connection loss
-	const bool gcs_connection_loss_ignored = state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_LAND ||
-			state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_PRECLAND || ignore_link_failsafe;
+	// Manual control and GCS connection loss, quadchute and mission failure
+	checkPolicySection(PolicySection::LinkAndMission, ignore_link_failsafe, status_flags, state.user_intended_mode);
 
-	if (_param_nav_dll_act.get() != int32_t(gcs_connection_loss_failsafe_mode::Disabled) && !gcs_connection_loss_ignored) {
-		CHECK_FAILSAFE(status_flags, gcs_connection_lost,
-			       fromNavDllOrRclActParam(_param_nav_dll_act.get()).causedBy(Cause::GCSConnectionLoss));
-	}
-
-	// VTOL transition failure (quadchute)
-	if (state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION ||
-	    state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER ||
-	    state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF ||
-	    state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_VTOL_TAKEOFF) {
-		CHECK_FAILSAFE(status_flags, vtol_fixed_wing_system_failure, fromQuadchuteActParam(_param_com_qc_act.get()));
-	}
-
-	// Mission
+	// If manual control loss and GCS connection loss are disabled and we lose both command links and the mission finished,
+	// trigger RTL to avoid losing the vehicle
 	if (state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION) {
-		CHECK_FAILSAFE(status_flags, mission_failure, Action::RTL);
+		const bool rc_loss_ignored_mission = _param_com_rcl_except.get() & (int)ManualControlLossExceptionBits::Mission;
 
-		// If manual control loss and GCS connection loss are disabled and we lose both command links and the mission finished,
-		// trigger RTL to avoid losing the vehicle
 		if ((_param_com_rc_in_mode.get() == int32_t(RcInMode::StickInputDisabled) || rc_loss_ignored_mission)
 		    && _param_nav_dll_act.get() == int32_t(gcs_connection_loss_failsafe_mode::Disabled)
 		    && state.mission_finished) {
@@ -508,31 +610,8 @@ void Failsafe::checkStateAndMode(const hrt_abstime &time_us, const State &state,
 		}
 	}
 
-	CHECK_FAILSAFE(status_flags, wind_limit_exceeded,
-		       ActionOptions(fromHighWindLimitActParam(_param_com_wind_max_act.get()).cannotBeDeferred()));
-	CHECK_FAILSAFE(status_flags, flight_time_limit_exceeded, ActionOptions(Action::RTL).cannotBeDeferred());
-
-	// trigger Low Position Accuracy Failsafe (only in auto mission and auto loiter)
-	if (state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION ||
-	    state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_LOITER) {
-		CHECK_FAILSAFE(status_flags, local_position_accuracy_low, fromPosLowActParam(_param_com_pos_low_act.get()));
-	}
-
-	if (state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_TAKEOFF ||
-	    state.user_intended_mode == vehicle_status_s::NAVIGATION_STATE_AUTO_RTL) {
-		CHECK_FAILSAFE(status_flags, navigator_failure,
-			       ActionOptions(Action::Land).clearOn(ClearCondition::OnModeChangeOrDisarm));
-
-	} else {
-		CHECK_FAILSAFE(status_flags, navigator_failure,
-			       ActionOptions(Action::Hold).clearOn(ClearCondition::OnModeChangeOrDisarm));
-	}
-
-	CHECK_FAILSAFE(status_flags, geofence_breached, fromGfActParam(_param_gf_action.get()).cannotBeDeferred());
-
-	// Battery flight time remaining failsafe
-	CHECK_FAILSAFE(status_flags, battery_low_remaining_time,
-		       ActionOptions(fromRemainingFlightTimeLowActParam(_param_com_fltt_low_act.get())));
+	// Wind and flight time limits, position accuracy, navigator failure, geofence and remaining flight time
+	checkPolicySection(PolicySection::Flight, ignore_link_failsafe, status_flags, state.user_intended_mode);
 
 	if ((_armed_time != 0)
 	    && (time_us < _armed_time + static_cast<hrt_abstime>(_param_com_spoolup_time.get() * 1_s))
@@ -594,8 +673,8 @@ void Failsafe::checkStateAndMode(const hrt_abstime &time_us, const State &state,
 		CHECK_FAILSAFE(status_flags, fd_critical_failure, Action::Warn);
 	}
 
-	CHECK_FAILSAFE(status_flags, fd_imbalanced_prop, fromImbalancedPropActParam(_param_com_imb_prop_act.get()));
-	CHECK_FAILSAFE(status_flags, fd_motor_failure, fromActuatorFailureActParam(_param_com_actuator_failure_act.get()));
+	// Imbalanced propeller and motor failure
+	checkPolicySection(PolicySection::FailureDetector, ignore_link_failsafe, status_flags, state.user_intended_mode);
 
 
 
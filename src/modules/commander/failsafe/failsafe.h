@@ -39,7 +39,39 @@
 class Failsafe : public FailsafeBase
 {
 public:
-	Failsafe(ModuleParams *parent) : FailsafeBase(parent) {}
+	Failsafe(ModuleParams *parent) : FailsafeBase(parent) { compilePolicy(); }
+
+	/**
+	 * Failsafe check that only depends on the parameters and the user intended mode. These are compiled into a
+	 * table with a mode mask on parameter changes, so the evaluation is a constant sequence of flag tests.
+	 */
+	struct PolicyRule {
+		enum class Gate : uint8_t {
+			None,              ///< always checked in the modes of the mask
+			LinkLoss,          ///< not checked during a VTOL takeoff before reaching the loiter altitude
+			ManualControlLoss, ///< like LinkLoss, and not checked while manual control is lost since arming
+		};
+
+		const char *flag_name;
+		uint16_t flag_offset; ///< offset into failsafe_flags_s, also used as caller id (like CHECK_FAILSAFE())
+		Gate gate;
+		uint32_t mode_mask;   ///< bit per user intended mode (nav_state) in which the rule is checked
+		ActionOptions options;
+	};
+
+	/**
+	 * Groups of rules, evaluated in this order together with the checks that depend on time or internal state
+	 */
+	enum class PolicySection : uint8_t {
+		LinkAndMission,
+		Flight,
+		FailureDetector,
+
+		Count
+	};
+
+	int policyRuleCount() const { return _policy_section_end[(int)PolicySection::Count - 1]; }
+	const PolicyRule &policyRule(int index) const { return _policy_rules[index]; }
 
 protected:
 
@@ -50,7 +82,16 @@ protected:
 	uint8_t modifyUserIntendedMode(Action previous_action, Action current_action,
 				       uint8_t user_intended_mode) const override;
 
+	void updateParams() override;
+
 private:
+	void compilePolicy();
+	void addPolicyRule(const char *flag_name, uint16_t flag_offset, PolicyRule::Gate gate, uint32_t mode_mask,
+			   const ActionOptions &options);
+	void endPolicySection(PolicySection section) { _policy_section_end[(int)section] = _num_policy_rules; }
+	void checkPolicySection(PolicySection section, bool ignore_link_failsafe, const failsafe_flags_s &status_flags,
+				uint8_t user_intended_mode);
+
 	void updateArmingState(const hrt_abstime &time_us, bool armed, const failsafe_flags_s &status_flags);
 
 	enum class ManualControlLossExceptionBits : int32_t {
@@ -180,6 +221,11 @@ private:
 	const int _caller_id_battery_warning_emergency{genCallerId()};
 	bool _last_state_battery_warning_emergency{false};
 
+	static constexpr int max_num_policy_rules{16};
+	PolicyRule _policy_rules[max_num_policy_rules] {};
+	uint8_t _num_policy_rules{0};
+	uint8_t _policy_section_end[(int)PolicySection::Count] {};
+
 	hrt_abstime _armed_time{0};
 	bool _was_armed{false};
 	bool _manual_control_lost_at_arming{false}; ///< true if manual control was lost at arming time
@@ -33,6 +33,7 @@
 
 #include <gtest/gtest.h>
 
+#include "failsafe.h"
 #include "framework.h"
 #include <uORB/topics/vehicle_status.h>
 
@@ -392,3 +393,47 @@ TEST_F(FailsafeTest, skip_failsafe)
 	ASSERT_EQ(updated_user_intented_mode, state.user_intended_mode);
 	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::Warn);
 }
+
+TEST_F(FailsafeTest, policy_table)
+{
+	int32_t value = 2; // Return mode
+	param_set(param_handle(px4::params::NAV_RCL_ACT), &value);
+	value = 1; // ignore manual control loss in mission
+	param_set(param_handle(px4::params::COM_RCL_EXCEPT), &value);
+	value = 0; // RC transmitter only
+	param_set(param_handle(px4::params::COM_RC_IN_MODE), &value);
+
+	Failsafe failsafe(nullptr);
+
+	const Failsafe::PolicyRule *rc_loss_rule = nullptr;
+
+	for (int i = 0; i < failsafe.policyRuleCount(); ++i) {
+		if (strcmp(failsafe.policyRule(i).flag_name, "manual_control_signal_lost") == 0) {
+			rc_loss_rule = &failsafe.policyRule(i);
+		}
+	}
+
+	ASSERT_NE(rc_loss_rule, nullptr);
+	EXPECT_FALSE(rc_loss_rule->mode_mask & (1u << vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION));
+	EXPECT_TRUE(rc_loss_rule->mode_mask & (1u << vehicle_status_s::NAVIGATION_STATE_POSCTL));
+	EXPECT_EQ(rc_loss_rule->options.action, FailsafeBase::Action::RTL);
+
+	// the compiled table gives the same decisions as the mode conditions
+	failsafe_flags_s failsafe_flags{};
+	FailsafeBase::State state{};
+	state.armed = true;
+	state.user_intended_mode = vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION;
+	state.vehicle_type = vehicle_status_s::VEHICLE_TYPE_ROTARY_WING;
+	hrt_abstime time = 5_s;
+
+	failsafe.update(time, state, false, false, failsafe_flags);
+	failsafe_flags.manual_control_signal_lost = true;
+	time += 10_ms;
+	failsafe.update(time, state, false, false, failsafe_flags);
+	ASSERT_EQ(failsafe.selectedAction(), FailsafeBase::Action::None);
+
+	state.user_intended_mode = vehicle_status_s::NAVIGATION_STATE_POSCTL;
+	time += 10_ms;
+	failsafe.update(time, state, true, false, failsafe_flags);
+	ASSERT_NE(failsafe.selectedAction(), FailsafeBase::Action::None);
+}
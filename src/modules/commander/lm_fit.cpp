@@ -50,14 +50,15 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 	float fit1 = 0.f;
 	float fit2 = 0.f;
 
-	matrix::SquareMatrix<float, 4> JTJ;
+	// JTJ is symmetric, only its upper triangle is accumulated
+	matrix::SymmetricMatrix<float, 4> JTJ_sum;
 	float JTFI[4] {};
 	float residual = 0.0f;
 
 	// Gauss Newton Part common for all kind of extensions including LM
 	for (uint16_t k = 0; k < samples_collected; k++) {
 
-		float sphere_jacob[4];
+		matrix::Vector4f sphere_jacob;
 		//Calculate Jacobian
 		float A = (params.diag(0)    * (x[k] - params.offset(0))) + (params.offdiag(0) * (y[k] - params.offset(1))) +
 			  (params.offdiag(1) * (z[k] - params.offset(2)));
@@ -68,23 +69,22 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 		float length = sqrtf(A * A + B * B + C * C);
 
 		// 0: partial derivative (radius wrt fitness fn) fn operated on sample
-		sphere_jacob[0] = 1.0f;
+		sphere_jacob(0) = 1.0f;
 		// 1-3: partial derivative (offsets wrt fitness fn) fn operated on sample
-		sphere_jacob[1] = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
-		sphere_jacob[2] = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
-		sphere_jacob[3] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
+		sphere_jacob(1) = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
+		sphere_jacob(2) = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
+		sphere_jacob(3) = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
 		residual = params.radius - length;
 
-		for (uint8_t i = 0; i < 4; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 4; j++) {
-				JTJ(i, j) += sphere_jacob[i] * sphere_jacob[j];
-			}
+		JTJ_sum.rankOneUpdate(1.f, sphere_jacob);
 
-			JTFI[i] += sphere_jacob[i] * residual;
+		for (uint8_t i = 0; i < 4; i++) {
+			JTFI[i] += sphere_jacob(i) * residual;
 		}
 	}
 
+	matrix::SquareMatrix<float, 4> JTJ = JTJ_sum.toSquareMatrix();
+
 
 	//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
 	// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -182,10 +182,11 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 	float fit1 = 0.0f;
 	float fit2 = 0.0f;
 
-	matrix::SquareMatrix<float, 9> JTJ;
+	// JTJ is symmetric, only its upper triangle is accumulated
+	matrix::SymmetricMatrix<float, 9> JTJ_sum;
 	float JTFI[9] {};
 	float residual = 0.0f;
-	float ellipsoid_jacob[9];
+	matrix::Vector<float, 9> ellipsoid_jacob;
 
 	// Gauss Newton Part common for all kind of extensions including LM
 	for (uint16_t k = 0; k < samples_collected; k++) {
@@ -201,28 +202,27 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 		residual = params.radius - length;
 		fit1 += residual * residual;
 		// 0-2: partial derivative (offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[0] = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
-		ellipsoid_jacob[1] = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
-		ellipsoid_jacob[2] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
+		ellipsoid_jacob(0) = 1.0f * (((params.diag(0)    * A) + (params.offdiag(0) * B) + (params.offdiag(1) * C)) / length);
+		ellipsoid_jacob(1) = 1.0f * (((params.offdiag(0) * A) + (params.diag(1)    * B) + (params.offdiag(2) * C)) / length);
+		ellipsoid_jacob(2) = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
 		// 3-5: partial derivative (diag offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[3] = -1.0f * ((x[k] - params.offset(0)) * A) / length;
-		ellipsoid_jacob[4] = -1.0f * ((y[k] - params.offset(1)) * B) / length;
-		ellipsoid_jacob[5] = -1.0f * ((z[k] - params.offset(2)) * C) / length;
+		ellipsoid_jacob(3) = -1.0f * ((x[k] - params.offset(0)) * A) / length;
+		ellipsoid_jacob(4) = -1.0f * ((y[k] - params.offset(1)) * B) / length;
+		ellipsoid_jacob(5) = -1.0f * ((z[k] - params.offset(2)) * C) / length;
 		// 6-8: partial derivative (off-diag offset wrt fitness fn) fn operated on sample
-		ellipsoid_jacob[6] = -1.0f * (((y[k] - params.offset(1)) * A) + ((x[k] - params.offset(0)) * B)) / length;
-		ellipsoid_jacob[7] = -1.0f * (((z[k] - params.offset(2)) * A) + ((x[k] - params.offset(0)) * C)) / length;
-		ellipsoid_jacob[8] = -1.0f * (((z[k] - params.offset(2)) * B) + ((y[k] - params.offset(1)) * C)) / length;
+		ellipsoid_jacob(6) = -1.0f * (((y[k] - params.offset(1)) * A) + ((x[k] - params.offset(0)) * B)) / length;
+		ellipsoid_jacob(7) = -1.0f * (((z[k] - params.offset(2)) * A) + ((x[k] - params.offset(0)) * C)) / length;
+		ellipsoid_jacob(8) = -1.0f * (((z[k] - params.offset(2)) * B) + ((y[k] - params.offset(1)) * C)) / length;
 
-		for (uint8_t i = 0; i < 9; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 9; j++) {
-				JTJ(i, j) += ellipsoid_jacob[i] * ellipsoid_jacob[j];
-			}
+		JTJ_sum.rankOneUpdate(1.f, ellipsoid_jacob);
 
-			JTFI[i] += ellipsoid_jacob[i] * residual;
+		for (uint8_t i = 0; i < 9; i++) {
+			JTFI[i] += ellipsoid_jacob(i) * residual;
 		}
 	}
 
+	matrix::SquareMatrix<float, 9> JTJ = JTJ_sum.toSquareMatrix();
+
 
 	//------------------------Levenberg-Marquardt-part-starts-here---------------------------------//
 	// refer: http://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm#Choice_of_damping_parameter
@@ -353,3 +353,51 @@ int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int s
 
 	return 1;
 }
+
+void SphereFitAccumulator::reset()
+{
+	_ata.zero();
+	_atb.zero();
+	_reference.zero();
+	_count = 0;
+}
+
+void SphereFitAccumulator::add(float x, float y, float z)
+{
+	if (_count == 0) {
+		_reference = matrix::Vector3f(x, y, z);
+	}
+
+	const matrix::Vector3f p = matrix::Vector3f(x, y, z) - _reference;
+	const matrix::Vector4f phi(p(0), p(1), p(2), 1.f);
+
+	_ata.rankOneUpdate(1.f, phi);
+	_atb += phi * p.norm_squared();
+	_count++;
+}
+
+bool SphereFitAccumulator::solve(sphere_params &params) const
+{
+	if (_count < 4) {
+		return false;
+	}
+
+	matrix::SquareMatrix<float, 4> ata_inv;
+
+	if (!_ata.toSquareMatrix().I(ata_inv)) {
+		return false;
+	}
+
+	// unknowns [2 * c, d] with the center c relative to the reference sample
+	const matrix::Vector4f sol = ata_inv * _atb;
+	const matrix::Vector3f center = matrix::Vector3f(sol(0), sol(1), sol(2)) * 0.5f;
+	const float radius_squared = sol(3) + center.norm_squared();
+
+	if (!PX4_ISFINITE(radius_squared) || radius_squared <= 0.f) {
+		return false;
+	}
+
+	params.offset = center + _reference;
+	params.radius = sqrtf(radius_squared);
+	return true;
+}
@@ -63,3 +63,34 @@ struct sphere_params {
  */
 int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int samples_collected, sphere_params &params,
 	       bool full_ellipsoid);
+
+/**
+ * Incremental linear least-squares sphere fit.
+ *
+ * Accumulates the normal equations of |p|^2 = 2 * c'p + d one sample at a time
+ * during the data collection, so a close initial offset and radius for
+ * lm_mag_fit() are available right after it without another pass over the data.
+ */
+class SphereFitAccumulator
+{
+public:
+	void reset();
+
+	void add(float x, float y, float z);
+
+	/**
+	 * Solve the accumulated normal equations.
+	 *
+	 * @param params offset and radius are set on success, the rest is untouched
+	 * @return true if the fit is well defined
+	 */
+	bool solve(sphere_params &params) const;
+
+	unsigned int count() const { return _count; }
+
+private:
+	matrix::SymmetricMatrix<float, 4> _ata{};
+	matrix::Vector4f _atb{};
+	matrix::Vector3f _reference{}; ///< first sample, keeps the sums well conditioned
+	unsigned int _count{0};
+};
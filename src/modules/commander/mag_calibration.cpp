@@ -66,6 +66,10 @@
 #include <uORB/topics/sensor_gps.h>
 #include <uORB/topics/mag_worker_data.h>
 
+#if defined(__PX4_POSIX)
+#include <pthread.h>
+#endif
+
 using namespace matrix;
 using namespace time_literals;
 
@@ -94,6 +98,8 @@ struct mag_worker_data_t {
 	float		*y[MAX_MAGS];
 	float		*z[MAX_MAGS];
 
+	SphereFitAccumulator	sphere_fit[MAX_MAGS];			///< running linear fit, seeds lm_mag_fit()
+
 	calibration::Magnetometer calibration[MAX_MAGS] {};
 };
 
@@ -384,6 +390,7 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 						worker_data->x[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](0);
 						worker_data->y[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](1);
 						worker_data->z[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](2);
+						worker_data->sphere_fit[cur_mag].add(new_samples[cur_mag](0), new_samples[cur_mag](1), new_samples[cur_mag](2));
 
 						worker_data->calibration_counter_total[cur_mag]++;
 					}
@@ -463,6 +470,36 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 	return result;
 }
 
+/// Sphere and ellipsoid fit of one mag, independent of the others
+struct mag_fit_job_t {
+	const float	*x;
+	const float	*y;
+	const float	*z;
+	unsigned int	samples;
+	bool		sphere_fit_only;
+	sphere_params	params;
+	float		sphere_radius;		///< radius of the sphere fit before the ellipsoid refinement
+	bool		sphere_fit_success;
+	bool		ellipsoid_fit_success;
+};
+
+static void *mag_fit_run(void *arg)
+{
+	mag_fit_job_t *job = static_cast<mag_fit_job_t *>(arg);
+
+	job->sphere_fit_success = (lm_mag_fit(job->x, job->y, job->z, job->samples, job->params, false) == PX4_OK);
+
+	if (job->sphere_fit_success) {
+		job->sphere_radius = job->params.radius;
+
+		if (!job->sphere_fit_only) {
+			job->ellipsoid_fit_success = (lm_mag_fit(job->x, job->y, job->z, job->samples, job->params, true) == PX4_OK);
+		}
+	}
+
+	return nullptr;
+}
+
 calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_mask)
 {
 	// We should not try to subscribe if the topic doesn't actually exist and can be counted.
@@ -516,6 +553,7 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 		worker_data.y[cur_mag] = nullptr;
 		worker_data.z[cur_mag] = nullptr;
 		worker_data.calibration_counter_total[cur_mag] = 0;
+		worker_data.sphere_fit[cur_mag].reset();
 	}
 
 	const unsigned int calibration_points_maxcount = worker_data.calibration_sides * worker_data.calibration_points_perside;
@@ -572,41 +610,78 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 
 	if (result == calibrate_return_ok) {
 		// Sphere fit the data to get calibration values
+		mag_fit_job_t fit_jobs[MAX_MAGS] {};
+
 		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
 			if (worker_data.calibration[cur_mag].device_id() != 0) {
-				// Mag in this slot is available and we should have values for it to calibrate
+				mag_fit_job_t &job = fit_jobs[cur_mag];
+				job.x = worker_data.x[cur_mag];
+				job.y = worker_data.y[cur_mag];
+				job.z = worker_data.z[cur_mag];
+				job.samples = worker_data.calibration_counter_total[cur_mag];
 
 				// Estimate only the offsets if two-sided calibration is selected, as the problem is not constrained
 				// enough to reliably estimate both scales and offsets with 2 sides only (even if the existing calibration
 				// is already close)
-				bool sphere_fit_only = worker_data.calibration_sides <= 2;
+				job.sphere_fit_only = worker_data.calibration_sides <= 2;
 
-				sphere_params sphere_data;
-				sphere_data.radius = sphere_radius[cur_mag];
-				sphere_data.offset = matrix::Vector3f(sphere[cur_mag](0), sphere[cur_mag](1), sphere[cur_mag](2));
-				sphere_data.diag = matrix::Vector3f(diag[cur_mag](0), diag[cur_mag](1), diag[cur_mag](2));
-				sphere_data.offdiag = matrix::Vector3f(offdiag[cur_mag](0), offdiag[cur_mag](1), offdiag[cur_mag](2));
+				job.params.radius = sphere_radius[cur_mag];
+				job.params.offset = matrix::Vector3f(sphere[cur_mag](0), sphere[cur_mag](1), sphere[cur_mag](2));
+				job.params.diag = matrix::Vector3f(diag[cur_mag](0), diag[cur_mag](1), diag[cur_mag](2));
+				job.params.offdiag = matrix::Vector3f(offdiag[cur_mag](0), offdiag[cur_mag](1), offdiag[cur_mag](2));
 
-				bool sphere_fit_success = false;
-				bool ellipsoid_fit_success = false;
-				int ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-						     worker_data.calibration_counter_total[cur_mag], sphere_data, false);
+				// start from the linear fit accumulated during the data collection if it is plausible
+				sphere_params linear_fit = job.params;
 
-				if (ret == PX4_OK) {
-					sphere_fit_success = true;
-					PX4_INFO("Mag: %" PRIu8 " sphere radius: %.4f", cur_mag, (double)sphere_data.radius);
+				if (worker_data.sphere_fit[cur_mag].solve(linear_fit)
+				    && (linear_fit.radius > 0.5f * mag_sphere_radius) && (linear_fit.radius < 2.f * mag_sphere_radius)) {
+					job.params.offset = linear_fit.offset;
+					job.params.radius = linear_fit.radius;
+				}
+			}
+		}
 
-					if (!sphere_fit_only) {
-						int ellipsoid_ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
-									       worker_data.calibration_counter_total[cur_mag], sphere_data, true);
+#if defined(__PX4_POSIX)
+		// the fits of the different mags are independent, run them in parallel
+		pthread_t fit_threads[MAX_MAGS];
+		bool fit_thread_started[MAX_MAGS] {};
 
-						if (ellipsoid_ret == PX4_OK) {
-							ellipsoid_fit_success = true;
-						}
-					}
+		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
+			if (worker_data.calibration[cur_mag].device_id() != 0) {
+				fit_thread_started[cur_mag] = (pthread_create(&fit_threads[cur_mag], nullptr, mag_fit_run, &fit_jobs[cur_mag]) == 0);
+
+				if (!fit_thread_started[cur_mag]) {
+					mag_fit_run(&fit_jobs[cur_mag]);
+				}
+			}
+		}
+
+		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
+			if (fit_thread_started[cur_mag]) {
+				pthread_join(fit_threads[cur_mag], nullptr);
+			}
+		}
+
+#else
+
+		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
+			if (worker_data.calibration[cur_mag].device_id() != 0) {
+				mag_fit_run(&fit_jobs[cur_mag]);
+			}
+		}
+
+#endif
+
+		for (uint8_t cur_mag = 0; cur_mag < MAX_MAGS; cur_mag++) {
+			if (worker_data.calibration[cur_mag].device_id() != 0) {
+				// Mag in this slot is available and we should have values for it to calibrate
+				const mag_fit_job_t &job = fit_jobs[cur_mag];
+
+				if (job.sphere_fit_success) {
+					PX4_INFO("Mag: %" PRIu8 " sphere radius: %.4f", cur_mag, (double)job.sphere_radius);
 				}
 
-				if (!sphere_fit_success && !ellipsoid_fit_success) {
+				if (!job.sphere_fit_success && !job.ellipsoid_fit_success) {
 					if (worker_data.calibration[cur_mag].enabled()) {
 						calibration_log_emergency(mavlink_log_pub, "Retry calibration (unable to fit mag %" PRIu8 ")", cur_mag);
 						result = calibrate_return_error;
@@ -618,12 +693,12 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 					}
 				}
 
-				sphere_radius[cur_mag] = sphere_data.radius;
+				sphere_radius[cur_mag] = job.params.radius;
 
 				for (int i = 0; i < 3; i++) {
-					sphere[cur_mag](i) = sphere_data.offset(i);
-					diag[cur_mag](i) = sphere_data.diag(i);
-					offdiag[cur_mag](i) = sphere_data.offdiag(i);
+					sphere[cur_mag](i) = job.params.offset(i);
+					diag[cur_mag](i) = job.params.diag(i);
+					offdiag[cur_mag](i) = job.params.offdiag(i);
 				}
 
 				result = check_calibration_result(sphere[cur_mag](0), sphere[cur_mag](1), sphere[cur_mag](2),
@@ -648,7 +723,6 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 		}
 	}
 
-
 #if 0
 
 	// DO NOT REMOVE! Critical validation data!
@@ -236,3 +236,41 @@ TEST_F(MagCalTest, replayTestData)
 	EXPECT_NEAR(ellipsoid.diag(1), scale_true(1), 0.01f) << "scale Y: " << ellipsoid.diag(1);
 	EXPECT_NEAR(ellipsoid.diag(2), scale_true(2), 0.01f) << "scale Z: " << ellipsoid.diag(2);
 }
+
+TEST_F(MagCalTest, incrementalSphereInit)
+{
+	// GIVEN: regularly spaced points on an offset sphere, accumulated one by one
+	static constexpr unsigned int N_SAMPLES = 240;
+
+	const float mag_str_true = 0.4f;
+	const Vector3f offset_true = {-1.07f, 0.35f, -0.78f};
+	const Vector3f scale_true = {1.f, 1.f, 1.f};
+
+	float x[N_SAMPLES];
+	float y[N_SAMPLES];
+	float z[N_SAMPLES];
+	generateRegularData(x, y, z, N_SAMPLES, mag_str_true);
+	modifyOffsetScale(x, y, z, N_SAMPLES, offset_true, scale_true);
+
+	SphereFitAccumulator accumulator;
+	accumulator.reset();
+
+	for (unsigned int k = 0; k < N_SAMPLES; k++) {
+		accumulator.add(x[k], y[k], z[k]);
+	}
+
+	// WHEN: solving the accumulated linear fit
+	sphere_params sphere;
+	sphere.diag = {1.f, 1.f, 1.f};
+	ASSERT_TRUE(accumulator.solve(sphere));
+
+	// THEN: it is already close to the solution, and the LM fit started from it converges
+	EXPECT_NEAR(sphere.radius, mag_str_true, 0.01f) << "radius: " << sphere.radius;
+	EXPECT_NEAR((sphere.offset - offset_true).norm(), 0.f, 0.01f);
+
+	EXPECT_EQ(lm_mag_fit(x, y, z, N_SAMPLES, sphere, false), PX4_OK);
+	EXPECT_NEAR(sphere.radius, mag_str_true, 0.001f) << "radius: " << sphere.radius;
+	EXPECT_NEAR(sphere.offset(0), offset_true(0), 0.001f) << "offset X: " << sphere.offset(0);
+	EXPECT_NEAR(sphere.offset(1), offset_true(1), 0.001f) << "offset Y: " << sphere.offset(1);
+	EXPECT_NEAR(sphere.offset(2), offset_true(2), 0.001f) << "offset Z: " << sphere.offset(2);
+}
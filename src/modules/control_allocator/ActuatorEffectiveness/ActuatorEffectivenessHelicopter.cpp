@@ -88,6 +88,10 @@ void ActuatorEffectivenessHelicopter::updateParams()
 		_geometry.swash_plate_servos[i].angle = math::radians(angle_deg);
 		param_get(_param_handles.swash_plate_servos[i].arm_length, &_geometry.swash_plate_servos[i].arm_length);
 		param_get(_param_handles.swash_plate_servos[i].trim, &_geometry.swash_plate_servos[i].trim);
+		_geometry.swash_plate_servos[i].roll_coeff = sinf(_geometry.swash_plate_servos[i].angle)
+				* _geometry.swash_plate_servos[i].arm_length;
+		_geometry.swash_plate_servos[i].pitch_coeff = cosf(_geometry.swash_plate_servos[i].angle)
+				* _geometry.swash_plate_servos[i].arm_length;
 	}
 
 	for (int i = 0; i < NUM_CURVE_POINTS; ++i) {
@@ -155,8 +159,8 @@ void ActuatorEffectivenessHelicopter::updateSetpoint(const matrix::Vector<float,
 	}
 
 	for (int i = 0; i < _geometry.num_swash_plate_servos; i++) {
-		float roll_coeff = sinf(_geometry.swash_plate_servos[i].angle) * _geometry.swash_plate_servos[i].arm_length;
-		float pitch_coeff = cosf(_geometry.swash_plate_servos[i].angle) * _geometry.swash_plate_servos[i].arm_length;
+		const float roll_coeff = _geometry.swash_plate_servos[i].roll_coeff;
+		const float pitch_coeff = _geometry.swash_plate_servos[i].pitch_coeff;
 		actuator_sp(_first_swash_plate_servo_index + i) = collective_pitch
 				+ control_sp(ControlAxis::PITCH) * pitch_coeff
 				- control_sp(ControlAxis::ROLL) * roll_coeff
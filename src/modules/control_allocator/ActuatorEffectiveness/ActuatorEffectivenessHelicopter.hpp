@@ -52,6 +52,8 @@ public:
 		float angle;
 		float arm_length;
 		float trim;
+		float roll_coeff; ///< sin(angle) * arm_length, precomputed
+		float pitch_coeff; ///< cos(angle) * arm_length, precomputed
 	};
 
 	struct Geometry {
@@ -49,6 +49,7 @@ ActuatorEffectivenessTiltrotorVTOL::ActuatorEffectivenessTiltrotorVTOL(ModulePar
 	  _control_surfaces(this), _tilts(this)
 {
 	_param_handles.com_spoolup_time = param_find("COM_SPOOLUP_TIME");
+	_param_handles.tilt_table = param_find("CA_SV_TL_LUT");
 
 	updateParams();
 	setFlightPhase(FlightPhase::HOVER_FLIGHT);
@@ -59,6 +60,7 @@ void ActuatorEffectivenessTiltrotorVTOL::updateParams()
 	ModuleParams::updateParams();
 
 	param_get(_param_handles.com_spoolup_time, &_param_spoolup_time);
+	param_get(_param_handles.tilt_table, &_param_tilt_table);
 }
 
 bool
@@ -79,10 +81,23 @@ ActuatorEffectivenessTiltrotorVTOL::getEffectivenessMatrix(Configuration &config
 	// scales are tilt-invariant. Note: configuration updates are only possible when disarmed.
 	const float collective_tilt_control_applied = (external_update == EffectivenessUpdateReason::CONFIGURATION_UPDATE) ?
 			-1.f : _last_collective_tilt_control;
-	_untiltable_motors = _mc_rotors.updateAxisFromTilts(_tilts, collective_tilt_control_applied)
-			     << configuration.num_actuators[(int)ActuatorType::MOTORS];
+	if (external_update == EffectivenessUpdateReason::CONFIGURATION_UPDATE) {
+		updateTiltEffectivenessTable();
+	}
+
+	bool mc_rotors_added_successfully = true;
+
+	if ((_tilt_table_num_motors > 0) && (external_update == EffectivenessUpdateReason::NO_EXTERNAL_UPDATE)) {
+		// tilt change in flight
+		addMotorsFromTiltTable(configuration, collective_tilt_control_applied);
+
+	} else {
+		_untiltable_motors = _mc_rotors.updateAxisFromTilts(_tilts, collective_tilt_control_applied)
+				     << configuration.num_actuators[(int)ActuatorType::MOTORS];
+
+		mc_rotors_added_successfully = _mc_rotors.addActuators(configuration);
+	}
 
-	const bool mc_rotors_added_successfully = _mc_rotors.addActuators(configuration);
 	_motors = _mc_rotors.getMotors();
 
 	// Control Surfaces
@@ -103,6 +118,53 @@ ActuatorEffectivenessTiltrotorVTOL::getEffectivenessMatrix(Configuration &config
 	return (mc_rotors_added_successfully && surfaces_added_successfully && tilts_added_successfully);
 }
 
+void ActuatorEffectivenessTiltrotorVTOL::updateTiltEffectivenessTable()
+{
+	_tilt_table_num_motors = 0;
+
+	if (!_param_tilt_table) {
+		return;
+	}
+
+	int num_motors = 0;
+
+	for (int i = 0; i < TILT_TABLE_SIZE; i++) {
+		const float collective_tilt_control = -1.f + 2.f * i / (TILT_TABLE_SIZE - 1);
+		_mc_rotors.updateAxisFromTilts(_tilts, collective_tilt_control);
+
+		EffectivenessMatrix effectiveness{};
+		num_motors = ActuatorEffectivenessRotors::computeEffectivenessMatrix(_mc_rotors.geometry(), effectiveness, 0);
+		_tilt_table[i] = effectiveness.slice<NUM_AXES, ActuatorEffectivenessRotors::NUM_ROTORS_MAX>(0, 0);
+	}
+
+	_tilt_table_num_motors = num_motors;
+}
+
+void ActuatorEffectivenessTiltrotorVTOL::addMotorsFromTiltTable(Configuration &configuration,
+		float collective_tilt_control) const
+{
+	if (!PX4_ISFINITE(collective_tilt_control)) {
+		collective_tilt_control = -1.f;
+	}
+
+	const float table_position = (math::constrain(collective_tilt_control, -1.f, 1.f) + 1.f) * 0.5f * (TILT_TABLE_SIZE - 1);
+	const int index = math::min(static_cast<int>(table_position), TILT_TABLE_SIZE - 2);
+	const float fraction = table_position - index;
+
+	EffectivenessMatrix &effectiveness = configuration.effectiveness_matrices[configuration.selected_matrix];
+	const int first_motor_idx = configuration.num_actuators_matrix[configuration.selected_matrix];
+	const int num_motors = math::min(_tilt_table_num_motors, NUM_ACTUATORS - first_motor_idx);
+
+	for (int i = 0; i < num_motors; i++) {
+		for (int axis = 0; axis < NUM_AXES; axis++) {
+			effectiveness(axis, first_motor_idx + i) = math::lerp(_tilt_table[index](axis, i), _tilt_table[index + 1](axis, i),
+					fraction);
+		}
+	}
+
+	configuration.actuatorsAdded(ActuatorType::MOTORS, num_motors);
+}
+
 void ActuatorEffectivenessTiltrotorVTOL::allocateAuxilaryControls(const float dt, int matrix_index,
 		ActuatorVector &actuator_sp)
 {
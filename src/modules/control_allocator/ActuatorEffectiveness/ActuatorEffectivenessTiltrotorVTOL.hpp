@@ -102,6 +102,11 @@ protected:
 
 	float _last_collective_tilt_control{NAN};
 
+	// motor effectiveness over the collective tilt [-1, 1], precomputed on configuration updates (CA_SV_TL_LUT)
+	static constexpr int TILT_TABLE_SIZE{9};
+	matrix::Matrix<float, NUM_AXES, ActuatorEffectivenessRotors::NUM_ROTORS_MAX> _tilt_table[TILT_TABLE_SIZE];
+	int _tilt_table_num_motors{0}; ///< 0 if the table is not in use
+
 	uORB::Subscription _flaps_setpoint_sub{ORB_ID(flaps_setpoint)};
 	uORB::Subscription _spoilers_setpoint_sub{ORB_ID(spoilers_setpoint)};
 
@@ -118,13 +123,25 @@ private:
 
 	void updateParams() override;
 
+	/**
+	 * Compute the motor effectiveness table over the collective tilt if enabled, otherwise disable it.
+	 */
+	void updateTiltEffectivenessTable();
+
+	/**
+	 * Add the motors to the selected matrix by interpolating the effectiveness table.
+	 */
+	void addMotorsFromTiltTable(Configuration &configuration, float collective_tilt_control) const;
+
 	struct ParamHandles {
 		param_t com_spoolup_time;
+		param_t tilt_table;
 	};
 
 	ParamHandles _param_handles{};
 
 	float _param_spoolup_time{1.f};
+	int32_t _param_tilt_table{0};
 
 	// Tilt handling during motor spoolup: leave the tilts in their disarmed position unitil 1s after arming
 	bool throttleSpoolupFinished();
@@ -0,0 +1,208 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationBoxQP.cpp
+ *
+ * Box-constrained quadratic program control allocation.
+ */
+
+#include "ControlAllocationBoxQP.hpp"
+
+ControlAllocationBoxQP::ControlAllocationBoxQP() :
+	ModuleParams(nullptr)
+{
+}
+
+ControlAllocationBoxQP::~ControlAllocationBoxQP()
+{
+	perf_free(_solve_perf);
+	perf_free(_iteration_limit_perf);
+}
+
+void
+ControlAllocationBoxQP::updateParameters()
+{
+	updateParams();
+}
+
+void
+ControlAllocationBoxQP::updateHessian()
+{
+	// effectiveness in the normalized control units of the mix, see normalizeControlAllocationMatrix()
+	_effectiveness_normalized = _effectiveness;
+
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		const int scale_axis = (axis < 2) ? 0 : ((axis == 2) ? 2 : 3);
+
+		if (_control_allocation_scale(scale_axis) > FLT_EPSILON) {
+			_effectiveness_normalized.row(axis) *= _control_allocation_scale(axis);
+		}
+	}
+
+	// H = B^T W B + eps I
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> weighted_effectiveness = _effectiveness_normalized;
+
+	for (int axis = 0; axis < NUM_AXES; axis++) {
+		weighted_effectiveness.row(axis) *= AXIS_WEIGHTS[axis];
+	}
+
+	_hessian = _effectiveness_normalized.transposeMultiply(weighted_effectiveness);
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		_hessian(i, i) += REGULARISATION;
+	}
+
+	// Gershgorin bound of the largest eigenvalue, over the configured actuators only
+	float lipschitz = REGULARISATION;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		float row_sum = 0.f;
+
+		for (int j = 0; j < _num_actuators; j++) {
+			row_sum += fabsf(_hessian(i, j));
+		}
+
+		lipschitz = fmaxf(lipschitz, row_sum);
+	}
+
+	_step_size = 1.f / lipschitz;
+}
+
+void
+ControlAllocationBoxQP::project(ActuatorVector &x) const
+{
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		x(i) = math::constrain(x(i), _actuator_lower(i), _actuator_upper(i));
+	}
+}
+
+void
+ControlAllocationBoxQP::allocate()
+{
+	//Compute new gains if needed
+	const bool mix_updated = _mix_update_needed;
+	updatePseudoInverse();
+
+	if (mix_updated) {
+		updateHessian();
+	}
+
+	_prev_actuator_sp = _actuator_sp;
+
+	const matrix::Vector<float, NUM_AXES> control = _control_sp - _control_trim;
+	const ActuatorVector solution_pinv = _mix * control;
+
+	// box constraints relative to trim, unused or disabled actuators stay at trim
+	bool pinv_feasible = true;
+
+	for (int i = 0; i < NUM_ACTUATORS; i++) {
+		if ((i < _num_actuators) && (_actuator_min(i) <= _actuator_max(i))) {
+			_actuator_lower(i) = _actuator_min(i) - _actuator_trim(i);
+			_actuator_upper(i) = _actuator_max(i) - _actuator_trim(i);
+
+		} else {
+			_actuator_lower(i) = 0.f;
+			_actuator_upper(i) = 0.f;
+		}
+
+		pinv_feasible = pinv_feasible && (solution_pinv(i) >= _actuator_lower(i)) && (solution_pinv(i) <= _actuator_upper(i));
+	}
+
+	if (pinv_feasible) {
+		// the unconstrained minimum is feasible, nothing to solve
+		_solution = solution_pinv;
+		_last_iterations = 0;
+
+	} else {
+		perf_begin(_solve_perf);
+
+		// gradient of the cost: H x - q, with q = B^T W c + eps u_pinv
+		matrix::Vector<float, NUM_AXES> control_weighted;
+
+		for (int axis = 0; axis < NUM_AXES; axis++) {
+			control_weighted(axis) = AXIS_WEIGHTS[axis] * control(axis);
+		}
+
+		const ActuatorVector q = _effectiveness_normalized.transpose() * control_weighted + solution_pinv * REGULARISATION;
+
+		ActuatorVector x = _solution_valid ? _solution : solution_pinv;
+		project(x);
+
+		ActuatorVector y = x;
+		float momentum = 1.f;
+
+		const int max_iterations = math::max(_param_ca_qp_iter.get(), 1);
+		bool converged = false;
+		int iteration = 0;
+
+		while (iteration < max_iterations) {
+			iteration++;
+
+			const ActuatorVector gradient = _hessian * y - q;
+			ActuatorVector x_next = y - gradient * _step_size;
+			project(x_next);
+
+			const ActuatorVector step = x_next - x;
+			x = x_next;
+
+			if (step.abs().max() < TOLERANCE) {
+				converged = true;
+				break;
+			}
+
+			// restart the acceleration if the momentum points uphill
+			if (gradient.dot(step) > 0.f) {
+				momentum = 1.f;
+			}
+
+			const float momentum_next = 0.5f * (1.f + sqrtf(1.f + 4.f * momentum * momentum));
+			y = x + step * ((momentum - 1.f) / momentum_next);
+			momentum = momentum_next;
+		}
+
+		if (!converged) {
+			perf_count(_iteration_limit_perf);
+		}
+
+		_solution = x;
+		_last_iterations = iteration;
+
+		perf_end(_solve_perf);
+	}
+
+	_solution_valid = true;
+
+	_actuator_sp = _actuator_trim + _solution;
+}
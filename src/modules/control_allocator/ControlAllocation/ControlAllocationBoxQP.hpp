@@ -0,0 +1,115 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationBoxQP.hpp
+ *
+ * Control allocation by a box-constrained quadratic program:
+ *
+ *   min_u 0.5 * (B u - c)^T W (B u - c) + 0.5 * eps * ||u - u_pinv||^2   s.t.   u_min <= u <= u_max
+ *
+ * Contrary to clipping or sequential desaturation, the allocation error of a saturated
+ * demand is distributed over all axes according to the priority weights W
+ * (roll/pitch before thrust before yaw). The small regularisation towards the pseudo-inverse
+ * solution u_pinv makes the problem strictly convex for over-actuated airframes.
+ *
+ * The problem is solved with an accelerated projected gradient method (FISTA), which is
+ * warm started from the previous solution and bounded by CA_QP_ITER iterations.
+ * The pseudo-inverse solution is returned directly if it is already feasible.
+ */
+
+#pragma once
+
+#include "ControlAllocationPseudoInverse.hpp"
+
+#include <lib/mathlib/mathlib.h>
+#include <lib/perf/perf_counter.h>
+#include <px4_platform_common/module_params.h>
+
+class ControlAllocationBoxQP: public ControlAllocationPseudoInverse, public ModuleParams
+{
+public:
+
+	ControlAllocationBoxQP();
+	virtual ~ControlAllocationBoxQP();
+
+	void allocate() override;
+
+	void updateParameters() override;
+
+	/**
+	 * @return number of iterations of the last allocation, 0 if the pseudo-inverse solution was feasible
+	 */
+	int lastIterations() const { return _last_iterations; }
+
+	// Weights W of the squared allocation error (roll, pitch, yaw, thrust x, y, z)
+	static constexpr float AXIS_WEIGHTS[NUM_AXES] {1.f, 1.f, 0.1f, 0.5f, 0.5f, 0.5f};
+
+	// Regularisation towards the pseudo-inverse solution
+	static constexpr float REGULARISATION{1e-3f};
+
+	// Convergence threshold on the actuator step (infinity norm)
+	static constexpr float TOLERANCE{1e-4f};
+
+private:
+
+	/**
+	 * Update the Hessian and the gradient step size after a change of the effectiveness matrix.
+	 */
+	void updateHessian();
+
+	/**
+	 * Clip the actuator deviation from trim to the box constraints.
+	 */
+	void project(ActuatorVector &x) const;
+
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> _effectiveness_normalized; // diag(scale) * B
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _hessian;
+	float _step_size{0.f}; // 1 / Lipschitz constant of the gradient
+
+	ActuatorVector _actuator_lower; // box constraints, relative to trim
+	ActuatorVector _actuator_upper;
+
+	ActuatorVector _solution; // previous solution relative to trim, used as warm start
+	bool _solution_valid{false};
+
+	int _last_iterations{0};
+
+	perf_counter_t _solve_perf{perf_alloc(PC_ELAPSED, "control_allocator: QP solve")};
+	perf_counter_t _iteration_limit_perf{perf_alloc(PC_COUNT, "control_allocator: QP iteration limit")};
+
+	DEFINE_PARAMETERS(
+		(ParamInt<px4::params::CA_QP_ITER>) _param_ca_qp_iter
+	);
+};
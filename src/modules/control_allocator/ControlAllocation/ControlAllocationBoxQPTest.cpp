@@ -0,0 +1,162 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ControlAllocationBoxQPTest.cpp
+ *
+ * Tests for the box-constrained QP control allocation
+ */
+
+#include <gtest/gtest.h>
+#include <ControlAllocationBoxQP.hpp>
+
+using namespace matrix;
+
+namespace
+{
+
+static constexpr int NUM_MOTORS{4};
+
+// quad-x effectiveness matrix
+Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS> make_quad_x_effectiveness()
+{
+	Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS> effectiveness;
+	const float roll[NUM_MOTORS] {-0.5f, 0.5f, 0.5f, -0.5f};
+	const float pitch[NUM_MOTORS] {0.5f, -0.5f, 0.5f, -0.5f};
+	const float yaw[NUM_MOTORS] {0.05f, 0.05f, -0.05f, -0.05f};
+
+	for (int i = 0; i < NUM_MOTORS; i++) {
+		effectiveness(ControlAllocation::ControlAxis::ROLL, i) = roll[i];
+		effectiveness(ControlAllocation::ControlAxis::PITCH, i) = pitch[i];
+		effectiveness(ControlAllocation::ControlAxis::YAW, i) = yaw[i];
+		effectiveness(ControlAllocation::ControlAxis::THRUST_Z, i) = -0.25f;
+	}
+
+	return effectiveness;
+}
+
+template<typename T>
+void setup_quad_allocator(T &allocator)
+{
+	const Vector<float, ControlAllocation::NUM_ACTUATORS> actuator_trim;
+	const Vector<float, ControlAllocation::NUM_ACTUATORS> linearization_point;
+	allocator.setEffectivenessMatrix(make_quad_x_effectiveness(), actuator_trim, linearization_point, NUM_MOTORS, false);
+}
+
+// weighted squared error between the demanded and the allocated control
+float weighted_error(const Vector<float, ControlAllocation::NUM_AXES> &control_sp,
+		     const Vector<float, ControlAllocation::NUM_ACTUATORS> &actuator_sp)
+{
+	const Vector<float, ControlAllocation::NUM_AXES> error = make_quad_x_effectiveness() * actuator_sp - control_sp;
+	float cost = 0.f;
+
+	for (int axis = 0; axis < ControlAllocation::NUM_AXES; axis++) {
+		cost += ControlAllocationBoxQP::AXIS_WEIGHTS[axis] * error(axis) * error(axis);
+	}
+
+	return cost;
+}
+
+} // namespace
+
+TEST(ControlAllocationBoxQPTest, FeasibleMatchesPseudoInverse)
+{
+	ControlAllocationBoxQP allocator;
+	ControlAllocationPseudoInverse reference;
+	setup_quad_allocator(allocator);
+	setup_quad_allocator(reference);
+
+	Vector<float, ControlAllocation::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = 0.1f;
+	control_sp(ControlAllocation::ControlAxis::PITCH) = -0.05f;
+	control_sp(ControlAllocation::ControlAxis::YAW) = 0.01f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.5f;
+
+	allocator.setControlSetpoint(control_sp);
+	allocator.allocate();
+	reference.setControlSetpoint(control_sp);
+	reference.allocate();
+
+	EXPECT_EQ(allocator.lastIterations(), 0);
+	EXPECT_TRUE(isEqual(allocator.getActuatorSetpoint(), reference.getActuatorSetpoint(), 1e-5f));
+}
+
+TEST(ControlAllocationBoxQPTest, SaturatedStaysWithinBounds)
+{
+	ControlAllocationBoxQP allocator;
+	ControlAllocationPseudoInverse reference;
+	setup_quad_allocator(allocator);
+	setup_quad_allocator(reference);
+
+	// large roll and yaw demand at high thrust saturates the motors
+	Vector<float, ControlAllocation::NUM_AXES> control_sp;
+	control_sp(ControlAllocation::ControlAxis::ROLL) = 0.4f;
+	control_sp(ControlAllocation::ControlAxis::PITCH) = 0.1f;
+	control_sp(ControlAllocation::ControlAxis::YAW) = 0.5f;
+	control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.8f;
+
+	reference.setControlSetpoint(control_sp);
+	reference.allocate();
+	reference.clipActuatorSetpoint();
+
+	float cost = INFINITY;
+
+	// warm started from the previous solution, the solver converges within a few allocations
+	for (int i = 0; i < 5; i++) {
+		allocator.setControlSetpoint(control_sp);
+		allocator.allocate();
+
+		const Vector<float, ControlAllocation::NUM_ACTUATORS> &actuator_sp = allocator.getActuatorSetpoint();
+		EXPECT_GT(allocator.lastIterations(), 0);
+
+		for (int k = 0; k < ControlAllocation::NUM_ACTUATORS; k++) {
+			EXPECT_GE(actuator_sp(k), 0.f);
+			EXPECT_LE(actuator_sp(k), (k < NUM_MOTORS) ? 1.f : 0.f);
+		}
+
+		cost = weighted_error(control_sp, actuator_sp);
+	}
+
+	EXPECT_LT(allocator.lastIterations(), 5);
+
+	// better than clipping the pseudo-inverse solution
+	EXPECT_LT(cost, weighted_error(control_sp, reference.getActuatorSetpoint()));
+
+	// roll is prioritized over yaw
+	const Vector<float, ControlAllocation::NUM_AXES> control_allocated = make_quad_x_effectiveness() *
+			allocator.getActuatorSetpoint();
+	EXPECT_NEAR(control_allocated(ControlAllocation::ControlAxis::ROLL), control_sp(ControlAllocation::ControlAxis::ROLL),
+		    0.02f);
+	EXPECT_LT(control_allocated(ControlAllocation::ControlAxis::YAW), control_sp(ControlAllocation::ControlAxis::YAW));
+}
@@ -47,17 +47,35 @@ ControlAllocationPseudoInverse::setEffectivenessMatrix(
 	const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 	bool update_normalization_scale)
 {
+	// the effectiveness source rebuilds all matrices on every update, even if only one of them changed
+	// (e.g. only the tilts): skip the pseudo-inverse update of the unchanged ones (exact comparison)
+	bool effectiveness_changed = (num_actuators != _num_actuators) || update_normalization_scale;
+
+	for (int i = 0; (i < NUM_AXES) && !effectiveness_changed; i++) {
+		for (int j = 0; j < NUM_ACTUATORS; j++) {
+			if (fabsf(effectiveness(i, j) - _effectiveness(i, j)) > 0.f) {
+				effectiveness_changed = true;
+				break;
+			}
+		}
+	}
+
 	ControlAllocation::setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, num_actuators,
 			update_normalization_scale);
-	_mix_update_needed = true;
-	_normalization_needs_update = update_normalization_scale;
+
+	if (effectiveness_changed) {
+		_mix_update_needed = true;
+		_normalization_needs_update = update_normalization_scale;
+	}
 }
 
 void
 ControlAllocationPseudoInverse::updatePseudoInverse()
 {
 	if (_mix_update_needed) {
-		matrix::geninv(_effectiveness, _mix);
+		if (!updatePseudoInverseIncremental()) {
+			matrix::geninv(_effectiveness, _mix);
+		}
 
 		if (_normalization_needs_update && !_had_actuator_failure) {
 			updateControlAllocationMatrixScale();
@@ -69,6 +87,43 @@ ControlAllocationPseudoInverse::updatePseudoInverse()
 	}
 }
 
+bool
+ControlAllocationPseudoInverse::updatePseudoInverseIncremental()
+{
+	if ((_gram_updates < 0) || (_gram_updates >= GRAM_MATRIX_REFRESH_UPDATES)) {
+		_gram = _effectiveness * _effectiveness.transpose();
+		_gram_updates = 0;
+
+	} else {
+		// rank one updates for every changed column, B * B^T = sum(b_i * b_i^T)
+		for (int i = 0; i < NUM_ACTUATORS; i++) {
+			const matrix::Vector<float, NUM_AXES> column_prev{_gram_effectiveness.col(i)};
+			const matrix::Vector<float, NUM_AXES> column{_effectiveness.col(i)};
+
+			// exact comparison, operator!= has a tolerance
+			bool changed = false;
+
+			for (int k = 0; k < NUM_AXES; k++) {
+				changed |= (fabsf(column(k) - column_prev(k)) > 0.f);
+			}
+
+			if (changed) {
+				for (int k = 0; k < NUM_AXES; k++) {
+					for (int l = 0; l < NUM_AXES; l++) {
+						_gram(k, l) += column(k) * column(l) - column_prev(k) * column_prev(l);
+					}
+				}
+			}
+		}
+
+		_gram_updates++;
+	}
+
+	_gram_effectiveness = _effectiveness;
+
+	return matrix::pinvGram(_effectiveness, _gram, _mix);
+}
+
 void
 ControlAllocationPseudoInverse::updateControlAllocationMatrixScale()
 {
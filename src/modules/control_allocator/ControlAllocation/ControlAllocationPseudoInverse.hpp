@@ -70,7 +70,22 @@ protected:
 	void updatePseudoInverse();
 
 private:
+	/**
+	 * Update the Gram matrix B * B^T with the changed effectiveness columns (eg. tilting rotors)
+	 * and compute the pseudo inverse from its Cholesky factorisation.
+	 *
+	 * @return false if the effectiveness matrix is rank deficient, geninv() is required then
+	 */
+	bool updatePseudoInverseIncremental();
+
 	void normalizeControlAllocationMatrix();
 	void updateControlAllocationMatrixScale();
 	bool _normalization_needs_update{false};
+
+	// recompute the Gram matrix from scratch periodically to bound the accumulated rounding errors
+	static constexpr int GRAM_MATRIX_REFRESH_UPDATES{50};
+
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> _gram_effectiveness; // effectiveness used for _gram
+	matrix::SquareMatrix<float, NUM_AXES> _gram;
+	int _gram_updates{-1}; // incremental updates since the last full computation, -1: invalid
 };
@@ -67,3 +67,46 @@ TEST(ControlAllocationTest, AllZeroCase)
 	EXPECT_EQ(actuator_sp, actuator_sp_expected);
 	EXPECT_EQ(control_allocated, control_allocated_expected);
 }
+
+TEST(ControlAllocationTest, IncrementalUpdateMatchesFullInverse)
+{
+	// quad tiltrotor: tilting the rotors only changes their columns
+	ControlAllocationPseudoInverse method;
+
+	matrix::Matrix<float, 6, 16> effectiveness;
+	matrix::Vector<float, 16> actuator_trim;
+	matrix::Vector<float, 16> linearization_point;
+	matrix::Vector<float, 6> control_sp;
+	control_sp(0) = 0.1f;
+	control_sp(1) = -0.2f;
+	control_sp(2) = 0.05f;
+	control_sp(3) = 0.3f;
+	control_sp(5) = -0.6f;
+
+	const float roll[4] {-0.5f, 0.5f, 0.5f, -0.5f};
+	const float pitch[4] {0.5f, -0.5f, 0.5f, -0.5f};
+	const float yaw[4] {0.05f, 0.05f, -0.05f, -0.05f};
+
+	for (int step = 0; step <= 120; step++) {
+		const float tilt = 0.01f * step; // 0 to 1.2 rad
+
+		for (int i = 0; i < 4; i++) {
+			effectiveness(0, i) = roll[i] * cosf(tilt) + yaw[i] * sinf(tilt);
+			effectiveness(1, i) = pitch[i];
+			effectiveness(2, i) = yaw[i] * cosf(tilt) - roll[i] * sinf(tilt);
+			effectiveness(3, i) = sinf(tilt);
+			effectiveness(5, i) = -cosf(tilt);
+		}
+
+		method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+		method.setControlSetpoint(control_sp);
+		method.allocate();
+
+		// reference from the full pseudo inverse
+		matrix::Matrix<float, 16, 6> mix;
+		EXPECT_TRUE(matrix::geninv(effectiveness, mix));
+		const matrix::Vector<float, 16> actuator_sp_expected = mix * control_sp;
+
+		EXPECT_TRUE(isEqual(method.getActuatorSetpoint(), actuator_sp_expected, 1e-3f)) << "step " << step;
+	}
+}
@@ -52,7 +52,8 @@ using namespace time_literals;
 ControlAllocator::ControlAllocator() :
 	ModuleParams(nullptr),
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::rate_ctrl),
-	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle"))
+	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
+	_latency_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": control latency"))
 {
 	_control_allocator_status_pub[0].advertise();
 	_control_allocator_status_pub[1].advertise();
@@ -85,6 +86,7 @@ ControlAllocator::~ControlAllocator()
 	delete _actuator_effectiveness;
 
 	perf_free(_loop_perf);
+	perf_free(_latency_perf);
 }
 
 bool
@@ -187,6 +189,10 @@ ControlAllocator::update_allocation_method(bool force)
 				_control_allocation[i] = new ControlAllocationSequentialDesaturation();
 				break;
 
+			case AllocationMethod::BOX_QP:
+				_control_allocation[i] = new ControlAllocationBoxQP();
+				break;
+
 			default:
 				PX4_ERR("Unknown allocation method");
 				break;
@@ -468,13 +474,13 @@ ControlAllocator::Run()
 void
 ControlAllocator::update_effectiveness_matrix_if_needed(EffectivenessUpdateReason reason)
 {
-	ActuatorEffectiveness::Configuration config{};
-
 	if (reason == EffectivenessUpdateReason::NO_EXTERNAL_UPDATE
 	    && hrt_elapsed_time(&_last_effectiveness_update) < 100_ms) { // rate-limit updates
 		return;
 	}
 
+	ActuatorEffectiveness::Configuration config{};
+
 	if (_actuator_effectiveness->getEffectivenessMatrix(config, reason)) {
 		_last_effectiveness_update = hrt_absolute_time();
 
@@ -661,6 +667,10 @@ ControlAllocator::publish_actuator_controls()
 	actuator_motors.timestamp = hrt_absolute_time();
 	actuator_motors.timestamp_sample = _timestamp_sample;
 
+	if (_timestamp_sample != 0 && actuator_motors.timestamp >= _timestamp_sample) {
+		perf_set_elapsed(_latency_perf, actuator_motors.timestamp - _timestamp_sample);
+	}
+
 	actuator_servos_s actuator_servos;
 	actuator_servos.timestamp = actuator_motors.timestamp;
 	actuator_servos.timestamp_sample = _timestamp_sample;
@@ -808,6 +818,10 @@ int ControlAllocator::print_status()
 	case AllocationMethod::AUTO:
 		PX4_INFO("Method: Auto");
 		break;
+
+	case AllocationMethod::BOX_QP:
+		PX4_INFO("Method: Box-constrained QP");
+		break;
 	}
 
 	// Print current airframe
@@ -837,8 +851,35 @@ int ControlAllocator::print_status()
 			 _handled_motor_failure_bitmask);
 	}
 
+	// Print the gyro sample to actuator output latency, measured by the output modules
+	for (auto &control_latency_sub : _control_latency_subs) {
+		control_latency_s control_latency;
+
+		if (control_latency_sub.copy(&control_latency) && (hrt_elapsed_time(&control_latency.timestamp) < 3_s)) {
+			PX4_INFO("Output latency (instance %i): mean %.0f us, min %" PRIu32 " us, max %" PRIu32 " us (allocation: mean %.0f us, max %"
+				 PRIu32 " us), %" PRIu32 " samples",
+				 control_latency_sub.get_instance(), (double)control_latency.latency_mean_us, control_latency.latency_min_us,
+				 control_latency.latency_max_us, (double)control_latency.allocation_latency_mean_us,
+				 control_latency.allocation_latency_max_us, control_latency.sample_count);
+
+			for (int bin = 0; bin < control_latency_s::NUM_BINS; bin++) {
+				if (control_latency.histogram[bin] > 0) {
+					const unsigned lower = bin * control_latency_s::BIN_WIDTH_US;
+
+					if (bin == control_latency_s::NUM_BINS - 1) {
+						PX4_INFO("  >= %5u us: %u", lower, control_latency.histogram[bin]);
+
+					} else {
+						PX4_INFO("  %5u - %5u us: %u", lower, lower + control_latency_s::BIN_WIDTH_US, control_latency.histogram[bin]);
+					}
+				}
+			}
+		}
+	}
+
 	// Print perf
 	perf_print_counter(_loop_perf);
+	perf_print_counter(_latency_perf);
 
 	return 0;
 }
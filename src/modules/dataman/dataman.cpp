@@ -48,10 +48,15 @@
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/getopt.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 #include <lib/parameters/param.h>
 #include <lib/perf/perf_counter.h>
 #include <stdlib.h>
 
+#if defined(__PX4_POSIX)
+#include <sys/mman.h>
+#endif
+
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/dataman_request.h>
@@ -59,6 +64,8 @@
 
 #include "dataman.h"
 
+using namespace time_literals;
+
 __BEGIN_DECLS
 __EXPORT int dataman_main(int argc, char *argv[]);
 __END_DECLS
@@ -79,6 +86,15 @@ static int  _ram_clear(dm_item_t item);
 static int _ram_initialize(unsigned max_offset);
 static void _ram_shutdown();
 
+/* Private RAM cached file based Operations */
+static ssize_t _cached_file_write(dm_item_t item, unsigned index, const void *buf, size_t count);
+static int  _cached_file_clear(dm_item_t item);
+static int _cached_file_initialize(unsigned max_offset);
+static void _cached_file_shutdown();
+static void _cached_file_flush();
+
+static void _reset_storage();
+
 typedef struct dm_operations_t {
 	ssize_t (*write)(dm_item_t item, unsigned index, const void *buf, size_t count);
 	ssize_t (*read)(dm_item_t item, unsigned index, void *buf, size_t count);
@@ -86,6 +102,7 @@ typedef struct dm_operations_t {
 	int (*initialize)(unsigned max_offset);
 	void (*shutdown)();
 	int (*wait)(px4_sem_t *sem);
+	void (*flush)(); ///< write back pending changes (optional)
 } dm_operations_t;
 
 static constexpr dm_operations_t dm_file_operations = {
@@ -95,6 +112,7 @@ static constexpr dm_operations_t dm_file_operations = {
 	.initialize = _file_initialize,
 	.shutdown = _file_shutdown,
 	.wait = px4_sem_wait,
+	.flush = nullptr,
 };
 
 static constexpr dm_operations_t dm_ram_operations = {
@@ -104,6 +122,17 @@ static constexpr dm_operations_t dm_ram_operations = {
 	.initialize = _ram_initialize,
 	.shutdown = _ram_shutdown,
 	.wait = px4_sem_wait,
+	.flush = nullptr,
+};
+
+static constexpr dm_operations_t dm_cached_file_operations = {
+	.write   = _cached_file_write,
+	.read    = _ram_read,
+	.clear   = _cached_file_clear,
+	.initialize = _cached_file_initialize,
+	.shutdown = _cached_file_shutdown,
+	.wait = px4_sem_wait,
+	.flush = _cached_file_flush,
 };
 
 static const dm_operations_t *g_dm_ops;
@@ -118,6 +147,13 @@ static struct {
 			uint8_t *data_end;
 		} ram;
 	};
+	struct {
+		int fd;
+		unsigned size;
+		uint8_t *dirty; ///< bitmap of DM_CACHE_BLOCK_SIZE blocks not yet written back to the file
+		hrt_abstime dirty_since; ///< time of the oldest change not written back (0 if none)
+		bool mapped; ///< the RAM buffer is a shared memory map of the file
+	} cache;
 	bool running;
 	bool silence = false;
 } dm_operations_data;
@@ -138,6 +174,7 @@ static constexpr size_t g_per_item_size_with_hdr[DM_KEY_NUM_KEYS] = {
 	g_per_item_size[DM_KEY_WAYPOINTS_OFFBOARD_0] + DM_SECTOR_HDR_SIZE,
 	g_per_item_size[DM_KEY_WAYPOINTS_OFFBOARD_1] + DM_SECTOR_HDR_SIZE,
 	g_per_item_size[DM_KEY_MISSION_STATE] + DM_SECTOR_HDR_SIZE,
+	g_per_item_size[DM_KEY_TERRAIN_MAP] + DM_SECTOR_HDR_SIZE,
 	g_per_item_size[DM_KEY_COMPAT] + DM_SECTOR_HDR_SIZE
 };
 
@@ -148,6 +185,12 @@ static uint8_t dataman_clients_count = 1;
 
 static perf_counter_t _dm_read_perf{nullptr};
 static perf_counter_t _dm_write_perf{nullptr};
+static perf_counter_t _dm_flush_perf{nullptr};
+
+/* Write-back of the cached file backend */
+static constexpr unsigned DM_CACHE_BLOCK_SIZE = 64;
+static constexpr hrt_abstime DM_CACHE_FLUSH_IDLE = 100_ms; ///< flush after no further write for this time
+static constexpr hrt_abstime DM_CACHE_FLUSH_MAX_AGE = 1_s; ///< flush at the latest after this time
 
 /* The data manager store file handle and file name */
 static const char *default_device_path = PX4_STORAGEDIR "/dataman";
@@ -157,6 +200,7 @@ static enum {
 	BACKEND_NONE = 0,
 	BACKEND_FILE,
 	BACKEND_RAM,
+	BACKEND_CACHED_FILE,
 	BACKEND_LAST
 } backend = BACKEND_NONE;
 
@@ -559,35 +603,7 @@ _file_initialize(unsigned max_offset)
 	dm_operations_data.silence = false;
 
 	if (!file_existed || (compat_state.key != DM_COMPAT_KEY)) {
-
-		/* Write current compat info */
-		compat_state.key = DM_COMPAT_KEY;
-		int ret = g_dm_ops->write(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state));
-
-		if (ret != sizeof(compat_state)) {
-			PX4_ERR("Failed writing compat: %d", ret);
-		}
-
-		for (uint32_t item = DM_KEY_SAFE_POINTS_0; item <= DM_KEY_MISSION_STATE; ++item) {
-			g_dm_ops->clear((dm_item_t)item);
-		}
-
-		mission_s mission{};
-		mission.timestamp = hrt_absolute_time();
-		mission.mission_dataman_id = DM_KEY_WAYPOINTS_OFFBOARD_0;
-		mission.count = 0;
-		mission.current_seq = 0;
-		mission.mission_id = 0u;
-		mission.geofence_id = 0u;
-		mission.safe_points_id = 0u;
-
-		mission_stats_entry_s stats;
-		stats.num_items = 0;
-		stats.opaque_id = 0;
-
-		g_dm_ops->write(DM_KEY_MISSION_STATE, 0, reinterpret_cast<uint8_t *>(&mission), sizeof(mission_s));
-		g_dm_ops->write(DM_KEY_FENCE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
-		g_dm_ops->write(DM_KEY_SAFE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
+		_reset_storage();
 	}
 
 	dm_operations_data.running = true;
@@ -628,6 +644,258 @@ _ram_shutdown()
 	dm_operations_data.running = false;
 }
 
+/* Mark a range of the cached file as changed */
+static void
+_cached_file_mark_dirty(unsigned offset, unsigned count)
+{
+	for (unsigned block = offset / DM_CACHE_BLOCK_SIZE; block <= (offset + count - 1) / DM_CACHE_BLOCK_SIZE; block++) {
+		dm_operations_data.cache.dirty[block / 8] |= 1 << (block % 8);
+	}
+
+	if (dm_operations_data.cache.dirty_since == 0) {
+		dm_operations_data.cache.dirty_since = hrt_absolute_time();
+	}
+}
+
+/* write to the RAM cache of the data manager file, the file is updated by _cached_file_flush() */
+static ssize_t
+_cached_file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
+{
+	const ssize_t ret = _ram_write(item, index, buf, count);
+
+	if (ret >= 0) {
+		_cached_file_mark_dirty(calculate_offset(item, index), count + DM_SECTOR_HDR_SIZE);
+	}
+
+	return ret;
+}
+
+static int
+_cached_file_clear(dm_item_t item)
+{
+	if (item >= DM_KEY_NUM_KEYS) {
+		return -1;
+	}
+
+	/* Get the offset of 1st item of this type */
+	int offset = calculate_offset(item, 0);
+
+	/* Check for item type out of range */
+	if (offset < 0) {
+		return -1;
+	}
+
+	/* Clear all items of this type, only the changed headers need to be written back */
+	for (int i = 0; (unsigned)i < g_per_item_max_index[item]; i++) {
+		uint8_t *buf = &dm_operations_data.ram.data[offset];
+
+		if (buf > dm_operations_data.ram.data_end) {
+			return -1;
+		}
+
+		if (buf[0]) {
+			buf[0] = 0;
+			_cached_file_mark_dirty(offset, 1);
+		}
+
+		offset += g_per_item_size_with_hdr[item];
+	}
+
+	return 0;
+}
+
+/* Write all changed blocks back to the file, contiguous changes are combined into a single write */
+static void
+_cached_file_flush()
+{
+	if (dm_operations_data.cache.dirty_since == 0) {
+		return;
+	}
+
+	perf_begin(_dm_flush_perf);
+
+	const unsigned num_blocks = (dm_operations_data.cache.size + DM_CACHE_BLOCK_SIZE - 1) / DM_CACHE_BLOCK_SIZE;
+	unsigned block = 0;
+
+	while (block < num_blocks) {
+		if (!(dm_operations_data.cache.dirty[block / 8] & (1 << (block % 8)))) {
+			block++;
+			continue;
+		}
+
+		const unsigned first_block = block;
+
+		while (block < num_blocks && (dm_operations_data.cache.dirty[block / 8] & (1 << (block % 8)))) {
+			dm_operations_data.cache.dirty[block / 8] &= ~(1 << (block % 8));
+			block++;
+		}
+
+		const unsigned offset = first_block * DM_CACHE_BLOCK_SIZE;
+		const unsigned end = math::min(block * DM_CACHE_BLOCK_SIZE, dm_operations_data.cache.size);
+
+#if defined(__PX4_POSIX)
+
+		if (dm_operations_data.cache.mapped) {
+			// msync needs a page aligned start
+			const unsigned page_size = sysconf(_SC_PAGESIZE);
+			const unsigned page_offset = offset - (offset % page_size);
+
+			if (msync(dm_operations_data.ram.data + page_offset, end - page_offset, MS_SYNC) != 0) {
+				PX4_ERR("cache flush msync failed %d", errno);
+			}
+
+			continue;
+		}
+
+#endif // __PX4_POSIX
+
+		if (lseek(dm_operations_data.cache.fd, offset, SEEK_SET) != (off_t)offset
+		    || write(dm_operations_data.cache.fd, dm_operations_data.ram.data + offset, end - offset) != (ssize_t)(end - offset)) {
+			PX4_ERR("cache flush write failed %d", errno);
+		}
+	}
+
+	if (!dm_operations_data.cache.mapped) {
+		/* Make sure data is written to physical media */
+		fsync(dm_operations_data.cache.fd);
+	}
+
+	dm_operations_data.cache.dirty_since = 0;
+
+	perf_end(_dm_flush_perf);
+}
+
+/* Reset the storage after a format change, or create it */
+static void
+_reset_storage()
+{
+	dataman_compat_s compat_state{};
+
+	/* Write current compat info */
+	compat_state.key = DM_COMPAT_KEY;
+	int ret = g_dm_ops->write(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state));
+
+	if (ret != sizeof(compat_state)) {
+		PX4_ERR("Failed writing compat: %d", ret);
+	}
+
+	for (uint32_t item = DM_KEY_SAFE_POINTS_0; item < DM_KEY_COMPAT; ++item) {
+		g_dm_ops->clear((dm_item_t)item);
+	}
+
+	mission_s mission{};
+	mission.timestamp = hrt_absolute_time();
+	mission.mission_dataman_id = DM_KEY_WAYPOINTS_OFFBOARD_0;
+	mission.count = 0;
+	mission.current_seq = 0;
+	mission.mission_id = 0u;
+	mission.geofence_id = 0u;
+	mission.safe_points_id = 0u;
+
+	mission_stats_entry_s stats;
+	stats.num_items = 0;
+	stats.opaque_id = 0;
+
+	g_dm_ops->write(DM_KEY_MISSION_STATE, 0, reinterpret_cast<uint8_t *>(&mission), sizeof(mission_s));
+	g_dm_ops->write(DM_KEY_FENCE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
+	g_dm_ops->write(DM_KEY_SAFE_POINTS_STATE, 0, reinterpret_cast<uint8_t *>(&stats), sizeof(mission_stats_entry_s));
+}
+
+static int
+_cached_file_initialize(unsigned max_offset)
+{
+	const bool file_existed = (access(k_data_manager_device_path, F_OK) == 0);
+
+	/* Open or create the data manager file */
+	dm_operations_data.cache.fd = open(k_data_manager_device_path, O_RDWR | O_CREAT | O_BINARY, PX4_O_MODE_666);
+
+	if (dm_operations_data.cache.fd < 0) {
+		PX4_WARN("Could not open data manager file %s", k_data_manager_device_path);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	dm_operations_data.cache.size = max_offset;
+	dm_operations_data.cache.dirty_since = 0;
+	dm_operations_data.cache.mapped = false;
+	dm_operations_data.ram.data = nullptr;
+
+	const unsigned num_blocks = (max_offset + DM_CACHE_BLOCK_SIZE - 1) / DM_CACHE_BLOCK_SIZE;
+	dm_operations_data.cache.dirty = (uint8_t *)calloc((num_blocks + 7) / 8, 1);
+
+#if defined(__PX4_POSIX)
+
+	/* Map the file, unused space reads as empty items */
+	if (dm_operations_data.cache.dirty && ftruncate(dm_operations_data.cache.fd, max_offset) == 0) {
+		void *data = mmap(nullptr, max_offset, PROT_READ | PROT_WRITE, MAP_SHARED, dm_operations_data.cache.fd, 0);
+
+		if (data != MAP_FAILED) {
+			dm_operations_data.ram.data = (uint8_t *)data;
+			dm_operations_data.cache.mapped = true;
+		}
+	}
+
+#endif // __PX4_POSIX
+
+	if (dm_operations_data.cache.dirty && !dm_operations_data.cache.mapped) {
+		/* Read the whole file into RAM */
+		dm_operations_data.ram.data = (uint8_t *)malloc(max_offset);
+
+		if (dm_operations_data.ram.data) {
+			memset(dm_operations_data.ram.data, 0, max_offset);
+
+			if (lseek(dm_operations_data.cache.fd, 0, SEEK_SET) != 0
+			    || read(dm_operations_data.cache.fd, dm_operations_data.ram.data, max_offset) < 0) {
+				free(dm_operations_data.ram.data);
+				dm_operations_data.ram.data = nullptr;
+			}
+		}
+	}
+
+	if (dm_operations_data.ram.data == nullptr) {
+		PX4_WARN("Could not cache data manager file %s (%u bytes)", k_data_manager_device_path, max_offset);
+		free(dm_operations_data.cache.dirty);
+		close(dm_operations_data.cache.fd);
+		px4_sem_post(&g_init_sema); /* Don't want to hang startup */
+		return -1;
+	}
+
+	dm_operations_data.ram.data_end = &dm_operations_data.ram.data[max_offset - 1];
+
+	dataman_compat_s compat_state{};
+	g_dm_ops->read(DM_KEY_COMPAT, 0, &compat_state, sizeof(compat_state));
+
+	if (!file_existed || (compat_state.key != DM_COMPAT_KEY)) {
+		_reset_storage();
+		_cached_file_flush();
+	}
+
+	dm_operations_data.running = true;
+
+	return 0;
+}
+
+static void
+_cached_file_shutdown()
+{
+	_cached_file_flush();
+
+#if defined(__PX4_POSIX)
+
+	if (dm_operations_data.cache.mapped) {
+		munmap(dm_operations_data.ram.data, dm_operations_data.cache.size);
+
+	} else
+#endif // __PX4_POSIX
+	{
+		free(dm_operations_data.ram.data);
+	}
+
+	free(dm_operations_data.cache.dirty);
+	close(dm_operations_data.cache.fd);
+	dm_operations_data.running = false;
+}
+
 static int
 task_main(int argc, char *argv[])
 {
@@ -641,6 +909,10 @@ task_main(int argc, char *argv[])
 		g_dm_ops = &dm_ram_operations;
 		break;
 
+	case BACKEND_CACHED_FILE:
+		g_dm_ops = &dm_cached_file_operations;
+		break;
+
 	default:
 		PX4_WARN("No valid backend set.");
 		return -1;
@@ -672,6 +944,10 @@ task_main(int argc, char *argv[])
 	_dm_read_perf = perf_alloc(PC_ELAPSED, MODULE_NAME": read");
 	_dm_write_perf = perf_alloc(PC_ELAPSED, MODULE_NAME": write");
 
+	if (g_dm_ops->flush) {
+		_dm_flush_perf = perf_alloc(PC_ELAPSED, MODULE_NAME": flush");
+	}
+
 	int ret = g_dm_ops->initialize(max_offset);
 
 	if (ret) {
@@ -689,6 +965,11 @@ task_main(int argc, char *argv[])
 		PX4_INFO("data manager RAM size is %u bytes", max_offset);
 		break;
 
+	case BACKEND_CACHED_FILE:
+		PX4_INFO("data manager file '%s' size is %u bytes (%s)", k_data_manager_device_path, max_offset,
+			 dm_operations_data.cache.mapped ? "memory mapped" : "RAM cached");
+		break;
+
 	default:
 		break;
 	}
@@ -703,7 +984,13 @@ task_main(int argc, char *argv[])
 	/* Start the endless loop, waiting for then processing work requests */
 	while (true) {
 
-		ret = px4_poll(&fds, 1, 1000);
+		// wake up to write back pending changes once the writes stop
+		const bool flush_pending = g_dm_ops->flush && dm_operations_data.cache.dirty_since != 0;
+		ret = px4_poll(&fds, 1, flush_pending ? DM_CACHE_FLUSH_IDLE / 1000 : 1000);
+
+		if (flush_pending && (ret == 0 || hrt_elapsed_time(&dm_operations_data.cache.dirty_since) > DM_CACHE_FLUSH_MAX_AGE)) {
+			g_dm_ops->flush();
+		}
 
 		if (ret > 0) {
 
@@ -774,6 +1061,35 @@ task_main(int argc, char *argv[])
 
 					break;
 
+				case DM_READ_RANGE: {
+						// Answer every index with its own response, the last one is published below
+						const uint8_t count = math::constrain(request.count, (uint8_t)1, (uint8_t)DM_MAX_READ_RANGE);
+
+						g_func_counts[DM_READ_RANGE]++;
+
+						for (uint8_t i = 0; i < count; i++) {
+							response.index = request.index + i;
+
+							perf_begin(_dm_read_perf);
+							result = g_dm_ops->read(static_cast<dm_item_t>(request.item), response.index,
+										&(response.data), request.data_length);
+							perf_end(_dm_read_perf);
+
+							if (result >= 0) {
+								response.status = dataman_response_s::STATUS_SUCCESS;
+
+							} else {
+								response.status = dataman_response_s::STATUS_FAILURE_READ_FAILED;
+							}
+
+							if (i < count - 1) {
+								response.timestamp = hrt_absolute_time();
+								dataman_response_pub.publish(response);
+							}
+						}
+					}
+					break;
+
 				case DM_CLEAR:
 
 					g_func_counts[DM_CLEAR]++;
@@ -817,6 +1133,9 @@ end:
 	perf_free(_dm_write_perf);
 	_dm_write_perf = nullptr;
 
+	perf_free(_dm_flush_perf);
+	_dm_flush_perf = nullptr;
+
 	return 0;
 }
 
@@ -851,10 +1170,15 @@ status()
 	/* display usage statistics */
 	PX4_INFO("Writes   %u", g_func_counts[DM_WRITE]);
 	PX4_INFO("Reads    %u", g_func_counts[DM_READ]);
+	PX4_INFO("Range reads %u", g_func_counts[DM_READ_RANGE]);
 	PX4_INFO("Clears   %u", g_func_counts[DM_CLEAR]);
 
 	perf_print_counter(_dm_read_perf);
 	perf_print_counter(_dm_write_perf);
+
+	if (_dm_flush_perf) {
+		perf_print_counter(_dm_flush_perf);
+	}
 }
 
 static void
@@ -874,6 +1198,8 @@ Module to provide persistent storage for the rest of the system in form of a sim
 Multiple backends are supported:
 - a file (eg. on the SD card)
 - RAM (this is obviously not persistent)
+- a file cached in RAM (memory mapped on POSIX): writes are batched and written back to the file
+  once no further writes arrive for 100 ms, or at the latest after 1 s
 
 It is used to store structured data of different types: mission waypoints, mission state and geofence polygons.
 Each type has a specific type and a fixed maximum amount of storage items, so that fast random access is possible.
@@ -887,6 +1213,7 @@ Reading and writing a single item is always atomic.
 	PRINT_MODULE_USAGE_COMMAND("start");
 	PRINT_MODULE_USAGE_PARAM_STRING('f', nullptr, "<file>", "Storage file", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('r', "Use RAM backend (NOT persistent)", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('c', "Cache the storage file in RAM and write back changes in batches", true);
 	PRINT_MODULE_USAGE_PARAM_COMMENT("The options -f and -r are mutually exclusive. If nothing is specified, a file 'dataman' is used");
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
 }
@@ -920,10 +1247,11 @@ dataman_main(int argc, char *argv[])
 		int ch;
 		int dmoptind = 1;
 		const char *dmoptarg = nullptr;
+		bool cache_file = false;
 
 		/* jump over start and look at options first */
 
-		while ((ch = px4_getopt(argc, argv, "f:r", &dmoptind, &dmoptarg)) != EOF) {
+		while ((ch = px4_getopt(argc, argv, "f:rc", &dmoptind, &dmoptarg)) != EOF) {
 			switch (ch) {
 			case 'f':
 				if (backend_check()) {
@@ -943,6 +1271,10 @@ dataman_main(int argc, char *argv[])
 				backend = BACKEND_RAM;
 				break;
 
+			case 'c':
+				cache_file = true;
+				break;
+
 			//no break
 			default:
 				usage();
@@ -955,6 +1287,16 @@ dataman_main(int argc, char *argv[])
 			k_data_manager_device_path = strdup(default_device_path);
 		}
 
+		if (cache_file) {
+			if (backend != BACKEND_FILE) {
+				PX4_WARN("-c requires a file backend");
+				usage();
+				return -1;
+			}
+
+			backend = BACKEND_CACHED_FILE;
+		}
+
 		start();
 
 		if (!is_running()) {
@@ -996,4 +1338,6 @@ static_assert(sizeof(dataman_response_s::data) >= MISSION_FENCE_POINT_SIZE, "mis
 static_assert(sizeof(dataman_response_s::data) >= MISSION_ITEM_SIZE, "mission_item_s can't fit in the response data");
 static_assert(sizeof(dataman_response_s::data) >= MISSION_SIZE, "mission_s can't fit in the response data");
 static_assert(sizeof(dataman_response_s::data) >= DATAMAN_COMPAT_SIZE, "dataman_compat_s can't fit in the response data");
+static_assert(sizeof(dataman_response_s::data) >= TERRAIN_MAP_ROW_SIZE, "terrain_map_row_s can't fit in the response data");
 static_assert(sizeof(dataman_response_s::data) >= sizeof(hrt_abstime), "hrt_abstime can't fit in the response data");
+static_assert(dataman_response_s::ORB_QUEUE_LENGTH >= DM_MAX_READ_RANGE, "a range read does not fit in the response queue");
@@ -53,6 +53,7 @@ typedef enum {
 	DM_KEY_WAYPOINTS_OFFBOARD_0,	///< Mission way point coordinates sent over mavlink
 	DM_KEY_WAYPOINTS_OFFBOARD_1,	///< (alternate between 0 and 1)
 	DM_KEY_MISSION_STATE,			///< Persistent mission state
+	DM_KEY_TERRAIN_MAP,			///< Terrain map cache tile rows
 	DM_KEY_COMPAT,
 	DM_KEY_NUM_KEYS					///< Total number of item types defined
 } dm_item_t;
@@ -63,9 +64,13 @@ typedef enum {
 	DM_WRITE,			///< Write index for given item
 	DM_READ,			///< Read index for given item
 	DM_CLEAR,			///< Clear all index for given item
+	DM_READ_RANGE,			///< Read consecutive indexes for given item, one response per index
 	DM_NUMBER_OF_FUNCS
 } dm_function_t;
 
+/** Maximum number of indexes read with a single DM_READ_RANGE request */
+#define DM_MAX_READ_RANGE 8
+
 /** The maximum number of instances for each item type */
 #if defined(MEMORY_CONSTRAINED_SYSTEM)
 enum {
@@ -76,6 +81,7 @@ enum {
 	DM_KEY_WAYPOINTS_OFFBOARD_0_MAX = NUM_MISSIONS_SUPPORTED,
 	DM_KEY_WAYPOINTS_OFFBOARD_1_MAX = NUM_MISSIONS_SUPPORTED,
 	DM_KEY_MISSION_STATE_MAX = 1,
+	DM_KEY_TERRAIN_MAP_MAX = 0,
 	DM_KEY_COMPAT_MAX = 1
 };
 #else
@@ -87,6 +93,7 @@ enum {
 	DM_KEY_WAYPOINTS_OFFBOARD_0_MAX = NUM_MISSIONS_SUPPORTED,
 	DM_KEY_WAYPOINTS_OFFBOARD_1_MAX = NUM_MISSIONS_SUPPORTED,
 	DM_KEY_MISSION_STATE_MAX = 1,
+	DM_KEY_TERRAIN_MAP_MAX = 16 * 16, // TerrainMapCache::NUM_TILES * TerrainMapCache::TILE_CELLS
 	DM_KEY_COMPAT_MAX = 1
 };
 #endif
@@ -102,6 +109,7 @@ static const unsigned g_per_item_max_index[DM_KEY_NUM_KEYS] = {
 	DM_KEY_WAYPOINTS_OFFBOARD_0_MAX,
 	DM_KEY_WAYPOINTS_OFFBOARD_1_MAX,
 	DM_KEY_MISSION_STATE_MAX,
+	DM_KEY_TERRAIN_MAP_MAX,
 	DM_KEY_COMPAT_MAX
 };
 
@@ -115,6 +123,7 @@ constexpr uint32_t MISSION_FENCE_POINT_SIZE = sizeof(struct mission_fence_point_
 constexpr uint32_t MISSION_FENCE_POINT_STATE_SIZE = sizeof(struct mission_stats_entry_s);
 constexpr uint32_t MISSION_ITEM_SIZE = sizeof(struct mission_item_s);
 constexpr uint32_t MISSION_SIZE = sizeof(struct mission_s);
+constexpr uint32_t TERRAIN_MAP_ROW_SIZE = sizeof(struct terrain_map_row_s);
 constexpr uint32_t DATAMAN_COMPAT_SIZE = sizeof(struct dataman_compat_s);
 
 /** The table of the size of each item type */
@@ -128,11 +137,12 @@ static constexpr size_t g_per_item_size[DM_KEY_NUM_KEYS] = {
 	MISSION_ITEM_SIZE,
 	MISSION_ITEM_SIZE,
 	MISSION_SIZE,
+	TERRAIN_MAP_ROW_SIZE,
 	DATAMAN_COMPAT_SIZE
 };
 
 /* increment this define whenever a binary incompatible change is performed */
-#define DM_COMPAT_VERSION	5ULL
+#define DM_COMPAT_VERSION	6ULL
 
 #define DM_COMPAT_KEY ((DM_COMPAT_VERSION << 32) + (sizeof(struct mission_item_s) << 24) + \
 		       (sizeof(struct mission_s) << 16) + (sizeof(struct mission_stats_entry_s) << 12) + \
@@ -93,7 +93,12 @@ public:
 		uint8_t head_new = _head;
 
 		if (!_first_write) {
-			head_new = (_head + 1) % _size;
+			head_new = next(_head);
+
+			if (sample.time_us < _buffer[_head].time_us) {
+				// out of order, fall back to a linear search until the buffer has been emptied
+				_ordered = false;
+			}
 		}
 
 		_buffer[head_new] = sample;
@@ -101,7 +106,7 @@ public:
 
 		// move tail if we overwrite it
 		if (_head == _tail && !_first_write) {
-			_tail = (_tail + 1) % _size;
+			_tail = next(_tail);
 
 		} else {
 			_first_write = false;
@@ -119,38 +124,29 @@ public:
 
 	bool pop_first_older_than(const uint64_t &timestamp, data_type *sample)
 	{
-		// start looking from newest observation data
-		for (uint8_t i = 0; i < _size; i++) {
-			int index = (_head - i);
-			index = index < 0 ? _size + index : index;
+		const int index = _ordered ? findNewestOlderThan(timestamp) : findNewestOlderThanLinear(timestamp);
 
-			if (timestamp >= _buffer[index].time_us && timestamp < _buffer[index].time_us + (uint64_t)1e5) {
-				*sample = _buffer[index];
-
-				// Now we can set the tail to the item which
-				// comes after the one we removed since we don't
-				// want to have any older data in the buffer
-				if (index == _head) {
-					_tail = _head;
-					_first_write = true;
-
-				} else {
-					_tail = (index + 1) % _size;
-				}
+		if (index < 0) {
+			return false;
+		}
 
-				_buffer[index].time_us = 0;
+		*sample = _buffer[index];
 
-				return true;
-			}
+		// Now we can set the tail to the item which
+		// comes after the one we removed since we don't
+		// want to have any older data in the buffer
+		if (index == _head) {
+			_tail = _head;
+			_first_write = true;
+			_ordered = true;
 
-			if (index == _tail) {
-				// we have reached the tail and haven't got a
-				// match
-				return false;
-			}
+		} else {
+			_tail = next(index);
 		}
 
-		return false;
+		_buffer[index].time_us = 0;
+
+		return true;
 	}
 
 	int get_used_size() const { return sizeof(*this) + sizeof(data_type) * entries(); }
@@ -179,10 +175,69 @@ public:
 			_head = 0;
 			_tail = 0;
 			_first_write = true;
+			_ordered = true;
 		}
 	}
 
 private:
+	// ring index arithmetic without division, valid for i < 2 * _size
+	uint8_t wrap(uint16_t i) const { return (i >= _size) ? (i - _size) : i; }
+	uint8_t next(uint8_t i) const { return wrap(i + 1); }
+
+	// binary search for the newest sample not newer than the timestamp (and at most 0.1 s older),
+	// requires the samples to be in chronological order from tail to head
+	int findNewestOlderThan(const uint64_t &timestamp) const
+	{
+		if (_first_write || (timestamp < _buffer[_tail].time_us)) {
+			// empty or all samples are newer
+			return -1;
+		}
+
+		// the sample at the logical index "low" (counted from the tail) is never newer than the timestamp
+		uint8_t low = 0;
+		uint8_t high = (_head >= _tail) ? (_head - _tail) : (_size - _tail + _head);
+
+		while (low < high) {
+			const uint8_t mid = low + (high - low + 1) / 2;
+
+			if (_buffer[wrap(_tail + mid)].time_us <= timestamp) {
+				low = mid;
+
+			} else {
+				high = mid - 1;
+			}
+		}
+
+		const uint8_t index = wrap(_tail + low);
+
+		if (timestamp >= _buffer[index].time_us + (uint64_t)1e5) {
+			return -1;
+		}
+
+		return index;
+	}
+
+	int findNewestOlderThanLinear(const uint64_t &timestamp) const
+	{
+		// start looking from newest observation data
+		for (uint8_t i = 0; i < _size; i++) {
+			int index = (_head - i);
+			index = index < 0 ? _size + index : index;
+
+			if (timestamp >= _buffer[index].time_us && timestamp < _buffer[index].time_us + (uint64_t)1e5) {
+				return index;
+			}
+
+			if (index == _tail) {
+				// we have reached the tail and haven't got a
+				// match
+				return -1;
+			}
+		}
+
+		return -1;
+	}
+
 	data_type *_buffer{nullptr};
 
 	uint8_t _head{0};
@@ -190,6 +245,7 @@ private:
 	uint8_t _size{0};
 
 	bool _first_write{true};
+	bool _ordered{true};
 };
 
 #endif // !EKF_RINGBUFFER_H
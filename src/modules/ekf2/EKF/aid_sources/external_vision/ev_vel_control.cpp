@@ -182,7 +182,24 @@ void Ekf::fuseBodyFrameVelocity(estimator_aid_source3d_s &aid_src, const uint64_
 			      innov_var,				// innovation variance
 			      innovation_gate);				// innovation gate
 
-	if (!aid_src.innovation_rejected) {
+	if (!aid_src.innovation_rejected && _params.vector_fusion) {
+		matrix::Matrix<float, State::size, 3> H_block;
+
+		for (uint8_t index = 0; index <= 2; index++) {
+			H_block.col(index) = H[index];
+		}
+
+		// the innovations of the three body axes are correlated through the attitude and velocity covariance,
+		// a joint update uses the full innovation covariance and replaces three sequential covariance updates
+		if (measurementUpdate(H_block, matrix::diag(measurement_var), innov)) {
+			aid_src.fused = true;
+			aid_src.time_last_fuse = _time_delayed_us;
+
+			_time_last_hor_vel_fuse = _time_delayed_us;
+			_time_last_ver_vel_fuse = _time_delayed_us;
+		}
+
+	} else if (!aid_src.innovation_rejected) {
 		for (uint8_t index = 0; index <= 2; index++) {
 			if (index == 1) {
 				sym::ComputeBodyVelYInnovVar(state_vector, P, measurement_var(index), &aid_src.innovation_variance[index]);
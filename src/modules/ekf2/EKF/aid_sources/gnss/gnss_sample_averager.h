@@ -0,0 +1,218 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file gnss_sample_averager.h
+ * Combines high rate GNSS samples into a single measurement per averaging period.
+ *
+ * The output is the mean of the samples at their mean time of validity, which
+ * keeps it consistent with the EKF delayed time horizon (see the drag specific
+ * force down sampling in the estimator interface). The reported accuracies are
+ * averaged but not reduced, the receiver errors are strongly correlated over
+ * the short averaging period.
+ */
+
+#ifndef EKF_GNSS_SAMPLE_AVERAGER_H
+#define EKF_GNSS_SAMPLE_AVERAGER_H
+
+#include "../../common.h"
+
+#include <mathlib/mathlib.h>
+
+namespace estimator
+{
+
+class GnssSampleAverager
+{
+public:
+	GnssSampleAverager() = default;
+	~GnssSampleAverager() = default;
+
+	// averaging period, 0 passes all samples through
+	void setPeriod(uint32_t period_us)
+	{
+		if (period_us != _period_us) {
+			_period_us = period_us;
+			reset();
+		}
+	}
+
+	uint32_t period() const { return _period_us; }
+
+	void reset() { _count = 0; }
+
+	/*
+	 * Add a new sample
+	 * @return true when a combined sample has been written to out
+	 */
+	bool update(const gnssSample &sample, gnssSample &out)
+	{
+		if (_period_us == 0) {
+			out = sample;
+			return true;
+		}
+
+		if ((_time_last_us != 0) && (sample.time_us > _time_last_us)) {
+			_interval_us = sample.time_us - _time_last_us;
+		}
+
+		if ((_count > 0)
+		    && ((sample.time_us <= _time_last_us) // out of order or duplicate
+			|| (sample.time_us > _time_last_us + _period_us) // data gap
+			|| (sample.fix_type != _first.fix_type))) {
+			// never combine samples across a data gap or a change of the solution type
+			reset();
+		}
+
+		accumulate(sample);
+
+		// output when the next sample is expected to fall outside of the averaging period
+		if ((_count >= kMaxCount) || (_time_last_us + _interval_us >= _first.time_us + _period_us)) {
+			average(out);
+			reset();
+			return true;
+		}
+
+		return false;
+	}
+
+	uint8_t count() const { return _count; }
+
+private:
+	void accumulate(const gnssSample &sample)
+	{
+		if (_count == 0) {
+			_first = sample;
+			_dt_sum_us = 0;
+			_dlat_sum = 0.0;
+			_dlon_sum = 0.0;
+			_dalt_sum = 0.f;
+			_vel_sum.zero();
+			_hacc_sum = 0.f;
+			_vacc_sum = 0.f;
+			_sacc_sum = 0.f;
+			_yaw_sin_sum = 0.f;
+			_yaw_cos_sum = 0.f;
+			_yaw_acc_sum = 0.f;
+			_yaw_count = 0;
+			_nsats_min = sample.nsats;
+			_pdop_max = sample.pdop;
+			_spoofed = false;
+		}
+
+		_time_last_us = sample.time_us;
+
+		_dt_sum_us += sample.time_us - _first.time_us;
+		_dlat_sum += sample.lat - _first.lat;
+		_dlon_sum += matrix::wrap(sample.lon - _first.lon, -180., 180.);
+		_dalt_sum += sample.alt - _first.alt;
+		_vel_sum += sample.vel;
+		_hacc_sum += sample.hacc;
+		_vacc_sum += sample.vacc;
+		_sacc_sum += sample.sacc;
+
+		if (PX4_ISFINITE(sample.yaw)) {
+			_yaw_sin_sum += sinf(sample.yaw);
+			_yaw_cos_sum += cosf(sample.yaw);
+			_yaw_acc_sum += sample.yaw_acc;
+			_yaw_count++;
+		}
+
+		_nsats_min = math::min(_nsats_min, sample.nsats);
+		_pdop_max = math::max(_pdop_max, sample.pdop);
+		_spoofed |= sample.spoofed;
+		_yaw_offset = sample.yaw_offset;
+
+		_count++;
+	}
+
+	void average(gnssSample &out) const
+	{
+		const float n = static_cast<float>(_count);
+
+		out = _first;
+		out.time_us = _first.time_us + _dt_sum_us / _count;
+		out.lat = _first.lat + _dlat_sum / _count;
+		out.lon = matrix::wrap(_first.lon + _dlon_sum / _count, -180., 180.);
+		out.alt = _first.alt + _dalt_sum / n;
+		out.vel = _vel_sum / n;
+		out.hacc = _hacc_sum / n;
+		out.vacc = _vacc_sum / n;
+		out.sacc = _sacc_sum / n;
+		out.nsats = _nsats_min;
+		out.pdop = _pdop_max;
+		out.spoofed = _spoofed;
+		out.yaw_offset = _yaw_offset;
+
+		if (_yaw_count > 0) {
+			out.yaw = atan2f(_yaw_sin_sum, _yaw_cos_sum);
+			out.yaw_acc = _yaw_acc_sum / static_cast<float>(_yaw_count);
+
+		} else {
+			out.yaw = NAN;
+		}
+	}
+
+	static constexpr uint8_t kMaxCount{50};
+
+	uint32_t _period_us{0};
+
+	gnssSample _first{};        ///< first sample of the current period, reference for the sums
+	uint64_t _time_last_us{0};
+	uint64_t _interval_us{0};   ///< latest interval between two samples (us)
+	uint8_t _count{0};
+
+	uint64_t _dt_sum_us{0};
+	double _dlat_sum{0.0};
+	double _dlon_sum{0.0};
+	float _dalt_sum{0.f};
+	Vector3f _vel_sum{};
+	float _hacc_sum{0.f};
+	float _vacc_sum{0.f};
+	float _sacc_sum{0.f};
+
+	float _yaw_sin_sum{0.f};
+	float _yaw_cos_sum{0.f};
+	float _yaw_acc_sum{0.f};
+	uint8_t _yaw_count{0};
+	float _yaw_offset{NAN};
+
+	uint8_t _nsats_min{0};
+	float _pdop_max{0.f};
+	bool _spoofed{false};
+};
+
+} // namespace estimator
+
+#endif // !EKF_GNSS_SAMPLE_AVERAGER_H
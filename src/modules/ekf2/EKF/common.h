@@ -271,6 +271,7 @@ struct parameters {
 	int32_t imu_ctrl{static_cast<int32_t>(ImuCtrl::GyroBias) | static_cast<int32_t>(ImuCtrl::AccelBias)};
 
 	float velocity_limit{100.f};           ///< velocity state limit (m/s)
+	int32_t vector_fusion{0};              ///< fuse multi-axis direct state observations as a single vector update
 
 	// measurement source control
 	int32_t height_sensor_ref{static_cast<int32_t>(HeightSensor::BARO)};
@@ -45,6 +45,8 @@
 
 void Ekf::controlFusionModes(const imuSample &imu_delayed)
 {
+	_cpu_profile.start();
+
 	// Store the status to enable change detection
 	_control_status_prev.value = _control_status.value;
 	_state_reset_count_prev = _state_reset_status.reset_count;
@@ -102,54 +104,69 @@ void Ekf::controlFusionModes(const imuSample &imu_delayed)
 		}
 	}
 
+	controlWarmStartYaw();
+
+	_cpu_profile.lap(CpuProfileStep::Other);
+
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 	// control use of observations for aiding
 	controlMagFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Mag);
 #endif // CONFIG_EKF2_MAGNETOMETER
 
 #if defined(CONFIG_EKF2_OPTICAL_FLOW)
 	controlOpticalFlowFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::OpticalFlow);
 #endif // CONFIG_EKF2_OPTICAL_FLOW
 
 #if defined(CONFIG_EKF2_GNSS)
 	controlGpsFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Gnss);
 #endif // CONFIG_EKF2_GNSS
 
 #if defined(CONFIG_EKF2_AUX_GLOBAL_POSITION) && defined(MODULE_NAME)
 	_aux_global_position.update(*this, imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::AuxGlobalPosition);
 #endif // CONFIG_EKF2_AUX_GLOBAL_POSITION
 
 #if defined(CONFIG_EKF2_AIRSPEED)
 	controlAirDataFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Airspeed);
 #endif // CONFIG_EKF2_AIRSPEED
 
 #if defined(CONFIG_EKF2_SIDESLIP)
 	controlBetaFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Sideslip);
 #endif // CONFIG_EKF2_SIDESLIP
 
 #if defined(CONFIG_EKF2_DRAG_FUSION)
 	controlDragFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Drag);
 #endif // CONFIG_EKF2_DRAG_FUSION
 
 	controlHeightFusion(imu_delayed);
 
 #if defined(CONFIG_EKF2_GRAVITY_FUSION)
 	controlGravityFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Gravity);
 #endif // CONFIG_EKF2_GRAVITY_FUSION
 
 #if defined(CONFIG_EKF2_EXTERNAL_VISION)
 	// Additional data odometry data from an external estimator can be fused.
 	controlExternalVisionFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::ExternalVision);
 #endif // CONFIG_EKF2_EXTERNAL_VISION
 
 #if defined(CONFIG_EKF2_AUXVEL)
 	// Additional horizontal velocity data from an auxiliary sensor can be fused
 	controlAuxVelFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::AuxVel);
 #endif // CONFIG_EKF2_AUXVEL
 
 #if defined(CONFIG_EKF2_TERRAIN)
 	controlTerrainFakeFusion();
 	updateTerrainValidity();
+	_cpu_profile.lap(CpuProfileStep::Terrain);
 #endif // CONFIG_EKF2_TERRAIN
 
 	controlZeroInnovationHeadingUpdate();
@@ -166,4 +183,7 @@ void Ekf::controlFusionModes(const imuSample &imu_delayed)
 
 	// check if we are no longer fusing measurements that directly constrain velocity drift
 	updateDeadReckoningStatus();
+
+	_cpu_profile.lap(CpuProfileStep::Other);
+	_cpu_profile.finish();
 }
@@ -42,7 +42,7 @@
  */
 
 #include "ekf.h"
-#include <ekf_derivation/generated/predict_covariance.h>
+#include "covariance_prediction.h"
 
 #include <math.h>
 #include <mathlib/mathlib.h>
@@ -134,10 +134,8 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 	}
 
 	// calculate variances and upper diagonal covariances for quaternion, velocity, position and gyro bias states
-	P = sym::PredictCovariance(_state.vector(), P,
-				   imu_delayed.delta_vel / imu_delayed.delta_vel_dt, accel_var,
-				   imu_delayed.delta_ang / imu_delayed.delta_ang_dt, gyro_var,
-				   dt);
+	// and their cross covariances with the other states (block-wise equivalent of sym::PredictCovariance)
+	predictCovarianceBlocks(_state, P, imu_delayed.delta_vel / imu_delayed.delta_vel_dt, accel_var, gyro_var, dt);
 
 	// Construct the process noise variance diagonal for those states with a stationary process model
 	// These are kinematic states and their error growth is controlled separately by the IMU noise variances
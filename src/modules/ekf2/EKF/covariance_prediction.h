@@ -0,0 +1,179 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file covariance_prediction.h
+ * Block-wise covariance prediction, exploiting the sparse structure of the
+ * error state transition matrix.
+ */
+
+#ifndef EKF_COVARIANCE_PREDICTION_H
+#define EKF_COVARIANCE_PREDICTION_H
+
+#include <matrix/math.hpp>
+#include <ekf_derivation/generated/state.h>
+
+namespace estimator
+{
+
+// number of states with a kinematic process model, all subsequent states have an identity transition
+static constexpr unsigned kNumKinematicStates = State::accel_bias.idx + State::accel_bias.dof;
+
+/**
+ * Predict the upper triangle of the covariance matrix P, same as sym::PredictCovariance (see derivation.py).
+ *
+ * The error state transition matrix only has non trivial 3x3 blocks in the rows of the orientation,
+ * velocity and position errors:
+ *   theta' = |q|^2 theta - R dt gyro_bias
+ *   vel'   = -[R (accel - accel_bias) dt]x theta + vel - R dt accel_bias
+ *   pos'   = pos + dt vel
+ * The covariance propagation is evaluated with these blocks only. The cross covariances between the kinematic
+ * states and a stationary state (mag, wind, terrain) are only propagated if they are not zero, so decorrelated,
+ * inactive states cost nothing.
+ *
+ * @param state current state
+ * @param P covariance matrix, only the upper triangle is updated
+ * @param accel accelerometer measurement (m/s^2)
+ * @param accel_var accelerometer noise variance
+ * @param gyro_var gyro noise variance
+ * @param dt time step (s)
+ * @return number of stationary states whose cross covariances were propagated
+ */
+inline unsigned predictCovarianceBlocks(const StateSample &state, matrix::SquareMatrix<float, State::size> &P,
+					const matrix::Vector3f &accel, const matrix::Vector3f &accel_var,
+					const float gyro_var, const float dt)
+{
+	using matrix::Matrix3f;
+	using matrix::Vector3f;
+
+	static constexpr unsigned T = State::quat_nominal.idx;
+	static constexpr unsigned V = State::vel.idx;
+	static constexpr unsigned X = State::pos.idx;
+	static constexpr unsigned B = State::gyro_bias.idx;
+	static constexpr unsigned A = State::accel_bias.idx;
+
+	const float q_norm_sq = state.quat_nominal.norm_squared();
+	const matrix::Dcmf R(state.quat_nominal);
+	const Matrix3f R_dt = R * dt;
+	const Matrix3f F_vt = -Vector3f(R * (accel - state.accel_bias) * dt).hat();
+
+	// cross covariances of the stationary states, column by column: P(k, j) = F(k, k) * P(k, j)
+	unsigned num_propagated = 0;
+
+	for (unsigned j = kNumKinematicStates; j < State::size; j++) {
+		bool correlated = false;
+
+		for (unsigned k = 0; k < kNumKinematicStates; k++) {
+			if (fabsf(P(k, j)) > 0.f) {
+				correlated = true;
+				break;
+			}
+		}
+
+		if (!correlated) {
+			continue;
+		}
+
+		const Vector3f P_tj = P.slice<3, 1>(T, j);
+		const Vector3f P_vj = P.slice<3, 1>(V, j);
+
+		P.slice<3, 1>(T, j) = P_tj * q_norm_sq - R_dt * Vector3f(P.slice<3, 1>(B, j));
+		P.slice<3, 1>(V, j) = F_vt * P_tj + P_vj - R_dt * Vector3f(P.slice<3, 1>(A, j));
+		P.slice<3, 1>(X, j) = Vector3f(P.slice<3, 1>(X, j)) + P_vj * dt;
+		num_propagated++;
+	}
+
+	// kinematic block: first FP = F * P for the rows of the orientation, velocity and position errors
+	const Matrix3f P_tt = P.slice<3, 3>(T, T);
+	const Matrix3f P_tv = P.slice<3, 3>(T, V);
+	const Matrix3f P_tx = P.slice<3, 3>(T, X);
+	const Matrix3f P_tb = P.slice<3, 3>(T, B);
+	const Matrix3f P_ta = P.slice<3, 3>(T, A);
+	const Matrix3f P_vv = P.slice<3, 3>(V, V);
+	const Matrix3f P_vx = P.slice<3, 3>(V, X);
+	const Matrix3f P_vb = P.slice<3, 3>(V, B);
+	const Matrix3f P_va = P.slice<3, 3>(V, A);
+	const Matrix3f P_xx = P.slice<3, 3>(X, X);
+	const Matrix3f P_xb = P.slice<3, 3>(X, B);
+	const Matrix3f P_xa = P.slice<3, 3>(X, A);
+	const Matrix3f P_bb = P.slice<3, 3>(B, B);
+	const Matrix3f P_ba = P.slice<3, 3>(B, A);
+	const Matrix3f P_aa = P.slice<3, 3>(A, A);
+
+	// P is symmetric, lower blocks are the transposed upper blocks
+	const Matrix3f FP_tt = P_tt * q_norm_sq - R_dt * P_tb.T();
+	const Matrix3f FP_tv = P_tv * q_norm_sq - R_dt * P_vb.T();
+	const Matrix3f FP_tx = P_tx * q_norm_sq - R_dt * P_xb.T();
+	const Matrix3f FP_tb = P_tb * q_norm_sq - R_dt * P_bb;
+	const Matrix3f FP_ta = P_ta * q_norm_sq - R_dt * P_ba;
+
+	const Matrix3f FP_vt = F_vt * P_tt + P_tv.T() - R_dt * P_ta.T();
+	const Matrix3f FP_vv = F_vt * P_tv + P_vv - R_dt * P_va.T();
+	const Matrix3f FP_vx = F_vt * P_tx + P_vx - R_dt * P_xa.T();
+	const Matrix3f FP_vb = F_vt * P_tb + P_vb - R_dt * P_ba.T();
+	const Matrix3f FP_va = F_vt * P_ta + P_va - R_dt * P_aa;
+
+	const Matrix3f FP_xv = P_vx.T() + P_vv * dt;
+	const Matrix3f FP_xx = P_xx + P_vx * dt;
+	const Matrix3f FP_xb = P_xb + P_vb * dt;
+	const Matrix3f FP_xa = P_xa + P_va * dt;
+
+	// then the upper blocks of FP * F^T, plus the process noise of the gyro and accelerometer
+	Matrix3f R_dt_accel_var = R_dt;
+
+	for (unsigned i = 0; i < 3; i++) {
+		R_dt_accel_var.col(i) = R_dt.col(i) * accel_var(i);
+	}
+
+	P.slice<3, 3>(T, T) = FP_tt * q_norm_sq - FP_tb * R_dt.T() + R_dt * R_dt.T() * gyro_var;
+	P.slice<3, 3>(T, V) = FP_tt * F_vt.T() + FP_tv - FP_ta * R_dt.T();
+	P.slice<3, 3>(T, X) = FP_tx + FP_tv * dt;
+	P.slice<3, 3>(T, B) = FP_tb;
+	P.slice<3, 3>(T, A) = FP_ta;
+
+	P.slice<3, 3>(V, V) = FP_vt * F_vt.T() + FP_vv - FP_va * R_dt.T() + R_dt_accel_var * R_dt.T();
+	P.slice<3, 3>(V, X) = FP_vx + FP_vv * dt;
+	P.slice<3, 3>(V, B) = FP_vb;
+	P.slice<3, 3>(V, A) = FP_va;
+
+	P.slice<3, 3>(X, X) = FP_xx + FP_xv * dt;
+	P.slice<3, 3>(X, B) = FP_xb;
+	P.slice<3, 3>(X, A) = FP_xa;
+
+	return num_propagated;
+}
+
+} // namespace estimator
+
+#endif // !EKF_COVARIANCE_PREDICTION_H
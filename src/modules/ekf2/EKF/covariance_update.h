@@ -0,0 +1,252 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file covariance_update.h
+ * Kernels of the scalar and vector measurement covariance updates
+ */
+
+#ifndef EKF_COVARIANCE_UPDATE_H
+#define EKF_COVARIANCE_UPDATE_H
+
+#include <matrix/math.hpp>
+
+namespace estimator
+{
+
+/**
+ * Compute P * H for a symmetric P and a (usually sparse) observation Jacobian H.
+ * Only the rows of P corresponding to non zero elements of H are accessed; as P is symmetric and stored row major,
+ * these are contiguous in memory.
+ */
+template<size_t N>
+inline matrix::Vector<float, N> covarianceTimesJacobian(const matrix::SquareMatrix<float, N> &P,
+		const matrix::Vector<float, N> &H)
+{
+	matrix::Vector<float, N> PH;
+
+	for (size_t k = 0; k < N; k++) {
+		const float h_k = H(k);
+
+		if (fabsf(h_k) > 0.f) {
+			for (size_t i = 0; i < N; i++) {
+				PH(i) += P(k, i) * h_k;
+			}
+		}
+	}
+
+	return PH;
+}
+
+/**
+ * Joseph stabilized covariance update for a scalar measurement, see "G. J. Bierman. Factorization Methods for
+ * Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
+ *   P = (I - K * H) * P * (I - K * H).T + K * R * K.T
+ *     = P - K * PH.T - PH * K.T + (H.T * P * H + R) * K * K.T
+ * where PH = P * H. The expanded form is symmetric and valid for any gain K (e.g. with zeroed gains of inhibited
+ * states), so only the upper triangle is computed and then mirrored.
+ *
+ * @param P covariance matrix (symmetric)
+ * @param K Kalman gain
+ * @param PH P * H
+ * @param HPH H.T * P * H
+ * @param R observation variance
+ */
+template<size_t N>
+inline void josephCovarianceUpdate(matrix::SquareMatrix<float, N> &P, const matrix::Vector<float, N> &K,
+				   const matrix::Vector<float, N> &PH, const float HPH, const float R)
+{
+	const float innov_var = HPH + R;
+
+	// rows and columns of states with zero gain and zero P * H (eg inhibited and uncorrelated magnetic field or wind
+	// states of a vehicle not using them) are left unchanged, only the covariance of the active states is updated
+	uint8_t active[N];
+	float k[N];
+	float ph[N];
+	size_t n = 0;
+
+	for (size_t i = 0; i < N; i++) {
+		if ((fabsf(K(i)) > 0.f) || (fabsf(PH(i)) > 0.f)) {
+			active[n] = i;
+			k[n] = K(i);
+			ph[n] = PH(i);
+			n++;
+		}
+	}
+
+	for (size_t a = 0; a < n; a++) {
+		const float k_a = k[a];
+		const float ph_a = ph[a];
+		const float k_a_innov_var = k_a * innov_var;
+
+		for (size_t b = a; b < n; b++) {
+			P(active[a], active[b]) += (k_a_innov_var - ph_a) * k[b] - k_a * ph[b];
+		}
+	}
+
+	for (size_t a = 1; a < n; a++) {
+		for (size_t b = 0; b < a; b++) {
+			P(active[a], active[b]) = P(active[b], active[a]);
+		}
+	}
+}
+
+/**
+ * Compute the Kalman gain K = PH * S^-1 of a vector measurement using a Cholesky factorization S = L * L.T
+ * of the innovation covariance S = H.T * P * H + R.
+ *
+ * @param PH P * H
+ * @param S innovation covariance (symmetric)
+ * @param K Kalman gain
+ * @return false if S is not positive definite, K is then left unchanged
+ */
+template<size_t N, size_t M>
+inline bool kalmanGainCholesky(const matrix::Matrix<float, N, M> &PH, const matrix::SquareMatrix<float, M> &S,
+			       matrix::Matrix<float, N, M> &K)
+{
+	matrix::SquareMatrix<float, M> L;
+
+	for (size_t j = 0; j < M; j++) {
+		float diag = S(j, j);
+
+		for (size_t k = 0; k < j; k++) {
+			diag -= L(j, k) * L(j, k);
+		}
+
+		if (!(diag > 0.f)) {
+			return false;
+		}
+
+		L(j, j) = sqrtf(diag);
+
+		for (size_t i = j + 1; i < M; i++) {
+			float sum = S(i, j);
+
+			for (size_t k = 0; k < j; k++) {
+				sum -= L(i, k) * L(j, k);
+			}
+
+			L(i, j) = sum / L(j, j);
+		}
+	}
+
+	// solve K * L * L.T = PH row by row (forward then backward substitution)
+	for (size_t r = 0; r < N; r++) {
+		float y[M];
+
+		for (size_t j = 0; j < M; j++) {
+			float sum = PH(r, j);
+
+			for (size_t k = 0; k < j; k++) {
+				sum -= L(j, k) * y[k];
+			}
+
+			y[j] = sum / L(j, j);
+		}
+
+		for (size_t j = M; j-- > 0;) {
+			float sum = y[j];
+
+			for (size_t k = j + 1; k < M; k++) {
+				sum -= L(k, j) * K(r, k);
+			}
+
+			K(r, j) = sum / L(j, j);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Joseph stabilized covariance update for a vector measurement
+ *   P = (I - K * H) * P * (I - K * H).T + K * R * K.T
+ *     = P - K * PH.T - PH * K.T + K * S * K.T
+ * where PH = P * H and S = H.T * P * H + R. As for the scalar version, this is valid for any gain K and only the upper
+ * triangle is computed, in a single pass over P.
+ *
+ * @param P covariance matrix (symmetric)
+ * @param K Kalman gain
+ * @param PH P * H
+ * @param S innovation covariance (symmetric)
+ */
+template<size_t N, size_t M>
+inline void josephCovarianceUpdate(matrix::SquareMatrix<float, N> &P, const matrix::Matrix<float, N, M> &K,
+				   const matrix::Matrix<float, N, M> &PH, const matrix::SquareMatrix<float, M> &S)
+{
+	const matrix::Matrix<float, N, M> KS = K * S;
+
+	// as for the scalar update, only the states with a non zero gain or P * H are updated
+	uint8_t active[N];
+	size_t n = 0;
+
+	for (size_t i = 0; i < N; i++) {
+		for (size_t m = 0; m < M; m++) {
+			if ((fabsf(K(i, m)) > 0.f) || (fabsf(PH(i, m)) > 0.f)) {
+				active[n++] = i;
+				break;
+			}
+		}
+	}
+
+	for (size_t a = 0; a < n; a++) {
+		const size_t i = active[a];
+		float a_i[M];
+
+		for (size_t m = 0; m < M; m++) {
+			a_i[m] = KS(i, m) - PH(i, m);
+		}
+
+		for (size_t b = a; b < n; b++) {
+			const size_t j = active[b];
+			float sum = 0.f;
+
+			for (size_t m = 0; m < M; m++) {
+				sum += a_i[m] * K(j, m) - K(i, m) * PH(j, m);
+			}
+
+			P(i, j) += sum;
+		}
+	}
+
+	for (size_t a = 1; a < n; a++) {
+		for (size_t b = 0; b < a; b++) {
+			P(active[a], active[b]) = P(active[b], active[a]);
+		}
+	}
+}
+
+} // namespace estimator
+
+#endif // !EKF_COVARIANCE_UPDATE_H
@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file cpu_profile.h
+ * Lightweight CPU time accounting of the fusion control steps.
+ *
+ * Ekf::controlFusionModes() calls start() once, lap() after every step and
+ * finish() at the end, so every step costs a single time stamp. Without
+ * CONFIG_EKF2_CPU_PROFILE all calls compile to nothing.
+ */
+
+#ifndef EKF_CPU_PROFILE_H
+#define EKF_CPU_PROFILE_H
+
+#include <stdint.h>
+
+#if defined(CONFIG_EKF2_CPU_PROFILE) && defined(MODULE_NAME)
+# include <drivers/drv_hrt.h>
+#endif // CONFIG_EKF2_CPU_PROFILE && MODULE_NAME
+
+namespace estimator
+{
+
+// same order as the estimator_cpu_profile STEP_* constants
+enum class CpuProfileStep : uint8_t {
+	Mag = 0,
+	OpticalFlow,
+	Gnss,
+	AuxGlobalPosition,
+	Airspeed,
+	Sideslip,
+	Drag,
+	Baro,
+	GnssHeight,
+	Range,
+	Gravity,
+	ExternalVision,
+	AuxVel,
+	Terrain,
+	Other,
+	Count
+};
+
+class CpuProfile
+{
+public:
+	static constexpr uint8_t NUM_STEPS = static_cast<uint8_t>(CpuProfileStep::Count);
+
+	struct Entry {
+		uint64_t total_us{0};
+		uint32_t max_us{0};
+	};
+
+#if defined(CONFIG_EKF2_CPU_PROFILE) && defined(MODULE_NAME)
+	void start()
+	{
+		_start_us = hrt_absolute_time();
+		_lap_us = _start_us;
+	}
+
+	void lap(CpuProfileStep step)
+	{
+		const hrt_abstime now = hrt_absolute_time();
+		add(_steps[static_cast<uint8_t>(step)], now - _lap_us);
+		_lap_us = now;
+	}
+
+	void finish()
+	{
+		add(_total, _lap_us - _start_us);
+		_update_count++;
+	}
+#else
+	void start() {}
+	void lap(CpuProfileStep) {}
+	void finish() {}
+#endif // CONFIG_EKF2_CPU_PROFILE && MODULE_NAME
+
+	void reset()
+	{
+		for (Entry &entry : _steps) {
+			entry = {};
+		}
+
+		_total = {};
+		_update_count = 0;
+	}
+
+	const Entry &step(CpuProfileStep step) const { return _steps[static_cast<uint8_t>(step)]; }
+	const Entry &total() const { return _total; }
+	uint32_t updateCount() const { return _update_count; }
+
+	static const char *stepName(CpuProfileStep step)
+	{
+		static constexpr const char *names[NUM_STEPS] {
+			"mag", "flow", "gnss", "aux gpos", "airspeed", "sideslip", "drag", "baro",
+			"gnss hgt", "range", "gravity", "ev", "aux vel", "terrain", "other"
+		};
+
+		return (step < CpuProfileStep::Count) ? names[static_cast<uint8_t>(step)] : "unknown";
+	}
+
+private:
+	static void add(Entry &entry, uint64_t elapsed_us)
+	{
+		entry.total_us += elapsed_us;
+
+		if (elapsed_us > entry.max_us) {
+			entry.max_us = static_cast<uint32_t>(elapsed_us);
+		}
+	}
+
+	Entry _steps[NUM_STEPS] {};
+	Entry _total{};
+	uint32_t _update_count{0};
+
+	uint64_t _start_us{0};
+	uint64_t _lap_us{0};
+};
+
+} // namespace estimator
+
+#endif // !EKF_CPU_PROFILE_H
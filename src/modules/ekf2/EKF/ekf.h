@@ -59,6 +59,8 @@
 #include <uORB/topics/estimator_aid_source2d.h>
 #include <uORB/topics/estimator_aid_source3d.h>
 
+#include "cpu_profile.h"
+
 #include "aid_sources/ZeroGyroUpdate.hpp"
 #include "aid_sources/ZeroVelocityUpdate.hpp"
 
@@ -108,6 +110,15 @@ public:
 	// get the terrain variance
 	float getTerrainVariance() const { return P(State::terrain.idx, State::terrain.idx); }
 
+	// terrain altitude AMSL (m) and variance (m^2) known at the current position (e.g. from a terrain map),
+	// used instead of the assumed ground clearance when the terrain state is initialised in air
+	void setTerrainPrior(float terrain_alt, float variance)
+	{
+		_terrain_prior_alt = terrain_alt;
+		_terrain_prior_var = variance;
+		_time_terrain_prior = _time_latest_us;
+	}
+
 #endif // CONFIG_EKF2_TERRAIN
 
 #if defined(CONFIG_EKF2_RANGE_FINDER)
@@ -259,8 +270,20 @@ public:
 	// fuse single direct state measurement (eg NED velocity, NED position, mag earth field, etc)
 	void fuseDirectStateMeasurement(const float innov, const float innov_var, const float R, const int state_index);
 
+	// fuse M direct measurements of consecutive states starting at state_index (eg NED velocity) as a single vector
+	// update, R is the (possibly correlated) observation covariance. Returns false if the innovation covariance
+	// is not positive definite.
+	template<size_t M>
+	bool fuseDirectStateMeasurement(const matrix::Vector<float, M> &innov, const matrix::SquareMatrix<float, M> &R,
+					const int state_index);
+
 	bool measurementUpdate(VectorState &K, const VectorState &H, const float R, const float innovation);
 
+	// fuse a vector measurement with Jacobian H (one column per measurement axis) as a single update
+	template<size_t M>
+	bool measurementUpdate(const matrix::Matrix<float, State::size, M> &H, const matrix::SquareMatrix<float, M> &R,
+			       const matrix::Vector<float, M> &innov);
+
 	// gyro bias
 	const Vector3f &getGyroBias() const { return _state.gyro_bias; } // get the gyroscope bias in rad/s
 	Vector3f getGyroBiasVariance() const { return getStateVariance<State::gyro_bias>(); } // get the gyroscope bias variance in rad/s
@@ -416,6 +439,18 @@ public:
 
 	void updateParameters();
 
+	// yaw from a previous power cycle, used for the yaw alignment if the vehicle is at rest
+	// when the tilt is aligned and the heading isn't going to be aligned by the magnetometer
+	void setWarmStartYaw(float yaw, float yaw_variance)
+	{
+		_warm_start_yaw = yaw;
+		_warm_start_yaw_var = yaw_variance;
+	}
+
+	// CPU time accounting of the fusion control steps (only active with CONFIG_EKF2_CPU_PROFILE)
+	const CpuProfile &cpu_profile() const { return _cpu_profile; }
+	void resetCpuProfile() { _cpu_profile.reset(); }
+
 	friend class AuxGlobalPosition;
 
 private:
@@ -503,6 +538,10 @@ private:
 	// Terrain height state estimation
 	float _last_on_ground_posD{0.0f};	///< last vertical position when the in_air status was false (m)
 
+	float _terrain_prior_alt{0.f};		///< terrain altitude AMSL from setTerrainPrior() (m)
+	float _terrain_prior_var{0.f};		///< variance of _terrain_prior_alt (m^2)
+	uint64_t _time_terrain_prior{0};	///< time of the last setTerrainPrior() (uSec)
+
 	bool _terrain_valid{false};
 #endif // CONFIG_EKF2_TERRAIN
 
@@ -586,6 +625,9 @@ private:
 	AlphaFilter<Vector3f> _accel_lpf{0.1f};	///< filtered accelerometer measurement used to align tilt (m/s/s)
 	AlphaFilter<Vector3f> _gyro_lpf{0.1f};	///< filtered gyro measurement used for alignment excessive movement check (rad/sec)
 
+	float _warm_start_yaw{NAN};		///< yaw from a previous power cycle waiting to be used for the alignment (rad)
+	float _warm_start_yaw_var{0.f};		///< variance of the warm start yaw (rad^2)
+
 #if defined(CONFIG_EKF2_BAROMETER)
 	estimator_aid_source1d_s _aid_src_baro_hgt {};
 
@@ -798,6 +840,11 @@ private:
 	float getMagDeclination();
 #endif // CONFIG_EKF2_MAGNETOMETER
 
+	// Kalman gain from a Cholesky solve of the innovation covariance S, Joseph covariance update and state correction
+	template<size_t M>
+	bool vectorMeasurementUpdate(const matrix::Matrix<float, State::size, M> &PH, const matrix::SquareMatrix<float, M> &S,
+				     const matrix::Vector<float, M> &innov);
+
 	void clearInhibitedStateKalmanGains(VectorState &K) const;
 
 	// limit the diagonal of the covariance matrix
@@ -937,6 +984,9 @@ private:
 
 	void controlZeroInnovationHeadingUpdate();
 
+	// align the yaw to the warm start value if still possible, see setWarmStartYaw()
+	void controlWarmStartYaw();
+
 #if defined(CONFIG_EKF2_AUXVEL)
 	// control fusion of auxiliary velocity observations
 	void controlAuxVelFusion(const imuSample &imu_sample);
@@ -1141,6 +1191,8 @@ private:
 	ZeroGyroUpdate _zero_gyro_update{};
 	ZeroVelocityUpdate _zero_velocity_update{};
 
+	CpuProfile _cpu_profile{};
+
 #if defined(CONFIG_EKF2_AUX_GLOBAL_POSITION) && defined(MODULE_NAME)
 	AuxGlobalPosition _aux_global_position {};
 #endif // CONFIG_EKF2_AUX_GLOBAL_POSITION
@@ -40,6 +40,7 @@
  */
 
 #include "ekf.h"
+#include "covariance_update.h"
 
 #include <mathlib/mathlib.h>
 #include <lib/world_magnetic_model/geo_mag_declination.h>
@@ -1045,41 +1046,77 @@ void Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 	P += KR.multiplyByTranspose(K);
 #else
 	// Efficient implementation of the Joseph stabilized covariance update
-	// Based on "G. J. Bierman. Factorization Methods for Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
-	// P = (I - K * H) * P * (I - K * H).T   + K * R * K.T
-	//   =      P_temp     * (I - H.T * K.T) + K * R * K.T
-	//   =      P_temp - P_temp * H.T * K.T  + K * R * K.T
-
-	// Step 1: conventional update
-	// Compute P_temp and store it in P to avoid allocating more memory
 	// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
-	VectorState PH = P.row(state_index);
+	const VectorState PH = P.row(state_index);
+	josephCovarianceUpdate(P, K, PH, P(state_index, state_index), R);
+#endif
 
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j < State::size; j++) {
-			P(i, j) -= K(i) * PH(j); // P is now not symmetric if K is not optimal (e.g.: some gains have been zeroed)
-		}
+	constrainStateVariances();
+
+	// apply the state corrections
+	fuse(K, innov);
+}
+
+template<size_t M>
+bool Ekf::fuseDirectStateMeasurement(const matrix::Vector<float, M> &innov, const matrix::SquareMatrix<float, M> &R,
+				     const int state_index)
+{
+	// H selects M consecutive states, so PH are columns of P and H.T * P * H is a diagonal block of P
+	const matrix::Matrix<float, State::size, M> PH = P.template slice<State::size, M>(0, state_index);
+	const matrix::SquareMatrix<float, M> S = matrix::SquareMatrix<float, M>(P.template slice<M, M>(state_index,
+			state_index)) + R;
+
+	return vectorMeasurementUpdate(PH, S, innov);
+}
+
+template<size_t M>
+bool Ekf::measurementUpdate(const matrix::Matrix<float, State::size, M> &H, const matrix::SquareMatrix<float, M> &R,
+			    const matrix::Vector<float, M> &innov)
+{
+	matrix::Matrix<float, State::size, M> PH;
+
+	for (size_t m = 0; m < M; m++) {
+		PH.col(m) = covarianceTimesJacobian(P, VectorState(H.col(m)));
 	}
 
-	// Step 2: stabilized update
-	// P (or "P_temp") is not symmetric so we must take the column
-	PH = P.col(state_index);
+	const matrix::SquareMatrix<float, M> S = matrix::SquareMatrix<float, M>(H.transpose() * PH) + R;
 
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j <= i; j++) {
-			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
-			P(j, i) = P(i, j);
-		}
+	return vectorMeasurementUpdate(PH, S, innov);
+}
+
+template<size_t M>
+bool Ekf::vectorMeasurementUpdate(const matrix::Matrix<float, State::size, M> &PH,
+				  const matrix::SquareMatrix<float, M> &S, const matrix::Vector<float, M> &innov)
+{
+	matrix::Matrix<float, State::size, M> K;
+
+	if (!kalmanGainCholesky(PH, S, K)) {
+		return false;
 	}
 
-#endif
+	for (size_t m = 0; m < M; m++) {
+		VectorState K_m = K.col(m);
+		clearInhibitedStateKalmanGains(K_m);
+		K.col(m) = K_m;
+	}
+
+	josephCovarianceUpdate(P, K, PH, S);
 
 	constrainStateVariances();
 
-	// apply the state corrections
-	fuse(K, innov);
+	// apply the state corrections, the correction is linear in K * innov
+	fuse(VectorState(K * innov), 1.f);
+
+	return true;
 }
 
+template bool Ekf::fuseDirectStateMeasurement<2>(const matrix::Vector<float, 2> &, const matrix::SquareMatrix<float, 2> &,
+		const int);
+template bool Ekf::fuseDirectStateMeasurement<3>(const matrix::Vector<float, 3> &, const matrix::SquareMatrix<float, 3> &,
+		const int);
+template bool Ekf::measurementUpdate<3>(const matrix::Matrix<float, State::size, 3> &,
+					const matrix::SquareMatrix<float, 3> &, const matrix::Vector<float, 3> &);
+
 bool Ekf::measurementUpdate(VectorState &K, const VectorState &H, const float R, const float innovation)
 {
 	clearInhibitedStateKalmanGains(K);
@@ -1096,32 +1133,9 @@ bool Ekf::measurementUpdate(VectorState &K, const VectorState &H, const float R,
 	P += KR.multiplyByTranspose(K);
 #else
 	// Efficient implementation of the Joseph stabilized covariance update
-	// Based on "G. J. Bierman. Factorization Methods for Discrete Sequential Estimation. Academic Press, Dover Publications, New York, 1977, 2006"
-	// P = (I - K * H) * P * (I - K * H).T   + K * R * K.T
-	//   =      P_temp     * (I - H.T * K.T) + K * R * K.T
-	//   =      P_temp - P_temp * H.T * K.T  + K * R * K.T
-
-	// Step 1: conventional update
-	// Compute P_temp and store it in P to avoid allocating more memory
-	// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
-	VectorState PH = P * H; // H is stored as a column vector. H is in fact H.T
-
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j < State::size; j++) {
-			P(i, j) -= K(i) * PH(j); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
-		}
-	}
-
-	// Step 2: stabilized update
-	PH = P * H; // H is stored as a column vector. H is in fact H.T
-
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j <= i; j++) {
-			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
-			P(j, i) = P(i, j);
-		}
-	}
-
+	// P is symmetric, so PH == H.T * P.T == H.T * P. H is stored as a column vector. H is in fact H.T
+	const VectorState PH = covarianceTimesJacobian(P, H);
+	josephCovarianceUpdate(P, K, PH, H.dot(PH), R);
 #endif
 
 	constrainStateVariances();
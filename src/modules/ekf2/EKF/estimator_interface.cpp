@@ -77,6 +77,18 @@ EstimatorInterface::~EstimatorInterface()
 
 // Accumulate imu data and store to buffer at desired rate
 void EstimatorInterface::setIMUData(const imuSample &imu_sample)
+{
+	// accumulate and down-sample imu data and push to the buffer when new downsampled data becomes available
+	if (_imu_down_sampler.update(imu_sample)) {
+		const imuSample imu_downsampled = _imu_down_sampler.getDownSampledImuAndTriggerReset();
+		setIMUData(imu_sample, &imu_downsampled);
+
+	} else {
+		setIMUData(imu_sample, nullptr);
+	}
+}
+
+void EstimatorInterface::setIMUData(const imuSample &imu_sample, const imuSample *imu_downsampled_ptr)
 {
 	// TODO: resolve misplaced responsibility
 	if (!_initialised) {
@@ -89,12 +101,12 @@ void EstimatorInterface::setIMUData(const imuSample &imu_sample)
 	_output_predictor.calculateOutputStates(imu_sample.time_us, imu_sample.delta_ang, imu_sample.delta_ang_dt,
 						imu_sample.delta_vel, imu_sample.delta_vel_dt);
 
-	// accumulate and down-sample imu data and push to the buffer when new downsampled data becomes available
-	if (_imu_down_sampler.update(imu_sample)) {
+	// push to the buffer when new downsampled data becomes available
+	if (imu_downsampled_ptr) {
 
 		_imu_updated = true;
 
-		imuSample imu_downsampled = _imu_down_sampler.getDownSampledImuAndTriggerReset();
+		imuSample imu_downsampled = *imu_downsampled_ptr;
 
 		// as a precaution constrain the integration delta time to prevent numerical problems
 		const float filter_update_period_s = _params.filter_update_interval_us * 1e-6f;
@@ -84,6 +84,10 @@ class EstimatorInterface
 public:
 	void setIMUData(const imuSample &imu_sample);
 
+	// set IMU data that has already been down sampled to the filter update rate by the caller (eg shared between
+	// multiple instances using the same IMU), imu_downsampled is nullptr if no new down sampled sample is available
+	void setIMUData(const imuSample &imu_sample, const imuSample *imu_downsampled);
+
 #if defined(CONFIG_EKF2_GNSS)
 	void setGpsData(const gnssSample &gnss_sample);
 
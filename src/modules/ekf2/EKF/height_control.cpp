@@ -40,22 +40,27 @@
 void Ekf::controlHeightFusion(const imuSample &imu_delayed)
 {
 	checkVerticalAccelerationHealth(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Other);
 
 #if defined(CONFIG_EKF2_BAROMETER)
 	updateGroundEffect();
 
 	controlBaroHeightFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Baro);
 #endif // CONFIG_EKF2_BAROMETER
 
 #if defined(CONFIG_EKF2_GNSS)
 	controlGnssHeightFusion(_gps_sample_delayed);
+	_cpu_profile.lap(CpuProfileStep::GnssHeight);
 #endif // CONFIG_EKF2_GNSS
 
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 	controlRangeHaglFusion(imu_delayed);
+	_cpu_profile.lap(CpuProfileStep::Range);
 #endif // CONFIG_EKF2_RANGE_FINDER
 
 	checkHeightSensorRefFallback();
+	_cpu_profile.lap(CpuProfileStep::Other);
 }
 
 void Ekf::checkHeightSensorRefFallback()
@@ -249,6 +249,91 @@ void OutputPredictor::calculateOutputStates(const uint64_t time_us, const Vector
 	_unaided_yaw = matrix::wrap_pi(_unaided_yaw + spin_del_ang_D);
 }
 
+void OutputPredictor::calculateOutputStates(const uint64_t time_us, const Vector3f delta_angle[],
+		const Vector3f delta_velocity[], const uint8_t samples, const float dt)
+{
+	if ((samples == 0) || !(dt > 0.f)) {
+		return;
+	}
+
+	if (_time_last_update_states_us != 0) {
+		const float dt_avg = math::constrain((time_us - _time_last_update_states_us) * 1e-6f / samples, 0.0001f, 0.03f);
+
+		for (uint8_t i = 0; i < samples; i++) {
+			_dt_update_states_avg = 0.8f * _dt_update_states_avg + 0.2f * dt_avg;
+		}
+	}
+
+	_time_last_update_states_us = time_us;
+
+	_output_new.time_us = time_us;
+	_output_vert_new.time_us = time_us;
+
+	// corrections are identical for all samples of the batch
+	const Vector3f delta_angle_bias_scaled = _gyro_bias * dt;
+	const Vector3f delta_angle_offset = _delta_angle_corr - delta_angle_bias_scaled;
+	const Vector3f delta_vel_bias_scaled = _accel_bias * dt;
+	const float delta_vel_gravity = CONSTANTS_ONE_G * dt;
+	const float half_dt = 0.5f * dt;
+
+	Quatf q = _output_new.quat_nominal;
+	Vector3f delta_angle_corrected;
+	Vector3f delta_vel_earth;
+	float spin_del_ang_D = 0.f;
+
+	for (uint8_t i = 0; i < samples; i++) {
+		delta_angle_corrected = delta_angle[i] + delta_angle_offset;
+
+		const float angle_sq = delta_angle_corrected.norm_squared();
+
+		if (angle_sq < 0.01f) {
+			// cos(a/2) and sin(a/2)/a truncated after the a^2 term, the error is below 3e-7 for a < 0.1 rad
+			const float half_sinc = 0.5f - angle_sq * (1.f / 48.f);
+			q = q * Quatf(1.f - angle_sq * 0.125f, delta_angle_corrected(0) * half_sinc,
+				      delta_angle_corrected(1) * half_sinc, delta_angle_corrected(2) * half_sinc);
+
+		} else {
+			q = q * Quatf(AxisAnglef{delta_angle_corrected});
+		}
+
+		// q stays unit length within float precision over a batch, normalisation is done once at the end
+		const Dcmf R(q);
+
+		delta_vel_earth = R * (delta_velocity[i] - delta_vel_bias_scaled);
+
+		// correct for measured acceleration due to gravity
+		delta_vel_earth(2) += delta_vel_gravity;
+
+		// trapezoidal integration of the position
+		const Vector3f vel_last(_output_new.vel);
+		_output_new.vel += delta_vel_earth;
+		_output_vert_new.vert_vel += delta_vel_earth(2);
+
+		const Vector3f delta_pos_NED = (_output_new.vel + vel_last) * half_dt;
+		_output_new.pos += delta_pos_NED;
+		_output_vert_new.vert_vel_integ += delta_pos_NED(2);
+
+		// auxiliary yaw estimate
+		spin_del_ang_D += (delta_angle[i] - delta_angle_bias_scaled).dot(Vector3f(R.row(2)));
+	}
+
+	_output_vert_new.dt += dt * samples;
+
+	q.normalize();
+	_output_new.quat_nominal = q;
+	_R_to_earth_now = Dcmf(q);
+
+	_unaided_yaw = matrix::wrap_pi(_unaided_yaw + spin_del_ang_D);
+
+	if (dt > 0.001f) {
+		// velocity derivative and velocity of the IMU relative to the body origin from the newest sample
+		_vel_deriv = delta_vel_earth / dt;
+
+		const Vector3f ang_rate = delta_angle_corrected / dt;
+		_vel_imu_rel_body_ned = _R_to_earth_now * (ang_rate % _imu_pos_body);
+	}
+}
+
 void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 		const Quatf &quat_state, const Vector3f &vel_state, const LatLonAlt &gpos_state, const matrix::Vector3f &gyro_bias,
 		const matrix::Vector3f &accel_bias)
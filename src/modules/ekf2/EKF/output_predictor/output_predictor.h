@@ -67,6 +67,20 @@ public:
 	void calculateOutputStates(const uint64_t time_us, const matrix::Vector3f &delta_angle, const float delta_angle_dt,
 				   const matrix::Vector3f &delta_velocity, const float delta_velocity_dt);
 
+	/*
+	* Batch version of calculateOutputStates() for a FIFO of IMU samples at a fixed rate (eg a sensor_gyro_fifo chunk).
+	* The bias and tracking corrections are computed once per batch, the delta quaternions use a small angle series
+	* instead of trigonometric functions and the attitude quaternion is only normalised at the end of the batch.
+	*
+	* @param time_us timestamp of the last (newest) sample
+	* @param delta_angle oldest to newest delta angles (rad)
+	* @param delta_velocity oldest to newest delta velocities (m/s)
+	* @param samples number of samples
+	* @param dt sampling interval (s)
+	*/
+	void calculateOutputStates(const uint64_t time_us, const matrix::Vector3f delta_angle[],
+				   const matrix::Vector3f delta_velocity[], const uint8_t samples, const float dt);
+
 	void correctOutputStates(const uint64_t time_delayed_us,
 				 const matrix::Quatf &quat_state, const matrix::Vector3f &vel_state, const LatLonAlt &gpos_state,
 				 const matrix::Vector3f &gyro_bias, const matrix::Vector3f &accel_bias);
@@ -57,15 +57,24 @@ bool Ekf::fuseHorizontalPosition(estimator_aid_source2d_s &aid_src)
 {
 	// x & y
 	if (!aid_src.innovation_rejected) {
-		for (unsigned i = 0; i < 2; i++) {
-			fuseDirectStateMeasurement(aid_src.innovation[i], aid_src.innovation_variance[i], aid_src.observation_variance[i],
-						   State::pos.idx + i);
+		if (_params.vector_fusion) {
+			aid_src.fused = fuseDirectStateMeasurement(Vector2f(aid_src.innovation),
+					matrix::diag(Vector2f(aid_src.observation_variance)), State::pos.idx);
+
+		} else {
+			for (unsigned i = 0; i < 2; i++) {
+				fuseDirectStateMeasurement(aid_src.innovation[i], aid_src.innovation_variance[i], aid_src.observation_variance[i],
+							   State::pos.idx + i);
+			}
+
+			aid_src.fused = true;
 		}
 
-		aid_src.fused = true;
-		aid_src.time_last_fuse = _time_delayed_us;
+		if (aid_src.fused) {
+			aid_src.time_last_fuse = _time_delayed_us;
 
-		_time_last_hor_pos_fuse = _time_delayed_us;
+			_time_last_hor_pos_fuse = _time_delayed_us;
+		}
 
 	} else {
 		aid_src.fused = false;
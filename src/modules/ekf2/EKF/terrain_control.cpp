@@ -42,6 +42,17 @@
 
 void Ekf::initTerrain()
 {
+	const float terrain_prior_hagl = _gpos.altitude() - _terrain_prior_alt;
+
+	if (_control_status.flags.in_air && isRecent(_time_terrain_prior, (uint64_t)1e6)
+	    && PX4_ISFINITE(terrain_prior_hagl) && (terrain_prior_hagl > 0.f)
+	    && (_terrain_prior_var > 0.f)) {
+		// terrain known at this position, e.g. from a previous overflight
+		_state.terrain = -_terrain_prior_alt;
+		P.uncorrelateCovarianceSetVariance<State::terrain.dof>(State::terrain.idx, _terrain_prior_var);
+		return;
+	}
+
 	// assume a ground clearance
 	_state.terrain = -_gpos.altitude() + _params.rng_gnd_clearance;
 
@@ -37,15 +37,24 @@ bool Ekf::fuseHorizontalVelocity(estimator_aid_source2d_s &aid_src)
 {
 	// vx, vy
 	if (!aid_src.innovation_rejected) {
-		for (unsigned i = 0; i < 2; i++) {
-			fuseDirectStateMeasurement(aid_src.innovation[i], aid_src.innovation_variance[i], aid_src.observation_variance[i],
-						   State::vel.idx + i);
+		if (_params.vector_fusion) {
+			aid_src.fused = fuseDirectStateMeasurement(Vector2f(aid_src.innovation),
+					matrix::diag(Vector2f(aid_src.observation_variance)), State::vel.idx);
+
+		} else {
+			for (unsigned i = 0; i < 2; i++) {
+				fuseDirectStateMeasurement(aid_src.innovation[i], aid_src.innovation_variance[i], aid_src.observation_variance[i],
+							   State::vel.idx + i);
+			}
+
+			aid_src.fused = true;
 		}
 
-		aid_src.fused = true;
-		aid_src.time_last_fuse = _time_delayed_us;
+		if (aid_src.fused) {
+			aid_src.time_last_fuse = _time_delayed_us;
 
-		_time_last_hor_vel_fuse = _time_delayed_us;
+			_time_last_hor_vel_fuse = _time_delayed_us;
+		}
 
 	} else {
 		aid_src.fused = false;
@@ -58,16 +67,25 @@ bool Ekf::fuseVelocity(estimator_aid_source3d_s &aid_src)
 {
 	// vx, vy, vz
 	if (!aid_src.innovation_rejected) {
-		for (unsigned i = 0; i < 3; i++) {
-			fuseDirectStateMeasurement(aid_src.innovation[i], aid_src.innovation_variance[i], aid_src.observation_variance[i],
-						   State::vel.idx + i);
+		if (_params.vector_fusion) {
+			aid_src.fused = fuseDirectStateMeasurement(Vector3f(aid_src.innovation),
+					matrix::diag(Vector3f(aid_src.observation_variance)), State::vel.idx);
+
+		} else {
+			for (unsigned i = 0; i < 3; i++) {
+				fuseDirectStateMeasurement(aid_src.innovation[i], aid_src.innovation_variance[i], aid_src.observation_variance[i],
+							   State::vel.idx + i);
+			}
+
+			aid_src.fused = true;
 		}
 
-		aid_src.fused = true;
-		aid_src.time_last_fuse = _time_delayed_us;
+		if (aid_src.fused) {
+			aid_src.time_last_fuse = _time_delayed_us;
 
-		_time_last_hor_vel_fuse = _time_delayed_us;
-		_time_last_ver_vel_fuse = _time_delayed_us;
+			_time_last_hor_vel_fuse = _time_delayed_us;
+			_time_last_ver_vel_fuse = _time_delayed_us;
+		}
 
 	} else {
 		aid_src.fused = false;
@@ -43,7 +43,6 @@
 using matrix::AxisAnglef;
 using matrix::Dcmf;
 using matrix::Eulerf;
-using matrix::Matrix3f;
 using matrix::Quatf;
 using matrix::Vector2f;
 using matrix::Vector3f;
@@ -53,6 +52,10 @@ using math::Utilities::updateYawInRotMat;
 
 EKFGSF_yaw::EKFGSF_yaw()
 {
+	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+		setAhrsRotMat(model_index, matrix::eye<float, 3>());
+	}
+
 	reset();
 }
 
@@ -99,8 +102,23 @@ void EKFGSF_yaw::predict(const matrix::Vector3f &delta_ang, const float delta_an
 		}
 	}
 
+	// generate an attitude reference using IMU data
+	ahrsPredict(delta_ang, delta_ang_dt);
+
+	// we don't start running the EKF part of the algorithm until there are regular velocity observations
+	if (!_ekf_gsf_vel_fuse_started) {
+		return;
+	}
+
+	// delta velocity process noise double if we're not in air
+	const float accel_noise = in_air ? _accel_noise : 2.f * _accel_noise;
+	const float d_vel_var = sq(accel_noise * delta_vel_dt);
+
+	// Use fixed values for delta angle process noise variances
+	const float d_ang_var = sq(_gyro_noise * delta_ang_dt);
+
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
-		predictEKF(model_index, delta_ang, delta_ang_dt, delta_vel, delta_vel_dt, in_air);
+		predictEKF(model_index, delta_ang, delta_vel, d_vel_var, d_ang_var);
 	}
 }
 
@@ -121,9 +139,12 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 	} else {
 		bool bad_update = false;
 
+		// set observation variance from accuracy estimate supplied by GPS and apply a sanity check minimum
+		const float vel_obs_var = sq(fmaxf(vel_accuracy, 0.01f));
+
 		for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
 			// subsequent measurements are fused as direct state observations
-			if (!updateEKF(model_index, vel_NE, vel_accuracy)) {
+			if (!updateEKF(model_index, vel_NE, vel_obs_var)) {
 				bad_update = true;
 			}
 		}
@@ -170,55 +191,113 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 	}
 }
 
-void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt)
+void EKFGSF_yaw::ahrsPredict(const Vector3f &delta_ang, const float delta_ang_dt)
 {
-	// generate attitude solution using simple complementary filter for the selected model
-	const Vector3f ang_rate = delta_ang / fmaxf(delta_ang_dt, 0.001f) - _ahrs_ekf_gsf[model_index].gyro_bias;
-
-	const Dcmf R_to_body = _ahrs_ekf_gsf[model_index].R.transpose();
-	const Vector3f gravity_direction_bf = R_to_body.col(2);
-
-	const float ahrs_accel_norm = _ahrs_accel.norm();
+	// generate attitude solutions using simple complementary filters, the terms independent of the model are
+	// computed once for the whole bank
+	const float dt_inv = 1.f / fmaxf(delta_ang_dt, 0.001f);
 
 	// gain from accel vector tilt error to rate gyro correction used by AHRS calculation
 	const float ahrs_accel_fusion_gain = ahrsCalcAccelGain();
+	const float tilt_gain = (ahrs_accel_fusion_gain > 0.f) ? ahrs_accel_fusion_gain / _ahrs_accel.norm() : 0.f;
 
-	// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away from 1 g (reduces drift when vehicle picked up and moved).
 	// During fixed wing flight, compensate for centripetal acceleration assuming coordinated turns and X axis forward
-	Vector3f tilt_correction{};
-
-	if (ahrs_accel_fusion_gain > 0.f) {
+	const float true_airspeed = (PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON)) ? _true_airspeed : 0.f;
 
-		Vector3f accel = _ahrs_accel;
+	constexpr float gyro_bias_limit = 0.05f;
+	const float gyro_bias_gain = _gyro_bias_gain * delta_ang_dt;
+	const float spin_rate_max_sq = sq(math::radians(10.f));
+
+	for (uint8_t m = 0; m < N_MODELS_EKFGSF; m++) {
+		float bias_x = _ahrs_gyro_bias[0][m];
+		float bias_y = _ahrs_gyro_bias[1][m];
+		float bias_z = _ahrs_gyro_bias[2][m];
+
+		const float rate_x = delta_ang(0) * dt_inv - bias_x;
+		const float rate_y = delta_ang(1) * dt_inv - bias_y;
+		const float rate_z = delta_ang(2) * dt_inv - bias_z;
+
+		// gravity direction in body frame is the last row of the body to earth frame rotation matrix
+		const float grav_x = _ahrs_R[2][0][m];
+		const float grav_y = _ahrs_R[2][1][m];
+		const float grav_z = _ahrs_R[2][2][m];
+
+		// correct measured accel for the body frame centripetal acceleration, with the assumption that the
+		// X axis is aligned with the airspeed vector (cross product of body rate and body frame airspeed vector)
+		const float accel_x = _ahrs_accel(0);
+		const float accel_y = _ahrs_accel(1) - true_airspeed * rate_z;
+		const float accel_z = _ahrs_accel(2) + true_airspeed * rate_y;
+
+		// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away
+		// from 1 g (reduces drift when vehicle picked up and moved).
+		const float tilt_corr_x = (grav_y * accel_z - grav_z * accel_y) * tilt_gain;
+		const float tilt_corr_y = (grav_z * accel_x - grav_x * accel_z) * tilt_gain;
+		const float tilt_corr_z = (grav_x * accel_y - grav_y * accel_x) * tilt_gain;
+
+		// Gyro bias estimation
+		if ((sq(rate_x) + sq(rate_y) + sq(rate_z)) < spin_rate_max_sq) {
+			bias_x = math::constrain(bias_x - tilt_corr_x * gyro_bias_gain, -gyro_bias_limit, gyro_bias_limit);
+			bias_y = math::constrain(bias_y - tilt_corr_y * gyro_bias_gain, -gyro_bias_limit, gyro_bias_limit);
+			bias_z = math::constrain(bias_z - tilt_corr_z * gyro_bias_gain, -gyro_bias_limit, gyro_bias_limit);
+
+			_ahrs_gyro_bias[0][m] = bias_x;
+			_ahrs_gyro_bias[1][m] = bias_y;
+			_ahrs_gyro_bias[2][m] = bias_z;
+		}
 
-		if (PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON)) {
-			// Calculate body frame centripetal acceleration with assumption X axis is aligned with the airspeed vector
-			// Use cross product of body rate and body frame airspeed vector
-			const Vector3f centripetal_accel_bf = Vector3f(0.0f, _true_airspeed * ang_rate(2), - _true_airspeed * ang_rate(1));
+		// delta angle from previous to current frame
+		const float g_x = delta_ang(0) + (tilt_corr_x - bias_x) * delta_ang_dt;
+		const float g_y = delta_ang(1) + (tilt_corr_y - bias_y) * delta_ang_dt;
+		const float g_z = delta_ang(2) + (tilt_corr_z - bias_z) * delta_ang_dt;
+
+		// Efficient propagation of the delta angle applied to the body to earth frame rotation matrix
+		for (uint8_t r = 0; r < 3; r++) {
+			const float R_r0 = _ahrs_R[r][0][m];
+			const float R_r1 = _ahrs_R[r][1][m];
+			const float R_r2 = _ahrs_R[r][2][m];
+
+			float row_0 = R_r0 + R_r1 * g_z - R_r2 * g_y;
+			float row_1 = R_r1 + R_r2 * g_x - R_r0 * g_z;
+			float row_2 = R_r2 + R_r0 * g_y - R_r1 * g_x;
+
+			// Renormalise rows
+			const float row_length_sq = sq(row_0) + sq(row_1) + sq(row_2);
+
+			if (row_length_sq > FLT_EPSILON) {
+				// Use linear approximation for inverse sqrt taking advantage of the row length being close to 1.0
+				const float row_length_inv = 1.5f - 0.5f * row_length_sq;
+				row_0 *= row_length_inv;
+				row_1 *= row_length_inv;
+				row_2 *= row_length_inv;
+			}
 
-			// correct measured accel for centripetal acceleration
-			accel -= centripetal_accel_bf;
+			_ahrs_R[r][0][m] = row_0;
+			_ahrs_R[r][1][m] = row_1;
+			_ahrs_R[r][2][m] = row_2;
 		}
-
-		tilt_correction = (gravity_direction_bf % accel) * ahrs_accel_fusion_gain / ahrs_accel_norm;
 	}
+}
 
-	// Gyro bias estimation
-	constexpr float gyro_bias_limit = 0.05f;
-	const float spin_rate = ang_rate.length();
+Dcmf EKFGSF_yaw::getAhrsRotMat(const uint8_t model_index) const
+{
+	Dcmf R;
 
-	if (spin_rate < math::radians(10.f)) {
-		_ahrs_ekf_gsf[model_index].gyro_bias -= tilt_correction * (_gyro_bias_gain * delta_ang_dt);
-		_ahrs_ekf_gsf[model_index].gyro_bias = matrix::constrain(_ahrs_ekf_gsf[model_index].gyro_bias,
-						       -gyro_bias_limit, gyro_bias_limit);
+	for (uint8_t r = 0; r < 3; r++) {
+		for (uint8_t c = 0; c < 3; c++) {
+			R(r, c) = _ahrs_R[r][c][model_index];
+		}
 	}
 
-	// delta angle from previous to current frame
-	const Vector3f delta_angle_corrected = delta_ang
-					       + (tilt_correction - _ahrs_ekf_gsf[model_index].gyro_bias) * delta_ang_dt;
+	return R;
+}
 
-	// Apply delta angle to rotation matrix
-	_ahrs_ekf_gsf[model_index].R = ahrsPredictRotMat(_ahrs_ekf_gsf[model_index].R, delta_angle_corrected);
+void EKFGSF_yaw::setAhrsRotMat(const uint8_t model_index, const Dcmf &R)
+{
+	for (uint8_t r = 0; r < 3; r++) {
+		for (uint8_t c = 0; c < 3; c++) {
+			_ahrs_R[r][c][model_index] = R(r, c);
+		}
+	}
 }
 
 void EKFGSF_yaw::ahrsAlignTilt(const Vector3f &delta_vel)
@@ -249,7 +328,7 @@ void EKFGSF_yaw::ahrsAlignTilt(const Vector3f &delta_vel)
 	R.setRow(2, down_in_bf);
 
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-		_ahrs_ekf_gsf[model_index].R = R;
+		setAhrsRotMat(model_index, R);
 	}
 }
 
@@ -259,39 +338,25 @@ void EKFGSF_yaw::ahrsAlignYaw()
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
 
 		const float yaw = wrap_pi(_ekf_gsf[model_index].X(2));
-		const Dcmf R = _ahrs_ekf_gsf[model_index].R;
-		_ahrs_ekf_gsf[model_index].R = updateYawInRotMat(yaw, R);
+		setAhrsRotMat(model_index, updateYawInRotMat(yaw, getAhrsRotMat(model_index)));
 	}
 }
 
-void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt,
-			    const Vector3f &delta_vel, const float delta_vel_dt, bool in_air)
+void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang, const Vector3f &delta_vel,
+			    const float d_vel_var, const float d_ang_var)
 {
-	// generate an attitude reference using IMU data
-	ahrsPredict(model_index, delta_ang, delta_ang_dt);
-
-	// we don't start running the EKF part of the algorithm until there are regular velocity observations
-	if (!_ekf_gsf_vel_fuse_started) {
-		return;
-	}
+	const Dcmf R = getAhrsRotMat(model_index);
 
 	// Calculate the yaw state using a projection onto the horizontal that avoids gimbal lock
-	_ekf_gsf[model_index].X(2) = getEulerYaw(_ahrs_ekf_gsf[model_index].R);
+	_ekf_gsf[model_index].X(2) = getEulerYaw(R);
 
 	// calculate delta velocity in a horizontal front-right frame
-	const Vector3f del_vel_NED = _ahrs_ekf_gsf[model_index].R * delta_vel;
+	const Vector3f del_vel_NED = R * delta_vel;
 	const float cos_yaw = cosf(_ekf_gsf[model_index].X(2));
 	const float sin_yaw = sinf(_ekf_gsf[model_index].X(2));
 	const float dvx =   del_vel_NED(0) * cos_yaw + del_vel_NED(1) * sin_yaw;
 	const float dvy = - del_vel_NED(0) * sin_yaw + del_vel_NED(1) * cos_yaw;
-	const float daz = Vector3f(_ahrs_ekf_gsf[model_index].R * delta_ang)(2);
-
-	// delta velocity process noise double if we're not in air
-	const float accel_noise = in_air ? _accel_noise : 2.f * _accel_noise;
-	const float d_vel_var = sq(accel_noise * delta_vel_dt);
-
-	// Use fixed values for delta angle process noise variances
-	const float d_ang_var = sq(_gyro_noise * delta_ang_dt);
+	const float daz = Vector3f(R * delta_ang)(2);
 
 	_ekf_gsf[model_index].P = sym::YawEstPredictCovariance(_ekf_gsf[model_index].X, _ekf_gsf[model_index].P, Vector2f(dvx,
 				  dvy), d_vel_var, daz, d_ang_var);
@@ -313,11 +378,8 @@ void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang
 	_ekf_gsf[model_index].X(1) += del_vel_NED(1);
 }
 
-bool EKFGSF_yaw::updateEKF(const uint8_t model_index, const Vector2f &vel_NE, const float vel_accuracy)
+bool EKFGSF_yaw::updateEKF(const uint8_t model_index, const Vector2f &vel_NE, const float vel_obs_var)
 {
-	// set observation variance from accuracy estimate supplied by GPS and apply a sanity check minimum
-	const float vel_obs_var = sq(fmaxf(vel_accuracy, 0.01f));
-
 	// calculate velocity observation innovations
 	_ekf_gsf[model_index].innov(0) = _ekf_gsf[model_index].X(0) - vel_NE(0);
 	_ekf_gsf[model_index].innov(1) = _ekf_gsf[model_index].X(1) - vel_NE(1);
@@ -371,16 +433,14 @@ bool EKFGSF_yaw::updateEKF(const uint8_t model_index, const Vector2f &vel_NE, co
 	// take advantage of sparseness in the yaw rotation matrix
 	const float cosYaw = cosf(yawDelta);
 	const float sinYaw = sinf(yawDelta);
-	const float R_prev00 = _ahrs_ekf_gsf[model_index].R(0, 0);
-	const float R_prev01 = _ahrs_ekf_gsf[model_index].R(0, 1);
-	const float R_prev02 = _ahrs_ekf_gsf[model_index].R(0, 2);
 
-	_ahrs_ekf_gsf[model_index].R(0, 0) = R_prev00 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 0) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(0, 1) = R_prev01 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 1) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(0, 2) = R_prev02 * cosYaw - _ahrs_ekf_gsf[model_index].R(1, 2) * sinYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 0) = R_prev00 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 0) * cosYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 1) = R_prev01 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 1) * cosYaw;
-	_ahrs_ekf_gsf[model_index].R(1, 2) = R_prev02 * sinYaw + _ahrs_ekf_gsf[model_index].R(1, 2) * cosYaw;
+	for (uint8_t c = 0; c < 3; c++) {
+		const float R_prev0c = _ahrs_R[0][c][model_index];
+		const float R_prev1c = _ahrs_R[1][c][model_index];
+
+		_ahrs_R[0][c][model_index] = R_prev0c * cosYaw - R_prev1c * sinYaw;
+		_ahrs_R[1][c][model_index] = R_prev0c * sinYaw + R_prev1c * cosYaw;
+	}
 
 	return true;
 }
@@ -456,30 +516,3 @@ float EKFGSF_yaw::ahrsCalcAccelGain() const
 	const float delta_accel_g = (ahrs_accel_norm - CONSTANTS_ONE_G) / CONSTANTS_ONE_G;
 	return _tilt_gain * sq(1.f - math::min(attenuation * fabsf(delta_accel_g), 1.f));
 }
-
-Matrix3f EKFGSF_yaw::ahrsPredictRotMat(const Matrix3f &R, const Vector3f &g)
-{
-	Matrix3f ret = R;
-	ret(0, 0) += R(0, 1) * g(2) - R(0, 2) * g(1);
-	ret(0, 1) += R(0, 2) * g(0) - R(0, 0) * g(2);
-	ret(0, 2) += R(0, 0) * g(1) - R(0, 1) * g(0);
-	ret(1, 0) += R(1, 1) * g(2) - R(1, 2) * g(1);
-	ret(1, 1) += R(1, 2) * g(0) - R(1, 0) * g(2);
-	ret(1, 2) += R(1, 0) * g(1) - R(1, 1) * g(0);
-	ret(2, 0) += R(2, 1) * g(2) - R(2, 2) * g(1);
-	ret(2, 1) += R(2, 2) * g(0) - R(2, 0) * g(2);
-	ret(2, 2) += R(2, 0) * g(1) - R(2, 1) * g(0);
-
-	// Renormalise rows
-	for (uint8_t r = 0; r < 3; r++) {
-		const float rowLengthSq = ret.row(r).norm_squared();
-
-		if (rowLengthSq > FLT_EPSILON) {
-			// Use linear approximation for inverse sqrt taking advantage of the row length being close to 1.0
-			const float rowLengthInv = 1.5f - 0.5f * rowLengthSq;
-			ret.row(r) *= rowLengthInv;
-		}
-	}
-
-	return ret;
-}
@@ -37,7 +37,11 @@
 #include <lib/mathlib/mathlib.h>
 #include <lib/matrix/matrix/math.hpp>
 
+#if defined(CONFIG_EKF2_GSF_MODELS)
+static constexpr uint8_t N_MODELS_EKFGSF = CONFIG_EKF2_GSF_MODELS;
+#else
 static constexpr uint8_t N_MODELS_EKFGSF = 5;
+#endif // CONFIG_EKF2_GSF_MODELS
 
 class EKFGSF_yaw
 {
@@ -61,8 +65,10 @@ public:
 		// uncorrected rate gyro bias error about the gravity vector
 		if (!_ahrs_ekf_gsf_tilt_aligned || !_ekf_gsf_vel_fuse_started || force) {
 			// init gyro bias for each model
-			for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
-				_ahrs_ekf_gsf[model_index].gyro_bias = imu_gyro_bias;
+			for (uint8_t axis = 0; axis < 3; axis++) {
+				for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index++) {
+					_ahrs_gyro_bias[axis][model_index] = imu_gyro_bias(axis);
+				}
 			}
 		}
 	}
@@ -93,10 +99,10 @@ private:
 	// Declarations used by the bank of N_MODELS_EKFGSF AHRS complementary filters
 	float _true_airspeed{NAN};	// true airspeed used for centripetal accel compensation (m/s)
 
-	struct {
-		matrix::Dcmf R{matrix::eye<float, 3>()}; // matrix that rotates a vector from body to earth frame
-		matrix::Vector3f gyro_bias{};            // gyro bias learned and used by the quaternion calculation
-	} _ahrs_ekf_gsf[N_MODELS_EKFGSF] {};
+	// The AHRS bank is stored as structure of arrays (model index last) so that the loops over the models
+	// in ahrsPredict() operate on contiguous data and can be vectorised
+	float _ahrs_R[3][3][N_MODELS_EKFGSF] {};       // matrices that rotate a vector from body to earth frame
+	float _ahrs_gyro_bias[3][N_MODELS_EKFGSF] {};  // gyro biases learned and used by the rotation matrix calculation
 
 	bool _ahrs_ekf_gsf_tilt_aligned{false};  // true the initial tilt alignment has been calculated
 	matrix::Vector3f _ahrs_accel{0.f, 0.f, 0.f};     // low pass filtered body frame specific force vector used by AHRS calculation (m/s/s)
@@ -104,8 +110,11 @@ private:
 	// calculate the gain from gravity vector misalingment to tilt correction to be used by all AHRS filters
 	float ahrsCalcAccelGain() const;
 
-	// update specified AHRS rotation matrix using IMU and optionally true airspeed data
-	void ahrsPredict(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt);
+	// update all AHRS rotation matrices using IMU and optionally true airspeed data
+	void ahrsPredict(const matrix::Vector3f &delta_ang, const float delta_ang_dt);
+
+	matrix::Dcmf getAhrsRotMat(const uint8_t model_index) const;
+	void setAhrsRotMat(const uint8_t model_index, const matrix::Dcmf &R);
 
 	// align all AHRS roll and pitch orientations using IMU delta velocity vector
 	void ahrsAlignTilt(const matrix::Vector3f &delta_vel);
@@ -113,9 +122,6 @@ private:
 	// align all AHRS yaw orientations to initial values
 	void ahrsAlignYaw();
 
-	// Efficient propagation of a delta angle in body frame applied to the body to earth frame rotation matrix
-	matrix::Matrix3f ahrsPredictRotMat(const matrix::Matrix3f &R, const matrix::Vector3f &g);
-
 	// Declarations used by a bank of N_MODELS_EKFGSF EKFs
 
 	struct {
@@ -132,12 +138,12 @@ private:
 	void initialiseEKFGSF(const matrix::Vector2f &vel_NE, const float vel_accuracy);
 
 	// predict state and covariance for the specified EKF using inertial data
-	void predictEKF(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt,
-			const matrix::Vector3f &delta_vel, const float delta_vel_dt, bool in_air = false);
+	void predictEKF(const uint8_t model_index, const matrix::Vector3f &delta_ang, const matrix::Vector3f &delta_vel,
+			const float d_vel_var, const float d_ang_var);
 
 	// update state and covariance for the specified EKF using a NE velocity measurement
 	// return false if update failed
-	bool updateEKF(const uint8_t model_index, const matrix::Vector2f &vel_NE, const float vel_accuracy);
+	bool updateEKF(const uint8_t model_index, const matrix::Vector2f &vel_NE, const float vel_obs_var);
 
 	inline float sq(float x) const { return x * x; };
 
@@ -163,3 +163,37 @@ void Ekf::resetQuatStateYaw(float yaw, float yaw_variance)
 
 	_time_last_heading_fuse = _time_delayed_us;
 }
+
+void Ekf::controlWarmStartYaw()
+{
+	if (!PX4_ISFINITE(_warm_start_yaw)) {
+		return;
+	}
+
+	if (_control_status.flags.yaw_align || _control_status.flags.in_air) {
+		// already aligned by another source or the vehicle may have moved
+		_warm_start_yaw = NAN;
+		return;
+	}
+
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+
+	if ((_params.mag_fusion_type != MagFuseType::NONE) && (_mag_buffer != nullptr)) {
+		// the magnetometer aligns the heading (and would conflict with a wrong warm start value)
+		_warm_start_yaw = NAN;
+		return;
+	}
+
+#endif // CONFIG_EKF2_MAGNETOMETER
+
+	if (!_control_status.flags.tilt_align || !_control_status.flags.vehicle_at_rest) {
+		return;
+	}
+
+	ECL_INFO("yaw warm start %.3f -> %.3f rad", (double)getEulerYaw(_R_to_earth), (double)_warm_start_yaw);
+
+	resetQuatStateYaw(_warm_start_yaw, _warm_start_yaw_var);
+	_control_status.flags.yaw_align = true;
+
+	_warm_start_yaw = NAN;
+}
@@ -67,6 +67,7 @@ EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
 	_param_ekf2_delay_max(_params->delay_max_ms),
 	_param_ekf2_imu_ctrl(_params->imu_ctrl),
 	_param_ekf2_vel_lim(_params->velocity_limit),
+	_param_ekf2_vec_fuse(_params->vector_fusion),
 #if defined(CONFIG_EKF2_AUXVEL)
 	_param_ekf2_avel_delay(_params->auxvel_delay_ms),
 #endif // CONFIG_EKF2_AUXVEL
@@ -384,6 +385,7 @@ void EKF2::AdvertiseTopics()
 bool EKF2::multi_init(int imu, int mag)
 {
 	bool changed_instance = _vehicle_imu_sub.ChangeInstance(imu);
+	_imu_front_end = EKF2ImuFrontEnd::get(imu);
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 
@@ -423,6 +425,25 @@ int EKF2::print_status(bool verbose)
 	perf_print_counter(_msg_missed_imu_perf);
 
 	if (verbose) {
+#if defined(CONFIG_EKF2_CPU_PROFILE)
+
+		if (_cpu_profile.update_count > 0) {
+			PX4_INFO_RAW("fusion CPU time over %.1fs, %" PRIu32 " updates: mean %.1fus, max %" PRIu32 "us\n",
+				     (double)(_cpu_profile.window_us * 1e-6f), _cpu_profile.update_count,
+				     (double)_cpu_profile.total_mean_us, _cpu_profile.total_max_us);
+
+			for (uint8_t i = 0; i < estimator_cpu_profile_s::STEP_COUNT; i++) {
+				if (_cpu_profile.max_us[i] > 0) {
+					PX4_INFO_RAW("  %-9s mean %6.2fus (%4.1f%%), max %4" PRIu32 "us\n",
+						     CpuProfile::stepName(static_cast<CpuProfileStep>(i)),
+						     (double)_cpu_profile.mean_us[i],
+						     (double)(100.f * _cpu_profile.mean_us[i] / fmaxf(_cpu_profile.total_mean_us, 1e-3f)),
+						     _cpu_profile.max_us[i]);
+				}
+			}
+		}
+
+#endif // CONFIG_EKF2_CPU_PROFILE
 #if defined(CONFIG_EKF2_VERBOSE_STATUS)
 		_ekf.print_status();
 #endif // CONFIG_EKF2_VERBOSE_STATUS
@@ -456,6 +477,7 @@ void EKF2::Run()
 
 #if defined(CONFIG_EKF2_GNSS)
 		_ekf.set_min_required_gps_health_time(_param_ekf2_req_gps_h.get() * 1_s);
+		_gnss_sample_averager.setPeriod(static_cast<uint32_t>(math::max(_param_ekf2_gps_avg.get(), 0.f) * 1000.f));
 #endif // CONFIG_EKF2_GNSS
 
 		const matrix::Vector3f imu_pos_body(_param_ekf2_imu_pos_x.get(),
@@ -476,6 +498,16 @@ void EKF2::Run()
 #endif // CONFIG_EKF2_AIRSPEED
 
 		_ekf.updateParameters();
+
+		if (!_warm_start_loaded) {
+			// yaw saved at rest on ground before the last power down
+			if (_param_ekf2_ws_en.get() && (_param_ekf2_ws_yaw_var.get() > 0.f)
+			    && PX4_ISFINITE(_param_ekf2_ws_yaw.get())) {
+				_ekf.setWarmStartYaw(math::radians(_param_ekf2_ws_yaw.get()), _param_ekf2_ws_yaw_var.get());
+			}
+
+			_warm_start_loaded = true;
+		}
 	}
 
 	if (!_callback_registered) {
@@ -728,7 +760,28 @@ void EKF2::Run()
 		const hrt_abstime now = imu_sample_new.time_us;
 
 		// push imu data into estimator
-		_ekf.setIMUData(imu_sample_new);
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+		if (_imu_front_end) {
+			imuSample imu_downsampled;
+			const int ret = _imu_front_end->update(imu_sample_new, _params->filter_update_interval_us, imu_downsampled);
+
+			if (ret >= 0) {
+				_ekf.setIMUData(imu_sample_new, (ret > 0) ? &imu_downsampled : nullptr);
+
+			} else {
+				// fallen too far behind the other instances, continue with the own down sampler
+				PX4_WARN("%d - shared IMU down sampling lost, using own", _instance);
+				_imu_front_end = nullptr;
+				_ekf.setIMUData(imu_sample_new);
+			}
+
+		} else
+#endif // CONFIG_EKF2_MULTI_INSTANCE
+		{
+			_ekf.setIMUData(imu_sample_new);
+		}
+
 		PublishAttitude(now); // publish attitude immediately (uses quaternion from output predictor)
 
 		// integrate time to monitor time slippage
@@ -789,6 +842,10 @@ void EKF2::Run()
 			PublishGlobalPosition(now);
 			PublishSensorBias(now);
 
+#if defined(CONFIG_EKF2_TERRAIN) && defined(CONFIG_LIB_TERRAIN_MAP)
+			UpdateTerrainMap(now);
+#endif // CONFIG_EKF2_TERRAIN && CONFIG_LIB_TERRAIN_MAP
+
 #if defined(CONFIG_EKF2_WIND)
 			PublishWindEstimate(now);
 #endif // CONFIG_EKF2_WIND
@@ -798,6 +855,10 @@ void EKF2::Run()
 			PublishStatus(now);
 			PublishStatusFlags(now);
 
+#if defined(CONFIG_EKF2_CPU_PROFILE)
+			PublishCpuProfile(now);
+#endif // CONFIG_EKF2_CPU_PROFILE
+
 			if (_param_ekf2_log_verbose.get()) {
 				PublishAidSourceStatus(now);
 				PublishInnovations(now);
@@ -830,6 +891,7 @@ void EKF2::Run()
 
 			UpdateAccelCalibration(now);
 			UpdateGyroCalibration(now);
+			UpdateWarmStart();
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 			UpdateMagCalibration(now);
 #endif // CONFIG_EKF2_MAGNETOMETER
@@ -911,8 +973,11 @@ void EKF2::VerifyParams()
 
 #if defined(CONFIG_EKF2_GNSS)
 
-	if (_param_ekf2_gps_delay.get() > delay_max) {
-		delay_max = _param_ekf2_gps_delay.get();
+	// the combined samples are valid up to one averaging period before the newest sample
+	const float gps_delay = _param_ekf2_gps_delay.get() + math::max(_param_ekf2_gps_avg.get(), 0.f);
+
+	if (gps_delay > delay_max) {
+		delay_max = gps_delay;
 	}
 
 #endif // CONFIG_EKF2_GNSS
@@ -1216,6 +1281,36 @@ void EKF2::PublishGlobalPosition(const hrt_abstime &timestamp)
 	}
 }
 
+#if defined(CONFIG_EKF2_TERRAIN) && defined(CONFIG_LIB_TERRAIN_MAP)
+void EKF2::UpdateTerrainMap(const hrt_abstime &timestamp)
+{
+	// a single instance feeds the shared map
+	if (_instance != 0 || (timestamp < _last_terrain_map_update + 100_ms)
+	    || !_ekf.global_origin_valid() || !_ekf.isGlobalHorizontalPositionValid()) {
+		return;
+	}
+
+	_last_terrain_map_update = timestamp;
+
+	const LatLonAlt lla = _ekf.getLatLonAlt();
+	TerrainMapCache &terrain_map = TerrainMapCache::instance();
+
+	if (_ekf.control_status_flags().in_air && _ekf.control_status_flags().rng_terrain && _ekf.isTerrainEstimateValid()) {
+		terrain_map.update(lla.latitude_deg(), lla.longitude_deg(), _ekf.getEkfGlobalOriginAltitude() - _ekf.getTerrainVertPos());
+
+	} else {
+		// terrain of a previous overflight, used if the terrain state is (re)initialised
+		float terrain_alt = NAN;
+		uint8_t weight = 0;
+
+		if (terrain_map.lookup(lla.latitude_deg(), lla.longitude_deg(), terrain_alt, &weight)) {
+			// the cell size dominates the uncertainty, more so with only a few samples
+			_ekf.setTerrainPrior(terrain_alt, (weight >= 4) ? sq(1.f) : sq(2.f));
+		}
+	}
+}
+#endif // CONFIG_EKF2_TERRAIN && CONFIG_LIB_TERRAIN_MAP
+
 #if defined(CONFIG_EKF2_GNSS)
 void EKF2::PublishGpsStatus(const hrt_abstime &timestamp)
 {
@@ -1963,10 +2058,10 @@ void EKF2::PublishStatusFlags(const hrt_abstime &timestamp)
 #if defined(CONFIG_EKF2_GNSS)
 void EKF2::PublishYawEstimatorStatus(const hrt_abstime &timestamp)
 {
-	static_assert(sizeof(yaw_estimator_status_s::yaw) / sizeof(float) == N_MODELS_EKFGSF,
+	static_assert(sizeof(yaw_estimator_status_s::yaw) / sizeof(float) >= N_MODELS_EKFGSF,
 		      "yaw_estimator_status_s::yaw wrong size");
 
-	yaw_estimator_status_s yaw_est_test_data;
+	yaw_estimator_status_s yaw_est_test_data{};
 
 	if (_ekf.getDataEKFGSF(&yaw_est_test_data.yaw_composite, &yaw_est_test_data.yaw_variance,
 			       yaw_est_test_data.yaw,
@@ -1974,6 +2069,7 @@ void EKF2::PublishYawEstimatorStatus(const hrt_abstime &timestamp)
 			       yaw_est_test_data.weight)) {
 
 		yaw_est_test_data.yaw_composite_valid = _ekf.isYawEmergencyEstimateAvailable();
+		yaw_est_test_data.n_models = N_MODELS_EKFGSF;
 		yaw_est_test_data.timestamp_sample = _ekf.time_delayed_us();
 		yaw_est_test_data.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
 
@@ -1982,6 +2078,53 @@ void EKF2::PublishYawEstimatorStatus(const hrt_abstime &timestamp)
 }
 #endif // CONFIG_EKF2_GNSS
 
+#if defined(CONFIG_EKF2_CPU_PROFILE)
+void EKF2::PublishCpuProfile(const hrt_abstime &timestamp)
+{
+	static_assert(CpuProfile::NUM_STEPS == estimator_cpu_profile_s::STEP_COUNT, "estimator_cpu_profile_s wrong size");
+
+	// CPU time is always measured against the real clock, also in replay
+	const hrt_abstime time_now_us = hrt_absolute_time();
+
+	if (_cpu_profile_window_start == 0) {
+		_cpu_profile_window_start = time_now_us;
+		_ekf.resetCpuProfile();
+		return;
+	}
+
+	if (time_now_us < _cpu_profile_window_start + 1_s) {
+		return;
+	}
+
+	const CpuProfile &profile = _ekf.cpu_profile();
+	const uint32_t update_count = profile.updateCount();
+
+	if (update_count > 0) {
+		estimator_cpu_profile_s cpu_profile{};
+
+		cpu_profile.window_us = static_cast<uint32_t>(time_now_us - _cpu_profile_window_start);
+		cpu_profile.update_count = update_count;
+		cpu_profile.total_mean_us = static_cast<float>(profile.total().total_us) / update_count;
+		cpu_profile.total_max_us = profile.total().max_us;
+
+		for (uint8_t i = 0; i < CpuProfile::NUM_STEPS; i++) {
+			const CpuProfile::Entry &entry = profile.step(static_cast<CpuProfileStep>(i));
+			cpu_profile.mean_us[i] = static_cast<float>(entry.total_us) / update_count;
+			cpu_profile.max_us[i] = entry.max_us;
+		}
+
+		cpu_profile.timestamp_sample = _ekf.time_delayed_us();
+		cpu_profile.timestamp = _replay_mode ? timestamp : time_now_us;
+		_estimator_cpu_profile_pub.publish(cpu_profile);
+
+		_cpu_profile = cpu_profile;
+	}
+
+	_ekf.resetCpuProfile();
+	_cpu_profile_window_start = time_now_us;
+}
+#endif // CONFIG_EKF2_CPU_PROFILE
+
 #if defined(CONFIG_EKF2_WIND)
 void EKF2::PublishWindEstimate(const hrt_abstime &timestamp)
 {
@@ -2436,7 +2579,11 @@ void EKF2::UpdateGpsSample(ekf2_timestamps_s &ekf2_timestamps)
 			.spoofed = vehicle_gps_position.spoofing_state == sensor_gps_s::SPOOFING_STATE_MULTIPLE,
 		};
 
-		_ekf.setGpsData(gnss_sample);
+		gnssSample gnss_sample_combined;
+
+		if (_gnss_sample_averager.update(gnss_sample, gnss_sample_combined)) {
+			_ekf.setGpsData(gnss_sample_combined);
+		}
 
 		const float geoid_height = altitude_ellipsoid - altitude_amsl;
 
@@ -2698,6 +2845,44 @@ void EKF2::UpdateGyroCalibration(const hrt_abstime &timestamp)
 			  bias_valid, learning_valid);
 }
 
+void EKF2::UpdateWarmStart()
+{
+	// only the primary instance stores the yaw used for the next startup
+	if (!_param_ekf2_ws_en.get() || (_multi_mode && (_instance != 0))) {
+		return;
+	}
+
+	const auto &flags = _ekf.control_status_flags();
+
+	if (flags.in_air || !flags.vehicle_at_rest || !flags.tilt_align || !flags.yaw_align
+	    || (_ekf.fault_status().value != 0)) {
+		return;
+	}
+
+	const float yaw_var = _ekf.getYawVar();
+
+	if (!(yaw_var > 0.f) || (yaw_var > sq(math::radians(5.f)))) {
+		return;
+	}
+
+	const float yaw_deg = math::degrees(Eulerf(_ekf.getQuaternion()).psi());
+
+	if (!PX4_ISFINITE(yaw_deg)) {
+		return;
+	}
+
+	// limit the parameter writes to significant changes
+	const bool yaw_changed = fabsf(matrix::wrap(yaw_deg - _param_ekf2_ws_yaw.get(), -180.f, 180.f)) > 1.f;
+	const bool var_invalid = !(_param_ekf2_ws_yaw_var.get() > 0.f);
+
+	if (yaw_changed || var_invalid) {
+		_param_ekf2_ws_yaw.set(yaw_deg);
+		_param_ekf2_ws_yaw.commit_no_notification();
+		_param_ekf2_ws_yaw_var.set(yaw_var);
+		_param_ekf2_ws_yaw_var.commit_no_notification();
+	}
+}
+
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 void EKF2::UpdateMagCalibration(const hrt_abstime &timestamp)
 {
@@ -2826,6 +3011,11 @@ int EKF2::task_spawn(int argc, char *argv[])
 
 		bool ekf2_instance_created[MAX_NUM_IMUS][MAX_NUM_MAGS] {}; // IMUs * mags
 
+		// balance the instances across the INS work queues, on ties prefer a queue already running the same IMU
+		static constexpr uint8_t NUM_INS_WQ = 4;
+		uint8_t ins_wq_instances[NUM_INS_WQ] {};
+		bool ins_wq_imu[NUM_INS_WQ][MAX_NUM_IMUS] {};
+
 		while ((multi_instances_allocated < multi_instances)
 		       && (vehicle_status_sub.get().arming_state != vehicle_status_s::ARMING_STATE_ARMED)
 		       && ((hrt_elapsed_time(&time_started) < 30_s)
@@ -2845,7 +3035,16 @@ int EKF2::task_spawn(int argc, char *argv[])
 					if ((vehicle_mag_sub.advertised() || mag == 0) && (vehicle_imu_sub.advertised())) {
 
 						if (!ekf2_instance_created[imu][mag]) {
-							EKF2 *ekf2_inst = new EKF2(true, px4::ins_instance_to_wq(imu), false);
+							uint8_t wq = 0;
+
+							for (uint8_t i = 1; i < NUM_INS_WQ; i++) {
+								if ((ins_wq_instances[i] < ins_wq_instances[wq])
+								    || ((ins_wq_instances[i] == ins_wq_instances[wq]) && ins_wq_imu[i][imu] && !ins_wq_imu[wq][imu])) {
+									wq = i;
+								}
+							}
+
+							EKF2 *ekf2_inst = new EKF2(true, px4::ins_instance_to_wq(wq), false);
 
 							if (ekf2_inst && ekf2_inst->multi_init(imu, mag)) {
 								int actual_instance = ekf2_inst->instance(); // match uORB instance numbering
@@ -2855,10 +3054,13 @@ int EKF2::task_spawn(int argc, char *argv[])
 									success = true;
 									multi_instances_allocated++;
 									ekf2_instance_created[imu][mag] = true;
+									ins_wq_instances[wq]++;
+									ins_wq_imu[wq][imu] = true;
 
-									PX4_DEBUG("starting instance %d, IMU:%" PRIu8 " (%" PRIu32 "), MAG:%" PRIu8 " (%" PRIu32 ")", actual_instance,
+									PX4_DEBUG("starting instance %d, IMU:%" PRIu8 " (%" PRIu32 "), MAG:%" PRIu8 " (%" PRIu32 "), wq:INS%" PRIu8,
+										  actual_instance,
 										  imu, vehicle_imu_sub.get().accel_device_id,
-										  mag, vehicle_mag_sub.get().device_id);
+										  mag, vehicle_mag_sub.get().device_id, wq);
 
 									_ekf2_selector.load()->ScheduleNow();
 
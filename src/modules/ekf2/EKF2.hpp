@@ -44,6 +44,7 @@
 #include "EKF/ekf.h"
 
 #include "EKF2Selector.hpp"
+#include "EKF2ImuFrontEnd.hpp"
 #include "mathlib/math/filter/AlphaFilter.hpp"
 
 #include <float.h>
@@ -53,6 +54,7 @@
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 #include <lib/systemlib/mavlink_log.h>
+#include <px4_platform_common/arena.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
@@ -97,11 +99,16 @@
 # include <uORB/topics/landing_target_pose.h>
 #endif // CONFIG_EKF2_AUXVEL
 
+#if defined(CONFIG_EKF2_CPU_PROFILE)
+# include <uORB/topics/estimator_cpu_profile.h>
+#endif // CONFIG_EKF2_CPU_PROFILE
+
 #if defined(CONFIG_EKF2_BAROMETER)
 # include <uORB/topics/vehicle_air_data.h>
 #endif // CONFIG_EKF2_BAROMETER
 
 #if defined(CONFIG_EKF2_GNSS)
+# include "EKF/aid_sources/gnss/gnss_sample_averager.h"
 # include <uORB/topics/estimator_gps_status.h>
 # include <uORB/topics/sensor_gps.h>
 #endif // CONFIG_EKF2_GNSS
@@ -123,6 +130,10 @@
 # include <uORB/topics/wind.h>
 #endif // CONFIG_EKF2_WIND
 
+#if defined(CONFIG_EKF2_TERRAIN) && defined(CONFIG_LIB_TERRAIN_MAP)
+# include <lib/terrain_estimation/TerrainMapCache.hpp>
+#endif // CONFIG_EKF2_TERRAIN && CONFIG_LIB_TERRAIN_MAP
+
 extern pthread_mutex_t ekf2_module_mutex;
 
 class EKF2 final : public ModuleParams, public px4::ScheduledWorkItem
@@ -132,6 +143,9 @@ public:
 	EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode);
 	~EKF2() override;
 
+	// instances are large and live until ekf2 is stopped
+	PX4_ARENA_ALLOCATED("ekf2")
+
 	/** @see ModuleBase */
 	static int task_spawn(int argc, char *argv[]);
 
@@ -197,6 +211,9 @@ private:
 #if defined(CONFIG_EKF2_WIND)
 	void PublishWindEstimate(const hrt_abstime &timestamp);
 #endif // CONFIG_EKF2_WIND
+#if defined(CONFIG_EKF2_CPU_PROFILE)
+	void PublishCpuProfile(const hrt_abstime &timestamp);
+#endif // CONFIG_EKF2_CPU_PROFILE
 
 #if defined(CONFIG_EKF2_AIRSPEED)
 	void UpdateAirspeedSample(ekf2_timestamps_s &ekf2_timestamps);
@@ -232,6 +249,10 @@ private:
 
 	void UpdateSystemFlagsSample(ekf2_timestamps_s &ekf2_timestamps);
 
+#if defined(CONFIG_EKF2_TERRAIN) && defined(CONFIG_LIB_TERRAIN_MAP)
+	void UpdateTerrainMap(const hrt_abstime &timestamp);
+#endif // CONFIG_EKF2_TERRAIN && CONFIG_LIB_TERRAIN_MAP
+
 	// Used to check, save and use learned accel/gyro/mag biases
 	struct InFlightCalibration {
 		hrt_abstime last_us{0};         ///< last time the EKF was operating a mode that estimates accelerometer biases (uSec)
@@ -244,6 +265,7 @@ private:
 			       const matrix::Vector3f &bias_variance, float bias_limit, bool bias_valid, bool learning_valid);
 	void UpdateAccelCalibration(const hrt_abstime &timestamp);
 	void UpdateGyroCalibration(const hrt_abstime &timestamp);
+	void UpdateWarmStart();
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 	void UpdateMagCalibration(const hrt_abstime &timestamp);
 #endif // CONFIG_EKF2_MAGNETOMETER
@@ -396,6 +418,10 @@ private:
 	uORB::SubscriptionCallbackWorkItem _sensor_combined_sub{this, ORB_ID(sensor_combined)};
 	uORB::SubscriptionCallbackWorkItem _vehicle_imu_sub{this, ORB_ID(vehicle_imu)};
 
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+	EKF2ImuFrontEnd *_imu_front_end {nullptr}; ///< IMU down sampling shared with the other instances of the same IMU
+#endif // CONFIG_EKF2_MULTI_INSTANCE
+
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 	hrt_abstime _status_rng_hgt_pub_last {0};
 
@@ -406,7 +432,12 @@ private:
 	int _distance_sensor_selected{-1}; // because we can have several distance sensor instances with different orientations
 #endif // CONFIG_EKF2_RANGE_FINDER
 
+#if defined(CONFIG_EKF2_TERRAIN) && defined(CONFIG_LIB_TERRAIN_MAP)
+	hrt_abstime _last_terrain_map_update{0};
+#endif // CONFIG_EKF2_TERRAIN && CONFIG_LIB_TERRAIN_MAP
+
 	bool _callback_registered{false};
+	bool _warm_start_loaded{false};
 
 	hrt_abstime _last_event_flags_publish{0};
 	hrt_abstime _last_status_flags_publish{0};
@@ -443,12 +474,20 @@ private:
 	uORB::PublicationMulti<wind_s>              _wind_pub;
 #endif // CONFIG_EKF2_WIND
 
+#if defined(CONFIG_EKF2_CPU_PROFILE)
+	hrt_abstime _cpu_profile_window_start {0};
+	estimator_cpu_profile_s _cpu_profile{}; ///< last published window, also shown by ekf2 status -v
+	uORB::PublicationMulti<estimator_cpu_profile_s> _estimator_cpu_profile_pub {ORB_ID(estimator_cpu_profile)};
+#endif // CONFIG_EKF2_CPU_PROFILE
+
 #if defined(CONFIG_EKF2_GNSS)
 
 	uint64_t _last_geoid_height_update_us{0};
 	static constexpr float kGeoidHeightLpfTimeConstant = 10.f;
 	AlphaFilter<float> _geoid_height_lpf;  ///< height offset between AMSL and ellipsoid
 
+	GnssSampleAverager _gnss_sample_averager{}; ///< combines high rate GNSS samples (EKF2_GPS_AVG)
+
 	hrt_abstime _last_gps_status_published{0};
 
 	hrt_abstime _status_gnss_hgt_pub_last{0};
@@ -488,6 +527,7 @@ private:
 		(ParamExtFloat<px4::params::EKF2_DELAY_MAX>) _param_ekf2_delay_max,
 		(ParamExtInt<px4::params::EKF2_IMU_CTRL>) _param_ekf2_imu_ctrl,
 		(ParamExtFloat<px4::params::EKF2_VEL_LIM>) _param_ekf2_vel_lim,
+		(ParamExtInt<px4::params::EKF2_VEC_FUSE>) _param_ekf2_vec_fuse,
 
 #if defined(CONFIG_EKF2_AUXVEL)
 		(ParamExtFloat<px4::params::EKF2_AVEL_DELAY>)
@@ -538,6 +578,7 @@ private:
 		// Used by EKF-GSF experimental yaw estimator
 		(ParamExtFloat<px4::params::EKF2_GSF_TAS>) _param_ekf2_gsf_tas_default,
 		(ParamFloat<px4::params::EKF2_GPS_YAW_OFF>) _param_ekf2_gps_yaw_off,
+		(ParamFloat<px4::params::EKF2_GPS_AVG>) _param_ekf2_gps_avg,
 #endif // CONFIG_EKF2_GNSS
 
 #if defined(CONFIG_EKF2_BAROMETER)
@@ -709,6 +750,11 @@ private:
 		(ParamExtFloat<px4::params::EKF2_ANGERR_INIT>)
 		_param_ekf2_angerr_init,	///< 1-sigma tilt error after initial alignment using gravity vector (rad)
 
+		// yaw warm start from the last time at rest on ground
+		(ParamBool<px4::params::EKF2_WS_EN>) _param_ekf2_ws_en,
+		(ParamFloat<px4::params::EKF2_WS_YAW>) _param_ekf2_ws_yaw,
+		(ParamFloat<px4::params::EKF2_WS_YAW_VAR>) _param_ekf2_ws_yaw_var,
+
 		// EKF accel bias learning control
 		(ParamExtFloat<px4::params::EKF2_ABL_LIM>) _param_ekf2_abl_lim,	///< Accelerometer bias learning limit (m/s**2)
 		(ParamExtFloat<px4::params::EKF2_ABL_ACCLIM>)
@@ -0,0 +1,88 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "EKF2ImuFrontEnd.hpp"
+
+#if defined(CONFIG_EKF2_MULTI_INSTANCE)
+
+#include <containers/LockGuard.hpp>
+
+static EKF2ImuFrontEnd _imu_front_ends[EKF2ImuFrontEnd::MAX_NUM_IMUS] {};
+
+EKF2ImuFrontEnd *EKF2ImuFrontEnd::get(uint8_t imu)
+{
+	if (imu < MAX_NUM_IMUS) {
+		return &_imu_front_ends[imu];
+	}
+
+	return nullptr;
+}
+
+int EKF2ImuFrontEnd::update(const imuSample &imu_sample, int32_t target_dt_us, imuSample &imu_downsampled)
+{
+	LockGuard lg{_mutex};
+
+	if (imu_sample.time_us > _history[_newest].time_us) {
+		// first instance to receive this sample
+		_target_dt_us = target_dt_us;
+
+		_newest = (_newest + 1) % HISTORY_LENGTH;
+		Entry &entry = _history[_newest];
+
+		entry.time_us = imu_sample.time_us;
+		entry.downsampled = _down_sampler.update(imu_sample);
+
+		if (entry.downsampled) {
+			entry.imu_downsampled = _down_sampler.getDownSampledImuAndTriggerReset();
+		}
+	}
+
+	// newest first
+	for (uint8_t i = 0; i < HISTORY_LENGTH; i++) {
+		const Entry &entry = _history[(_newest + HISTORY_LENGTH - i) % HISTORY_LENGTH];
+
+		if (entry.time_us == imu_sample.time_us) {
+			if (entry.downsampled) {
+				imu_downsampled = entry.imu_downsampled;
+				return 1;
+			}
+
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+#endif // CONFIG_EKF2_MULTI_INSTANCE
@@ -0,0 +1,95 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file EKF2ImuFrontEnd.hpp
+ *
+ * IMU down sampling shared by all multi-instance EKF2 instances using the same IMU.
+ *
+ * Every instance still receives every vehicle_imu sample (the output predictor runs at the full IMU rate),
+ * but the accumulation to the filter update rate is done only once per sample, by the first instance receiving it.
+ * The other instances reuse the result, so all instances of an IMU predict in lock-step with identical data.
+ * A short history of results allows instances on other work queues to lag behind by a few samples.
+ */
+
+#ifndef EKF2IMUFRONTEND_HPP
+#define EKF2IMUFRONTEND_HPP
+
+#include "EKF/common.h"
+#include "EKF/imu_down_sampler/imu_down_sampler.hpp"
+
+#include <pthread.h>
+
+class EKF2ImuFrontEnd
+{
+public:
+	EKF2ImuFrontEnd() = default;
+	~EKF2ImuFrontEnd() = default;
+
+	static constexpr uint8_t MAX_NUM_IMUS = 4;
+
+	/**
+	 * Get the front-end of an IMU (vehicle_imu instance)
+	 */
+	static EKF2ImuFrontEnd *get(uint8_t imu);
+
+	/**
+	 * Down sample a new IMU sample or fetch the result if it was already processed by another instance
+	 *
+	 * @param imu_sample IMU sample at the sensor rate
+	 * @param target_dt_us filter update interval (EKF2_PREDICT_US)
+	 * @param imu_downsampled set to the down sampled IMU sample if one is completed by this sample
+	 * @return -1 if the sample is too old to be in the history, otherwise 1 if imu_downsampled was set and 0 if not
+	 */
+	int update(const imuSample &imu_sample, int32_t target_dt_us, imuSample &imu_downsampled);
+
+private:
+	static constexpr uint8_t HISTORY_LENGTH = 8;
+
+	struct Entry {
+		uint64_t time_us{0};
+		bool downsampled{false};
+		imuSample imu_downsampled{};
+	};
+
+	Entry _history[HISTORY_LENGTH] {};
+	uint8_t _newest{0};
+
+	int32_t _target_dt_us{10000};
+	ImuDownSampler _down_sampler{_target_dt_us};
+
+	pthread_mutex_t _mutex = PTHREAD_MUTEX_INITIALIZER;
+};
+
+#endif // !EKF2IMUFRONTEND_HPP
@@ -0,0 +1,354 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ekf2_batch_replay.cpp
+ * Replay a set of sensor data files (created from flight logs with
+ * sensor_simulator/convertULogToSensorData.py) through independent EKF
+ * instances on a pool of worker threads, and print a summary of the
+ * innovation test ratios of each log.
+ *
+ * Usage: ekf2_batch_replay [-j <jobs>] [-o <output dir>] [-s <summary.csv>] <file.csv>...
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+#include "sensor_simulator/ekf_logger.h"
+
+static constexpr uint32_t kReplayStepUs = 5000; // one IMU sample at the default replay rate
+static constexpr uint32_t kLoggingIntervalUs = 100000; // 10 Hz, same as test_EKF_withReplayData
+
+enum AidSource {
+	GNSS_VEL,
+	GNSS_POS,
+	BARO_HGT,
+	MAG,
+	AID_SOURCE_COUNT
+};
+
+static const char *const aid_source_names[AID_SOURCE_COUNT] = {"gnss_vel", "gnss_pos", "baro_hgt", "mag"};
+
+static float maxTestRatio(float test_ratio) { return test_ratio; }
+
+template<size_t N>
+static float maxTestRatio(const float(&test_ratio)[N])
+{
+	float max_test_ratio = 0.f;
+
+	for (size_t i = 0; i < N; i++) {
+		if (!std::isfinite(test_ratio[i]) || test_ratio[i] > max_test_ratio) {
+			max_test_ratio = test_ratio[i];
+		}
+	}
+
+	return max_test_ratio;
+}
+
+/**
+ * Test ratio statistics of one aiding source, updated once per fused
+ * (or rejected) observation.
+ */
+struct TestRatioStats {
+	template<typename T>
+	void update(const T &aid_src)
+	{
+		if ((aid_src.timestamp_sample == 0) || (aid_src.timestamp_sample == last_timestamp_sample)) {
+			return;
+		}
+
+		last_timestamp_sample = aid_src.timestamp_sample;
+		const float test_ratio = maxTestRatio(aid_src.test_ratio);
+
+		if (!std::isfinite(test_ratio)) {
+			invalid++;
+			return;
+		}
+
+		samples++;
+		sum += (double)test_ratio;
+
+		if (test_ratio > max) {
+			max = test_ratio;
+		}
+
+		if (aid_src.innovation_rejected) {
+			rejected++;
+		}
+	}
+
+	float mean() const { return (samples > 0) ? static_cast<float>(sum / samples) : 0.f; }
+	float rejectedRatio() const { return (samples > 0) ? static_cast<float>(rejected) / samples : 0.f; }
+
+	uint64_t last_timestamp_sample{0};
+	uint32_t samples{0};
+	uint32_t rejected{0};
+	uint32_t invalid{0}; ///< number of NaN/inf test ratios
+	double sum{0.0};
+	float max{0.f};
+};
+
+struct ReplayJob {
+	std::string input_file;
+	std::string output_file; ///< state output, empty if disabled
+
+	TestRatioStats stats[AID_SOURCE_COUNT] {};
+	uint64_t duration_us{0};
+};
+
+static void runReplay(ReplayJob &job)
+{
+	std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+	SensorSimulator sensor_simulator(ekf);
+	EkfWrapper ekf_wrapper(ekf);
+	EkfLogger ekf_logger(ekf);
+
+	sensor_simulator.loadSensorDataFromFile(job.input_file);
+
+	if (!job.output_file.empty()) {
+		ekf_logger.setFilePath(job.output_file);
+	}
+
+	// IMU, Baro and Mag are always running, start all other sensors contained in the log
+	if (sensor_simulator.hasReplayData(sensor_info::measurement_t::GPS)) {
+		sensor_simulator.startGps();
+		ekf_wrapper.enableGpsFusion();
+	}
+
+	if (sensor_simulator.hasReplayData(sensor_info::measurement_t::FLOW)) {
+		sensor_simulator.startFlow();
+		ekf_wrapper.enableFlowFusion();
+	}
+
+	if (sensor_simulator.hasReplayData(sensor_info::measurement_t::RANGE)) {
+		sensor_simulator.startRangeFinder();
+	}
+
+	if (sensor_simulator.hasReplayData(sensor_info::measurement_t::AIRSPEED)) {
+		sensor_simulator.startAirspeedSensor();
+	}
+
+	uint32_t time_since_log_us = 0;
+
+	while (!sensor_simulator.isReplayFinished()) {
+		sensor_simulator.runReplayMicroseconds(kReplayStepUs);
+
+		job.stats[GNSS_VEL].update(ekf->aid_src_gnss_vel());
+		job.stats[GNSS_POS].update(ekf->aid_src_gnss_pos());
+		job.stats[BARO_HGT].update(ekf->aid_src_baro_hgt());
+		job.stats[MAG].update(ekf->aid_src_mag());
+
+		time_since_log_us += kReplayStepUs;
+
+		if (!job.output_file.empty() && (time_since_log_us >= kLoggingIntervalUs)) {
+			ekf_logger.writeStateToFile();
+			time_since_log_us = 0;
+		}
+	}
+
+	job.duration_us = sensor_simulator.getTime();
+}
+
+static std::string baseName(const std::string &path)
+{
+	const size_t slash = path.find_last_of('/');
+	std::string name = (slash == std::string::npos) ? path : path.substr(slash + 1);
+	const size_t dot = name.find_last_of('.');
+
+	if (dot != std::string::npos && dot > 0) {
+		name = name.substr(0, dot);
+	}
+
+	return name;
+}
+
+static void printSummary(const std::vector<ReplayJob> &jobs)
+{
+	printf("%-32s %8s", "log", "time [s]");
+
+	for (int i = 0; i < AID_SOURCE_COUNT; i++) {
+		printf(" | %-8s %6s %6s %6s", aid_source_names[i], "mean", "max", "rej %");
+	}
+
+	printf("\n");
+
+	for (const ReplayJob &job : jobs) {
+		printf("%-32.32s %8.1f", baseName(job.input_file).c_str(), job.duration_us * 1e-6);
+
+		for (int i = 0; i < AID_SOURCE_COUNT; i++) {
+			const TestRatioStats &stats = job.stats[i];
+
+			if (stats.samples > 0) {
+				printf(" | %8u %6.2f %6.2f %6.1f", stats.samples, (double)stats.mean(), (double)stats.max,
+				       (double)(stats.rejectedRatio() * 100.f));
+
+			} else {
+				printf(" | %8s %6s %6s %6s", "-", "-", "-", "-");
+			}
+		}
+
+		printf("\n");
+	}
+}
+
+static bool writeSummary(const std::vector<ReplayJob> &jobs, const std::string &file_path)
+{
+	FILE *file = fopen(file_path.c_str(), "w");
+
+	if (!file) {
+		fprintf(stderr, "Can not write to summary file %s\n", file_path.c_str());
+		return false;
+	}
+
+	fprintf(file, "log,duration");
+
+	for (int i = 0; i < AID_SOURCE_COUNT; i++) {
+		fprintf(file, ",%s_samples,%s_mean,%s_max,%s_rejected,%s_invalid", aid_source_names[i], aid_source_names[i],
+			aid_source_names[i], aid_source_names[i], aid_source_names[i]);
+	}
+
+	fprintf(file, "\n");
+
+	for (const ReplayJob &job : jobs) {
+		fprintf(file, "%s,%.3f", job.input_file.c_str(), job.duration_us * 1e-6);
+
+		for (int i = 0; i < AID_SOURCE_COUNT; i++) {
+			const TestRatioStats &stats = job.stats[i];
+			fprintf(file, ",%u,%.4f,%.4f,%u,%u", stats.samples, (double)stats.mean(), (double)stats.max, stats.rejected,
+				stats.invalid);
+		}
+
+		fprintf(file, "\n");
+	}
+
+	fclose(file);
+	return true;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-j <jobs>] [-o <output dir>] [-s <summary.csv>] <file.csv>...\n", name);
+	fprintf(stderr, " -j <jobs>        number of worker threads (default: number of cores)\n");
+	fprintf(stderr, " -o <output dir>  write the estimated states of each log to <output dir>/<log>.csv\n");
+	fprintf(stderr, " -s <summary.csv> write the test ratio summary to a file\n");
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned num_threads = std::thread::hardware_concurrency();
+	std::string output_dir;
+	std::string summary_file;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "j:o:s:h")) != -1) {
+		switch (ch) {
+		case 'j':
+			num_threads = strtoul(optarg, nullptr, 10);
+			break;
+
+		case 'o':
+			output_dir = optarg;
+			break;
+
+		case 's':
+			summary_file = optarg;
+			break;
+
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (optind >= argc) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	std::vector<ReplayJob> jobs(argc - optind);
+
+	for (size_t i = 0; i < jobs.size(); i++) {
+		jobs[i].input_file = argv[optind + i];
+
+		if (access(jobs[i].input_file.c_str(), R_OK) != 0) {
+			fprintf(stderr, "Can not read %s\n", jobs[i].input_file.c_str());
+			return 1;
+		}
+
+		if (!output_dir.empty()) {
+			jobs[i].output_file = output_dir + "/" + baseName(jobs[i].input_file) + ".csv";
+		}
+	}
+
+	if (num_threads == 0) {
+		num_threads = 1;
+	}
+
+	if (num_threads > jobs.size()) {
+		num_threads = jobs.size();
+	}
+
+	// the EKF instances share no state, so each worker simply takes the next log
+	std::atomic<size_t> next_job{0};
+	std::vector<std::thread> workers;
+
+	for (unsigned i = 0; i < num_threads; i++) {
+		workers.emplace_back([&jobs, &next_job]() {
+			for (size_t job = next_job++; job < jobs.size(); job = next_job++) {
+				runReplay(jobs[job]);
+			}
+		});
+	}
+
+	for (std::thread &worker : workers) {
+		worker.join();
+	}
+
+	printSummary(jobs);
+
+	if (!summary_file.empty() && !writeSummary(jobs, summary_file)) {
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,487 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file ekf2_replay_benchmark.cpp
+ * Replay the bundled replay_data sets with the same setup as
+ * test_EKF_withReplayData and report the CPU time of Ekf::update() together
+ * with the state error against the change_indication references, so that
+ * performance regressions (e.g. after regenerating the SymForce code) show up
+ * alongside accuracy regressions.
+ *
+ * The cost of the fusion steps is estimated by grouping the updates by the
+ * combination of aiding sources that were processed, relative to the updates
+ * that only predict.
+ * The change_indication states are logged with 2 significant digits, which
+ * limits the resolution of the state error. For finer comparisons a full
+ * precision reference can be recorded with -w and used with -r.
+ *
+ * Usage: ekf2_replay_benchmark [-n <repetitions>] [-r <reference dir>] [-w <output dir>] [-s <summary.csv>]
+ *                              [-t <max ns>] [-e <max error>]
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+static constexpr uint32_t kReplayStepUs = 1000; // one simulation step, at most one EKF update
+static constexpr uint32_t kReferenceIntervalSteps = 100; // reference states are logged at 10 Hz
+
+struct Dataset {
+	const char *name;
+	float duration_s;
+	float gnss_innov_gate; ///< GNSS innovation gate override, 0 to keep the default
+};
+
+// keep in sync with test_EKF_withReplayData
+static const Dataset datasets[] = {
+	{"iris_gps", 35.f, 0.f},
+	{"ekf_gsf_reset", 39.f, 1.f},
+};
+
+enum AidSource {
+	GNSS,
+	BARO,
+	MAG,
+	AID_SOURCE_COUNT
+};
+
+static const char *const aid_source_names[AID_SOURCE_COUNT] = {"gnss", "baro", "mag"};
+
+// updates are grouped by the bitmask of the processed aiding sources, 0 is prediction only
+static constexpr int UPDATE_TYPE_COUNT = 1 << AID_SOURCE_COUNT;
+
+static std::string updateTypeName(int update_type)
+{
+	if (update_type == 0) {
+		return "predict";
+	}
+
+	std::string name;
+
+	for (int i = 0; i < AID_SOURCE_COUNT; i++) {
+		if (update_type & (1 << i)) {
+			name += name.empty() ? aid_source_names[i] : std::string("+") + aid_source_names[i];
+		}
+	}
+
+	return name;
+}
+
+struct UpdateStats {
+	void add(uint64_t time_ns)
+	{
+		sum_ns += time_ns;
+		count++;
+	}
+
+	double mean() const { return (count > 0) ? static_cast<double>(sum_ns) / count : (double)NAN; }
+
+	uint64_t sum_ns{0};
+	uint32_t count{0};
+};
+
+struct ErrorStats {
+	void add(double error)
+	{
+		sum_sq += error * error;
+		max = fmax(max, error);
+		count++;
+	}
+
+	double rms() const { return (count > 0) ? sqrt(sum_sq / count) : (double)NAN; }
+
+	double sum_sq{0.0};
+	double max{0.0};
+	uint32_t count{0};
+};
+
+struct Result {
+	UpdateStats total{};
+	UpdateStats update_type[UPDATE_TYPE_COUNT] {};
+
+	ErrorStats attitude_deg{};
+	ErrorStats velocity{};
+	ErrorStats position{};
+	uint32_t reference_time_mismatch{0};
+};
+
+struct ReferenceState {
+	uint64_t time_us{0};
+	float state[10] {}; ///< quaternion, velocity, position
+};
+
+static std::vector<ReferenceState> loadReference(const std::string &file_path)
+{
+	std::vector<ReferenceState> reference;
+	std::ifstream file(file_path);
+	std::string line;
+
+	// skip the header
+	std::getline(file, line);
+
+	while (std::getline(file, line)) {
+		std::stringstream line_stream(line);
+		std::string value;
+		ReferenceState sample{};
+
+		if (!std::getline(line_stream, value, ',')) {
+			break;
+		}
+
+		sample.time_us = std::stoull(value);
+
+		for (float &state : sample.state) {
+			std::getline(line_stream, value, ',');
+			state = std::stof(value);
+		}
+
+		reference.push_back(sample);
+	}
+
+	return reference;
+}
+
+static void compareToReference(const Ekf &ekf, const ReferenceState &reference, Result &result)
+{
+	if (ekf.time_delayed_us() != reference.time_us) {
+		result.reference_time_mismatch++;
+	}
+
+	const matrix::Quatf q_ref(reference.state[0], reference.state[1], reference.state[2], reference.state[3]);
+	const matrix::Vector3f vel_ref(reference.state[4], reference.state[5], reference.state[6]);
+	const matrix::Vector3f pos_ref(reference.state[7], reference.state[8], reference.state[9]);
+
+	// the references are logged from the delayed states (see EkfLogger)
+	const StateSample &state = ekf.state();
+	const float q_dot = fabsf(q_ref.unit().dot(state.quat_nominal));
+	result.attitude_deg.add(math::degrees(2.0 * acos((double)math::min(q_dot, 1.f))));
+	result.velocity.add((double)(state.vel - vel_ref).norm());
+	result.position.add((double)(state.pos - pos_ref).norm());
+}
+
+template<typename T>
+static bool updateSampleTime(const T &aid_src, uint64_t &last_timestamp_sample)
+{
+	if (aid_src.timestamp_sample != last_timestamp_sample) {
+		last_timestamp_sample = aid_src.timestamp_sample;
+		return true;
+	}
+
+	return false;
+}
+
+static void writeState(FILE *file, const Ekf &ekf)
+{
+	const StateSample &state = ekf.state();
+	fprintf(file, "%llu", (unsigned long long)ekf.time_delayed_us());
+
+	for (int i = 0; i < 4; i++) {
+		fprintf(file, ",%.9g", (double)state.quat_nominal(i));
+	}
+
+	for (int i = 0; i < 3; i++) {
+		fprintf(file, ",%.9g", (double)state.vel(i));
+	}
+
+	for (int i = 0; i < 3; i++) {
+		fprintf(file, ",%.9g", (double)state.pos(i));
+	}
+
+	fprintf(file, "\n");
+}
+
+static bool runDataset(const Dataset &dataset, const std::string &reference_dir, const std::string &output_dir,
+		       Result &result)
+{
+	std::shared_ptr<Ekf> ekf = std::make_shared<Ekf>();
+	SensorSimulator sensor_simulator(ekf);
+	EkfWrapper ekf_wrapper(ekf);
+
+	const std::string replay_file = std::string(TEST_DATA_PATH"/replay_data/") + dataset.name + ".csv";
+	const std::string reference_file = reference_dir + "/" + dataset.name + ".csv";
+
+	if (access(replay_file.c_str(), R_OK) != 0) {
+		fprintf(stderr, "Can not read %s\n", replay_file.c_str());
+		return false;
+	}
+
+	const std::vector<ReferenceState> reference = loadReference(reference_file);
+
+	if (reference.empty()) {
+		fprintf(stderr, "Can not read reference %s\n", reference_file.c_str());
+		return false;
+	}
+
+	FILE *output_file = nullptr;
+
+	if (!output_dir.empty()) {
+		const std::string output_file_path = output_dir + "/" + dataset.name + ".csv";
+		output_file = fopen(output_file_path.c_str(), "w");
+
+		if (!output_file) {
+			fprintf(stderr, "Can not write to %s\n", output_file_path.c_str());
+			return false;
+		}
+
+		fprintf(output_file, "Timestamp,state[0],state[1],state[2],state[3],state[4],state[5],state[6],state[7],state[8],state[9]\n");
+	}
+
+	sensor_simulator.loadSensorDataFromFile(replay_file);
+	sensor_simulator.startGps();
+	ekf_wrapper.enableGpsFusion();
+
+	if (dataset.gnss_innov_gate > 0.f) {
+		ekf->getParamHandle()->gps_vel_innov_gate = dataset.gnss_innov_gate;
+		ekf->getParamHandle()->gps_pos_innov_gate = dataset.gnss_innov_gate;
+	}
+
+	uint64_t last_timestamp_sample[AID_SOURCE_COUNT] {};
+	const uint32_t num_steps = static_cast<uint32_t>(dataset.duration_s * 1e6f) / kReplayStepUs;
+
+	for (uint32_t step = 1; step <= num_steps; step++) {
+		sensor_simulator.runReplayMicroseconds(kReplayStepUs);
+
+		if (sensor_simulator.getReplayUpdateCount() == 1) {
+			const uint64_t time_ns = sensor_simulator.getReplayUpdateTimeNs();
+			result.total.add(time_ns);
+
+			// GNSS velocity and position are always processed together
+			int update_type = 0;
+
+			if (updateSampleTime(ekf->aid_src_gnss_vel(), last_timestamp_sample[GNSS])) {
+				update_type |= 1 << GNSS;
+			}
+
+			if (updateSampleTime(ekf->aid_src_baro_hgt(), last_timestamp_sample[BARO])) {
+				update_type |= 1 << BARO;
+			}
+
+			if (updateSampleTime(ekf->aid_src_mag(), last_timestamp_sample[MAG])) {
+				update_type |= 1 << MAG;
+			}
+
+			result.update_type[update_type].add(time_ns);
+		}
+
+		if (step % kReferenceIntervalSteps == 0) {
+			if (step / kReferenceIntervalSteps <= reference.size()) {
+				compareToReference(*ekf, reference[step / kReferenceIntervalSteps - 1], result);
+			}
+
+			if (output_file) {
+				writeState(output_file, *ekf);
+			}
+		}
+	}
+
+	if (output_file) {
+		fclose(output_file);
+	}
+
+	return true;
+}
+
+static void printResult(const Dataset &dataset, const Result &result)
+{
+	printf("%s: %u updates, %.0f ns per update\n", dataset.name, result.total.count, result.total.mean());
+
+	const double predict_ns = result.update_type[0].mean();
+
+	for (int i = 0; i < UPDATE_TYPE_COUNT; i++) {
+		const UpdateStats &stats = result.update_type[i];
+
+		if (stats.count == 0) {
+			continue;
+		}
+
+		if (i == 0) {
+			printf("  %-14s %6u updates %8.0f ns\n", updateTypeName(i).c_str(), stats.count, stats.mean());
+
+		} else {
+			printf("  %-14s %6u updates %8.0f ns (fusion %+6.0f ns)\n", updateTypeName(i).c_str(), stats.count,
+			       stats.mean(), stats.mean() - predict_ns);
+		}
+	}
+
+	printf("  state error:     rms      max\n");
+	printf("  attitude [deg] %7.3f  %7.3f\n", result.attitude_deg.rms(), result.attitude_deg.max);
+	printf("  velocity [m/s] %7.3f  %7.3f\n", result.velocity.rms(), result.velocity.max);
+	printf("  position [m]   %7.3f  %7.3f\n", result.position.rms(), result.position.max);
+
+	if (result.reference_time_mismatch > 0) {
+		printf("  WARNING: %u reference samples with a different timestamp\n", result.reference_time_mismatch);
+	}
+}
+
+static bool writeSummary(const std::vector<Result> &results, const std::string &file_path)
+{
+	FILE *file = fopen(file_path.c_str(), "w");
+
+	if (!file) {
+		fprintf(stderr, "Can not write to summary file %s\n", file_path.c_str());
+		return false;
+	}
+
+	fprintf(file, "dataset,updates,update_ns");
+
+	for (int i = 0; i < UPDATE_TYPE_COUNT; i++) {
+		fprintf(file, ",%s_ns", updateTypeName(i).c_str());
+	}
+
+	fprintf(file, ",attitude_rms_deg,attitude_max_deg,velocity_rms,velocity_max,position_rms,position_max\n");
+
+	for (size_t i = 0; i < results.size(); i++) {
+		const Result &result = results[i];
+		fprintf(file, "%s,%u,%.1f", datasets[i].name, result.total.count, result.total.mean());
+
+		for (int k = 0; k < UPDATE_TYPE_COUNT; k++) {
+			fprintf(file, ",%.1f", result.update_type[k].mean());
+		}
+
+		fprintf(file, ",%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n", result.attitude_deg.rms(), result.attitude_deg.max,
+			result.velocity.rms(), result.velocity.max, result.position.rms(), result.position.max);
+	}
+
+	fclose(file);
+	return true;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-n <repetitions>] [-r <reference dir>] [-w <output dir>] [-s <summary.csv>]"
+		" [-t <max ns>] [-e <max error>]\n", name);
+	fprintf(stderr, " -n <repetitions>  replay every dataset n times and keep the fastest run (default: 3)\n");
+	fprintf(stderr, " -r <dir>          reference states (default: test/change_indication)\n");
+	fprintf(stderr, " -w <dir>          write the states in full precision, for use with -r\n");
+	fprintf(stderr, " -s <summary.csv>  write the results to a file\n");
+	fprintf(stderr, " -t <max ns>       fail if the mean time per update of a dataset exceeds this\n");
+	fprintf(stderr, " -e <max error>    fail if the rms position error [m] of a dataset exceeds this\n");
+}
+
+int main(int argc, char *argv[])
+{
+	int repetitions = 3;
+	std::string reference_dir = TEST_DATA_PATH"/change_indication";
+	std::string output_dir;
+	std::string summary_file;
+	double max_update_ns = 0.0;
+	double max_position_error = 0.0;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "n:r:w:s:t:e:h")) != -1) {
+		switch (ch) {
+		case 'n':
+			repetitions = atoi(optarg);
+			break;
+
+		case 'r':
+			reference_dir = optarg;
+			break;
+
+		case 'w':
+			output_dir = optarg;
+			break;
+
+		case 's':
+			summary_file = optarg;
+			break;
+
+		case 't':
+			max_update_ns = atof(optarg);
+			break;
+
+		case 'e':
+			max_position_error = atof(optarg);
+			break;
+
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (repetitions < 1) {
+		repetitions = 1;
+	}
+
+	std::vector<Result> results;
+	bool passed = true;
+
+	for (const Dataset &dataset : datasets) {
+		Result best{};
+
+		// the replay is deterministic, only the timing differs between repetitions
+		for (int i = 0; i < repetitions; i++) {
+			Result result{};
+
+			if (!runDataset(dataset, reference_dir, (i == 0) ? output_dir : std::string(), result)) {
+				return 1;
+			}
+
+			if ((i == 0) || (result.total.sum_ns < best.total.sum_ns)) {
+				best = result;
+			}
+		}
+
+		printResult(dataset, best);
+		results.push_back(best);
+
+		if ((max_update_ns > 0.0) && (best.total.mean() > max_update_ns)) {
+			printf("  FAILED: %.0f ns per update exceeds %.0f ns\n", best.total.mean(), max_update_ns);
+			passed = false;
+		}
+
+		if ((max_position_error > 0.0) && !(best.position.rms() <= max_position_error)) {
+			printf("  FAILED: rms position error %.3f m exceeds %.3f m\n", best.position.rms(), max_position_error);
+			passed = false;
+		}
+	}
+
+	if (!summary_file.empty() && !writeSummary(results, summary_file)) {
+		return 1;
+	}
+
+	return passed ? 0 : 1;
+}
@@ -41,6 +41,7 @@
 
 #include "EKF/ekf.h"
 #include <math.h>
+#include <algorithm>
 #include <memory>
 
 namespace sensor_simulator
@@ -65,6 +66,11 @@ public:
 
 	bool should_send(uint64_t time) const;
 
+	// earliest time at or after time at which a running sensor sends its next sample
+	uint64_t nextSendTime(uint64_t time) const { return std::max(time, _time_last_data_sent + _update_period); }
+
+	uint32_t getUpdatePeriod() const { return _update_period; }
+
 protected:
 
 	std::shared_ptr<Ekf> _ekf;
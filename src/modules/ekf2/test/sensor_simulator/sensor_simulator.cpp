@@ -1,5 +1,8 @@
 #include "sensor_simulator.h"
 
+#include <algorithm>
+#include <chrono>
+
 
 SensorSimulator::SensorSimulator(std::shared_ptr<Ekf> ekf):
 	_airspeed(ekf),
@@ -159,22 +162,62 @@ void SensorSimulator::runSeconds(float duration_seconds)
 
 void SensorSimulator::runMicroseconds(uint32_t duration)
 {
-	// simulate in 1000us steps
+	// simulate in 1000us steps, the sensor data is constant over the call so only the
+	// steps at which a sensor sends are run, which gives the same result as visiting every step
 	const uint64_t start_time = _time;
+	const uint64_t end_time = start_time + ((uint64_t)duration + 999) / 1000 * 1000;
 
-	for (; _time < start_time + (uint64_t)duration; _time += 1000) {
-		bool update_imu = _imu.should_send(_time);
-		updateSensors();
+	buildStepSchedule(start_time, end_time);
 
-		if (update_imu) {
-			if (_imu.moving()) {
-				_ekf->set_vehicle_at_rest(false);
-			}
+	for (const uint64_t step_time : _step_schedule) {
+		_time = step_time;
+		updateSensorsAndEkf();
+	}
 
-			// Update at IMU rate
-			_ekf->update();
+	_time = end_time;
+}
+
+void SensorSimulator::buildStepSchedule(uint64_t start_time, uint64_t end_time)
+{
+	const sensor_simulator::Sensor *sensors[] {&_airspeed, &_baro, &_flow, &_gps, &_imu, &_mag, &_rng, &_vio};
+
+	// first step at or after time
+	auto align_to_step = [start_time](uint64_t time) {
+		return start_time + (time - start_time + 999) / 1000 * 1000;
+	};
+
+	_step_schedule.clear();
+
+	for (const sensor_simulator::Sensor *sensor : sensors) {
+		if (!sensor->isRunning()) {
+			continue;
+		}
+
+		const uint64_t period = std::max(sensor->getUpdatePeriod(), (uint32_t)1);
+
+		for (uint64_t time = align_to_step(sensor->nextSendTime(start_time)); time < end_time;
+		     time = align_to_step(time + period)) {
+			_step_schedule.push_back(time);
 		}
 	}
+
+	std::sort(_step_schedule.begin(), _step_schedule.end());
+	_step_schedule.erase(std::unique(_step_schedule.begin(), _step_schedule.end()), _step_schedule.end());
+}
+
+void SensorSimulator::updateSensorsAndEkf()
+{
+	bool update_imu = _imu.should_send(_time);
+	updateSensors();
+
+	if (update_imu) {
+		if (_imu.moving()) {
+			_ekf->set_vehicle_at_rest(false);
+		}
+
+		// Update at IMU rate
+		_ekf->update();
+	}
 }
 
 void SensorSimulator::updateSensors()
@@ -203,6 +246,8 @@ void SensorSimulator::runReplayMicroseconds(uint32_t duration)
 
 	// simulate in 1000us steps
 	const uint64_t start_time = _time;
+	_replay_update_time_ns = 0;
+	_replay_update_count = 0;
 
 	for (; _time < start_time + duration; _time += 1000) {
 		setSensorDataFromReplayData();
@@ -215,23 +260,42 @@ void SensorSimulator::runReplayMicroseconds(uint32_t duration)
 				_ekf->set_vehicle_at_rest(false);
 			}
 
+			const auto update_start = std::chrono::steady_clock::now();
 			_ekf->update();
+			_replay_update_time_ns += std::chrono::duration_cast<std::chrono::nanoseconds>
+						  (std::chrono::steady_clock::now() - update_start).count();
+			_replay_update_count++;
 		}
 	}
 }
 
+bool SensorSimulator::hasReplayData(sensor_info::measurement_t sensor_type) const
+{
+	for (const sensor_info &sample : _replay_data) {
+		if (sample.sensor_type == sensor_type) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void SensorSimulator::setSensorDataFromReplayData()
 {
+	if (_current_replay_data_index >= _replay_data.size() && _replay_data.size() > 0) {
+		// end of replay data, keep the last sample
+		return;
+	}
+
 	if (_replay_data.size() > 0) {
 		sensor_info sample = _replay_data[_current_replay_data_index];
 
 		while (sample.timestamp < _time) {
 			setSingleReplaySample(sample);
 
-			if (_current_replay_data_index < _replay_data.size()) {
-				_current_replay_data_index ++;
+			_current_replay_data_index++;
 
-			} else {
+			if (_current_replay_data_index >= _replay_data.size()) {
 				break;
 			}
 
@@ -334,16 +398,7 @@ void SensorSimulator::runTrajectoryMicroseconds(uint32_t duration)
 
 		setSensorDataFromTrajectory();
 
-		bool update_imu = _imu.should_send(_time);
-		updateSensors();
-
-		if (update_imu) {
-			if (_imu.moving()) {
-				_ekf->set_vehicle_at_rest(false);
-			}
-
-			_ekf->update();
-		}
+		updateSensorsAndEkf();
 	}
 }
 
@@ -118,6 +118,12 @@ public:
 	void setOrientation(const Dcmf &orientation) { _R_body_to_world = orientation; }
 
 	void loadSensorDataFromFile(std::string filename);
+	bool hasReplayData(sensor_info::measurement_t sensor_type) const;
+	bool isReplayFinished() const { return _current_replay_data_index >= _replay_data.size(); }
+
+	// wall clock time spent in Ekf::update() and number of updates during the last runReplayMicroseconds() call
+	uint64_t getReplayUpdateTimeNs() const { return _replay_update_time_ns; }
+	uint32_t getReplayUpdateCount() const { return _replay_update_count; }
 
 	Airspeed    _airspeed;
 	Baro        _baro;
@@ -138,14 +144,21 @@ private:
 	void setSensorDataFromTrajectory();
 	void startBasicSensor();
 	void updateSensors();
+	void updateSensorsAndEkf();
+
+	// pregenerates the simulation steps within [start_time, end_time) at which any sensor sends data
+	void buildStepSchedule(uint64_t start_time, uint64_t end_time);
 
 	std::shared_ptr<Ekf> _ekf{nullptr};
 
 	std::vector<sensor_info> _replay_data{};
+	std::vector<uint64_t> _step_schedule{};
 
 	bool _has_replay_data{false};
 
 	uint64_t _current_replay_data_index{0};
+	uint64_t _replay_update_time_ns{0};
+	uint32_t _replay_update_count{0};
 	uint64_t _time{0}; // microseconds
 
 	Dcmf _R_body_to_world{};
@@ -0,0 +1,106 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "EKF/ekf.h"
+#include "EKF/covariance_prediction.h"
+#include "test_helper/comparison_helper.h"
+
+#include "../EKF/python/ekf_derivation/generated/predict_covariance.h"
+
+using namespace matrix;
+
+static void expectUpperTriangleNear(const SquareMatrixState &P, const SquareMatrixState &P_expected)
+{
+	for (unsigned col = 0; col < State::size; col++) {
+		for (unsigned row = 0; row <= col; row++) {
+			const float tolerance = 1e-5f * fmaxf(1.f, fabsf(P_expected(row, col)));
+			EXPECT_NEAR(P(row, col), P_expected(row, col), tolerance) << "row = " << row << " col = " << col;
+		}
+	}
+}
+
+TEST(CovariancePrediction, sameAsGenerated)
+{
+	const Vector3f accel_var(1e-3f, 2e-3f, 3e-3f);
+	const float gyro_var = 1e-4f;
+	const float dt = 0.01f;
+
+	// GIVEN: various orientations, biases and a random covariance matrix
+	for (float yaw = 0.f; yaw < 2.f * M_PI_F; yaw += M_PI_F / 3.f) {
+		for (float pitch = -M_PI_F / 2.f; pitch < M_PI_F / 2.f; pitch += M_PI_F / 5.f) {
+			StateSample state{};
+			state.quat_nominal = Eulerf(0.3f, pitch, yaw);
+			state.gyro_bias = Vector3f(0.01f, -0.02f, 0.005f);
+			state.accel_bias = Vector3f(0.1f, 0.05f, -0.2f);
+			const Vector3f accel(0.5f, -0.3f, -9.7f);
+
+			SquareMatrixState P = createRandomCovarianceMatrix() * 0.1f;
+
+			const SquareMatrixState P_expected = sym::PredictCovariance(state.vector(), P, accel, accel_var, Vector3f(),
+							     gyro_var, dt);
+
+			// WHEN: predicting the covariance block-wise
+			const unsigned num_propagated = predictCovarianceBlocks(state, P, accel, accel_var, gyro_var, dt);
+
+			// THEN: the upper triangle is the same as the generated one
+			EXPECT_EQ(num_propagated, State::size - kNumKinematicStates);
+			expectUpperTriangleNear(P, P_expected);
+		}
+	}
+}
+
+TEST(CovariancePrediction, decorrelatedStatesSkipped)
+{
+	StateSample state{};
+	state.quat_nominal = Eulerf(0.1f, -0.2f, 1.f);
+	const Vector3f accel(0.f, 0.f, -CONSTANTS_ONE_G);
+	const Vector3f accel_var(1e-3f, 1e-3f, 1e-3f);
+
+	// GIVEN: a covariance matrix where the mag and wind states are decorrelated from the kinematic states
+	SquareMatrixState P = createRandomCovarianceMatrix() * 0.1f;
+	P.uncorrelateCovarianceSetVariance<State::mag_I.dof>(State::mag_I.idx, 0.01f);
+	P.uncorrelateCovarianceSetVariance<State::mag_B.dof>(State::mag_B.idx, 0.01f);
+	P.uncorrelateCovarianceSetVariance<State::wind_vel.dof>(State::wind_vel.idx, 1.f);
+
+	const SquareMatrixState P_expected = sym::PredictCovariance(state.vector(), P, accel, accel_var, Vector3f(), 1e-4f,
+					     0.004f);
+
+	// WHEN: predicting the covariance block-wise
+	const unsigned num_propagated = predictCovarianceBlocks(state, P, accel, accel_var, 1e-4f, 0.004f);
+
+	// THEN: only the terrain cross covariances have been propagated, and the result is unchanged
+	EXPECT_EQ(num_propagated, State::terrain.dof);
+	expectUpperTriangleNear(P, P_expected);
+}
@@ -0,0 +1,315 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include "EKF/ekf.h"
+#include "EKF/covariance_update.h"
+#include "test_helper/comparison_helper.h"
+
+using namespace matrix;
+
+// Matrix implementation of the Joseph stabilized covariance update, used as reference
+static SquareMatrixState josephUpdateReference(const SquareMatrixState &P, const VectorState &K, const VectorState &H,
+		const float R)
+{
+	SquareMatrixState A = matrix::eye<float, State::size>();
+	A -= K.multiplyByTranspose(H);
+	SquareMatrixState P_new = A * P;
+	P_new = P_new.multiplyByTranspose(A);
+
+	const VectorState KR = K * R;
+	P_new += KR.multiplyByTranspose(K);
+	return P_new;
+}
+
+// Previous two step implementation of Ekf::measurementUpdate, used for the benchmark
+static void josephUpdateTwoSteps(SquareMatrixState &P, const VectorState &K, const VectorState &H, const float R)
+{
+	VectorState PH = P * H;
+
+	for (unsigned i = 0; i < State::size; i++) {
+		for (unsigned j = 0; j < State::size; j++) {
+			P(i, j) -= K(i) * PH(j);
+		}
+	}
+
+	PH = P * H;
+
+	for (unsigned i = 0; i < State::size; i++) {
+		for (unsigned j = 0; j <= i; j++) {
+			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
+			P(j, i) = P(i, j);
+		}
+	}
+}
+
+static VectorState createSparseJacobian()
+{
+	// e.g. a magnetometer axis: orientation, earth and body field
+	VectorState H;
+	H.slice<3, 1>(State::quat_nominal.idx, 0) = Vector3f(0.1f, -0.4f, 0.2f);
+	H.slice<3, 1>(State::mag_I.idx, 0) = Vector3f(0.9f, 0.3f, -0.1f);
+	H(State::mag_B.idx) = 1.f;
+	return H;
+}
+
+TEST(CovarianceUpdate, sameAsMatrixImplementation)
+{
+	const float R = 0.05f;
+
+	for (int n = 0; n < 10; n++) {
+		// GIVEN: a random covariance matrix and a sparse observation
+		const SquareMatrixState P = createRandomCovarianceMatrix();
+		const VectorState H = createSparseJacobian();
+
+		const VectorState PH = covarianceTimesJacobian(P, H);
+		EXPECT_TRUE(isEqual(PH, VectorState(P * H), 1e-5f));
+
+		const float HPH = H.dot(PH);
+		VectorState K = PH / (HPH + R);
+
+		// AND: some inhibited states (non optimal gain)
+		K(State::accel_bias.idx + 2) = 0.f;
+		K(State::wind_vel.idx) = 0.f;
+
+		// WHEN: doing the Joseph update on the upper triangle
+		SquareMatrixState P_new = P;
+		josephCovarianceUpdate(P_new, K, PH, HPH, R);
+
+		// THEN: it matches the full matrix implementation and is symmetric
+		const SquareMatrixState P_expected = josephUpdateReference(P, K, H, R);
+
+		for (unsigned row = 0; row < State::size; row++) {
+			for (unsigned col = 0; col < State::size; col++) {
+				EXPECT_NEAR(P_new(row, col), P_expected(row, col), 1e-4f) << "row = " << row << " col = " << col;
+				EXPECT_FLOAT_EQ(P_new(row, col), P_new(col, row));
+			}
+		}
+	}
+}
+
+TEST(CovarianceUpdate, benchmark)
+{
+	static constexpr int kIterations = 20000;
+	const float R = 0.05f;
+	const SquareMatrixState P0 = createRandomCovarianceMatrix();
+	const VectorState H = createSparseJacobian();
+	const VectorState PH0 = P0 * H;
+	const VectorState K = PH0 / (H.dot(PH0) + R);
+
+	// keep the matrices bounded by starting from the same matrix every iteration
+	SquareMatrixState P_two_steps;
+	const auto t0 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < kIterations; i++) {
+		P_two_steps = P0;
+		josephUpdateTwoSteps(P_two_steps, K, H, R);
+	}
+
+	SquareMatrixState P_upper;
+	const auto t1 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < kIterations; i++) {
+		P_upper = P0;
+		const VectorState PH = covarianceTimesJacobian(P_upper, H);
+		josephCovarianceUpdate(P_upper, K, PH, H.dot(PH), R);
+	}
+
+	const auto t2 = std::chrono::steady_clock::now();
+
+	const double two_steps_us = std::chrono::duration<double, std::micro>(t1 - t0).count() / kIterations;
+	const double upper_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / kIterations;
+	printf("measurement update: two steps %.3f us, upper triangle %.3f us\n", two_steps_us, upper_us);
+
+	EXPECT_TRUE(isEqual(P_upper, P_two_steps, 1e-4f));
+}
+
+TEST(CovarianceUpdate, vectorUpdateSameAsSequential)
+{
+	const Vector3f R(0.05f, 0.08f, 0.2f);
+	const int state_index = State::vel.idx;
+
+	for (int n = 0; n < 10; n++) {
+		// GIVEN: a random covariance matrix and a direct observation of three states with uncorrelated noise
+		const SquareMatrixState P = createRandomCovarianceMatrix();
+
+		// WHEN: fusing the three axes sequentially
+		SquareMatrixState P_sequential = P;
+
+		for (int i = 0; i < 3; i++) {
+			const VectorState PH = P_sequential.row(state_index + i);
+			const float HPH = P_sequential(state_index + i, state_index + i);
+			const VectorState K = PH / (HPH + R(i));
+			josephCovarianceUpdate(P_sequential, K, PH, HPH, R(i));
+		}
+
+		// AND: as a single vector update
+		SquareMatrixState P_vector = P;
+		const Matrix<float, State::size, 3> PH = P.slice<State::size, 3>(0, state_index);
+		const SquareMatrix3f S = SquareMatrix3f(P.slice<3, 3>(state_index, state_index)) + diag(R);
+		Matrix<float, State::size, 3> K;
+		ASSERT_TRUE(kalmanGainCholesky(PH, S, K));
+		josephCovarianceUpdate(P_vector, K, PH, S);
+
+		// THEN: the result is the same and symmetric
+		for (unsigned row = 0; row < State::size; row++) {
+			for (unsigned col = 0; col < State::size; col++) {
+				EXPECT_NEAR(P_vector(row, col), P_sequential(row, col), 1e-4f) << "row = " << row << " col = " << col;
+				EXPECT_FLOAT_EQ(P_vector(row, col), P_vector(col, row));
+			}
+		}
+	}
+}
+
+TEST(CovarianceUpdate, vectorUpdateCorrelatedNoise)
+{
+	// GIVEN: a random covariance matrix and a direct observation of three states with correlated noise
+	const SquareMatrixState P = createRandomCovarianceMatrix();
+	const int state_index = State::pos.idx;
+
+	const Dcmf rot(Eulerf(0.3f, -0.2f, 1.1f));
+	const SquareMatrix3f R = rot * diag(Vector3f(0.01f, 0.04f, 0.25f)) * rot.transpose();
+
+	const Matrix<float, State::size, 3> PH = P.slice<State::size, 3>(0, state_index);
+	const SquareMatrix3f S = SquareMatrix3f(P.slice<3, 3>(state_index, state_index)) + R;
+
+	// WHEN: computing the gain with a Cholesky solve
+	Matrix<float, State::size, 3> K;
+	ASSERT_TRUE(kalmanGainCholesky(PH, S, K));
+
+	// THEN: it matches the gain computed with the inverse of the innovation covariance
+	const Matrix<float, State::size, 3> K_expected = PH * S.I();
+	EXPECT_TRUE(isEqual(K, K_expected, 1e-5f));
+
+	// AND: the Joseph update matches the full matrix implementation
+	Matrix<float, State::size, 3> H;
+	H.slice<3, 3>(state_index, 0) = eye<float, 3>();
+
+	SquareMatrixState A = eye<float, State::size>();
+	A -= K * H.transpose();
+	const SquareMatrixState P_expected = A * P * A.transpose() + K * R * K.transpose();
+
+	SquareMatrixState P_new = P;
+	josephCovarianceUpdate(P_new, K, PH, S);
+	EXPECT_TRUE(isEqual(P_new, P_expected, 1e-4f));
+
+	// AND: a non positive definite innovation covariance is rejected
+	EXPECT_FALSE(kalmanGainCholesky(PH, SquareMatrix3f(-S), K));
+}
+
+static SquareMatrixState createCovarianceMatrixWithUnusedStates()
+{
+	// e.g. a vehicle without magnetometer and wind estimation: the states are inhibited and uncorrelated
+	SquareMatrixState P = createRandomCovarianceMatrix();
+	P.uncorrelateCovarianceSetVariance<State::mag_I.dof>(State::mag_I.idx, 0.01f);
+	P.uncorrelateCovarianceSetVariance<State::mag_B.dof>(State::mag_B.idx, 0.01f);
+	P.uncorrelateCovarianceSetVariance<State::wind_vel.dof>(State::wind_vel.idx, 1.f);
+	return P;
+}
+
+static void clearUnusedStatesGain(VectorState &K)
+{
+	K.slice<State::mag_I.dof, 1>(State::mag_I.idx, 0) = 0.f;
+	K.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0) = 0.f;
+	K.slice<State::wind_vel.dof, 1>(State::wind_vel.idx, 0) = 0.f;
+}
+
+TEST(CovarianceUpdate, unusedStatesUnchanged)
+{
+	const float R = 0.05f;
+
+	for (int n = 0; n < 10; n++) {
+		// GIVEN: uncorrelated unused states and a velocity observation
+		const SquareMatrixState P = createCovarianceMatrixWithUnusedStates();
+		VectorState H;
+		H(State::vel.idx + 1) = 1.f;
+
+		const VectorState PH = covarianceTimesJacobian(P, H);
+		VectorState K = PH / (H.dot(PH) + R);
+		clearUnusedStatesGain(K);
+
+		// WHEN: doing the Joseph update on the active states only
+		SquareMatrixState P_new = P;
+		josephCovarianceUpdate(P_new, K, PH, H.dot(PH), R);
+
+		// THEN: it matches the full matrix implementation
+		EXPECT_TRUE(isEqual(P_new, josephUpdateReference(P, K, H, R), 1e-4f));
+
+		// AND: the unused states are left untouched
+		for (unsigned i = State::mag_I.idx; i < State::wind_vel.idx + State::wind_vel.dof; i++) {
+			for (unsigned j = 0; j < State::size; j++) {
+				EXPECT_FLOAT_EQ(P_new(i, j), P(i, j));
+				EXPECT_FLOAT_EQ(P_new(j, i), P(j, i));
+			}
+		}
+	}
+}
+
+TEST(CovarianceUpdate, benchmarkUnusedStates)
+{
+	static constexpr int kIterations = 20000;
+	const float R = 0.05f;
+	const SquareMatrixState P0 = createCovarianceMatrixWithUnusedStates();
+	VectorState H;
+	H(State::pos.idx + 2) = 1.f;
+	const VectorState PH0 = P0 * H;
+	VectorState K = PH0 / (H.dot(PH0) + R);
+	clearUnusedStatesGain(K);
+
+	SquareMatrixState P_two_steps;
+	const auto t0 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < kIterations; i++) {
+		P_two_steps = P0;
+		josephUpdateTwoSteps(P_two_steps, K, H, R);
+	}
+
+	SquareMatrixState P_active;
+	const auto t1 = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < kIterations; i++) {
+		P_active = P0;
+		const VectorState PH = covarianceTimesJacobian(P_active, H);
+		josephCovarianceUpdate(P_active, K, PH, H.dot(PH), R);
+	}
+
+	const auto t2 = std::chrono::steady_clock::now();
+
+	const double two_steps_us = std::chrono::duration<double, std::micro>(t1 - t0).count() / kIterations;
+	const double active_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / kIterations;
+	printf("measurement update with unused states: two steps %.3f us, active states %.3f us\n", two_steps_us, active_us);
+
+	EXPECT_TRUE(isEqual(P_active, P_two_steps, 1e-4f));
+}
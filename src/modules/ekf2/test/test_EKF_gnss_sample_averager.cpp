@@ -0,0 +1,161 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include "EKF/aid_sources/gnss/gnss_sample_averager.h"
+
+using estimator::gnssSample;
+using estimator::GnssSampleAverager;
+using matrix::Vector3f;
+
+class EkfGnssSampleAveragerTest : public ::testing::Test
+{
+public:
+	GnssSampleAverager _averager;
+
+	gnssSample makeSample(uint64_t time_us, double lat, double lon, float alt, const Vector3f &vel)
+	{
+		gnssSample sample{};
+		sample.time_us = time_us;
+		sample.lat = lat;
+		sample.lon = lon;
+		sample.alt = alt;
+		sample.vel = vel;
+		sample.hacc = 0.5f;
+		sample.vacc = 0.8f;
+		sample.sacc = 0.2f;
+		sample.fix_type = 3;
+		sample.nsats = 16;
+		sample.pdop = 1.5f;
+		sample.yaw = NAN;
+		sample.yaw_acc = NAN;
+		sample.yaw_offset = NAN;
+		return sample;
+	}
+};
+
+TEST_F(EkfGnssSampleAveragerTest, passThroughWhenDisabled)
+{
+	const gnssSample sample = makeSample(1000000, 47.1, 8.5, 400.f, Vector3f(1.f, 2.f, 3.f));
+	gnssSample out{};
+
+	EXPECT_TRUE(_averager.update(sample, out));
+	EXPECT_EQ(out.time_us, sample.time_us);
+	EXPECT_DOUBLE_EQ(out.lat, sample.lat);
+	EXPECT_DOUBLE_EQ(out.lon, sample.lon);
+	EXPECT_FLOAT_EQ(out.alt, sample.alt);
+	EXPECT_TRUE(matrix::isEqual(out.vel, sample.vel));
+}
+
+TEST_F(EkfGnssSampleAveragerTest, combineAtOutputRate)
+{
+	// GIVEN: a 50Hz receiver averaged over 100ms
+	_averager.setPeriod(100000);
+
+	int outputs = 0;
+	gnssSample out{};
+
+	for (int i = 0; i < 50; i++) {
+		const uint64_t time_us = 1000000 + i * 20000;
+		// moving north at 2m/s
+		const Vector3f vel(2.f + ((i % 2) ? 0.1f : -0.1f), 0.f, 0.f);
+		const gnssSample sample = makeSample(time_us, 47.0 + i * 3.6e-7, 8.5, 400.f + ((i % 2) ? 0.2f : -0.2f), vel);
+
+		if (_averager.update(sample, out)) {
+			outputs++;
+
+			// THEN: each output is the mean of 5 samples at their mean time
+			EXPECT_EQ(out.time_us, time_us - 40000);
+			EXPECT_NEAR(out.lat, 47.0 + (i - 2) * 3.6e-7, 1e-10);
+			EXPECT_NEAR(out.vel(0), 2.f + ((i % 2) ? 0.02f : -0.02f), 1e-4f);
+			EXPECT_LT(fabsf(out.alt - 400.f), 0.05f);
+			EXPECT_FLOAT_EQ(out.hacc, 0.5f);
+		}
+	}
+
+	EXPECT_EQ(outputs, 10);
+}
+
+TEST_F(EkfGnssSampleAveragerTest, resetOnDataGap)
+{
+	_averager.setPeriod(100000);
+	gnssSample out{};
+
+	EXPECT_FALSE(_averager.update(makeSample(1000000, 47.0, 8.5, 400.f, Vector3f()), out));
+	EXPECT_FALSE(_averager.update(makeSample(1020000, 47.0, 8.5, 400.f, Vector3f()), out));
+
+	// WHEN: the data stops for longer than the averaging period
+	EXPECT_TRUE(_averager.update(makeSample(1500000, 47.1, 8.5, 410.f, Vector3f()), out));
+
+	// THEN: the samples before the gap are not used
+	EXPECT_EQ(out.time_us, 1500000);
+	EXPECT_DOUBLE_EQ(out.lat, 47.1);
+	EXPECT_FLOAT_EQ(out.alt, 410.f);
+}
+
+TEST_F(EkfGnssSampleAveragerTest, resetOnFixTypeChange)
+{
+	_averager.setPeriod(100000);
+	gnssSample out{};
+
+	EXPECT_FALSE(_averager.update(makeSample(1000000, 47.0, 8.5, 400.f, Vector3f()), out));
+
+	gnssSample rtk = makeSample(1020000, 47.0, 8.5, 400.f, Vector3f());
+	rtk.fix_type = 6;
+	_averager.update(rtk, out);
+	EXPECT_EQ(_averager.count(), 1);
+}
+
+TEST_F(EkfGnssSampleAveragerTest, wrapLongitudeAndYaw)
+{
+	// GIVEN: samples on both sides of the antimeridian with a heading close to +-pi
+	_averager.setPeriod(40000);
+	gnssSample out{};
+
+	gnssSample sample = makeSample(1000000, 0.0, 179.99999, 0.f, Vector3f());
+	sample.yaw = M_PI_F - 0.01f;
+	sample.yaw_acc = 0.1f;
+	EXPECT_FALSE(_averager.update(sample, out));
+
+	sample = makeSample(1020000, 0.0, -179.99999, 0.f, Vector3f());
+	sample.yaw = -M_PI_F + 0.01f;
+	sample.yaw_acc = 0.1f;
+	EXPECT_TRUE(_averager.update(sample, out));
+
+	// THEN: the mean is on the antimeridian and the heading is pi
+	EXPECT_NEAR(fabs(out.lon), 180.0, 1e-9);
+	EXPECT_NEAR(fabsf(out.yaw), M_PI_F, 1e-5f);
+	EXPECT_FLOAT_EQ(out.yaw_acc, 0.1f);
+}
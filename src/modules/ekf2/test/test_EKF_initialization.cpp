@@ -308,6 +308,46 @@ TEST_F(EkfInitializationTest, initializeHeadingWithZeroTilt)
 	learningCorrectAccelBias();
 }
 
+TEST_F(EkfInitializationTest, initializeHeadingFromWarmStart)
+{
+	// GIVEN: a vehicle without heading sensor and the yaw saved before the last power down
+	const float yaw = math::radians(-120.0f);
+	const Quatf quat_sim(Eulerf(0.f, 0.f, yaw));
+
+	_ekf_wrapper.setMagFuseTypeNone();
+	_ekf->setWarmStartYaw(yaw, sq(math::radians(2.f)));
+
+	// WHEN: the tilt gets aligned at rest
+	_sensor_simulator.simulateOrientation(quat_sim);
+	_sensor_simulator.runSeconds(_init_tilt_period);
+
+	// THEN: the heading is aligned to the warm start yaw
+	EXPECT_TRUE(_ekf->control_status_flags().tilt_align);
+	EXPECT_TRUE(_ekf->control_status_flags().yaw_align);
+	EXPECT_FALSE(_ekf->control_status_flags().mag_hdg);
+	EXPECT_FALSE(_ekf->control_status_flags().mag);
+
+	EXPECT_NEAR(Eulerf(_ekf->getQuaternion()).psi(), yaw, math::radians(0.1f));
+	EXPECT_LT(_ekf->getYawVar(), sq(math::radians(3.f)));
+}
+
+TEST_F(EkfInitializationTest, warmStartIgnoredWithMagnetometer)
+{
+	// GIVEN: a warm start yaw that does not match the magnetometer heading
+	const float yaw = math::radians(90.0f);
+	const Quatf quat_sim(Eulerf(0.f, 0.f, yaw));
+
+	_ekf->setWarmStartYaw(math::radians(-30.f), sq(math::radians(2.f)));
+
+	// WHEN: the tilt gets aligned at rest
+	_sensor_simulator.simulateOrientation(quat_sim);
+	_sensor_simulator.runSeconds(_init_tilt_period);
+
+	// THEN: the heading is aligned with the magnetometer
+	EXPECT_TRUE(_ekf->control_status_flags().yaw_align);
+	initializedOrienationIsMatchingGroundTruth(quat_sim);
+}
+
 TEST_F(EkfInitializationTest, initializeWithTilt)
 {
 	const float pitch = math::radians(30.0f);
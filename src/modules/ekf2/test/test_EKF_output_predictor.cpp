@@ -0,0 +1,138 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include "EKF/output_predictor/output_predictor.h"
+
+using namespace matrix;
+
+class OutputPredictorTest : public ::testing::Test
+{
+public:
+	static constexpr uint8_t kFifoSize = 8; // e.g. 8 kHz gyro FIFO published at 1 kHz
+	static constexpr float kDt = 1.f / 8000.f;
+
+	void SetUp() override
+	{
+		for (OutputPredictor *op : {&_single, &_batch}) {
+			op->allocate(12);
+			op->set_imu_offset(Vector3f(0.05f, -0.02f, 0.1f));
+			op->alignOutputFilter(Quatf(Eulerf(0.1f, -0.2f, 1.5f)), Vector3f(1.f, -2.f, 0.5f), LatLonAlt(47.0, 8.0, 400.f));
+		}
+	}
+
+	// rotating and accelerating vehicle
+	void getImuSample(int i, Vector3f &delta_angle, Vector3f &delta_velocity) const
+	{
+		const float t = i * kDt;
+		delta_angle = Vector3f(2.f * sinf(3.f * t), 1.f * cosf(2.f * t), 4.f) * kDt;
+		delta_velocity = Vector3f(1.f * sinf(t), -0.5f, -CONSTANTS_ONE_G + cosf(5.f * t)) * kDt;
+	}
+
+	OutputPredictor _single;
+	OutputPredictor _batch;
+};
+
+TEST_F(OutputPredictorTest, batchSameAsSingleSamples)
+{
+	const uint64_t t0_us = 1'000'000;
+	const uint64_t dt_us = 125;
+
+	for (int batch = 0; batch < 1000; batch++) {
+		Vector3f delta_angle[kFifoSize];
+		Vector3f delta_velocity[kFifoSize];
+		uint64_t time_us = 0;
+
+		// WHEN: processing the same IMU data sample by sample and in batches
+		for (int i = 0; i < kFifoSize; i++) {
+			const int sample = batch * kFifoSize + i;
+			time_us = t0_us + sample * dt_us;
+			getImuSample(sample, delta_angle[i], delta_velocity[i]);
+			_single.calculateOutputStates(time_us, delta_angle[i], kDt, delta_velocity[i], kDt);
+		}
+
+		_batch.calculateOutputStates(time_us, delta_angle, delta_velocity, kFifoSize, kDt);
+	}
+
+	// THEN: the outputs are the same
+	const Quatf q_single = _single.getQuaternion();
+	const Quatf q_batch = _batch.getQuaternion();
+	EXPECT_LT((q_single.inversed() * q_batch).imag().norm(), 1e-4f);
+	EXPECT_TRUE(isEqual(_single.getVelocity(), _batch.getVelocity(), 1e-3f));
+	EXPECT_TRUE(isEqual(_single.getVelocityDerivative(), _batch.getVelocityDerivative(), 1e-3f));
+	EXPECT_NEAR(_single.getVerticalPositionDerivative(), _batch.getVerticalPositionDerivative(), 1e-3f);
+	EXPECT_NEAR(_single.getUnaidedYaw(), _batch.getUnaidedYaw(), 1e-4f);
+
+	const LatLonAlt lla_single = _single.getLatLonAlt();
+	const LatLonAlt lla_batch = _batch.getLatLonAlt();
+	EXPECT_LT((lla_single - lla_batch).norm(), 1e-2f);
+}
+
+TEST_F(OutputPredictorTest, benchmark)
+{
+	static constexpr int kBatches = 20000;
+	Vector3f delta_angle[kFifoSize];
+	Vector3f delta_velocity[kFifoSize];
+
+	for (int i = 0; i < kFifoSize; i++) {
+		getImuSample(i, delta_angle[i], delta_velocity[i]);
+	}
+
+	uint64_t time_us = 1'000'000;
+	const auto t0 = std::chrono::steady_clock::now();
+
+	for (int batch = 0; batch < kBatches; batch++) {
+		for (int i = 0; i < kFifoSize; i++) {
+			time_us += 125;
+			_single.calculateOutputStates(time_us, delta_angle[i], kDt, delta_velocity[i], kDt);
+		}
+	}
+
+	const auto t1 = std::chrono::steady_clock::now();
+	time_us = 1'000'000;
+
+	for (int batch = 0; batch < kBatches; batch++) {
+		time_us += kFifoSize * 125;
+		_batch.calculateOutputStates(time_us, delta_angle, delta_velocity, kFifoSize, kDt);
+	}
+
+	const auto t2 = std::chrono::steady_clock::now();
+
+	const double single_us = std::chrono::duration<double, std::micro>(t1 - t0).count() / kBatches;
+	const double batch_us = std::chrono::duration<double, std::micro>(t2 - t1).count() / kBatches;
+	printf("output predictor latency for %d samples: single %.3f us, batch %.3f us\n", kFifoSize, single_us, batch_us);
+
+	EXPECT_TRUE(_batch.getQuaternion().isAllFinite());
+}
@@ -158,3 +158,106 @@ TEST_F(EkfRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+TEST_F(EkfRingBufferTest, popAfterWrapAround)
+{
+	// GIVEN: a buffer that wrapped around several times
+	ASSERT_EQ(true, _buffer->allocate(5));
+
+	sample s{};
+
+	for (int i = 1; i <= 12; i++) {
+		s.time_us = i * 10000;
+		s.data[0] = (float)i;
+		_buffer->push(s);
+	}
+
+	// THEN: only the 5 newest samples are left
+	sample pop = {};
+	EXPECT_EQ(false, _buffer->pop_first_older_than(75000, &pop));
+
+	// WHEN: asking for a timestamp between two samples
+	// THEN: we should get the newest sample that is older
+	EXPECT_EQ(true, _buffer->pop_first_older_than(95000, &pop));
+	EXPECT_EQ(90000u, pop.time_us);
+	EXPECT_FLOAT_EQ(9.f, pop.data[0]);
+
+	// AND: the older samples are discarded
+	EXPECT_EQ(100000u, _buffer->get_oldest().time_us);
+
+	EXPECT_EQ(true, _buffer->pop_first_older_than(120000, &pop));
+	EXPECT_EQ(120000u, pop.time_us);
+	EXPECT_EQ(false, _buffer->pop_first_older_than(200000, &pop));
+}
+
+TEST_F(EkfRingBufferTest, popSameAsLinearSearch)
+{
+	// GIVEN: a buffer with samples at irregular intervals
+	ASSERT_EQ(true, _buffer->allocate(7));
+
+	uint64_t t = 1000000;
+	uint64_t pushed[32] {};
+	int num_pushed = 0;
+
+	for (int i = 0; i < 32; i++) {
+		t += 3000 + (i * 7919) % 40000;
+		sample s{};
+		s.time_us = t;
+		_buffer->push(s);
+		pushed[num_pushed++] = t;
+
+		// WHEN: popping with a query time every few samples
+		if (i % 3 == 2) {
+			const uint64_t query = t - (i * 104729) % 60000;
+
+			// THEN: the result is the newest pushed and not yet popped sample not newer than the query
+			// and at most 0.1 s older, samples older than it are discarded
+			int expected = -1;
+
+			for (int k = num_pushed - 1; k >= 0; k--) {
+				if (pushed[k] != 0 && pushed[k] <= query) {
+					if (query < pushed[k] + 100000 && (num_pushed - k) <= 7) {
+						expected = k;
+					}
+
+					break;
+				}
+			}
+
+			sample pop = {};
+			EXPECT_EQ(expected >= 0, _buffer->pop_first_older_than(query, &pop));
+
+			if (expected >= 0) {
+				EXPECT_EQ(pushed[expected], pop.time_us);
+
+				for (int k = 0; k <= expected; k++) {
+					pushed[k] = 0;
+				}
+			}
+		}
+	}
+}
+
+TEST_F(EkfRingBufferTest, popOutOfOrderSamples)
+{
+	// GIVEN: samples that were not pushed in chronological order
+	ASSERT_EQ(true, _buffer->allocate(3));
+	_buffer->push(_x);
+	_buffer->push(_z);
+	_buffer->push(_y);
+
+	// WHEN: popping
+	// THEN: the search starts from the newest sample
+	sample pop = {};
+	EXPECT_EQ(true, _buffer->pop_first_older_than(_z.time_us + 10, &pop));
+	EXPECT_EQ(_z.time_us, pop.time_us);
+
+	// AND: once emptied, the buffer is ordered again
+	EXPECT_EQ(true, _buffer->pop_first_older_than(_y.time_us + 10, &pop));
+	EXPECT_EQ(_y.time_us, pop.time_us);
+
+	_buffer->push(_x);
+	_buffer->push(_z);
+	EXPECT_EQ(true, _buffer->pop_first_older_than(_x.time_us + 10, &pop));
+	EXPECT_EQ(_x.time_us, pop.time_us);
+}
@@ -96,7 +96,7 @@ TEST_F(EKFYawEstimatorTest, inAirYawAlignment)
 	// THEN: the heading can be estimated and then used to fuse GNSS vel and pos to the main EKF
 	float yaw_est{};
 	float yaw_est_var{};
-	float dummy[5];
+	float dummy[N_MODELS_EKFGSF];
 	_ekf->getDataEKFGSF(&yaw_est, &yaw_est_var, dummy, dummy, dummy, dummy);
 
 	const float tolerance_rad = math::radians(5.f);
@@ -52,8 +52,6 @@ EscBattery::init()
 		return false;
 	}
 
-	_esc_status_sub.set_interval_us(ESC_BATTERY_INTERVAL_US);
-
 	return true;
 }
 
@@ -82,7 +80,7 @@ EscBattery::Run()
 
 	esc_status_s esc_status;
 
-	if (_esc_status_sub.copy(&esc_status)) {
+	if (_esc_status_sub.update(&esc_status)) {
 
 		if (esc_status.esc_count == 0 || esc_status.esc_count > esc_status_s::CONNECTED_ESC_MAX) {
 			return;
@@ -101,10 +99,14 @@ EscBattery::Run()
 
 		average_voltage_v /= online_esc_count;
 
+		// integrate the current of every ESC report, the estimation runs at ESC_BATTERY_INTERVAL_US
 		_battery.setConnected(true);
 		_battery.updateVoltage(average_voltage_v);
-		_battery.updateCurrent(total_current_a);
-		_battery.updateAndPublishBatteryStatus(esc_status.timestamp);
+		_battery.integrateCurrent(esc_status.timestamp, total_current_a);
+
+		if (esc_status.timestamp >= _battery.lastStatusUpdate() + ESC_BATTERY_INTERVAL_US * 3 / 4) {
+			_battery.updateAndPublishBatteryStatus(esc_status.timestamp);
+		}
 	}
 }
 
@@ -73,6 +73,6 @@ private:
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 	uORB::SubscriptionCallbackWorkItem _esc_status_sub{this, ORB_ID(esc_status)};
 
-	static constexpr uint32_t ESC_BATTERY_INTERVAL_US = 20_ms; // assume higher frequency esc feedback than 50Hz
+	static constexpr uint32_t ESC_BATTERY_INTERVAL_US = 20_ms; // battery estimation rate, the current is integrated at the esc feedback rate
 	Battery _battery;
 };
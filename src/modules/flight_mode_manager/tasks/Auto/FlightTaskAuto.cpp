@@ -472,6 +472,10 @@ bool FlightTaskAuto::_evaluateTriplets()
 		_next_was_valid = _sub_triplet_setpoint.get().next.valid;
 	}
 
+	if (_sub_mission_lookahead.update() || triplet_update) {
+		_updateLookahead();
+	}
+
 	// activation/deactivation of weather vane is based on parameter WV_EN and setting of navigator (allow_weather_vane)
 	_weathervane.setNavigatorForceDisabled(PX4_ISFINITE(_sub_triplet_setpoint.get().current.yaw));
 
@@ -594,6 +598,37 @@ bool FlightTaskAuto::_isFinite(const position_setpoint_s &sp)
 	return (PX4_ISFINITE(sp.lat) && PX4_ISFINITE(sp.lon) && PX4_ISFINITE(sp.alt));
 }
 
+void FlightTaskAuto::_updateLookahead()
+{
+	const mission_lookahead_s &lookahead = _sub_mission_lookahead.get();
+	const position_setpoint_triplet_s &triplet = _sub_triplet_setpoint.get();
+	const int num_items = math::min(static_cast<int>(lookahead.num_items), PositionSmoothing::MAX_LOOKAHEAD_WAYPOINTS);
+
+	// the lookahead has to start with the current and next setpoint, otherwise it belongs to another triplet
+	const bool continues_triplet = (num_items >= 3)
+				       && triplet.current.valid && triplet.next.valid && _reference_position.isInitialized()
+				       && (fabs(lookahead.lat[0] - triplet.current.lat) < DBL_EPSILON)
+				       && (fabs(lookahead.lon[0] - triplet.current.lon) < DBL_EPSILON)
+				       && (fabs(lookahead.lat[1] - triplet.next.lat) < DBL_EPSILON)
+				       && (fabs(lookahead.lon[1] - triplet.next.lon) < DBL_EPSILON);
+
+	if (!continues_triplet) {
+		_position_smoothing.setLookaheadWaypoints(nullptr, 0);
+		return;
+	}
+
+	Vector3f waypoints[PositionSmoothing::MAX_LOOKAHEAD_WAYPOINTS];
+	waypoints[0] = _triplet_target;
+	waypoints[1] = _triplet_next_wp;
+
+	for (int i = 2; i < num_items; i++) {
+		_reference_position.project(lookahead.lat[i], lookahead.lon[i], waypoints[i](0), waypoints[i](1));
+		waypoints[i](2) = -(lookahead.alt[i] - _reference_altitude);
+	}
+
+	_position_smoothing.setLookaheadWaypoints(waypoints, num_items);
+}
+
 bool FlightTaskAuto::_evaluateGlobalReference()
 {
 	// check if reference has changed and update.
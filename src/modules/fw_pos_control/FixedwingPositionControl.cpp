@@ -1301,7 +1301,19 @@ FixedwingPositionControl::control_auto_loiter(const float control_interval, cons
 
 	_npfg.setAirspeedNom(target_airspeed * _eas2tas);
 	_npfg.setAirspeedMax(_performance_model.getMaximumCalibratedAirspeed() * _eas2tas);
-	navigateLoiter(curr_wp_local, curr_pos_local, loiter_radius, pos_sp_curr.loiter_direction_counter_clockwise,
+
+	bool loiter_direction_counter_clockwise = pos_sp_curr.loiter_direction_counter_clockwise;
+
+	if (_param_fw_ltr_dir_sel.get() && !close_to_circle) {
+		loiter_direction_counter_clockwise = selectLoiterDirection(curr_wp_local, curr_pos_local, loiter_radius,
+						     loiter_direction_counter_clockwise, ground_speed, _wind_vel);
+
+	} else if (_param_fw_ltr_dir_sel.get() && (curr_wp_local - _loiter_direction_center).norm() < 0.1f) {
+		// keep the direction selected on the way to the circle
+		loiter_direction_counter_clockwise = _loiter_direction_counter_clockwise;
+	}
+
+	navigateLoiter(curr_wp_local, curr_pos_local, loiter_radius, loiter_direction_counter_clockwise,
 		       ground_speed,
 		       _wind_vel);
 	float roll_body = getCorrectedNpfgRollSetpoint();
@@ -3223,6 +3235,21 @@ void FixedwingPositionControl::navigateLine(const Vector2f &point_on_line, const
 
 void FixedwingPositionControl::navigateLoiter(const Vector2f &loiter_center, const Vector2f &vehicle_pos,
 		float radius, bool loiter_direction_counter_clockwise, const Vector2f &ground_vel, const Vector2f &wind_vel)
+{
+	Vector2f unit_path_tangent;
+	Vector2f position_on_path;
+	float path_curvature;
+	getLoiterPath(loiter_center, vehicle_pos, radius, loiter_direction_counter_clockwise, ground_vel, unit_path_tangent,
+		      position_on_path, path_curvature);
+
+	_target_bearing = atan2f(unit_path_tangent(1), unit_path_tangent(0));
+	_closest_point_on_path = position_on_path;
+	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, unit_path_tangent, position_on_path, path_curvature);
+}
+
+void FixedwingPositionControl::getLoiterPath(const Vector2f &loiter_center, const Vector2f &vehicle_pos, float radius,
+		bool loiter_direction_counter_clockwise, const Vector2f &ground_vel, Vector2f &unit_path_tangent,
+		Vector2f &position_on_path, float &path_curvature) const
 {
 	const float loiter_direction_multiplier = loiter_direction_counter_clockwise ? -1.f : 1.f;
 
@@ -3251,13 +3278,66 @@ void FixedwingPositionControl::navigateLoiter(const Vector2f &loiter_center, con
 	}
 
 	// 90 deg clockwise rotation * loiter direction
-	const Vector2f unit_path_tangent = loiter_direction_multiplier * Vector2f{-unit_vec_center_to_closest_pt(1), unit_vec_center_to_closest_pt(0)};
+	unit_path_tangent = loiter_direction_multiplier * Vector2f{-unit_vec_center_to_closest_pt(1), unit_vec_center_to_closest_pt(0)};
 
-	float path_curvature = loiter_direction_multiplier / radius;
-	_target_bearing = atan2f(unit_path_tangent(1), unit_path_tangent(0));
-	_closest_point_on_path = unit_vec_center_to_closest_pt * radius + loiter_center;
-	_npfg.guideToPath(vehicle_pos, ground_vel, wind_vel, unit_path_tangent,
-			  loiter_center + unit_vec_center_to_closest_pt * radius, path_curvature);
+	path_curvature = loiter_direction_multiplier / radius;
+	position_on_path = loiter_center + unit_vec_center_to_closest_pt * radius;
+}
+
+bool FixedwingPositionControl::selectLoiterDirection(const Vector2f &loiter_center, const Vector2f &vehicle_pos,
+		float radius, bool loiter_direction_counter_clockwise, const Vector2f &ground_vel, const Vector2f &wind_vel)
+{
+	if ((loiter_center - _loiter_direction_center).norm() < 0.1f) {
+		// already selected for this loiter, never switch while circling
+		return _loiter_direction_counter_clockwise;
+	}
+
+	// candidate 0: clockwise, candidate 1: counter-clockwise
+	static constexpr int num_candidates = 2;
+	NPFG::PathCandidates candidates;
+	candidates.num = num_candidates;
+
+	for (int i = 0; i < num_candidates; i++) {
+		Vector2f unit_path_tangent;
+		Vector2f position_on_path;
+		getLoiterPath(loiter_center, vehicle_pos, radius, i == 1, ground_vel, unit_path_tangent, position_on_path,
+			      candidates.path_curvature[i]);
+		candidates.unit_path_tangent_x[i] = unit_path_tangent(0);
+		candidates.unit_path_tangent_y[i] = unit_path_tangent(1);
+		candidates.position_on_path_x[i] = position_on_path(0);
+		candidates.position_on_path_y[i] = position_on_path(1);
+	}
+
+	NPFG::PathEvaluation evaluation;
+	_npfg.evaluatePaths(vehicle_pos, ground_vel, wind_vel, candidates, evaluation);
+
+	// energy rate to reach the airspeed reference of each candidate (e.g. incremented in excess wind) on the same altitude
+	const float true_airspeed = math::max(_airspeed_eas * _eas2tas, FLT_EPSILON);
+	float height_rate[num_candidates] {};
+	float tas[num_candidates];
+	float tas_rate[num_candidates];
+	float energy_cost[num_candidates];
+
+	for (int i = 0; i < num_candidates; i++) {
+		tas[i] = true_airspeed;
+		tas_rate[i] = (evaluation.airspeed_ref[i] - true_airspeed) / math::max(_param_fw_t_tas_error_tc.get(), 0.1f);
+	}
+
+	_tecs.evaluateEnergyDemand(height_rate, tas, tas_rate, energy_cost, num_candidates);
+
+	const float cost_clockwise = evaluation.cost[0] + energy_cost[0];
+	const float cost_counter_clockwise = evaluation.cost[1] + energy_cost[1];
+
+	if (loiter_direction_counter_clockwise) {
+		_loiter_direction_counter_clockwise = !(cost_clockwise + LOITER_DIRECTION_COST_HYSTERESIS < cost_counter_clockwise);
+
+	} else {
+		_loiter_direction_counter_clockwise = cost_counter_clockwise + LOITER_DIRECTION_COST_HYSTERESIS < cost_clockwise;
+	}
+
+	_loiter_direction_center = loiter_center;
+
+	return _loiter_direction_counter_clockwise;
 }
 
 void FixedwingPositionControl::navigatePathTangent(const matrix::Vector2f &vehicle_pos,
@@ -178,6 +178,9 @@ static constexpr float ROLL_WARNING_CAN_RUN_THRESHOLD = 0.9f;
 // [s] slew rate with which we change altitude time constant
 static constexpr float TECS_ALT_TIME_CONST_SLEW_RATE = 1.0f;
 
+// [-] Cost advantage the other loiter direction needs before it is selected over the commanded one
+static constexpr float LOITER_DIRECTION_COST_HYSTERESIS = 0.1f;
+
 class FixedwingPositionControl final : public ModuleBase<FixedwingPositionControl>, public ModuleParams,
 	public px4::WorkItem
 {
@@ -439,6 +442,9 @@ private:
 	float _min_current_sp_distance_xy{FLT_MAX};
 	float _target_bearing{0.0f}; // [rad]
 
+	matrix::Vector2f _loiter_direction_center{NAN, NAN}; ///< loiter center the loiter direction was selected for [m]
+	bool _loiter_direction_counter_clockwise{false}; ///< selected loiter direction, see FW_LTR_DIR_SEL
+
 #ifdef CONFIG_FIGURE_OF_EIGHT
 	/* Loitering */
 	FigureEight _figure_eight;
@@ -919,6 +925,39 @@ private:
 			    float radius, bool loiter_direction_counter_clockwise, const matrix::Vector2f &ground_vel,
 			    const matrix::Vector2f &wind_vel);
 
+	/*
+	 * Path on the loiter circle to track from the vehicle position.
+	 *
+	 * @param[in] loiter_center The position of the center of the loiter circle [m]
+	 * @param[in] vehicle_pos Vehicle position in local coordinates. (N,E) [m]
+	 * @param[in] radius Loiter radius [m]
+	 * @param[in] loiter_direction_counter_clockwise Specifies loiter direction
+	 * @param[in] ground_vel Vehicle ground velocity vector [m/s]
+	 * @param[out] unit_path_tangent Unit vector tangent to the circle at the closest point
+	 * @param[out] position_on_path Closest point on the circle [m]
+	 * @param[out] path_curvature Signed curvature of the circle [m^-1]
+	 */
+	void getLoiterPath(const matrix::Vector2f &loiter_center, const matrix::Vector2f &vehicle_pos, float radius,
+			   bool loiter_direction_counter_clockwise, const matrix::Vector2f &ground_vel,
+			   matrix::Vector2f &unit_path_tangent, matrix::Vector2f &position_on_path, float &path_curvature) const;
+
+	/*
+	 * Selects the loiter direction with the lower guidance (NPFG) and energy (TECS) cost to enter
+	 * the loiter circle from the current state. The direction is selected once per loiter center.
+	 * NPFG airspeed references must be set before calling this.
+	 *
+	 * @param[in] loiter_center The position of the center of the loiter circle [m]
+	 * @param[in] vehicle_pos Vehicle position in local coordinates. (N,E) [m]
+	 * @param[in] radius Loiter radius [m]
+	 * @param[in] loiter_direction_counter_clockwise Commanded loiter direction, kept unless the other one is clearly cheaper
+	 * @param[in] ground_vel Vehicle ground velocity vector [m/s]
+	 * @param[in] wind_vel Wind velocity vector [m/s]
+	 * @return true if the loiter should be flown counter-clockwise
+	 */
+	bool selectLoiterDirection(const matrix::Vector2f &loiter_center, const matrix::Vector2f &vehicle_pos, float radius,
+				   bool loiter_direction_counter_clockwise, const matrix::Vector2f &ground_vel,
+				   const matrix::Vector2f &wind_vel);
+
 	/*
 	 * Path following logic. Takes poisiton, path tangent, curvature and
 	 * then updates control setpoints to follow a path setpoint.
@@ -976,6 +1015,7 @@ private:
 		(ParamFloat<px4::params::FW_LND_THRTC_SC>) _param_fw_thrtc_sc,
 		(ParamFloat<px4::params::FW_T_THR_LOW_HGT>) _param_fw_t_thr_low_hgt,
 		(ParamBool<px4::params::FW_LND_EARLYCFG>) _param_fw_lnd_earlycfg,
+		(ParamBool<px4::params::FW_LTR_DIR_SEL>) _param_fw_ltr_dir_sel,
 		(ParamInt<px4::params::FW_LND_USETER>) _param_fw_lnd_useter,
 
 		(ParamFloat<px4::params::FW_P_LIM_MAX>) _param_fw_p_lim_max,
@@ -234,6 +234,19 @@ PARAM_DEFINE_FLOAT(FW_P_LIM_MAX, 30.0f);
  */
 PARAM_DEFINE_FLOAT(FW_R_LIM, 50.0f);
 
+/**
+ * Loiter direction selection
+ *
+ * If enabled, the loiter direction of a loiter the vehicle is approaching from outside the circle
+ * is selected from the guidance effort and energy demand to enter it in the current wind.
+ * The commanded direction is kept unless the other one is clearly cheaper, and
+ * the direction doesn't change anymore once the vehicle is close to the circle.
+ *
+ * @boolean
+ * @group FW Path Control
+ */
+PARAM_DEFINE_INT32(FW_LTR_DIR_SEL, 0);
+
 /**
  * Throttle limit max
  *
@@ -274,3 +274,32 @@ PARAM_DEFINE_FLOAT(MNT_LND_P_MIN, -90.0f);
 * @group Mount
 */
 PARAM_DEFINE_FLOAT(MNT_LND_P_MAX, 90.0f);
+
+/**
+* Fast stabilization for AUX output
+*
+* Apply the vehicle attitude compensation and update the gimbal outputs on
+* every vehicle attitude update instead of at the rate of the gimbal input
+* processing. Only used with MNT_MODE_OUT set to AUX.
+*
+* @boolean
+* @reboot_required true
+* @group Mount
+*/
+PARAM_DEFINE_INT32(MNT_STAB_FAST, 0);
+
+/**
+* Vehicle rate feed-forward for fast stabilization
+*
+* The vehicle attitude is extrapolated with the vehicle angular rates by this
+* time before it is compensated, to make up for the delay of the gimbal servos.
+* Only used with MNT_STAB_FAST enabled.
+*
+* @min 0.0
+* @max 0.1
+* @unit s
+* @decimal 3
+* @increment 0.001
+* @group Mount
+*/
+PARAM_DEFINE_FLOAT(MNT_STAB_FF, 0.0f);
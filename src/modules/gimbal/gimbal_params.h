@@ -62,6 +62,8 @@ struct Parameters {
 	int32_t mnt_rc_in_mode;
 	float mnt_lnd_p_min;
 	float mnt_lnd_p_max;
+	int32_t mnt_stab_fast;
+	float mnt_stab_ff;
 };
 
 struct ParameterHandles {
@@ -86,6 +88,8 @@ struct ParameterHandles {
 	param_t mnt_rc_in_mode;
 	param_t mnt_lnd_p_min;
 	param_t mnt_lnd_p_max;
+	param_t mnt_stab_fast;
+	param_t mnt_stab_ff;
 };
 
 } /* namespace gimbal */
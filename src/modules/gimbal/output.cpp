@@ -254,6 +254,8 @@ void OutputBase::_calculate_angle_output(const hrt_abstime &t)
 			_angle_outputs[i] += dt * _angle_velocity[i];
 		}
 
+		_angle_targets[i] = _angle_outputs[i];
+
 		if (compensate[i] && PX4_ISFINITE(euler_vehicle(i))) {
 			_angle_outputs[i] -= euler_vehicle(i);
 		}
@@ -97,16 +97,17 @@ protected:
 	void _calculate_angle_output(const hrt_abstime &t);
 
 	float _angle_outputs[3] = { 0.f, 0.f, 0.f }; ///< calculated output angles (roll, pitch, yaw) [rad]
+	float _angle_targets[3] = { 0.f, 0.f, 0.f }; ///< output angles before the vehicle attitude compensation [rad]
 	hrt_abstime _last_update;
 
+	bool _landed{true};
+
 private:
 	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
 	uORB::Subscription _vehicle_global_position_sub{ORB_ID(vehicle_global_position)};
 	uORB::Subscription _vehicle_land_detected_sub{ORB_ID(vehicle_land_detected)};
 
 	uORB::Publication<mount_orientation_s> _mount_orientation_pub{ORB_ID(mount_orientation)};
-
-	bool _landed{true};
 };
 
 
@@ -46,6 +46,20 @@ namespace gimbal
 OutputRC::OutputRC(const Parameters &parameters)
 	: OutputBase(parameters)
 {
+	if (_parameters.mnt_stab_fast == 1) {
+		_stabilizer = new Stabilizer();
+
+		if (_stabilizer == nullptr || !_stabilizer->start()) {
+			PX4_ERR("stabilizer start failed");
+			delete _stabilizer;
+			_stabilizer = nullptr;
+		}
+	}
+}
+
+OutputRC::~OutputRC()
+{
+	delete _stabilizer;
 }
 
 void OutputRC::update(const ControlData &control_data, bool new_setpoints, uint8_t &gimbal_device_id)
@@ -65,6 +79,13 @@ void OutputRC::update(const ControlData &control_data, bool new_setpoints, uint8
 	// If the output is RC, then we signal this by referring to compid 1.
 	gimbal_device_id = 1;
 
+	if (_stabilizer) {
+		// the output is published by the stabilizer at the attitude rate
+		_update_stabilizer_setpoint(now);
+		_last_update = now;
+		return;
+	}
+
 	// _angle_outputs are in radians, gimbal_controls are in [-1, 1]
 	gimbal_controls_s gimbal_controls{};
 	gimbal_controls.control[gimbal_controls_s::INDEX_ROLL] = constrain(
@@ -88,6 +109,37 @@ void OutputRC::update(const ControlData &control_data, bool new_setpoints, uint8
 void OutputRC::print_status() const
 {
 	PX4_INFO("Output: AUX");
+
+	if (_stabilizer) {
+		_stabilizer->print_status();
+	}
+}
+
+void OutputRC::_update_stabilizer_setpoint(const hrt_abstime &now)
+{
+	Stabilizer::Setpoint setpoint{};
+	setpoint.timestamp = now;
+
+	for (int i = 0; i < 3; ++i) {
+		setpoint.angles[i] = _angle_targets[i];
+		setpoint.compensate[i] = _stabilize[i] && _absolute_angle[i];
+	}
+
+	setpoint.landed = _landed;
+	setpoint.landed_pitch_min = math::radians(_parameters.mnt_lnd_p_min);
+	setpoint.landed_pitch_max = math::radians(_parameters.mnt_lnd_p_max);
+
+	setpoint.offset[0] = math::radians(_parameters.mnt_off_roll);
+	setpoint.offset[1] = math::radians(_parameters.mnt_off_pitch);
+	setpoint.offset[2] = math::radians(_parameters.mnt_off_yaw);
+
+	setpoint.range[0] = math::radians(_parameters.mnt_range_roll);
+	setpoint.range[1] = math::radians(_parameters.mnt_range_pitch);
+	setpoint.range[2] = math::radians(_parameters.mnt_range_yaw);
+
+	setpoint.rate_feed_forward = _parameters.mnt_stab_ff;
+
+	_stabilizer->set_setpoint(setpoint);
 }
 
 void OutputRC::_stream_device_attitude_status()
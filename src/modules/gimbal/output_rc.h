@@ -35,6 +35,7 @@
 #pragma once
 
 #include "output.h"
+#include "stabilizer.h"
 
 #include <uORB/Publication.hpp>
 #include <uORB/topics/gimbal_controls.h>
@@ -48,13 +49,16 @@ class OutputRC : public OutputBase
 public:
 	OutputRC() = delete;
 	explicit OutputRC(const Parameters &parameters);
-	virtual ~OutputRC() = default;
+	virtual ~OutputRC();
 
 	virtual void update(const ControlData &control_data, bool new_setpoints, uint8_t &gimbal_device_id);
 	virtual void print_status() const;
 
 private:
 	void _stream_device_attitude_status();
+	void _update_stabilizer_setpoint(const hrt_abstime &now);
+
+	Stabilizer *_stabilizer{nullptr}; ///< fast stabilization path, if enabled with MNT_STAB_FAST
 
 	uORB::Publication <gimbal_controls_s>	_gimbal_controls_pub{ORB_ID(gimbal_controls)};
 	uORB::Publication <gimbal_device_attitude_status_s>	_attitude_status_pub{ORB_ID(gimbal_device_attitude_status)};
@@ -0,0 +1,188 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+
+#include "stabilizer.h"
+
+#include <containers/LockGuard.hpp>
+#include <mathlib/mathlib.h>
+#include <matrix/math.hpp>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/posix.h>
+
+namespace gimbal
+{
+
+Stabilizer::Stabilizer() :
+	WorkItem(MODULE_NAME"_stabilizer", px4::wq_configurations::nav_and_controllers)
+{
+	pthread_mutex_init(&_setpoint_mutex, nullptr);
+}
+
+Stabilizer::~Stabilizer()
+{
+	stop();
+
+	perf_free(_cycle_perf);
+	perf_free(_interval_perf);
+	pthread_mutex_destroy(&_setpoint_mutex);
+}
+
+bool Stabilizer::start()
+{
+	_should_exit.store(false);
+	_exited.store(false);
+
+	if (!_vehicle_attitude_sub.registerCallback()) {
+		PX4_ERR("stabilizer callback registration failed");
+		_exited.store(true);
+		return false;
+	}
+
+	return true;
+}
+
+void Stabilizer::stop()
+{
+	if (_exited.load()) {
+		return;
+	}
+
+	_vehicle_attitude_sub.unregisterCallback();
+	_should_exit.store(true);
+	ScheduleNow();
+
+	// wait for a running cycle to finish before the object can go away
+	for (int i = 0; i < 100 && !_exited.load(); i++) {
+		px4_usleep(1000);
+	}
+
+	ScheduleClear();
+}
+
+void Stabilizer::set_setpoint(const Setpoint &setpoint)
+{
+	LockGuard lg{_setpoint_mutex};
+	_setpoint = setpoint;
+}
+
+void Stabilizer::Run()
+{
+	if (_should_exit.load()) {
+		_exited.store(true);
+		return;
+	}
+
+	vehicle_attitude_s vehicle_attitude;
+
+	if (!_vehicle_attitude_sub.update(&vehicle_attitude)) {
+		return;
+	}
+
+	perf_begin(_cycle_perf);
+	perf_count(_interval_perf);
+
+	Setpoint setpoint;
+	{
+		LockGuard lg{_setpoint_mutex};
+		setpoint = _setpoint;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (setpoint.timestamp == 0 || now > setpoint.timestamp + SETPOINT_TIMEOUT) {
+		perf_end(_cycle_perf);
+		return;
+	}
+
+	const matrix::Eulerf euler_vehicle{matrix::Quatf(vehicle_attitude.q)};
+	matrix::Vector3f euler_vehicle_rate{};
+
+	vehicle_angular_velocity_s angular_velocity;
+
+	if ((setpoint.rate_feed_forward > 0.f) && _vehicle_angular_velocity_sub.copy(&angular_velocity)) {
+		// body rates to euler angle rates, skipped close to the singularity at +-90 deg pitch
+		const float sin_roll = sinf(euler_vehicle.phi());
+		const float cos_roll = cosf(euler_vehicle.phi());
+		const float cos_pitch = cosf(euler_vehicle.theta());
+
+		if (fabsf(cos_pitch) > 0.1f) {
+			const matrix::Vector3f rates{angular_velocity.xyz};
+			const float q_sin_r_cos = rates(1) * sin_roll + rates(2) * cos_roll;
+
+			euler_vehicle_rate(0) = rates(0) + q_sin_r_cos * tanf(euler_vehicle.theta());
+			euler_vehicle_rate(1) = rates(1) * cos_roll - rates(2) * sin_roll;
+			euler_vehicle_rate(2) = q_sin_r_cos / cos_pitch;
+		}
+	}
+
+	gimbal_controls_s gimbal_controls{};
+	const uint8_t index[3] {gimbal_controls_s::INDEX_ROLL, gimbal_controls_s::INDEX_PITCH, gimbal_controls_s::INDEX_YAW};
+
+	for (int i = 0; i < 3; ++i) {
+		float angle = setpoint.angles[i];
+
+		if (setpoint.compensate[i] && PX4_ISFINITE(euler_vehicle(i))) {
+			// compensate the attitude the vehicle will have when the servo got there
+			angle -= euler_vehicle(i) + euler_vehicle_rate(i) * setpoint.rate_feed_forward;
+		}
+
+		if (!PX4_ISFINITE(angle)) {
+			angle = 0.f;
+		}
+
+		angle = matrix::wrap_pi(angle);
+
+		if (i == 1 && setpoint.landed) {
+			angle = math::constrain(angle, setpoint.landed_pitch_min, setpoint.landed_pitch_max);
+		}
+
+		gimbal_controls.control[index[i]] = math::constrain((angle + setpoint.offset[i]) / (setpoint.range[i] / 2.f), -1.f, 1.f);
+	}
+
+	gimbal_controls.timestamp_sample = vehicle_attitude.timestamp_sample;
+	gimbal_controls.timestamp = hrt_absolute_time();
+	_gimbal_controls_pub.publish(gimbal_controls);
+
+	perf_end(_cycle_perf);
+}
+
+void Stabilizer::print_status() const
+{
+	PX4_INFO("Stabilization: fast path on vehicle_attitude");
+	perf_print_counter(_cycle_perf);
+	perf_print_counter(_interval_perf);
+}
+
+} /* namespace gimbal */
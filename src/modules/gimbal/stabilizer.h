@@ -0,0 +1,113 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <uORB/Publication.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/gimbal_controls.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_attitude.h>
+
+#include <pthread.h>
+
+using namespace time_literals;
+
+namespace gimbal
+{
+
+/**
+ * Fast path for AUX gimbal outputs: applies the vehicle attitude
+ * compensation and publishes gimbal_controls on every vehicle_attitude
+ * update, while the inputs and the setpoint generation keep running at
+ * the rate of the gimbal thread.
+ */
+class Stabilizer : public px4::WorkItem
+{
+public:
+	struct Setpoint {
+		hrt_abstime timestamp{0};
+
+		float angles[3] {};		///< target angles before vehicle compensation (roll, pitch, yaw) [rad]
+		bool compensate[3] {};		///< subtract the vehicle attitude on this axis
+
+		bool landed{true};
+		float landed_pitch_min{0.f};	///< [rad]
+		float landed_pitch_max{0.f};	///< [rad]
+
+		float offset[3] {};		///< output offset [rad]
+		float range[3] {1.f, 1.f, 1.f};	///< full output range [rad]
+
+		float rate_feed_forward{0.f};	///< vehicle rate feed-forward time [s]
+	};
+
+	Stabilizer();
+	~Stabilizer() override;
+
+	bool start();
+	void stop();
+
+	/** set from the gimbal thread */
+	void set_setpoint(const Setpoint &setpoint);
+
+	void print_status() const;
+
+private:
+	// stop commanding the output if the gimbal thread stops providing setpoints
+	static constexpr hrt_abstime SETPOINT_TIMEOUT = 500_ms;
+
+	void Run() override;
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_attitude_sub{this, ORB_ID(vehicle_attitude)};
+	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
+
+	uORB::Publication<gimbal_controls_s> _gimbal_controls_pub{ORB_ID(gimbal_controls)};
+
+	pthread_mutex_t _setpoint_mutex{};
+	Setpoint _setpoint{};
+
+	px4::atomic<bool> _should_exit{false};
+	px4::atomic<bool> _exited{true};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": stabilizer cycle")};
+	perf_counter_t _interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": stabilizer interval")};
+};
+
+} /* namespace gimbal */
@@ -67,6 +67,10 @@ GyroFFT::~GyroFFT()
 	delete[] _fft_input_buffer;
 	delete[] _fft_outupt_buffer;
 	delete[] _peak_magnitudes_all;
+
+	for (auto &spectrum_average : _spectrum_average) {
+		delete[] spectrum_average;
+	}
 }
 
 bool GyroFFT::init()
@@ -141,6 +145,35 @@ bool GyroFFT::init()
 	if (buffers_allocated) {
 		_imu_gyro_fft_len = _param_imu_gyro_fft_len.get();
 
+		switch (_param_imu_gyro_fft_dec.get()) {
+		case 1:
+		case 2:
+		case 4:
+			_decimation = _param_imu_gyro_fft_dec.get();
+			break;
+
+		default:
+			PX4_ERR("Invalid IMU_GYRO_FFT_DEC=%" PRId32 ", resetting", _param_imu_gyro_fft_dec.get());
+			_param_imu_gyro_fft_dec.set(1);
+			_param_imu_gyro_fft_dec.commit();
+			_decimation = 1;
+			break;
+		}
+
+		if (_param_imu_gyro_fft_avg.get() > 1) {
+			// averaged magnitude spectrum per axis (Welch)
+			for (auto &spectrum_average : _spectrum_average) {
+				spectrum_average = new math::float16[_imu_gyro_fft_len / 2] {};
+
+				if (spectrum_average == nullptr) {
+					buffers_allocated = false;
+				}
+			}
+		}
+	}
+
+	if (buffers_allocated) {
+
 		// init Hanning window
 		for (int n = 0; n < _imu_gyro_fft_len; n++) {
 			const float hanning_value = 0.5f * (1.f - cosf(2.f * M_PI_F * n / (_imu_gyro_fft_len - 1)));
@@ -332,30 +365,35 @@ void GyroFFT::Run()
 	if (_gyro_fifo) {
 		// run on sensor gyro fifo updates
 		sensor_gyro_fifo_s sensor_gyro_fifo;
+		const sensor_gyro_fifo_s *fifo;
 
-		while (_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
+		// borrow the FIFO messages in place where possible instead of copying them
+		while ((fifo = _sensor_gyro_fifo_sub.borrow_or_update(&sensor_gyro_fifo))) {
 			if (_sensor_gyro_fifo_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
 
 			_gyro_last_generation = _sensor_gyro_fifo_sub.get_last_generation();
 
-			if (fabsf(sensor_gyro_fifo.scale - _fifo_last_scale) > FLT_EPSILON) {
+			if (fabsf(fifo->scale - _fifo_last_scale) > FLT_EPSILON) {
 				// force reset if scale has changed
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
-				_fifo_last_scale = sensor_gyro_fifo.scale;
+				_fifo_last_scale = fifo->scale;
 			}
 
-			int16_t *input[] {sensor_gyro_fifo.x, sensor_gyro_fifo.y, sensor_gyro_fifo.z};
-			Update(sensor_gyro_fifo.timestamp_sample, input, sensor_gyro_fifo.samples);
+			const int16_t *const input[] {fifo->x, fifo->y, fifo->z};
+			Update(fifo->timestamp_sample, input, math::min(fifo->samples, (uint8_t)(sizeof(fifo->x) / sizeof(fifo->x[0]))));
+
+			if (!_sensor_gyro_fifo_sub.borrow_valid(fifo, &sensor_gyro_fifo)) {
+				// overwritten by the publisher while buffering, treat like a missed sample
+				ResetBuffers();
+
+				perf_count(_gyro_fifo_generation_gap_perf);
+			}
 		}
 
 	} else {
@@ -365,9 +403,7 @@ void GyroFFT::Run()
 		while (_sensor_gyro_sub.update(&sensor_gyro)) {
 			if (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
-				_fft_buffer_index[0] = 0;
-				_fft_buffer_index[1] = 0;
-				_fft_buffer_index[2] = 0;
+				ResetBuffers();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -379,7 +415,7 @@ void GyroFFT::Run()
 			int16_t gyro_y[1] {(int16_t)roundf(sensor_gyro.y * gyro_scale)};
 			int16_t gyro_z[1] {(int16_t)roundf(sensor_gyro.z * gyro_scale)};
 
-			int16_t *input[] {gyro_x, gyro_y, gyro_z};
+			const int16_t *const input[] {gyro_x, gyro_y, gyro_z};
 			Update(sensor_gyro.timestamp_sample, input, 1);
 		}
 	}
@@ -392,7 +428,7 @@ void GyroFFT::Run()
 	perf_end(_cycle_perf);
 }
 
-void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
+void GyroFFT::Update(const hrt_abstime &timestamp_sample, const int16_t *const input[], uint8_t N)
 {
 	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
@@ -400,9 +436,26 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 		int &buffer_index = _fft_buffer_index[axis];
 
 		for (int n = 0; n < N; n++) {
+			if (_decimation > 1) {
+				// average (boxcar) decimation
+				_decimation_sum[axis] += input[axis][n];
+
+				if (++_decimation_count[axis] < _decimation) {
+					continue;
+				}
+			}
+
 			if (buffer_index < _imu_gyro_fft_len) {
 				// convert int16_t -> q15_t (scaling isn't relevant)
-				gyro_data_buffer[axis][buffer_index] = input[axis][n] / 2;
+				if (_decimation > 1) {
+					gyro_data_buffer[axis][buffer_index] = _decimation_sum[axis] / (2 * _decimation);
+					_decimation_sum[axis] = 0;
+					_decimation_count[axis] = 0;
+
+				} else {
+					gyro_data_buffer[axis][buffer_index] = input[axis][n] / 2;
+				}
+
 				buffer_index++;
 			}
 
@@ -429,23 +482,48 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 	}
 }
 
+void GyroFFT::ResetBuffers()
+{
+	for (int axis = 0; axis < 3; axis++) {
+		_fft_buffer_index[axis] = 0;
+		_decimation_sum[axis] = 0;
+		_decimation_count[axis] = 0;
+		_spectrum_count[axis] = 0;
+	}
+}
+
 void GyroFFT::FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer)
 {
-	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+	const float resolution_hz = _gyro_sample_rate_hz / (_decimation * _imu_gyro_fft_len);
 
 	// sum total energy across all used buckets for SNR
 	float bin_mag_sum = 0;
 
+	// Welch: peaks are searched in the average over the last IMU_GYRO_FFT_AVG (overlapped) spectra
+	math::float16 *spectrum_average = _spectrum_average[axis];
+	float spectrum_alpha = 1.f;
+
+	if (spectrum_average != nullptr) {
+		// cumulative mean until enough spectra are available, then a moving average
+		_spectrum_count[axis] = math::min(_spectrum_count[axis] + 1, _param_imu_gyro_fft_avg.get());
+		spectrum_alpha = 1.f / _spectrum_count[axis];
+	}
+
 	// FFT output buffer is ordered [real[0], imag[0], real[1], imag[1], real[2], imag[2] ... real[(N/2)-1], imag[(N/2)-1]
 	for (uint16_t fft_index = 2; fft_index < _imu_gyro_fft_len; fft_index += 2) {
 
 		const float real = fft_outupt_buffer[fft_index];
 		const float imag = fft_outupt_buffer[fft_index + 1];
 
-		const float fft_magnitude = sqrtf(real * real + imag * imag);
+		float fft_magnitude = sqrtf(real * real + imag * imag);
 
 		int bin_index = fft_index / 2;
 
+		if (spectrum_average != nullptr) {
+			spectrum_average[bin_index] += spectrum_alpha * (fft_magnitude - spectrum_average[bin_index]);
+			fft_magnitude = spectrum_average[bin_index];
+		}
+
 		_peak_magnitudes_all[bin_index] = fft_magnitude;
 		bin_mag_sum += fft_magnitude;
 	}
@@ -672,7 +750,7 @@ void GyroFFT::Publish()
 {
 	_sensor_gyro_fft.device_id = _selected_sensor_device_id;
 	_sensor_gyro_fft.sensor_sample_rate_hz = _gyro_sample_rate_hz;
-	_sensor_gyro_fft.resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+	_sensor_gyro_fft.resolution_hz = _gyro_sample_rate_hz / (_decimation * _imu_gyro_fft_len);
 	_sensor_gyro_fft.timestamp = hrt_absolute_time();
 	_sensor_gyro_fft_pub.publish(_sensor_gyro_fft);
 }
@@ -703,6 +781,8 @@ int GyroFFT::task_spawn(int argc, char *argv[])
 int GyroFFT::print_status()
 {
 	PX4_INFO("gyro sample rate: %.3f Hz", (double)_gyro_sample_rate_hz);
+	PX4_INFO("decimation: %" PRId32 ", averaged spectra: %" PRId32, _decimation,
+		 (_spectrum_average[0] != nullptr) ? _param_imu_gyro_fft_avg.get() : (int32_t)1);
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_cycle_interval_perf);
 	perf_print_counter(_fft_perf);
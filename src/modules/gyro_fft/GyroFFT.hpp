@@ -34,6 +34,7 @@
 #ifndef GYRO_FFT_HPP
 #define GYRO_FFT_HPP
 
+#include <lib/mathlib/math/CompactStorage.hpp>
 #include <lib/mathlib/math/filter/MedianFilter.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/perf/perf_counter.h>
@@ -89,9 +90,10 @@ private:
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
 	inline void Publish();
 	bool SensorSelectionUpdate(bool force = false);
-	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
+	void Update(const hrt_abstime &timestamp_sample, const int16_t *const input[], uint8_t N);
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
 				 float peak_snr[MAX_NUM_PEAKS], int num_peaks_found);
+	void ResetBuffers();
 	void VehicleIMUStatusUpdate(bool force = false);
 
 	template<size_t N>
@@ -149,6 +151,13 @@ private:
 
 	int _fft_buffer_index[3] {};
 
+	int32_t _decimation{1};
+	int32_t _decimation_sum[3] {};
+	int32_t _decimation_count[3] {};
+
+	math::float16 *_spectrum_average[3] {}; // half precision, the average is only used to locate the peaks
+	int32_t _spectrum_count[3] {};
+
 	unsigned _gyro_last_generation{0};
 
 	math::MedianFilter<float, 7> _median_filter[3][MAX_NUM_PEAKS] {};
@@ -166,7 +175,9 @@ private:
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
-		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
+		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr,
+		(ParamInt<px4::params::IMU_GYRO_FFT_DEC>) _param_imu_gyro_fft_dec,
+		(ParamInt<px4::params::IMU_GYRO_FFT_AVG>) _param_imu_gyro_fft_avg
 	)
 };
 
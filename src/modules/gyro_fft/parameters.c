@@ -83,3 +83,33 @@ PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 * @group Sensors
 */
 PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_SNR, 10.f);
+
+/**
+* IMU gyro FFT decimation.
+*
+* Gyro samples are averaged and decimated by this factor before the FFT.
+* This improves the frequency resolution for a given FFT length
+* (sample rate / (decimation * IMU_GYRO_FFT_LEN)) at the same computational cost,
+* IMU_GYRO_FFT_MAX needs to stay below half the decimated sample rate.
+*
+* @value 1 1 (disabled)
+* @value 2 2
+* @value 4 4
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_DEC, 1);
+
+/**
+* IMU gyro FFT number of averaged spectra.
+*
+* Peaks are detected in the moving average of the magnitude spectra of the last
+* overlapping FFT windows (Welch's method), reducing the variance of the estimate.
+* Set to 1 to use every spectrum on its own.
+*
+* @min 1
+* @max 8
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_AVG, 1);
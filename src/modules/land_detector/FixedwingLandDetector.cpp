@@ -51,6 +51,13 @@ FixedwingLandDetector::FixedwingLandDetector()
 	_landed_hysteresis.set_hysteresis_time_from(true, FLYING_TRIGGER_TIME_US);
 }
 
+void FixedwingLandDetector::_update_params()
+{
+	_ground_speed_stats.setWindow(_statistics_window_us);
+	_vertical_velocity_stats.setWindow(_statistics_window_us);
+	_airspeed_stats.setWindow(_statistics_window_us);
+}
+
 bool FixedwingLandDetector::_get_landed_state()
 {
 	// Only trigger flight conditions if we are armed.
@@ -71,6 +78,17 @@ bool FixedwingLandDetector::_get_landed_state()
 
 	} else if (hrt_elapsed_time(&_vehicle_local_position.timestamp) < 1_s) {
 
+		if (_vehicle_local_position_updated) {
+			if (_vehicle_local_position.v_xy_valid) {
+				_ground_speed_stats.update(matrix::Vector2f(_vehicle_local_position.vx, _vehicle_local_position.vy).norm(),
+							   _vehicle_local_position.timestamp);
+			}
+
+			if (_vehicle_local_position.v_z_valid) {
+				_vertical_velocity_stats.update(_vehicle_local_position.vz, _vehicle_local_position.timestamp);
+			}
+		}
+
 		// Horizontal velocity complimentary filter.
 		float val = 0.97f * _velocity_xy_filtered + 0.03f * sqrtf(_vehicle_local_position.vx * _vehicle_local_position.vx +
 				_vehicle_local_position.vy * _vehicle_local_position.vy);
@@ -98,6 +116,7 @@ bool FixedwingLandDetector::_get_landed_state()
 
 		} else {
 			_airspeed_filtered = 0.95f * _airspeed_filtered + 0.05f * airspeed_validated.true_airspeed_m_s;
+			_airspeed_stats.update(airspeed_validated.true_airspeed_m_s, airspeed_validated.timestamp);
 		}
 
 		// A leaking lowpass prevents biases from building up, but
@@ -123,4 +142,31 @@ bool FixedwingLandDetector::_get_landed_state()
 	return landDetected;
 }
 
+float FixedwingLandDetector::_get_landed_confidence()
+{
+	if (!_armed) {
+		return 1.f;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (!_ground_speed_stats.valid(now) || !_vertical_velocity_stats.valid(now)) {
+		return LandDetector::_get_landed_confidence();
+	}
+
+	// each speed with its spread has to stay below its landed threshold
+	const float ground_speed = _ground_speed_stats.mean() + _ground_speed_stats.standard_deviation();
+	const float vz = fabsf(_vertical_velocity_stats.mean()) + _vertical_velocity_stats.standard_deviation();
+
+	float confidence = (1.f - math::constrain(ground_speed / math::max(_param_lndfw_vel_xy_max.get(), FLT_EPSILON), 0.f, 1.f))
+			   * (1.f - math::constrain(vz / math::max(_param_lndfw_vel_z_max.get(), FLT_EPSILON), 0.f, 1.f));
+
+	if (_airspeed_stats.valid(now)) {
+		const float airspeed = _airspeed_stats.mean() + _airspeed_stats.standard_deviation();
+		confidence *= 1.f - math::constrain(airspeed / math::max(_param_lndfw_airspd.get(), FLT_EPSILON), 0.f, 1.f);
+	}
+
+	return confidence;
+}
+
 } // namespace land_detector
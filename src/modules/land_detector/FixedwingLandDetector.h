@@ -61,7 +61,10 @@ public:
 
 protected:
 
+	void _update_params() override;
+
 	bool _get_landed_state() override;
+	float _get_landed_confidence() override;
 	void _set_hysteresis_factor(const int factor) override {};
 
 private:
@@ -76,6 +79,10 @@ private:
 	float _velocity_z_filtered{0.0f};
 	float _xy_accel_filtered{0.0f};
 
+	WindowedStatistics _ground_speed_stats{};	///< horizontal ground speed [m/s]
+	WindowedStatistics _vertical_velocity_stats{};	///< vertical velocity [m/s]
+	WindowedStatistics _airspeed_stats{};		///< true airspeed [m/s]
+
 	DEFINE_PARAMETERS_CUSTOM_PARENT(
 		LandDetector,
 		(ParamFloat<px4::params::LNDFW_XYACC_MAX>)  _param_lndfw_xyaccel_max,
@@ -60,6 +60,7 @@ LandDetector::LandDetector() :
 	_land_detected.rotational_movement = false;
 	_land_detected.close_to_ground_or_skipped_check = true;
 	_land_detected.at_rest = true;
+	_land_detected.landed_confidence = 1.f;
 }
 
 LandDetector::~LandDetector()
@@ -85,6 +86,7 @@ void LandDetector::Run()
 		_parameter_update_sub.copy(&param_update);
 
 		updateParams();
+		_statistics_window_us = static_cast<hrt_abstime>(_param_lnd_stat_win.get() * 1e6f);
 		_update_params();
 
 		_total_flight_time = static_cast<uint64_t>(_param_total_flight_time_high.get()) << 32;
@@ -115,7 +117,7 @@ void LandDetector::Run()
 		}
 	}
 
-	_vehicle_local_position_sub.update(&_vehicle_local_position);
+	_vehicle_local_position_updated = _vehicle_local_position_sub.update(&_vehicle_local_position);
 	_vehicle_status_sub.update(&_vehicle_status);
 
 	_update_topics();
@@ -178,6 +180,7 @@ void LandDetector::Run()
 		_land_detected.rotational_movement = _get_rotational_movement();
 		_land_detected.close_to_ground_or_skipped_check = _get_close_to_ground_or_skipped_check();
 		_land_detected.at_rest = at_rest;
+		_land_detected.landed_confidence = _get_landed_confidence();
 		_land_detected.timestamp = hrt_absolute_time();
 		_vehicle_land_detected_pub.publish(_land_detected);
 	}
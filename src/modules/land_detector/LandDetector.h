@@ -67,12 +67,14 @@
 #include <uORB/topics/vehicle_local_position.h>
 #include <uORB/topics/vehicle_status.h>
 
+#include "WindowedStatistics.hpp"
+
 using namespace time_literals;
 
 namespace land_detector
 {
 
-class LandDetector : public ModuleBase<LandDetector>, ModuleParams, px4::ScheduledWorkItem
+class LandDetector : public ModuleBase<LandDetector>, public ModuleParams, px4::ScheduledWorkItem
 {
 public:
 	LandDetector();
@@ -140,6 +142,12 @@ protected:
 	virtual bool _get_vertical_movement() { return false; }
 	virtual bool _get_rotational_movement() { return false; }
 	virtual bool _get_close_to_ground_or_skipped_check() {  return false; }
+
+	/**
+	 * @return confidence in [0, 1] of the landed state from the windowed statistics
+	 */
+	virtual float _get_landed_confidence() { return _landed_hysteresis.get_state() ? 1.f : 0.f; }
+
 	virtual void _set_hysteresis_factor(const int factor) = 0;
 
 	systemlib::Hysteresis _freefall_hysteresis{false};
@@ -157,6 +165,9 @@ protected:
 	bool _armed{false};
 	bool _previous_armed_state{false};	///< stores the previous actuator_armed.armed state
 	bool _dist_bottom_is_observable{false};
+	bool _vehicle_local_position_updated{false};	///< _vehicle_local_position has a new sample this cycle
+
+	hrt_abstime _statistics_window_us{1_s};		///< length of the statistics windows, see LND_STAT_WIN
 
 private:
 	void Run() override;
@@ -191,7 +202,8 @@ private:
 	DEFINE_PARAMETERS_CUSTOM_PARENT(
 		ModuleParams,
 		(ParamInt<px4::params::LND_FLIGHT_T_HI>) _param_total_flight_time_high,
-		(ParamInt<px4::params::LND_FLIGHT_T_LO>) _param_total_flight_time_low
+		(ParamInt<px4::params::LND_FLIGHT_T_LO>) _param_total_flight_time_low,
+		(ParamFloat<px4::params::LND_STAT_WIN>) _param_lnd_stat_win
 	);
 };
 
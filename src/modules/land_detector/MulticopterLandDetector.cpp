@@ -90,6 +90,11 @@ void MulticopterLandDetector::_update_topics()
 
 	if (_vehicle_thrust_setpoint_sub.update(&vehicle_thrust_setpoint)) {
 		_vehicle_thrust_setpoint_throttle = -vehicle_thrust_setpoint.xyz[2];
+		_thrust_stats.update(_vehicle_thrust_setpoint_throttle, vehicle_thrust_setpoint.timestamp);
+	}
+
+	if (_vehicle_local_position_updated && _vehicle_local_position.v_z_valid) {
+		_vertical_velocity_stats.update(_vehicle_local_position.vz, _vehicle_local_position.timestamp);
 	}
 
 	vehicle_control_mode_s vehicle_control_mode;
@@ -123,6 +128,9 @@ void MulticopterLandDetector::_update_params()
 	param_get(_paramHandle.landSpeed, &_params.landSpeed);
 	param_get(_paramHandle.crawlSpeed, &_params.crawlSpeed);
 
+	_vertical_velocity_stats.setWindow(_statistics_window_us);
+	_thrust_stats.setWindow(_statistics_window_us);
+
 	// 1.2 corresponds to the margin between the default parameters LNDMC_Z_VEL_MAX = MPC_LAND_CRWL / 1.2
 	const float lndmc_upper_threshold = math::min(_params.crawlSpeed, _params.landSpeed) / 1.2f;
 
@@ -296,6 +304,39 @@ bool MulticopterLandDetector::_get_landed_state()
 	return !_armed || _maybe_landed_hysteresis.get_state();
 }
 
+float MulticopterLandDetector::_get_landed_confidence()
+{
+	if (!_armed) {
+		return 1.f;
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+	bool any_valid = false;
+	float confidence = 1.f;
+
+	// no vertical movement: mean and spread of the vertical velocity within the threshold
+	if (_vertical_velocity_stats.valid(now)) {
+		const float vz_max = math::max(_param_lndmc_z_vel_max.get(), FLT_EPSILON);
+		const float vz = fabsf(_vertical_velocity_stats.mean()) + _vertical_velocity_stats.standard_deviation();
+		confidence *= 1.f - math::constrain(vz / vz_max, 0.f, 1.f);
+		any_valid = true;
+	}
+
+	// low thrust: mean and spread of the thrust between the minimum and hover thrust
+	if (_thrust_stats.valid(now)) {
+		const float thrust_range = math::max(_params.hoverThrottle - _params.minThrottle, FLT_EPSILON);
+		const float thrust = _thrust_stats.mean() + _thrust_stats.standard_deviation() - _params.minThrottle;
+		confidence *= 1.f - math::constrain(thrust / thrust_range, 0.f, 1.f);
+		any_valid = true;
+	}
+
+	if (!any_valid) {
+		return LandDetector::_get_landed_confidence();
+	}
+
+	return confidence;
+}
+
 bool MulticopterLandDetector::_get_ground_effect_state()
 {
 	return (_in_descend && !_horizontal_movement) ||
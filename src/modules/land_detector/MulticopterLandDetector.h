@@ -76,6 +76,7 @@ protected:
 	bool _get_vertical_movement() override { return _vertical_movement; }
 	bool _get_rotational_movement() override { return _rotational_movement; }
 	bool _get_close_to_ground_or_skipped_check() override { return _close_to_ground_or_skipped_check; }
+	float _get_landed_confidence() override;
 
 	void _set_hysteresis_factor(const int factor) override;
 private:
@@ -124,6 +125,9 @@ private:
 
 	systemlib::Hysteresis _minimum_thrust_8s_hysteresis{false};
 
+	WindowedStatistics _vertical_velocity_stats{};	///< vertical velocity [m/s]
+	WindowedStatistics _thrust_stats{};		///< collective thrust setpoint [0, 1]
+
 	bool _in_descend{false};		///< vehicle is commanded to desend
 	bool _horizontal_movement{false};	///< vehicle is moving horizontally
 	bool _vertical_movement{false};
@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file WindowedStatistics.hpp
+ * Mean and variance of a signal over consecutive time windows.
+ *
+ * Samples are accumulated incrementally with Welford's algorithm into the
+ * current window, the statistics of the last completed window are reported.
+ * The result does not depend on the rate the samples come in.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/math/WelfordMean.hpp>
+
+namespace land_detector
+{
+
+class WindowedStatistics
+{
+public:
+	void setWindow(hrt_abstime window_us) { _window_us = math::max(window_us, static_cast<hrt_abstime>(1)); }
+
+	void update(float value, hrt_abstime now)
+	{
+		if (_current.count() == 0) {
+			_current_start = now;
+		}
+
+		_current.update(value);
+
+		if (now - _current_start >= _window_us) {
+			_last = _current;
+			_last_end = now;
+			_current.reset();
+		}
+	}
+
+	void reset()
+	{
+		_current.reset();
+		_last.reset();
+		_last_end = 0;
+	}
+
+	/**
+	 * @return true if the last completed window has enough samples and is at most one window old
+	 */
+	bool valid(hrt_abstime now) const { return _last.valid() && (now - _last_end <= _window_us); }
+
+	float mean() const { return _last.mean(); }
+	float variance() const { return _last.valid() ? _last.variance() : 0.f; }
+	float standard_deviation() const { return sqrtf(variance()); }
+
+private:
+	math::WelfordMean<float> _current{};
+	math::WelfordMean<float> _last{};
+
+	hrt_abstime _current_start{0};
+	hrt_abstime _last_end{0};
+	hrt_abstime _window_us{1000000};
+};
+
+} // namespace land_detector
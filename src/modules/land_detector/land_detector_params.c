@@ -58,3 +58,18 @@ PARAM_DEFINE_INT32(LND_FLIGHT_T_HI, 0);
  *
  */
 PARAM_DEFINE_INT32(LND_FLIGHT_T_LO, 0);
+
+/**
+ * Land detector statistics window
+ *
+ * Length of the windows over which the mean and variance of the velocity and
+ * thrust are computed for the landed confidence.
+ *
+ * @unit s
+ * @min 0.1
+ * @max 5.0
+ * @decimal 1
+ * @increment 0.1
+ * @group Land Detector
+ */
+PARAM_DEFINE_FLOAT(LND_STAT_WIN, 1.0f);
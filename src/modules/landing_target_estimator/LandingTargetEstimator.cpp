@@ -74,7 +74,9 @@ void LandingTargetEstimator::update()
 
 	/* predict */
 	if (_estimator_initialized) {
-		if (hrt_absolute_time() - _last_update > landing_target_estimator_TIMEOUT_US) {
+		_filter_bank.removeStale(hrt_absolute_time(), landing_target_estimator_TIMEOUT_US);
+
+		if (!_filter_bank.anyActive()) {
 			PX4_INFO("Lost sight of Marker");
 			_estimator_initialized = false;
 
@@ -93,105 +95,94 @@ void LandingTargetEstimator::update()
 				a.zero();
 			}
 
-			_kalman_filter_x.predict(dt, -a(0), _params.acc_unc);
-			_kalman_filter_y.predict(dt, -a(1), _params.acc_unc);
+			_filter_bank.predict(dt, -a(0), -a(1), _params.acc_unc);
 
 			_last_predict = hrt_absolute_time();
 		}
 	}
 
-	if (!_new_irlockReport) {
-		// nothing to do
-		return;
-	}
-
-	// mark this sensor measurement as consumed
-	_new_irlockReport = false;
-
-
-	if (!_estimator_initialized) {
-		float vx_init = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vx : 0.f;
-		float vy_init = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vy : 0.f;
-		PX4_INFO("Init %.2f %.2f", (double)vx_init, (double)vy_init);
-		_kalman_filter_x.init(_target_position_report.rel_pos_x, vx_init, _params.pos_unc_init, _params.vel_unc_init);
-		_kalman_filter_y.init(_target_position_report.rel_pos_y, vy_init, _params.pos_unc_init, _params.vel_unc_init);
-
-		_estimator_initialized = true;
-		_last_update = hrt_absolute_time();
-		_last_predict = _last_update;
-
-	} else {
-		// update
-		const float measurement_uncertainty = _params.meas_unc * _dist_z * _dist_z;
-		bool update_x = _kalman_filter_x.update(_target_position_report.rel_pos_x, measurement_uncertainty);
-		bool update_y = _kalman_filter_y.update(_target_position_report.rel_pos_y, measurement_uncertainty);
-
-		if (!update_x || !update_y) {
-			if (!_faulty) {
-				_faulty = true;
-				PX4_INFO("Landing target measurement rejected:%s%s", update_x ? "" : " x", update_y ? "" : " y");
-			}
+	// the sensors report every detected target, all of them update the filter bank
+	irlock_report_s irlock_report;
 
-		} else {
-			_faulty = false;
+	while (_irlockReportSub.update(&irlock_report)) {
+		if (!_update_target_position(irlock_report)) {
+			continue;
 		}
 
-		if (!_faulty) {
-			// only publish if both measurements were good
+		TargetFilterBank::Measurement meas{};
+		meas.timestamp = hrt_absolute_time();
+		meas.signature = _target_position_report.signature;
+		meas.x = _target_position_report.rel_pos_x;
+		meas.y = _target_position_report.rel_pos_y;
+		meas.variance = _params.meas_unc * _dist_z * _dist_z;
+
+		TargetFilterBank::InitialState init{};
+		init.vx = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vx : 0.f;
+		init.vy = _vehicleLocalPosition.v_xy_valid ? -_vehicleLocalPosition.vy : 0.f;
+		init.pos_variance = _params.pos_unc_init;
+		init.vel_variance = _params.vel_unc_init;
+
+		if (!_estimator_initialized) {
+			PX4_INFO("Init %.2f %.2f", (double)init.vx, (double)init.vy);
+			_estimator_initialized = true;
+			_last_predict = meas.timestamp;
+		}
 
-			_target_pose.timestamp = _target_position_report.timestamp;
+		const int index = _filter_bank.update(meas, init);
 
-			float x, xvel, y, yvel, covx, covx_v, covy, covy_v;
-			_kalman_filter_x.getState(x, xvel);
-			_kalman_filter_x.getCovariance(covx, covx_v);
+		// a new target is published from its second measurement on
+		if ((index == _filter_bank.best()) && (_filter_bank.numUpdates(index) > 1)) {
+			_publish_target(index);
+		}
+	}
+}
 
-			_kalman_filter_y.getState(y, yvel);
-			_kalman_filter_y.getCovariance(covy, covy_v);
+void LandingTargetEstimator::_publish_target(int index)
+{
+	_target_pose.timestamp = _target_position_report.timestamp;
 
-			_target_pose.is_static = (_params.mode == TargetMode::Stationary);
+	float x, xvel, y, yvel, cov_pos, cov_vel;
+	_filter_bank.getState(index, x, xvel, y, yvel);
+	_filter_bank.getCovariance(index, cov_pos, cov_vel);
 
-			_target_pose.rel_pos_valid = true;
-			_target_pose.rel_vel_valid = true;
-			_target_pose.x_rel = x;
-			_target_pose.y_rel = y;
-			_target_pose.z_rel = _target_position_report.rel_pos_z ;
-			_target_pose.vx_rel = xvel;
-			_target_pose.vy_rel = yvel;
+	_target_pose.is_static = (_params.mode == TargetMode::Stationary);
 
-			_target_pose.cov_x_rel = covx;
-			_target_pose.cov_y_rel = covy;
+	_target_pose.rel_pos_valid = true;
+	_target_pose.rel_vel_valid = true;
+	_target_pose.x_rel = x;
+	_target_pose.y_rel = y;
+	_target_pose.z_rel = _target_position_report.rel_pos_z ;
+	_target_pose.vx_rel = xvel;
+	_target_pose.vy_rel = yvel;
 
-			_target_pose.cov_vx_rel = covx_v;
-			_target_pose.cov_vy_rel = covy_v;
+	_target_pose.cov_x_rel = cov_pos;
+	_target_pose.cov_y_rel = cov_pos;
 
-			if (_vehicleLocalPosition_valid && _vehicleLocalPosition.xy_valid) {
-				_target_pose.x_abs = x + _vehicleLocalPosition.x;
-				_target_pose.y_abs = y + _vehicleLocalPosition.y;
-				_target_pose.z_abs = _target_position_report.rel_pos_z  + _vehicleLocalPosition.z;
-				_target_pose.abs_pos_valid = true;
+	_target_pose.cov_vx_rel = cov_vel;
+	_target_pose.cov_vy_rel = cov_vel;
 
-			} else {
-				_target_pose.abs_pos_valid = false;
-			}
+	if (_vehicleLocalPosition_valid && _vehicleLocalPosition.xy_valid) {
+		_target_pose.x_abs = x + _vehicleLocalPosition.x;
+		_target_pose.y_abs = y + _vehicleLocalPosition.y;
+		_target_pose.z_abs = _target_position_report.rel_pos_z  + _vehicleLocalPosition.z;
+		_target_pose.abs_pos_valid = true;
 
-			_targetPosePub.publish(_target_pose);
+	} else {
+		_target_pose.abs_pos_valid = false;
+	}
 
-			_last_update = hrt_absolute_time();
-			_last_predict = _last_update;
-		}
+	_targetPosePub.publish(_target_pose);
 
-		float innov_x, innov_cov_x, innov_y, innov_cov_y;
-		_kalman_filter_x.getInnovations(innov_x, innov_cov_x);
-		_kalman_filter_y.getInnovations(innov_y, innov_cov_y);
+	float innov_x, innov_y, innov_var;
+	_filter_bank.getInnovations(index, innov_x, innov_y, innov_var);
 
-		_target_innovations.timestamp = _target_position_report.timestamp;
-		_target_innovations.innov_x = innov_x;
-		_target_innovations.innov_cov_x = innov_cov_x;
-		_target_innovations.innov_y = innov_y;
-		_target_innovations.innov_cov_y = innov_cov_y;
+	_target_innovations.timestamp = _target_position_report.timestamp;
+	_target_innovations.innov_x = innov_x;
+	_target_innovations.innov_cov_x = innov_var;
+	_target_innovations.innov_y = innov_y;
+	_target_innovations.innov_cov_y = innov_var;
 
-		_targetInnovationsPub.publish(_target_innovations);
-	}
+	_targetInnovationsPub.publish(_target_innovations);
 }
 
 void LandingTargetEstimator::_check_params(const bool force)
@@ -209,53 +200,52 @@ void LandingTargetEstimator::_update_topics()
 	_vehicleLocalPosition_valid = _vehicleLocalPositionSub.update(&_vehicleLocalPosition);
 	_vehicleAttitude_valid = _attitudeSub.update(&_vehicleAttitude);
 	_vehicle_acceleration_valid = _vehicle_acceleration_sub.update(&_vehicle_acceleration);
+}
 
+bool LandingTargetEstimator::_update_target_position(const irlock_report_s &report)
+{
+	if (!_vehicleAttitude_valid || !_vehicleLocalPosition_valid || !_vehicleLocalPosition.dist_bottom_valid) {
+		// don't have the data needed for an update
+		return false;
+	}
 
-	if (_irlockReportSub.update(&_irlockReport)) { //
-		_new_irlockReport = true;
-
-		if (!_vehicleAttitude_valid || !_vehicleLocalPosition_valid || !_vehicleLocalPosition.dist_bottom_valid) {
-			// don't have the data needed for an update
-			return;
-		}
-
-		if (!PX4_ISFINITE(_irlockReport.pos_y) || !PX4_ISFINITE(_irlockReport.pos_x)) {
-			return;
-		}
+	if (!PX4_ISFINITE(report.pos_y) || !PX4_ISFINITE(report.pos_x)) {
+		return false;
+	}
 
-		matrix::Vector<float, 3> sensor_ray; // ray pointing towards target in body frame
-		sensor_ray(0) = _irlockReport.pos_x * _params.scale_x; // forward
-		sensor_ray(1) = _irlockReport.pos_y * _params.scale_y; // right
-		sensor_ray(2) = 1.0f;
+	matrix::Vector<float, 3> sensor_ray; // ray pointing towards target in body frame
+	sensor_ray(0) = report.pos_x * _params.scale_x; // forward
+	sensor_ray(1) = report.pos_y * _params.scale_y; // right
+	sensor_ray(2) = 1.0f;
 
-		// rotate unit ray according to sensor orientation
-		_S_att = get_rot_matrix(_params.sensor_yaw);
-		sensor_ray = _S_att * sensor_ray;
+	// rotate unit ray according to sensor orientation
+	_S_att = get_rot_matrix(_params.sensor_yaw);
+	sensor_ray = _S_att * sensor_ray;
 
-		// rotate the unit ray into the navigation frame
-		matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
-		_R_att = matrix::Dcm<float>(q_att);
-		sensor_ray = _R_att * sensor_ray;
+	// rotate the unit ray into the navigation frame
+	matrix::Quaternion<float> q_att(&_vehicleAttitude.q[0]);
+	_R_att = matrix::Dcm<float>(q_att);
+	sensor_ray = _R_att * sensor_ray;
 
-		if (fabsf(sensor_ray(2)) < 1e-6f) {
-			// z component of measurement unsafe, don't use this measurement
-			return;
-		}
+	if (fabsf(sensor_ray(2)) < 1e-6f) {
+		// z component of measurement unsafe, don't use this measurement
+		return false;
+	}
 
-		_dist_z = _vehicleLocalPosition.dist_bottom - _params.offset_z;
+	_dist_z = _vehicleLocalPosition.dist_bottom - _params.offset_z;
 
-		// scale the ray s.t. the z component has length of _uncertainty_scale
-		_target_position_report.timestamp = _irlockReport.timestamp;
-		_target_position_report.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
-		_target_position_report.rel_pos_z = _dist_z;
+	// scale the ray s.t. the z component has length of _uncertainty_scale
+	_target_position_report.timestamp = report.timestamp;
+	_target_position_report.signature = report.signature;
+	_target_position_report.rel_pos_x = sensor_ray(0) / sensor_ray(2) * _dist_z;
+	_target_position_report.rel_pos_y = sensor_ray(1) / sensor_ray(2) * _dist_z;
+	_target_position_report.rel_pos_z = _dist_z;
 
-		// Adjust relative position according to sensor offset
-		_target_position_report.rel_pos_x += _params.offset_x;
-		_target_position_report.rel_pos_y += _params.offset_y;
+	// Adjust relative position according to sensor offset
+	_target_position_report.rel_pos_x += _params.offset_x;
+	_target_position_report.rel_pos_y += _params.offset_y;
 
-		_new_irlockReport = true;
-	}
+	return true;
 }
 
 void LandingTargetEstimator::_update_params()
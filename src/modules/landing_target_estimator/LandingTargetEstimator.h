@@ -59,7 +59,7 @@
 #include <mathlib/mathlib.h>
 #include <matrix/Matrix.hpp>
 #include <lib/conversion/rotation.h>
-#include "KalmanFilter.h"
+#include "TargetFilterBank.h"
 
 using namespace time_literals;
 
@@ -90,6 +90,17 @@ protected:
 	 */
 	void _update_params();
 
+	/*
+	 * Compute the relative target position of a sensor report.
+	 * @return true if the report can be used for an update
+	 */
+	bool _update_target_position(const irlock_report_s &report);
+
+	/*
+	 * Publish pose and innovations of a target of the filter bank.
+	 */
+	void _publish_target(int index);
+
 	/* timeout after which filter is reset if target not seen */
 	static constexpr uint32_t landing_target_estimator_TIMEOUT_US = 2000000;
 
@@ -141,6 +152,7 @@ private:
 
 	struct {
 		hrt_abstime timestamp;
+		uint16_t signature;
 		float rel_pos_x;
 		float rel_pos_y;
 		float rel_pos_z;
@@ -154,25 +166,18 @@ private:
 	vehicle_local_position_s	_vehicleLocalPosition{};
 	vehicle_attitude_s		_vehicleAttitude{};
 	vehicle_acceleration_s		_vehicle_acceleration{};
-	irlock_report_s			_irlockReport{};
 
 	// keep track of which topics we have received
 	bool _vehicleLocalPosition_valid{false};
 	bool _vehicleAttitude_valid{false};
 	bool _vehicle_acceleration_valid{false};
-	bool _new_irlockReport{false};
-	bool _new_sensorReport{false};
 	bool _estimator_initialized{false};
-	// keep track of whether last measurement was rejected
-	bool _faulty{false};
 
 	matrix::Dcmf _R_att; //Orientation of the body frame
 	matrix::Dcmf _S_att; //Orientation of the sensor relative to body frame
 	matrix::Vector2f _rel_pos;
-	KalmanFilter _kalman_filter_x;
-	KalmanFilter _kalman_filter_y;
+	TargetFilterBank _filter_bank; // one filter per observed target, e.g. several beacons or markers of a pad
 	hrt_abstime _last_predict{0}; // timestamp of last filter prediction
-	hrt_abstime _last_update{0}; // timestamp of last filter update (used to check timeout)
 	float _dist_z{1.0f};
 
 	void _check_params(const bool force);
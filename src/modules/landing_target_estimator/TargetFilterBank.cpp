@@ -0,0 +1,234 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/*
+ * @file TargetFilterBank.cpp
+ * Bank of landing target filters, one hypothesis per observed target.
+ *
+ */
+
+#include "TargetFilterBank.h"
+
+#include <string.h>
+
+namespace landing_target_estimator
+{
+
+void TargetFilterBank::reset()
+{
+	memset(_x, 0, sizeof(_x));
+	memset(_vx, 0, sizeof(_vx));
+	memset(_y, 0, sizeof(_y));
+	memset(_vy, 0, sizeof(_vy));
+	memset(_p00, 0, sizeof(_p00));
+	memset(_p01, 0, sizeof(_p01));
+	memset(_p11, 0, sizeof(_p11));
+	memset(_innov_x, 0, sizeof(_innov_x));
+	memset(_innov_y, 0, sizeof(_innov_y));
+	memset(_innov_var, 0, sizeof(_innov_var));
+	memset(_last_update, 0, sizeof(_last_update));
+	memset(_signature, 0, sizeof(_signature));
+	memset(_num_updates, 0, sizeof(_num_updates));
+	_best = -1;
+}
+
+void TargetFilterBank::initHypothesis(int i, const Measurement &meas, const InitialState &init)
+{
+	_x[i] = meas.x;
+	_vx[i] = init.vx;
+	_y[i] = meas.y;
+	_vy[i] = init.vy;
+
+	_p00[i] = init.pos_variance;
+	_p01[i] = 0.f;
+	_p11[i] = init.vel_variance;
+
+	_innov_x[i] = 0.f;
+	_innov_y[i] = 0.f;
+	_innov_var[i] = 0.f;
+
+	_last_update[i] = meas.timestamp;
+	_signature[i] = meas.signature;
+	_num_updates[i] = 1;
+}
+
+void TargetFilterBank::predict(float dt, float acc_x, float acc_y, float acc_unc)
+{
+	const float dt2 = dt * dt;
+	const float half_dt2 = 0.5f * dt2;
+
+	// process noise G * G^T * acc_unc with G = [dt^2 / 2; dt]
+	const float q00 = half_dt2 * half_dt2 * acc_unc;
+	const float q01 = half_dt2 * dt * acc_unc;
+	const float q11 = dt2 * acc_unc;
+
+	// unused slots are predicted as well, it keeps the loops free of branches
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		_x[i] += _vx[i] * dt + half_dt2 * acc_x;
+		_vx[i] += acc_x * dt;
+		_y[i] += _vy[i] * dt + half_dt2 * acc_y;
+		_vy[i] += acc_y * dt;
+	}
+
+	// A * P * A^T + Q
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		_p00[i] += 2.f * dt * _p01[i] + dt2 * _p11[i] + q00;
+		_p01[i] += dt * _p11[i] + q01;
+		_p11[i] += q11;
+	}
+}
+
+int TargetFilterBank::update(const Measurement &meas, const InitialState &init)
+{
+	// normalized innovation squared of all hypotheses
+	float beta[MAX_TARGETS];
+
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		const float innov_x = meas.x - _x[i];
+		const float innov_y = meas.y - _y[i];
+		beta[i] = (innov_x * innov_x + innov_y * innov_y) / (_p00[i] + meas.variance);
+	}
+
+	int match = -1;
+	float beta_min = GATE_SIZE;
+
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		if (active(i) && (_signature[i] == meas.signature) && (beta[i] < beta_min)) {
+			beta_min = beta[i];
+			match = i;
+		}
+	}
+
+	if (match < 0) {
+		// new target, in a free slot or replacing the least recently updated one other than the best
+		int slot = -1;
+
+		for (int i = 0; i < MAX_TARGETS; i++) {
+			if ((i != _best) && ((slot < 0) || (_last_update[i] < _last_update[slot]))) {
+				slot = i;
+			}
+		}
+
+		initHypothesis(slot, meas, init);
+		return slot;
+	}
+
+	const int i = match;
+
+	_innov_x[i] = meas.x - _x[i];
+	_innov_y[i] = meas.y - _y[i];
+	_innov_var[i] = _p00[i] + meas.variance;
+
+	const float k0 = _p00[i] / _innov_var[i];
+	const float k1 = _p01[i] / _innov_var[i];
+
+	_x[i] += k0 * _innov_x[i];
+	_vx[i] += k1 * _innov_x[i];
+	_y[i] += k0 * _innov_y[i];
+	_vy[i] += k1 * _innov_y[i];
+
+	// (I - K * H) * P
+	_p11[i] -= k1 * _p01[i];
+	_p00[i] *= 1.f - k0;
+	_p01[i] *= 1.f - k0;
+
+	_last_update[i] = meas.timestamp;
+
+	if (_num_updates[i] < UINT16_MAX) {
+		_num_updates[i]++;
+	}
+
+	return i;
+}
+
+void TargetFilterBank::removeStale(hrt_abstime now, hrt_abstime timeout)
+{
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		if (active(i) && (now > _last_update[i] + timeout)) {
+			_last_update[i] = 0;
+			_num_updates[i] = 0;
+		}
+	}
+}
+
+int TargetFilterBank::best()
+{
+	if ((_best >= 0) && active(_best)) {
+		return _best;
+	}
+
+	_best = -1;
+
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		if (active(i) && ((_best < 0) || (_num_updates[i] > _num_updates[_best]))) {
+			_best = i;
+		}
+	}
+
+	return _best;
+}
+
+bool TargetFilterBank::anyActive() const
+{
+	for (int i = 0; i < MAX_TARGETS; i++) {
+		if (active(i)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TargetFilterBank::getState(int i, float &x, float &vx, float &y, float &vy) const
+{
+	x = _x[i];
+	vx = _vx[i];
+	y = _y[i];
+	vy = _vy[i];
+}
+
+void TargetFilterBank::getCovariance(int i, float &pos_variance, float &vel_variance) const
+{
+	pos_variance = _p00[i];
+	vel_variance = _p11[i];
+}
+
+void TargetFilterBank::getInnovations(int i, float &innov_x, float &innov_y, float &innov_var) const
+{
+	innov_x = _innov_x[i];
+	innov_y = _innov_y[i];
+	innov_var = _innov_var[i];
+}
+
+} // namespace landing_target_estimator
@@ -0,0 +1,157 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/*
+ * @file TargetFilterBank.h
+ * Bank of landing target filters, one hypothesis per observed target.
+ *
+ * Every hypothesis is a constant velocity model per horizontal axis, predicted with
+ * the vehicle acceleration and updated with a direct position measurement:
+ * x_{k+1} = A * x_{k} + G * a, A = [1 dt; 0 1], H = [1 0]
+ *
+ * Both axes use the same process and measurement noise, so they share one
+ * covariance per hypothesis. The states are kept as structure of arrays, so
+ * the prediction and the association gates of all hypotheses are plain loops
+ * the compiler can vectorize.
+ *
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+
+namespace landing_target_estimator
+{
+
+class TargetFilterBank
+{
+public:
+	static constexpr int MAX_TARGETS = 4;
+	static_assert(MAX_TARGETS > 1, "a new target must not replace the best one");
+
+	struct Measurement {
+		hrt_abstime timestamp;
+		uint16_t signature;	///< target id reported by the sensor
+		float x;		///< relative position north [m]
+		float y;		///< relative position east [m]
+		float variance;		///< measurement variance [m^2]
+	};
+
+	struct InitialState {
+		float vx;		///< relative velocity north [m/s]
+		float vy;		///< relative velocity east [m/s]
+		float pos_variance;
+		float vel_variance;
+	};
+
+	TargetFilterBank() { reset(); }
+	~TargetFilterBank() = default;
+
+	void reset();
+
+	/**
+	 * Predict all hypotheses with an external acceleration estimate
+	 * @param dt      Time delta in seconds since the last prediction
+	 * @param acc_x   Acceleration estimate north
+	 * @param acc_y   Acceleration estimate east
+	 * @param acc_unc Variance of the acceleration estimate
+	 */
+	void predict(float dt, float acc_x, float acc_y, float acc_unc);
+
+	/**
+	 * Associate a measurement with the hypothesis of the same signature that has the smallest
+	 * normalized innovation within the gate and update it. A measurement that fits no
+	 * hypothesis starts a new one, replacing the least recently updated if the bank is full.
+	 * @return index of the updated or new hypothesis
+	 */
+	int update(const Measurement &meas, const InitialState &init);
+
+	/**
+	 * Drop the hypotheses not updated within the timeout
+	 */
+	void removeStale(hrt_abstime now, hrt_abstime timeout);
+
+	/**
+	 * The best target stays selected as long as it is tracked, then the next one
+	 * is the hypothesis with the most updates.
+	 * @return index of the best target, -1 if no target is tracked
+	 */
+	int best();
+
+	bool active(int i) const { return _last_update[i] != 0; }
+	bool anyActive() const;
+
+	hrt_abstime lastUpdate(int i) const { return _last_update[i]; }
+	uint16_t signature(int i) const { return _signature[i]; }
+	uint16_t numUpdates(int i) const { return _num_updates[i]; }
+
+	void getState(int i, float &x, float &vx, float &y, float &vy) const;
+
+	/**
+	 * Get the position and velocity variances, the same for both axes
+	 */
+	void getCovariance(int i, float &pos_variance, float &vel_variance) const;
+
+	/**
+	 * Get measurement innovations and their variance of the last update of a hypothesis
+	 */
+	void getInnovations(int i, float &innov_x, float &innov_y, float &innov_var) const;
+
+private:
+	/* chi-squared 95% quantile for 2 degrees of freedom */
+	static constexpr float GATE_SIZE = 5.99f;
+
+	void initHypothesis(int i, const Measurement &meas, const InitialState &init);
+
+	float _x[MAX_TARGETS];
+	float _vx[MAX_TARGETS];
+	float _y[MAX_TARGETS];
+	float _vy[MAX_TARGETS];
+
+	// state covariance [p00 p01; p01 p11], shared by both axes
+	float _p00[MAX_TARGETS];
+	float _p01[MAX_TARGETS];
+	float _p11[MAX_TARGETS];
+
+	float _innov_x[MAX_TARGETS];
+	float _innov_y[MAX_TARGETS];
+	float _innov_var[MAX_TARGETS];
+
+	hrt_abstime _last_update[MAX_TARGETS]; ///< 0 for unused slots
+	uint16_t _signature[MAX_TARGETS];
+	uint16_t _num_updates[MAX_TARGETS];
+
+	int _best{-1};
+};
+} // namespace landing_target_estimator
@@ -33,6 +33,10 @@
 
 #include "LoadMon.hpp"
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+#include <uORB/uORBManager.hpp>
+#endif
+
 #if defined(__PX4_NUTTX)
 // if free stack space falls below this, print a warning
 #if defined(CONFIG_ARMV7M_STACKCHECK)
@@ -41,7 +45,8 @@ static constexpr unsigned STACK_LOW_WARNING_THRESHOLD = 100;
 static constexpr unsigned STACK_LOW_WARNING_THRESHOLD = 300;
 #endif
 
-static constexpr unsigned FDS_LOW_WARNING_THRESHOLD = 2; ///< if free file descriptors fall below this, print a warning
+// time budget per cycle for the stack checks, each check scans the free part of a stack for the fill pattern
+static constexpr hrt_abstime STACK_CHECK_BUDGET_US = 200;
 #endif
 
 using namespace time_literals;
@@ -99,9 +104,15 @@ void LoadMon::Run()
 #endif
 	perf_begin(_cycle_perf);
 
+#if defined(__PX4_NUTTX)
+	// walks the whole heap, do it once for both the cpuload and heap_info
+	_mem = mallinfo();
+#endif
+
 	cpuload();
 
 #if defined(__PX4_NUTTX)
+	heap_usage();
 
 	if (_param_sys_stck_en.get()) {
 		stack_usage();
@@ -109,6 +120,14 @@ void LoadMon::Run()
 
 #endif
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+	topic_statistics();
+#endif
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+	work_item_statistics();
+#endif
+
 	if (should_exit()) {
 		ScheduleClear();
 #if defined (__PX4_LINUX)
@@ -226,8 +245,7 @@ void LoadMon::cpuload()
 	cpuload.load = interval_spent_time / interval;
 #elif defined(__PX4_NUTTX)
 	// get ram usage
-	struct mallinfo mem = mallinfo();
-	cpuload.ram_usage = (float)mem.uordblks / mem.arena;
+	cpuload.ram_usage = (float)_mem.uordblks / _mem.arena;
 	cpuload.load = 1.f - interval_idletime / interval;
 #elif defined(__PX4_QURT)
 	cpuload.ram_usage = 0.0f;
@@ -250,56 +268,138 @@ void LoadMon::cpuload()
 #if defined(__PX4_NUTTX)
 void LoadMon::stack_usage()
 {
-	unsigned stack_free = 0;
+	static_assert(sizeof(task_stack_info_s::task_name) == CONFIG_TASK_NAME_SIZE,
+		      "task_stack_info.task_name must match NuttX CONFIG_TASK_NAME_SIZE");
 
-	bool checked_task = false;
+	const hrt_abstime start = hrt_absolute_time();
+	unsigned published = 0;
 
-	task_stack_info_s task_stack_info{};
-	static_assert(sizeof(task_stack_info.task_name) == CONFIG_TASK_NAME_SIZE,
-		      "task_stack_info.task_name must match NuttX CONFIG_TASK_NAME_SIZE");
+	// Continue after the last checked task, empty slots are skipped without using up the cycle.
+	// Stop when the budget or the publication queue is used up, or after one pass over all slots.
+	for (int slot = 0; slot < CONFIG_FS_PROCFS_MAX_TASKS; slot++) {
+		if ((published >= task_stack_info_s::ORB_QUEUE_LENGTH) || (hrt_elapsed_time(&start) > STACK_CHECK_BUDGET_US)) {
+			break;
+		}
+
+		const int index = _stack_task_index;
+		_stack_task_index = (_stack_task_index + 1) % CONFIG_FS_PROCFS_MAX_TASKS;
 
-	sched_lock();
+		task_stack_info_s task_stack_info{};
+		bool checked_task = false;
 
-	if (system_load.tasks[_stack_task_index].valid && (system_load.tasks[_stack_task_index].tcb->pid > 0)) {
+		sched_lock();
 
-		stack_free = up_check_tcbstack_remain(system_load.tasks[_stack_task_index].tcb);
+		if (system_load.tasks[index].valid && (system_load.tasks[index].tcb->pid > 0)) {
+			task_stack_info.stack_free = up_check_tcbstack_remain(system_load.tasks[index].tcb);
 
-		strncpy((char *)task_stack_info.task_name, system_load.tasks[_stack_task_index].tcb->name, CONFIG_TASK_NAME_SIZE - 1);
-		task_stack_info.task_name[CONFIG_TASK_NAME_SIZE - 1] = '\0';
+			strncpy((char *)task_stack_info.task_name, system_load.tasks[index].tcb->name, CONFIG_TASK_NAME_SIZE - 1);
+			task_stack_info.task_name[CONFIG_TASK_NAME_SIZE - 1] = '\0';
+
+			checked_task = true;
+		}
 
-		checked_task = true;
+		sched_unlock();
 
-#if CONFIG_NFILE_DESCRIPTORS_PER_BLOCK > 0
-		unsigned int tcb_num_used_fds = 0; // number of used file descriptors
-		struct filelist *filelist = &system_load.tasks[_stack_task_index].tcb->group->tg_filelist;
+		if (checked_task) {
+			task_stack_info.timestamp = hrt_absolute_time();
+			_task_stack_info_pub.publish(task_stack_info);
+			published++;
 
-		for (int fdr = 0; fdr < filelist->fl_rows; fdr++) {
-			for (int fdc = 0; fdc < CONFIG_NFILE_DESCRIPTORS_PER_BLOCK; fdc++) {
-				if (filelist->fl_files[fdr][fdc].f_inode) {
-					++tcb_num_used_fds;
-				}
+			if (task_stack_info.stack_free < STACK_LOW_WARNING_THRESHOLD) {
+				PX4_WARN("%s low on stack! (%i bytes left)", task_stack_info.task_name, task_stack_info.stack_free);
 			}
 		}
+	}
+}
+
+void LoadMon::heap_usage()
+{
+	const hrt_abstime now = hrt_absolute_time();
+
+	heap_info_s heap_info{};
+	heap_info.total_bytes = _mem.arena;
+	heap_info.used_bytes = _mem.uordblks;
+	heap_info.free_bytes = _mem.fordblks;
+	heap_info.largest_free_bytes = _mem.mxordblk;
+	heap_info.free_blocks = _mem.ordblks;
 
-#endif // CONFIG_NFILE_DESCRIPTORS_PER_BLOCK
+	if (heap_info.free_bytes < _heap_free_min) {
+		_heap_free_min = heap_info.free_bytes;
 	}
 
-	sched_unlock();
+	heap_info.free_min_bytes = _heap_free_min;
 
-	if (checked_task) {
-		task_stack_info.stack_free = stack_free;
-		task_stack_info.timestamp = hrt_absolute_time();
+	if (heap_info.free_bytes > 0) {
+		heap_info.fragmentation = 1.f - (float)heap_info.largest_free_bytes / heap_info.free_bytes;
+	}
+
+	if (_heap_last_sample != 0) {
+		const float dt = (now - _heap_last_sample) * 1e-6f;
+		heap_info.used_rate = ((int64_t)heap_info.used_bytes - (int64_t)_heap_used_last) / dt;
+	}
+
+	_heap_used_last = heap_info.used_bytes;
+	_heap_last_sample = now;
+
+	heap_info.timestamp = now;
+	_heap_info_pub.publish(heap_info);
+}
+#endif
+
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+void LoadMon::topic_statistics()
+{
+	// publish as many topics per cycle as the queue can hold
+	for (unsigned i = 0; i < uorb_topic_stats_s::ORB_QUEUE_LENGTH; i++) {
+		uorb_topic_stats_s topic_stats;
+
+		if (!uORB::Manager::orb_get_topic_statistics(_topic_stats_index, &topic_stats)) {
+			// end of the node list, restart next cycle
+			_topic_stats_index = 0;
+			break;
+		}
 
-		_task_stack_info_pub.publish(task_stack_info);
+		_topic_stats_index++;
 
-		// Found task low on stack, report and exit. Continue here in next cycle.
-		if (stack_free < STACK_LOW_WARNING_THRESHOLD) {
-			PX4_WARN("%s low on stack! (%i bytes left)", task_stack_info.task_name, stack_free);
+		if (topic_stats.publications > 0) {
+			topic_stats.timestamp = hrt_absolute_time();
+			_uorb_topic_stats_pub.publish(topic_stats);
 		}
 	}
+}
+#endif
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+void LoadMon::work_item_statistics()
+{
+	// publish as many work items per cycle as the queue can hold
+	for (unsigned i = 0; i < work_item_stats_s::ORB_QUEUE_LENGTH; i++) {
+		px4::wq_runtime_stats_t stats;
+
+		if (!px4::WorkQueueManagerGetRuntimeStatistics(_work_item_stats_index, stats)) {
+			// end of the work item list, restart next cycle
+			_work_item_stats_index = 0;
+			break;
+		}
 
-	// Continue after last checked task next cycle
-	_stack_task_index = (_stack_task_index + 1) % CONFIG_FS_PROCFS_MAX_TASKS;
+		_work_item_stats_index++;
+
+		work_item_stats_s work_item_stats{};
+		work_item_stats.runs = px4::wq_runtime_stats_t::count(stats.runtime_bins);
+
+		if (work_item_stats.runs > 0) {
+			strncpy(work_item_stats.item_name, stats.item_name, sizeof(work_item_stats.item_name) - 1);
+			strncpy(work_item_stats.wq_name, stats.wq_name, sizeof(work_item_stats.wq_name) - 1);
+			work_item_stats.runtime_p50_us = px4::wq_runtime_stats_t::percentile(stats.runtime_bins, stats.runtime_max_us, 50);
+			work_item_stats.runtime_p99_us = px4::wq_runtime_stats_t::percentile(stats.runtime_bins, stats.runtime_max_us, 99);
+			work_item_stats.runtime_max_us = stats.runtime_max_us;
+			work_item_stats.wait_p50_us = px4::wq_runtime_stats_t::percentile(stats.wait_bins, stats.wait_max_us, 50);
+			work_item_stats.wait_p99_us = px4::wq_runtime_stats_t::percentile(stats.wait_bins, stats.wait_max_us, 99);
+			work_item_stats.wait_max_us = stats.wait_max_us;
+			work_item_stats.timestamp = hrt_absolute_time();
+			_work_item_stats_pub.publish(work_item_stats);
+		}
+	}
 }
 #endif
 
@@ -315,8 +415,15 @@ int LoadMon::print_usage(const char *reason)
 Background process running periodically on the low priority work queue to calculate the CPU load and RAM
 usage and publish the `cpuload` topic.
 
-On NuttX it also checks the stack usage of each process and if it falls below 300 bytes, a warning is output,
-which will also appear in the log file.
+On NuttX it also checks the stack usage of the processes in turn, as many per cycle as a fixed time budget
+allows, and if it falls below 300 bytes, a warning is output, which will also appear in the log file.
+The heap usage and fragmentation (largest free block, net allocation rate) are published with the `heap_info` topic.
+
+If built with CONFIG_ORB_TOPIC_STATISTICS, it also publishes the publication interval and copy latency statistics
+of all uORB topics in turn with the `uorb_topic_stats` topic.
+
+If built with CONFIG_WORK_QUEUE_RUNTIME_STATISTICS, it publishes the execution and queue wait time percentiles
+of all work items in turn with the `work_item_stats` topic.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("load_mon", "system");
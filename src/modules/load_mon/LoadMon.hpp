@@ -46,7 +46,10 @@
 #include <px4_platform/cpuload.h>
 #include <uORB/Publication.hpp>
 #include <uORB/topics/cpuload.h>
+#include <uORB/topics/heap_info.h>
 #include <uORB/topics/task_stack_info.h>
+#include <uORB/topics/uorb_topic_stats.h>
+#include <uORB/topics/work_item_stats.h>
 
 #if defined(__PX4_LINUX)
 #include <sys/times.h>
@@ -83,15 +86,43 @@ private:
 
 	/* Stack check only available on Nuttx */
 #if defined(__PX4_NUTTX)
-	/* Calculate stack usage */
+	/* Calculate stack usage of as many tasks as the time budget allows */
 	void stack_usage();
 
+	/* Publish the heap statistics of the last mallinfo() */
+	void heap_usage();
+
 	int _stack_task_index{0};
 
+	struct mallinfo _mem {};
+
+	uint32_t _heap_free_min{UINT32_MAX};
+	uint32_t _heap_used_last{0};
+	hrt_abstime _heap_last_sample{0};
+
 	uORB::Publication<task_stack_info_s> _task_stack_info_pub{ORB_ID(task_stack_info)};
+	uORB::Publication<heap_info_s> _heap_info_pub{ORB_ID(heap_info)};
 #endif
 	uORB::Publication<cpuload_s> _cpuload_pub {ORB_ID(cpuload)};
 
+#if defined(CONFIG_ORB_TOPIC_STATISTICS)
+	/* Publish the statistics of a few uORB topics each cycle */
+	void topic_statistics();
+
+	unsigned _topic_stats_index{0};
+
+	uORB::Publication<uorb_topic_stats_s> _uorb_topic_stats_pub{ORB_ID(uorb_topic_stats)};
+#endif
+
+#if defined(CONFIG_WORK_QUEUE_RUNTIME_STATISTICS)
+	/* Publish the runtime statistics of a few work items each cycle */
+	void work_item_statistics();
+
+	unsigned _work_item_stats_index{0};
+
+	uORB::Publication<work_item_stats_s> _work_item_stats_pub{ORB_ID(work_item_stats)};
+#endif
+
 #if defined(__PX4_LINUX)
 	FILE *_proc_fd = nullptr;
 	/* calculate usage directly from clock ticks on Linux */
@@ -0,0 +1,131 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file SparseMeasurement.hpp
+ *
+ * Measurement matrix of a Kalman filter correction that only observes a few states,
+ * stored as its non zero columns. The products with the state and the covariance
+ * only touch these columns instead of multiplying the full dense matrix.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <matrix/Matrix.hpp>
+
+template<size_t N_Y, size_t N_X, size_t N_C>
+class SparseMeasurement
+{
+public:
+	static_assert(N_C <= N_X, "more columns than states");
+
+	/**
+	 * @param states indices of the observed states, the columns of the measurement matrix that can be non zero
+	 */
+	explicit SparseMeasurement(const uint8_t (&states)[N_C])
+	{
+		for (size_t j = 0; j < N_C; j++) {
+			_states[j] = states[j];
+		}
+	}
+
+	/**
+	 * Set the element (row, state) of the measurement matrix, state has to be one of the observed states.
+	 */
+	void set(size_t row, uint8_t state, float value)
+	{
+		for (size_t j = 0; j < N_C; j++) {
+			if (_states[j] == state) {
+				_C(row, j) = value;
+				return;
+			}
+		}
+	}
+
+	// C * x
+	matrix::Vector<float, N_Y> operator*(const matrix::Vector<float, N_X> &x) const
+	{
+		matrix::Vector<float, N_Y> res;
+
+		for (size_t i = 0; i < N_Y; i++) {
+			for (size_t j = 0; j < N_C; j++) {
+				res(i) += _C(i, j) * x(_states[j]);
+			}
+		}
+
+		return res;
+	}
+
+	// C * A
+	template<size_t M>
+	matrix::Matrix<float, N_Y, M> operator*(const matrix::Matrix<float, N_X, M> &A) const
+	{
+		matrix::Matrix<float, N_Y, M> res;
+
+		for (size_t i = 0; i < N_Y; i++) {
+			for (size_t j = 0; j < N_C; j++) {
+				const float c = _C(i, j);
+
+				for (size_t k = 0; k < M; k++) {
+					res(i, k) += c * A(_states[j], k);
+				}
+			}
+		}
+
+		return res;
+	}
+
+	// A * C^T, e.g. P * C^T for the Kalman gain
+	template<size_t M>
+	matrix::Matrix<float, M, N_Y> multiplyTransposed(const matrix::Matrix<float, M, N_X> &A) const
+	{
+		matrix::Matrix<float, M, N_Y> res;
+
+		for (size_t k = 0; k < M; k++) {
+			for (size_t i = 0; i < N_Y; i++) {
+				for (size_t j = 0; j < N_C; j++) {
+					res(k, i) += A(k, _states[j]) * _C(i, j);
+				}
+			}
+		}
+
+		return res;
+	}
+
+private:
+	uint8_t _states[N_C] {};
+	matrix::Matrix<float, N_Y, N_C> _C{};
+};
@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurement.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -58,17 +59,17 @@ void BlockLocalPositionEstimator::baroCorrect()
 	y -= _baroAltOrigin;
 
 	// baro measurement matrix
-	Matrix<float, n_y_baro, n_x> C;
-	C.setZero();
-	C(Y_baro_z, X_z) = -1;	// measured altitude, negative down dir.
+	SparseMeasurement<n_y_baro, n_x, 1> C{{X_z}};
+	C.set(Y_baro_z, X_z, -1);	// measured altitude, negative down dir.
 
 	Matrix<float, n_y_baro, n_y_baro> R;
 	R.setZero();
 	R(0, 0) = _param_lpe_bar_z.get() * _param_lpe_bar_z.get();
 
 	// residual
+	const Matrix<float, n_x, n_y_baro> PCt = C.multiplyTransposed(m_P);
 	Matrix<float, n_y_baro, n_y_baro> S_I =
-		inv<float, n_y_baro>((C * m_P * C.transpose()) + R);
+		inv<float, n_y_baro>(C * PCt + R);
 	Vector<float, n_y_baro> r = y - (C * _x);
 
 	// fault detection
@@ -87,10 +88,10 @@ void BlockLocalPositionEstimator::baroCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_baro> K = m_P * C.transpose() * S_I;
+	Matrix<float, n_x, n_y_baro> K = PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 }
 
 void BlockLocalPositionEstimator::baroCheckTimeout()
@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurement.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -43,13 +44,12 @@ void BlockLocalPositionEstimator::landCorrect()
 	if (landMeasure(y) != OK) { return; }
 
 	// measurement matrix
-	Matrix<float, n_y_land, n_x> C;
-	C.setZero();
+	SparseMeasurement<n_y_land, n_x, 4> C{{X_z, X_vx, X_vy, X_tz}};
 	// y = -(z - tz)
-	C(Y_land_vx, X_vx) = 1;
-	C(Y_land_vy, X_vy) = 1;
-	C(Y_land_agl, X_z) = -1;// measured altitude, negative down dir.
-	C(Y_land_agl, X_tz) = 1;// measured altitude, negative down dir.
+	C.set(Y_land_vx, X_vx, 1);
+	C.set(Y_land_vy, X_vy, 1);
+	C.set(Y_land_agl, X_z, -1);// measured altitude, negative down dir.
+	C.set(Y_land_agl, X_tz, 1);// measured altitude, negative down dir.
 
 	// use parameter covariance
 	SquareMatrix<float, n_y_land> R;
@@ -59,7 +59,8 @@ void BlockLocalPositionEstimator::landCorrect()
 	R(Y_land_agl, Y_land_agl) = _param_lpe_land_z.get() * _param_lpe_land_z.get();
 
 	// residual
-	Matrix<float, n_y_land, n_y_land> S_I = inv<float, n_y_land>((C * m_P * C.transpose()) + R);
+	const Matrix<float, n_x, n_y_land> PCt = C.multiplyTransposed(m_P);
+	Matrix<float, n_y_land, n_y_land> S_I = inv<float, n_y_land>(C * PCt + R);
 	Vector<float, n_y_land> r = y - C * _x;
 	_pub_innov.get().hagl = r(Y_land_agl);
 	_pub_innov_var.get().hagl = R(Y_land_agl, Y_land_agl);
@@ -85,10 +86,10 @@ void BlockLocalPositionEstimator::landCorrect()
 	}
 
 	// kalman filter correction always for land detector
-	Matrix<float, n_x, n_y_land> K = m_P * C.transpose() * S_I;
+	Matrix<float, n_x, n_y_land> K = PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 }
 
 void BlockLocalPositionEstimator::landCheckTimeout()
@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurement.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -64,12 +65,11 @@ void BlockLocalPositionEstimator::landingTargetCorrect()
 	}
 
 	// target measurement matrix and noise matrix
-	Matrix<float, n_y_target, n_x> C;
-	C.setZero();
+	SparseMeasurement<n_y_target, n_x, 2> C{{X_vx, X_vy}};
 	// residual = (y + vehicle velocity)
 	// sign change because target velocitiy is -vehicle velocity
-	C(Y_target_x, X_vx) = -1;
-	C(Y_target_y, X_vy) = -1;
+	C.set(Y_target_x, X_vx, -1);
+	C.set(Y_target_y, X_vy, -1);
 
 	// covariance matrix
 	SquareMatrix<float, n_y_target> R;
@@ -81,8 +81,9 @@ void BlockLocalPositionEstimator::landingTargetCorrect()
 	Vector<float, n_y_target> r = y - C * _x;
 
 	// residual covariance, (inverse)
+	const Matrix<float, n_x, n_y_target> PCt = C.multiplyTransposed(m_P);
 	Matrix<float, n_y_target, n_y_target> S_I =
-		inv<float, n_y_target>(C * m_P * C.transpose() + R);
+		inv<float, n_y_target>(C * PCt + R);
 
 	// fault detection
 	float beta = (r.transpose()  * (S_I * r))(0, 0);
@@ -103,10 +104,10 @@ void BlockLocalPositionEstimator::landingTargetCorrect()
 
 	// kalman filter correction
 	Matrix<float, n_x, n_y_target> K =
-		m_P * C.transpose() * S_I;
+		PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 
 }
 
@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurement.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -67,12 +68,11 @@ void BlockLocalPositionEstimator::lidarCorrect()
 	if (lidarMeasure(y) != OK) { return; }
 
 	// measurement matrix
-	Matrix<float, n_y_lidar, n_x> C;
-	C.setZero();
+	SparseMeasurement<n_y_lidar, n_x, 2> C{{X_z, X_tz}};
 	// y = -(z - tz)
 	// TODO could add trig to make this an EKF correction
-	C(Y_lidar_z, X_z) = -1;	// measured altitude, negative down dir.
-	C(Y_lidar_z, X_tz) = 1;	// measured altitude, negative down dir.
+	C.set(Y_lidar_z, X_z, -1);	// measured altitude, negative down dir.
+	C.set(Y_lidar_z, X_tz, 1);	// measured altitude, negative down dir.
 
 	// use parameter covariance unless sensor provides reasonable value
 	SquareMatrix<float, n_y_lidar> R;
@@ -89,7 +89,8 @@ void BlockLocalPositionEstimator::lidarCorrect()
 	// residual
 	Vector<float, n_y_lidar> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_lidar, n_y_lidar> S = C * m_P * C.transpose() + R;
+	const Matrix<float, n_x, n_y_lidar> PCt = C.multiplyTransposed(m_P);
+	Matrix<float, n_y_lidar, n_y_lidar> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().hagl = r(0);
@@ -116,10 +117,10 @@ void BlockLocalPositionEstimator::lidarCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_lidar> K = m_P * C.transpose() * S_I;
+	Matrix<float, n_x, n_y_lidar> K = PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 }
 
 void BlockLocalPositionEstimator::lidarCheckTimeout()
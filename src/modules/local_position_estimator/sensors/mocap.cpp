@@ -1,4 +1,5 @@
 #include "../BlockLocalPositionEstimator.hpp"
+#include "../SparseMeasurement.hpp"
 #include <systemlib/mavlink_log.h>
 #include <matrix/math.hpp>
 
@@ -109,11 +110,10 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// mocap measurement matrix, measures position
-	Matrix<float, n_y_mocap, n_x> C;
-	C.setZero();
-	C(Y_mocap_x, X_x) = 1;
-	C(Y_mocap_y, X_y) = 1;
-	C(Y_mocap_z, X_z) = 1;
+	SparseMeasurement<n_y_mocap, n_x, 3> C{{X_x, X_y, X_z}};
+	C.set(Y_mocap_x, X_x, 1);
+	C.set(Y_mocap_y, X_y, 1);
+	C.set(Y_mocap_z, X_z, 1);
 
 	// noise matrix
 	Matrix<float, n_y_mocap, n_y_mocap> R;
@@ -139,7 +139,8 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	// residual
 	Vector<float, n_y_mocap> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_mocap, n_y_mocap> S = C * m_P * C.transpose() + R;
+	const Matrix<float, n_x, n_y_mocap> PCt = C.multiplyTransposed(m_P);
+	Matrix<float, n_y_mocap, n_y_mocap> S = C * PCt + R;
 
 	// publish innovations
 	_pub_innov.get().ev_hpos[0] = r(0);
@@ -175,10 +176,10 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	}
 
 	// kalman filter correction always
-	Matrix<float, n_x, n_y_mocap> K = m_P * C.transpose() * S_I;
+	Matrix<float, n_x, n_y_mocap> K = PCt * S_I;
 	Vector<float, n_x> dx = K * r;
 	_x += dx;
-	m_P -= K * C * m_P;
+	m_P -= K * (C * m_P);
 }
 
 void BlockLocalPositionEstimator::mocapCheckTimeout()
@@ -0,0 +1,128 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "delta_compression.h"
+
+namespace px4
+{
+namespace logger
+{
+namespace delta_compression
+{
+
+static constexpr uint8_t ZERO_RUN = 0x80;
+static constexpr size_t MAX_RUN = 128;
+
+size_t encode(const uint8_t *data, const uint8_t *previous, size_t size, uint8_t *out, size_t out_size)
+{
+	// never produce an encoding that is not smaller than the plain message
+	const size_t limit = (out_size < size) ? out_size : size - 1;
+	size_t pos = 0;
+	size_t i = 0;
+
+	while (i < size) {
+		size_t run = 0;
+
+		if (data[i] == previous[i]) {
+			while ((i + run < size) && (run < MAX_RUN) && (data[i + run] == previous[i + run])) {
+				run++;
+			}
+
+			if (pos + 1 > limit) {
+				return 0;
+			}
+
+			out[pos++] = ZERO_RUN | (uint8_t)(run - 1);
+
+		} else {
+			// literal run until the next pair of unchanged bytes (a single one is cheaper as literal)
+			while ((i + run < size) && (run < MAX_RUN)
+			       && ((data[i + run] != previous[i + run])
+				   || ((i + run + 1 < size) && (data[i + run + 1] != previous[i + run + 1])))) {
+				run++;
+			}
+
+			if (pos + 1 + run > limit) {
+				return 0;
+			}
+
+			out[pos++] = (uint8_t)(run - 1);
+
+			for (size_t j = 0; j < run; j++) {
+				out[pos++] = data[i + j] ^ previous[i + j];
+			}
+		}
+
+		i += run;
+	}
+
+	return pos;
+}
+
+bool decode(const uint8_t *encoded, size_t encoded_size, const uint8_t *previous, size_t size, uint8_t *out)
+{
+	size_t pos = 0;
+	size_t i = 0;
+
+	while (pos < encoded_size) {
+		const uint8_t control = encoded[pos++];
+		const size_t run = (control & ~ZERO_RUN) + 1;
+
+		if (i + run > size) {
+			return false;
+		}
+
+		if (control & ZERO_RUN) {
+			for (size_t j = 0; j < run; j++) {
+				out[i + j] = previous[i + j];
+			}
+
+		} else {
+			if (pos + run > encoded_size) {
+				return false;
+			}
+
+			for (size_t j = 0; j < run; j++) {
+				out[i + j] = previous[i + j] ^ encoded[pos++];
+			}
+		}
+
+		i += run;
+	}
+
+	return i == size;
+}
+
+} // namespace delta_compression
+} // namespace logger
+} // namespace px4
@@ -0,0 +1,77 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace px4
+{
+namespace logger
+{
+namespace delta_compression
+{
+
+/**
+ * Encode a message relative to the previous message of the same topic: the XOR of both is
+ * written as a sequence of runs, each starting with a control byte c:
+ * - c < 0x80: c + 1 literal (XOR) bytes follow
+ * - c >= 0x80: (c & 0x7f) + 1 bytes are unchanged (XOR 0), nothing follows
+ *
+ * Consecutive samples of numerical topics mostly differ in a few low order bytes, so the
+ * XOR is dominated by zero runs.
+ *
+ * @param data message to encode
+ * @param previous previous message of the same topic
+ * @param size size of data and previous in bytes
+ * @param out output buffer
+ * @param out_size output buffer size
+ * @return encoded size, 0 if the encoding is not smaller than size or does not fit
+ */
+size_t encode(const uint8_t *data, const uint8_t *previous, size_t size, uint8_t *out, size_t out_size);
+
+/**
+ * Decode a message encoded with encode().
+ * @param encoded encoded data
+ * @param encoded_size size of the encoded data
+ * @param previous previous message of the same topic
+ * @param size message size in bytes
+ * @param out output message (size bytes)
+ * @return true on success, false if the encoded data is corrupt
+ */
+bool decode(const uint8_t *encoded, size_t encoded_size, const uint8_t *previous, size_t size, uint8_t *out);
+
+} // namespace delta_compression
+} // namespace logger
+} // namespace px4
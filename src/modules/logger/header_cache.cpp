@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "header_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace px4
+{
+namespace logger
+{
+
+HeaderCache::~HeaderCache()
+{
+	free(_buffer);
+}
+
+void HeaderCache::begin()
+{
+	_size = 0;
+	_valid = false;
+}
+
+bool HeaderCache::append(const void *msg, size_t size)
+{
+	if (_failed) {
+		return false;
+	}
+
+	if (_size + size > _capacity) {
+		size_t capacity = (_capacity > 0) ? _capacity : 4096;
+
+		while (capacity < _size + size) {
+			capacity *= 2;
+		}
+
+		uint8_t *buffer = (uint8_t *)realloc(_buffer, capacity);
+
+		if (buffer == nullptr) {
+			// give the memory back, the header is then written message by message
+			free(_buffer);
+			_buffer = nullptr;
+			_capacity = 0;
+			_size = 0;
+			_failed = true;
+			return false;
+		}
+
+		_buffer = buffer;
+		_capacity = capacity;
+	}
+
+	memcpy(_buffer + _size, msg, size);
+	_size += size;
+	return true;
+}
+
+void HeaderCache::end()
+{
+	_valid = !_failed;
+}
+
+} // namespace logger
+} // namespace px4
@@ -0,0 +1,93 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class HeaderCache
+ * Serialized ULog messages of a log header section (e.g. the formats), built once
+ * while not logging, so that starting a log writes them with a single copy.
+ *
+ * Only used from the logger thread.
+ */
+class HeaderCache
+{
+public:
+	HeaderCache() = default;
+	~HeaderCache();
+
+	/**
+	 * Start building the cache from scratch, keeps the allocation
+	 */
+	void begin();
+
+	/**
+	 * Add a message (including its ULog message header)
+	 * @return false if out of memory, the cache then stays invalid
+	 */
+	bool append(const void *msg, size_t size);
+
+	/**
+	 * Mark the cache as complete. It is only valid if all appends succeeded.
+	 */
+	void end();
+
+	void invalidate() { _valid = false; }
+
+	bool valid() const { return _valid; }
+
+	/** true if building failed before, building again would fail too */
+	bool failed() const { return _failed; }
+
+	const uint8_t *data() const { return _buffer; }
+	size_t size() const { return _size; }
+
+private:
+	uint8_t *_buffer{nullptr};
+	size_t _capacity{0};
+	size_t _size{0};
+	bool _valid{false};
+	bool _failed{false};
+};
+
+} // namespace logger
+} // namespace px4
@@ -140,6 +140,36 @@ public:
 		return 0;
 	}
 
+	/**
+	 * Get the write stall statistics of the file backend since the last call and reset them.
+	 */
+	LogWriterFile::WriteStallStatistics get_write_stall_statistics_file(LogType type)
+	{
+		if (_log_writer_file) { return _log_writer_file->get_write_stall_statistics(type); }
+
+		return {};
+	}
+
+#if defined(PX4_CRYPTO)
+	/**
+	 * Get the encryption statistics of the file backend since the last call and reset them.
+	 */
+	LogWriterFile::EncryptionStatistics get_encryption_statistics_file()
+	{
+		if (_log_writer_file) { return _log_writer_file->get_encryption_statistics(); }
+
+		return {};
+	}
+#endif
+
+	/**
+	 * Set the preallocation extent for the next file log of a type (0 to disable).
+	 */
+	void set_file_preallocation(LogType type, size_t extent)
+	{
+		if (_log_writer_file) { _log_writer_file->set_preallocation(type, extent); }
+	}
+
 	pthread_t thread_id_file() const
 	{
 		if (_log_writer_file) { return _log_writer_file->thread_id(); }
@@ -159,6 +189,19 @@ public:
 		if (_log_writer_mavlink) { _log_writer_mavlink->set_need_reliable_transfer(need_reliable && mavlink_backed_too); }
 	}
 
+	/**
+	 * Mark the following mavlink messages as (not) being part of the log header.
+	 */
+	void set_mavlink_header(bool header)
+	{
+		if (_log_writer_mavlink) { _log_writer_mavlink->set_header(header); }
+	}
+
+	void set_mavlink_ack_window(int window)
+	{
+		if (_log_writer_mavlink) { _log_writer_mavlink->set_ack_window(window); }
+	}
+
 	bool need_reliable_transfer() const
 	{
 		if (_log_writer_file) { return _log_writer_file->need_reliable_transfer(); }
@@ -403,6 +403,11 @@ void LogWriterFile::run()
 				available = (available / _min_blocksize) * _min_blocksize;
 #endif
 
+				if (buffer.direct_io() && buffer._should_run && available >= _min_write_chunk) {
+					// write whole chunks only, so that the file offset stays aligned
+					available = (available / _min_write_chunk) * _min_write_chunk;
+				}
+
 				/* if sufficient data available or partial read or terminating, write data */
 				if (available >= min_available[i] || is_part || (!buffer._should_run && available > 0)) {
 					pthread_mutex_unlock(&_mtx);
@@ -414,21 +419,32 @@ void LogWriterFile::run()
 					 * - the encryption can be done in
 					     place. This is always taken care
 					     by the px4 crypto interfaces
+					 * Only the part not encrypted yet is encrypted, the rest of a
+					 * partial write is already encrypted when it gets written.
 					 */
 
-					size_t out = available;
+					size_t encrypted_now = 0;
+					hrt_abstime encryption_time = 0;
+
+					if (_algorithm != CRYPTO_NONE && available > buffer._encrypted) {
+						const hrt_abstime encryption_start = hrt_absolute_time();
+						encrypted_now = available - buffer._encrypted;
+						uint8_t *encrypt_ptr = (uint8_t *)read_ptr + buffer._encrypted;
+						size_t out = encrypted_now;
 
-					if (_algorithm != CRYPTO_NONE) {
 						_crypto.encrypt_data(
 							_key_idx,
-							(uint8_t *)read_ptr,
-							available,
-							(uint8_t *)read_ptr,
+							encrypt_ptr,
+							encrypted_now,
+							encrypt_ptr,
 							&out);
 
-						if (out != available) {
+						if (out != encrypted_now) {
 							PX4_ERR("Encryption output size mismatch, logfile corrupted");
 						}
+
+						buffer._encrypted = available;
+						encryption_time = hrt_elapsed_time(&encryption_start);
 					}
 
 #endif
@@ -445,6 +461,11 @@ void LogWriterFile::run()
 					/* buffer.mark_read() requires _mtx to be locked */
 					pthread_mutex_lock(&_mtx);
 
+#if defined(PX4_CRYPTO)
+					_encryption_stats.bytes += encrypted_now;
+					_encryption_stats.time_us += encryption_time;
+#endif
+
 					if (written >= 0) {
 						/* subtract bytes written from number in buffer (count -= written) */
 						buffer.mark_read(written);
@@ -658,7 +679,32 @@ size_t LogWriterFile::LogFileBuffer::get_read_ptr(void **ptr, bool *is_part)
 
 bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 {
-	_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
+	_preallocating = false;
+	_direct_io = false;
+	_allocated = 0;
+	_file_size = 0;
+	_stall_stats = {};
+
+#if defined(__PX4_LINUX)
+
+	if (_prealloc_extent > 0) {
+		_fd = ::open(filename, O_CREAT | O_WRONLY | O_DIRECT, PX4_O_MODE_666);
+
+		if (_fd >= 0) {
+			_preallocating = true;
+			_direct_io = true;
+
+		} else {
+			PX4_WARN("direct I/O not supported (%i), using buffered writes", errno);
+		}
+	}
+
+	if (_fd < 0)
+#endif // __PX4_LINUX
+	{
+		_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
+	}
+
 	_had_write_error.store(false);
 
 	if (_fd < 0) {
@@ -686,7 +732,23 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 
 #endif // __PX4_NUTTX
 
-		_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
+#if defined(__PX4_LINUX)
+
+		if (_prealloc_extent > 0) {
+			// direct I/O needs whole, aligned chunks
+			_buffer_size = (_buffer_size + _min_write_chunk - 1) / _min_write_chunk * _min_write_chunk;
+
+			void *buffer = nullptr;
+
+			if (posix_memalign(&buffer, _min_write_chunk, _buffer_size) == 0) {
+				_buffer = (uint8_t *)buffer;
+			}
+
+		} else
+#endif // __PX4_LINUX
+		{
+			_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
+		}
 
 		if (_buffer == nullptr) {
 			PX4_ERR("Can't create log buffer");
@@ -696,6 +758,11 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 		}
 	}
 
+	if (_direct_io && ((((uintptr_t)_buffer % _min_write_chunk) != 0) || ((_buffer_size % _min_write_chunk) != 0))) {
+		// buffer allocated for an earlier log without preallocation
+		disable_direct_io();
+	}
+
 	// Clear buffer and counters
 	_head = 0;
 	_count = 0;
@@ -713,11 +780,34 @@ void LogWriterFile::LogFileBuffer::fsync() const
 	perf_end(_perf_fsync);
 }
 
-ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t size, bool call_fsync) const
+ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t size, bool call_fsync)
 {
+	if (_direct_io && ((((uintptr_t)buffer % _min_write_chunk) != 0) || ((size % _min_write_chunk) != 0))) {
+		// unaligned remainder (e.g. when stopping), continue with buffered writes
+		disable_direct_io();
+	}
+
+	const hrt_abstime write_start = hrt_absolute_time();
+
+	preallocate(size);
+
 	perf_begin(_perf_write);
 	ssize_t ret = ::write(_fd, buffer, size);
 	perf_end(_perf_write);
+	const hrt_abstime write_time = hrt_elapsed_time(&write_start);
+
+	if (ret > 0) {
+		_file_size += ret;
+	}
+
+	if (write_time > _stall_threshold) {
+		_stall_stats.stalls++;
+		_stall_stats.stall_time_us += write_time;
+	}
+
+	if (write_time > _stall_stats.max_write_time_us) {
+		_stall_stats.max_write_time_us = write_time;
+	}
 
 	if (call_fsync) {
 		fsync();
@@ -726,9 +816,60 @@ ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t s
 	return ret;
 }
 
+void LogWriterFile::LogFileBuffer::preallocate(size_t size)
+{
+#if defined(__PX4_LINUX)
+
+	while (_preallocating && (_file_size + (off_t)size > _allocated)) {
+		// keep the file size, so that an unclosed log does not end with unwritten space
+		if (fallocate(_fd, FALLOC_FL_KEEP_SIZE, _allocated, _prealloc_extent) == 0) {
+			_allocated += _prealloc_extent;
+
+		} else {
+			PX4_WARN("log file preallocation failed (%i)", errno);
+			_preallocating = false;
+		}
+	}
+
+#else
+	(void)size;
+#endif // __PX4_LINUX
+}
+
+void LogWriterFile::LogFileBuffer::disable_direct_io()
+{
+#if defined(__PX4_LINUX)
+	const int flags = fcntl(_fd, F_GETFL);
+
+	if (flags != -1) {
+		fcntl(_fd, F_SETFL, flags & ~O_DIRECT);
+	}
+
+#endif // __PX4_LINUX
+
+	_direct_io = false;
+}
+
+LogWriterFile::WriteStallStatistics LogWriterFile::LogFileBuffer::get_write_stall_statistics()
+{
+	WriteStallStatistics stats = _stall_stats;
+	stats.direct_io = _direct_io;
+	_stall_stats = {};
+	return stats;
+}
+
 void LogWriterFile::LogFileBuffer::close_file()
 {
 	if (_fd >= 0) {
+#if defined(__PX4_LINUX)
+
+		if (_allocated > _file_size) {
+			// release the preallocated space beyond the end of the log
+			ftruncate(_fd, _file_size);
+		}
+
+#endif // __PX4_LINUX
+
 		int res = close(_fd);
 
 		if (res) {
@@ -744,6 +885,7 @@ void LogWriterFile::LogFileBuffer::reset()
 {
 	_head = 0;
 	_count = 0;
+	_encrypted = 0;
 	_fd = -1;
 }
 
@@ -134,9 +134,44 @@ public:
 
 	bool had_write_error() const { return _buffers[(int)LogType::Full]._had_write_error.load(); }
 
+	struct WriteStallStatistics {
+		uint32_t stalls;		///< number of writes taking longer than stall_threshold
+		uint64_t stall_time_us;		///< total time spent in stalled writes
+		uint32_t max_write_time_us;
+		bool direct_io;			///< file is written with direct I/O
+	};
+
+	/**
+	 * Get the write stall statistics since the last call and reset them.
+	 */
+	WriteStallStatistics get_write_stall_statistics(LogType type) { return _buffers[(int)type].get_write_stall_statistics(); }
+
+	/**
+	 * Preallocate the next log file in extents of the given size and write it with direct I/O (Linux only).
+	 * @param extent size in bytes, 0 to disable
+	 */
+	void set_preallocation(LogType type, size_t extent) { _buffers[(int)type].set_preallocation(extent); }
+
 	pthread_t thread_id() const { return _thread; }
 
 #if defined(PX4_CRYPTO)
+	struct EncryptionStatistics {
+		uint64_t bytes;			///< number of bytes encrypted
+		uint64_t time_us;		///< time spent encrypting
+	};
+
+	/**
+	 * Get the encryption statistics since the last call and reset them.
+	 */
+	EncryptionStatistics get_encryption_statistics()
+	{
+		pthread_mutex_lock(&_mtx);
+		EncryptionStatistics stats = _encryption_stats;
+		_encryption_stats = {};
+		pthread_mutex_unlock(&_mtx);
+		return stats;
+	}
+
 	void set_encryption_parameters(px4_crypto_algorithm_t algorithm, uint8_t key_idx,  uint8_t exchange_key_idx)
 	{
 		_algorithm = algorithm;
@@ -166,6 +201,9 @@ private:
 	/* 512 didn't seem to work properly, 4096 should match the FAT cluster size */
 	static constexpr size_t	_min_write_chunk = 4096;
 
+	/* writes taking longer than this are counted as stalls */
+	static constexpr hrt_abstime _stall_threshold = 20000;
+
 	class LogFileBuffer
 	{
 	public:
@@ -191,18 +229,31 @@ private:
 
 		int fd() const { return _fd; }
 
-		inline ssize_t write_to_file(const void *buffer, size_t size, bool call_fsync) const;
+		inline ssize_t write_to_file(const void *buffer, size_t size, bool call_fsync);
 
 		inline void fsync() const;
 
-		void mark_read(size_t n) { _count -= n; _total_written += n; }
+		void mark_read(size_t n)
+		{
+			_count -= n;
+			_total_written += n;
+			_encrypted = (_encrypted > n) ? _encrypted - n : 0;
+		}
 
 		size_t total_written() const { return _total_written; }
 		size_t buffer_size() const { return _buffer_size; }
 		size_t count() const { return _count; }
 
+		/** true if only whole, aligned chunks of _min_write_chunk can currently be written */
+		bool direct_io() const { return _direct_io; }
+
+		void set_preallocation(size_t extent) { _prealloc_extent = extent; }
+
+		WriteStallStatistics get_write_stall_statistics();
+
 		bool _should_run = false;
 		px4::atomic_bool _had_write_error{false};
+		size_t _encrypted = 0; ///< bytes at the read pointer that are already encrypted (writer thread only)
 	private:
 		size_t _buffer_size;
 		const size_t _buffer_size_min;
@@ -211,6 +262,18 @@ private:
 		size_t _head = 0; ///< next position to write to
 		size_t _count = 0; ///< number of bytes in _buffer to be written
 		size_t _total_written = 0;
+
+		void preallocate(size_t size);
+		void disable_direct_io();
+
+		size_t _prealloc_extent = 0; ///< preallocation extent requested for the next log
+		bool _preallocating = false;
+		bool _direct_io = false;
+		off_t _allocated = 0; ///< preallocated file size
+		off_t _file_size = 0;
+
+		WriteStallStatistics _stall_stats{};
+
 		perf_counter_t _perf_write;
 		perf_counter_t _perf_fsync;
 	};
@@ -230,6 +293,7 @@ private:
 	px4_crypto_algorithm_t _algorithm;
 	uint8_t _key_idx;
 	uint8_t _exchange_key_idx;
+	EncryptionStatistics _encryption_stats{}; ///< protected by _mtx
 #endif
 
 };
@@ -75,6 +75,9 @@ void LogWriterMavlink::start_log()
 	_ulog_stream_data.msg_sequence = 0;
 	_ulog_stream_data.length = 0;
 	_ulog_stream_data.first_message_offset = 0;
+	_num_unacked = 0;
+	_header = false;
+	_header_start = false;
 
 	_is_started = true;
 }
@@ -82,9 +85,30 @@ void LogWriterMavlink::start_log()
 void LogWriterMavlink::stop_log()
 {
 	_ulog_stream_data.length = 0;
+	_num_unacked = 0;
 	_is_started = false;
 }
 
+void LogWriterMavlink::set_header(bool header)
+{
+	if (header == _header) {
+		return;
+	}
+
+	// the header must start and end on a message boundary, so flush what we have
+	if (_is_started && _ulog_stream_data.length > 0) {
+		publish_message();
+	}
+
+	_header = header;
+	_header_start = header;
+}
+
+void LogWriterMavlink::set_ack_window(int window)
+{
+	_ack_window = math::constrain(window, 1, (int)ulog_stream_ack_s::ACK_WINDOW_MAX);
+}
+
 int LogWriterMavlink::write_message(void *ptr, size_t size)
 {
 	if (!is_started()) {
@@ -122,6 +146,11 @@ void LogWriterMavlink::set_need_reliable_transfer(bool need_reliable)
 			// make sure to send previous data using reliable transfer
 			publish_message();
 		}
+
+		// do not mix reliable and unreliable messages in flight
+		if (_is_started) {
+			wait_for_acks(0);
+		}
 	}
 
 	_need_reliable_transfer = need_reliable;
@@ -136,51 +165,79 @@ int LogWriterMavlink::publish_message()
 		_ulog_stream_data.flags = _ulog_stream_data.FLAGS_NEED_ACK;
 	}
 
+	if (_header) {
+		_ulog_stream_data.flags |= _ulog_stream_data.FLAGS_HEADER;
+
+		if (_header_start) {
+			_ulog_stream_data.flags |= _ulog_stream_data.FLAGS_HEADER_START;
+			_header_start = false;
+		}
+	}
+
 	_ulog_stream_pub.publish(_ulog_stream_data);
 
 	if (_need_reliable_transfer) {
-		// we need to wait for an ack. Note that this blocks the main logger thread, so if a file logging
-		// is already running, it will miss samples.
-		px4_pollfd_struct_t fds[1];
-		fds[0].fd = _ulog_stream_ack_sub;
-		fds[0].events = POLLIN;
-		bool got_ack = false;
-		const int timeout_ms = ulog_stream_ack_s::ACK_TIMEOUT * ulog_stream_ack_s::ACK_MAX_TRIES;
+		++_num_unacked;
 
-		hrt_abstime started = hrt_absolute_time();
+		// we need to wait for an ack once the window is full. Note that this blocks the main logger thread,
+		// so if a file logging is already running, it will miss samples.
+		if (wait_for_acks(_ack_window - 1) != 0) {
+			return -2;
+		}
+	}
 
-		do {
-			int ret = px4_poll(fds, sizeof(fds) / sizeof(fds[0]), timeout_ms);
+	_ulog_stream_data.msg_sequence++;
+	_ulog_stream_data.length = 0;
+	_ulog_stream_data.first_message_offset = 255;
+	return 0;
+}
 
-			if (ret <= 0) {
-				break;
-			}
+int LogWriterMavlink::wait_for_acks(int max_unacked)
+{
+	if (_num_unacked <= max_unacked) {
+		return 0;
+	}
 
-			if (fds[0].revents & POLLIN) {
-				ulog_stream_ack_s ack;
-				orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+	px4_pollfd_struct_t fds[1];
+	fds[0].fd = _ulog_stream_ack_sub;
+	fds[0].events = POLLIN;
+	const int timeout_ms = ulog_stream_ack_s::ACK_TIMEOUT * ulog_stream_ack_s::ACK_MAX_TRIES;
 
-				if (ack.msg_sequence == _ulog_stream_data.msg_sequence) {
-					got_ack = true;
-				}
+	hrt_abstime started = hrt_absolute_time();
+	hrt_abstime last_progress = started;
 
-			} else {
-				break;
+	do {
+		int ret = px4_poll(fds, sizeof(fds) / sizeof(fds[0]), timeout_ms);
+
+		if (ret <= 0) {
+			break;
+		}
+
+		if (fds[0].revents & POLLIN) {
+			ulog_stream_ack_s ack;
+			orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+
+			// acks are cumulative. The unacked sequences are [last - _num_unacked + 1, last]
+			const uint16_t last = _ulog_stream_data.msg_sequence;
+			const uint16_t first_unacked = last - _num_unacked + 1;
+
+			if ((int16_t)(ack.msg_sequence - first_unacked) >= 0 && (int16_t)(last - ack.msg_sequence) >= 0) {
+				_num_unacked = (uint16_t)(last - ack.msg_sequence);
+				last_progress = hrt_absolute_time();
 			}
-		} while (!got_ack && hrt_elapsed_time(&started) / 1000 < timeout_ms);
 
-		if (!got_ack) {
-			PX4_ERR("Ack timeout. Stopping mavlink log");
-			stop_log();
-			return -2;
+		} else {
+			break;
 		}
+	} while (_num_unacked > max_unacked && hrt_elapsed_time(&last_progress) / 1000 < timeout_ms);
 
-		PX4_DEBUG("got ack in %i ms", (int)(hrt_elapsed_time(&started) / 1000));
+	if (_num_unacked > max_unacked) {
+		PX4_ERR("Ack timeout. Stopping mavlink log");
+		stop_log();
+		return -2;
 	}
 
-	_ulog_stream_data.msg_sequence++;
-	_ulog_stream_data.length = 0;
-	_ulog_stream_data.first_message_offset = 255;
+	PX4_DEBUG("got ack in %i ms", (int)(hrt_elapsed_time(&started) / 1000));
 	return 0;
 }
 
@@ -71,16 +71,38 @@ public:
 		return _need_reliable_transfer;
 	}
 
+	/**
+	 * Mark the following messages as part of the log header. Clients that are already streaming skip
+	 * them, so the header can be re-sent for a client that joins a running stream.
+	 */
+	void set_header(bool header);
+
+	/**
+	 * Set the number of unacked reliable messages that can be in flight before waiting for an ack.
+	 * @param window [1, ulog_stream_ack_s::ACK_WINDOW_MAX]
+	 */
+	void set_ack_window(int window);
+
 private:
 
 	/** publish message, wait for ack if needed & reset message */
 	int publish_message();
 
+	/**
+	 * wait until at most max_unacked messages are unacked
+	 * @return 0 on success, -2 on timeout
+	 */
+	int wait_for_acks(int max_unacked);
+
 	ulog_stream_s _ulog_stream_data{};
 	uORB::Publication<ulog_stream_s> _ulog_stream_pub{ORB_ID(ulog_stream)};
 	int _ulog_stream_ack_sub{-1};
 	bool _need_reliable_transfer{false};
 	bool _is_started{false};
+	bool _header{false};
+	bool _header_start{false};
+	int _ack_window{1};
+	int _num_unacked{0}; ///< number of published reliable messages without ack (the last _num_unacked sequences)
 };
 
 }
@@ -43,6 +43,77 @@
 
 using namespace px4::logger;
 
+struct TopicPriorityEntry {
+	const char *name;
+	TopicPriority priority;
+};
+
+// topics not listed here have TopicPriority::Normal
+static constexpr TopicPriorityEntry topic_priorities[] = {
+	// estimator (incl. replay inputs) and controls
+	{"actuator_armed", TopicPriority::Essential},
+	{"actuator_motors", TopicPriority::Essential},
+	{"actuator_servos", TopicPriority::Essential},
+	{"airspeed", TopicPriority::Essential},
+	{"aux_global_position", TopicPriority::Essential},
+	{"distance_sensor", TopicPriority::Essential},
+	{"ekf2_timestamps", TopicPriority::Essential},
+	{"estimator_event_flags", TopicPriority::Essential},
+	{"estimator_selector_status", TopicPriority::Essential},
+	{"estimator_status", TopicPriority::Essential},
+	{"estimator_status_flags", TopicPriority::Essential},
+	{"failsafe_flags", TopicPriority::Essential},
+	{"sensor_accel_fifo", TopicPriority::Essential},
+	{"sensor_combined", TopicPriority::Essential},
+	{"sensor_gyro_fifo", TopicPriority::Essential},
+	{"sensor_selection", TopicPriority::Essential},
+	{"vehicle_acceleration", TopicPriority::Essential},
+	{"vehicle_air_data", TopicPriority::Essential},
+	{"vehicle_angular_velocity", TopicPriority::Essential},
+	{"vehicle_attitude", TopicPriority::Essential},
+	{"vehicle_attitude_setpoint", TopicPriority::Essential},
+	{"vehicle_command", TopicPriority::Essential},
+	{"vehicle_command_ack", TopicPriority::Essential},
+	{"vehicle_control_mode", TopicPriority::Essential},
+	{"vehicle_global_position", TopicPriority::Essential},
+	{"vehicle_gps_position", TopicPriority::Essential},
+	{"vehicle_land_detected", TopicPriority::Essential},
+	{"vehicle_local_position", TopicPriority::Essential},
+	{"vehicle_magnetometer", TopicPriority::Essential},
+	{"vehicle_optical_flow", TopicPriority::Essential},
+	{"vehicle_rates_setpoint", TopicPriority::Essential},
+	{"vehicle_status", TopicPriority::Essential},
+	{"vehicle_thrust_setpoint", TopicPriority::Essential},
+	{"vehicle_torque_setpoint", TopicPriority::Essential},
+	{"vehicle_visual_odometry", TopicPriority::Essential},
+
+	// debugging and diagnostics
+	{"actuator_test", TopicPriority::Low},
+	{"cellular_status", TopicPriority::Low},
+	{"cpuload", TopicPriority::Low},
+	{"debug_array", TopicPriority::Low},
+	{"debug_key_value", TopicPriority::Low},
+	{"debug_value", TopicPriority::Low},
+	{"debug_vect", TopicPriority::Low},
+	{"heap_info", TopicPriority::Low},
+	{"heater_status", TopicPriority::Low},
+	{"mag_worker_data", TopicPriority::Low},
+	{"mavlink_link_stats", TopicPriority::Low},
+	{"onboard_computer_status", TopicPriority::Low},
+	{"radio_status", TopicPriority::Low},
+	{"satellite_info", TopicPriority::Low},
+	{"sensor_accel", TopicPriority::Low},
+	{"sensor_baro", TopicPriority::Low},
+	{"sensor_gyro", TopicPriority::Low},
+	{"sensor_mag", TopicPriority::Low},
+	{"sensor_preflight_mag", TopicPriority::Low},
+	{"telemetry_status", TopicPriority::Low},
+	{"timesync_status", TopicPriority::Low},
+	{"uorb_topic_stats", TopicPriority::Low},
+	{"vehicle_imu_status", TopicPriority::Low},
+	{"work_item_stats", TopicPriority::Low},
+};
+
 void LoggedTopics::add_default_topics()
 {
 	add_topic("action_request");
@@ -57,11 +128,13 @@ void LoggedTopics::add_default_topics()
 	add_topic("cellular_status", 200);
 	add_topic("commander_state");
 	add_topic("config_overrides");
+	add_optional_topic_multi("control_latency", 0, 2);
 	add_topic("cpuload");
 	add_topic("distance_sensor_mode_change_request");
 	add_optional_topic("external_ins_attitude");
 	add_optional_topic("external_ins_global_position");
 	add_optional_topic("external_ins_local_position");
+	add_optional_topic("esc_rpm", 50);
 	add_optional_topic("esc_status", 250);
 	add_topic("failure_detector_status", 100);
 	add_topic("failsafe_flags");
@@ -76,6 +149,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("gps_dump");
 	add_optional_topic("gimbal_controls", 200);
 	add_optional_topic("gripper");
+	add_optional_topic("heap_info", 1000);
 	add_optional_topic("heater_status");
 	add_topic("home_position");
 	add_topic("hover_thrust_estimate", 100);
@@ -127,6 +201,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("tiltrotor_extra_controls", 100);
 	add_topic("trajectory_setpoint", 200);
 	add_topic("transponder_report");
+	add_optional_topic("uorb_topic_stats");
 	add_topic("vehicle_acceleration", 50);
 	add_topic("vehicle_air_data", 200);
 	add_topic("vehicle_angular_velocity", 20);
@@ -147,6 +222,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("vehicle_status");
 	add_optional_topic("vtol_vehicle_status", 200);
 	add_topic("wind", 1000);
+	add_optional_topic("work_item_stats");
 
 	// multi topics
 	add_optional_topic_multi("actuator_outputs", 100, 3);
@@ -157,6 +233,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic_multi("rpm", 200);
 	add_topic_multi("timesync_status", 1000, 3);
 	add_optional_topic_multi("telemetry_status", 1000, 4);
+	add_optional_topic_multi("mavlink_link_stats", 1000, 4);
 
 	// EKF multi topics
 	{
@@ -173,6 +250,7 @@ void LoggedTopics::add_default_topics()
 
 	// important EKF topics (higher rate)
 	add_optional_topic("estimator_selector_status", 10);
+	add_optional_topic_multi("estimator_cpu_profile", 1000);
 	add_optional_topic_multi("estimator_event_flags", 10);
 	add_optional_topic_multi("estimator_optical_flow_vel", 200);
 	add_optional_topic_multi("estimator_sensor_bias", 1000);
@@ -184,6 +262,7 @@ void LoggedTopics::add_default_topics()
 	add_topic_multi("battery_status", 200, 2);
 	add_topic_multi("differential_pressure", 1000, 2);
 	add_topic_multi("distance_sensor", 1000, 2);
+	add_optional_topic_multi("vehicle_distance_sensor", 1000, 2);
 	add_optional_topic_multi("sensor_accel", 1000, 4);
 	add_optional_topic_multi("sensor_baro", 1000, 4);
 	add_topic_multi("sensor_gps", 1000, 2);
@@ -258,18 +337,18 @@ void LoggedTopics::add_high_rate_topics()
 	// maximum rate to analyze fast maneuvers (e.g. for racing)
 	add_topic("manual_control_setpoint");
 	add_topic_multi("rate_ctrl_status", 20, 2);
-	add_topic("sensor_combined");
-	add_topic("vehicle_angular_velocity");
-	add_topic("vehicle_attitude");
+	add_high_rate_topic("sensor_combined");
+	add_high_rate_topic("vehicle_angular_velocity");
+	add_high_rate_topic("vehicle_attitude");
 	add_topic("vehicle_attitude_setpoint");
-	add_topic("vehicle_rates_setpoint");
+	add_high_rate_topic("vehicle_rates_setpoint");
 
 	add_topic("esc_status", 5);
-	add_topic("actuator_motors");
+	add_high_rate_topic("actuator_motors");
 	add_topic("actuator_outputs_debug");
-	add_topic("actuator_servos");
-	add_topic_multi("vehicle_thrust_setpoint", 0, 2);
-	add_topic_multi("vehicle_torque_setpoint", 0, 2);
+	add_high_rate_topic("actuator_servos");
+	add_high_rate_topic_multi("vehicle_thrust_setpoint", 0, 2);
+	add_high_rate_topic_multi("vehicle_torque_setpoint", 0, 2);
 }
 
 void LoggedTopics::add_debug_topics()
@@ -332,12 +411,12 @@ void LoggedTopics::add_vision_and_avoidance_topics()
 
 void LoggedTopics::add_raw_imu_gyro_fifo()
 {
-	add_topic("sensor_gyro_fifo");
+	add_high_rate_topic("sensor_gyro_fifo");
 }
 
 void LoggedTopics::add_raw_imu_accel_fifo()
 {
-	add_topic("sensor_accel_fifo");
+	add_high_rate_topic("sensor_accel_fifo");
 }
 
 void LoggedTopics::add_system_identification_topics()
@@ -494,6 +573,23 @@ bool LoggedTopics::add_topic(const char *name, uint16_t interval_ms, uint8_t ins
 	return success;
 }
 
+bool LoggedTopics::add_high_rate_topic(const char *name, uint16_t interval_ms, uint8_t instance)
+{
+	if (!add_topic(name, interval_ms, instance)) {
+		return false;
+	}
+
+	for (int j = 0; j < _subscriptions.count; ++j) {
+		RequestedSubscription &sub = _subscriptions.sub[j];
+
+		if ((sub.instance == instance) && (strcmp(get_orb_meta(sub.id)->o_name, name) == 0)) {
+			sub.high_rate = true;
+		}
+	}
+
+	return true;
+}
+
 bool LoggedTopics::add_topic_multi(const char *name, uint16_t interval_ms, uint8_t max_num_instances, bool optional)
 {
 	// add all possible instances
@@ -515,9 +611,26 @@ bool LoggedTopics::initialize_logged_topics(SDLogProfileMask profile)
 		initialize_configured_topics(profile);
 	}
 
+	set_topic_priorities();
+
 	return _subscriptions.count > 0;
 }
 
+void LoggedTopics::set_topic_priorities()
+{
+	for (int i = 0; i < _subscriptions.count; ++i) {
+		RequestedSubscription &sub = _subscriptions.sub[i];
+		const char *name = get_orb_meta(sub.id)->o_name;
+
+		for (const TopicPriorityEntry &entry : topic_priorities) {
+			if (strcmp(name, entry.name) == 0) {
+				sub.priority = entry.priority;
+				break;
+			}
+		}
+	}
+}
+
 void LoggedTopics::initialize_configured_topics(SDLogProfileMask profile)
 {
 	// load appropriate topics for profile
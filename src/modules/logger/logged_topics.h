@@ -63,6 +63,15 @@ enum class MissionLogType : int32_t {
 	Geotagging =             2
 };
 
+/**
+ * When the write buffer fills up, the logging rate of lower priority topics is reduced first
+ */
+enum class TopicPriority : uint8_t {
+	Essential =              0, ///< estimator and controls, never reduced
+	Normal =                 1,
+	Low =                    2  ///< debugging and diagnostics
+};
+
 inline bool operator&(SDLogProfileMask a, SDLogProfileMask b)
 {
 	return static_cast<int32_t>(a) & static_cast<int32_t>(b);
@@ -82,6 +91,8 @@ public:
 	struct RequestedSubscription {
 		uint16_t interval_ms;
 		uint8_t instance;
+		bool high_rate{false}; ///< delta compress (SDLOG_COMPRESS) and stage (SDLOG_STAGING) if enabled
+		TopicPriority priority{TopicPriority::Normal};
 		ORB_ID id{ORB_ID::INVALID};
 	};
 	struct RequestedSubscriptionArray {
@@ -143,6 +154,29 @@ private:
 		return add_topic_multi(name, interval_ms, max_num_instances, true);
 	}
 
+	/**
+	 * Add a high-rate numerical topic, which is logged delta compressed if SDLOG_COMPRESS is enabled,
+	 * and captured at publication time if SDLOG_STAGING is enabled.
+	 * Also marks the topic as high-rate if it has already been added.
+	 * @see add_topic()
+	 */
+	bool add_high_rate_topic(const char *name, uint16_t interval_ms = 0, uint8_t instance = 0);
+
+	bool add_high_rate_topic_multi(const char *name, uint16_t interval_ms = 0,
+				       uint8_t max_num_instances = ORB_MULTI_MAX_INSTANCES)
+	{
+		for (uint8_t instance = 0; instance < max_num_instances; instance++) {
+			add_high_rate_topic(name, interval_ms, instance);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Set the priority of the added topics according to the priority table
+	 */
+	void set_topic_priorities();
+
 	/**
 	 * Parse a file containing a list of uORB topics to log, calling add_topic for each
 	 * @param fname name of file
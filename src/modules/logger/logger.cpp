@@ -33,6 +33,7 @@
 
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/console_buffer.h>
+#include "delta_compression.h"
 #include "logged_topics.h"
 #include "logger.h"
 #include "messages.h"
@@ -194,6 +195,14 @@ int Logger::print_status()
 	PX4_INFO("Number of subscriptions: %i (%i bytes)", _num_subscriptions,
 		 (int)(_num_subscriptions * sizeof(LoggerSubscription)));
 
+	if (_num_staged_topics > 0) {
+		PX4_INFO("Staged topics: %i (%u samples each)", _num_staged_topics, _staged_topics[0]->depth());
+	}
+
+	if (_pre_trigger_buffer.allocated()) {
+		PX4_INFO("Pre-trigger buffer: %zu/%zu bytes used", _pre_trigger_buffer.count(), _pre_trigger_buffer.size());
+	}
+
 	bool is_logging = false;
 
 	if (_writer.is_started(LogType::Full, LogWriter::BackendFile)) {
@@ -208,6 +217,18 @@ int Logger::print_status()
 		is_logging = true;
 	}
 
+#if defined(PX4_CRYPTO)
+	const LogWriterFile::EncryptionStatistics encryption = _writer.get_encryption_statistics_file();
+
+	if (encryption.bytes > 0 && encryption.time_us > 0) {
+		const float kibibytes = encryption.bytes / 1024.0f;
+		const float seconds = encryption.time_us * 1e-6f;
+		PX4_INFO("Since last status: encrypted %.1f KiB in %.3f s (%.1f KiB/s)", (double)kibibytes, (double)seconds,
+			 (double)(kibibytes / seconds));
+	}
+
+#endif
+
 	if (_writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
 		PX4_INFO("Mavlink Logging Running (Full log)");
 		is_logging = true;
@@ -247,6 +268,12 @@ void Logger::print_statistics(LogType type)
 	stats.high_water = 0;
 	stats.write_dropouts = 0;
 	stats.max_dropout_duration = 0.f;
+
+	const LogWriterFile::WriteStallStatistics stalls = _writer.get_write_stall_statistics_file(type);
+
+	PX4_INFO("Since last status: write stalls: %u (total: %.3f s), max write time: %.1f ms%s",
+		 (unsigned)stalls.stalls, (double)(stalls.stall_time_us * 1e-6f), (double)(stalls.max_write_time_us * 1e-3f),
+		 stalls.direct_io ? " (direct I/O)" : "");
 }
 
 Logger *Logger::instantiate(int argc, char *argv[])
@@ -406,16 +433,33 @@ Logger::Logger(LogWriter::Backend backend, size_t buffer_size, uint32_t log_inte
 			PX4_ERR("Failed to find topic %s", poll_topic_name);
 		}
 	}
+
+	pthread_mutex_init(&_log_dir_mutex, nullptr);
 }
 
 Logger::~Logger()
 {
+	pthread_mutex_destroy(&_log_dir_mutex);
+
 	if (_replay_file_name) {
 		free(_replay_file_name);
 	}
 
 	delete[](_msg_buffer);
 	delete[](_subscriptions);
+
+	for (int i = 0; i < _num_compressed_topics; ++i) {
+		delete[](_compressed_topics[i].previous);
+	}
+
+	delete[](_compressed_topics);
+	delete[](_compression_buffer);
+
+	for (int i = 0; i < _num_staged_topics; ++i) {
+		delete _staged_topics[i];
+	}
+
+	delete[](_staged_topics);
 }
 
 void Logger::update_params()
@@ -470,8 +514,10 @@ bool Logger::copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe)
 				write_add_logged_msg(LogType::Mission, sub);
 			}
 
-			// copy first data
-			updated = sub.copy(buffer);
+			// copy first data (staged topics get it from the staging callback)
+			if (sub.staged_index < 0) {
+				updated = sub.copy(buffer);
+			}
 		}
 	}
 
@@ -561,8 +607,72 @@ bool Logger::initialize_topics()
 		for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
 			const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
 			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance);
+			_subscriptions[i].priority = sub.priority;
 			_subscriptions[i].subscribe();
 		}
+
+		// compression is not supported by the mavlink streaming readers
+		if (_param_sdlog_compress.get() && (_writer.backend() == LogWriter::BackendFile)) {
+			int num_compressed = 0;
+
+			for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
+				if (logged_topics.subscriptions().sub[i].high_rate) {
+					num_compressed++;
+				}
+			}
+
+			if (num_compressed > 0) {
+				_compressed_topics = new CompressedTopic[num_compressed];
+			}
+
+			for (int i = 0; _compressed_topics && (i < logged_topics.subscriptions().count); ++i) {
+				if (logged_topics.subscriptions().sub[i].high_rate) {
+					CompressedTopic &topic = _compressed_topics[_num_compressed_topics];
+					topic.previous = new uint8_t[_subscriptions[i].get_topic()->o_size_no_padding];
+
+					if (topic.previous) {
+						_subscriptions[i].compression_index = _num_compressed_topics++;
+					}
+				}
+			}
+
+			PX4_INFO("compressing %i topics", _num_compressed_topics);
+		}
+
+		if (_param_sdlog_staging.get() > 0) {
+			int num_staged = 0;
+
+			for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
+				if (logged_topics.subscriptions().sub[i].high_rate) {
+					num_staged++;
+				}
+			}
+
+			if (num_staged > 0) {
+				_staged_topics = new StagedTopic *[num_staged];
+			}
+
+			for (int i = 0; _staged_topics && (i < logged_topics.subscriptions().count); ++i) {
+				const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
+
+				if (sub.high_rate) {
+					StagedTopic *staged = new StagedTopic(_subscriptions[i].get_topic(), _subscriptions[i].get_interval_us(),
+									      sub.instance);
+
+					if (staged && !staged->init(_param_sdlog_staging.get())) {
+						delete staged;
+						staged = nullptr;
+					}
+
+					if (staged) {
+						_subscriptions[i].staged_index = _num_staged_topics;
+						_staged_topics[_num_staged_topics++] = staged;
+					}
+				}
+			}
+
+			PX4_INFO("staging %i topics", _num_staged_topics);
+		}
 	}
 
 	_num_subscriptions = logged_topics.subscriptions().count;
@@ -587,8 +697,15 @@ void Logger::run()
 			}
 		}
 
-		if (util::check_free_space(LOG_ROOT[(int)LogType::Full], _param_sdlog_dirs_max.get(), _mavlink_log_pub,
-					   _file_name[(int)LogType::Full].sess_dir_index) == 1) {
+		// With a stored session index and enough space to start logging, old logs are removed in the background.
+		// Otherwise scan the log directory now (e.g. on the first boot with a new SD card).
+		const int sess_dir_index = util::read_sess_dir_index(LOG_ROOT[(int)LogType::Full]);
+
+		if (sess_dir_index >= 0 && util::has_min_free_space(LOG_ROOT[(int)LogType::Full]) && start_cleanup_thread()) {
+			_file_name[(int)LogType::Full].sess_dir_index = sess_dir_index;
+
+		} else if (util::check_free_space(LOG_ROOT[(int)LogType::Full], _param_sdlog_dirs_max.get(), _mavlink_log_pub,
+						  _file_name[(int)LogType::Full].sess_dir_index) == 1) {
 			return;
 		}
 	}
@@ -637,12 +754,36 @@ void Logger::run()
 		}
 	}
 
+	if (_num_compressed_topics > 0) {
+		_compression_buffer = new uint8_t[_msg_buffer_len];
+
+		if (!_compression_buffer) {
+			PX4_ERR("failed to alloc compression buffer");
+			_num_compressed_topics = 0;
+
+			for (int sub = 0; sub < _num_subscriptions; ++sub) {
+				_subscriptions[sub].compression_index = -1;
+			}
+		}
+	}
+
 
 	if (!_writer.init()) {
 		PX4_ERR("writer init failed");
 		return;
 	}
 
+	if ((_param_sdlog_pretrig.get() > 0) && (_writer.backend() & LogWriter::BackendFile)
+	    && (_log_mode != LogMode::boot_until_shutdown)) {
+		if (_pre_trigger_buffer.allocate(_param_sdlog_pretrig.get() * 1024)) {
+			// data messages are captured before the topics are added to a log
+			assign_msg_id(_event_subscription);
+
+		} else {
+			PX4_ERR("failed to alloc pre-trigger buffer");
+		}
+	}
+
 	/* debug stats */
 	hrt_abstime	timer_start = 0;
 	uint32_t	total_bytes = 0;
@@ -717,7 +858,8 @@ void Logger::run()
 
 		const hrt_abstime loop_time = hrt_absolute_time();
 
-		if (_writer.is_started(LogType::Full)) { // mission log only runs when full log is also started
+		// mission log only runs when full log is also started. With a pre-trigger buffer, data is captured while not logging
+		if (_writer.is_started(LogType::Full) || pre_trigger_active()) {
 
 			if (!was_started) {
 				adjust_subscription_updates();
@@ -749,50 +891,34 @@ void Logger::run()
 			/* wait for lock on log buffer */
 			_writer.lock();
 
+			flush_pre_trigger_buffer();
+
 			for (int sub_idx = 0; sub_idx < _num_subscriptions; ++sub_idx) {
 				LoggerSubscription &sub = _subscriptions[sub_idx];
 				/* if this topic has been updated, copy the new data into the message buffer
 				 * and write a message to the log
 				 */
 				const bool try_to_subscribe = (sub_idx == next_subscribe_topic_index);
+				StagedTopic *staged = (sub.staged_index >= 0) ? _staged_topics[sub.staged_index] : nullptr;
 
-				if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
-					// each message consists of a header followed by an orb data object
-					const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
-					const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
-					const uint16_t write_msg_id = sub.msg_id;
-
-					//write one byte after another (necessary because of alignment)
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
-					_msg_buffer[3] = (uint8_t)write_msg_id;
-					_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
-
-					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+				if (staged && !staged->registered() && sub.valid()) {
+					// from now on the topic is captured at publication time, starting with the latest sample
+					staged->registerCallback();
+				}
 
-					// full log
-					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+				if (staged && staged->registered()) {
+					const uint8_t *data;
 
-#ifdef DBGPRINT
-						total_bytes += msg_size;
-#endif /* DBGPRINT */
+					while ((data = staged->front()) != nullptr) {
+						memcpy(_msg_buffer + sizeof(ulog_message_data_s), data, sub.get_topic()->o_size);
+						staged->pop();
+						write_subscription_data(sub_idx, loop_time, total_bytes);
 					}
 
-					// mission log
-					if (sub_idx < _num_mission_subs) {
-						if (_writer.is_started(LogType::Mission)) {
-							if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
-								unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
-
-								if (delta_time > 0) {
-									_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
-								}
+					_message_gaps += staged->take_dropped();
 
-								write_message(LogType::Mission, _msg_buffer, msg_size);
-							}
-						}
-					}
+				} else if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
+					write_subscription_data(sub_idx, loop_time, total_bytes);
 				}
 			}
 
@@ -807,16 +933,7 @@ void Logger::run()
 				int message_len = strlen(message);
 
 				if (message_len > 0) {
-					uint16_t write_msg_size = sizeof(ulog_message_logging_s) - sizeof(ulog_message_logging_s::message)
-								  - ULOG_MSG_HEADER_LEN + message_len;
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::LOGGING);
-					_msg_buffer[3] = log_message.severity + '0';
-					memcpy(_msg_buffer + 4, &log_message.timestamp, sizeof(ulog_message_logging_s::timestamp));
-					strncpy((char *)(_msg_buffer + 12), message, sizeof(ulog_message_logging_s::message));
-
-					write_message(LogType::Full, _msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
+					write_logging_message(log_message.severity, log_message.timestamp, message);
 				}
 			}
 
@@ -837,7 +954,7 @@ void Logger::run()
 				_msg_buffer[9] = 0xBB;
 				_msg_buffer[10] = 0x12;
 
-				write_message(LogType::Full, _msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
+				write_full_log_stream(_msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
 				_last_sync_time = loop_time;
 			}
 
@@ -848,6 +965,8 @@ void Logger::run()
 				}
 			}
 
+			control_log_rate(loop_time);
+
 			publish_logger_status();
 
 			/* release the log buffer */
@@ -891,6 +1010,10 @@ void Logger::run()
 			}
 
 			was_started = false;
+
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+			update_header_cache();
+#endif
 		}
 
 		handle_file_write_error();
@@ -939,6 +1062,16 @@ void Logger::run()
 	// stop the writer thread
 	_writer.thread_stop();
 
+	if (_cleanup_thread_running) {
+		pthread_join(_cleanup_thread, nullptr);
+		_cleanup_thread_running = false;
+	}
+
+	if (_cleanup_mavlink_log_pub) {
+		orb_unadvertise(_cleanup_mavlink_log_pub);
+		_cleanup_mavlink_log_pub = nullptr;
+	}
+
 	if (polling_topic_sub >= 0) {
 		orb_unsubscribe(polling_topic_sub);
 	}
@@ -1002,7 +1135,7 @@ bool Logger::handle_event_updates(uint32_t &total_bytes)
 			_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
 
 			// full log
-			if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+			if (write_full_log_stream(_msg_buffer, msg_size)) {
 
 #ifdef DBGPRINT
 				total_bytes += msg_size;
@@ -1131,6 +1264,23 @@ bool Logger::start_stop_logging()
 			desired_state = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED) ||
 					(_prev_file_log_start_state && _log_mode == LogMode::arm_until_shutdown);
 			updated = true;
+
+			if (vehicle_status.failsafe && !_prev_failsafe && _pre_trigger_buffer.allocated()) {
+				pre_trigger("failsafe");
+			}
+
+			_prev_failsafe = vehicle_status.failsafe;
+		}
+	}
+
+	if (_pre_trigger_time != 0) {
+		if (hrt_elapsed_time(&_pre_trigger_time) < PRE_TRIGGER_POST_DURATION) {
+			desired_state = true;
+			updated = true;
+
+		} else {
+			// stop with the next state update (unless e.g. armed meanwhile)
+			_pre_trigger_time = 0;
 		}
 	}
 
@@ -1183,6 +1333,11 @@ void Logger::handle_vehicle_command_update()
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
 				start_log_mavlink();
 
+			} else if (_writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
+				// another client joins the running stream: it needs its own copy of the header
+				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
+				write_header_mavlink();
+
 			} else {
 				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_TEMPORARILY_REJECTED);
 			}
@@ -1194,12 +1349,213 @@ void Logger::handle_vehicle_command_update()
 			}
 
 			ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
+
+		} else if (command.command == vehicle_command_s::VEHICLE_CMD_LOGGING_PRE_TRIGGER) {
+			if (_pre_trigger_buffer.allocated()) {
+				pre_trigger("command");
+				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED);
+
+			} else {
+				ack_vehicle_command(&command, vehicle_command_ack_s::VEHICLE_CMD_RESULT_UNSUPPORTED);
+			}
+		}
+	}
+}
+
+void Logger::control_log_rate(hrt_abstime now)
+{
+	const size_t buffer_size = _writer.get_buffer_size_file(LogType::Full);
+
+	if (buffer_size == 0) {
+		return;
+	}
+
+	const float fill = (float)_writer.get_buffer_fill_count_file(LogType::Full) / buffer_size;
+	int level = _log_rate_level;
+
+	if (fill > LOG_RATE_REDUCE_FILL) {
+		if (now > _log_rate_level_change + LOG_RATE_REDUCE_HOLD) {
+			level = math::min(level + 1, LOG_RATE_LEVEL_MAX);
+		}
+
+		_log_rate_drained_since = 0;
+
+	} else if (fill < LOG_RATE_RESTORE_FILL) {
+		if (_log_rate_drained_since == 0) {
+			_log_rate_drained_since = now;
+
+		} else if (now > _log_rate_drained_since + LOG_RATE_RESTORE_HOLD) {
+			// restore one level at a time, each after the buffer stayed drained for the hold time
+			level = math::max(level - 1, 0);
+			_log_rate_drained_since = now;
+		}
+
+	} else {
+		_log_rate_drained_since = 0;
+	}
+
+	if (level != _log_rate_level) {
+		set_log_rate_level(level);
+		_log_rate_level_change = now;
+
+		char message[80];
+		snprintf(message, sizeof(message), "Logging rate level %i (buffer fill %i%%)", level, (int)(fill * 100.f));
+		write_logging_message(6, now, message); // info
+	}
+}
+
+void Logger::set_log_rate_level(int level)
+{
+	// minimum interval, indexed by the number of levels a topic is reduced by
+	static constexpr uint16_t min_interval_ms[LOG_RATE_LEVEL_MAX + 1] {0, 50, 200, 1000};
+
+	_log_rate_level = level;
+
+	// mission topics are shared with the mission log, which has its own rate
+	for (int i = _num_mission_subs; i < _num_subscriptions; ++i) {
+		LoggerSubscription &sub = _subscriptions[i];
+
+		// the interval of staged topics is applied by the staging callback, they are high-rate topics
+		// which are expected to be essential anyway
+		if ((sub.priority == TopicPriority::Essential) || (sub.staged_index >= 0)) {
+			continue;
+		}
+
+		// low priority topics are reduced first
+		const int reduction = (sub.priority == TopicPriority::Low) ? level : level - 1;
+		uint32_t interval_ms = sub.base_interval_ms;
+
+		if ((reduction > 0) && (interval_ms < min_interval_ms[reduction])) {
+			interval_ms = min_interval_ms[reduction];
+		}
+
+		sub.set_interval_ms(interval_ms);
+	}
+}
+
+void Logger::write_logging_message(uint8_t log_level, uint64_t timestamp, const char *message)
+{
+	const int message_len = math::min(strlen(message), sizeof(ulog_message_logging_s::message));
+	uint16_t write_msg_size = sizeof(ulog_message_logging_s) - sizeof(ulog_message_logging_s::message)
+				  - ULOG_MSG_HEADER_LEN + message_len;
+	_msg_buffer[0] = (uint8_t)write_msg_size;
+	_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
+	_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::LOGGING);
+	_msg_buffer[3] = log_level + '0';
+	memcpy(_msg_buffer + 4, &timestamp, sizeof(ulog_message_logging_s::timestamp));
+	strncpy((char *)(_msg_buffer + 12), message, sizeof(ulog_message_logging_s::message));
+
+	write_full_log_stream(_msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
+}
+
+bool Logger::write_data_message(LoggerSubscription &sub, size_t msg_size)
+{
+	if (sub.compression_index < 0) {
+		return write_full_log_stream(_msg_buffer, msg_size);
+	}
+
+	CompressedTopic &topic = _compressed_topics[sub.compression_index];
+
+	if (pre_trigger_active()) {
+		// the pre-trigger buffer drops the oldest messages, which would break the chain
+		topic.valid = false;
+		return write_full_log_stream(_msg_buffer, msg_size);
+	}
+	const uint8_t *data = _msg_buffer + sizeof(ulog_message_data_s);
+	const size_t data_size = msg_size - sizeof(ulog_message_data_s);
+	size_t encoded_size = 0;
+
+	if (topic.valid && (topic.since_plain < COMPRESSION_PLAIN_INTERVAL)) {
+		encoded_size = delta_compression::encode(data, topic.previous, data_size,
+				_compression_buffer + sizeof(ulog_message_data_compressed_s),
+				_msg_buffer_len - sizeof(ulog_message_data_compressed_s));
+	}
+
+	memcpy(topic.previous, data, data_size);
+
+	bool written;
+
+	if (encoded_size > 0) {
+		const size_t compressed_size = sizeof(ulog_message_data_compressed_s) + encoded_size;
+		const uint16_t write_msg_size = static_cast<uint16_t>(compressed_size - ULOG_MSG_HEADER_LEN);
+
+		_compression_buffer[0] = (uint8_t)write_msg_size;
+		_compression_buffer[1] = (uint8_t)(write_msg_size >> 8);
+		_compression_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA_COMPRESSED);
+		_compression_buffer[3] = _msg_buffer[3]; // msg_id
+		_compression_buffer[4] = _msg_buffer[4];
+
+		written = write_message(LogType::Full, _compression_buffer, compressed_size);
+		topic.since_plain++;
+
+	} else {
+		written = write_message(LogType::Full, _msg_buffer, msg_size);
+		topic.since_plain = 0;
+	}
+
+	// a dropped message breaks the chain, the next one is written plain
+	topic.valid = written;
+
+	return written;
+}
+
+void Logger::write_subscription_data(int sub_idx, hrt_abstime loop_time, uint32_t &total_bytes)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+
+	// each message consists of a header followed by an orb data object
+	const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
+	const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
+	if (sub.msg_id == MSG_ID_INVALID) {
+		// captured into the pre-trigger buffer before the topic is added to a log
+		assign_msg_id(sub);
+	}
+
+	const uint16_t write_msg_id = sub.msg_id;
+
+	//write one byte after another (necessary because of alignment)
+	_msg_buffer[0] = (uint8_t)write_msg_size;
+	_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
+	_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
+	_msg_buffer[3] = (uint8_t)write_msg_id;
+	_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
+
+	// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+
+	// full log
+	if (write_data_message(sub, msg_size)) {
+
+#ifdef DBGPRINT
+		total_bytes += msg_size;
+#endif /* DBGPRINT */
+	}
+
+	// mission log
+	if (sub_idx < _num_mission_subs) {
+		if (_writer.is_started(LogType::Mission)) {
+			if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
+				unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
+
+				if (delta_time > 0) {
+					_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
+				}
+
+				write_message(LogType::Mission, _msg_buffer, msg_size);
+			}
 		}
 	}
 }
 
 bool Logger::write_message(LogType type, void *ptr, size_t size)
 {
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+
+	if (_header_capture) {
+		return _header_capture->append(ptr, size);
+	}
+
+#endif
+
 	Statistics &stats = _statistics[(int)type];
 
 	if (_writer.write_message(type, ptr, size, stats.dropout_start) != -1) {
@@ -1226,7 +1582,109 @@ bool Logger::write_message(LogType type, void *ptr, size_t size)
 	return false;
 }
 
+bool Logger::write_full_log_stream(void *ptr, size_t size)
+{
+	if (pre_trigger_active()) {
+		return _pre_trigger_buffer.push(ptr, size);
+	}
+
+	return write_message(LogType::Full, ptr, size);
+}
+
+bool Logger::pre_trigger_active() const
+{
+	if (!_pre_trigger_buffer.allocated() || _writer.is_started(LogType::Full, LogWriter::BackendMavlink)) {
+		return false;
+	}
+
+	return !_writer.is_started(LogType::Full, LogWriter::BackendFile) || (_pre_trigger_buffer.count() > 0);
+}
+
+void Logger::pre_trigger(const char *reason)
+{
+	if (!_writer.is_started(LogType::Full, LogWriter::BackendFile)) {
+		PX4_INFO("pre-trigger: %s", reason);
+	}
+
+	_pre_trigger_time = hrt_absolute_time();
+}
+
+void Logger::flush_pre_trigger_buffer()
+{
+	if ((_pre_trigger_buffer.count() == 0) || !_writer.is_started(LogType::Full, LogWriter::BackendFile)) {
+		return;
+	}
+
+	// keep the write buffer below the fill level at which the log rate would be reduced, live data
+	// is appended to the pre-trigger buffer meanwhile
+	const size_t max_fill = (size_t)(_writer.get_buffer_size_file(LogType::Full) * LOG_RATE_REDUCE_FILL);
+	size_t msg_size;
+
+	while ((msg_size = _pre_trigger_buffer.front_size()) > 0) {
+		if (_writer.get_buffer_fill_count_file(LogType::Full) + msg_size > max_fill) {
+			break;
+		}
+
+		if (_pre_trigger_buffer.pop(_msg_buffer, _msg_buffer_len) == 0) {
+			// not possible, all messages were written from _msg_buffer
+			_pre_trigger_buffer.reset();
+			break;
+		}
+
+		write_message(LogType::Full, _msg_buffer, msg_size);
+	}
+
+	// messages dropped after the trigger are lost
+	_message_gaps += _pre_trigger_buffer.take_dropped();
+}
+
+bool Logger::start_cleanup_thread()
+{
+	pthread_attr_t thr_attr;
+	pthread_attr_init(&thr_attr);
+
+	sched_param param;
+	/* lowest priority, the logger does not depend on it */
+	param.sched_priority = SCHED_PRIORITY_DEFAULT - 50;
+	(void)pthread_attr_setschedparam(&thr_attr, &param);
+
+	pthread_attr_setstacksize(&thr_attr, PX4_STACK_ADJUSTED(1280));
+
+	int ret = pthread_create(&_cleanup_thread, &thr_attr, &Logger::cleanup_thread_helper, this);
+	pthread_attr_destroy(&thr_attr);
+
+	if (ret != 0) {
+		PX4_WARN("cleanup thread start failed (%i)", ret);
+		return false;
+	}
+
+	_cleanup_thread_running = true;
+	return true;
+}
+
+void *Logger::cleanup_thread_helper(void *context)
+{
+	px4_prctl(PR_SET_NAME, "log_cleanup", px4_getpid());
+
+	Logger *logger = static_cast<Logger *>(context);
+	int sess_dir_index = 0; // the logger uses the stored index
+
+	util::check_free_space(LOG_ROOT[(int)LogType::Full], logger->_param_sdlog_dirs_max.get(),
+			       logger->_cleanup_mavlink_log_pub, sess_dir_index, &logger->_log_dir_mutex,
+			       logger->_file_name[(int)LogType::Full].log_dir);
+
+	return nullptr;
+}
+
 int Logger::create_log_dir(LogType type, tm *tt, char *log_dir, int log_dir_len)
+{
+	pthread_mutex_lock(&_log_dir_mutex);
+	int ret = create_log_dir_locked(type, tt, log_dir, log_dir_len);
+	pthread_mutex_unlock(&_log_dir_mutex);
+	return ret;
+}
+
+int Logger::create_log_dir_locked(LogType type, tm *tt, char *log_dir, int log_dir_len)
 {
 	LogFileName &file_name = _file_name[(int)type];
 
@@ -1253,6 +1711,13 @@ int Logger::create_log_dir(LogType type, tm *tt, char *log_dir, int log_dir_len)
 
 		if (file_name.has_log_dir) {
 			strncpy(log_dir + n, file_name.log_dir, log_dir_len - n);
+
+		} else {
+			const int stored_dir_number = util::read_sess_dir_index(LOG_ROOT[(int)type]);
+
+			if (stored_dir_number > dir_number) {
+				dir_number = stored_dir_number;
+			}
 		}
 
 		/* look for the next dir that does not exist */
@@ -1271,6 +1736,8 @@ int Logger::create_log_dir(LogType type, tm *tt, char *log_dir, int log_dir_len)
 			if (mkdir_ret == 0) {
 				PX4_DEBUG("log dir created: %s", log_dir);
 				file_name.has_log_dir = true;
+				file_name.file_index = 100;
+				util::write_sess_dir_index(LOG_ROOT[(int)type], dir_number + 1);
 
 			} else if (errno != EEXIST) {
 				PX4_ERR("failed creating new dir: %s (%i)", log_dir, errno);
@@ -1349,7 +1816,7 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 			return -1;
 		}
 
-		uint16_t file_number = 100; // start with file log100
+		uint16_t file_number = _file_name[(int)type].file_index; // start with file log100 in a new session
 
 		/* look for the next file that does not exist */
 		while (file_number <= MAX_NO_LOGFILE) {
@@ -1370,6 +1837,8 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 			return -1;
 		}
 
+		_file_name[(int)type].file_index = file_number + 1;
+
 		if (notify) {
 			mavlink_log_info(&_mavlink_log_pub, "[logger] %s\t", file_name);
 			uint16_t sess = 0;
@@ -1421,6 +1890,26 @@ void Logger::start_log_file(LogType type)
 		_param_sdlog_crypto_exchange_key.get());
 #endif
 
+	_writer.set_file_preallocation(type, (type == LogType::Full) ? _param_sdlog_prealloc.get() * 1024 * 1024 : 0);
+
+	if (type == LogType::Full) {
+		// the first message of each compressed topic in a new log is written plain
+		for (int i = 0; i < _num_compressed_topics; ++i) {
+			_compressed_topics[i].valid = false;
+		}
+
+		set_log_rate_level(0);
+		_log_rate_drained_since = 0;
+
+		// drop samples captured while not logging
+		for (int i = 0; i < _num_staged_topics; ++i) {
+			_staged_topics[i]->reset();
+		}
+
+		// messages dropped from the pre-trigger buffer so far are just older than what it can hold
+		_pre_trigger_buffer.take_dropped();
+	}
+
 	if (_writer.start_log_file(type, file_name)) {
 		_writer.select_write_backend(LogWriter::BackendFile);
 		_writer.set_need_reliable_transfer(true);
@@ -1484,8 +1973,15 @@ void Logger::start_log_mavlink()
 	PX4_INFO("Start mavlink log");
 
 	_writer.start_log_mavlink();
+	_writer.set_mavlink_ack_window(_param_sdlog_strm_win.get());
+	write_header_mavlink();
+}
+
+void Logger::write_header_mavlink()
+{
 	_writer.select_write_backend(LogWriter::BackendMavlink);
 	_writer.set_need_reliable_transfer(true);
+	_writer.set_mavlink_header(true);
 	write_header(LogType::Full);
 	write_version(LogType::Full);
 	write_formats(LogType::Full);
@@ -1496,6 +1992,7 @@ void Logger::start_log_mavlink()
 	write_events_file(LogType::Full);
 	write_excluded_optional_topics(LogType::Full);
 	write_all_add_logged_msg(LogType::Full);
+	_writer.set_mavlink_header(false);
 	_writer.set_need_reliable_transfer(false);
 	_writer.unselect_write_backend();
 	_writer.notify();
@@ -1685,6 +2182,19 @@ void Logger::write_console_output()
 }
 
 void Logger::write_formats(LogType type)
+{
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+
+	if (write_cached(type, _formats_cache[(int)type], &Logger::write_formats_uncached)) {
+		return;
+	}
+
+#endif
+
+	write_formats_uncached(type);
+}
+
+void Logger::write_formats_uncached(LogType type)
 {
 	_writer.lock();
 
@@ -1816,6 +2326,82 @@ void Logger::write_formats(LogType type)
 	_writer.unlock();
 }
 
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+bool Logger::write_cached(LogType type, HeaderCache &cache, void (Logger::*write_uncached)(LogType))
+{
+	if (cache.failed()) {
+		return false;
+	}
+
+	if (!cache.valid()) {
+		cache.begin();
+		_header_capture = &cache;
+		(this->*write_uncached)(type);
+		_header_capture = nullptr;
+		cache.end();
+
+		if (!cache.valid()) {
+			PX4_WARN("header cache allocation failed");
+			return false;
+		}
+	}
+
+	if (_writer.is_started(type)) {
+		_writer.lock();
+		write_message(type, (void *)cache.data(), cache.size());
+		_writer.unlock();
+		_writer.notify();
+	}
+
+	return true;
+}
+
+void Logger::update_header_cache()
+{
+	if (hrt_elapsed_time(&_header_cache_check) < HEADER_CACHE_CHECK_INTERVAL) {
+		return;
+	}
+
+	_header_cache_check = hrt_absolute_time();
+
+	// the defaults are only logged for used parameters that differ from the current value
+	bool parameters_changed = false;
+
+	if (_header_cache_parameter_update_sub.updated()) {
+		parameter_update_s pupdate;
+		_header_cache_parameter_update_sub.copy(&pupdate);
+		parameters_changed = true;
+	}
+
+	const unsigned parameters_used = param_count_used();
+
+	if (parameters_used != _parameter_defaults_cache_used) {
+		_parameter_defaults_cache_used = parameters_used;
+		parameters_changed = true;
+	}
+
+	if (parameters_changed) {
+		_parameter_defaults_cache.invalidate();
+
+	} else if (!_parameter_defaults_cache.valid() && !_parameter_defaults_cache.failed()) {
+		// rebuild once the parameters are settled
+		write_cached(LogType::Full, _parameter_defaults_cache, &Logger::write_parameter_defaults_uncached);
+	}
+
+	for (int i = 0; i < (int)LogType::Count; ++i) {
+		const LogType type = (LogType)i;
+
+		if (type == LogType::Mission && _num_mission_subs == 0) {
+			continue;
+		}
+
+		if (!_formats_cache[i].valid() && !_formats_cache[i].failed()) {
+			write_cached(type, _formats_cache[i], &Logger::write_formats_uncached);
+		}
+	}
+}
+#endif
+
 void Logger::write_all_add_logged_msg(LogType type)
 {
 	_writer.lock();
@@ -1846,20 +2432,29 @@ void Logger::write_all_add_logged_msg(LogType type)
 	}
 }
 
-void Logger::write_add_logged_msg(LogType type, LoggerSubscription &subscription)
+bool Logger::assign_msg_id(LoggerSubscription &subscription)
 {
-	ulog_message_add_logged_s msg;
-
 	if (subscription.msg_id == MSG_ID_INVALID) {
 		if (_next_topic_id == MSG_ID_INVALID) {
 			// if we land here an uint8 is too small -> switch to uint16
 			PX4_ERR("limit for _next_topic_id reached");
-			return;
+			return false;
 		}
 
 		subscription.msg_id = _next_topic_id++;
 	}
 
+	return true;
+}
+
+void Logger::write_add_logged_msg(LogType type, LoggerSubscription &subscription)
+{
+	ulog_message_add_logged_s msg;
+
+	if (!assign_msg_id(subscription)) {
+		return;
+	}
+
 	msg.msg_id = subscription.msg_id;
 	msg.multi_id = subscription.get_instance();
 
@@ -2132,6 +2727,19 @@ void Logger::write_version(LogType type)
 }
 
 void Logger::write_parameter_defaults(LogType type)
+{
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+
+	if (write_cached(type, _parameter_defaults_cache, &Logger::write_parameter_defaults_uncached)) {
+		return;
+	}
+
+#endif
+
+	write_parameter_defaults_uncached(type);
+}
+
+void Logger::write_parameter_defaults_uncached(LogType type)
 {
 	_writer.lock();
 	ulog_message_parameter_default_s msg = {};
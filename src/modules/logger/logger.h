@@ -38,6 +38,9 @@
 #include "messages.h"
 #include "watchdog.h"
 #include <containers/Array.hpp>
+#include "header_cache.h"
+#include "pre_trigger_buffer.h"
+#include "staged_topic.h"
 #include "util.h"
 #include <px4_platform_common/defines.h>
 #include <drivers/drv_hrt.h>
@@ -75,10 +78,15 @@ struct LoggerSubscription : public uORB::SubscriptionInterval {
 	LoggerSubscription() = default;
 
 	LoggerSubscription(ORB_ID id, uint32_t interval_ms = 0, uint8_t instance = 0) :
-		uORB::SubscriptionInterval(id, interval_ms * 1000, instance)
+		uORB::SubscriptionInterval(id, interval_ms * 1000, instance),
+		base_interval_ms(interval_ms)
 	{}
 
+	uint16_t base_interval_ms{0}; ///< configured interval, without log rate reduction
 	uint8_t msg_id{MSG_ID_INVALID};
+	TopicPriority priority{TopicPriority::Normal};
+	int16_t compression_index{-1}; ///< index into the compression state, -1 if logged plain
+	int16_t staged_index{-1}; ///< index into the staged topics, -1 if polled
 };
 
 class Logger : public ModuleBase<Logger>, public ModuleParams
@@ -163,8 +171,9 @@ private:
 	};
 
 	struct LogFileName {
-		char log_dir[12];           ///< e.g. "2018-01-01" or "sess001"
+		char log_dir[12] {};        ///< e.g. "2018-01-01" or "sess001"
 		int sess_dir_index{1};      ///< search starting index for 'sess<i>' directory name
+		uint16_t file_index{100};   ///< search starting index for 'log<i>' file name
 		char log_file_name[31];     ///< e.g. "log001.ulg" or "12_09_00_replayed.ulg"
 		bool has_log_dir{false};
 	};
@@ -192,6 +201,12 @@ private:
 	 */
 	void write_all_add_logged_msg(LogType type);
 
+	/**
+	 * Assign the next free message ID to a subscription, if it does not have one yet
+	 * @return false if there are no more IDs
+	 */
+	bool assign_msg_id(LoggerSubscription &subscription);
+
 	/**
 	 * Write an ADD_LOGGED_MSG to the log for a given subscription and instance.
 	 * _writer.lock() must be held when calling this.
@@ -207,6 +222,15 @@ private:
 	 * @return string length of log_dir (excluding terminating null-char), <0 on error
 	 */
 	int create_log_dir(LogType type, tm *tt, char *log_dir, int log_dir_len);
+	int create_log_dir_locked(LogType type, tm *tt, char *log_dir, int log_dir_len);
+
+	/**
+	 * Start a low priority thread removing old log directories (SDLOG_DIRS_MAX and free space)
+	 * @return true on success
+	 */
+	bool start_cleanup_thread();
+
+	static void *cleanup_thread_helper(void *context);
 
 	/**
 	 * Get log file name with directory (create it if necessary)
@@ -219,6 +243,12 @@ private:
 
 	void start_log_mavlink();
 
+	/**
+	 * write the log header to the mavlink backend. Called on start, and again when another
+	 * client starts streaming while the mavlink log is already running.
+	 */
+	void write_header_mavlink();
+
 	void stop_log_mavlink();
 
 	/** check if mavlink logging can be started */
@@ -237,6 +267,7 @@ private:
 	void write_header(LogType type);
 
 	void write_formats(LogType type);
+	void write_formats_uncached(LogType type);
 
 	/**
 	 * write performance counters
@@ -274,6 +305,20 @@ private:
 
 	void write_parameters(LogType type);
 	void write_parameter_defaults(LogType type);
+	void write_parameter_defaults_uncached(LogType type);
+
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+	/**
+	 * Write a header section from its cache, building the cache first if needed.
+	 * @return false if there is no cache, the caller then writes the section directly
+	 */
+	bool write_cached(LogType type, HeaderCache &cache, void (Logger::*write_uncached)(LogType));
+
+	/**
+	 * Rebuild invalid header caches, called while not logging.
+	 */
+	void update_header_cache();
+#endif
 
 	void write_changed_parameters(LogType type);
 	void write_events_file(LogType type);
@@ -338,10 +383,103 @@ private:
 
 	void adjust_subscription_updates();
 
+	/**
+	 * Closed-loop log rate control: progressively reduce the logging rate of lower priority
+	 * topics while the file write buffer fills up, and restore it once it drained.
+	 * _writer.lock() must be held when calling this.
+	 */
+	void control_log_rate(hrt_abstime now);
+
+	/**
+	 * Apply a log rate level to the (non-mission) subscriptions
+	 * @param level 0 (configured rates) to LOG_RATE_LEVEL_MAX
+	 */
+	void set_log_rate_level(int level);
+
+	/**
+	 * Write a ULog logging message to the full log.
+	 * _writer.lock() must be held when calling this.
+	 * @param log_level syslog level (0 = emergency, 7 = debug)
+	 */
+	void write_logging_message(uint8_t log_level, uint64_t timestamp, const char *message);
+
+	/**
+	 * Write the data message in _msg_buffer to the full log, delta compressed if enabled for the subscription.
+	 * _writer.lock() must be held when calling this.
+	 * @return true if the message was written
+	 */
+	bool write_data_message(LoggerSubscription &sub, size_t msg_size);
+
+	/**
+	 * Write the topic data in _msg_buffer (after the header) to the full and mission logs.
+	 * _writer.lock() must be held when calling this.
+	 */
+	void write_subscription_data(int sub_idx, hrt_abstime loop_time, uint32_t &total_bytes);
+
+	/**
+	 * Write a data, logging or sync message to the full log, through the pre-trigger buffer if active.
+	 * _writer.lock() must be held when calling this.
+	 * @return true if the message was written or buffered
+	 */
+	bool write_full_log_stream(void *ptr, size_t size);
+
+	/**
+	 * true while data messages of the full log go through the pre-trigger buffer: when not logging to file,
+	 * and after starting until the buffered data is written.
+	 */
+	bool pre_trigger_active() const;
+
+	/**
+	 * Start a file log (which includes the data of the pre-trigger buffer) due to an event, and keep
+	 * logging for at least PRE_TRIGGER_POST_DURATION.
+	 */
+	void pre_trigger(const char *reason);
+
+	/**
+	 * Move as many messages from the pre-trigger buffer to the full log as currently fit.
+	 * _writer.lock() must be held when calling this.
+	 */
+	void flush_pre_trigger_buffer();
+
 	uint8_t						*_msg_buffer{nullptr};
 	int						_msg_buffer_len{0};
 
+	struct CompressedTopic {
+		uint8_t *previous{nullptr};	///< last written message, reference for the next one
+		uint16_t since_plain{0};	///< compressed messages since the last plain one
+		bool valid{false};		///< previous was written to the current log
+	};
+
+	static constexpr uint16_t COMPRESSION_PLAIN_INTERVAL = 50; ///< write every n-th message plain for readers without support
+
+	CompressedTopic					*_compressed_topics{nullptr};
+	int						_num_compressed_topics{0};
+	uint8_t						*_compression_buffer{nullptr};
+
+	StagedTopic					**_staged_topics{nullptr};
+	int						_num_staged_topics{0};
+
+	static constexpr int LOG_RATE_LEVEL_MAX = 3;
+	static constexpr float LOG_RATE_REDUCE_FILL = 0.5f;	///< buffer fill ratio above which the rate is reduced
+	static constexpr float LOG_RATE_RESTORE_FILL = 0.1f;	///< buffer fill ratio below which the rate is restored
+	static constexpr hrt_abstime LOG_RATE_REDUCE_HOLD{200_ms};
+	static constexpr hrt_abstime LOG_RATE_RESTORE_HOLD{2_s};
+
+	int						_log_rate_level{0};
+	hrt_abstime					_log_rate_level_change{0};
+	hrt_abstime					_log_rate_drained_since{0}; ///< 0 if the buffer is not drained
+
+	static constexpr hrt_abstime PRE_TRIGGER_POST_DURATION{60_s}; ///< minimum log duration after a pre-trigger event
+
+	PreTriggerBuffer				_pre_trigger_buffer;
+	hrt_abstime					_pre_trigger_time{0}; ///< time of the last pre-trigger event, 0 if none
+	bool						_prev_failsafe{false};
+
 	LogFileName					_file_name[(int)LogType::Count];
+	pthread_mutex_t					_log_dir_mutex; ///< protects the log directories against the cleanup thread
+	pthread_t					_cleanup_thread{};
+	bool						_cleanup_thread_running{false};
+	orb_advert_t					_cleanup_mavlink_log_pub{nullptr};
 
 	bool						_prev_file_log_start_state{false}; ///< previous state depending on logging mode (arming or aux1 state)
 	bool						_manually_logging_override{false};
@@ -391,13 +529,29 @@ private:
 	uORB::SubscriptionInterval			_log_message_sub{ORB_ID(log_message), 20};
 	uORB::SubscriptionInterval			_parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
+#if defined(CONFIG_LOGGER_HEADER_CACHE)
+	static constexpr hrt_abstime HEADER_CACHE_CHECK_INTERVAL{1_s};
+
+	HeaderCache					_formats_cache[(int)LogType::Count];
+	HeaderCache					_parameter_defaults_cache;
+	unsigned					_parameter_defaults_cache_used{0}; ///< number of used parameters when cached
+	HeaderCache					*_header_capture{nullptr}; ///< if set, messages are appended here instead of written
+	hrt_abstime					_header_cache_check{0};
+	uORB::Subscription				_header_cache_parameter_update_sub{ORB_ID(parameter_update)};
+#endif
+
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::SDLOG_UTC_OFFSET>) _param_sdlog_utc_offset,
 		(ParamInt<px4::params::SDLOG_DIRS_MAX>) _param_sdlog_dirs_max,
 		(ParamInt<px4::params::SDLOG_PROFILE>) _param_sdlog_profile,
 		(ParamInt<px4::params::SDLOG_MISSION>) _param_sdlog_mission,
 		(ParamBool<px4::params::SDLOG_BOOT_BAT>) _param_sdlog_boot_bat,
-		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid
+		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid,
+		(ParamInt<px4::params::SDLOG_PREALLOC>) _param_sdlog_prealloc,
+		(ParamBool<px4::params::SDLOG_COMPRESS>) _param_sdlog_compress,
+		(ParamInt<px4::params::SDLOG_STAGING>) _param_sdlog_staging,
+		(ParamInt<px4::params::SDLOG_PRETRIG>) _param_sdlog_pretrig,
+		(ParamInt<px4::params::SDLOG_STRM_WIN>) _param_sdlog_strm_win
 #if defined(PX4_CRYPTO)
 		, (ParamInt<px4::params::SDLOG_ALGORITHM>) _param_sdlog_crypto_algorithm,
 		(ParamInt<px4::params::SDLOG_KEY>) _param_sdlog_crypto_key,
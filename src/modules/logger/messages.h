@@ -49,6 +49,7 @@ enum class ULogMessageType : uint8_t {
 	LOGGING = 'L',
 	LOGGING_TAGGED = 'C',
 	FLAG_BITS = 'B',
+	DATA_COMPRESSED = 'Z',
 };
 
 
@@ -179,6 +180,20 @@ struct ulog_message_data_s {
 	uint16_t msg_id;
 };
 
+/**
+ * @brief Compressed Data Message
+ *
+ * Data message encoded relative to the previous data message (plain or compressed) with the same msg_id,
+ * as described in delta_compression.h. The encoded data follows after the msg_id. Readers not supporting
+ * it can skip these messages and still get the plain data messages, which are rate limited.
+ */
+struct ulog_message_data_compressed_s {
+	uint16_t msg_size; ///< size of message - ULOG_MSG_HEADER_LEN
+	uint8_t msg_type = static_cast<uint8_t>(ULogMessageType::DATA_COMPRESSED);
+
+	uint16_t msg_id;
+};
+
 /**
  * @brief Information Message
  *
@@ -150,7 +150,8 @@ PARAM_DEFINE_INT32(SDLOG_PROFILE, 1);
  * Maximum number of log directories to keep
  *
  * If there are more log directories than this value,
- * the system will delete the oldest directories during startup.
+ * the system will delete the oldest directories during startup
+ * (in a low priority background thread, not delaying the start of logging).
  *
  * In addition, the system will delete old logs if there is not enough free space left.
  * The minimum amount is 300 MB.
@@ -167,6 +168,55 @@ PARAM_DEFINE_INT32(SDLOG_PROFILE, 1);
  */
 PARAM_DEFINE_INT32(SDLOG_DIRS_MAX, 0);
 
+/**
+ * Preallocation extent of the full log file
+ *
+ * If non-zero, the full log file is preallocated in extents of this size ahead
+ * of the data, and written in aligned blocks bypassing the page cache (O_DIRECT).
+ * This avoids stalls on file system block allocation during high-rate logging.
+ * Unused space is released when the log is closed.
+ *
+ * Only supported on Linux, ignored on other platforms.
+ *
+ * @unit MB
+ * @min 0
+ * @max 1024
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_PREALLOC, 0);
+
+/**
+ * Delta compression of high-rate topics
+ *
+ * If enabled, high-rate numerical topics are written relative to their previous sample
+ * (ULog 'Z' messages), with every 50th sample written plain. Use Tools/ulog_decompress.py
+ * to convert the log for tools that do not support compressed data messages.
+ *
+ * Only applies to the file backend.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_COMPRESS, 0);
+
+/**
+ * Staging depth of high-rate topics
+ *
+ * If greater than 0, high-rate topics are captured at publication time into a buffer
+ * of this many samples per topic instead of being polled by the logger. This avoids
+ * missing queued samples if the logger runs late, at the cost of RAM and a copy in
+ * the context of the publisher.
+ *
+ * The value is rounded up to a power of 2. Set to 0 to disable.
+ *
+ * @min 0
+ * @max 64
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_STAGING, 0);
+
 /**
  * Log UUID
  *
@@ -219,3 +269,34 @@ PARAM_DEFINE_INT32(SDLOG_KEY, 2);
  * @group SD Logging
  */
 PARAM_DEFINE_INT32(SDLOG_EXCH_KEY, 1);
+
+/**
+ * Pre-trigger buffer size
+ *
+ * If greater than 0, a RAM buffer of this size keeps the most recent data while no log
+ * file is written (e.g. before arming). When logging starts, the buffered data is written
+ * to the log first. A log is also started on a failsafe, or when receiving the
+ * VEHICLE_CMD_LOGGING_PRE_TRIGGER command, and recorded for at least a minute.
+ *
+ * How many seconds are covered depends on the logging profile and rate.
+ *
+ * @min 0
+ * @max 4096
+ * @unit KB
+ * @reboot_required true
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_PRETRIG, 0);
+
+/**
+ * MAVLink log streaming ack window
+ *
+ * Number of reliably transferred log messages (e.g. the log header) that can be in
+ * flight before the logger waits for an ack. Larger values speed up the log start
+ * on links with a high latency.
+ *
+ * @min 1
+ * @max 8
+ * @group SD Logging
+ */
+PARAM_DEFINE_INT32(SDLOG_STRM_WIN, 1);
@@ -0,0 +1,139 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "pre_trigger_buffer.h"
+#include "messages.h"
+
+#include <string.h>
+
+namespace px4
+{
+namespace logger
+{
+
+PreTriggerBuffer::~PreTriggerBuffer()
+{
+	delete[](_buffer);
+}
+
+bool PreTriggerBuffer::allocate(size_t size)
+{
+	delete[](_buffer);
+	_buffer = new uint8_t[size];
+	_size = _buffer ? size : 0;
+	reset();
+	return _buffer != nullptr;
+}
+
+void PreTriggerBuffer::reset()
+{
+	_tail = 0;
+	_count = 0;
+	_dropped = 0;
+}
+
+void PreTriggerBuffer::read(size_t pos, void *dst, size_t n) const
+{
+	const size_t n_to_end = _size - pos;
+	uint8_t *dst_c = static_cast<uint8_t *>(dst);
+
+	if (n > n_to_end) {
+		memcpy(dst_c, _buffer + pos, n_to_end);
+		memcpy(dst_c + n_to_end, _buffer, n - n_to_end);
+
+	} else {
+		memcpy(dst_c, _buffer + pos, n);
+	}
+}
+
+size_t PreTriggerBuffer::front_size() const
+{
+	if (_count < ULOG_MSG_HEADER_LEN) {
+		return 0;
+	}
+
+	uint8_t msg_size[2];
+	read(_tail, msg_size, sizeof(msg_size));
+	return ((size_t)msg_size[0] | ((size_t)msg_size[1] << 8)) + ULOG_MSG_HEADER_LEN;
+}
+
+void PreTriggerBuffer::drop_front()
+{
+	const size_t size = front_size();
+	_tail = (_tail + size) % _size;
+	_count -= size;
+	_dropped++;
+}
+
+bool PreTriggerBuffer::push(const void *msg, size_t size)
+{
+	if (!_buffer || size > _size) {
+		return false;
+	}
+
+	while (_size - _count < size) {
+		drop_front();
+	}
+
+	const size_t head = (_tail + _count) % _size;
+	const size_t n_to_end = _size - head;
+	const uint8_t *msg_c = static_cast<const uint8_t *>(msg);
+
+	if (size > n_to_end) {
+		memcpy(_buffer + head, msg_c, n_to_end);
+		memcpy(_buffer, msg_c + n_to_end, size - n_to_end);
+
+	} else {
+		memcpy(_buffer + head, msg_c, size);
+	}
+
+	_count += size;
+	return true;
+}
+
+size_t PreTriggerBuffer::pop(void *dst, size_t dst_size)
+{
+	const size_t size = front_size();
+
+	if (size == 0 || size > dst_size) {
+		return 0;
+	}
+
+	read(_tail, dst, size);
+	_tail = (_tail + size) % _size;
+	_count -= size;
+	return size;
+}
+
+} // namespace logger
+} // namespace px4
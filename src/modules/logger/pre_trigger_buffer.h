@@ -0,0 +1,111 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class PreTriggerBuffer
+ * Circular RAM buffer of whole ULog messages. While no log file is written it holds the
+ * most recent data, dropping the oldest messages when full. When a log file is started,
+ * the messages are moved into the log (oldest first), so that the log also contains the
+ * data from before the trigger.
+ *
+ * Only used from the logger thread.
+ */
+class PreTriggerBuffer
+{
+public:
+	PreTriggerBuffer() = default;
+	~PreTriggerBuffer();
+
+	/**
+	 * Allocate the buffer
+	 * @return true on success
+	 */
+	bool allocate(size_t size);
+
+	bool allocated() const { return _buffer != nullptr; }
+
+	/**
+	 * Add a message (including its ULog message header). Drops the oldest messages to
+	 * make space if needed.
+	 * @return false if the message does not fit at all
+	 */
+	bool push(const void *msg, size_t size);
+
+	/**
+	 * Get the size of the oldest message (including its header)
+	 * @return 0 if empty
+	 */
+	size_t front_size() const;
+
+	/**
+	 * Copy the oldest message to dst and remove it
+	 * @return message size, 0 if empty or dst is too small
+	 */
+	size_t pop(void *dst, size_t dst_size);
+
+	void reset();
+
+	size_t count() const { return _count; }
+	size_t size() const { return _size; }
+
+	/** number of messages dropped to make space since the last call */
+	uint32_t take_dropped()
+	{
+		const uint32_t dropped = _dropped;
+		_dropped = 0;
+		return dropped;
+	}
+
+private:
+	void read(size_t pos, void *dst, size_t n) const;
+	void drop_front();
+
+	uint8_t *_buffer{nullptr};
+	size_t _size{0};
+	size_t _tail{0}; ///< position of the oldest message
+	size_t _count{0}; ///< number of bytes in use
+	uint32_t _dropped{0};
+};
+
+} // namespace logger
+} // namespace px4
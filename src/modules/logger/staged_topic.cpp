@@ -0,0 +1,100 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "staged_topic.h"
+
+#include <string.h>
+
+namespace px4
+{
+namespace logger
+{
+
+StagedTopic::~StagedTopic()
+{
+	// make sure the publisher is not in call() anymore before freeing the ring
+	unregisterCallback();
+	delete[](_buffer);
+}
+
+bool StagedTopic::init(unsigned depth)
+{
+	unsigned depth_pow2 = 1;
+
+	while (depth_pow2 < depth) {
+		depth_pow2 <<= 1;
+	}
+
+	_size = get_topic()->o_size;
+	_buffer = new uint8_t[depth_pow2 * _size];
+
+	if (_buffer == nullptr) {
+		return false;
+	}
+
+	_depth = depth_pow2;
+	return true;
+}
+
+void StagedTopic::call()
+{
+	// the publisher holds the topic lock, so the borrowed data cannot change while it is copied.
+	// Drain all unread samples (there can be more than one for the first call after registration).
+	const void *data;
+
+	while ((data = _subscription.borrow()) != nullptr) {
+		if (_interval_us > 0) {
+			const hrt_abstime now = hrt_absolute_time();
+
+			if (now < _last_update + _interval_us) {
+				continue;
+			}
+
+			_last_update = (now > _interval_us) ? math::constrain(_last_update + _interval_us, now - _interval_us, now) : now;
+		}
+
+		const uint32_t head = _head.load();
+
+		if (head - _tail.load() >= _depth) {
+			_dropped.fetch_add(1);
+			continue;
+		}
+
+		memcpy(_buffer + (head & (_depth - 1)) * _size, data, _size);
+		_head.store(head + 1);
+	}
+}
+
+} // namespace logger
+} // namespace px4
@@ -0,0 +1,131 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+#include <uORB/SubscriptionCallback.hpp>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class StagedTopic
+ * Captures every publication of a topic into a lock-free single-producer, single-consumer
+ * ring, so that the logger does not have to poll the topic and cannot miss queued samples
+ * if it runs late.
+ *
+ * The producer is the publisher: uORB calls call() from within the publication, serialized
+ * per topic instance. The consumer is the logger thread (front()/pop()).
+ */
+class StagedTopic : public uORB::SubscriptionCallback
+{
+public:
+	StagedTopic(const orb_metadata *meta, uint32_t interval_us, uint8_t instance) :
+		uORB::SubscriptionCallback(meta, interval_us, instance)
+	{}
+
+	~StagedTopic() override;
+
+	/**
+	 * Allocate the ring
+	 * @param depth number of samples, rounded up to a power of 2
+	 * @return true on success
+	 */
+	bool init(unsigned depth);
+
+	/**
+	 * Called by the publisher: copy all new samples into the ring
+	 */
+	void call() override;
+
+	/**
+	 * Get the oldest captured sample (o_size bytes), which stays valid until pop() is called
+	 * @return nullptr if there is none
+	 */
+	const uint8_t *front() const
+	{
+		const uint32_t tail = _tail.load();
+
+		if (tail == _head.load()) {
+			return nullptr;
+		}
+
+		return _buffer + (tail & (_depth - 1)) * _size;
+	}
+
+	/**
+	 * Release the sample returned by front()
+	 */
+	void pop() { _tail.store(_tail.load() + 1); }
+
+	/**
+	 * Discard all captured samples and the dropped counter (consumer side)
+	 */
+	void reset()
+	{
+		_tail.store(_head.load());
+		take_dropped();
+	}
+
+	/**
+	 * Get and reset the number of samples dropped because the ring was full
+	 */
+	uint32_t take_dropped()
+	{
+		const uint32_t dropped = _dropped.load();
+
+		if (dropped > 0) {
+			_dropped.fetch_sub(dropped);
+		}
+
+		return dropped;
+	}
+
+	unsigned depth() const { return _depth; }
+
+private:
+	uint8_t *_buffer{nullptr};
+	uint16_t _depth{0};
+	uint16_t _size{0};
+
+	px4::atomic<uint32_t> _head{0}; ///< written by the producer only
+	px4::atomic<uint32_t> _tail{0}; ///< written by the consumer only
+	px4::atomic<uint32_t> _dropped{0};
+};
+
+} // namespace logger
+} // namespace px4
@@ -35,6 +35,7 @@
 
 #include <dirent.h>
 #include <sys/stat.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -57,6 +58,11 @@
 
 #define GPS_EPOCH_SECS ((time_t)1234567890ULL)
 
+static constexpr char SESS_INDEX_FILE_NAME[] = "sess_index";
+
+/* use a threshold of 50 MiB: if below, do not start logging */
+static constexpr uint64_t MIN_FREE_BYTES = 50ULL * 1024ULL * 1024ULL;
+
 typedef decltype(statfs::f_bavail) px4_statfs_buf_f_bavail_t;
 
 namespace px4
@@ -113,7 +119,7 @@ bool get_log_time(struct tm *tt, int utc_offset_sec, bool boot_time)
 }
 
 int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb_advert_t &mavlink_log_pub,
-		     int &sess_dir_index)
+		     int &sess_dir_index, pthread_mutex_t *dir_mutex, const char *dir_in_use)
 {
 	struct statfs statfs_buf;
 
@@ -141,10 +147,16 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 		// For both we find the oldest and then remove the one which has more directories.
 		int year_min = 10000, month_min = 99, day_min = 99, sess_idx_min = 99999999, sess_idx_max = 99;
 
+		char leftover_directory[LOG_DIR_LEN] {};
+
 		while ((result = readdir(dp))) {
 			int year, month, day, sess_idx;
 
-			if (sscanf(result->d_name, "sess%d", &sess_idx) == 1) {
+			if (strncmp(result->d_name, ".del_", 5) == 0) {
+				// partially removed directory (e.g. power loss during a previous removal)
+				snprintf(leftover_directory, sizeof(leftover_directory), "%s/%s", log_root_dir, result->d_name);
+
+			} else if (sscanf(result->d_name, "sess%d", &sess_idx) == 1) {
 				++num_sess;
 
 				if (sess_idx > sess_idx_max) {
@@ -181,6 +193,15 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 
 		sess_dir_index = sess_idx_max + 1;
 
+		if (leftover_directory[0] != '\0') {
+			if (remove_directory(leftover_directory)) {
+				PX4_ERR("Failed to delete directory");
+				break;
+			}
+
+			continue;
+		}
+
 
 		uint64_t min_free_bytes = 300ULL * 1024ULL * 1024ULL;
 		uint64_t total_bytes = (uint64_t)statfs_buf.f_blocks * statfs_buf.f_bsize;
@@ -198,17 +219,18 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 			break; // nothing to delete
 		}
 
+		char dir_name[16];
 		char directory_to_delete[LOG_DIR_LEN];
-		int n;
 
 		if (num_sess >= num_dates) {
-			n = snprintf(directory_to_delete, sizeof(directory_to_delete), "%s/sess%03u", log_root_dir, sess_idx_min);
+			snprintf(dir_name, sizeof(dir_name), "sess%03u", sess_idx_min);
 
 		} else {
-			n = snprintf(directory_to_delete, sizeof(directory_to_delete), "%s/%04u-%02u-%02u", log_root_dir, year_min, month_min,
-				     day_min);
+			snprintf(dir_name, sizeof(dir_name), "%04u-%02u-%02u", year_min, month_min, day_min);
 		}
 
+		int n = snprintf(directory_to_delete, sizeof(directory_to_delete), "%s/%s", log_root_dir, dir_name);
+
 		if (n >= (int)sizeof(directory_to_delete)) {
 			PX4_ERR("log path too long (%i)", n);
 			break;
@@ -217,6 +239,25 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 		PX4_INFO("removing log directory %s to get more space (left=%u MiB)", directory_to_delete,
 			 (unsigned int)(statfs_buf.f_bavail * statfs_buf.f_bsize / 1024U / 1024U));
 
+		if (dir_mutex) {
+			// move the directory out of the way while holding the lock, so the (slow) removal
+			// does not block the logger from creating a new log directory
+			char directory_renamed[LOG_DIR_LEN];
+			n = snprintf(directory_renamed, sizeof(directory_renamed), "%s/.del_%s", log_root_dir, dir_name);
+
+			pthread_mutex_lock(dir_mutex);
+			const bool in_use = dir_in_use && strcmp(dir_in_use, dir_name) == 0;
+			const bool renamed = !in_use && n < (int)sizeof(directory_renamed) &&
+					     rename(directory_to_delete, directory_renamed) == 0;
+			pthread_mutex_unlock(dir_mutex);
+
+			if (!renamed) {
+				break; // the oldest directory is in use (or cannot be moved), keep everything else
+			}
+
+			strcpy(directory_to_delete, directory_renamed);
+		}
+
 		if (remove_directory(directory_to_delete)) {
 			PX4_ERR("Failed to delete directory");
 			break;
@@ -225,8 +266,7 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 	} while (true);
 
 
-	/* use a threshold of 50 MiB: if below, do not start logging */
-	if (statfs_buf.f_bavail < (px4_statfs_buf_f_bavail_t)(50 * 1024 * 1024 / statfs_buf.f_bsize)) {
+	if (statfs_buf.f_bavail < (px4_statfs_buf_f_bavail_t)(MIN_FREE_BYTES / statfs_buf.f_bsize)) {
 		mavlink_log_critical(&mavlink_log_pub,
 				     "[logger] Not logging; SD almost full: %u MiB\t",
 				     (unsigned int)(statfs_buf.f_bavail * statfs_buf.f_bsize / 1024U / 1024U));
@@ -242,6 +282,60 @@ int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb
 	return PX4_OK;
 }
 
+bool has_min_free_space(const char *log_root_dir)
+{
+	struct statfs statfs_buf;
+
+	if (statfs(log_root_dir, &statfs_buf) != 0 || statfs_buf.f_bsize == 0) {
+		return false;
+	}
+
+	return statfs_buf.f_bavail >= (px4_statfs_buf_f_bavail_t)(MIN_FREE_BYTES / statfs_buf.f_bsize);
+}
+
+int read_sess_dir_index(const char *log_root_dir)
+{
+	char file_name[LOG_DIR_LEN];
+
+	if (snprintf(file_name, sizeof(file_name), "%s/%s", log_root_dir, SESS_INDEX_FILE_NAME) >= (int)sizeof(file_name)) {
+		return -1;
+	}
+
+	FILE *fp = fopen(file_name, "r");
+
+	if (fp == nullptr) {
+		return -1;
+	}
+
+	int sess_dir_index = -1;
+
+	if (fscanf(fp, "%d", &sess_dir_index) != 1 || sess_dir_index < 0) {
+		sess_dir_index = -1;
+	}
+
+	fclose(fp);
+	return sess_dir_index;
+}
+
+void write_sess_dir_index(const char *log_root_dir, int sess_dir_index)
+{
+	char file_name[LOG_DIR_LEN];
+
+	if (snprintf(file_name, sizeof(file_name), "%s/%s", log_root_dir, SESS_INDEX_FILE_NAME) >= (int)sizeof(file_name)) {
+		return;
+	}
+
+	FILE *fp = fopen(file_name, "w");
+
+	if (fp == nullptr) {
+		PX4_DEBUG("failed to write %s", file_name);
+		return;
+	}
+
+	fprintf(fp, "%d\n", sess_dir_index);
+	fclose(fp);
+}
+
 int remove_directory(const char *dir)
 {
 	DIR *d = opendir(dir);
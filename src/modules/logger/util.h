@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <pthread.h>
 #include <stdint.h>
 #include <time.h>
 
@@ -70,10 +71,28 @@ bool file_exist(const char *filename);
  * @param max_log_dirs_to_keep maximum log directories to keep (set to 0 for unlimited)
  * @param mavlink_log_pub
  * @param sess_dir_index output argument: will be set to the next free directory sess%i index.
+ * @param dir_mutex optional mutex protecting dir_in_use, when running concurrently to the logger
+ * @param dir_in_use optional log directory name (e.g. "sess012") which must not be removed
  * @return 0 on success, 1 if not enough space, <0 on error
  */
 int check_free_space(const char *log_root_dir, int32_t max_log_dirs_to_keep, orb_advert_t &mavlink_log_pub,
-		     int &sess_dir_index);
+		     int &sess_dir_index, pthread_mutex_t *dir_mutex = nullptr, const char *dir_in_use = nullptr);
+
+/**
+ * Check (without scanning the log directory) if there is enough free space to start logging
+ */
+bool has_min_free_space(const char *log_root_dir);
+
+/**
+ * Read the next free sess%i directory index from the index file in the log root directory
+ * @return the index, or -1 if there's no (valid) index file
+ */
+int read_sess_dir_index(const char *log_root_dir);
+
+/**
+ * Store the next free sess%i directory index, so that the next boot does not need to scan the log root directory
+ */
+void write_sess_dir_index(const char *log_root_dir, int sess_dir_index);
 
 /**
  * Get the time for log file name
@@ -135,9 +135,9 @@ void MagBiasEstimator::Run()
 			if (calibration_count != _calibration[mag_index].calibration_count()) {
 				_reset_field_estimator[mag_index] = true;
 			}
-
-			_bias_estimator[mag_index].setLearningGain(_param_mbe_learn_gain.get());
 		}
+
+		_bias_estimator.setLearningGain(_param_mbe_learn_gain.get());
 	}
 
 	// do nothing during regular sensor calibration
@@ -154,70 +154,103 @@ void MagBiasEstimator::Run()
 
 		const Vector3f angular_velocity{vehicle_angular_velocity.xyz};
 
-		bool updated = false;
+		// collect the queued samples of all instances first, calibrated and stored per axis over the instances
+		static constexpr int QUEUE_LENGTH = sensor_mag_s::ORB_QUEUE_LENGTH;
+		float mag_calibrated[QUEUE_LENGTH][3][MAX_SENSOR_COUNT];
+		hrt_abstime timestamp_sample[QUEUE_LENGTH][MAX_SENSOR_COUNT];
+		int sample_count[MAX_SENSOR_COUNT] {};
+		int max_sample_count = 0;
 
 		for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
-			int sensor_mag_updates = 0;
 			sensor_mag_s sensor_mag;
 
-			while ((sensor_mag_updates < sensor_mag_s::ORB_QUEUE_LENGTH) && _sensor_mag_subs[mag_index].update(&sensor_mag)) {
-				sensor_mag_updates++;
-				updated = true;
+			while ((sample_count[mag_index] < QUEUE_LENGTH) && _sensor_mag_subs[mag_index].update(&sensor_mag)) {
+				const int sample = sample_count[mag_index]++;
 
 				// apply existing mag calibration
 				_calibration[mag_index].set_device_id(sensor_mag.device_id);
 
-				const Vector3f mag_calibrated = _calibration[mag_index].Correct(Vector3f{sensor_mag.x, sensor_mag.y, sensor_mag.z});
+				const Vector3f mag = _calibration[mag_index].Correct(Vector3f{sensor_mag.x, sensor_mag.y, sensor_mag.z});
+				mag_calibrated[sample][0][mag_index] = mag(0);
+				mag_calibrated[sample][1][mag_index] = mag(1);
+				mag_calibrated[sample][2][mag_index] = mag(2);
+				timestamp_sample[sample][mag_index] = sensor_mag.timestamp_sample;
+			}
+
+			max_sample_count = math::max(max_sample_count, sample_count[mag_index]);
+		}
+
+		bool updated = (max_sample_count > 0);
+
+		// then run the estimators of all instances together, one queued sample of each per step
+		for (int sample = 0; sample < max_sample_count; sample++) {
+			float dt[MAX_SENSOR_COUNT] {};
+			bool active[MAX_SENSOR_COUNT] {};
+			Vector3f bias_prev[MAX_SENSOR_COUNT];
+
+			for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+				if (sample >= sample_count[mag_index]) {
+					continue;
+				}
 
-				float dt = (sensor_mag.timestamp_sample - _timestamp_last_update[mag_index]) * 1e-6f;
-				_timestamp_last_update[mag_index] = sensor_mag.timestamp_sample;
+				dt[mag_index] = (timestamp_sample[sample][mag_index] - _timestamp_last_update[mag_index]) * 1e-6f;
+				_timestamp_last_update[mag_index] = timestamp_sample[sample][mag_index];
 
-				if (dt < 0.001f || dt > 0.2f) {
+				if (dt[mag_index] < 0.001f || dt[mag_index] > 0.2f) {
 					_reset_field_estimator[mag_index] = true;
 				}
 
 				if (_reset_field_estimator[mag_index]) {
 					// reset
-					_bias_estimator[mag_index].setBias(Vector3f{});
-					_bias_estimator[mag_index].setField(mag_calibrated);
+					_bias_estimator.setBias(mag_index, Vector3f{});
+					_bias_estimator.setField(mag_index, Vector3f{mag_calibrated[sample][0][mag_index],
+								 mag_calibrated[sample][1][mag_index],
+								 mag_calibrated[sample][2][mag_index]});
 
 					_reset_field_estimator[mag_index] = false;
 					_valid[mag_index] = false;
 					_time_valid[mag_index] = 0;
 
 				} else {
-					updated = true;
+					active[mag_index] = true;
+					bias_prev[mag_index] = _bias_estimator.getBias(mag_index);
+				}
+			}
 
-					const Vector3f bias_prev = _bias_estimator[mag_index].getBias();
+			_bias_estimator.updateEstimate(angular_velocity, mag_calibrated[sample], dt, active);
 
-					_bias_estimator[mag_index].updateEstimate(angular_velocity, mag_calibrated, dt);
+			for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
+				if (!active[mag_index]) {
+					continue;
+				}
 
-					const Vector3f &bias = _bias_estimator[mag_index].getBias();
-					const Vector3f bias_rate = (bias - bias_prev) / dt;
+				updated = true;
 
-					if (!bias.isAllFinite() || bias.longerThan(5.f)) {
-						_reset_field_estimator[mag_index] = true;
-						_valid[mag_index] = false;
-						_time_valid[mag_index] = 0;
+				const Vector3f bias = _bias_estimator.getBias(mag_index);
+				const Vector3f bias_rate = (bias - bias_prev[mag_index]) / dt[mag_index];
 
-					} else {
+				if (!bias.isAllFinite() || bias.longerThan(5.f)) {
+					_reset_field_estimator[mag_index] = true;
+					_valid[mag_index] = false;
+					_time_valid[mag_index] = 0;
 
-						Vector3f fitness{
-							fabsf(angular_velocity(0)) / fmaxf(fabsf(bias_rate(1)) + fabsf(bias_rate(2)), 0.02f),
-							fabsf(angular_velocity(1)) / fmaxf(fabsf(bias_rate(0)) + fabsf(bias_rate(2)), 0.02f),
-							fabsf(angular_velocity(2)) / fmaxf(fabsf(bias_rate(0)) + fabsf(bias_rate(1)), 0.02f)
-						};
+				} else {
 
-						const bool bias_significant = bias.longerThan(0.04f);
-						const bool has_converged = fitness(0) > 20.f || fitness(1) > 20.f || fitness(2) > 20.f;
+					Vector3f fitness{
+						fabsf(angular_velocity(0)) / fmaxf(fabsf(bias_rate(1)) + fabsf(bias_rate(2)), 0.02f),
+						fabsf(angular_velocity(1)) / fmaxf(fabsf(bias_rate(0)) + fabsf(bias_rate(2)), 0.02f),
+						fabsf(angular_velocity(2)) / fmaxf(fabsf(bias_rate(0)) + fabsf(bias_rate(1)), 0.02f)
+					};
 
-						if (bias_significant && has_converged) {
-							if (!_valid[mag_index]) {
-								_time_valid[mag_index] = hrt_absolute_time();
-							}
+					const bool bias_significant = bias.longerThan(0.04f);
+					const bool has_converged = fitness(0) > 20.f || fitness(1) > 20.f || fitness(2) > 20.f;
 
-							_valid[mag_index] = true;
+					if (bias_significant && has_converged) {
+						if (!_valid[mag_index]) {
+							_time_valid[mag_index] = hrt_absolute_time();
 						}
+
+						_valid[mag_index] = true;
 					}
 				}
 			}
@@ -236,7 +269,7 @@ void MagBiasEstimator::publishMagBiasEstimate()
 	magnetometer_bias_estimate_s mag_bias_est{};
 
 	for (int mag_index = 0; mag_index < MAX_SENSOR_COUNT; mag_index++) {
-		const Vector3f &bias = _bias_estimator[mag_index].getBias();
+		const Vector3f bias = _bias_estimator.getBias(mag_index);
 		mag_bias_est.bias_x[mag_index] = bias(0);
 		mag_bias_est.bias_y[mag_index] = bias(1);
 		mag_bias_est.bias_z[mag_index] = bias(2);
@@ -260,7 +293,7 @@ int MagBiasEstimator::print_status()
 
 			_calibration[mag_index].PrintStatus();
 
-			const Vector3f &bias = _bias_estimator[mag_index].getBias();
+			const Vector3f bias = _bias_estimator.getBias(mag_index);
 
 			PX4_INFO("%d (%" PRIu32 ") bias: [% 05.3f % 05.3f % 05.3f]",
 				 mag_index, _calibration[mag_index].device_id(),
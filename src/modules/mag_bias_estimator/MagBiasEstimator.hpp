@@ -34,7 +34,7 @@
 #pragma once
 
 #include <drivers/drv_hrt.h>
-#include <lib/field_sensor_bias_estimator/FieldSensorBiasEstimator.hpp>
+#include <lib/field_sensor_bias_estimator/FieldSensorBiasEstimatorBatch.hpp>
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 #include <lib/sensor_calibration/Magnetometer.hpp>
@@ -83,7 +83,7 @@ private:
 
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
-	FieldSensorBiasEstimator _bias_estimator[MAX_SENSOR_COUNT];
+	FieldSensorBiasEstimatorBatch<MAX_SENSOR_COUNT> _bias_estimator;
 	hrt_abstime _timestamp_last_update[MAX_SENSOR_COUNT] {};
 
 	uORB::SubscriptionMultiArray<sensor_mag_s, MAX_SENSOR_COUNT> _sensor_mag_subs{ORB_ID::sensor_mag};
@@ -0,0 +1,105 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "lockfree_queue.h"
+#include "mavlink_command_dedup.h"
+#include <gtest/gtest.h>
+
+TEST(LockFreeQueue, PushPop)
+{
+	LockFreeQueue<int, 4> queue;
+	int value = 0;
+
+	EXPECT_TRUE(queue.empty());
+	EXPECT_FALSE(queue.pop(value));
+
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_TRUE(queue.push(i));
+	}
+
+	// full
+	EXPECT_FALSE(queue.push(4));
+	EXPECT_FALSE(queue.empty());
+
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_TRUE(queue.pop(value));
+		EXPECT_EQ(value, i);
+	}
+
+	EXPECT_FALSE(queue.pop(value));
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(LockFreeQueue, WrapAround)
+{
+	LockFreeQueue<int, 2> queue;
+	int value = 0;
+
+	for (int i = 0; i < 100; ++i) {
+		EXPECT_TRUE(queue.push(i));
+		EXPECT_TRUE(queue.push(i + 1000));
+		EXPECT_TRUE(queue.pop(value));
+		EXPECT_EQ(value, i);
+		EXPECT_TRUE(queue.pop(value));
+		EXPECT_EQ(value, i + 1000);
+	}
+}
+
+TEST(MavlinkCommandDedup, Duplicates)
+{
+	MavlinkCommandDedup dedup;
+
+	vehicle_command_s command{};
+	command.command = vehicle_command_s::VEHICLE_CMD_COMPONENT_ARM_DISARM;
+	command.source_system = 255;
+	command.param1 = 1.f;
+
+	EXPECT_FALSE(dedup.check_duplicate(command, 1000));
+	EXPECT_TRUE(dedup.check_duplicate(command, 1100));
+	EXPECT_EQ(dedup.num_duplicates(), 1u);
+
+	// outside of the window it's handled again
+	EXPECT_FALSE(dedup.check_duplicate(command, 1100 + MavlinkCommandDedup::WINDOW_MS + 1));
+
+	// a retransmission with a new confirmation value is not a duplicate
+	command.confirmation = 1;
+	EXPECT_FALSE(dedup.check_duplicate(command, 2000));
+
+	// neither are different parameters or a different source
+	command.param1 = 0.f;
+	EXPECT_FALSE(dedup.check_duplicate(command, 2000));
+	command.source_system = 254;
+	EXPECT_FALSE(dedup.check_duplicate(command, 2000));
+	EXPECT_EQ(dedup.num_duplicates(), 1u);
+}
@@ -0,0 +1,141 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file lockfree_queue.h
+ * Bounded lock-free queue for multiple producers and consumers.
+ *
+ * Every cell carries a sequence number telling whether it is ready to be
+ * written or read for a given position, so producers and consumers only
+ * need a compare-and-swap on the shared position (D. Vyukov's design).
+ * Neither push() nor pop() block: they fail when the queue is full or empty.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <px4_platform_common/atomic.h>
+
+/**
+ * @class LockFreeQueue
+ * @tparam T trivially copyable item type
+ * @tparam NUM_ITEMS capacity, a power of 2
+ */
+template <class T, uint32_t NUM_ITEMS>
+class LockFreeQueue
+{
+public:
+	static_assert(NUM_ITEMS > 0 && (NUM_ITEMS & (NUM_ITEMS - 1)) == 0, "NUM_ITEMS must be a power of 2");
+
+	LockFreeQueue()
+	{
+		for (uint32_t i = 0; i < NUM_ITEMS; ++i) {
+			_cells[i].sequence.store(i);
+		}
+	}
+
+	~LockFreeQueue() = default;
+
+	/**
+	 * Append an item.
+	 * @return false if the queue is full
+	 */
+	bool push(const T &item)
+	{
+		uint32_t pos = _tail.load();
+
+		for (;;) {
+			Cell &cell = _cells[pos & (NUM_ITEMS - 1)];
+			const int32_t diff = (int32_t)(cell.sequence.load() - pos);
+
+			if (diff == 0) {
+				if (_tail.compare_exchange(&pos, pos + 1)) {
+					cell.item = item;
+					cell.sequence.store(pos + 1);
+					return true;
+				}
+
+			} else if (diff < 0) {
+				return false;
+
+			} else {
+				pos = _tail.load();
+			}
+		}
+	}
+
+	/**
+	 * Remove the oldest item.
+	 * @return false if the queue is empty
+	 */
+	bool pop(T &item)
+	{
+		uint32_t pos = _head.load();
+
+		for (;;) {
+			Cell &cell = _cells[pos & (NUM_ITEMS - 1)];
+			const int32_t diff = (int32_t)(cell.sequence.load() - (pos + 1));
+
+			if (diff == 0) {
+				if (_head.compare_exchange(&pos, pos + 1)) {
+					item = cell.item;
+					cell.sequence.store(pos + NUM_ITEMS);
+					return true;
+				}
+
+			} else if (diff < 0) {
+				return false;
+
+			} else {
+				pos = _head.load();
+			}
+		}
+	}
+
+	bool empty() const { return _head.load() == _tail.load(); }
+
+private:
+	struct Cell {
+		px4::atomic<uint32_t> sequence{0};
+		T item{};
+	};
+
+	Cell _cells[NUM_ITEMS];
+	px4::atomic<uint32_t> _head{0};
+	px4::atomic<uint32_t> _tail{0};
+
+	/* do not allow copying or assigning this class */
+	LockFreeQueue(const LockFreeQueue &) = delete;
+	LockFreeQueue operator=(const LockFreeQueue &) = delete;
+};
@@ -0,0 +1,136 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file mavlink_command_dedup.h
+ * Detects commands received more than once, e.g. from a ground station connected over several links.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <px4_platform_common/atomic.h>
+#include <uORB/topics/vehicle_command.h>
+
+/**
+ * @class MavlinkCommandDedup
+ * Keeps a small table of recently received commands, identified by source system, command, confirmation
+ * and parameters. Lock-free, so it can be shared by the receivers of all instances. A race between two
+ * receivers can let a duplicate through, which is the same as without deduplication.
+ */
+class MavlinkCommandDedup
+{
+public:
+	static constexpr uint32_t NUM_ENTRIES = 8;
+	static constexpr uint32_t WINDOW_MS = 500; ///< a command repeated within this time is a duplicate
+
+	MavlinkCommandDedup() = default;
+	~MavlinkCommandDedup() = default;
+
+	/**
+	 * Check if a command was already received within WINDOW_MS and record it otherwise.
+	 * @param command the received command
+	 * @param now_ms current time in milliseconds
+	 * @return true if the command is a duplicate and must not be handled again
+	 */
+	bool check_duplicate(const vehicle_command_s &command, uint32_t now_ms)
+	{
+		const uint32_t key = hash(command);
+
+		if (now_ms == 0) {
+			now_ms = 1; // 0 marks an unused entry
+		}
+
+		for (Entry &entry : _entries) {
+			if (entry.key.load() == key) {
+				const uint32_t time_ms = entry.time_ms.load();
+
+				if (time_ms != 0 && now_ms - time_ms <= WINDOW_MS) {
+					_num_duplicates.fetch_add(1);
+					return true;
+				}
+			}
+		}
+
+		Entry &entry = _entries[_next.fetch_add(1) % NUM_ENTRIES];
+		entry.time_ms.store(0);
+		entry.key.store(key);
+		entry.time_ms.store(now_ms);
+		return false;
+	}
+
+	uint32_t num_duplicates() const { return _num_duplicates.load(); }
+
+private:
+	struct Entry {
+		px4::atomic<uint32_t> key{0};
+		px4::atomic<uint32_t> time_ms{0};
+	};
+
+	static void hash_bytes(uint32_t &hash, const void *data, size_t len)
+	{
+		const uint8_t *bytes = static_cast<const uint8_t *>(data);
+
+		for (size_t i = 0; i < len; ++i) {
+			hash = (hash ^ bytes[i]) * 16777619u; // FNV-1a
+		}
+	}
+
+	static uint32_t hash(const vehicle_command_s &command)
+	{
+		uint32_t hash = 2166136261u;
+		hash_bytes(hash, &command.source_system, sizeof(command.source_system));
+		hash_bytes(hash, &command.command, sizeof(command.command));
+		hash_bytes(hash, &command.confirmation, sizeof(command.confirmation));
+		hash_bytes(hash, &command.target_system, sizeof(command.target_system));
+		hash_bytes(hash, &command.target_component, sizeof(command.target_component));
+		hash_bytes(hash, &command.param1, sizeof(command.param1));
+		hash_bytes(hash, &command.param2, sizeof(command.param2));
+		hash_bytes(hash, &command.param3, sizeof(command.param3));
+		hash_bytes(hash, &command.param4, sizeof(command.param4));
+		hash_bytes(hash, &command.param5, sizeof(command.param5));
+		hash_bytes(hash, &command.param6, sizeof(command.param6));
+		hash_bytes(hash, &command.param7, sizeof(command.param7));
+		return hash != 0 ? hash : 1;
+	}
+
+	Entry _entries[NUM_ENTRIES] {};
+	px4::atomic<uint32_t> _next{0};
+	px4::atomic<uint32_t> _num_duplicates{0};
+
+	/* do not allow copying or assigning this class */
+	MavlinkCommandDedup(const MavlinkCommandDedup &) = delete;
+	MavlinkCommandDedup operator=(const MavlinkCommandDedup &) = delete;
+};
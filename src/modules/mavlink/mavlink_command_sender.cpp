@@ -73,7 +73,6 @@ int MavlinkCommandSender::handle_vehicle_command(const vehicle_command_s &comman
 		return 0;
 	}
 
-	lock();
 	CMD_DEBUG("new command: %" PRIu32 " (channel: %d)", command.command, channel);
 
 	mavlink_command_long_t msg = {};
@@ -88,8 +87,14 @@ int MavlinkCommandSender::handle_vehicle_command(const vehicle_command_s &comman
 	msg.param5 = command.param5;
 	msg.param6 = command.param6;
 	msg.param7 = command.param7;
+
+	// send outside of the lock, writing to the link can take a while
 	mavlink_msg_command_long_send_struct(channel, &msg);
 
+	lock();
+	process_acks();
+	++_num_sent;
+
 	bool already_existing = false;
 	_commands.reset_to_start();
 
@@ -122,27 +127,65 @@ void MavlinkCommandSender::handle_mavlink_command_ack(const mavlink_command_ack_
 {
 	CMD_DEBUG("handling result %" PRIu8 " for command %" PRIu16 " (from %" PRIu8 ":%" PRIu8 ")",
 		  ack.result, ack.command, from_sysid, from_compid);
-	lock();
 
+	const ack_item_s item{ack.command, from_sysid, from_compid, channel};
+
+	if (_acks.push(item)) {
+		_num_acks_queued.fetch_add(1);
+
+	} else {
+		// queue full: should not happen with the expected ack rates, but never lose an ack
+		_num_acks_direct.fetch_add(1);
+		lock();
+		process_acks();
+		apply_ack(item);
+		unlock();
+	}
+}
+
+void MavlinkCommandSender::apply_ack(const ack_item_s &ack)
+{
 	_commands.reset_to_start();
 
 	while (command_item_s *item = _commands.get_next()) {
 		// Check if the incoming ack matches any of the commands that we have sent.
 		if (item->command.command == ack.command &&
-		    (item->command.target_system == 0 || from_sysid == item->command.target_system) &&
-		    (item->command.target_component == 0 || from_compid == item->command.target_component) &&
-		    item->num_sent_per_channel[channel] != -1) {
-			item->num_sent_per_channel[channel] = -2;	// mark this as acknowledged
+		    (item->command.target_system == 0 || ack.from_sysid == item->command.target_system) &&
+		    (item->command.target_component == 0 || ack.from_compid == item->command.target_component) &&
+		    item->num_sent_per_channel[ack.channel] != -1) {
+			item->num_sent_per_channel[ack.channel] = -2;	// mark this as acknowledged
 			break;
 		}
 	}
+}
+
+void MavlinkCommandSender::process_acks()
+{
+	ack_item_s ack;
+
+	while (_acks.pop(ack)) {
+		apply_ack(ack);
+	}
+}
 
+void MavlinkCommandSender::print_status()
+{
+	lock();
+	printf("\tcommand sender: sent: %" PRIu32 ", retransmitted: %" PRIu32 ", timed out: %" PRIu32 "\n",
+	       _num_sent, _num_retransmissions, _num_timeouts);
 	unlock();
+	printf("\t  acks queued: %" PRIu32 ", applied directly (queue full): %" PRIu32 "\n",
+	       _num_acks_queued.load(), _num_acks_direct.load());
 }
 
 void MavlinkCommandSender::check_timeout(mavlink_channel_t channel)
 {
+	// retransmissions are sent after releasing the lock
+	mavlink_command_long_t to_send[NUM_COMMANDS];
+	int num_to_send = 0;
+
 	lock();
+	process_acks();
 
 	_commands.reset_to_start();
 
@@ -196,7 +239,7 @@ void MavlinkCommandSender::check_timeout(mavlink_channel_t channel)
 		if (item->num_sent_per_channel[channel] < max_sent && item->num_sent_per_channel[channel] != -1) {
 			// We are behind and need to do a retransmission.
 			item->command.confirmation = ++item->num_sent_per_channel[channel];
-			mavlink_msg_command_long_send_struct(channel, &item->command);
+			to_send[num_to_send++] = item->command;
 
 			CMD_DEBUG("command %" PRIu16 " sent (not first, retries: %" PRIu8 "/%" PRIi8 ", channel: %d)",
 				  item->command.command,
@@ -212,12 +255,13 @@ void MavlinkCommandSender::check_timeout(mavlink_channel_t channel)
 			if (item->num_sent_per_channel[channel] + 1 > RETRIES) {
 				CMD_DEBUG("command %" PRIu16 " dropped", item->command.command);
 				_commands.drop_current();
+				++_num_timeouts;
 				continue;
 			}
 
 			// We are the first of a new retransmission series.
 			item->command.confirmation = ++item->num_sent_per_channel[channel];
-			mavlink_msg_command_long_send_struct(channel, &item->command);
+			to_send[num_to_send++] = item->command;
 			// Therefore, we are the ones setting the timestamp of this retry round.
 			item->last_time_sent_us = hrt_absolute_time();
 
@@ -234,5 +278,10 @@ void MavlinkCommandSender::check_timeout(mavlink_channel_t channel)
 		}
 	}
 
+	_num_retransmissions += num_to_send;
 	unlock();
+
+	for (int i = 0; i < num_to_send; ++i) {
+		mavlink_msg_command_long_send_struct(channel, &to_send[i]);
+	}
 }
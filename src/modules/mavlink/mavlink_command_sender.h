@@ -47,6 +47,7 @@
 #include <uORB/topics/vehicle_command.h>
 #include <uORB/topics/vehicle_command_ack.h>
 
+#include "lockfree_queue.h"
 #include "timestamped_list.h"
 #include "mavlink_bridge_header.h"
 
@@ -83,6 +84,8 @@ public:
 	void handle_mavlink_command_ack(const mavlink_command_ack_t &ack, uint8_t from_sysid, uint8_t from_compid,
 					uint8_t channel);
 
+	void print_status();
+
 private:
 	MavlinkCommandSender() = default;
 
@@ -101,6 +104,20 @@ private:
 	static MavlinkCommandSender *_instance;
 	static px4_sem_t _lock;
 
+	/** an incoming command_ack, queued by the receivers and applied by the sending threads */
+	struct ack_item_s {
+		uint16_t command;
+		uint8_t from_sysid;
+		uint8_t from_compid;
+		uint8_t channel;
+	};
+
+	/** mark the command matching an ack as acknowledged, requires the lock */
+	void apply_ack(const ack_item_s &ack);
+
+	/** apply all queued acks, requires the lock */
+	void process_acks();
+
 	struct command_item_s {
 		mavlink_command_long_t command = {};
 		hrt_abstime timestamp_us = 0;
@@ -115,7 +132,17 @@ private:
 #endif
 	};
 
-	TimestampedList<command_item_s, 3> _commands{};
+	static constexpr int NUM_COMMANDS = 3;
+	TimestampedList<command_item_s, NUM_COMMANDS> _commands{};
+
+	// acks are handed over without taking the lock, so a receiver never waits for a sending thread
+	LockFreeQueue<ack_item_s, 16> _acks{};
+
+	px4::atomic<uint32_t> _num_acks_queued{0};
+	px4::atomic<uint32_t> _num_acks_direct{0}; ///< acks applied under the lock because the queue was full
+	uint32_t _num_sent{0};
+	uint32_t _num_retransmissions{0};
+	uint32_t _num_timeouts{0};
 
 	bool _debug_enabled = false;
 	static constexpr uint8_t RETRIES = 3;
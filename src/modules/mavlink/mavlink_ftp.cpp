@@ -34,7 +34,7 @@
 /// @file mavlink_ftp.cpp
 ///	@author px4dev, Don Gagne <don@thegagnes.com>
 
-#include <crc32.h>
+#include <lib/crc/px4_crc.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <fcntl.h>
@@ -42,10 +42,14 @@
 #include <errno.h>
 #include <cstring>
 
+#include <lib/mathlib/mathlib.h>
+
 #include "mavlink_ftp.h"
 #include "mavlink_tests/mavlink_ftp_test.h"
 
 #include "mavlink_main.h"
+#include "mavlink_mission.h"
+#include "mavlink_parameters.h"
 
 using namespace time_literals;
 
@@ -54,25 +58,49 @@ constexpr const char MavlinkFTP::_root_dir[];
 MavlinkFTP::MavlinkFTP(Mavlink &mavlink) :
 	_mavlink(mavlink)
 {
-	// initialize session
-	_session_info.fd = -1;
+	// initialize sessions
+	for (auto &session : _sessions) {
+		session.fd = -1;
+	}
 }
 
 MavlinkFTP::~MavlinkFTP()
 {
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
+	delete[] _read_ahead;
 }
 
 unsigned
 MavlinkFTP::get_size()
 {
-	if (_session_info.stream_download) {
-		return MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+	for (const auto &session : _sessions) {
+		if (session.fd >= 0 && session.stream_download) {
+			return MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+		}
+	}
 
-	} else {
-		return 0;
+	return 0;
+}
+
+void
+MavlinkFTP::print_status() const
+{
+	int open = 0;
+	int streaming = 0;
+
+	for (const auto &session : _sessions) {
+		if (session.fd >= 0) {
+			open++;
+
+			if (session.stream_download) {
+				streaming++;
+			}
+		}
 	}
+
+	printf("	FTP: %d/%d sessions open, %d burst downloads\n", open, kMaxSessions, streaming);
+	printf("	  burst rate: %.1f B/s, total: %" PRIu64 " B\n", (double)_stream_rate, _stream_bytes);
 }
 
 #ifdef MAVLINK_FTP_UNIT_TEST
@@ -503,12 +531,61 @@ MavlinkFTP::_workList(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 {
-	if (_session_info.fd >= 0) {
+	uint8_t session = 0;
+
+	while (session < kMaxSessions && _sessions[session].fd >= 0) {
+		session++;
+	}
+
+	if (session == kMaxSessions) {
 		PX4_ERR("FTP: Open failed - out of sessions");
 		return kErrNoSessionsAvailable;
 	}
 
-	_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
+	bool mission_upload = false;
+
+#ifndef MAVLINK_FTP_UNIT_TEST
+
+	if (_mission_manager && strcmp(_data_as_cstring(payload), MavlinkMissionManager::MISSION_FTP_PATH) == 0) {
+		// virtual file: the active mission for a download, or the upload staging file
+		if (oflag & O_WRONLY) {
+			strncpy(_work_buffer1, MavlinkMissionManager::MISSION_IMPORT_FILE, _work_buffer1_len);
+			mission_upload = true;
+
+		} else {
+			if (_mission_manager->export_mission_file() != PX4_OK) {
+				_our_errno = EIO;
+				return kErrFailErrno;
+			}
+
+			strncpy(_work_buffer1, MavlinkMissionManager::MISSION_EXPORT_FILE, _work_buffer1_len);
+		}
+
+		_work_buffer1[_work_buffer1_len - 1] = '\0';
+
+	} else if (strcmp(_data_as_cstring(payload), MavlinkParametersManager::SNAPSHOT_FTP_PATH) == 0) {
+		// virtual file, generated on request
+		if (MavlinkParametersManager::update_snapshot() != PX4_OK) {
+			_our_errno = EIO;
+			return kErrFailErrno;
+		}
+
+		strncpy(_work_buffer1, MavlinkParametersManager::SNAPSHOT_FILE, _work_buffer1_len);
+		_work_buffer1[_work_buffer1_len - 1] = '\0';
+
+	} else
+#endif // MAVLINK_FTP_UNIT_TEST
+	{
+		_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
+
+#if defined(__PX4_NUTTX) && defined(CONFIG_FS_CROMFS) && !defined(MAVLINK_FTP_UNIT_TEST)
+
+		if (!(oflag & O_WRONLY)) {
+			_useMetadataCache(_work_buffer1, _work_buffer1_len);
+		}
+
+#endif
+	}
 
 	PX4_DEBUG("FTP: open '%s'", _work_buffer1);
 
@@ -541,11 +618,16 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 		return kErrFailErrno;
 	}
 
-	_session_info.fd = fd;
-	_session_info.file_size = fileSize;
-	_session_info.stream_download = false;
+	_sessions[session].fd = fd;
+	_sessions[session].file_size = fileSize;
+	_sessions[session].stream_download = false;
+	_sessions[session].mission_upload = mission_upload;
+
+	if (_read_ahead_session == session) {
+		_read_ahead_session = -1;
+	}
 
-	payload->session = 0;
+	payload->session = session;
 	payload->size = sizeof(uint32_t);
 	std::memcpy(payload->data, &fileSize, payload->size);
 
@@ -556,31 +638,24 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workRead(PayloadHeader *payload)
 {
-	if (payload->session != 0 || _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("FTP: read offset:%ld" PRIu32, payload->offset);
 
 	// We have to test seek past EOF ourselves, lseek will allow seek past EOF
-	if (payload->offset >= _session_info.file_size) {
+	if (payload->offset >= session->file_size) {
 		PX4_WARN("request past EOF");
 		return kErrEOF;
 	}
 
-	PX4_DEBUG("lseek with offset: %ld", payload->offset);
-
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-		_our_errno = errno;
-		PX4_ERR("seek fail: %s", strerror(_our_errno));
-		return kErrFailErrno;
-	}
-
-	int bytes_read = ::read(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_read = _readSession(payload->session, payload->offset, &payload->data[0], payload->size);
 
 	if (bytes_read < 0) {
 		// Negative return indicates error other than eof
-		_our_errno = errno;
 		PX4_ERR("read fail %d, %s", bytes_read, strerror(_our_errno));
 		return kErrFailErrno;
 	}
@@ -594,19 +669,21 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id)
 {
-	if (payload->session != 0 && _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		PX4_DEBUG("_workBurst: no session or no fd");
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("FTP: burst offset:%" PRIu32, payload->offset);
 	// Setup for streaming sends
-	_session_info.stream_download = true;
-	_session_info.stream_offset = payload->offset;
-	_session_info.stream_chunk_transmitted = 0;
-	_session_info.stream_seq_number = payload->seq_number + 1;
-	_session_info.stream_target_system_id = target_system_id;
-	_session_info.stream_target_component_id = target_component_id;
+	session->stream_download = true;
+	session->stream_offset = payload->offset;
+	session->stream_chunk_transmitted = 0;
+	session->stream_seq_number = payload->seq_number + 1;
+	session->stream_target_system_id = target_system_id;
+	session->stream_target_component_id = target_component_id;
 
 	return kErrNone;
 }
@@ -615,7 +692,9 @@ MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workWrite(PayloadHeader *payload)
 {
-	if (payload->session != 0 && _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		PX4_DEBUG("_workWrite: no session or no fd");
 		return kErrInvalidSession;
 	}
@@ -624,14 +703,18 @@ MavlinkFTP::_workWrite(PayloadHeader *payload)
 		return kErrFailFileProtected;
 	}
 
-	if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
+	if (_read_ahead_session == payload->session) {
+		_read_ahead_session = -1;
+	}
+
+	if (lseek(session->fd, payload->offset, SEEK_SET) < 0) {
 		// Unable to see to the specified location
 		PX4_ERR("seek fail");
 		return kErrFailErrno;
 	}
 
 	PX4_DEBUG("write %d bytes", payload->size);
-	int bytes_written = ::write(_session_info.fd, &payload->data[0], payload->size);
+	int bytes_written = ::write(session->fd, &payload->data[0], payload->size);
 
 	if (bytes_written < 0) {
 		// Negative return indicates error other than eof
@@ -790,14 +873,24 @@ MavlinkFTP::_workTruncateFile(PayloadHeader *payload)
 MavlinkFTP::ErrorCode
 MavlinkFTP::_workTerminate(PayloadHeader *payload)
 {
-	if (payload->session != 0 || _session_info.fd < 0) {
+	SessionInfo *session = _getSession(payload->session);
+
+	if (session == nullptr) {
 		return kErrInvalidSession;
 	}
 
 	PX4_DEBUG("work terminate: close");
-	::close(_session_info.fd);
-	_session_info.fd = -1;
-	_session_info.stream_download = false;
+	_closeSession(payload->session);
+
+#ifndef MAVLINK_FTP_UNIT_TEST
+
+	// a completed mission upload: load it, a broken file is reported back to the client
+	if (session->mission_upload && _mission_manager && (_mission_manager->import_mission_file() != PX4_OK)) {
+		_our_errno = EINVAL;
+		return kErrFailErrno;
+	}
+
+#endif // MAVLINK_FTP_UNIT_TEST
 
 	payload->size = 0;
 
@@ -810,10 +903,8 @@ MavlinkFTP::_workReset(PayloadHeader *payload)
 {
 	PX4_DEBUG("work reset: close");
 
-	if (_session_info.fd != -1) {
-		::close(_session_info.fd);
-		_session_info.fd = -1;
-		_session_info.stream_download = false;
+	for (uint8_t session = 0; session < kMaxSessions; session++) {
+		_closeSession(session);
 	}
 
 	payload->size = 0;
@@ -923,7 +1014,7 @@ MavlinkFTP::_workCalcFileCRC32(PayloadHeader *payload)
 			return kErrFailErrno;
 		}
 
-		checksum = crc32part((uint8_t *)_work_buffer2, bytes_read, checksum);
+		checksum = px4_crc32(checksum, (uint8_t *)_work_buffer2, bytes_read);
 	} while (bytes_read == _work_buffer2_len);
 
 	::close(fd);
@@ -933,6 +1024,116 @@ MavlinkFTP::_workCalcFileCRC32(PayloadHeader *payload)
 	return kErrNone;
 }
 
+MavlinkFTP::SessionInfo *
+MavlinkFTP::_getSession(uint8_t session)
+{
+	if (session < kMaxSessions && _sessions[session].fd >= 0) {
+		return &_sessions[session];
+	}
+
+	return nullptr;
+}
+
+void
+MavlinkFTP::_closeSession(uint8_t session)
+{
+	if (_sessions[session].fd >= 0) {
+		::close(_sessions[session].fd);
+		_sessions[session].fd = -1;
+	}
+
+	_sessions[session].stream_download = false;
+
+	if (_read_ahead_session == session) {
+		_read_ahead_session = -1;
+	}
+}
+
+int
+MavlinkFTP::_readSession(uint8_t session, uint32_t offset, uint8_t *dst, size_t len)
+{
+	const int fd = _sessions[session].fd;
+
+	if (kReadAheadLen > 0 && _read_ahead == nullptr) {
+		_read_ahead = new uint8_t[kReadAheadLen];
+	}
+
+	if (_read_ahead == nullptr) {
+		// no read-ahead, read directly
+		if (lseek(fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		const int bytes_read = ::read(fd, dst, len);
+
+		if (bytes_read < 0) {
+			_our_errno = errno;
+		}
+
+		return bytes_read;
+	}
+
+	// refill the buffer from the requested offset, unless it already holds the data
+	if ((_read_ahead_session != session) || (offset < _read_ahead_offset)
+	    || (offset + len > _read_ahead_offset + _read_ahead_len)) {
+
+		_read_ahead_session = -1;
+
+		if (lseek(fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		const int bytes_read = ::read(fd, _read_ahead, kReadAheadLen);
+
+		if (bytes_read < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		_read_ahead_session = session;
+		_read_ahead_offset = offset;
+		_read_ahead_len = bytes_read;
+	}
+
+	const size_t available = math::min(len, (size_t)(_read_ahead_offset + _read_ahead_len - offset));
+	memcpy(dst, &_read_ahead[offset - _read_ahead_offset], available);
+
+	return available;
+}
+
+int
+MavlinkFTP::_nextStreamSession()
+{
+	for (int i = 1; i <= kMaxSessions; i++) {
+		const int session = (_stream_session + i) % kMaxSessions;
+
+		if (_sessions[session].fd >= 0 && _sessions[session].stream_download) {
+			_stream_session = session;
+			return session;
+		}
+	}
+
+	return -1;
+}
+
+unsigned
+MavlinkFTP::_burstWindow() const
+{
+#if defined(MAVLINK_UDP) && !defined(MAVLINK_FTP_UNIT_TEST)
+
+	// network links are fast, so fewer round-trips between the bursts matter more
+	if (_mavlink.get_protocol() == Protocol::UDP) {
+		return 350000;
+	}
+
+#endif
+
+	/* perform transfers in 35K chunks - this is determined empirical */
+	return 35000;
+}
+
 /// @brief Guarantees that the payload data is null terminated.
 ///     @return Returns a pointer to the payload data as a char *
 char *
@@ -1010,6 +1211,74 @@ MavlinkFTP::_copy_file(const char *src_path, const char *dst_path, size_t length
 	return (length > 0) ? -1 : 0;
 }
 
+#if defined(__PX4_NUTTX) && defined(CONFIG_FS_CROMFS)
+void
+MavlinkFTP::_useMetadataCache(char *path, int path_len)
+{
+	static constexpr const char extras_dir[] = PX4_ROOTFSDIR "/etc/extras/";
+	static constexpr const char cache_dir[] = PX4_STORAGEDIR "/metadata_cache";
+	static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+	static bool cache_cleared = false;
+
+	const char *file_name = path + sizeof(extras_dir) - 1;
+
+	if ((strncmp(path, extras_dir, sizeof(extras_dir) - 1) != 0) || (strchr(file_name, '/') != nullptr)) {
+		return;
+	}
+
+	char cache_path[128];
+
+	if (snprintf(cache_path, sizeof(cache_path), "%s/%s", cache_dir, file_name) >= (int)sizeof(cache_path)) {
+		return;
+	}
+
+	pthread_mutex_lock(&cache_mutex);
+
+	if (!cache_cleared) {
+		// copies from an earlier boot might belong to a different firmware
+		DIR *dp = opendir(cache_dir);
+
+		if (dp) {
+			struct dirent *result;
+			char stale_path[128];
+
+			while ((result = readdir(dp)) != nullptr) {
+				if ((result->d_type == DTYPE_FILE)
+				    && (snprintf(stale_path, sizeof(stale_path), "%s/%s", cache_dir, result->d_name)
+					< (int)sizeof(stale_path))) {
+					unlink(stale_path);
+				}
+			}
+
+			closedir(dp);
+
+		} else {
+			mkdir(cache_dir, S_IRWXU | S_IRWXG | S_IRWXO);
+		}
+
+		cache_cleared = true;
+	}
+
+	struct stat st;
+	bool cached = (stat(cache_path, &st) == 0);
+
+	if (!cached && (stat(path, &st) == 0)) {
+		cached = (_copy_file(path, cache_path, st.st_size) == 0);
+
+		if (!cached) {
+			unlink(cache_path);
+		}
+	}
+
+	pthread_mutex_unlock(&cache_mutex);
+
+	if (cached) {
+		strncpy(path, cache_path, path_len);
+		path[path_len - 1] = '\0';
+	}
+}
+#endif // __PX4_NUTTX && CONFIG_FS_CROMFS
+
 void MavlinkFTP::send()
 {
 
@@ -1025,21 +1294,40 @@ void MavlinkFTP::send()
 				delete[] _work_buffer2;
 				_work_buffer2 = nullptr;
 			}
+
+			if (_read_ahead && get_size() == 0) {
+				delete[] _read_ahead;
+				_read_ahead = nullptr;
+				_read_ahead_session = -1;
+			}
 		}
 
-	} else if (_session_info.fd != -1) {
-		// close session without activity
-		if (hrt_elapsed_time(&_last_work_buffer_access) > 10_s) {
-			::close(_session_info.fd);
-			_session_info.fd = -1;
-			_session_info.stream_download = false;
-			_last_reply_valid = false;
-			PX4_WARN("Session was closed without activity");
+	} else if (hrt_elapsed_time(&_last_work_buffer_access) > 10_s) {
+		// close sessions without activity
+		for (uint8_t session = 0; session < kMaxSessions; session++) {
+			if (_sessions[session].fd != -1) {
+				_closeSession(session);
+				_last_reply_valid = false;
+				PX4_WARN("Session was closed without activity");
+			}
+		}
+	}
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if (now > _stream_rate_timestamp + 1_s) {
+		if (_stream_rate_timestamp != 0) {
+			_stream_rate = _stream_rate_bytes / ((now - _stream_rate_timestamp) * 1e-6f);
 		}
+
+		_stream_rate_bytes = 0;
+		_stream_rate_timestamp = now;
 	}
 
 	// Anything to stream?
-	if (!_session_info.stream_download) {
+	int session_index = _nextStreamSession();
+
+	if (session_index < 0) {
 		return;
 	}
 
@@ -1062,34 +1350,28 @@ void MavlinkFTP::send()
 		more_data = false;
 
 		ErrorCode error_code = kErrNone;
+		SessionInfo &session = _sessions[session_index];
 
 		mavlink_file_transfer_protocol_t ftp_msg;
 		PayloadHeader *payload = reinterpret_cast<PayloadHeader *>(&ftp_msg.payload[0]);
 
-		payload->seq_number = _session_info.stream_seq_number;
-		payload->session = 0;
+		payload->seq_number = session.stream_seq_number;
+		payload->session = session_index;
 		payload->opcode = kRspAck;
 		payload->req_opcode = kCmdBurstReadFile;
-		payload->offset = _session_info.stream_offset;
-		_session_info.stream_seq_number++;
+		payload->offset = session.stream_offset;
+		session.stream_seq_number++;
 
-		PX4_DEBUG("stream send: offset %" PRIu32, _session_info.stream_offset);
+		PX4_DEBUG("stream send: offset %" PRIu32, session.stream_offset);
 
 		// We have to test seek past EOF ourselves, lseek will allow seek past EOF
-		if (_session_info.stream_offset >= _session_info.file_size) {
+		if (session.stream_offset >= session.file_size) {
 			error_code = kErrEOF;
 			PX4_DEBUG("stream download: sending Nak EOF");
 		}
 
 		if (error_code == kErrNone) {
-			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: seek fail");
-			}
-		}
-
-		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+			int bytes_read = _readSession(session_index, payload->offset, &payload->data[0], kMaxDataLength);
 
 			if (bytes_read < 0) {
 				// Negative return indicates error other than eof
@@ -1098,8 +1380,10 @@ void MavlinkFTP::send()
 
 			} else {
 				payload->size = bytes_read;
-				_session_info.stream_offset += bytes_read;
-				_session_info.stream_chunk_transmitted += bytes_read;
+				session.stream_offset += bytes_read;
+				session.stream_chunk_transmitted += bytes_read;
+				_stream_bytes += bytes_read;
+				_stream_rate_bytes += bytes_read;
 			}
 		}
 
@@ -1114,7 +1398,7 @@ void MavlinkFTP::send()
 				payload->data[1] = _our_errno;
 			}
 
-			_session_info.stream_download = false;
+			session.stream_download = false;
 
 		} else {
 #ifndef MAVLINK_FTP_UNIT_TEST
@@ -1122,11 +1406,10 @@ void MavlinkFTP::send()
 			if (max_bytes_to_send < (get_size() * 2)) {
 				more_data = false;
 
-				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
+				if (session.stream_chunk_transmitted > _burstWindow()) {
 					payload->burst_complete = true;
-					_session_info.stream_download = false;
-					_session_info.stream_chunk_transmitted = 0;
+					session.stream_download = false;
+					session.stream_chunk_transmitted = 0;
 				}
 
 			} else {
@@ -1140,10 +1423,16 @@ void MavlinkFTP::send()
 #endif
 		}
 
-		ftp_msg.target_system = _session_info.stream_target_system_id;
+		ftp_msg.target_system = session.stream_target_system_id;
 		ftp_msg.target_network = 0;
-		ftp_msg.target_component = _session_info.stream_target_component_id;
+		ftp_msg.target_component = session.stream_target_component_id;
 		_reply(&ftp_msg);
+
+		// interleave the packets of concurrent burst downloads
+		if (more_data) {
+			session_index = _nextStreamSession();
+			more_data = (session_index >= 0);
+		}
 	} while (more_data);
 }
 
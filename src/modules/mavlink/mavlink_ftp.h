@@ -47,6 +47,7 @@
 
 class MavlinkFtpTest;
 class Mavlink;
+class MavlinkMissionManager;
 
 /// MAVLink remote file server. Support FTP like commands using MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL message.
 class MavlinkFTP
@@ -71,6 +72,9 @@ public:
 	///	@param worker_data Data to pass to worker
 	void set_unittest_worker(ReceiveMessageFunc_t rcvMsgFunc, void *worker_data);
 
+	/// @brief Set the mission manager serving the packed mission file (MavlinkMissionManager::MISSION_FTP_PATH)
+	void set_mission_manager(MavlinkMissionManager *mission_manager) { _mission_manager = mission_manager; }
+
 	/// @brief This is the payload which is in mavlink_file_transfer_protocol_t.payload.
 	/// This needs to be packed, because it's typecasted from mavlink_file_transfer_protocol_t.payload, which starts
 	/// at a 3 byte offset, causing an unaligned access to seq_number and offset
@@ -126,6 +130,11 @@ public:
 
 	unsigned get_size();
 
+	/**
+	 * Display the session and throughput status
+	 */
+	void print_status() const;
+
 private:
 	char		*_data_as_cstring(PayloadHeader *payload);
 
@@ -147,6 +156,35 @@ private:
 	ErrorCode	_workRename(PayloadHeader *payload);
 	ErrorCode	_workCalcFileCRC32(PayloadHeader *payload);
 
+	struct SessionInfo;
+
+	/**
+	 * @return the open session with the given id, nullptr if the session is invalid
+	 */
+	SessionInfo	*_getSession(uint8_t session);
+
+	/**
+	 * Close a session and drop its read-ahead data
+	 */
+	void		_closeSession(uint8_t session);
+
+	/**
+	 * Read file data of a session, served from the read-ahead buffer if possible.
+	 * @return number of bytes read, -1 on error (_our_errno is set)
+	 */
+	int		_readSession(uint8_t session, uint32_t offset, uint8_t *dst, size_t len);
+
+	/**
+	 * Select the next session with an active burst download (round robin)
+	 * @return session id, -1 if there is none
+	 */
+	int		_nextStreamSession();
+
+	/**
+	 * @return number of bytes sent in one burst before the client has to request the next one
+	 */
+	unsigned	_burstWindow() const;
+
 	uint8_t _getServerSystemId(void);
 	uint8_t _getServerComponentId(void);
 	uint8_t _getServerChannel(void);
@@ -158,6 +196,16 @@ private:
 
 	bool _validatePathIsWritable(const char *path);
 
+#if defined(__PX4_NUTTX) && defined(CONFIG_FS_CROMFS)
+	/**
+	 * Redirect a read of a metadata file in the compressed ROMFS (/etc/extras) to a plain copy
+	 * on the storage. The copy is made on the first request after boot, so the image is only
+	 * decompressed once per file, no matter how often and in how many sessions it is downloaded.
+	 * The path is left untouched if the file cannot be cached.
+	 */
+	void _useMetadataCache(char *path, int path_len);
+#endif
+
 	/**
 	 * make sure that the working buffers _work_buffer* are allocated
 	 * @return true if buffers exist, false if allocation failed
@@ -180,13 +228,39 @@ private:
 		uint8_t		stream_target_system_id;
 		uint8_t         stream_target_component_id;
 		unsigned	stream_chunk_transmitted;
+		bool		mission_upload;		///< imported as mission when the session is terminated
 	};
-	struct SessionInfo _session_info {};	///< Session info, fd=-1 for no active session
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr int kMaxSessions = 1;
+	static constexpr int kReadAheadLen = 0;
+#elif defined(__PX4_NUTTX)
+	static constexpr int kMaxSessions = 2;
+	static constexpr int kReadAheadLen = 2048;
+#else
+	static constexpr int kMaxSessions = 4;
+	static constexpr int kReadAheadLen = 16384;
+#endif
+
+	struct SessionInfo _sessions[kMaxSessions] {};	///< Session info, fd=-1 for no active session
+	int _stream_session{0};				///< last session served by a burst download
+
+	/* read-ahead buffer for file reads, allocated on the first read (if kReadAheadLen > 0) */
+	uint8_t *_read_ahead{nullptr};
+	int _read_ahead_session{-1};			///< session the buffered data belongs to, -1 for none
+	uint32_t _read_ahead_offset{0};
+	int _read_ahead_len{0};
+
+	/* burst download throughput */
+	uint64_t _stream_bytes{0};
+	uint32_t _stream_rate_bytes{0};
+	float _stream_rate{0.f};			///< [B/s]
+	hrt_abstime _stream_rate_timestamp{0};
 
 	ReceiveMessageFunc_t	_utRcvMsgFunc{};	///< Unit test override for mavlink message sending
 	void			*_worker_data{nullptr};	///< Additional parameter to _utRcvMsgFunc;
 
 	Mavlink &_mavlink;
+	MavlinkMissionManager *_mission_manager{nullptr};
 
 	/* do not allow copying this class */
 	MavlinkFTP(const MavlinkFTP &);
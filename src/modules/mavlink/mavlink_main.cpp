@@ -102,6 +102,9 @@ Mavlink::Mavlink() :
 	ModuleParams(nullptr),
 	_receiver(*this)
 {
+	px4_sem_init(&_main_loop_sem, 0, 0);
+	px4_sem_setprotocol(&_main_loop_sem, SEM_PRIO_NONE);
+
 	// initialise parameter cache
 	mavlink_update_parameters();
 
@@ -135,6 +138,7 @@ Mavlink::Mavlink() :
 
 	_event_sub.subscribe();
 	_telemetry_status_pub.advertise();
+	_link_stats_pub.advertise();
 }
 
 Mavlink::~Mavlink()
@@ -178,8 +182,11 @@ Mavlink::~Mavlink()
 
 	perf_free(_loop_perf);
 	perf_free(_loop_interval_perf);
+	perf_free(_loop_triggered_perf);
 	perf_free(_send_byte_error_perf);
 	perf_free(_forwarding_error_perf);
+
+	px4_sem_destroy(&_main_loop_sem);
 }
 
 void
@@ -712,6 +719,9 @@ Mavlink::get_free_tx_buf()
 
 #if defined(__PX4_NUTTX)
 		(void) ioctl(_uart_fd, FIONSPACE, (unsigned long)&buf_free);
+
+		// account for the packets not yet written
+		buf_free = math::max(buf_free - (int)_buf_fill, 0);
 #else
 		// No FIONSPACE on Linux todo:use SIOCOUTQ  and queue size to emulate FIONSPACE
 		//Linux cp210x does not support TIOCOUTQ
@@ -735,11 +745,40 @@ Mavlink::get_free_tx_buf()
 	return buf_free;
 }
 
+unsigned
+Mavlink::get_tx_queue_depth()
+{
+	int queued = 0;
+
+#if defined(__PX4_NUTTX)
+
+	if (get_protocol() == Protocol::SERIAL) {
+		(void) ioctl(_uart_fd, FIONWRITE, (unsigned long)&queued);
+	}
+
+#elif defined(__PX4_LINUX)
+	// TIOCOUTQ is the same as SIOCOUTQ for sockets; not all USB serial drivers support it
+	const int fd = (get_protocol() == Protocol::SERIAL) ? _uart_fd : _socket_fd;
+
+	if (fd >= 0 && ioctl(fd, TIOCOUTQ, &queued) != 0) {
+		queued = 0;
+	}
+
+#endif
+
+	return math::max(queued, 0);
+}
+
 void Mavlink::send_start(int length)
 {
 	pthread_mutex_lock(&_send_mutex);
 	_last_write_try_time = hrt_absolute_time();
 
+	// make room for the packet if the batch is full
+	if (_buf_fill + length > sizeof(_buf)) {
+		flush_tx_buffer();
+	}
+
 	// check if there is space in the buffer
 	if (length > (int)get_free_tx_buf()) {
 		// not enough space in buffer to send
@@ -752,18 +791,53 @@ void Mavlink::send_start(int length)
 
 	} else {
 		_tx_buffer_low = false;
+
+		// all sent data uses up link bandwidth
+		if (_tx_tokens_max > 0.f) {
+			_tx_tokens = fmaxf(_tx_tokens - length, -_tx_tokens_max);
+		}
 	}
 }
 
 void Mavlink::send_finish()
 {
-	if (_tx_buffer_low || (_buf_fill == 0)) {
-		pthread_mutex_unlock(&_send_mutex);
+	if (!_tx_buffer_low) {
+		_buf_messages++;
+	}
+
+	if (!_tx_batch) {
+		flush_tx_buffer();
+	}
+
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::begin_tx_batch()
+{
+	pthread_mutex_lock(&_send_mutex);
+	_tx_batch = true;
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::end_tx_batch()
+{
+	pthread_mutex_lock(&_send_mutex);
+	_tx_batch = false;
+	flush_tx_buffer();
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+void Mavlink::flush_tx_buffer()
+{
+	if (_buf_fill == 0) {
 		return;
 	}
 
 	int ret = -1;
 
+	_tx_queue_depth_max = math::max(_tx_queue_depth_max, get_tx_queue_depth());
+	const hrt_abstime write_start = hrt_absolute_time();
+
 	// send message to UART
 	if (get_protocol() == Protocol::SERIAL) {
 		ret = ::write(_uart_fd, _buf, _buf_fill);
@@ -809,24 +883,31 @@ void Mavlink::send_finish()
 
 #endif // MAVLINK_UDP
 
+	const uint32_t write_time = hrt_elapsed_time(&write_start);
+	_tx_write_time_max = math::max(_tx_write_time_max, write_time);
+	_tx_write_time_total += write_time;
+	_tx_write_count++;
+
 	if (ret == (int)_buf_fill) {
-		_tstatus.tx_message_count++;
+		_tstatus.tx_message_count += _buf_messages;
 		count_txbytes(_buf_fill);
 		_last_write_success_time = _last_write_try_time;
 
+		_tx_writes++;
+		_tx_write_bytes += _buf_fill;
+
 	} else {
 		count_txerrbytes(_buf_fill);
 	}
 
 	_buf_fill = 0;
-
-	pthread_mutex_unlock(&_send_mutex);
+	_buf_messages = 0;
 }
 
 void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
 {
 	if (!_tx_buffer_low) {
-		if (_buf_fill + packet_len < sizeof(_buf)) {
+		if (_buf_fill + packet_len <= sizeof(_buf)) {
 			memcpy(&_buf[_buf_fill], buf, packet_len);
 			_buf_fill += packet_len;
 
@@ -1005,6 +1086,15 @@ void Mavlink::init_udp()
 		return;
 	}
 
+# if defined(__PX4_LINUX)
+
+	// kernel (or NIC) receive timestamps for the timesync, falls back to the time of handling without
+	if (!Timesync::enable_rx_timestamping(_socket_fd)) {
+		PX4_DEBUG("rx timestamping unavailable: %s", strerror(errno));
+	}
+
+# endif // __PX4_LINUX
+
 	/* set default target address, but not for onboard mode (will be set on first received packet) */
 	if (!_src_addr_initialized) {
 		_src_addr.sin_family = AF_INET;
@@ -1204,8 +1294,9 @@ Mavlink::configure_stream(const char *stream_name, const float rate)
 	}
 
 	// if we reach here, the stream list does not contain the stream.
-	// flash constrained target's don't include all streams, and some are only available for the development dialect
-#if defined(CONSTRAINED_FLASH) || !defined(MAVLINK_DEVELOPMENT_H)
+	// flash constrained target's don't include all streams, some can be excluded by the board configuration
+	// and some are only available for the development dialect
+#if defined(CONSTRAINED_FLASH) || !defined(MAVLINK_DEVELOPMENT_H) || defined(MAVLINK_STREAMS_PRUNED)
 	return PX4_OK;
 #else
 	PX4_WARN("stream %s not found", stream_name);
@@ -1293,15 +1384,17 @@ void
 Mavlink::update_rate_mult()
 {
 	float const_rate = 0.0f;
-	float rate = 0.0f;
+	float rate[MavlinkStream::NUM_PRIORITIES] {};
 
 	/* scale down rates if their theoretical bandwidth is exceeding the link bandwidth */
 	for (const auto &stream : _streams) {
+		const float stream_rate = (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+
 		if (stream->const_rate()) {
-			const_rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			const_rate += stream_rate;
 
 		} else {
-			rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			rate[(int)stream->get_priority()] += stream_rate;
 		}
 	}
 
@@ -1311,14 +1404,6 @@ Mavlink::update_rate_mult()
 		mavlink_ulog_streaming_rate_inv = 1.0f - _mavlink_ulog->current_data_rate();
 	}
 
-	/* scale up and down as the link permits */
-	float bandwidth_mult = (float)(_datarate * mavlink_ulog_streaming_rate_inv - const_rate) / rate;
-
-	/* if we do not have flow control, limit to the set data rate */
-	if (!get_flow_control_enabled()) {
-		bandwidth_mult = fminf(1.0f, bandwidth_mult);
-	}
-
 	float hardware_mult = 1.0f;
 	bool log_radio_timeout = false;
 
@@ -1346,15 +1431,82 @@ Mavlink::update_rate_mult()
 
 	pthread_mutex_unlock(&_radio_status_mutex);
 
+	// a congested link also reduces the rate of our log stream, independently of the other sessions
+	if (_mavlink_ulog) {
+		_mavlink_ulog->set_link_quality(hardware_mult);
+	}
+
 	if (log_radio_timeout) {
 		PX4_ERR("instance %d: RADIO_STATUS timeout", _instance_id);
 	}
 
-	/* pick the minimum from bandwidth mult and hardware mult as limit */
-	_rate_mult = fminf(bandwidth_mult, hardware_mult);
+	/* the link bandwidth, reduced if the hardware reports congestion */
+	const float bandwidth = _datarate * mavlink_ulog_streaming_rate_inv * hardware_mult;
+
+	/* assign what is left after the constant rate streams by priority, highest first */
+	float bandwidth_left = bandwidth - const_rate;
+	float rate_total = 0.f;
+	float rate_assigned = 0.f;
+
+	for (int priority = MavlinkStream::NUM_PRIORITIES - 1; priority >= 0; priority--) {
+		float mult = (rate[priority] > 0.f) ? fmaxf(bandwidth_left, 0.f) / rate[priority] : 1.0f;
+
+		/* ensure the rate multiplier never drops below 5% so that something is always sent */
+		mult = math::constrain(mult, 0.05f, 1.0f);
+
+		_rate_mult_priority[priority] = mult;
+		bandwidth_left -= rate[priority] * mult;
+
+		rate_total += rate[priority];
+		rate_assigned += rate[priority] * mult;
+	}
+
+	_rate_mult = (rate_total > 0.f) ? math::constrain(rate_assigned / rate_total, 0.05f, 1.0f) : 1.0f;
 
-	/* ensure the rate multiplier never drops below 5% so that something is always sent */
-	_rate_mult = math::constrain(_rate_mult, 0.05f, 1.0f);
+	/* with flow control the link throttles itself, otherwise limit the actual traffic to the set data rate
+	 * (including the ulog streaming, which uses up tokens as it sends) */
+	_tx_bandwidth = get_flow_control_enabled() ? 0.f : _datarate * hardware_mult;
+}
+
+void
+Mavlink::update_tx_tokens(const hrt_abstime &t)
+{
+	pthread_mutex_lock(&_send_mutex);
+
+	if (_tx_bandwidth > 0.f) {
+		// allow bursts of up to 100 ms, but at least two full packets
+		_tx_tokens_max = fmaxf(_tx_bandwidth * 0.1f, 2 * MAVLINK_MAX_PACKET_LEN);
+
+		if (_tx_tokens_timestamp != 0) {
+			const float dt = math::constrain((t - _tx_tokens_timestamp) * 1e-6f, 0.f, 1.f);
+			_tx_tokens = math::constrain(_tx_tokens + _tx_bandwidth * dt, -_tx_tokens_max, _tx_tokens_max);
+
+		} else {
+			_tx_tokens = _tx_tokens_max;
+		}
+
+	} else {
+		_tx_tokens_max = 0.f;
+		_tx_tokens = 0.f;
+	}
+
+	_tx_tokens_timestamp = t;
+
+	pthread_mutex_unlock(&_send_mutex);
+}
+
+bool
+Mavlink::tx_bandwidth_available(unsigned size, MavlinkStream::Priority priority) const
+{
+	if ((_tx_tokens_max <= 0.f) || (priority == MavlinkStream::Priority::High)) {
+		return true;
+	}
+
+	if (priority == MavlinkStream::Priority::Low) {
+		return _tx_tokens >= size + _tx_tokens_max * 0.5f;
+	}
+
+	return _tx_tokens >= size;
 }
 
 void
@@ -1819,6 +1971,27 @@ Mavlink::configure_streams_to_default(const char *configure_single_stream)
 	return ret;
 }
 
+bool
+Mavlink::wait_main_loop()
+{
+	struct timespec ts;
+#if defined(__PX4_NUTTX)
+	px4_clock_gettime(CLOCK_REALTIME, &ts);
+#else
+	// lockstep aware, see px4_poll()
+	px4_clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+
+	const unsigned billion = (1000 * 1000 * 1000);
+	uint64_t nsecs = ts.tv_nsec + (uint64_t)_main_loop_delay * 1000;
+	ts.tv_sec += nsecs / billion;
+	ts.tv_nsec = nsecs % billion;
+
+	const bool woken = (px4_sem_timedwait(&_main_loop_sem, &ts) == 0);
+	_main_loop_wakeup_pending.store(false);
+	return woken;
+}
+
 int
 Mavlink::task_main(int argc, char *argv[])
 {
@@ -2291,8 +2464,10 @@ Mavlink::task_main(int argc, char *argv[])
 	_task_running.store(true);
 
 	while (!should_exit()) {
-		/* main loop */
-		px4_usleep(_main_loop_delay);
+		/* main loop: run once per period, or earlier if the topic of a triggered stream got published */
+		if (wait_main_loop()) {
+			perf_count(_loop_triggered_perf);
+		}
 
 		if (!should_transmit()) {
 			check_requested_subscriptions();
@@ -2305,9 +2480,13 @@ Mavlink::task_main(int argc, char *argv[])
 		perf_count(_loop_interval_perf);
 		perf_begin(_loop_perf);
 
+		// write all packets of this iteration at once
+		begin_tx_batch();
+
 		const hrt_abstime t = hrt_absolute_time();
 
 		update_rate_mult();
+		update_tx_tokens(t);
 
 		// check for parameter updates
 		if (_parameter_update_sub.updated()) {
@@ -2365,7 +2544,7 @@ Mavlink::task_main(int argc, char *argv[])
 			const int ret = _mavlink_ulog->handle_update(get_channel());
 
 			if (ret < 0) { // abort the streaming on error
-				if (ret != -1) {
+				if (ret != -1 && ret != -ECANCELED) {
 					PX4_WARN("mavlink ulog stream update failed, stopping (%i)", ret);
 				}
 
@@ -2443,6 +2622,8 @@ Mavlink::task_main(int argc, char *argv[])
 			publish_telemetry_status();
 		}
 
+		end_tx_batch();
+
 		perf_end(_loop_perf);
 	}
 
@@ -2743,6 +2924,35 @@ void Mavlink::publish_telemetry_status()
 	_tstatus.timestamp = hrt_absolute_time();
 	_telemetry_status_pub.publish(_tstatus);
 	_tstatus_updated = false;
+
+	publish_link_stats();
+}
+
+void Mavlink::publish_link_stats()
+{
+	// the round trip time fields are populated in place by the receiver (MavlinkTimesync)
+
+	{
+		// the TX buffer is also flushed from the receiver thread
+		LockGuard lg{_send_mutex};
+
+		_link_stats.tx_queue_depth_max = _tx_queue_depth_max;
+		_link_stats.tx_write_count = _tx_write_count;
+		_link_stats.tx_write_time_avg = (_tx_write_count > 0) ? (float)_tx_write_time_total / _tx_write_count : 0.f;
+		_link_stats.tx_write_time_max = _tx_write_time_max;
+
+		_tx_queue_depth_max = 0;
+		_tx_write_count = 0;
+		_tx_write_time_max = 0;
+		_tx_write_time_total = 0;
+	}
+
+	_receiver.get_message_statistics(_link_stats);
+
+	_link_stats.timestamp = hrt_absolute_time();
+	_link_stats_pub.publish(_link_stats);
+
+	_link_stats.rtt_max = 0.f;
 }
 
 void Mavlink::configure_sik_radio()
@@ -2935,6 +3145,7 @@ Mavlink::display_status()
 	printf("\trates:\n");
 	printf("\t  tx: %.1f B/s\n", (double)_tstatus.tx_rate_avg);
 	printf("\t  txerr: %.1f B/s\n", (double)_tstatus.tx_error_rate_avg);
+	printf("\t  tx bytes per write: %.1f\n", _tx_writes > 0 ? (double)_tx_write_bytes / _tx_writes : 0.);
 	printf("\t  tx rate mult: %.3f\n", (double)_rate_mult);
 	printf("\t  tx rate max: %i B/s\n", _datarate);
 	printf("\t  rx: %.1f B/s\n", (double)_tstatus.rx_rate_avg);
@@ -2945,13 +3156,19 @@ Mavlink::display_status()
 #endif // !CONSTRAINED_FLASH
 
 	if (_mavlink_ulog) {
-		printf("\tULog rate: %.1f%% of max %.1f%%\n", (double)_mavlink_ulog->current_data_rate() * 100.,
-		       (double)_mavlink_ulog->maximum_data_rate() * 100.);
+		_mavlink_ulog->print_status();
 	}
 
+	MavlinkCommandSender::instance().print_status();
+	printf("\t  duplicate commands ignored: %" PRIu32 "\n", MavlinkReceiver::num_duplicate_commands());
+
 	printf("\tFTP enabled: %s, TX enabled: %s\n",
 	       _ftp_on ? "YES" : "NO",
 	       _transmitting_enabled ? "YES" : "NO");
+
+	if (_ftp_on) {
+		_receiver.print_ftp_status();
+	}
 	printf("\tmode: %s\n", mavlink_mode_str(_mode));
 
 	if (_mode == MAVLINK_MODE_IRIDIUM) {
@@ -2997,18 +3214,38 @@ Mavlink::display_status()
 		printf("\t  min: %0.2f ms\n", (double)_ping_stats.min_rtt);
 		printf("\t  dropped packets: %" PRIi32 "\n", _ping_stats.dropped_packets);
 	}
+
+	if (_link_stats.rtt_samples > 0) {
+		printf("\ttimesync round trip time: %.2f ms, jitter: %.2f ms\n",
+		       (double)_link_stats.rtt_avg, (double)_link_stats.rtt_jitter);
+		printf("\t  histogram [<5, 10, 20, 50, 100, 200, 500, >500 ms]:");
+
+		for (int i = 0; i < mavlink_link_stats_s::RTT_HIST_BINS; i++) {
+			printf(" %" PRIu32, _link_stats.rtt_hist[i]);
+		}
+
+		printf("\n");
+	}
 }
 
 void
 Mavlink::display_status_streams()
 {
-	printf("\t%-20s%-16s %s\n", "Name", "Rate Config (current) [Hz]", "Message Size (if active) [B]");
+	static constexpr const char *priority_str[MavlinkStream::NUM_PRIORITIES] {"low", "normal", "high"};
+
+	printf("\tstreams: %u configured, %u available in this build\n", (unsigned)_streams.size(), (unsigned)get_num_streams());
+	printf("\trate mult by priority: high %.3f, normal %.3f, low %.3f\n",
+	       (double)_rate_mult_priority[(int)MavlinkStream::Priority::High],
+	       (double)_rate_mult_priority[(int)MavlinkStream::Priority::Normal],
+	       (double)_rate_mult_priority[(int)MavlinkStream::Priority::Low]);
 
-	const float rate_mult = _rate_mult;
+	printf("\t%-20s%-16s %-8s %-8s %-9s %s\n", "Name", "Rate Config (current) [Hz]", "Priority", "Dropped",
+	       "Triggered", "Message Size (if active) [B]");
 
 	for (const auto &stream : _streams) {
 		const int interval = stream->get_interval();
 		const unsigned size = stream->get_size();
+		const MavlinkStream::Priority priority = stream->get_priority();
 		char rate_str[20];
 
 		if (interval < 0) {
@@ -3018,11 +3255,12 @@ Mavlink::display_status_streams()
 			float rate = 1000000.0f / (float)interval;
 			// Note that the actual current rate can be lower if the associated uORB topic updates at a
 			// lower rate.
-			float rate_current = stream->const_rate() ? rate : rate * rate_mult;
+			float rate_current = stream->const_rate() ? rate : rate * get_rate_mult(priority);
 			snprintf(rate_str, sizeof(rate_str), "%6.2f (%.3f)", (double)rate, (double)rate_current);
 		}
 
-		printf("\t%-30s%-16s", stream->get_name(), rate_str);
+		printf("\t%-30s%-16s %-8s %-8" PRIu32 " %-9s", stream->get_name(), rate_str, priority_str[(int)priority],
+		       stream->dropped_count(), stream->triggered() ? "yes" : "no");
 
 		if (size > 0) {
 			printf(" %3u\n", size);
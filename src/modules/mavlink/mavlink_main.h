@@ -62,6 +62,7 @@
 #include <parameters/param.h>
 #include <lib/variable_length_ringbuffer/VariableLengthRingbuffer.hpp>
 #include <perf/perf_counter.h>
+#include <px4_platform_common/arena.h>
 #include <px4_platform_common/cli.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/defines.h>
@@ -69,11 +70,13 @@
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/posix.h>
+#include <px4_platform_common/sem.h>
 #include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/SubscriptionInterval.hpp>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/radio_status.h>
+#include <uORB/topics/mavlink_link_stats.h>
 #include <uORB/topics/telemetry_status.h>
 #include <uORB/topics/vehicle_command.h>
 #include <uORB/topics/vehicle_command_ack.h>
@@ -114,6 +117,9 @@ public:
 	 */
 	Mavlink();
 
+	// instances are large and usually live until shutdown
+	PX4_ARENA_ALLOCATED("mavlink")
+
 	/**
 	 * Destructor, also kills the mavlinks task.
 	 */
@@ -339,10 +345,17 @@ public:
 	void			send_bytes(const uint8_t *buf, unsigned packet_len);
 
 	/**
-	 * Flush the transmit buffer and send one MAVLink packet
+	 * Finish one MAVLink packet, and flush the transmit buffer unless a batch is active
 	 */
 	void             	send_finish();
 
+	/**
+	 * Collect the packets sent until end_tx_batch() in the transmit buffer, and write them
+	 * with a single call instead of one write per packet.
+	 */
+	void			begin_tx_batch();
+	void			end_tx_batch();
+
 	/**
 	 * Resend message as is, don't change sequence number and CRC.
 	 */
@@ -411,6 +424,22 @@ public:
 
 	float			get_rate_mult() const { return _rate_mult; }
 
+	/**
+	 * Get the rate multiplier of streams with a given priority
+	 */
+	float			get_rate_mult(MavlinkStream::Priority priority) const { return _rate_mult_priority[(int)priority]; }
+
+	/**
+	 * Check the TX token bucket for a message of a stream with the given priority.
+	 *
+	 * High priority streams are always sent, normal priority streams need the tokens for
+	 * the message and low priority streams only get sent while the bucket is half full.
+	 *
+	 * @param size expected message size in bytes
+	 * @return true if the message can be sent
+	 */
+	bool			tx_bandwidth_available(unsigned size, MavlinkStream::Priority priority) const;
+
 	float			get_baudrate() { return _baudrate; }
 
 	/* Functions for waiting to start transmission until message received. */
@@ -443,6 +472,11 @@ public:
 
 	void			set_telemetry_status_type(uint8_t type) { _tstatus.type = type; }
 
+	/**
+	 * Get the latency statistics of this MAVLink link. The round trip time fields are updated from the receiver thread.
+	 */
+	mavlink_link_stats_s	&link_stats() { return _link_stats; }
+
 	void			update_radio_status(const radio_status_s &radio_status);
 
 	unsigned		get_system_type() { return _param_mav_type.get(); }
@@ -478,6 +512,18 @@ public:
 
 	unsigned		get_main_loop_delay() const { return _main_loop_delay; }
 
+	/**
+	 * Wake up the main loop before the end of its period, e.g. because the topic of a triggered stream got published.
+	 * Can be called from any thread.
+	 */
+	void			wake_main_loop()
+	{
+		if (!_main_loop_wakeup_pending.load()) {
+			_main_loop_wakeup_pending.store(true);
+			px4_sem_post(&_main_loop_sem);
+		}
+	}
+
 	/** get the Mavlink shell. Create a new one if there isn't one. It is *always* created via MavlinkReceiver thread.
 	 *  Returns nullptr if shell cannot be created */
 	MavlinkShell		*get_shell();
@@ -488,7 +534,11 @@ public:
 	MavlinkULog		*get_ulog_streaming() { return _mavlink_ulog; }
 	void			try_start_ulog_streaming(uint8_t target_system, uint8_t target_component)
 	{
-		if (_mavlink_ulog) { return; }
+		if (_mavlink_ulog) {
+			// restarted by the same client
+			_mavlink_ulog->request_header();
+			return;
+		}
 
 		_mavlink_ulog = MavlinkULog::try_start(_datarate, 0.7f, target_system, target_component);
 	}
@@ -537,6 +587,7 @@ private:
 
 	uORB::Publication<vehicle_command_ack_s> _vehicle_command_ack_pub{ORB_ID(vehicle_command_ack)};
 	uORB::PublicationMulti<telemetry_status_s> _telemetry_status_pub{ORB_ID(telemetry_status)};
+	uORB::PublicationMulti<mavlink_link_stats_s> _link_stats_pub{ORB_ID(mavlink_link_stats)};
 
 	uORB::Subscription _event_sub{ORB_ID(event)};
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
@@ -563,6 +614,8 @@ private:
 	px4::atomic_bool	_should_check_events{false};    /**< Events subscription: only one MAVLink instance should check */
 
 	unsigned		_main_loop_delay{1000};	/**< mainloop delay, depends on data rate */
+	px4_sem_t		_main_loop_sem;	/**< posted by triggered streams to wake up the main loop */
+	px4::atomic_bool	_main_loop_wakeup_pending{false};
 
 	List<MavlinkStream *>		_streams;
 
@@ -584,6 +637,12 @@ private:
 	int			_baudrate{57600};
 	int			_datarate{1000};		///< data rate for normal streams (attitude, position, etc.)
 	float			_rate_mult{1.0f};
+	float			_rate_mult_priority[MavlinkStream::NUM_PRIORITIES] {1.0f, 1.0f, 1.0f};
+
+	float			_tx_bandwidth{0.f};		///< available link bandwidth [B/s], 0 if not limited
+	float			_tx_tokens{0.f};		///< TX token bucket fill [B]
+	float			_tx_tokens_max{0.f};		///< TX token bucket size [B]
+	hrt_abstime		_tx_tokens_timestamp{0};
 	float			_high_latency_freq{0.015f};	///< frequency of HIGH_LATENCY2 stream
 
 	bool			_radio_status_available{false};
@@ -630,8 +689,26 @@ private:
 	unsigned short		_remote_port{DEFAULT_REMOTE_PORT_UDP};
 #endif // MAVLINK_UDP
 
-	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr unsigned TX_BUFFER_SIZE = MAVLINK_MAX_PACKET_LEN;
+#elif defined(__PX4_NUTTX)
+	static constexpr unsigned TX_BUFFER_SIZE = 2 * MAVLINK_MAX_PACKET_LEN;
+#else
+	static constexpr unsigned TX_BUFFER_SIZE = 1472; // max UDP payload without fragmentation (1500 bytes MTU)
+#endif
+
+	uint8_t			_buf[TX_BUFFER_SIZE] {};
 	unsigned		_buf_fill{0};
+	unsigned		_buf_messages{0};	///< number of packets in _buf
+	bool			_tx_batch{false};	///< collect packets until end_tx_batch()
+
+	uint32_t		_tx_writes{0};		///< number of write()/sendto() calls
+	uint64_t		_tx_write_bytes{0};	///< bytes written with these calls
+
+	uint32_t		_tx_queue_depth_max{0};	///< link stats since the last publication
+	uint32_t		_tx_write_count{0};
+	uint32_t		_tx_write_time_max{0};
+	uint64_t		_tx_write_time_total{0};
 
 	bool			_tx_buffer_low{false};
 
@@ -643,6 +720,7 @@ private:
 	radio_status_s		_rstatus {};
 	telemetry_status_s	_tstatus {};
 	bool                    _tstatus_updated{false};
+	mavlink_link_stats_s	_link_stats {};
 
 	ping_statistics_s	_ping_stats {};
 
@@ -669,11 +747,17 @@ private:
 
 	perf_counter_t _loop_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": tx run elapsed")};                      /**< loop performance counter */
 	perf_counter_t _loop_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": tx run interval")};           /**< loop interval performance counter */
+	perf_counter_t _loop_triggered_perf{perf_alloc(PC_COUNT, MODULE_NAME": tx run triggered")};            /**< loop iterations woken up by a stream topic */
 	perf_counter_t _send_byte_error_perf{perf_alloc(PC_COUNT, MODULE_NAME": send_bytes error")};           /**< send bytes error count */
 	perf_counter_t _forwarding_error_perf{perf_alloc(PC_COUNT, MODULE_NAME": forwarding error")};           /**< forwarding messages error count */
 
 	void			mavlink_update_parameters();
 
+	/**
+	 * Write out the transmit buffer, _send_mutex must be held
+	 */
+	void			flush_tx_buffer();
+
 	int mavlink_open_uart(const int baudrate = DEFAULT_BAUD_RATE,
 			      const char *uart_name = DEFAULT_DEVICE_NAME,
 			      const FLOW_CONTROL_MODE flow_control = FLOW_CONTROL_AUTO);
@@ -704,6 +788,13 @@ private:
 
 	void publish_telemetry_status();
 
+	void publish_link_stats();
+
+	/**
+	 * @return number of bytes waiting in the OS transmit queue, 0 if the platform does not report it
+	 */
+	unsigned get_tx_queue_depth();
+
 	void check_requested_subscriptions();
 
 	void handleCommands();
@@ -722,9 +813,17 @@ private:
 
 	/**
 	 * Update rate mult so total bitrate will be equal to _datarate.
+	 *
+	 * The bandwidth is assigned by stream priority: constant rate streams first,
+	 * then the high, normal and low priority streams with what is left.
 	 */
 	void update_rate_mult();
 
+	/**
+	 * Refill the TX token bucket with the available link bandwidth
+	 */
+	void update_tx_tokens(const hrt_abstime &t);
+
 #if defined(MAVLINK_UDP)
 	void find_broadcast_address();
 
@@ -736,6 +835,12 @@ private:
 
 	bool set_instance_id();
 
+	/**
+	 * Wait for the main loop period
+	 * @return true if woken up early by wake_main_loop()
+	 */
+	bool wait_main_loop();
+
 	/**
 	 * Main mavlink task.
 	 */
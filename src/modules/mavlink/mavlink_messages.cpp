@@ -82,8 +82,6 @@
 #include "streams/GPS_STATUS.hpp"
 #include "streams/HEARTBEAT.hpp"
 #include "streams/HIGHRES_IMU.hpp"
-#include "streams/HIL_ACTUATOR_CONTROLS.hpp"
-#include "streams/HIL_STATE_QUATERNION.hpp"
 #include "streams/HOME_POSITION.hpp"
 #include "streams/HYGROMETER_SENSOR.hpp"
 #include "streams/LANDING_TARGET.hpp"
@@ -93,10 +91,6 @@
 #include "streams/MOUNT_ORIENTATION.hpp"
 #include "streams/NAV_CONTROLLER_OUTPUT.hpp"
 #include "streams/OBSTACLE_DISTANCE.hpp"
-#include "streams/OPEN_DRONE_ID_BASIC_ID.hpp"
-#include "streams/OPEN_DRONE_ID_LOCATION.hpp"
-#include "streams/OPEN_DRONE_ID_SYSTEM.hpp"
-#include "streams/OPEN_DRONE_ID_ARM_STATUS.hpp"
 #include "streams/OPTICAL_FLOW_RAD.hpp"
 #include "streams/ORBIT_EXECUTION_STATUS.hpp"
 #include "streams/PING.hpp"
@@ -133,27 +127,49 @@
 #endif
 
 #if !defined(CONSTRAINED_FLASH)
-# include "streams/ADSB_VEHICLE.hpp"
-# include "streams/AUTOPILOT_STATE_FOR_GIMBAL_DEVICE.hpp"
 # include "streams/BATTERY_INFO.hpp"
-# include "streams/DEBUG.hpp"
-# include "streams/DEBUG_FLOAT_ARRAY.hpp"
-# include "streams/DEBUG_VECT.hpp"
-# include "streams/GIMBAL_DEVICE_ATTITUDE_STATUS.hpp"
-# include "streams/GIMBAL_DEVICE_SET_ATTITUDE.hpp"
-# include "streams/GIMBAL_MANAGER_INFORMATION.hpp"
-# include "streams/GIMBAL_MANAGER_STATUS.hpp"
-# include "streams/GIMBAL_DEVICE_INFORMATION.hpp"
 # include "streams/GPS2_RAW.hpp"
 # include "streams/HIGH_LATENCY2.hpp"
 # include "streams/LINK_NODE_STATUS.hpp"
-# include "streams/NAMED_VALUE_FLOAT.hpp"
 # include "streams/ODOMETRY.hpp"
 # include "streams/SCALED_PRESSURE2.hpp"
 # include "streams/SCALED_PRESSURE3.hpp"
+#endif // !CONSTRAINED_FLASH
+
+// optional stream groups, selected by the board configuration (see Kconfig)
+#if defined(CONFIG_MAVLINK_STREAMS_ADSB)
+# include "streams/ADSB_VEHICLE.hpp"
 # include "streams/UAVIONIX_ADSB_OUT_CFG.hpp"
 # include "streams/UAVIONIX_ADSB_OUT_DYNAMIC.hpp"
-#endif // !CONSTRAINED_FLASH
+#endif // CONFIG_MAVLINK_STREAMS_ADSB
+
+#if defined(CONFIG_MAVLINK_STREAMS_DEBUG)
+# include "streams/DEBUG.hpp"
+# include "streams/DEBUG_FLOAT_ARRAY.hpp"
+# include "streams/DEBUG_VECT.hpp"
+# include "streams/NAMED_VALUE_FLOAT.hpp"
+#endif // CONFIG_MAVLINK_STREAMS_DEBUG
+
+#if defined(CONFIG_MAVLINK_STREAMS_GIMBAL)
+# include "streams/AUTOPILOT_STATE_FOR_GIMBAL_DEVICE.hpp"
+# include "streams/GIMBAL_DEVICE_ATTITUDE_STATUS.hpp"
+# include "streams/GIMBAL_DEVICE_INFORMATION.hpp"
+# include "streams/GIMBAL_DEVICE_SET_ATTITUDE.hpp"
+# include "streams/GIMBAL_MANAGER_INFORMATION.hpp"
+# include "streams/GIMBAL_MANAGER_STATUS.hpp"
+#endif // CONFIG_MAVLINK_STREAMS_GIMBAL
+
+#if defined(CONFIG_MAVLINK_STREAMS_HIL)
+# include "streams/HIL_ACTUATOR_CONTROLS.hpp"
+# include "streams/HIL_STATE_QUATERNION.hpp"
+#endif // CONFIG_MAVLINK_STREAMS_HIL
+
+#if defined(CONFIG_MAVLINK_STREAMS_OPEN_DRONE_ID)
+# include "streams/OPEN_DRONE_ID_ARM_STATUS.hpp"
+# include "streams/OPEN_DRONE_ID_BASIC_ID.hpp"
+# include "streams/OPEN_DRONE_ID_LOCATION.hpp"
+# include "streams/OPEN_DRONE_ID_SYSTEM.hpp"
+#endif // CONFIG_MAVLINK_STREAMS_OPEN_DRONE_ID
 
 // ensure PX4 rotation enum and MAV_SENSOR_ROTATION align
 static_assert(MAV_SENSOR_ROTATION_NONE == static_cast<MAV_SENSOR_ORIENTATION>(ROTATION_NONE),
@@ -247,7 +263,7 @@ static_assert(41 == ROTATION_MAX, "Keep MAV_SENSOR_ROTATION and PX4 Rotation in
 static_assert(MAV_SENSOR_ROTATION_CUSTOM == static_cast<MAV_SENSOR_ORIENTATION>(ROTATION_CUSTOM), "Custom Rotation");
 
 
-static const StreamListItem streams_list[] = {
+static constexpr StreamListItem streams_list[] = {
 #if defined(HEARTBEAT_HPP)
 	create_stream_list_item<MavlinkStreamHeartbeat>(),
 #endif // HEARTBEAT_HPP
@@ -516,6 +532,13 @@ static const StreamListItem streams_list[] = {
 #endif // CURRENT_MODE_HPP
 };
 
+static constexpr size_t num_streams = sizeof(streams_list) / sizeof(streams_list[0]);
+
+size_t get_num_streams()
+{
+	return num_streams;
+}
+
 const char *get_stream_name(const uint16_t msg_id)
 {
 	// search for stream with specified msg id in supported streams list
@@ -46,6 +46,13 @@
 #define DEFINE_GET_PX4_CUSTOM_MODE
 #include <commander/px4_custom_mode.h>
 
+// set if stream groups are excluded from the build by the board configuration
+#if !defined(CONFIG_MAVLINK_STREAMS_ADSB) || !defined(CONFIG_MAVLINK_STREAMS_DEBUG) \
+	|| !defined(CONFIG_MAVLINK_STREAMS_GIMBAL) || !defined(CONFIG_MAVLINK_STREAMS_HIL) \
+	|| !defined(CONFIG_MAVLINK_STREAMS_OPEN_DRONE_ID)
+# define MAVLINK_STREAMS_PRUNED
+#endif
+
 class StreamListItem
 {
 
@@ -54,23 +61,26 @@ public:
 	const char *name;
 	uint16_t id;
 
-	StreamListItem(MavlinkStream * (*inst)(Mavlink *mavlink), const char *_name, uint16_t _id) :
+	constexpr StreamListItem(MavlinkStream * (*inst)(Mavlink *mavlink), const char *_name, uint16_t _id) :
 		new_instance(inst),
 		name(_name),
 		id(_id) {}
 
-	const char *get_name() const { return name; }
-	uint16_t get_id() const { return id; }
+	constexpr const char *get_name() const { return name; }
+	constexpr uint16_t get_id() const { return id; }
 };
 
 template <class T>
-static StreamListItem create_stream_list_item()
+static constexpr StreamListItem create_stream_list_item()
 {
 	return StreamListItem(&T::new_instance, T::get_name_static(), T::get_id_static());
 }
 
 const char *get_stream_name(const uint16_t msg_id);
 
+/** @return number of streams included in the build */
+size_t get_num_streams();
+
 MavlinkStream *create_mavlink_stream(const char *stream_name, Mavlink *mavlink);
 
 MavlinkStream *create_mavlink_stream(const uint16_t msg_id, Mavlink *mavlink);
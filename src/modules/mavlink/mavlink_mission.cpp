@@ -53,7 +53,10 @@
 #include <navigator/navigation.h>
 #include <uORB/topics/mission.h>
 #include <uORB/topics/mission_result.h>
-#include <crc32.h>
+#include <lib/crc/px4_crc.h>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 using matrix::wrap_2pi;
 
@@ -494,6 +497,10 @@ MavlinkMissionManager::send()
 		return;
 	}
 
+	if (_import_fd >= 0) {
+		update_mission_file_import();
+	}
+
 	mission_result_s mission_result{};
 
 	if (_mission_result_sub.update(&mission_result)) {
@@ -1881,6 +1888,243 @@ void MavlinkMissionManager::check_active_mission()
 	}
 }
 
+int MavlinkMissionManager::export_mission_file()
+{
+	if (_transfer_in_progress) {
+		return PX4_ERROR;
+	}
+
+	const uint16_t count = _count[MAV_MISSION_TYPE_MISSION];
+
+	if (_exported && (_exported_crc32 == _crc32[MAV_MISSION_TYPE_MISSION])
+	    && (access(MISSION_EXPORT_FILE, F_OK) == 0)) {
+		// up-to-date
+		return PX4_OK;
+	}
+
+	int fd = ::open(MISSION_EXPORT_FILE, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("open '%s' failed (%i)", MISSION_EXPORT_FILE, errno);
+		return PX4_ERROR;
+	}
+
+	MissionFileHeader header{};
+	header.magic = MISSION_FILE_MAGIC;
+	header.version = MISSION_FILE_VERSION;
+	header.mission_type = MAV_MISSION_TYPE_MISSION;
+	header.count = count;
+	header.current_seq = (_current_seq >= 0 && _current_seq < count) ? _current_seq : -1;
+
+	bool success = (::write(fd, &header, sizeof(header)) == sizeof(header));
+	uint32_t crc32 = 0;
+
+	// the file always holds MISSION_ITEM_INT items
+	const bool int_mode = _int_mode;
+	_int_mode = true;
+
+	for (uint16_t seq = 0; success && seq < count; seq++) {
+		mission_item_s mission_item{};
+		success = _dataman_client.readSync(_mission_dataman_id, seq, reinterpret_cast<uint8_t *>(&mission_item),
+						   sizeof(mission_item_s));
+
+		if (success) {
+			mavlink_mission_item_int_t wp{};
+			format_mavlink_mission_item(&mission_item, reinterpret_cast<mavlink_mission_item_t *>(&wp));
+			wp.seq = seq;
+			wp.current = (header.current_seq == seq) ? 1 : 0;
+
+			crc32 = crc32_for_mission_item(*reinterpret_cast<mavlink_mission_item_t *>(&wp), crc32);
+			success = (::write(fd, &wp, sizeof(wp)) == sizeof(wp));
+		}
+	}
+
+	_int_mode = int_mode;
+
+	// the checksum goes into the header once all items are known
+	header.crc32 = crc32;
+	success = success && (lseek(fd, 0, SEEK_SET) == 0) && (::write(fd, &header, sizeof(header)) == sizeof(header));
+
+	::close(fd);
+
+	if (!success) {
+		PX4_ERR("mission export failed");
+		unlink(MISSION_EXPORT_FILE);
+		_exported = false;
+		return PX4_ERROR;
+	}
+
+	_exported = true;
+	_exported_crc32 = crc32;
+
+	return PX4_OK;
+}
+
+int MavlinkMissionManager::import_mission_file()
+{
+	if (_transfer_in_progress || (_state != MAVLINK_WPM_STATE_IDLE)) {
+		PX4_ERR("mission import: transfer in progress");
+		return PX4_ERROR;
+	}
+
+	int fd = ::open(MISSION_IMPORT_FILE, O_RDONLY);
+
+	if (fd < 0) {
+		PX4_ERR("open '%s' failed (%i)", MISSION_IMPORT_FILE, errno);
+		return PX4_ERROR;
+	}
+
+	MissionFileHeader header{};
+
+	if ((::read(fd, &header, sizeof(header)) != sizeof(header))
+	    || (header.magic != MISSION_FILE_MAGIC) || (header.version != MISSION_FILE_VERSION)
+	    || (header.mission_type != MAV_MISSION_TYPE_MISSION)
+	    || (header.count > MAX_COUNT[MAV_MISSION_TYPE_MISSION])) {
+
+		PX4_ERR("mission import: invalid header");
+		::close(fd);
+		return PX4_ERROR;
+	}
+
+	// verify all items before anything is written to dataman
+	uint32_t crc32 = 0;
+
+	for (uint16_t seq = 0; seq < header.count; seq++) {
+		mavlink_mission_item_int_t wp;
+
+		if (::read(fd, &wp, sizeof(wp)) != sizeof(wp)) {
+			PX4_ERR("mission import: file too short");
+			::close(fd);
+			return PX4_ERROR;
+		}
+
+		crc32 = crc32_for_mission_item(*reinterpret_cast<mavlink_mission_item_t *>(&wp), crc32);
+	}
+
+	if (crc32 != header.crc32) {
+		PX4_ERR("mission import: checksum mismatch");
+		::close(fd);
+		return PX4_ERROR;
+	}
+
+	if (lseek(fd, sizeof(header), SEEK_SET) != sizeof(header)) {
+		::close(fd);
+		return PX4_ERROR;
+	}
+
+	// the items are written to the inactive storage, like a MISSION_ITEM transfer
+	_transfer_in_progress = true;
+	_mission_type = MAV_MISSION_TYPE_MISSION;
+	_transfer_dataman_id = (_mission_dataman_id == DM_KEY_WAYPOINTS_OFFBOARD_0 ? DM_KEY_WAYPOINTS_OFFBOARD_1 :
+				DM_KEY_WAYPOINTS_OFFBOARD_0);
+	_transfer_seq = 0;
+	_transfer_count = header.count;
+	_transfer_current_seq = header.current_seq;
+	_transfer_current_crc32 = crc32;
+	_transfer_land_start_marker = -1;
+	_transfer_land_marker = -1;
+	_import_fd = fd;
+
+	PX4_DEBUG("mission import: %u items", header.count);
+
+	return PX4_OK;
+}
+
+void MavlinkMissionManager::update_mission_file_import()
+{
+	// keep the receiver responsive: only write for a few milliseconds per iteration
+	static constexpr hrt_abstime MISSION_IMPORT_TIME_SLICE = 5_ms;
+
+	const hrt_abstime start = hrt_absolute_time();
+
+	const bool int_mode = _int_mode;
+	_int_mode = true;
+
+	bool failed = false;
+
+	while ((_transfer_seq < _transfer_count) && (hrt_elapsed_time(&start) < MISSION_IMPORT_TIME_SLICE)) {
+		mavlink_mission_item_int_t wp;
+
+		if (::read(_import_fd, &wp, sizeof(wp)) != sizeof(wp)) {
+			failed = true;
+			break;
+		}
+
+		mission_item_s mission_item{};
+
+		if (parse_mavlink_mission_item(reinterpret_cast<mavlink_mission_item_t *>(&wp), &mission_item) != PX4_OK) {
+			PX4_ERR("mission import: seq %u invalid item", _transfer_seq);
+			failed = true;
+			break;
+		}
+
+		if (mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_INCLUSION ||
+		    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_POLYGON_VERTEX_EXCLUSION ||
+		    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_CIRCLE_INCLUSION ||
+		    mission_item.nav_cmd == MAV_CMD_NAV_FENCE_CIRCLE_EXCLUSION ||
+		    mission_item.nav_cmd == MAV_CMD_NAV_RALLY_POINT) {
+			PX4_ERR("mission import: seq %u wrong item type", _transfer_seq);
+			failed = true;
+			break;
+		}
+
+		if (!_dataman_client.writeSync(_transfer_dataman_id, _transfer_seq, reinterpret_cast<uint8_t *>(&mission_item),
+					       sizeof(struct mission_item_s))) {
+			failed = true;
+			break;
+		}
+
+		// Check for land start marker
+		if ((mission_item.nav_cmd == MAV_CMD_DO_LAND_START) && (_transfer_land_start_marker == -1)) {
+			_transfer_land_start_marker = _transfer_seq;
+		}
+
+		// Check for land index
+		if (((mission_item.nav_cmd == MAV_CMD_NAV_VTOL_LAND) || (mission_item.nav_cmd == MAV_CMD_NAV_LAND))
+		    && (_transfer_land_marker == -1)) {
+			_transfer_land_marker = _transfer_seq;
+
+			if (_transfer_land_start_marker == -1) {
+				_transfer_land_start_marker = _transfer_land_marker;
+			}
+		}
+
+		_transfer_seq++;
+	}
+
+	_int_mode = int_mode;
+
+	if (failed) {
+		finish_mission_file_import(false);
+
+	} else if (_transfer_seq == _transfer_count) {
+		finish_mission_file_import(true);
+	}
+}
+
+void MavlinkMissionManager::finish_mission_file_import(bool success)
+{
+	::close(_import_fd);
+	_import_fd = -1;
+
+	if (success) {
+		_land_start_marker = _transfer_land_start_marker;
+		_land_marker = _transfer_land_marker;
+
+		update_active_mission(_transfer_dataman_id, _transfer_count, _transfer_current_seq, _transfer_current_crc32);
+
+		PX4_INFO("mission with %u items imported", _transfer_count);
+
+	} else {
+		_mavlink.send_statustext_critical("Mission file import failed\t");
+		events::send(events::ID("mavlink_mission_file_import_failed"), events::Log::Error,
+			     "Mission file import failed");
+	}
+
+	unlink(MISSION_IMPORT_FILE);
+	_transfer_in_progress = false;
+}
+
 uint32_t MavlinkMissionManager::crc32_for_mission_item(const mavlink_mission_item_t &mission_item, uint32_t prev_crc32)
 {
 	union {
@@ -1899,5 +2143,5 @@ uint32_t MavlinkMissionManager::crc32_for_mission_item(const mavlink_mission_ite
 	u.item.params[5] = mission_item.y;
 	u.item.params[6] = mission_item.z;
 
-	return crc32part(u.raw, sizeof(u), prev_crc32);
+	return px4_crc32(prev_crc32, u.raw, sizeof(u));
 }
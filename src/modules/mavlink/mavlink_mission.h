@@ -91,6 +91,44 @@ public:
 
 	void check_active_mission(void);
 
+	/// FTP path of the packed mission file, used for bulk upload and download of the mission
+	static constexpr const char *MISSION_FTP_PATH = "@MISSION/mission.dat";
+
+	/// file the active mission is written to for an FTP download
+	static constexpr const char *MISSION_EXPORT_FILE = PX4_STORAGEDIR "/mission_export.dat";
+
+	/// file an FTP mission upload is written to
+	static constexpr const char *MISSION_IMPORT_FILE = PX4_STORAGEDIR "/mission_import.dat";
+
+	static constexpr uint32_t MISSION_FILE_MAGIC = 0x534d5850; ///< "PXMS"
+	static constexpr uint16_t MISSION_FILE_VERSION = 1;
+
+	/**
+	 * Header of the packed mission file, followed by count mavlink_mission_item_int_t items
+	 * (seq, target and mission_type fields are ignored).
+	 */
+	struct __attribute__((__packed__)) MissionFileHeader {
+		uint32_t magic;
+		uint16_t version;
+		uint16_t mission_type;	///< MAV_MISSION_TYPE, only MAV_MISSION_TYPE_MISSION is supported
+		uint16_t count;		///< number of items
+		int16_t current_seq;	///< current item, -1 if none
+		uint32_t crc32;		///< checksum of the items, as in MISSION_ACK.opaque_id and mission_s.mission_id
+	};
+
+	/**
+	 * Write the active mission to MISSION_EXPORT_FILE, unless it is up-to-date.
+	 * @return PX4_OK on success
+	 */
+	int export_mission_file();
+
+	/**
+	 * Verify MISSION_IMPORT_FILE and start writing it to dataman. The items are written in time slices
+	 * from send(), the mission becomes active once all of them are stored.
+	 * @return PX4_OK if the import was started
+	 */
+	int import_mission_file();
+
 private:
 	enum MAVLINK_WPM_STATES _state {MAVLINK_WPM_STATE_IDLE};	///< Current state
 	enum MAV_MISSION_TYPE _mission_type {MAV_MISSION_TYPE_MISSION};	///< mission type of current transmission (only one at a time possible)
@@ -136,6 +174,10 @@ private:
 
 	static bool		_transfer_in_progress;			///< Global variable checking for current transmission
 
+	int			_import_fd{-1};				///< mission file being written to dataman, -1 if none
+	uint32_t		_exported_crc32{0};			///< checksum of the mission in MISSION_EXPORT_FILE
+	bool			_exported{false};
+
 	uORB::Subscription	_mission_result_sub{ORB_ID(mission_result)};
 	uORB::SubscriptionData<mission_s> 	_mission_sub{ORB_ID(mission)};
 
@@ -261,6 +303,13 @@ private:
 	 */
 	void switch_to_idle_state();
 
+	/**
+	 * Write the next items of an imported mission file to dataman, limited to a short time slice
+	 */
+	void update_mission_file_import();
+
+	void finish_mission_file_import(bool success);
+
 	/**
 	 * Copies the specified range [1, 7] of param of MAVLink mission to params[] array of
 	 * the Mission item struct (Very useful for mission items for non-navigation
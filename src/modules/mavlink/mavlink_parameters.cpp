@@ -41,10 +41,15 @@
  */
 
 #include <stdio.h>
+#include <sys/stat.h>
 
 #include "mavlink_parameters.h"
 #include "mavlink_main.h"
 #include <lib/systemlib/mavlink_log.h>
+#include <lib/tinybson/tinybson.h>
+
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_encoder.h>
 
 MavlinkParametersManager::MavlinkParametersManager(Mavlink &mavlink) :
 	_mavlink(mavlink)
@@ -658,3 +663,166 @@ void MavlinkParametersManager::dequeue_uavcan_request()
 }
 
 #endif // CONFIG_MAVLINK_UAVCAN_PARAMETERS
+
+int MavlinkParametersManager::update_snapshot()
+{
+	static pthread_mutex_t snapshot_mutex = PTHREAD_MUTEX_INITIALIZER;
+	static uint32_t snapshot_hash = 0;
+	static bool snapshot_valid = false;
+
+	// shared by all instances
+	pthread_mutex_lock(&snapshot_mutex);
+
+	const uint32_t hash = param_hash_check();
+	struct stat st;
+	int ret = PX4_OK;
+
+	if (!snapshot_valid || (hash != snapshot_hash) || (stat(SNAPSHOT_FILE, &st) != 0)) {
+		ret = write_snapshot(hash);
+		snapshot_valid = (ret == PX4_OK);
+		snapshot_hash = hash;
+	}
+
+	pthread_mutex_unlock(&snapshot_mutex);
+
+	return ret;
+}
+
+int MavlinkParametersManager::write_snapshot(uint32_t hash)
+{
+	// the BSON document is written uncompressed first (the encoder needs to seek back for the size)
+	static constexpr const char *bson_file = PX4_STORAGEDIR "/param_snapshot.bson";
+
+	int fd = ::open(bson_file, O_RDWR | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		return -errno;
+	}
+
+	bson_encoder_s encoder{};
+	uint8_t bson_buffer[128];
+	int ret = bson_encoder_init_buf_file(&encoder, fd, bson_buffer, sizeof(bson_buffer));
+
+	if (ret == 0) {
+		ret = bson_encoder_append_int32(&encoder, HASH_PARAM, (int32_t)hash);
+	}
+
+	// in the same order as PARAM_VALUE (param_index)
+	const unsigned count = param_count_used();
+
+	for (unsigned i = 0; (i < count) && (ret == 0); i++) {
+		const param_t param = param_for_used_index(i);
+
+		switch (param_type(param)) {
+		case PARAM_TYPE_INT32: {
+				int32_t value = 0;
+				ret = param_get(param, &value);
+
+				if (ret == 0) {
+					ret = bson_encoder_append_int32(&encoder, param_name(param), value);
+				}
+			}
+			break;
+
+		case PARAM_TYPE_FLOAT: {
+				float value = 0.f;
+				ret = param_get(param, &value);
+
+				if (ret == 0) {
+					ret = bson_encoder_append_double(&encoder, param_name(param), (double)value);
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	if (ret == 0) {
+		ret = bson_encoder_fini(&encoder);
+	}
+
+	heatshrink_encoder *hse = nullptr;
+	int fd_out = -1;
+
+	if (ret == 0) {
+		hse = new heatshrink_encoder;
+		fd_out = ::open(SNAPSHOT_FILE, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+		if (!hse || fd_out < 0 || lseek(fd, 0, SEEK_SET) != 0) {
+			ret = PX4_ERROR;
+		}
+	}
+
+	if (ret == 0) {
+		heatshrink_encoder_reset(hse);
+		uint8_t in_buffer[64];
+		uint8_t out_buffer[64];
+		bool finished = false;
+
+		while (!finished && (ret == 0)) {
+			const int bytes_read = ::read(fd, in_buffer, sizeof(in_buffer));
+
+			if (bytes_read < 0) {
+				ret = -errno;
+				break;
+			}
+
+			size_t sunk = 0;
+
+			while ((sunk < (size_t)bytes_read) && (ret == 0)) {
+				size_t count_sunk = 0;
+
+				if (heatshrink_encoder_sink(hse, &in_buffer[sunk], bytes_read - sunk, &count_sunk) < 0) {
+					ret = PX4_ERROR;
+				}
+
+				sunk += count_sunk;
+
+				// drain the output before sinking more
+				HSE_poll_res poll_res;
+
+				do {
+					size_t output_size = 0;
+					poll_res = heatshrink_encoder_poll(hse, out_buffer, sizeof(out_buffer), &output_size);
+
+					if ((poll_res < 0) || (::write(fd_out, out_buffer, output_size) != (ssize_t)output_size)) {
+						ret = PX4_ERROR;
+					}
+				} while ((poll_res == HSER_POLL_MORE) && (ret == 0));
+			}
+
+			if (bytes_read == 0) {
+				// end of input: flush the remaining data
+				while ((heatshrink_encoder_finish(hse) == HSER_FINISH_MORE) && (ret == 0)) {
+					size_t output_size = 0;
+
+					if ((heatshrink_encoder_poll(hse, out_buffer, sizeof(out_buffer), &output_size) < 0)
+					    || (::write(fd_out, out_buffer, output_size) != (ssize_t)output_size)) {
+						ret = PX4_ERROR;
+					}
+				}
+
+				finished = true;
+			}
+		}
+	}
+
+	delete hse;
+
+	if (fd_out >= 0) {
+		::close(fd_out);
+	}
+
+	::close(fd);
+	unlink(bson_file);
+
+	if (ret != 0) {
+		unlink(SNAPSHOT_FILE);
+		PX4_ERR("parameter snapshot failed (%i)", ret);
+		return ret < 0 ? ret : PX4_ERROR;
+	}
+
+	return PX4_OK;
+}
@@ -43,6 +43,7 @@
 #pragma once
 
 #include <parameters/param.h>
+#include <px4_platform_common/defines.h>
 
 #include "mavlink_bridge_header.h"
 #include <uORB/Publication.hpp>
@@ -77,9 +78,24 @@ public:
 
 	void handle_message(const mavlink_message_t *msg);
 
+	/// FTP path of the parameter snapshot: all used parameters and the _HASH_CHECK as BSON document, heatshrink compressed
+	static constexpr const char *SNAPSHOT_FTP_PATH = "@PARAM/params.bson.hs";
+
+	/// file the snapshot is written to
+	static constexpr const char *SNAPSHOT_FILE = PX4_STORAGEDIR "/param_snapshot.bson.hs";
+
+	/**
+	 * Write the parameter snapshot to SNAPSHOT_FILE, unless it is up-to-date.
+	 * This allows a ground station to download all parameters in a single FTP transfer.
+	 * @return 0 on success, <0 error otherwise
+	 */
+	static int update_snapshot();
+
 private:
 	int		_send_all_index{-1};
 
+	static int write_snapshot(uint32_t hash);
+
 	/* do not allow top copying this class */
 	MavlinkParametersManager(MavlinkParametersManager &);
 	MavlinkParametersManager &operator = (const MavlinkParametersManager &);
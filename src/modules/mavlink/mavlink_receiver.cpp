@@ -106,6 +106,8 @@ static constexpr vehicle_odometry_s vehicle_odometry_empty {
 	.quality = 0
 };
 
+MavlinkCommandDedup MavlinkReceiver::_command_dedup;
+
 MavlinkReceiver::MavlinkReceiver(Mavlink &parent) :
 	ModuleParams(nullptr),
 	_mavlink(parent),
@@ -115,6 +117,7 @@ MavlinkReceiver::MavlinkReceiver(Mavlink &parent) :
 	_parameters_manager(parent),
 	_mavlink_timesync(parent)
 {
+	_mavlink_ftp.set_mission_manager(&_mission_manager);
 }
 
 void
@@ -408,7 +411,7 @@ MavlinkReceiver::handle_message(mavlink_message_t *msg)
 	_mavlink_log_handler.handle_message(msg);
 
 	/* handle packet with timesync component */
-	_mavlink_timesync.handle_message(msg);
+	_mavlink_timesync.handle_message(msg, _rx_timestamp);
 
 	/* handle packet with parent object */
 	_mavlink.handle_message(msg);
@@ -745,10 +748,27 @@ void MavlinkReceiver::handle_message_command_both(mavlink_message_t *msg, const
 				// from the logger.
 				_mavlink.try_start_ulog_streaming(msg->sysid, msg->compid);
 			}
+
+		} else if (cmd_mavlink.command == MAV_CMD_LOGGING_STOP) {
+			// other clients are still streaming: only stop our session and keep the logger running
+			MavlinkULog *ulog_streaming = _mavlink.get_ulog_streaming();
+
+			if (ulog_streaming && MavlinkULog::num_sessions() > 1) {
+				ulog_streaming->request_stop();
+				send_ack = true;
+				result = vehicle_command_ack_s::VEHICLE_CMD_RESULT_ACCEPTED;
+			}
 		}
 
 		if (!send_ack) {
-			_cmd_pub.publish(vehicle_command);
+			// the same command arriving over another link (or twice) is only handled once,
+			// its ack is sent out on all links anyway
+			if (_command_dedup.check_duplicate(vehicle_command, hrt_absolute_time() / 1000)) {
+				PX4_DEBUG("ignoring duplicate command %" PRIu32 " from %" PRIu8, vehicle_command.command, msg->sysid);
+
+			} else {
+				_cmd_pub.publish(vehicle_command);
+			}
 		}
 	}
 
@@ -3186,7 +3206,21 @@ MavlinkReceiver::run()
 
 #if defined(MAVLINK_UDP)
 	struct sockaddr_in srcaddr = {};
-	socklen_t addrlen = sizeof(srcaddr);
+
+# if defined(__PX4_LINUX)
+	// receive multiple datagrams per system call, each into its own slot of buf
+	static constexpr size_t UDP_SLOT_SIZE = 1600;
+	static constexpr unsigned UDP_NUM_SLOTS = sizeof(buf) / UDP_SLOT_SIZE;
+	struct mmsghdr msgs[UDP_NUM_SLOTS] {};
+	struct iovec iovecs[UDP_NUM_SLOTS] {};
+	struct sockaddr_in srcaddrs[UDP_NUM_SLOTS] {};
+
+	// kernel receive timestamps for the timesync, per datagram with the end of the datagram in buf
+	alignas(struct cmsghdr) char controls[UDP_NUM_SLOTS][Timesync::RX_TIMESTAMP_CONTROL_SIZE] {};
+	hrt_abstime rx_timestamps[UDP_NUM_SLOTS] {};
+	ssize_t rx_ends[UDP_NUM_SLOTS] {};
+	int num_datagrams = 0;
+# endif // __PX4_LINUX
 
 	if (_mavlink.get_protocol() == Protocol::UDP) {
 		fds[0].fd = _mavlink.get_socket_fd();
@@ -3226,7 +3260,49 @@ MavlinkReceiver::run()
 
 			else if (_mavlink.get_protocol() == Protocol::UDP) {
 				if (fds[0].revents & POLLIN) {
+# if defined(__PX4_LINUX)
+
+					for (unsigned i = 0; i < UDP_NUM_SLOTS; i++) {
+						iovecs[i].iov_base = &buf[i * UDP_SLOT_SIZE];
+						iovecs[i].iov_len = UDP_SLOT_SIZE;
+						msgs[i].msg_hdr = {};
+						msgs[i].msg_hdr.msg_iov = &iovecs[i];
+						msgs[i].msg_hdr.msg_iovlen = 1;
+						msgs[i].msg_hdr.msg_name = &srcaddrs[i];
+						msgs[i].msg_hdr.msg_namelen = sizeof(srcaddrs[i]);
+						msgs[i].msg_hdr.msg_control = controls[i];
+						msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+					}
+
+					num_datagrams = 0;
+
+					const int num_msgs = recvmmsg(_mavlink.get_socket_fd(), msgs, UDP_NUM_SLOTS, MSG_DONTWAIT, nullptr);
+
+					if (num_msgs > 0) {
+						// concatenate the datagrams, the parser treats them as one stream
+						nread = 0;
+
+						for (int i = 0; i < num_msgs; i++) {
+							memmove(&buf[nread], &buf[i * UDP_SLOT_SIZE], msgs[i].msg_len);
+							nread += msgs[i].msg_len;
+							rx_timestamps[i] = Timesync::rx_timestamp(msgs[i].msg_hdr);
+							rx_ends[i] = nread;
+						}
+
+						num_datagrams = num_msgs;
+
+						srcaddr = srcaddrs[num_msgs - 1];
+						_udp_receive_calls++;
+						_udp_received_datagrams += num_msgs;
+
+					} else {
+						nread = -1;
+					}
+
+# else
+					socklen_t addrlen = sizeof(srcaddr);
 					nread = recvfrom(_mavlink.get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
+# endif // __PX4_LINUX
 				}
 
 				struct sockaddr_in &srcaddr_last = _mavlink.get_client_source_address();
@@ -3258,8 +3334,35 @@ MavlinkReceiver::run()
 #endif // MAVLINK_UDP
 
 				/* if read failed, this loop won't execute */
-				for (ssize_t i = 0; i < nread; i++) {
-					if (mavlink_parse_char(_mavlink.get_channel(), buf[i], &msg, &_status)) {
+				for (ssize_t i = 0; i < nread;) {
+					bool received = false;
+					const size_t frame_length = parse_frame(&buf[i], nread - i, msg);
+
+					if (frame_length > 0) {
+						received = true;
+						i += frame_length;
+
+					} else {
+						received = mavlink_parse_char(_mavlink.get_channel(), buf[i], &msg, &_status);
+						i++;
+					}
+
+					if (received) {
+
+#if defined(MAVLINK_UDP) && defined(__PX4_LINUX)
+
+						if (num_datagrams > 0) {
+							// the datagram the message ended in
+							int datagram = 0;
+
+							while (datagram < num_datagrams - 1 && i > rx_ends[datagram]) {
+								datagram++;
+							}
+
+							_rx_timestamp = rx_timestamps[datagram];
+						}
+
+#endif // MAVLINK_UDP && __PX4_LINUX
 
 						/* check if we received version 2 and request a switch. */
 						if (!(_mavlink.get_status()->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)) {
@@ -3267,6 +3370,8 @@ MavlinkReceiver::run()
 							_mavlink.set_proto_version(2);
 						}
 
+						const hrt_abstime handle_start = _message_statistics_enabled ? hrt_absolute_time() : 0;
+
 						switch (_mavlink.get_mode()) {
 						case Mavlink::MAVLINK_MODE::MAVLINK_MODE_GIMBAL:
 							handle_messages_in_gimbal_mode(msg);
@@ -3281,8 +3386,10 @@ MavlinkReceiver::run()
 						update_rx_stats(msg);
 
 						if (_message_statistics_enabled) {
-							update_message_statistics(msg);
+							update_message_statistics(msg, hrt_elapsed_time(&handle_start));
 						}
+
+						_rx_timestamp = 0;
 					}
 				}
 
@@ -3363,6 +3470,76 @@ bool MavlinkReceiver::component_was_seen(int system_id, int component_id)
 	return false;
 }
 
+size_t MavlinkReceiver::parse_frame(const uint8_t *buf, size_t len, mavlink_message_t &msg)
+{
+	static constexpr size_t header_len = MAVLINK_NUM_HEADER_BYTES;
+
+	mavlink_status_t *status = _mavlink.get_status();
+
+	// only at a frame boundary of the byte parser, and for unsigned MAVLink 2 frames
+	if ((status->parse_state > MAVLINK_PARSE_STATE_IDLE) || (status->signing != nullptr)
+	    || (len < header_len + MAVLINK_NUM_CHECKSUM_BYTES) || (buf[0] != MAVLINK_STX) || (buf[2] != 0)) {
+		return 0;
+	}
+
+	const uint8_t payload_len = buf[1];
+	const size_t frame_len = header_len + payload_len + MAVLINK_NUM_CHECKSUM_BYTES;
+
+	if (len < frame_len) {
+		// incomplete, the byte parser keeps the state until the next read
+		return 0;
+	}
+
+	const uint32_t msgid = buf[7] | (buf[8] << 8) | (buf[9] << 16);
+	const mavlink_msg_entry_t *entry = mavlink_get_msg_entry(msgid);
+
+	if ((entry == nullptr) || (payload_len > entry->max_msg_len)) {
+		return 0;
+	}
+
+	// checksum over the header (without the start byte) and payload, plus the message CRC extra
+	uint16_t checksum = crc_calculate(&buf[1], header_len - 1 + payload_len);
+	crc_accumulate(entry->crc_extra, &checksum);
+
+	const uint16_t frame_checksum = buf[header_len + payload_len] | (buf[header_len + payload_len + 1] << 8);
+
+	if (checksum != frame_checksum) {
+		// let the byte parser handle (and count) the error
+		return 0;
+	}
+
+	msg.magic = MAVLINK_STX;
+	msg.len = payload_len;
+	msg.incompat_flags = buf[2];
+	msg.compat_flags = buf[3];
+	msg.seq = buf[4];
+	msg.sysid = buf[5];
+	msg.compid = buf[6];
+	msg.msgid = msgid;
+	msg.checksum = checksum;
+	msg.ck[0] = buf[header_len + payload_len];
+	msg.ck[1] = buf[header_len + payload_len + 1];
+
+	// zero fill truncated payloads, like mavlink_parse_char()
+	uint8_t *payload = (uint8_t *)_MAV_PAYLOAD_NON_CONST(&msg);
+	memcpy(payload, &buf[header_len], payload_len);
+	memset(&payload[payload_len], 0, entry->max_msg_len - payload_len);
+
+	// update the channel status as the byte parser would
+	if (status->packet_rx_success_count == 0) {
+		status->packet_rx_drop_count = 0;
+	}
+
+	status->packet_rx_success_count++;
+	status->current_rx_seq = msg.seq;
+	status->flags &= ~MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+	status->msg_received = MAVLINK_FRAMING_OK;
+
+	_fast_parsed_frames++;
+
+	return frame_len;
+}
+
 void MavlinkReceiver::update_rx_stats(const mavlink_message_t &message)
 {
 	const bool component_states_has_still_space = [this, &message]() {
@@ -3416,7 +3593,7 @@ void MavlinkReceiver::update_rx_stats(const mavlink_message_t &message)
 	}
 }
 
-void MavlinkReceiver::update_message_statistics(const mavlink_message_t &message)
+void MavlinkReceiver::update_message_statistics(const mavlink_message_t &message, uint32_t handle_time_us)
 {
 #if !defined(CONSTRAINED_FLASH)
 
@@ -3473,8 +3650,12 @@ void MavlinkReceiver::update_message_statistics(const mavlink_message_t &message
 					_received_msg_stats[msg_stats_slot].avg_rate_hz = 0.f;
 				}
 
+				_received_msg_stats[msg_stats_slot].avg_handle_time_us = 0.9f * _received_msg_stats[msg_stats_slot].avg_handle_time_us
+						+ 0.1f * handle_time_us;
+
 			} else {
 				_received_msg_stats[msg_stats_slot].avg_rate_hz = NAN;
+				_received_msg_stats[msg_stats_slot].avg_handle_time_us = handle_time_us;
 			}
 
 			_received_msg_stats[msg_stats_slot].last_time_received_ms = now_ms;
@@ -3515,8 +3696,9 @@ void MavlinkReceiver::print_detailed_rx_stats() const
 
 							const float elapsed_s = (now_ms - msg_stat.last_time_received_ms) / 1000.f;
 
-							printf("\t    msgid:%5" PRIu16 ", Rate:%5.1f Hz, last %.2fs ago\n",
-							       msg_stat.msg_id, (double)msg_stat.avg_rate_hz, (double)elapsed_s);
+							printf("\t    msgid:%5" PRIu16 ", Rate:%5.1f Hz, last %.2fs ago, handling: %.1f us\n",
+							       msg_stat.msg_id, (double)msg_stat.avg_rate_hz, (double)elapsed_s,
+							       (double)msg_stat.avg_handle_time_us);
 						}
 					}
 				}
@@ -3525,6 +3707,40 @@ void MavlinkReceiver::print_detailed_rx_stats() const
 			}
 		}
 	}
+
+	printf("\tframes parsed at once: %" PRIu32 "\n", _fast_parsed_frames);
+
+	if (_udp_receive_calls > 0) {
+		printf("\tUDP datagrams per receive call: %.2f\n", (double)_udp_received_datagrams / _udp_receive_calls);
+	}
+}
+
+void MavlinkReceiver::get_message_statistics(mavlink_link_stats_s &link_stats) const
+{
+	link_stats.rx_msg_stats_count = 0;
+
+#if !defined(CONSTRAINED_FLASH)
+	static_assert(MAX_MSG_STAT_SLOTS <= mavlink_link_stats_s::RX_MSG_STATS_MAX, "too many message statistic slots");
+
+	if (_message_statistics_enabled && _received_msg_stats) {
+		const uint32_t now_ms = hrt_absolute_time() / 1000;
+
+		for (int i = 0; i < MAX_MSG_STAT_SLOTS; i++) {
+			const ReceivedMessageStats &msg_stat = _received_msg_stats[i];
+
+			// valid messages received within the last 10 seconds
+			if ((msg_stat.last_time_received_ms != 0) && (now_ms - msg_stat.last_time_received_ms < 10'000)) {
+				const int n = link_stats.rx_msg_stats_count++;
+				link_stats.rx_msg_id[n] = msg_stat.msg_id;
+				link_stats.rx_msg_sysid[n] = msg_stat.system_id;
+				link_stats.rx_msg_compid[n] = msg_stat.component_id;
+				link_stats.rx_msg_rate[n] = msg_stat.avg_rate_hz;
+				link_stats.rx_msg_handle_time[n] = msg_stat.avg_handle_time_us;
+			}
+		}
+	}
+
+#endif // !CONSTRAINED_FLASH
 }
 
 void MavlinkReceiver::start()
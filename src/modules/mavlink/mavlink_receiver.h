@@ -43,6 +43,7 @@
 
 #pragma once
 
+#include "mavlink_command_dedup.h"
 #include "mavlink_ftp.h"
 #include "mavlink_log_handler.h"
 #include "mavlink_mission.h"
@@ -96,6 +97,7 @@
 #include <uORB/topics/sensor_baro.h>
 #include <uORB/topics/sensor_gps.h>
 #include <uORB/topics/sensor_optical_flow.h>
+#include <uORB/topics/mavlink_link_stats.h>
 #include <uORB/topics/telemetry_status.h>
 #include <uORB/topics/transponder_report.h>
 #include <uORB/topics/trajectory_setpoint.h>
@@ -138,6 +140,15 @@ public:
 	void enable_message_statistics() { _message_statistics_enabled = true; }
 	void print_detailed_rx_stats() const;
 
+	/**
+	 * Fill in the per message id statistics of link_stats (nothing if message statistics are not enabled)
+	 */
+	void get_message_statistics(mavlink_link_stats_s &link_stats) const;
+	void print_ftp_status() const { _mavlink_ftp.print_status(); }
+
+	/** @return number of duplicate commands ignored by the receivers of all instances */
+	static uint32_t num_duplicate_commands() { return _command_dedup.num_duplicates(); }
+
 	void request_stop() { _should_exit.store(true); }
 
 private:
@@ -241,9 +252,16 @@ private:
 
 	void schedule_tune(const char *tune);
 
-	void update_message_statistics(const mavlink_message_t &message);
+	void update_message_statistics(const mavlink_message_t &message, uint32_t handle_time_us);
 	void update_rx_stats(const mavlink_message_t &message);
 
+	/**
+	 * Fast path parser for a complete MAVLink 2 frame at the start of buf, validating the frame at once
+	 * instead of passing it to mavlink_parse_char() byte by byte.
+	 * @return frame length if msg was filled in, 0 if the bytes need to go through mavlink_parse_char()
+	 */
+	size_t parse_frame(const uint8_t *buf, size_t len, mavlink_message_t &msg);
+
 	px4::atomic_bool 	_should_exit{false};
 	pthread_t		_thread {};
 	/**
@@ -258,6 +276,7 @@ private:
 	MavlinkMissionManager		_mission_manager;
 	MavlinkParametersManager	_parameters_manager;
 	MavlinkTimesync			_mavlink_timesync;
+	hrt_abstime			_rx_timestamp{0};	///< kernel receive time of the message being handled, 0 if unknown
 	MavlinkStatustextHandler	_mavlink_statustext_handler;
 
 	mavlink_status_t		_status{}; ///< receiver status, used for mavlink_parse_char()
@@ -281,6 +300,7 @@ private:
 	static constexpr int MAX_MSG_STAT_SLOTS {16};
 	struct ReceivedMessageStats {
 		float avg_rate_hz{0.f}; // average rate
+		float avg_handle_time_us{0.f}; // average time to decode and handle the message
 		uint32_t last_time_received_ms{0};
 		uint16_t msg_id{0};
 		uint8_t system_id{0};
@@ -292,6 +312,10 @@ private:
 	uint64_t _total_received_counter{0};                            ///< The total number of successfully received messages
 	uint64_t _total_lost_counter{0};                                ///< Total messages lost during transmission.
 
+	uint32_t _fast_parsed_frames{0};                                ///< frames handled by parse_frame()
+	uint32_t _udp_receive_calls{0};                                 ///< recvmmsg() calls returning data
+	uint32_t _udp_received_datagrams{0};                            ///< datagrams received with these calls
+
 	uint8_t _mavlink_status_last_buffer_overrun{0};
 	uint8_t _mavlink_status_last_parse_error{0};
 	uint16_t _mavlink_status_last_packet_rx_drop_count{0};
@@ -353,6 +377,8 @@ private:
 	// ORB publications (queue length > 1)
 	uORB::Publication<transponder_report_s>  _transponder_report_pub{ORB_ID(transponder_report)};
 	uORB::Publication<vehicle_command_s>     _cmd_pub{ORB_ID(vehicle_command)};
+
+	static MavlinkCommandDedup _command_dedup; ///< shared by all instances
 	uORB::Publication<vehicle_command_ack_s> _cmd_ack_pub{ORB_ID(vehicle_command_ack)};
 
 	// ORB subscriptions
@@ -50,6 +50,54 @@ MavlinkStream::MavlinkStream(Mavlink *mavlink) :
 	_last_sent = hrt_absolute_time();
 }
 
+MavlinkStream::~MavlinkStream()
+{
+	delete _trigger;
+}
+
+void
+MavlinkStream::set_interval(const int interval)
+{
+	_interval = interval;
+
+	const orb_metadata *trigger_topic = get_trigger_topic();
+
+	if (trigger_topic == nullptr) {
+		return;
+	}
+
+	if (interval > 0) {
+		// wake up a bit early so that a slightly early publication is not missed.
+		// The stream itself still enforces its interval.
+		const uint32_t trigger_interval = (uint32_t)interval * 3 / 4;
+
+		if (_trigger == nullptr) {
+			_trigger = new MavlinkStreamTrigger(_mavlink, trigger_topic, trigger_interval);
+
+		} else {
+			_trigger->set_interval_us(trigger_interval);
+		}
+
+		if (_trigger) {
+			_trigger->registerCallback();
+		}
+
+	} else if (_trigger) {
+		// unlimited rate streams are sent every loop iteration anyway, disabled ones not at all
+		delete _trigger;
+		_trigger = nullptr;
+	}
+}
+
+void
+MavlinkStreamTrigger::call()
+{
+	if (updated()) {
+		set_last_update(hrt_absolute_time());
+		_mavlink->wake_main_loop();
+	}
+}
+
 /**
  * Update subscriptions and send message if necessary
  */
@@ -85,7 +133,7 @@ MavlinkStream::update(const hrt_abstime &t)
 	int interval = _interval;
 
 	if (!const_rate()) {
-		interval /= _mavlink->get_rate_mult();
+		interval /= _mavlink->get_rate_mult(get_priority());
 	}
 
 	// We don't need to send anything if the inverval is 0. send() will be called manually.
@@ -108,6 +156,13 @@ MavlinkStream::update(const hrt_abstime &t)
 	if (unlimited_rate || (dt > (interval - (_mavlink->get_main_loop_delay() / 10) * 3))) {
 		// interval expired, send message
 
+		// skip this message if the link is saturated by streams of higher priority
+		if (!_mavlink->tx_bandwidth_available(get_size_avg(), get_priority())) {
+			_dropped_count++;
+			_last_sent = t;
+			return -1;
+		}
+
 		// If the interval is non-zero and dt is smaller than 1.5 times the interval
 		// do not use the actual time but increment at a fixed rate, so that processing delays do not
 		// distort the average rate. The check of the maximum interval is done to ensure that after a
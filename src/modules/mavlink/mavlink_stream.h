@@ -44,16 +44,47 @@
 #include <drivers/drv_hrt.h>
 #include <px4_platform_common/module_params.h>
 #include <containers/List.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 
 class Mavlink;
 
+/**
+ * Wakes up the mavlink main loop when the primary topic of a stream is published,
+ * so the stream is sent without waiting for the next loop iteration.
+ */
+class MavlinkStreamTrigger : public uORB::SubscriptionCallback
+{
+public:
+	MavlinkStreamTrigger(Mavlink *mavlink, const orb_metadata *meta, uint32_t interval_us) :
+		uORB::SubscriptionCallback(meta, interval_us),
+		_mavlink(mavlink)
+	{}
+
+	void call() override;
+
+private:
+	Mavlink *const _mavlink;
+};
+
 class MavlinkStream : public ListNode<MavlinkStream *>
 {
 
 public:
 
+	/**
+	 * Stream priority, used to share the link bandwidth when it saturates.
+	 * Lower priority streams are slowed down and dropped first.
+	 */
+	enum class Priority : uint8_t {
+		Low = 0,	///< debug and diagnostic data
+		Normal,
+		High,		///< vehicle state required by a ground station
+	};
+
+	static constexpr int NUM_PRIORITIES = 3;
+
 	MavlinkStream(Mavlink *mavlink);
-	virtual ~MavlinkStream() = default;
+	virtual ~MavlinkStream();
 
 	// no copy, assignment, move, move assignment
 	MavlinkStream(const MavlinkStream &) = delete;
@@ -62,11 +93,11 @@ public:
 	MavlinkStream &operator=(MavlinkStream &&) = delete;
 
 	/**
-	 * Get the interval
+	 * Set the interval
 	 *
 	 * @param interval the interval in microseconds (us) between messages
 	 */
-	void set_interval(const int interval) { _interval = interval; }
+	void set_interval(const int interval);
 
 	/**
 	 * Get the interval
@@ -87,6 +118,11 @@ public:
 	 */
 	virtual bool const_rate() { return false; }
 
+	/**
+	 * @return the priority of the stream, constant rate streams are high priority by default
+	 */
+	virtual Priority get_priority() { return const_rate() ? Priority::High : Priority::Normal; }
+
 	/**
 	 * Get maximal total messages size on update
 	 */
@@ -111,6 +147,17 @@ public:
 	 */
 	virtual unsigned get_size_avg() { return get_size(); }
 
+	/**
+	 * @return the topic the stream mainly sends, or nullptr. When set, a publication of the topic
+	 * triggers the main loop, instead of the stream being polled at the loop rate only.
+	 */
+	virtual const orb_metadata *get_trigger_topic() const { return nullptr; }
+
+	/**
+	 * @return true if the stream is triggered by publications of its topic
+	 */
+	bool triggered() const { return _trigger != nullptr && _trigger->registered(); }
+
 	/**
 	 * @return true if the first message of this stream has been sent
 	 */
@@ -122,6 +169,11 @@ public:
 	 */
 	void reset_last_sent() { _last_sent = 0; }
 
+	/**
+	 * @return number of messages skipped because there was no link bandwidth left for the stream priority
+	 */
+	uint32_t dropped_count() const { return _dropped_count; }
+
 protected:
 	Mavlink      *const _mavlink;
 	int _interval{1000000};		///< if set to negative value = unlimited rate
@@ -137,7 +189,9 @@ protected:
 	virtual void update_data() { }
 
 private:
+	MavlinkStreamTrigger *_trigger{nullptr};
 	hrt_abstime _last_sent{0};
+	uint32_t _dropped_count{0};
 	bool _first_message_sent{false};
 };
 
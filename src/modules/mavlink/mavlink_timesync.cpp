@@ -41,6 +41,8 @@
 #include "mavlink_timesync.h"
 #include "mavlink_main.h"
 
+#include <lib/mathlib/mathlib.h>
+
 #include <stdlib.h>
 
 MavlinkTimesync::MavlinkTimesync(Mavlink &mavlink) :
@@ -49,7 +51,7 @@ MavlinkTimesync::MavlinkTimesync(Mavlink &mavlink) :
 }
 
 void
-MavlinkTimesync::handle_message(const mavlink_message_t *msg)
+MavlinkTimesync::handle_message(const mavlink_message_t *msg, hrt_abstime rx_timestamp)
 {
 	switch (msg->msgid) {
 	case MAVLINK_MSG_ID_TIMESYNC: {
@@ -72,7 +74,16 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 
 			} else if (tsync.tc1 > 0) {		// Message originating from this system, compute time offset from it
 
-				_timesync.update(now, tsync.tc1, tsync.ts1);
+				// the receive timestamp of the transport is not delayed by the scheduling of the receiver
+				const uint64_t received = (rx_timestamp != 0) ? rx_timestamp : now;
+
+				_timesync.update(received, tsync.tc1, tsync.ts1);
+
+				const uint64_t originate_us = tsync.ts1 / 1000ULL;
+
+				if (tsync.ts1 > 0 && received >= originate_us) {
+					update_rtt_stats(received - originate_us);
+				}
 			}
 
 			break;
@@ -106,3 +117,35 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 		break;
 	}
 }
+
+void
+MavlinkTimesync::update_rtt_stats(uint64_t rtt_us)
+{
+	// upper bin edges of mavlink_link_stats_s::rtt_hist, the last bin takes everything above
+	static constexpr float RTT_HIST_EDGES_MS[mavlink_link_stats_s::RTT_HIST_BINS - 1] {5.f, 10.f, 20.f, 50.f, 100.f, 200.f, 500.f};
+
+	mavlink_link_stats_s &stats = _mavlink.link_stats();
+	const float rtt_ms = rtt_us * 1e-3f;
+
+	int bin = 0;
+
+	while (bin < mavlink_link_stats_s::RTT_HIST_BINS - 1 && rtt_ms > RTT_HIST_EDGES_MS[bin]) {
+		bin++;
+	}
+
+	stats.rtt_hist[bin]++;
+
+	if (stats.rtt_samples == 0) {
+		stats.rtt_avg = rtt_ms;
+		stats.rtt_jitter = 0.f;
+
+	} else {
+		// same filter as the interarrival jitter of RFC 3550
+		stats.rtt_avg += (rtt_ms - stats.rtt_avg) / 16.f;
+		stats.rtt_jitter += (fabsf(rtt_ms - _last_rtt_ms) - stats.rtt_jitter) / 16.f;
+	}
+
+	stats.rtt_max = math::max(stats.rtt_max, rtt_ms);
+	stats.rtt_samples++;
+	_last_rtt_ms = rtt_ms;
+}
@@ -52,7 +52,11 @@ public:
 	explicit MavlinkTimesync(Mavlink &mavlink);
 	~MavlinkTimesync() = default;
 
-	void handle_message(const mavlink_message_t *msg);
+	/**
+	 * @param rx_timestamp local time the message was received at (usec), if known from the
+	 *                     transport, otherwise 0 to use the time of handling
+	 */
+	void handle_message(const mavlink_message_t *msg, hrt_abstime rx_timestamp = 0);
 
 	/**
 	 * Convert remote timestamp to local hrt time (usec)
@@ -61,6 +65,13 @@ public:
 	uint64_t sync_stamp(uint64_t usec) { return _timesync.sync_stamp(usec); }
 
 private:
+	/**
+	 * Add a round trip time sample to the link statistics
+	 */
+	void update_rtt_stats(uint64_t rtt_us);
+
 	Mavlink &_mavlink;
 	Timesync _timesync{};
+
+	float _last_rtt_ms{0.f};
 };
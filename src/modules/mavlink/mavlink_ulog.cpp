@@ -44,7 +44,10 @@
 #include <mathlib/mathlib.h>
 
 bool MavlinkULog::_init = false;
-MavlinkULog *MavlinkULog::_instance = nullptr;
+MavlinkULog *MavlinkULog::_sessions[MAX_SESSIONS] {};
+uint16_t MavlinkULog::_latest_reliable_sequence = 0;
+uint16_t MavlinkULog::_acked_sequence = 0;
+bool MavlinkULog::_acks_pending = false;
 px4_sem_t MavlinkULog::_lock;
 
 
@@ -61,8 +64,8 @@ MavlinkULog::MavlinkULog(int datarate, float max_rate_factor, uint8_t target_sys
 	}
 
 	_waiting_for_initial_ack = true;
-	_last_sent_time = hrt_absolute_time(); //(ab)use this timestamp during initialization
-	_next_rate_check = _last_sent_time + _rate_calculation_delta_t;
+	_start_time = hrt_absolute_time();
+	_next_rate_check = _start_time + _rate_calculation_delta_t;
 }
 
 MavlinkULog::~MavlinkULog()
@@ -73,12 +76,70 @@ MavlinkULog::~MavlinkULog()
 void MavlinkULog::start_ack_received()
 {
 	if (_waiting_for_initial_ack) {
-		_last_sent_time = 0;
 		_waiting_for_initial_ack = false;
 		PX4_DEBUG("got logger ack");
 	}
 }
 
+bool MavlinkULog::accept_message(const ulog_stream_s &ulog_data)
+{
+	const bool header = ulog_data.flags & ulog_stream_s::FLAGS_HEADER;
+	const bool header_start = ulog_data.flags & ulog_stream_s::FLAGS_HEADER_START;
+
+	switch (_state) {
+	case State::WaitForHeader:
+		if (header_start) {
+			_state = State::Header;
+			return true;
+		}
+
+		return false;
+
+	case State::Header:
+		if (header_start) {
+			// the header is re-sent for another session
+			_state = State::Streaming;
+			return false;
+		}
+
+		if (!header) {
+			_state = State::Streaming;
+		}
+
+		return true;
+
+	case State::Streaming:
+		return !header;
+	}
+
+	return false;
+}
+
+void MavlinkULog::send_acked(mavlink_channel_t channel, const ulog_stream_s &ulog_data)
+{
+	mavlink_logging_data_acked_t msg;
+	msg.sequence = ulog_data.msg_sequence;
+	msg.length = ulog_data.length;
+	msg.first_message_offset = ulog_data.first_message_offset;
+	msg.target_system = _target_system;
+	msg.target_component = _target_component;
+	memcpy(msg.data, ulog_data.data, sizeof(msg.data));
+	mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+}
+
+int MavlinkULog::num_pending() const
+{
+	int num = 0;
+
+	for (const PendingMessage &pending : _pending) {
+		if (pending.used) {
+			++num;
+		}
+	}
+
+	return num;
+}
+
 int MavlinkULog::handle_update(mavlink_channel_t channel)
 {
 	static_assert(sizeof(ulog_stream_s::data) == MAVLINK_MSG_LOGGING_DATA_FIELD_DATA_LEN,
@@ -86,8 +147,12 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 	static_assert(sizeof(ulog_stream_s::data) == MAVLINK_MSG_LOGGING_DATA_ACKED_FIELD_DATA_LEN,
 		      "Invalid uorb ulog_stream.data length");
 
+	if (_stop_requested) {
+		return -ECANCELED;
+	}
+
 	if (_waiting_for_initial_ack) {
-		if (hrt_elapsed_time(&_last_sent_time) > 3e5) {
+		if (hrt_elapsed_time(&_start_time) > 3e5) {
 			PX4_WARN("no ack from logger (is it running?)");
 			return -1;
 		}
@@ -95,45 +160,35 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 		return 0;
 	}
 
-	// check if we're waiting for an ACK
-	if (_last_sent_time) {
-		bool check_for_updates = false;
-
-		if (_ack_received) {
-			_last_sent_time = 0;
-			check_for_updates = true;
-
-		} else {
-
-			if (hrt_elapsed_time(&_last_sent_time) > ulog_stream_ack_s::ACK_TIMEOUT * 1000) {
-				if (++_sent_tries > ulog_stream_ack_s::ACK_MAX_TRIES) {
-					return -ETIMEDOUT;
-
-				} else {
-					PX4_DEBUG("re-sending ulog mavlink message (try=%i)", _sent_tries);
-					_last_sent_time = hrt_absolute_time();
+	if (_header_requested) {
+		_header_requested = false;
+		_state = State::WaitForHeader;
+	}
 
-					const ulog_stream_s &ulog_data = _ulog_stream_sub.get();
+	// re-send messages that did not get acked
+	const hrt_abstime now = hrt_absolute_time();
+	lock();
 
-					mavlink_logging_data_acked_t msg;
-					msg.sequence = ulog_data.msg_sequence;
-					msg.length = ulog_data.length;
-					msg.first_message_offset = ulog_data.first_message_offset;
-					msg.target_system = _target_system;
-					msg.target_component = _target_component;
-					memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-					mavlink_msg_logging_data_acked_send_struct(channel, &msg);
-				}
+	for (PendingMessage &pending : _pending) {
+		if (pending.used && now > pending.last_sent + ulog_stream_ack_s::ACK_TIMEOUT * 1000) {
+			if (++pending.tries > ulog_stream_ack_s::ACK_MAX_TRIES) {
+				unlock();
+				return -ETIMEDOUT;
 			}
-		}
 
-		if (!check_for_updates) {
-			return 0;
+			PX4_DEBUG("re-sending ulog mavlink message %i (try=%i)", pending.data.msg_sequence, pending.tries);
+			pending.last_sent = now;
+			++_num_retransmissions;
+			send_acked(channel, pending.data);
 		}
 	}
 
+	unlock();
+
+	const int max_num_messages = math::max(1, (int)(_max_num_messages * _link_quality));
 
-	while ((_current_num_msgs < _max_num_messages) && _ulog_stream_sub.updated()) {
+	while ((_current_num_msgs < max_num_messages) && (num_pending() < ulog_stream_ack_s::ACK_WINDOW_MAX)
+	       && _ulog_stream_sub.updated()) {
 		const unsigned last_generation = _ulog_stream_sub.get_last_generation();
 		_ulog_stream_sub.update();
 
@@ -143,36 +198,62 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 
 		const ulog_stream_s &ulog_data = _ulog_stream_sub.get();
 
-		if (ulog_data.timestamp > 0) {
-			if (ulog_data.flags & ulog_stream_s::FLAGS_NEED_ACK) {
-				_sent_tries = 1;
-				_last_sent_time = hrt_absolute_time();
-				lock();
-				_wait_for_ack_sequence = ulog_data.msg_sequence;
-				_ack_received = false;
-				unlock();
+		if (ulog_data.timestamp == 0) {
+			continue;
+		}
+
+		const bool need_ack = ulog_data.flags & ulog_stream_s::FLAGS_NEED_ACK;
+
+		lock();
+		const bool send = accept_message(ulog_data);
+
+		if (send && need_ack) {
+			for (PendingMessage &pending : _pending) {
+				if (!pending.used) {
+					pending.data = ulog_data;
+					pending.last_sent = hrt_absolute_time();
+					pending.tries = 1;
+					pending.used = true;
+					break;
+				}
+			}
+		}
 
-				mavlink_logging_data_acked_t msg;
-				msg.sequence = ulog_data.msg_sequence;
-				msg.length = ulog_data.length;
-				msg.first_message_offset = ulog_data.first_message_offset;
-				msg.target_system = _target_system;
-				msg.target_component = _target_component;
-				memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-				mavlink_msg_logging_data_acked_send_struct(channel, &msg);
-
-			} else {
-				mavlink_logging_data_t msg;
-				msg.sequence = ulog_data.msg_sequence;
-				msg.length = ulog_data.length;
-				msg.first_message_offset = ulog_data.first_message_offset;
-				msg.target_system = _target_system;
-				msg.target_component = _target_component;
-				memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-				mavlink_msg_logging_data_send_struct(channel, &msg);
+		_last_read_sequence = ulog_data.msg_sequence;
+		_have_read = true;
+
+		if (need_ack) {
+			if (!_acks_pending) {
+				_acked_sequence = ulog_data.msg_sequence - 1;
+				_latest_reliable_sequence = ulog_data.msg_sequence;
+				_acks_pending = true;
+
+			} else if ((int16_t)(ulog_data.msg_sequence - _latest_reliable_sequence) > 0) {
+				_latest_reliable_sequence = ulog_data.msg_sequence;
 			}
 		}
 
+		update_acks();
+		unlock();
+
+		if (!send) {
+			continue;
+		}
+
+		if (need_ack) {
+			send_acked(channel, ulog_data);
+
+		} else {
+			mavlink_logging_data_t msg;
+			msg.sequence = ulog_data.msg_sequence;
+			msg.length = ulog_data.length;
+			msg.first_message_offset = ulog_data.first_message_offset;
+			msg.target_system = _target_system;
+			msg.target_component = _target_component;
+			memcpy(msg.data, ulog_data.data, sizeof(msg.data));
+			mavlink_msg_logging_data_send_struct(channel, &msg);
+		}
+
 		++_current_num_msgs;
 	}
 
@@ -180,22 +261,75 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 	hrt_abstime t = hrt_absolute_time();
 
 	if (t > _next_rate_check) {
-		if (_current_num_msgs < _max_num_messages) {
-			_current_rate_factor = _max_rate_factor * (float)_current_num_msgs / _max_num_messages;
+		if (_current_num_msgs < max_num_messages) {
+			_current_rate_factor = maximum_data_rate() * (float)_current_num_msgs / max_num_messages;
 
 		} else {
-			_current_rate_factor = _max_rate_factor;
+			_current_rate_factor = maximum_data_rate();
 		}
 
 		_current_num_msgs = 0;
 		_next_rate_check = t + _rate_calculation_delta_t;
-		PX4_DEBUG("current rate=%.3f (max=%i msgs in %.3fs)", (double)_current_rate_factor, _max_num_messages,
+		PX4_DEBUG("current rate=%.3f (max=%i msgs in %.3fs)", (double)_current_rate_factor, max_num_messages,
 			  (double)(_rate_calculation_delta_t / 1e6));
 	}
 
 	return 0;
 }
 
+bool MavlinkULog::done_sequence(uint16_t &sequence) const
+{
+	if (!_have_read) {
+		return false;
+	}
+
+	// everything before the oldest pending message is done
+	bool have_pending = false;
+	uint16_t oldest_age = 0;
+
+	for (const PendingMessage &pending : _pending) {
+		if (pending.used) {
+			const uint16_t age = _last_read_sequence - pending.data.msg_sequence;
+
+			if (!have_pending || age > oldest_age) {
+				oldest_age = age;
+				have_pending = true;
+			}
+		}
+	}
+
+	sequence = have_pending ? _last_read_sequence - oldest_age - 1 : _last_read_sequence;
+	return true;
+}
+
+void MavlinkULog::update_acks()
+{
+	if (!_acks_pending) {
+		return;
+	}
+
+	// sessions that did not read anything yet do not hold back the others
+	uint16_t done = _latest_reliable_sequence;
+
+	for (const MavlinkULog *session : _sessions) {
+		uint16_t sequence;
+
+		if (session && session->done_sequence(sequence) && (int16_t)(sequence - done) < 0) {
+			done = sequence;
+		}
+	}
+
+	if ((int16_t)(done - _acked_sequence) > 0) {
+		ulog_stream_ack_s ack;
+		ack.timestamp = hrt_absolute_time();
+		ack.msg_sequence = done;
+		_ulog_stream_ack_pub.publish(ack);
+
+		_acked_sequence = done;
+		_acks_pending = done != _latest_reliable_sequence;
+	}
+}
+
 void MavlinkULog::initialize()
 {
 	if (_init) {
@@ -213,11 +347,15 @@ MavlinkULog *MavlinkULog::try_start(int datarate, float max_rate_factor, uint8_t
 	bool failed = false;
 	lock();
 
-	if (!_instance) {
-		ret = _instance = new MavlinkULog(datarate, max_rate_factor, target_system, target_component);
+	for (MavlinkULog *&session : _sessions) {
+		if (!session) {
+			ret = session = new MavlinkULog(datarate, max_rate_factor, target_system, target_component);
 
-		if (!_instance) {
-			failed = true;
+			if (!session) {
+				failed = true;
+			}
+
+			break;
 		}
 	}
 
@@ -230,13 +368,34 @@ MavlinkULog *MavlinkULog::try_start(int datarate, float max_rate_factor, uint8_t
 	return ret;
 }
 
+int MavlinkULog::num_sessions()
+{
+	int num = 0;
+	lock();
+
+	for (const MavlinkULog *session : _sessions) {
+		if (session) {
+			++num;
+		}
+	}
+
+	unlock();
+	return num;
+}
+
 void MavlinkULog::stop()
 {
 	lock();
 
-	if (_instance) {
-		delete _instance;
-		_instance = nullptr;
+	for (MavlinkULog *&session : _sessions) {
+		if (session == this) {
+			session = nullptr;
+
+			// the remaining sessions might be done with messages this one was holding back
+			update_acks();
+			delete this;
+			break;
+		}
 	}
 
 	unlock();
@@ -246,21 +405,31 @@ void MavlinkULog::handle_ack(mavlink_logging_ack_t ack)
 {
 	lock();
 
-	if (_instance) { // make sure stop() was not called right before
-		if (_wait_for_ack_sequence == ack.sequence) {
-			_ack_received = true;
-			publish_ack(ack.sequence);
+	for (const MavlinkULog *session : _sessions) {
+		if (session != this) { // make sure stop() was not called right before
+			continue;
 		}
+
+		for (PendingMessage &pending : _pending) {
+			if (pending.used && pending.data.msg_sequence == ack.sequence) {
+				pending.used = false;
+				update_acks();
+				break;
+			}
+		}
+
+		break;
 	}
 
 	unlock();
 }
 
-void MavlinkULog::publish_ack(uint16_t sequence)
+void MavlinkULog::print_status() const
 {
-	ulog_stream_ack_s ack;
-	ack.timestamp = hrt_absolute_time();
-	ack.msg_sequence = sequence;
+	static constexpr const char *state_str[] = {"waiting for header", "header", "streaming"};
 
-	_ulog_stream_ack_pub.publish(ack);
+	printf("\tULog: %s, rate: %.1f%% of max %.1f%%\n", state_str[(int)_state], (double)_current_rate_factor * 100.,
+	       (double)maximum_data_rate() * 100.);
+	printf("\t  unacked: %i (window %i), retransmissions: %" PRIu32 ", sessions: %i\n", num_pending(),
+	       (int)ulog_stream_ack_s::ACK_WINDOW_MAX, _num_retransmissions, num_sessions());
 }
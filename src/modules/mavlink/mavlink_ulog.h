@@ -45,6 +45,7 @@
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/sem.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 
 #include <uORB/Publication.hpp>
@@ -58,18 +59,27 @@ using namespace time_literals;
 
 /**
  * @class MavlinkULog
- * ULog streaming class. At most one instance (stream) can exist, assigned to a specific mavlink channel.
+ * ULog streaming class. One instance (session) can exist per mavlink channel, up to MAX_SESSIONS at
+ * the same time. All sessions stream the same ulog_stream data: a session joining a running stream
+ * waits for the header the logger re-sends for it, and sessions that are already streaming skip it.
+ * Reliable messages are acked to the logger once every session is done with them.
  */
 class MavlinkULog
 {
 public:
+#if defined(CONSTRAINED_MEMORY)
+	static constexpr int MAX_SESSIONS = 1;
+#else
+	static constexpr int MAX_SESSIONS = 3;
+#endif
+
 	/**
 	 * initialize: call this once on startup (this function is not thread-safe!)
 	 */
 	static void initialize();
 
 	/**
-	 * try to start a new stream. This fails if a stream is already running.
+	 * try to start a new stream. This fails if MAX_SESSIONS are already running.
 	 * thread-safe
 	 * @param datarate maximum link data rate in B/s
 	 * @param max_rate_factor let ulog streaming use a maximum of max_rate_factor * datarate
@@ -79,13 +89,27 @@ public:
 	 */
 	static MavlinkULog *try_start(int datarate, float max_rate_factor, uint8_t target_system, uint8_t target_component);
 
+	/** @return number of running sessions. thread-safe */
+	static int num_sessions();
+
 	/**
-	 * stop the stream. It also deletes the singleton object, so make sure cleanup
+	 * stop the stream. It also deletes the object, so make sure cleanup
 	 * all pointers to it.
 	 * thread-safe
 	 */
 	void stop();
 
+	/**
+	 * Request to stop this session from another thread. handle_update() returns -ECANCELED afterwards, and the
+	 * session has to be stopped by the caller of handle_update().
+	 */
+	void request_stop() { _stop_requested = true; }
+
+	/**
+	 * The client requested to start again: wait for the next header. thread-safe
+	 */
+	void request_header() { _header_requested = true; }
+
 	/**
 	 * periodic update method: check for ulog stream messages and handle retransmission.
 	 * @return 0 on success, <0 otherwise
@@ -98,11 +122,32 @@ public:
 	/** this is called when we got an vehicle_command_ack from the logger */
 	void start_ack_received();
 
+	/**
+	 * Set the link quality [0, 1] (e.g. derived from telemetry_status), which scales the maximum rate of this session.
+	 */
+	void set_link_quality(float link_quality) { _link_quality = math::constrain(link_quality, 0.05f, 1.f); }
+
 	float current_data_rate() const { return _current_rate_factor; }
-	float maximum_data_rate() const { return _max_rate_factor; }
+	float maximum_data_rate() const { return _max_rate_factor * _link_quality; }
+
+	void print_status() const;
 
 private:
 
+	enum class State : uint8_t {
+		WaitForHeader, ///< drop everything until the start of a header
+		Header,        ///< sending the header
+		Streaming      ///< sending data, skipping headers re-sent for other sessions
+	};
+
+	/** a sent message requiring an ack */
+	struct PendingMessage {
+		ulog_stream_s data;
+		hrt_abstime last_sent;
+		uint8_t tries;
+		bool used;
+	};
+
 	MavlinkULog(int datarate, float max_rate_factor, uint8_t target_system, uint8_t target_component);
 
 	~MavlinkULog();
@@ -117,28 +162,50 @@ private:
 		px4_sem_post(&_lock);
 	}
 
-	void publish_ack(uint16_t sequence);
+	/** @return true if the message should be sent by this session (updates the state) */
+	bool accept_message(const ulog_stream_s &ulog_data);
+
+	void send_acked(mavlink_channel_t channel, const ulog_stream_s &ulog_data);
+
+	/**
+	 * Get the sequence up to which this session is done (sent and acked, or skipped).
+	 * @return false if the session did not read anything yet. Requires the lock.
+	 */
+	bool done_sequence(uint16_t &sequence) const;
+
+	/** publish an ack if all sessions are done with new reliable messages. Requires the lock. */
+	void update_acks();
+
+	int num_pending() const;
 
 	static px4_sem_t _lock;
 	static bool _init;
-	static MavlinkULog *_instance;
+	static MavlinkULog *_sessions[MAX_SESSIONS];
+	static uint16_t _latest_reliable_sequence; ///< latest reliable message read by any session
+	static uint16_t _acked_sequence; ///< latest sequence that got acked towards the logger
+	static bool _acks_pending; ///< reliable messages up to _latest_reliable_sequence need an ack
 	static constexpr hrt_abstime _rate_calculation_delta_t = 100_ms; ///< rate update interval
 
 	uORB::SubscriptionData<ulog_stream_s> _ulog_stream_sub{ORB_ID(ulog_stream)};
 	uORB::Publication<ulog_stream_ack_s> _ulog_stream_ack_pub{ORB_ID(ulog_stream_ack)};
-	uint16_t _wait_for_ack_sequence;
-	uint8_t _sent_tries = 0;
-	volatile bool _ack_received = false; ///< set to true if a matching ack received
-	hrt_abstime _last_sent_time = 0; ///< last time we sent a message that requires an ack
+	PendingMessage _pending[ulog_stream_ack_s::ACK_WINDOW_MAX] {};
+	uint16_t _last_read_sequence{0};
+	bool _have_read{false};
+	State _state{State::WaitForHeader};
+	volatile bool _stop_requested{false};
+	volatile bool _header_requested{false};
+	hrt_abstime _start_time{0};
 	bool _waiting_for_initial_ack = false;
 	const uint8_t _target_system;
 	const uint8_t _target_component;
 
 	const float _max_rate_factor; ///< maximum rate percentage at which we're allowed to push data
 	const int _max_num_messages; ///< maximum number of messages we can send within _rate_calculation_delta_t
+	float _link_quality{1.f}; ///< scales _max_num_messages
 	float _current_rate_factor; ///< currently used rate percentage
 	int _current_num_msgs = 0;  ///< number of messages sent within the current time interval
 	hrt_abstime _next_rate_check; ///< next timestamp at which to update the rate
+	uint32_t _num_retransmissions{0};
 
 	perf_counter_t _msg_missed_ulog_stream_perf{perf_alloc(PC_COUNT, MODULE_NAME": ulog_stream messages missed")};
 
@@ -50,6 +50,10 @@ public:
 	const char *get_name() const override { return get_name_static(); }
 	uint16_t get_id() override { return get_id_static(); }
 
+	Priority get_priority() override { return Priority::High; }
+
+	const orb_metadata *get_trigger_topic() const override { return ORB_ID(vehicle_global_position); }
+
 	unsigned get_size() override
 	{
 		return _gpos_sub.advertised() ? MAVLINK_MSG_ID_GLOBAL_POSITION_INT_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES : 0;
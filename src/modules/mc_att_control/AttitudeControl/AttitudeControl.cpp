@@ -52,9 +52,10 @@ void AttitudeControl::setProportionalGain(const matrix::Vector3f &proportional_g
 	}
 }
 
-matrix::Vector3f AttitudeControl::update(const Quatf &q) const
+matrix::Vector3f AttitudeControl::computeRateSetpoint(const Quatf &q, const Quatf &attitude_setpoint_q,
+		const Vector3f &proportional_gain, const float yaw_w, const float yawspeed_setpoint, const Vector3f &rate_limit)
 {
-	Quatf qd = _attitude_setpoint_q;
+	Quatf qd = attitude_setpoint_q;
 
 	// calculate reduced desired attitude neglecting vehicle's yaw to prioritize roll and pitch
 	const Vector3f e_z = q.dcm_z();
@@ -78,7 +79,7 @@ matrix::Vector3f AttitudeControl::update(const Quatf &q) const
 	// catch numerical problems with the domain of acosf and asinf
 	q_mix(0) = math::constrain(q_mix(0), -1.f, 1.f);
 	q_mix(3) = math::constrain(q_mix(3), -1.f, 1.f);
-	qd = qd_red * Quatf(cosf(_yaw_w * acosf(q_mix(0))), 0, 0, sinf(_yaw_w * asinf(q_mix(3))));
+	qd = qd_red * Quatf(cosf(yaw_w * acosf(q_mix(0))), 0, 0, sinf(yaw_w * asinf(q_mix(3))));
 
 	// quaternion attitude control law, qe is rotation from q to qd
 	const Quatf qe = q.inversed() * qd;
@@ -88,7 +89,7 @@ matrix::Vector3f AttitudeControl::update(const Quatf &q) const
 	const Vector3f eq = 2.f * qe.canonical().imag();
 
 	// calculate angular rates setpoint
-	Vector3f rate_setpoint = eq.emult(_proportional_gain);
+	Vector3f rate_setpoint = eq.emult(proportional_gain);
 
 	// Feed forward the yaw setpoint rate.
 	// yawspeed_setpoint is the feed forward commanded rotation around the world z-axis,
@@ -97,13 +98,13 @@ matrix::Vector3f AttitudeControl::update(const Quatf &q) const
 	// and multiply it by the yaw setpoint rate (yawspeed_setpoint).
 	// This yields a vector representing the commanded rotatation around the world z-axis expressed in the body frame
 	// such that it can be added to the rates setpoint.
-	if (std::isfinite(_yawspeed_setpoint)) {
-		rate_setpoint += q.inversed().dcm_z() * _yawspeed_setpoint;
+	if (std::isfinite(yawspeed_setpoint)) {
+		rate_setpoint += q.inversed().dcm_z() * yawspeed_setpoint;
 	}
 
 	// limit rates
 	for (int i = 0; i < 3; i++) {
-		rate_setpoint(i) = math::constrain(rate_setpoint(i), -_rate_limit(i), _rate_limit(i));
+		rate_setpoint(i) = math::constrain(rate_setpoint(i), -rate_limit(i), rate_limit(i));
 	}
 
 	return rate_setpoint;
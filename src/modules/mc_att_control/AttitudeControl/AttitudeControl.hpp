@@ -98,7 +98,24 @@ public:
 	 * @param q estimation of the current vehicle attitude unit quaternion
 	 * @return [rad/s] body frame 3D angular rate setpoint vector to be executed by the rate controller
 	 */
-	matrix::Vector3f update(const matrix::Quatf &q) const;
+	matrix::Vector3f update(const matrix::Quatf &q) const
+	{
+		return computeRateSetpoint(q, _attitude_setpoint_q, _proportional_gain, _yaw_w, _yawspeed_setpoint, _rate_limit);
+	}
+
+	/**
+	 * Stateless attitude control law shared with the batched controller
+	 * @param q estimation of the current vehicle attitude unit quaternion
+	 * @param qd normalized attitude setpoint
+	 * @param proportional_gain gains for roll, pitch, yaw (yaw compensated for the yaw weight)
+	 * @param yaw_w yaw weight [0,1]
+	 * @param yawspeed_setpoint [rad/s] yaw feed forward angular rate in world frame
+	 * @param rate_limit [rad/s] limits for roll, pitch, yaw
+	 * @return [rad/s] body frame 3D angular rate setpoint vector
+	 */
+	static matrix::Vector3f computeRateSetpoint(const matrix::Quatf &q, const matrix::Quatf &qd,
+			const matrix::Vector3f &proportional_gain, const float yaw_w, const float yawspeed_setpoint,
+			const matrix::Vector3f &rate_limit);
 
 private:
 	matrix::Vector3f _proportional_gain;
@@ -0,0 +1,142 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file AttitudeControlBatch.hpp
+ *
+ * Attitude controller for a batch of N vehicles in structure of arrays layout,
+ * e.g. to run many simulated vehicles in one process.
+ * Uses the same control law as AttitudeControl.
+ */
+
+#pragma once
+
+#include "AttitudeControl.hpp"
+
+#include <mathlib/math/Functions.hpp>
+
+template<int N>
+class AttitudeControlBatch
+{
+public:
+	static_assert(N > 0, "batch needs at least one vehicle");
+
+	AttitudeControlBatch()
+	{
+		// identity setpoint like AttitudeControl
+		for (int vehicle = 0; vehicle < N; vehicle++) {
+			_attitude_setpoint_q[0][vehicle] = 1.f;
+		}
+	}
+
+	~AttitudeControlBatch() = default;
+
+	static constexpr int size() { return N; }
+
+	/**
+	 * Set proportional attitude control gain of one vehicle
+	 * @see AttitudeControl::setProportionalGain()
+	 */
+	void setProportionalGain(int vehicle, const matrix::Vector3f &proportional_gain, const float yaw_weight)
+	{
+		_yaw_w[vehicle] = math::constrain(yaw_weight, 0.f, 1.f);
+
+		for (int axis = 0; axis < 3; axis++) {
+			_proportional_gain[axis][vehicle] = proportional_gain(axis);
+		}
+
+		// compensate for the effect of the yaw weight rescaling the output
+		if (_yaw_w[vehicle] > 1e-4f) {
+			_proportional_gain[2][vehicle] /= _yaw_w[vehicle];
+		}
+	}
+
+	/**
+	 * Set hard limit for output rate setpoints of one vehicle
+	 * @see AttitudeControl::setRateLimit()
+	 */
+	void setRateLimit(int vehicle, const matrix::Vector3f &rate_limit)
+	{
+		for (int axis = 0; axis < 3; axis++) {
+			_rate_limit[axis][vehicle] = rate_limit(axis);
+		}
+	}
+
+	/**
+	 * Set the attitude setpoint of one vehicle
+	 * @see AttitudeControl::setAttitudeSetpoint()
+	 */
+	void setAttitudeSetpoint(int vehicle, const matrix::Quatf &qd, const float yawspeed_setpoint)
+	{
+		const matrix::Quatf qd_normalized = qd.normalized();
+
+		for (int i = 0; i < 4; i++) {
+			_attitude_setpoint_q[i][vehicle] = qd_normalized(i);
+		}
+
+		_yawspeed_setpoint[vehicle] = yawspeed_setpoint;
+	}
+
+	/**
+	 * Run one control loop cycle for all vehicles of the batch
+	 * @param q current attitude unit quaternions, q[component][vehicle]
+	 * @param rate_setpoint [rad/s] output body frame angular rate setpoints, rate_setpoint[axis][vehicle]
+	 */
+	void update(const float q[4][N], float rate_setpoint[3][N]) const
+	{
+		for (int vehicle = 0; vehicle < N; vehicle++) {
+			const matrix::Quatf q_vehicle(q[0][vehicle], q[1][vehicle], q[2][vehicle], q[3][vehicle]);
+			const matrix::Quatf qd(_attitude_setpoint_q[0][vehicle], _attitude_setpoint_q[1][vehicle],
+					       _attitude_setpoint_q[2][vehicle], _attitude_setpoint_q[3][vehicle]);
+			const matrix::Vector3f gain(_proportional_gain[0][vehicle], _proportional_gain[1][vehicle],
+						    _proportional_gain[2][vehicle]);
+			const matrix::Vector3f rate_limit(_rate_limit[0][vehicle], _rate_limit[1][vehicle], _rate_limit[2][vehicle]);
+
+			const matrix::Vector3f rate_sp = AttitudeControl::computeRateSetpoint(q_vehicle, qd, gain, _yaw_w[vehicle],
+							 _yawspeed_setpoint[vehicle], rate_limit);
+
+			for (int axis = 0; axis < 3; axis++) {
+				rate_setpoint[axis][vehicle] = rate_sp(axis);
+			}
+		}
+	}
+
+private:
+	float _proportional_gain[3][N] {};
+	float _rate_limit[3][N] {};
+	float _yaw_w[N] {}; ///< yaw weight [0,1] to deprioritize compared to roll and pitch
+
+	float _attitude_setpoint_q[4][N] {}; ///< latest known attitude setpoints
+	float _yawspeed_setpoint[N] {}; ///< latest known yawspeed feed-forward setpoints
+};
@@ -0,0 +1,78 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <AttitudeControlBatch.hpp>
+
+using namespace matrix;
+
+TEST(AttitudeControlBatchTest, MatchesScalarController)
+{
+	static constexpr int N = 9;
+	AttitudeControlBatch<N> batch;
+	AttitudeControl scalar[N];
+	float q[4][N];
+	float rate_setpoint[3][N];
+
+	for (int vehicle = 0; vehicle < N; vehicle++) {
+		const Vector3f gain(6.5f + vehicle, 6.5f, 2.8f);
+		const float yaw_weight = 0.1f * vehicle;
+		const Vector3f rate_limit(3.8f, 3.8f, 1.f + vehicle);
+		const Quatf qd(Eulerf(0.1f * vehicle, -0.2f, 0.4f * vehicle));
+		const float yawspeed = (vehicle % 3 == 0) ? NAN : 0.1f * vehicle;
+
+		batch.setProportionalGain(vehicle, gain, yaw_weight);
+		batch.setRateLimit(vehicle, rate_limit);
+		batch.setAttitudeSetpoint(vehicle, qd, yawspeed);
+		scalar[vehicle].setProportionalGain(gain, yaw_weight);
+		scalar[vehicle].setRateLimit(rate_limit);
+		scalar[vehicle].setAttitudeSetpoint(qd, yawspeed);
+
+		const Quatf q_vehicle(Eulerf(-0.3f * vehicle, 0.05f * vehicle, -0.5f));
+
+		for (int i = 0; i < 4; i++) {
+			q[i][vehicle] = q_vehicle(i);
+		}
+	}
+
+	batch.update(q, rate_setpoint);
+
+	for (int vehicle = 0; vehicle < N; vehicle++) {
+		const Vector3f expected = scalar[vehicle].update(Quatf(q[0][vehicle], q[1][vehicle], q[2][vehicle], q[3][vehicle]));
+
+		for (int axis = 0; axis < 3; axis++) {
+			EXPECT_FLOAT_EQ(rate_setpoint[axis][vehicle], expected(axis));
+		}
+	}
+}
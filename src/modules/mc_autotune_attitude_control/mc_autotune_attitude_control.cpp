@@ -45,6 +45,7 @@ McAutotuneAttitudeControl::McAutotuneAttitudeControl() :
 	ModuleParams(nullptr),
 	WorkItem(MODULE_NAME, px4::wq_configurations::hp_default)
 {
+	pthread_mutex_init(&_model_mutex, nullptr);
 	_autotune_attitude_control_status_pub.advertise();
 	reset();
 }
@@ -52,6 +53,9 @@ McAutotuneAttitudeControl::McAutotuneAttitudeControl() :
 McAutotuneAttitudeControl::~McAutotuneAttitudeControl()
 {
 	perf_free(_cycle_perf);
+	perf_free(_model_update_perf);
+	perf_free(_model_samples_dropped_perf);
+	pthread_mutex_destroy(&_model_mutex);
 }
 
 bool McAutotuneAttitudeControl::init()
@@ -71,11 +75,39 @@ void McAutotuneAttitudeControl::reset()
 	_param_mc_at_start.reset();
 }
 
+void McAutotuneAttitudeControl::resetModel()
+{
+	// _model_mutex held: drop the samples of the previous axis with the model
+	_sys_id.reset();
+	_model_samples.clear();
+}
+
+void McAutotuneAttitudeControl::processModelSamples()
+{
+	LockGuard lg{_model_mutex};
+
+	perf_begin(_model_update_perf);
+
+	ModelSample sample;
+
+	while (_model_samples.pop(sample)) {
+		_sys_id.updateModel(sample.u, sample.y);
+	}
+
+	perf_end(_model_update_perf);
+}
+
 void McAutotuneAttitudeControl::Run()
 {
 	if (should_exit()) {
 		_parameter_update_sub.unregisterCallback();
 		_vehicle_torque_setpoint_sub.unregisterCallback();
+		_model_update_work_item.ScheduleClear();
+
+		// wait for a running model update to finish
+		pthread_mutex_lock(&_model_mutex);
+		pthread_mutex_unlock(&_model_mutex);
+
 		exit_and_cleanup();
 		return;
 	}
@@ -88,6 +120,8 @@ void McAutotuneAttitudeControl::Run()
 
 		// update parameters from storage
 		updateParams();
+
+		LockGuard lg{_model_mutex};
 		updateStateMachine(hrt_absolute_time());
 	}
 
@@ -155,12 +189,19 @@ void McAutotuneAttitudeControl::Run()
 				      angular_velocity.xyz[2]);
 	}
 
-	// Update the model at a lower frequency
+	// Update the model at a lower frequency, in batches outside of this work queue
 	_model_update_counter++;
 
 	if (_model_update_counter >= _model_update_scaler) {
 		if ((_state == state::roll) || (_state == state::pitch) || (_state == state::yaw)) {
-			_sys_id.update();
+			if (!_model_samples.push({_sys_id.getFilteredInputData(), _sys_id.getFilteredOutputData()})) {
+				perf_count(_model_samples_dropped_perf);
+			}
+
+			if (_model_samples.size() >= MODEL_UPDATE_BATCH) {
+				_model_update_work_item.ScheduleNow();
+			}
+
 			_last_model_update = hrt_absolute_time();
 		}
 
@@ -168,6 +209,8 @@ void McAutotuneAttitudeControl::Run()
 	}
 
 	if (hrt_elapsed_time(&_last_publish) > _publishing_dt_hrt || _last_publish == 0) {
+		LockGuard lg{_model_mutex};
+
 		const hrt_abstime now = hrt_absolute_time();
 		updateStateMachine(now);
 
@@ -253,6 +296,7 @@ void McAutotuneAttitudeControl::checkFilters()
 			_model_update_scaler = math::max(int(model_dt / _filter_dt), 1);
 			model_dt = _model_update_scaler * _filter_dt;
 
+			LockGuard lg{_model_mutex};
 			_sys_id.setForgettingFactor(60.f, model_dt);
 			_sys_id.setFitnessLpfTimeConstant(1.f, model_dt);
 
@@ -288,7 +332,7 @@ void McAutotuneAttitudeControl::updateStateMachine(hrt_abstime now)
 		if (_are_filters_initialized) {
 			_state = state::roll;
 			_state_start_time = now;
-			_sys_id.reset();
+			resetModel();
 			// first step needs to be shorter to keep the drone centered
 			_steps_counter = 5;
 			_max_steps = 10;
@@ -316,7 +360,7 @@ void McAutotuneAttitudeControl::updateStateMachine(hrt_abstime now)
 		if ((now - _state_start_time) > 2_s) {
 			_state = state::pitch;
 			_state_start_time = now;
-			_sys_id.reset();
+			resetModel();
 			_input_scale = 1.f / (_param_mc_pitchrate_p.get() * _param_mc_pitchrate_k.get());
 			_signal_filter.reset(0.f);
 			_signal_sign = 1;
@@ -341,7 +385,7 @@ void McAutotuneAttitudeControl::updateStateMachine(hrt_abstime now)
 		if ((now - _state_start_time) > 2_s) {
 			_state = state::yaw;
 			_state_start_time = now;
-			_sys_id.reset();
+			resetModel();
 			_input_scale = 1.f / (_param_mc_yawrate_p.get() * _param_mc_yawrate_k.get());
 			_signal_filter.reset(0.f);
 			_signal_sign = 1;
@@ -366,7 +410,7 @@ void McAutotuneAttitudeControl::updateStateMachine(hrt_abstime now)
 		if ((now - _state_start_time) > 2_s) {
 			_state = state::verification;
 			_state_start_time = now;
-			_sys_id.reset();
+			resetModel();
 			_signal_filter.reset(0.f);
 			_signal_sign = 1;
 			_steps_counter = 5;
@@ -657,6 +701,8 @@ int McAutotuneAttitudeControl::custom_command(int argc, char *argv[])
 int McAutotuneAttitudeControl::print_status()
 {
 	perf_print_counter(_cycle_perf);
+	perf_print_counter(_model_update_perf);
+	perf_print_counter(_model_samples_dropped_perf);
 
 	return 0;
 }
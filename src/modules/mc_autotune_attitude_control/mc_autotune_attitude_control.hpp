@@ -39,6 +39,7 @@
 
 #pragma once
 
+#include <containers/LockGuard.hpp>
 #include <drivers/drv_hrt.h>
 #include <lib/perf/perf_counter.h>
 #include <lib/pid_design/pid_design.hpp>
@@ -87,6 +88,10 @@ private:
 	void Run() override;
 
 	void reset();
+	void resetModel();
+
+	/** Run the RLS updates for the queued samples, called on lp_default */
+	void processModelSamples();
 
 	void checkFilters();
 
@@ -112,7 +117,38 @@ private:
 
 	uORB::PublicationData<autotune_attitude_control_status_s> _autotune_attitude_control_status_pub{ORB_ID(autotune_attitude_control_status)};
 
+	/**
+	 * The filters run at the sample rate in Run(), the model updates are queued
+	 * and processed in batches on lp_default by this work item.
+	 * _model_mutex protects the model state of _sys_id.
+	 */
+	class ModelUpdateWorkItem : public px4::WorkItem
+	{
+	public:
+		explicit ModelUpdateWorkItem(McAutotuneAttitudeControl &parent) :
+			WorkItem(MODULE_NAME"_model", px4::wq_configurations::lp_default),
+			_parent(parent)
+		{}
+
+		using px4::WorkItem::ScheduleClear;
+
+	private:
+		void Run() override { _parent.processModelSamples(); }
+
+		McAutotuneAttitudeControl &_parent;
+	};
+
+	struct ModelSample {
+		float u;
+		float y;
+	};
+
+	static constexpr uint32_t MODEL_UPDATE_BATCH = 8;
+
 	SystemIdentification _sys_id;
+	SampleRing<ModelSample, 64> _model_samples;
+	ModelUpdateWorkItem _model_update_work_item{*this};
+	pthread_mutex_t _model_mutex{};
 
 	enum class state {
 		idle = autotune_attitude_control_status_s::STATE_IDLE,
@@ -175,6 +211,8 @@ private:
 	int _model_update_counter{0};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle time")};
+	perf_counter_t _model_update_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": model update")};
+	perf_counter_t _model_samples_dropped_perf{perf_alloc(PC_COUNT, MODULE_NAME": model samples dropped")};
 
 	DEFINE_PARAMETERS(
 		(ParamBool<px4::params::MC_AT_START>) _param_mc_at_start,
@@ -43,10 +43,23 @@ using matrix::sign;
 
 void ZeroOrderHoverThrustEkf::predict(const float dt)
 {
+	// the loop runs at a nearly constant rate, only recompute the gains when the interval
+	// changes by more than the scheduling jitter
+	if (fabsf(dt - _dt) > _dt_tolerance * _dt) {
+		_dt = dt;
+		updateDtDependentGains();
+	}
+
 	// State is constant
 	// Predict state covariance only
-	_state_var += _process_var * dt * dt;
-	_dt = dt;
+	_state_var += _process_var_dt2;
+}
+
+void ZeroOrderHoverThrustEkf::updateDtDependentGains()
+{
+	_process_var_dt2 = _process_var * _dt * _dt;
+	_lpf_alpha = _dt / (_lpf_time_constant + _dt);
+	_noise_alpha = _dt / (_noise_learning_time_constant + _dt);
 }
 
 void ZeroOrderHoverThrustEkf::fuseAccZ(const float acc_z, const float thrust)
@@ -111,7 +124,7 @@ inline float ZeroOrderHoverThrustEkf::computeKalmanGain(const float H, const flo
 
 inline float ZeroOrderHoverThrustEkf::computeInnovTestRatio(const float innov, const float innov_var) const
 {
-	return innov * innov / (_gate_size * _gate_size * innov_var);
+	return innov * innov / (_gate_size_sq * innov_var);
 }
 
 inline bool ZeroOrderHoverThrustEkf::isTestRatioPassing(const float innov_test_ratio) const
@@ -136,12 +149,12 @@ inline bool ZeroOrderHoverThrustEkf::isLargeOffsetDetected() const
 
 inline void ZeroOrderHoverThrustEkf::bumpStateVariance()
 {
-	_state_var += 1e3f * _process_var * _dt * _dt;
+	_state_var += 1e3f * _process_var_dt2;
 }
 
 inline void ZeroOrderHoverThrustEkf::updateLpf(const float residual, const float signed_innov_test_ratio)
 {
-	const float alpha = _dt / (_lpf_time_constant + _dt);
+	const float alpha = _lpf_alpha;
 	_residual_lpf = (1.f - alpha) * _residual_lpf + alpha * residual;
 	_signed_innov_test_ratio_lpf = (1.f - alpha) * _signed_innov_test_ratio_lpf + alpha * math::constrain(
 					       signed_innov_test_ratio, -1.f, 1.f);
@@ -149,7 +162,7 @@ inline void ZeroOrderHoverThrustEkf::updateLpf(const float residual, const float
 
 inline void ZeroOrderHoverThrustEkf::updateMeasurementNoise(const float residual, const float H)
 {
-	const float alpha = _dt / (_noise_learning_time_constant + _dt);
+	const float alpha = _noise_alpha;
 	const float res_no_bias = residual - _residual_lpf;
 	const float P = _state_var;
 	_acc_var = math::constrain((1.f - alpha) * _acc_var  + alpha * (res_no_bias * res_no_bias + H * P * H), 1.f, 400.f);
@@ -79,10 +79,14 @@ public:
 	void fuseAccZ(float acc_z, float thrust);
 
 	void setHoverThrust(float hover_thrust) { _hover_thr = math::constrain(hover_thrust, 0.1f, 0.9f); }
-	void setProcessNoiseStdDev(float process_noise) { _process_var = process_noise * process_noise; }
+	void setProcessNoiseStdDev(float process_noise)
+	{
+		_process_var = process_noise * process_noise;
+		updateDtDependentGains();
+	}
 	void setMeasurementNoiseScale(float scale) { _acc_var_scale = scale * scale; }
 	void setHoverThrustStdDev(float hover_thrust_noise) { _state_var = hover_thrust_noise * hover_thrust_noise; }
-	void setAccelInnovGate(float gate_size) { _gate_size = gate_size; }
+	void setAccelInnovGate(float gate_size) { _gate_size_sq = gate_size * gate_size; }
 	void setMinHoverThrust(float hover_thrust_min) { _hover_thr_min = hover_thrust_min; }
 	void setMaxHoverThrust(float hover_thrust_max) { _hover_thr_max = hover_thrust_max; }
 
@@ -98,13 +102,18 @@ private:
 	float _hover_thr_min{0.1f};
 	float _hover_thr_max{0.9f};
 
-	float _gate_size{3.f};
+	float _gate_size_sq{9.f};
 	float _state_var{0.01f}; ///< Initial hover thrust uncertainty variance (thrust^2)
 	float _process_var{12.5e-6f}; ///< Hover thrust process noise variance (thrust^2/s^2)
 	float _acc_var{5.f}; ///< Acceleration variance (m^2/s^3)
 	float _acc_var_scale{1.f}; ///< Multiplicator of the measurement variance, used to decrease sensivity
 	float _dt{0.02f};
 
+	// only depend on dt and the parameters, recomputed when one of them changes
+	float _process_var_dt2{12.5e-6f * 0.02f * 0.02f}; ///< Process noise variance added at each prediction (thrust^2)
+	float _lpf_alpha{0.02f / (1.f + 0.02f)};
+	float _noise_alpha{0.02f / (2.f + 0.02f)};
+
 	float _innov{0.f}; ///< Measurement innovation (m/s^2)
 	float _innov_var{0.f}; ///< Measurement innovation variance (m^2/s^3)
 	float _innov_test_ratio{0.f}; ///< Noramlized Innovation Squared test ratio
@@ -130,10 +139,12 @@ private:
 	void updateStateCovariance(float K, float H);
 	bool isLargeOffsetDetected() const;
 
+	void updateDtDependentGains();
 	void bumpStateVariance();
 	void updateLpf(float residual, float signed_innov_test_ratio);
 	void updateMeasurementNoise(float residual, float H);
 
 	static constexpr float _noise_learning_time_constant = 2.f; ///< in seconds
 	static constexpr float _lpf_time_constant = 1.f; ///< in seconds
+	static constexpr float _dt_tolerance = 0.05f; ///< relative change of dt that triggers a recomputation of the gains
 };
@@ -64,6 +64,9 @@ bool MulticopterPositionControl::init()
 		return false;
 	}
 
+	// run ahead of other items on the same queue (e.g. navigator) on a new estimate
+	SetDeadline(5_ms);
+
 	_time_stamp_last_loop = hrt_absolute_time();
 	ScheduleNow();
 
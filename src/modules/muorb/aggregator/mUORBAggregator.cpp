@@ -32,10 +32,56 @@
  ****************************************************************************/
 
 #include <px4_platform_common/log.h>
+#include <uORB/topics/uORBTopics.hpp>
 #include "mUORBAggregator.hpp"
 
 const bool mUORB::Aggregator::debugFlag = false;
 
+// Topics the remote side uses for control or estimation, they are sent without waiting for the buffer to fill
+static const char *const immediateTopics[] = {
+	"sensor_accel",
+	"sensor_accel_fifo",
+	"sensor_gyro",
+	"sensor_gyro_fifo",
+	"vehicle_imu",
+	"vehicle_angular_velocity",
+	"vehicle_attitude",
+};
+
+const std::pair<const std::string, mUORB::Aggregator::TopicPolicy> &mUORB::Aggregator::GetTopicPolicy(
+	const char *topic)
+{
+	auto it = topicPolicies.find(topic);
+
+	if (it != topicPolicies.end()) {
+		return *it;
+	}
+
+	TopicPolicy policy{defaultLatencyBudgetUs, false};
+
+	for (const char *immediate : immediateTopics) {
+		if (strcmp(topic, immediate) == 0) {
+			policy.latency_budget_us = 0;
+		}
+	}
+
+	if (policy.latency_budget_us > 0) {
+		const orb_metadata *const *topics = orb_get_topics();
+
+		for (size_t i = 0; i < orb_topics_count(); i++) {
+			if (strcmp(topics[i]->o_name, topic) == 0) {
+				// Without a queue the remote subscribers only see the latest sample anyway
+				policy.coalesce = (topics[i]->o_queue <= 1);
+				break;
+			}
+		}
+	}
+
+	if (debugFlag) { PX4_INFO("Topic %s latency budget %u us%s", topic, policy.latency_budget_us, policy.coalesce ? ", coalesced" : ""); }
+
+	return *topicPolicies.emplace(topic, policy).first;
+}
+
 bool mUORB::Aggregator::NewRecordOverflows(const char *messageName, int32_t length)
 {
 	if (! messageName) { return false; }
@@ -45,11 +91,30 @@ bool mUORB::Aggregator::NewRecordOverflows(const char *messageName, int32_t leng
 	return ((bufferWriteIndex + newMessageRecordTotalLength) > bufferSize);
 }
 
+bool mUORB::Aggregator::CoalesceRecord(const char *policyName, int32_t length, const uint8_t *data)
+{
+	for (uint32_t i = 0; i < numCoalesceRecords; i++) {
+		Record &record = coalesceRecords[i];
+
+		if ((record.name == policyName) && (record.data_length == length)) {
+			memcpy(&buffer[bufferId][record.data_index], data, length);
+			_stats.coalesced++;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void mUORB::Aggregator::MoveToNextBuffer()
 {
 	bufferWriteIndex = 0;
 	bufferId++;
 	bufferId %= numBuffers;
+
+	bufferDeadline = 0;
+	bufferRecords = 0;
+	numCoalesceRecords = 0;
 }
 
 void mUORB::Aggregator::AddRecordToBuffer(const char *messageName, int32_t length, const uint8_t *data)
@@ -67,6 +132,8 @@ void mUORB::Aggregator::AddRecordToBuffer(const char *messageName, int32_t lengt
 	bufferWriteIndex += messageNameLength;
 	memcpy(&buffer[bufferId][bufferWriteIndex], data, length);
 	bufferWriteIndex += length;
+
+	bufferRecords++;
 }
 
 int16_t mUORB::Aggregator::SendData()
@@ -77,6 +144,17 @@ int16_t mUORB::Aggregator::SendData()
 		if (aggregationEnabled) {
 			if (bufferWriteIndex) {
 				rc = sendFunc(topicName.c_str(), buffer[bufferId], bufferWriteIndex);
+
+				const uint32_t latency = hrt_elapsed_time(&bufferFirstRecordTime);
+
+				_stats.batches++;
+				_stats.records += bufferRecords;
+				_stats.bytes += bufferWriteIndex;
+
+				if (bufferWriteIndex > _stats.max_fill) { _stats.max_fill = bufferWriteIndex; }
+
+				if (latency > _stats.max_latency_us) { _stats.max_latency_us = latency; }
+
 				MoveToNextBuffer();
 			}
 		}
@@ -85,18 +163,65 @@ int16_t mUORB::Aggregator::SendData()
 	return rc;
 }
 
+int16_t mUORB::Aggregator::SendDataIfDue(hrt_abstime now)
+{
+	if (bufferWriteIndex && (now >= bufferDeadline)) {
+		_stats.flush_deadline++;
+		return SendData();
+	}
+
+	return 0;
+}
+
+void mUORB::Aggregator::PrintStats(const Stats &stats)
+{
+	PX4_INFO("aggregator: %u batches, %u records (%u coalesced), avg fill %u / %u B, max fill %u B",
+		 stats.batches, stats.records, stats.coalesced,
+		 stats.batches ? static_cast<uint32_t>(stats.bytes / stats.batches) : 0, bufferSize, stats.max_fill);
+	PX4_INFO("aggregator: flushes full %u, immediate %u, deadline %u, max latency %u us",
+		 stats.flush_full, stats.flush_immediate, stats.flush_deadline, stats.max_latency_us);
+}
+
 int16_t mUORB::Aggregator::ProcessTransmitTopic(const char *topic, const uint8_t *data, uint32_t length_in_bytes)
 {
 	int16_t rc = 0;
 
 	if (sendFunc) {
-		if (aggregationEnabled) {
+		if (aggregationEnabled && topic) {
+			const auto &policy = GetTopicPolicy(topic);
+			const char *policyName = policy.first.c_str();
+
+			if (policy.second.coalesce && CoalesceRecord(policyName, length_in_bytes, data)) {
+				return 0;
+			}
+
 			if (NewRecordOverflows(topic, length_in_bytes)) {
+				_stats.flush_full++;
 				rc = SendData();
 			}
 
+			const hrt_abstime now = hrt_absolute_time();
+
+			if (bufferWriteIndex == 0) {
+				bufferFirstRecordTime = now;
+			}
+
+			if (policy.second.coalesce && (numCoalesceRecords < maxCoalesceRecords)) {
+				coalesceRecords[numCoalesceRecords++] = Record{policyName,
+							       static_cast<uint16_t>(bufferWriteIndex + headerSize + strlen(topic)),
+							       static_cast<uint16_t>(length_in_bytes)};
+			}
+
 			AddRecordToBuffer(topic, length_in_bytes, data);
 
+			if (policy.second.latency_budget_us == 0) {
+				_stats.flush_immediate++;
+				rc = SendData();
+
+			} else if ((bufferDeadline == 0) || (now + policy.second.latency_budget_us < bufferDeadline)) {
+				bufferDeadline = now + policy.second.latency_budget_us;
+			}
+
 		} else if (topic) {
 			rc = sendFunc(topic, data, length_in_bytes);
 		}
@@ -33,8 +33,10 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <string.h>
+#include <drivers/drv_hrt.h>
 #include "uORB/uORBCommunicator.hpp"
 
 namespace mUORB
@@ -45,6 +47,18 @@ class Aggregator
 public:
 	typedef int (*sendFuncPtr)(const char *, const uint8_t *, int);
 
+	struct Stats {
+		uint32_t batches;              // aggregate buffers sent
+		uint32_t records;              // topic records sent in aggregate buffers
+		uint32_t coalesced;            // records replaced by a newer sample before the buffer was sent
+		uint64_t bytes;                // total bytes of the aggregate buffers sent
+		uint32_t max_fill;             // largest aggregate buffer sent [bytes]
+		uint32_t flush_full;           // flushes because the next record did not fit
+		uint32_t flush_immediate;      // flushes for a topic without latency budget
+		uint32_t flush_deadline;       // flushes because the latency budget of a record expired
+		uint32_t max_latency_us;       // longest time a record waited in the buffer
+	};
+
 	void RegisterSendHandler(sendFuncPtr func) { sendFunc = func; }
 
 	void RegisterHandler(uORBCommunicator::IChannelRxHandler *handler) { _RxHandler = handler; }
@@ -53,8 +67,19 @@ public:
 
 	void ProcessReceivedTopic(const char *topic, const uint8_t *data, uint32_t length_in_bytes);
 
+	// Send the current buffer unconditionally
 	int16_t SendData();
 
+	// Send the current buffer if the latency budget of one of its records expired
+	int16_t SendDataIfDue(hrt_abstime now);
+
+	const Stats &GetStats() const { return _stats; }
+
+	static void PrintStats(const Stats &stats);
+
+	// Period at which SendDataIfDue() should be called, the resolution of the latency budgets
+	static constexpr uint32_t flushCheckIntervalUs = 500;
+
 private:
 	static const bool debugFlag;
 
@@ -71,18 +96,50 @@ private:
 	static const uint32_t numBuffers = 2;
 	static const uint32_t bufferSize = 2048;
 
+	// Maximum time a record waits in the buffer unless its topic has a budget of its own
+	static constexpr uint32_t defaultLatencyBudgetUs = 2000;
+
+	struct TopicPolicy {
+		uint32_t latency_budget_us;    // 0 sends the buffer right after adding the record
+		bool coalesce;                 // only the latest sample is of use (queue length 1), replace it in the buffer
+	};
+
+	// Records of the current buffer that can be coalesced
+	struct Record {
+		const char *name;              // TopicPolicy map key, stable for the lifetime of the aggregator
+		uint16_t data_index;
+		uint16_t data_length;
+	};
+
+	static const uint32_t maxCoalesceRecords = 32;
+
 	uint32_t bufferId;
 	uint32_t bufferWriteIndex;
 	uint8_t  buffer[numBuffers][bufferSize];
 
+	hrt_abstime bufferFirstRecordTime{0};
+	hrt_abstime bufferDeadline{0};
+	uint32_t bufferRecords{0};
+
+	Record coalesceRecords[maxCoalesceRecords];
+	uint32_t numCoalesceRecords{0};
+
+	std::map<std::string, TopicPolicy> topicPolicies;
+
+	Stats _stats{};
+
 	uORBCommunicator::IChannelRxHandler *_RxHandler;
 
 	sendFuncPtr sendFunc;
 
 	bool isAggregate(const char *name) { return (strcmp(name, topicName.c_str()) == 0); }
 
+	const std::pair<const std::string, TopicPolicy> &GetTopicPolicy(const char *topic);
+
 	bool NewRecordOverflows(const char *messageName, int32_t length);
 
+	bool CoalesceRecord(const char *policyName, int32_t length, const uint8_t *data);
+
 	void MoveToNextBuffer();
 
 	void AddRecordToBuffer(const char *messageName, int32_t length, const uint8_t *data);
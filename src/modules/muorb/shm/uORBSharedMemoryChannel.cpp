@@ -0,0 +1,352 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "uORBSharedMemoryChannel.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <px4_platform_common/posix.h>
+#include <px4_platform_common/tasks.h>
+#include <uORB/uORBTopics.h>
+
+using namespace uORB;
+
+SharedMemoryChannel *SharedMemoryChannel::_InstancePtr = nullptr;
+
+bool SharedMemoryChannel::Initialize(const char *segment_name, uint32_t segment_size)
+{
+	if (_header != nullptr) {
+		PX4_INFO("already initialized");
+		return true;
+	}
+
+	if (segment_size < sizeof(shm::Header)) {
+		PX4_ERR("segment size too small (min %zu)", sizeof(shm::Header));
+		return false;
+	}
+
+	int fd = shm_open(segment_name, O_CREAT | O_RDWR, 0660);
+
+	if (fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", segment_name, errno);
+		return false;
+	}
+
+	if (ftruncate(fd, segment_size) != 0) {
+		PX4_ERR("ftruncate failed (%i)", errno);
+		close(fd);
+		return false;
+	}
+
+	void *segment = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (segment == MAP_FAILED) {
+		PX4_ERR("mmap failed (%i)", errno);
+		return false;
+	}
+
+	// PX4 owns the segment: any previous content (and attached peer) is discarded
+	memset(segment, 0, segment_size);
+
+	shm::Header *header = static_cast<shm::Header *>(segment);
+	header->version = shm::VERSION;
+	header->size = segment_size;
+	header->magic.store(shm::MAGIC, std::memory_order_release);
+
+	// receive buffer large enough for any topic
+	const orb_metadata *const *topics = orb_get_topics();
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if (topics[i]->o_size > _rx_buffer_size) {
+			_rx_buffer_size = topics[i]->o_size;
+		}
+	}
+
+	_rx_buffer = new uint8_t[_rx_buffer_size];
+
+	if (_rx_buffer == nullptr) {
+		munmap(segment, segment_size);
+		return false;
+	}
+
+	strncpy(_segment_name, segment_name, sizeof(_segment_name) - 1);
+	_header = header;
+
+	int task_id = px4_task_spawn_cmd("uorb_shm_rx",
+					 SCHED_DEFAULT,
+					 SCHED_PRIORITY_POSITION_CONTROL,
+					 PX4_STACK_ADJUSTED(2048),
+					 (px4_main_t)&SharedMemoryChannel::rx_task_trampoline,
+					 nullptr);
+
+	if (task_id < 0) {
+		PX4_ERR("task start failed");
+		return false;
+	}
+
+	return true;
+}
+
+shm::Topic *SharedMemoryChannel::get_topic(const char *messageName, uint32_t msg_size)
+{
+	const int cache_index = (reinterpret_cast<uintptr_t>(messageName) >> 3) % TOPIC_CACHE_SIZE;
+	shm::Topic *topic = _topic_cache[cache_index].load();
+
+	if (topic != nullptr && strncmp(topic->name, messageName, shm::TOPIC_NAME_LEN) == 0) {
+		return topic;
+	}
+
+	if (msg_size == 0) {
+		const orb_metadata *const *topics = orb_get_topics();
+
+		for (size_t i = 0; i < orb_topics_count(); i++) {
+			if (strcmp(topics[i]->o_name, messageName) == 0) {
+				msg_size = topics[i]->o_size;
+				break;
+			}
+		}
+
+		if (msg_size == 0) {
+			return nullptr;
+		}
+	}
+
+	topic = shm::get_or_create_topic(_header, messageName, msg_size);
+
+	if (topic == nullptr) {
+		PX4_ERR("no space for topic %s", messageName);
+		return nullptr;
+	}
+
+	_topic_cache[cache_index].store(topic);
+	return topic;
+}
+
+int16_t SharedMemoryChannel::topic_advertised(const char *messageName)
+{
+	shm::Topic *topic = initialized() ? get_topic(messageName) : nullptr;
+
+	if (topic == nullptr) {
+		return -1;
+	}
+
+	int32_t publisher = shm::NO_PUBLISHER;
+
+	if (!topic->publisher.compare_exchange_strong(publisher, shm::SIDE_PX4) && (publisher != shm::SIDE_PX4)) {
+		PX4_WARN("%s is already published by the peer", messageName);
+		return -1;
+	}
+
+	shm::ring_doorbell(_header, shm::SIDE_PEER);
+	return 0;
+}
+
+int16_t SharedMemoryChannel::add_subscription(const char *messageName, int32_t msgRateInHz)
+{
+	// This parameter is unused.
+	(void)(msgRateInHz);
+
+	shm::Topic *topic = initialized() ? get_topic(messageName) : nullptr;
+
+	if (topic == nullptr) {
+		return -1;
+	}
+
+	topic->subscribers[shm::SIDE_PX4].fetch_add(1);
+	shm::ring_doorbell(_header, shm::SIDE_PEER);
+	return 0;
+}
+
+int16_t SharedMemoryChannel::remove_subscription(const char *messageName)
+{
+	shm::Topic *topic = initialized() ? get_topic(messageName) : nullptr;
+
+	if (topic == nullptr) {
+		return -1;
+	}
+
+	uint32_t subscribers = topic->subscribers[shm::SIDE_PX4].load();
+
+	while (subscribers > 0 && !topic->subscribers[shm::SIDE_PX4].compare_exchange_weak(subscribers, subscribers - 1)) {}
+
+	shm::ring_doorbell(_header, shm::SIDE_PEER);
+	return 0;
+}
+
+int16_t SharedMemoryChannel::register_handler(uORBCommunicator::IChannelRxHandler *handler)
+{
+	_RxHandler = handler;
+	return 0;
+}
+
+int16_t SharedMemoryChannel::send_message(const char *messageName, int32_t length, uint8_t *data)
+{
+	shm::Topic *topic = initialized() ? get_topic(messageName, length) : nullptr;
+
+	if (topic == nullptr || length < 0) {
+		return -1;
+	}
+
+	if (topic->publisher.load(std::memory_order_relaxed) != shm::SIDE_PX4) {
+		// the topic might have been advertised before the channel was started
+		int32_t publisher = shm::NO_PUBLISHER;
+
+		if (!topic->publisher.compare_exchange_strong(publisher, shm::SIDE_PX4)) {
+			return -1;
+		}
+	}
+
+	shm::write(_header, topic, data, length);
+	_tx_messages.fetch_add(1);
+
+	shm::ring_doorbell(_header, shm::SIDE_PEER);
+	return 0;
+}
+
+int SharedMemoryChannel::rx_task_trampoline(int argc, char *argv[])
+{
+	GetInstance()->rx_task();
+	return 0;
+}
+
+void SharedMemoryChannel::rx_task()
+{
+	uint32_t doorbell = 0;
+
+	while (true) {
+		doorbell = shm::wait_doorbell(_header, shm::SIDE_PX4, doorbell, 100000);
+
+		for (int i = 0; i < shm::MAX_TOPICS; i++) {
+			if (_header->topics[i].state.load(std::memory_order_acquire) == shm::TOPIC_FREE) {
+				break;
+			}
+
+			process_topic(i);
+		}
+	}
+}
+
+void SharedMemoryChannel::process_topic(int index)
+{
+	shm::Topic &topic = _header->topics[index];
+	RxState &state = _rx_state[index];
+
+	if (_RxHandler == nullptr) {
+		return;
+	}
+
+	const bool peer_publishes = (topic.publisher.load(std::memory_order_acquire) == shm::SIDE_PEER);
+
+	if (peer_publishes && !state.advertised) {
+		state.advertised = true;
+
+		// start with the latest message
+		const uint32_t generation = topic.generation.load(std::memory_order_acquire);
+		state.last_generation = (generation > 0) ? generation - 1 : 0;
+
+		_RxHandler->process_remote_topic(topic.name);
+	}
+
+	const bool subscribed = topic.subscribers[shm::SIDE_PEER].load(std::memory_order_acquire) > 0;
+
+	if (subscribed != state.subscribed) {
+		state.subscribed = subscribed;
+
+		if (subscribed) {
+			_RxHandler->process_add_subscription(topic.name);
+
+		} else {
+			_RxHandler->process_remove_subscription(topic.name);
+		}
+	}
+
+	if (!state.advertised) {
+		return;
+	}
+
+	const uint32_t generation = topic.generation.load(std::memory_order_acquire);
+
+	if (generation - state.last_generation > shm::QUEUE_SLOTS) {
+		_rx_lost += generation - state.last_generation - shm::QUEUE_SLOTS;
+		state.last_generation = generation - shm::QUEUE_SLOTS;
+	}
+
+	while (state.last_generation != generation) {
+		uint32_t length = _rx_buffer_size;
+
+		if (shm::read(_header, &topic, state.last_generation, _rx_buffer, length)) {
+			_RxHandler->process_received_message(topic.name, length, _rx_buffer);
+			_rx_messages++;
+
+		} else {
+			_rx_lost++;
+		}
+
+		state.last_generation++;
+	}
+}
+
+void SharedMemoryChannel::print_status()
+{
+	if (!initialized()) {
+		PX4_INFO("not initialized");
+		return;
+	}
+
+	PX4_INFO("segment: %s, %u/%u bytes used", _segment_name,
+		 (unsigned)(_header->data_used.load() + sizeof(shm::Header)), (unsigned)_header->size);
+	PX4_INFO("tx: %u, rx: %u, rx lost: %u", (unsigned)_tx_messages.load(), (unsigned)_rx_messages, (unsigned)_rx_lost);
+
+	PX4_INFO_RAW("%-*s %9s %5s %8s %8s\n", shm::TOPIC_NAME_LEN / 2, "TOPIC", "PUBLISHER", "SIZE", "SUBS_PX4", "SUBS_PEER");
+
+	for (int i = 0; i < shm::MAX_TOPICS; i++) {
+		const shm::Topic &topic = _header->topics[i];
+
+		if (topic.state.load() == shm::TOPIC_FREE) {
+			break;
+		}
+
+		const int32_t publisher = topic.publisher.load();
+
+		PX4_INFO_RAW("%-*s %9s %5u %8u %8u\n", shm::TOPIC_NAME_LEN / 2, topic.name,
+			     (publisher == shm::SIDE_PX4) ? "px4" : ((publisher == shm::SIDE_PEER) ? "peer" : "-"),
+			     (unsigned)topic.msg_size, (unsigned)topic.subscribers[shm::SIDE_PX4].load(),
+			     (unsigned)topic.subscribers[shm::SIDE_PEER].load());
+	}
+}
@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/log.h>
+
+#include "uORB/uORBCommunicator.hpp"
+#include "uORBSharedMemoryLayout.hpp"
+
+namespace uORB
+{
+class SharedMemoryChannel;
+}
+
+/**
+ * uORB communicator channel exchanging topics with other processes on the
+ * same host through a POSIX shared memory segment (see uORBSharedMemoryLayout.hpp).
+ */
+class uORB::SharedMemoryChannel : public uORBCommunicator::IChannel
+{
+public:
+	/**
+	 * static method to get the IChannel Implementor.
+	 */
+	static uORB::SharedMemoryChannel *GetInstance()
+	{
+		if (_InstancePtr == nullptr) {
+			_InstancePtr = new uORB::SharedMemoryChannel();
+		}
+
+		return _InstancePtr;
+	}
+
+	/**
+	 * Static method to check if there is an instance.
+	 */
+	static bool isInstance()
+	{
+		return (_InstancePtr != nullptr);
+	}
+
+	/**
+	 * Create (or re-initialize) and map the shared memory segment and start the receive thread.
+	 * @param segment_name name passed to shm_open()
+	 * @param segment_size size of the segment in bytes
+	 * @return true on success
+	 */
+	bool Initialize(const char *segment_name, uint32_t segment_size);
+
+	bool initialized() const { return _header != nullptr; }
+
+	void print_status();
+
+	int16_t topic_advertised(const char *messageName) override;
+
+	int16_t add_subscription(const char *messageName, int32_t msgRateInHz) override;
+
+	int16_t remove_subscription(const char *messageName) override;
+
+	int16_t register_handler(uORBCommunicator::IChannelRxHandler *handler) override;
+
+	int16_t send_message(const char *messageName, int32_t length, uint8_t *data) override;
+
+private:
+	SharedMemoryChannel() = default;
+
+	/**
+	 * Get the topic entry, creating it if needed.
+	 * @param msg_size message size, 0 to look it up in the uORB metadata
+	 */
+	shm::Topic *get_topic(const char *messageName, uint32_t msg_size = 0);
+
+	static int rx_task_trampoline(int argc, char *argv[]);
+	void rx_task();
+
+	/** Handle control state changes and new data of the peer side */
+	void process_topic(int index);
+
+	static uORB::SharedMemoryChannel *_InstancePtr;
+
+	shm::Header *_header{nullptr};
+	char _segment_name[32] {};
+
+	uORBCommunicator::IChannelRxHandler *_RxHandler{nullptr};
+
+	// lookup cache, indexed by a hash of the message name pointer (the uORB metadata passes static strings)
+	static constexpr int TOPIC_CACHE_SIZE = 64;
+	px4::atomic<shm::Topic *> _topic_cache[TOPIC_CACHE_SIZE] {};
+
+	// receive side state, only accessed from the receive thread
+	struct RxState {
+		bool advertised;
+		bool subscribed;
+		uint32_t last_generation;
+	};
+
+	RxState _rx_state[shm::MAX_TOPICS] {};
+
+	uint8_t *_rx_buffer{nullptr};
+	uint32_t _rx_buffer_size{0};
+
+	px4::atomic<uint32_t> _tx_messages{0};
+	uint32_t _rx_messages{0};
+	uint32_t _rx_lost{0};
+};
@@ -0,0 +1,302 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file uORBSharedMemoryLayout.hpp
+ *
+ * Layout of the shared memory segment used by the uORB shared memory channel.
+ *
+ * This header only depends on the C++ standard library, so that processes
+ * outside of PX4 can include it to map the segment, read topics published by
+ * PX4 and publish topics back.
+ *
+ * Each topic has a ring of QUEUE_SLOTS message slots with a single writer.
+ * The writer protects each slot with a sequence number (odd while writing),
+ * readers copy the slot and retry if the sequence changed in the meantime.
+ * Control information (publisher, subscriber counts) is kept as state in the
+ * topic entry. After any change the writing side rings the doorbell of the
+ * other side, which then scans the topic table.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace uORB
+{
+namespace shm
+{
+
+static constexpr uint32_t MAGIC = 0x50583453; // "PX4S"
+static constexpr uint32_t VERSION = 1;
+
+static constexpr const char *DEFAULT_SEGMENT_NAME = "/px4_uorb";
+static constexpr uint32_t DEFAULT_SEGMENT_SIZE = 1024 * 1024;
+
+static constexpr int MAX_TOPICS = 128;
+static constexpr int TOPIC_NAME_LEN = 64;
+static constexpr uint32_t QUEUE_SLOTS = 4; // must be a power of 2
+
+enum Side : uint32_t {
+	SIDE_PX4 = 0,
+	SIDE_PEER = 1,
+	SIDE_COUNT = 2
+};
+
+static constexpr int32_t NO_PUBLISHER = -1;
+
+enum TopicState : uint32_t {
+	TOPIC_FREE = 0,
+	TOPIC_READY = 1
+};
+
+struct Slot {
+	std::atomic<uint32_t> sequence; ///< 2 * (generation + 1) once complete, odd while being written
+	uint32_t length;
+	// followed by the message data
+};
+
+struct Topic {
+	std::atomic<uint32_t> state;
+	char name[TOPIC_NAME_LEN];
+	uint32_t msg_size;                          ///< maximum message size
+	uint32_t slot_stride;                       ///< size of a slot including the header
+	uint32_t data_offset;                       ///< offset of the first slot from the segment start
+	std::atomic<int32_t> publisher;             ///< Side publishing the topic, NO_PUBLISHER if none
+	std::atomic<uint32_t> write_lock;           ///< serializes multiple writers of the publishing side
+	std::atomic<uint32_t> generation;           ///< number of completed publications
+	std::atomic<uint32_t> subscribers[SIDE_COUNT];
+};
+
+struct Header {
+	std::atomic<uint32_t> magic;                ///< written last by PX4 once the segment is initialized
+	uint32_t version;
+	uint32_t size;                              ///< total size of the segment
+	std::atomic<uint32_t> table_lock;           ///< protects topic creation
+	std::atomic<uint32_t> data_used;            ///< bytes allocated in the data area
+	std::atomic<uint32_t> doorbell[SIDE_COUNT]; ///< incremented to notify a side of any change
+	Topic topics[MAX_TOPICS];
+	// followed by the data area
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "lock-free atomics required for shared memory");
+
+static constexpr uint32_t align_up(uint32_t value) { return (value + 7u) & ~7u; }
+
+static inline Slot *slot_at(Header *header, const Topic *topic, uint32_t generation)
+{
+	uint8_t *base = reinterpret_cast<uint8_t *>(header) + topic->data_offset;
+	return reinterpret_cast<Slot *>(base + (generation & (QUEUE_SLOTS - 1)) * topic->slot_stride);
+}
+
+static inline uint8_t *slot_data(Slot *slot)
+{
+	return reinterpret_cast<uint8_t *>(slot + 1);
+}
+
+static inline void lock(std::atomic<uint32_t> &lock_word)
+{
+	uint32_t expected = 0;
+
+	while (!lock_word.compare_exchange_weak(expected, 1, std::memory_order_acquire)) {
+		expected = 0;
+	}
+}
+
+static inline void unlock(std::atomic<uint32_t> &lock_word)
+{
+	lock_word.store(0, std::memory_order_release);
+}
+
+/**
+ * Notify a side of a change in the segment (new data, publisher or subscribers).
+ */
+static inline void ring_doorbell(Header *header, Side side)
+{
+	header->doorbell[side].fetch_add(1, std::memory_order_release);
+#if defined(__linux__)
+	syscall(SYS_futex, reinterpret_cast<uint32_t *>(&header->doorbell[side]), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+/**
+ * Wait until the doorbell of a side differs from last_value, or the timeout passes.
+ * @return current doorbell value
+ */
+static inline uint32_t wait_doorbell(Header *header, Side side, uint32_t last_value, uint32_t timeout_us)
+{
+	uint32_t value = header->doorbell[side].load(std::memory_order_acquire);
+
+	if (value == last_value) {
+#if defined(__linux__)
+		struct timespec timeout {static_cast<time_t>(timeout_us / 1000000), static_cast<long>((timeout_us % 1000000) * 1000)};
+		syscall(SYS_futex, reinterpret_cast<uint32_t *>(&header->doorbell[side]), FUTEX_WAIT, last_value, &timeout, nullptr, 0);
+#else
+		struct timespec timeout {0, 1000 * 1000};
+		nanosleep(&timeout, nullptr);
+#endif
+		value = header->doorbell[side].load(std::memory_order_acquire);
+	}
+
+	return value;
+}
+
+static inline Topic *find_topic(Header *header, const char *name)
+{
+	for (int i = 0; i < MAX_TOPICS; i++) {
+		Topic *topic = &header->topics[i];
+
+		if (topic->state.load(std::memory_order_acquire) == TOPIC_FREE) {
+			// entries are allocated in order, so there are no more topics
+			break;
+		}
+
+		if (strncmp(topic->name, name, TOPIC_NAME_LEN) == 0) {
+			return topic;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Find a topic, or create it if it does not exist yet.
+ * @return topic, nullptr if the table or the data area is full
+ */
+static inline Topic *get_or_create_topic(Header *header, const char *name, uint32_t msg_size)
+{
+	Topic *topic = find_topic(header, name);
+
+	if (topic != nullptr) {
+		return (topic->msg_size >= msg_size) ? topic : nullptr;
+	}
+
+	lock(header->table_lock);
+
+	// check again, the other side might have created it in the meantime
+	topic = find_topic(header, name);
+
+	if (topic == nullptr) {
+		for (int i = 0; i < MAX_TOPICS; i++) {
+			if (header->topics[i].state.load(std::memory_order_relaxed) == TOPIC_FREE) {
+				const uint32_t stride = align_up(sizeof(Slot) + msg_size);
+				const uint32_t used = header->data_used.load(std::memory_order_relaxed);
+				const uint32_t data_start = align_up(sizeof(Header));
+
+				if (data_start + used + stride * QUEUE_SLOTS <= header->size) {
+					topic = &header->topics[i];
+					strncpy(topic->name, name, TOPIC_NAME_LEN - 1);
+					topic->msg_size = msg_size;
+					topic->slot_stride = stride;
+					topic->data_offset = data_start + used;
+					topic->publisher.store(NO_PUBLISHER, std::memory_order_relaxed);
+					header->data_used.store(used + stride * QUEUE_SLOTS, std::memory_order_relaxed);
+					topic->state.store(TOPIC_READY, std::memory_order_release);
+				}
+
+				break;
+			}
+		}
+	}
+
+	unlock(header->table_lock);
+
+	return (topic != nullptr && topic->msg_size >= msg_size) ? topic : nullptr;
+}
+
+/**
+ * Publish a message. Only the publishing side of the topic may call this.
+ */
+static inline void write(Header *header, Topic *topic, const void *data, uint32_t length)
+{
+	lock(topic->write_lock);
+
+	const uint32_t generation = topic->generation.load(std::memory_order_relaxed);
+	Slot *slot = slot_at(header, topic, generation);
+
+	slot->sequence.store(2 * generation + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot->length = length;
+	memcpy(slot_data(slot), data, length);
+
+	slot->sequence.store(2 * (generation + 1), std::memory_order_release);
+	topic->generation.store(generation + 1, std::memory_order_release);
+
+	unlock(topic->write_lock);
+}
+
+/**
+ * Copy the message with the given generation.
+ * @param length in: size of dst, out: message length
+ * @return false if the message was overwritten (or is being written)
+ */
+static inline bool read(Header *header, const Topic *topic, uint32_t generation, void *dst, uint32_t &length)
+{
+	Slot *slot = slot_at(header, topic, generation);
+
+	const uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+	if (sequence != 2 * (generation + 1)) {
+		return false;
+	}
+
+	const uint32_t slot_length = slot->length;
+
+	if (slot_length > length || slot_length > topic->msg_size) {
+		return false;
+	}
+
+	memcpy(dst, slot_data(slot), slot_length);
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	if (slot->sequence.load(std::memory_order_relaxed) != sequence) {
+		return false;
+	}
+
+	length = slot_length;
+	return true;
+}
+
+} // namespace shm
+} // namespace uORB
@@ -0,0 +1,125 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/module.h>
+
+#include "uORBSharedMemoryChannel.hpp"
+#include "uORB/uORBManager.hpp"
+
+extern "C" __EXPORT int uorb_shm_main(int argc, char *argv[]);
+
+static void usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+uORB communicator channel to exchange topics with other processes running on the same host
+(e.g. ROS 2 nodes or a vision pipeline) through a POSIX shared memory segment.
+
+External processes map the segment with the layout defined in `uORBSharedMemoryLayout.hpp`
+(only depends on the C++ standard library). PX4 topics with a subscriber in an external
+process are copied into a ring buffer in the segment on each publication, and topics
+published by an external process are published into uORB by a receive thread.
+
+PX4 (re-)initializes the segment on startup, so external processes need to attach after that.
+The channel should be started early, as topics advertised before are not announced to the peer.
+It cannot be stopped.
+
+### Examples
+$ uorb_shm start -n /px4_uorb -s 2048
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("uorb_shm", "communication");
+	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_PARAM_STRING('n', uORB::shm::DEFAULT_SEGMENT_NAME, nullptr, "Shared memory segment name", true);
+	PRINT_MODULE_USAGE_PARAM_INT('s', uORB::shm::DEFAULT_SEGMENT_SIZE / 1024, 64, 65536, "Segment size in kB", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print the topics in the segment");
+}
+
+int uorb_shm_main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		usage();
+		return -1;
+	}
+
+	if (!strcmp(argv[1], "start")) {
+		const char *segment_name = uORB::shm::DEFAULT_SEGMENT_NAME;
+		uint32_t segment_size = uORB::shm::DEFAULT_SEGMENT_SIZE;
+
+		int myoptind = 1;
+		int ch;
+		const char *myoptarg = nullptr;
+
+		while ((ch = px4_getopt(argc, argv, "n:s:", &myoptind, &myoptarg)) != EOF) {
+			switch (ch) {
+			case 'n':
+				segment_name = myoptarg;
+				break;
+
+			case 's':
+				segment_size = strtoul(myoptarg, nullptr, 10) * 1024;
+				break;
+
+			default:
+				usage();
+				return -1;
+			}
+		}
+
+		uORB::SharedMemoryChannel *channel = uORB::SharedMemoryChannel::GetInstance();
+
+		if (channel && channel->Initialize(segment_name, segment_size)) {
+			uORB::Manager::get_instance()->set_uorb_communicator(channel);
+			return 0;
+		}
+
+		return -1;
+	}
+
+	if (!strcmp(argv[1], "status")) {
+		if (uORB::SharedMemoryChannel::isInstance()) {
+			uORB::SharedMemoryChannel::GetInstance()->print_status();
+
+		} else {
+			PX4_INFO("not running");
+		}
+
+		return 0;
+	}
+
+	usage();
+	return -1;
+}
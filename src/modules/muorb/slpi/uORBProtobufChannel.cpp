@@ -49,6 +49,8 @@
 
 #include "hrt_work.h"
 
+using namespace time_literals;
+
 // Definition of test to run when in muorb test mode
 static MUORBTestType test_to_run;
 
@@ -80,11 +82,25 @@ static void aggregator_thread_func(void *ptr)
 
 	uORB::ProtobufChannel *muorb = uORB::ProtobufChannel::GetInstance();
 
+#if defined(CONFIG_MUORB_SLPI_AGGREGATOR_STATS)
+	hrt_abstime last_stats = hrt_absolute_time();
+#endif
+
 	while (true) {
-		// Check for timeout. Send buffer if timeout happened.
+		// Check for timeout. Send buffer if the latency budget of a record expired.
 		muorb->SendAggregateData();
 
-		qurt_timer_sleep(2000);
+#if defined(CONFIG_MUORB_SLPI_AGGREGATOR_STATS)
+
+		// Print outside of the tx lock, the log messages are sent to the apps side as well
+		if (hrt_elapsed_time(&last_stats) > 10_s) {
+			mUORB::Aggregator::PrintStats(muorb->GetAggregatorStats());
+			last_stats = hrt_absolute_time();
+		}
+
+#endif
+
+		qurt_timer_sleep(mUORB::Aggregator::flushCheckIntervalUs);
 	}
 
 	qurt_thread_exit(QURT_EOK);
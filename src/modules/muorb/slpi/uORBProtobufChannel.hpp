@@ -157,10 +157,18 @@ public:
 	void SendAggregateData()
 	{
 		pthread_mutex_lock(&_tx_mutex);
-		_Aggregator.SendData();
+		_Aggregator.SendDataIfDue(hrt_absolute_time());
 		pthread_mutex_unlock(&_tx_mutex);
 	}
 
+	mUORB::Aggregator::Stats GetAggregatorStats()
+	{
+		pthread_mutex_lock(&_tx_mutex);
+		mUORB::Aggregator::Stats stats = _Aggregator.GetStats();
+		pthread_mutex_unlock(&_tx_mutex);
+		return stats;
+	}
+
 private:
 	/**
 	 * Data Members
@@ -75,6 +75,16 @@ public:
 		}
 	}
 
+	float distanceToFenceBreachAlongPath(double lat_start, double lon_start, double lat_end, double lon_end,
+					     float altitude) override
+	{
+		if (_probe_function_behavior == ProbeFunction::GF_BOUNDARY_20M_AHEAD) {
+			return _gf_boundary_is_20m_north_along_path(lat_start, lon_start, lat_end, lon_end);
+		}
+
+		return Geofence::distanceToFenceBreachAlongPath(lat_start, lon_start, lat_end, lon_end, altitude);
+	}
+
 	enum class ProbeFunction {
 		ALL_POINTS_OUTSIDE = 0,
 		LEFT_INSIDE_RIGHT_OUTSIDE,
@@ -133,4 +143,23 @@ private:
 
 		return true;
 	}
+
+	float _gf_boundary_is_20m_north_along_path(double lat_start, double lon_start, double lat_end, double lon_end)
+	{
+		matrix::Vector2<double> home_global(42.1, 8.2);
+
+		MapProjection projection{home_global(0), home_global(1)};
+		const matrix::Vector2f start_local = projection.project(lat_start, lon_start);
+		const matrix::Vector2f end_local = projection.project(lat_end, lon_end);
+
+		if (start_local(0) >= 20.0f) {
+			return 0.f;
+		}
+
+		if (end_local(0) < 20.0f) {
+			return -1.f;
+		}
+
+		return (20.0f - start_local(0)) / (end_local(0) - start_local(0)) * (end_local - start_local).norm();
+	}
 };
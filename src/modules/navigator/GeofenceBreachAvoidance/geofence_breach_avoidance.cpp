@@ -152,26 +152,16 @@ GeofenceBreachAvoidance::generateLoiterPointForMultirotor(geofence_violation_typ
 {
 
 	if (violation_type.flags.fence_violation) {
-		float current_distance = _test_point_distance * 0.5f;
-		float current_min = 0.0f;
-		float current_max = _test_point_distance;
-		Vector2d test_point;
+		// distance from the drone to the geofence in the given direction
+		const Vector2d path_end = getFenceViolationTestPoint();
+		float current_distance = geofence->distanceToFenceBreachAlongPath(_current_pos_lat_lon(0), _current_pos_lat_lon(1),
+					 path_end(0), path_end(1), _current_alt_amsl);
 
-		// binary search for the distance from the drone to the geofence in the given direction
-		while (fabsf(current_max - current_min) > 0.5f) {
-			test_point = waypointFromBearingAndDistance(_current_pos_lat_lon, _test_point_bearing, current_distance);
-
-			if (!geofence->isInsidePolygonOrCircle(test_point(0), test_point(1), _current_alt_amsl)) {
-				current_max = current_distance;
-
-			} else {
-				current_min = current_distance;
-			}
-
-			current_distance = (current_max + current_min) * 0.5f;
+		if (current_distance < 0.f) {
+			current_distance = _test_point_distance;
 		}
 
-		test_point = waypointFromBearingAndDistance(_current_pos_lat_lon, _test_point_bearing, current_distance);
+		const Vector2d test_point = waypointFromBearingAndDistance(_current_pos_lat_lon, _test_point_bearing, current_distance);
 
 		if (_multirotor_braking_distance > current_distance - _min_hor_dist_to_fence_mc) {
 			return waypointFromBearingAndDistance(test_point, _test_point_bearing + M_PI_F, _min_hor_dist_to_fence_mc);
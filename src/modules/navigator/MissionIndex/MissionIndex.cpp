@@ -0,0 +1,272 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MissionIndex.cpp
+ */
+
+#include "MissionIndex.hpp"
+
+#include <float.h>
+
+MissionIndex::~MissionIndex()
+{
+	delete[] _entries;
+	delete[] _tree;
+}
+
+bool MissionIndex::reset(const mission_s &mission)
+{
+	_valid = false;
+	_num_entries = 0;
+
+	if (mission.count > _capacity) {
+		delete[] _entries;
+		delete[] _tree;
+		_entries = new Entry[mission.count];
+		_tree = new uint16_t[mission.count];
+
+		if (_entries == nullptr || _tree == nullptr) {
+			delete[] _entries;
+			delete[] _tree;
+			_entries = nullptr;
+			_tree = nullptr;
+			_capacity = 0;
+			return false;
+		}
+
+		_capacity = mission.count;
+	}
+
+	_mission_id = mission.mission_id;
+	_dataman_id = mission.mission_dataman_id;
+	_count = mission.count;
+
+	return true;
+}
+
+void MissionIndex::addItem(int32_t seq, const mission_item_s &item)
+{
+	if (_num_entries >= _capacity) {
+		return;
+	}
+
+	if (_num_entries == 0) {
+		_projection.initReference(item.lat, item.lon);
+	}
+
+	Entry &entry = _entries[_num_entries];
+	_projection.project(item.lat, item.lon, entry.x, entry.y);
+	entry.alt = item.altitude;
+	entry.seq = static_cast<uint16_t>(seq);
+	entry.flags = (item.altitude_is_relative ? FLAG_ALT_RELATIVE : 0) | (item.nav_cmd == NAV_CMD_LAND ? FLAG_LAND : 0);
+	entry.dist = 0.f;
+
+	if (_num_entries > 0) {
+		const Entry &previous = _entries[_num_entries - 1];
+		entry.dist = previous.dist + sqrtf((entry.x - previous.x) * (entry.x - previous.x) +
+						   (entry.y - previous.y) * (entry.y - previous.y));
+	}
+
+	_tree[_num_entries] = _num_entries;
+	++_num_entries;
+}
+
+void MissionIndex::build()
+{
+	buildTree(0, _num_entries, 0);
+	_valid = true;
+}
+
+bool MissionIndex::isValidFor(const mission_s &mission) const
+{
+	return _valid && (_mission_id == mission.mission_id) && (_dataman_id == mission.mission_dataman_id)
+	       && (_count == mission.count);
+}
+
+void MissionIndex::buildTree(uint16_t lo, uint16_t hi, uint8_t depth)
+{
+	if (hi - lo < 2) {
+		return;
+	}
+
+	const uint16_t mid = lo + (hi - lo) / 2;
+
+	// quickselect the median along the split axis into the middle of the range
+	uint16_t left = lo;
+	uint16_t right = hi - 1;
+
+	while (left < right) {
+		// pivot on the middle element, missions are often already sorted along an axis
+		const uint16_t center = left + (right - left) / 2;
+		const uint16_t swap = _tree[center];
+		_tree[center] = _tree[right];
+		_tree[right] = swap;
+
+		const float pivot = axisValue(_tree[right], depth);
+		uint16_t store = left;
+
+		for (uint16_t i = left; i < right; ++i) {
+			if (axisValue(_tree[i], depth) < pivot) {
+				const uint16_t tmp = _tree[i];
+				_tree[i] = _tree[store];
+				_tree[store] = tmp;
+				++store;
+			}
+		}
+
+		const uint16_t tmp = _tree[right];
+		_tree[right] = _tree[store];
+		_tree[store] = tmp;
+
+		if (store == mid) {
+			break;
+
+		} else if (store < mid) {
+			left = store + 1;
+
+		} else {
+			right = store - 1;
+		}
+	}
+
+	buildTree(lo, mid, depth + 1);
+	buildTree(mid + 1, hi, depth + 1);
+}
+
+void MissionIndex::searchTree(uint16_t lo, uint16_t hi, uint8_t depth, float x, float y, float alt, float home_alt,
+			      bool ignore_land, float &best_dist_sq, int32_t &best_seq) const
+{
+	if (lo >= hi) {
+		return;
+	}
+
+	const uint16_t mid = lo + (hi - lo) / 2;
+	const Entry &entry = _entries[_tree[mid]];
+
+	if (!(ignore_land && (entry.flags & FLAG_LAND))) {
+		const float dx = entry.x - x;
+		const float dy = entry.y - y;
+		const float dz = absoluteAlt(entry, home_alt) - alt;
+		const float dist_sq = dx * dx + dy * dy + dz * dz;
+
+		// on a tie keep the first item of the mission, like the linear search
+		if ((dist_sq < best_dist_sq) || (!(dist_sq > best_dist_sq) && (entry.seq < best_seq))) {
+			best_dist_sq = dist_sq;
+			best_seq = entry.seq;
+		}
+	}
+
+	const float split = ((depth & 1) ? y : x) - axisValue(_tree[mid], depth);
+	const bool near_is_low = split < 0.f;
+
+	searchTree(near_is_low ? lo : mid + 1, near_is_low ? mid : hi, depth + 1, x, y, alt, home_alt, ignore_land,
+		   best_dist_sq, best_seq);
+
+	// the distance to the splitting plane is a lower bound for the 3D distance of the far side
+	if (!(split * split > best_dist_sq)) {
+		searchTree(near_is_low ? mid + 1 : lo, near_is_low ? hi : mid, depth + 1, x, y, alt, home_alt, ignore_land,
+			   best_dist_sq, best_seq);
+	}
+}
+
+int32_t MissionIndex::closestItem(double lat, double lon, float alt, float home_alt, bool ignore_land) const
+{
+	if (!_valid || _num_entries == 0) {
+		return -1;
+	}
+
+	float x;
+	float y;
+	_projection.project(lat, lon, x, y);
+
+	float best_dist_sq = FLT_MAX;
+	int32_t best_seq = -1;
+	searchTree(0, _num_entries, 0, x, y, alt, home_alt, ignore_land, best_dist_sq, best_seq);
+
+	return best_seq;
+}
+
+uint16_t MissionIndex::lowerBound(int32_t seq) const
+{
+	uint16_t lo = 0;
+	uint16_t hi = _num_entries;
+
+	while (lo < hi) {
+		const uint16_t mid = lo + (hi - lo) / 2;
+
+		if (_entries[mid].seq < seq) {
+			lo = mid + 1;
+
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+float MissionIndex::distanceAlongMission(int32_t from_seq, int32_t to_seq) const
+{
+	if (!_valid) {
+		return 0.f;
+	}
+
+	const uint16_t first = lowerBound(from_seq);
+	const uint16_t end = lowerBound(to_seq + 1);
+
+	if (first >= _num_entries || end <= first + 1) {
+		return 0.f;
+	}
+
+	return _entries[end - 1].dist - _entries[first].dist;
+}
+
+int32_t MissionIndex::nextPosition(int32_t seq, float home_alt, double &lat, double &lon, float &alt) const
+{
+	if (!_valid) {
+		return -1;
+	}
+
+	const uint16_t i = lowerBound(seq);
+
+	if (i >= _num_entries) {
+		return -1;
+	}
+
+	_projection.reproject(_entries[i].x, _entries[i].y, lat, lon);
+	alt = absoluteAlt(_entries[i], home_alt);
+
+	return _entries[i].seq;
+}
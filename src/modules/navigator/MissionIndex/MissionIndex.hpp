@@ -0,0 +1,163 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file MissionIndex.hpp
+ *
+ * In-memory index of the position items of the mission, so that the closest item and the distance
+ * along the mission can be queried without reading the mission items from the dataman.
+ */
+
+#pragma once
+
+#include "../navigation.h"
+
+#include <lib/geo/geo.h>
+#include <uORB/topics/mission.h>
+
+class MissionIndex
+{
+public:
+	MissionIndex() = default;
+	~MissionIndex();
+
+	MissionIndex(const MissionIndex &) = delete;
+	MissionIndex &operator=(const MissionIndex &) = delete;
+
+	/**
+	 * @brief Start a new index for the given mission, drops the previous one.
+	 *
+	 * The position items have to be added in mission order with addItem(), then the index is
+	 * finished with build().
+	 *
+	 * @param[in] mission The mission the index is built for
+	 * @return true if the memory for the index could be allocated
+	 */
+	bool reset(const mission_s &mission);
+
+	/**
+	 * @brief Add the next position item of the mission.
+	 *
+	 * @param[in] seq Index of the item in the mission
+	 * @param[in] item The mission item, it has to contain a position
+	 */
+	void addItem(int32_t seq, const mission_item_s &item);
+
+	/**
+	 * @brief Build the spatial index over the added items and mark the index valid.
+	 */
+	void build();
+
+	void invalidate() { _valid = false; }
+
+	/**
+	 * @return true if the index is built for the given mission
+	 */
+	bool isValidFor(const mission_s &mission) const;
+
+	/**
+	 * @brief Find the position item closest to a position.
+	 *
+	 * Same metric as MissionBase::setMissionToClosestItem(): the horizontal distance combined with
+	 * the altitude difference to the absolute altitude of the item.
+	 *
+	 * @param[in] lat latitude of the position
+	 * @param[in] lon longitude of the position
+	 * @param[in] alt AMSL altitude of the position
+	 * @param[in] home_alt altitude of the home position, for the items with relative altitude
+	 * @param[in] ignore_land do not consider NAV_CMD_LAND items
+	 * @return mission index of the closest item, -1 if there is none
+	 */
+	int32_t closestItem(double lat, double lon, float alt, float home_alt, bool ignore_land) const;
+
+	/**
+	 * @brief Horizontal distance of the mission path between two mission indexes.
+	 *
+	 * The path goes from the first position item at or after from_seq to the last position item at or
+	 * before to_seq, jumps are not followed.
+	 *
+	 * @return distance [m], 0 if there is no segment in between
+	 */
+	float distanceAlongMission(int32_t from_seq, int32_t to_seq) const;
+
+	/**
+	 * @brief Position of the first position item at or after a mission index.
+	 *
+	 * @param[in] seq Mission index to start the search from
+	 * @param[in] home_alt altitude of the home position, for the items with relative altitude
+	 * @param[out] lat latitude of the item
+	 * @param[out] lon longitude of the item
+	 * @param[out] alt AMSL altitude of the item
+	 * @return mission index of the item, -1 if there is none
+	 */
+	int32_t nextPosition(int32_t seq, float home_alt, double &lat, double &lon, float &alt) const;
+
+	uint16_t size() const { return _num_entries; }
+
+private:
+	struct Entry {
+		float x;		///< [m] north of the reference
+		float y;		///< [m] east of the reference
+		float alt;		///< [m] altitude as stored in the item
+		float dist;		///< [m] horizontal distance along the mission from the first position item
+		uint16_t seq;		///< index of the item in the mission
+		uint8_t flags;
+	};
+
+	static constexpr uint8_t FLAG_ALT_RELATIVE = (1 << 0);
+	static constexpr uint8_t FLAG_LAND = (1 << 1);
+
+	/* Build the k-d tree over _tree[lo, hi) splitting on the axis of the given depth */
+	void buildTree(uint16_t lo, uint16_t hi, uint8_t depth);
+	void searchTree(uint16_t lo, uint16_t hi, uint8_t depth, float x, float y, float alt, float home_alt,
+			bool ignore_land, float &best_dist_sq, int32_t &best_seq) const;
+
+	/* First entry with a mission index at or after seq, _num_entries if there is none */
+	uint16_t lowerBound(int32_t seq) const;
+
+	float axisValue(uint16_t entry, uint8_t depth) const { return (depth & 1) ? _entries[entry].y : _entries[entry].x; }
+	float absoluteAlt(const Entry &entry, float home_alt) const { return (entry.flags & FLAG_ALT_RELATIVE) ? entry.alt + home_alt : entry.alt; }
+
+	Entry *_entries{nullptr};	///< position items in mission order
+	uint16_t *_tree{nullptr};	///< entries ordered as an implicit k-d tree
+	uint16_t _capacity{0};
+	uint16_t _num_entries{0};
+
+	MapProjection _projection{};
+
+	uint32_t _mission_id{0};
+	uint8_t _dataman_id{0};
+	uint16_t _count{0};
+	bool _valid{false};
+};
@@ -0,0 +1,156 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "MissionIndex.hpp"
+
+#include <float.h>
+#include <stdlib.h>
+
+class MissionIndexTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		srand(42);
+		_mission.mission_id = 1;
+		_mission.mission_dataman_id = 0;
+	}
+
+	void addItems(int count)
+	{
+		_mission.count = count;
+		ASSERT_TRUE(_index.reset(_mission));
+
+		for (int i = 0; i < count; ++i) {
+			mission_item_s &item = _items[i];
+			item = {};
+			item.lat = 47.397 + randomUnit() * 0.01;
+			item.lon = 8.545 + randomUnit() * 0.015;
+			item.altitude = 20.f + 30.f * static_cast<float>(randomUnit());
+			item.altitude_is_relative = (i % 3) != 0;
+			item.nav_cmd = (i % 7 == 0) ? NAV_CMD_LAND : NAV_CMD_WAYPOINT;
+			_index.addItem(i, item);
+		}
+
+		_index.build();
+	}
+
+	static double randomUnit() { return static_cast<double>(rand()) / RAND_MAX; }
+
+	float itemDist(int i, double lat, double lon, float alt, float home_alt) const
+	{
+		float dist_xy, dist_z;
+		const float item_alt = _items[i].altitude_is_relative ? _items[i].altitude + home_alt : _items[i].altitude;
+		return get_distance_to_point_global_wgs84(_items[i].lat, _items[i].lon, item_alt, lat, lon, alt, &dist_xy, &dist_z);
+	}
+
+	static constexpr int MAX_ITEMS = 1000;
+
+	mission_s _mission{};
+	mission_item_s _items[MAX_ITEMS];
+	MissionIndex _index;
+};
+
+TEST_F(MissionIndexTest, emptyIndex)
+{
+	EXPECT_EQ(_index.closestItem(47.397, 8.545, 500.f, 480.f, false), -1);
+	EXPECT_FALSE(_index.isValidFor(_mission));
+
+	addItems(0);
+	EXPECT_TRUE(_index.isValidFor(_mission));
+	EXPECT_EQ(_index.closestItem(47.397, 8.545, 500.f, 480.f, false), -1);
+	EXPECT_FLOAT_EQ(_index.distanceAlongMission(0, 10), 0.f);
+}
+
+TEST_F(MissionIndexTest, closestItemMatchesLinearSearch)
+{
+	addItems(MAX_ITEMS);
+	const float home_alt = 480.f;
+
+	for (int query = 0; query < 200; ++query) {
+		const double lat = 47.39 + randomUnit() * 0.025;
+		const double lon = 8.54 + randomUnit() * 0.03;
+		const float alt = home_alt + 60.f * static_cast<float>(randomUnit());
+		const bool ignore_land = (query % 2) == 0;
+
+		float min_dist = FLT_MAX;
+
+		for (int i = 0; i < MAX_ITEMS; ++i) {
+			if (!(ignore_land && _items[i].nav_cmd == NAV_CMD_LAND)) {
+				min_dist = fminf(min_dist, itemDist(i, lat, lon, alt, home_alt));
+			}
+		}
+
+		const int32_t closest = _index.closestItem(lat, lon, alt, home_alt, ignore_land);
+		ASSERT_GE(closest, 0);
+		EXPECT_FALSE(ignore_land && _items[closest].nav_cmd == NAV_CMD_LAND);
+
+		// the index works in a local projection, allow for the projection error
+		EXPECT_NEAR(itemDist(closest, lat, lon, alt, home_alt), min_dist, 0.01f + min_dist * 1e-3f);
+	}
+}
+
+TEST_F(MissionIndexTest, distanceAlongMission)
+{
+	addItems(100);
+
+	float path = 0.f;
+
+	for (int i = 10; i < 60; ++i) {
+		path += get_distance_to_next_waypoint(_items[i].lat, _items[i].lon, _items[i + 1].lat, _items[i + 1].lon);
+	}
+
+	EXPECT_NEAR(_index.distanceAlongMission(10, 60), path, path * 1e-3f);
+
+	// only a single position item in the range
+	EXPECT_FLOAT_EQ(_index.distanceAlongMission(99, 200), 0.f);
+	EXPECT_FLOAT_EQ(_index.distanceAlongMission(20, 10), 0.f);
+
+	double lat, lon;
+	float alt;
+	EXPECT_EQ(_index.nextPosition(42, 480.f, lat, lon, alt), 42);
+	EXPECT_NEAR(lat, _items[42].lat, 1e-6);
+	EXPECT_NEAR(lon, _items[42].lon, 1e-6);
+	EXPECT_EQ(_index.nextPosition(100, 480.f, lat, lon, alt), -1);
+}
+
+TEST_F(MissionIndexTest, invalidatedByNewMission)
+{
+	addItems(10);
+	EXPECT_TRUE(_index.isValidFor(_mission));
+
+	_mission.mission_id++;
+	EXPECT_FALSE(_index.isValidFor(_mission));
+}
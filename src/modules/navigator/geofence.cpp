@@ -43,11 +43,12 @@
 #include "navigation.h"
 
 #include <ctype.h>
-#include <crc32.h>
+#include <lib/crc/px4_crc.h>
 
 #include <dataman_client/DatamanClient.hpp>
 #include <drivers/drv_hrt.h>
 #include <lib/geo/geo.h>
+#include <lib/geo/geometry_kernels.h>
 #include <systemlib/mavlink_log.h>
 #include <px4_platform_common/events.h>
 
@@ -71,7 +72,7 @@ static uint32_t crc32_for_fence_point(const mission_fence_point_s &fence_point,
 	u.item.params[5] = static_cast<float>(fence_point.lon);
 	u.item.params[6] = fence_point.alt;
 
-	return crc32part(u.raw, sizeof(u), prev_crc32);
+	return px4_crc32(prev_crc32, u.raw, sizeof(u));
 }
 
 Geofence::Geofence(Navigator *navigator) :
@@ -87,9 +88,20 @@ Geofence::Geofence(Navigator *navigator) :
 
 Geofence::~Geofence()
 {
-	if (_polygons) {
-		delete[](_polygons);
-	}
+	clearFenceCache();
+}
+
+void Geofence::clearFenceCache()
+{
+	delete[](_polygons);
+	delete[](_vertices);
+	delete[](_slab_starts);
+	delete[](_slab_edges);
+	_polygons = nullptr;
+	_vertices = nullptr;
+	_slab_starts = nullptr;
+	_slab_edges = nullptr;
+	_num_polygons = 0;
 }
 
 void Geofence::run()
@@ -210,8 +222,9 @@ void Geofence::_updateFence()
 	mission_fence_point_s mission_fence_point;
 	bool is_circle_area = false;
 
+	clearFenceCache();
+
 	// iterate over all polygons and store their starting vertices
-	_num_polygons = 0;
 	int current_seq = 0;
 
 	while (current_seq < _dataman_cache.size()) {
@@ -277,17 +290,7 @@ void Geofence::_updateFence()
 					current_seq += mission_fence_point.vertex_count;
 				}
 
-				// check if requiremetns for Home location are met
-				const bool home_check_okay = checkHomeRequirementsForGeofence(polygon);
-
-				// check if current position is inside the fence and vehicle is armed
-				const bool current_position_check_okay = checkCurrentPositionRequirementsForGeofence(polygon);
-
-				// discard the polygon if at least one check fails by not incrementing the counter in that case
-				if (home_check_okay && current_position_check_okay) {
-					++_num_polygons;
-
-				}
+				++_num_polygons;
 			}
 
 			break;
@@ -298,6 +301,177 @@ void Geofence::_updateFence()
 			break;
 		}
 	}
+
+	if (!buildFenceCache()) {
+		clearFenceCache();
+		return;
+	}
+
+	// discard the polygons for which at least one check fails
+	int num_valid_polygons = 0;
+
+	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		const PolygonInfo &polygon = _polygons[polygon_index];
+
+		// check if requiremetns for Home location are met
+		const bool home_check_okay = checkHomeRequirementsForGeofence(polygon);
+
+		// check if current position is inside the fence and vehicle is armed
+		const bool current_position_check_okay = checkCurrentPositionRequirementsForGeofence(polygon);
+
+		if (home_check_okay && current_position_check_okay) {
+			_polygons[num_valid_polygons++] = polygon;
+		}
+	}
+
+	_num_polygons = num_valid_polygons;
+}
+
+bool Geofence::buildFenceCache()
+{
+	static constexpr int MAX_SLABS = 16;
+	static constexpr int VERTICES_PER_SLAB = 4;
+
+	int num_vertices = 0;
+	int num_slab_starts = 0;
+
+	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		PolygonInfo &polygon = _polygons[polygon_index];
+		const bool is_circle = polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION
+				       || polygon.fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION;
+
+		polygon.vertex_offset = num_vertices;
+		polygon.slab_offset = num_slab_starts;
+		polygon.num_slabs = is_circle ? 0 : math::min(polygon.vertex_count / VERTICES_PER_SLAB + 1, MAX_SLABS);
+
+		num_vertices += is_circle ? 1 : polygon.vertex_count;
+		num_slab_starts += is_circle ? 0 : polygon.num_slabs + 1;
+	}
+
+	if (_num_polygons == 0) {
+		return true;
+	}
+
+	_vertices = new FenceVertex[num_vertices];
+	_slab_starts = new uint16_t[num_slab_starts] {};
+
+	if (!_vertices || !_slab_starts) {
+		PX4_ERR("alloc failed");
+		return false;
+	}
+
+	// copy the vertices and compute the bounding boxes
+	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		PolygonInfo &polygon = _polygons[polygon_index];
+		const int count = (polygon.num_slabs == 0) ? 1 : polygon.vertex_count;
+		polygon.valid_frame = true;
+
+		for (int i = 0; i < count; ++i) {
+			mission_fence_point_s vertex{};
+			bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), polygon.dataman_index + i,
+							       reinterpret_cast<uint8_t *>(&vertex), sizeof(mission_fence_point_s));
+
+			if (!success) {
+				PX4_ERR("loadWait failed, seq: %i", polygon.dataman_index + i);
+				return false;
+			}
+
+			switch (vertex.frame) {
+			case NAV_FRAME_GLOBAL:
+			case NAV_FRAME_GLOBAL_INT:
+			case NAV_FRAME_GLOBAL_RELATIVE_ALT:
+			case NAV_FRAME_GLOBAL_RELATIVE_ALT_INT:
+				break;
+
+			default:
+				// TODO: handle different frames
+				PX4_ERR("Frame type %i not supported", (int)vertex.frame);
+				polygon.valid_frame = false;
+				break;
+			}
+
+			_vertices[polygon.vertex_offset + i] = FenceVertex{vertex.lat, vertex.lon};
+
+			if (i == 0) {
+				polygon.lat_min = polygon.lat_max = vertex.lat;
+				polygon.lon_min = polygon.lon_max = vertex.lon;
+
+			} else {
+				polygon.lat_min = math::min(polygon.lat_min, vertex.lat);
+				polygon.lat_max = math::max(polygon.lat_max, vertex.lat);
+				polygon.lon_min = math::min(polygon.lon_min, vertex.lon);
+				polygon.lon_max = math::max(polygon.lon_max, vertex.lon);
+			}
+		}
+	}
+
+	// count the edges per slab: an edge can toggle the result for all longitudes between its vertices
+	int num_slab_edges = 0;
+
+	for (int pass = 0; pass < 2; ++pass) {
+		for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+			const PolygonInfo &polygon = _polygons[polygon_index];
+			uint16_t *slab_starts = &_slab_starts[polygon.slab_offset];
+
+			for (unsigned i = 0, j = polygon.vertex_count - 1; polygon.num_slabs > 0 && i < polygon.vertex_count; j = i++) {
+				const double lon_i = _vertices[polygon.vertex_offset + i].lon;
+				const double lon_j = _vertices[polygon.vertex_offset + j].lon;
+				const int first_slab = slabIndex(polygon, math::min(lon_i, lon_j));
+				const int last_slab = slabIndex(polygon, math::max(lon_i, lon_j));
+
+				for (int slab = first_slab; slab <= last_slab; ++slab) {
+					if (pass == 0) {
+						++slab_starts[slab];
+						++num_slab_edges;
+
+					} else {
+						// fill from the end of each slab, leaving slab_starts at the beginning
+						_slab_edges[--slab_starts[slab]] = i;
+					}
+				}
+			}
+
+			if (pass == 0 && polygon.num_slabs > 0) {
+				// running sum: the start of each slab holds its end offset until the second pass
+				const uint16_t polygon_start = (polygon.slab_offset > 0) ? _slab_starts[polygon.slab_offset - 1] : 0;
+				slab_starts[0] += polygon_start;
+
+				for (int slab = 1; slab < polygon.num_slabs; ++slab) {
+					slab_starts[slab] += slab_starts[slab - 1];
+				}
+
+				slab_starts[polygon.num_slabs] = slab_starts[polygon.num_slabs - 1];
+			}
+		}
+
+		if (pass == 0) {
+			if (num_slab_edges > UINT16_MAX) {
+				PX4_ERR("fence too large");
+				return false;
+			}
+
+			_slab_edges = new uint16_t[math::max(num_slab_edges, 1)];
+
+			if (!_slab_edges) {
+				PX4_ERR("alloc failed");
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int Geofence::slabIndex(const PolygonInfo &polygon, double lon)
+{
+	const double lon_range = polygon.lon_max - polygon.lon_min;
+
+	if (!(lon_range > 0.0)) {
+		return 0;
+	}
+
+	const int slab = static_cast<int>((lon - polygon.lon_min) / lon_range * polygon.num_slabs);
+	return math::constrain(slab, 0, polygon.num_slabs - 1);
 }
 
 bool Geofence::checkHomeRequirementsForGeofence(const PolygonInfo &polygon)
@@ -402,6 +576,156 @@ bool Geofence::isInsidePolygonOrCircle(double lat, double lon, float altitude)
 	return checksPass;
 }
 
+float Geofence::distanceToFenceBreachAlongPath(double lat_start, double lon_start, double lat_end, double lon_end,
+		float altitude)
+{
+	if (!isInsidePolygonOrCircle(lat_start, lon_start, altitude)) {
+		return 0.f;
+	}
+
+	if (isEmpty()) {
+		return -1.f;
+	}
+
+	// the result can only change where the path crosses the boundary of a polygon or circle
+	float crossings[MAX_PATH_CROSSINGS];
+	int num_crossings = 0;
+	bool overflow = false;
+
+	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		const PolygonInfo &polygon = _polygons[polygon_index];
+
+		if (polygon.num_slabs == 0) {
+			addCircleCrossings(polygon, lat_start, lon_start, lat_end, lon_end, crossings, num_crossings, overflow);
+
+		} else {
+			addPolygonCrossings(polygon, lat_start, lon_start, lat_end, lon_end, crossings, num_crossings, overflow);
+		}
+	}
+
+	const float path_length = get_distance_to_next_waypoint(lat_start, lon_start, lat_end, lon_end);
+
+	// test between each crossing and the next one
+	for (int i = 0; i < num_crossings; ++i) {
+		const double t = 0.5 * ((double)crossings[i] + ((i + 1 < num_crossings) ? (double)crossings[i + 1] : 1.0));
+
+		if (!isInsidePolygonOrCircle(lat_start + t * (lat_end - lat_start), lon_start + t * (lon_end - lon_start), altitude)) {
+			return crossings[i] * path_length;
+		}
+	}
+
+	// more crossings than we keep track of: be conservative
+	if (overflow && !isInsidePolygonOrCircle(lat_end, lon_end, altitude)) {
+		return crossings[num_crossings - 1] * path_length;
+	}
+
+	return -1.f;
+}
+
+void Geofence::addPolygonCrossings(const PolygonInfo &polygon, double lat_start, double lon_start, double lat_end,
+				   double lon_end, float crossings[MAX_PATH_CROSSINGS], int &num_crossings, bool &overflow)
+{
+	if (!polygon.valid_frame
+	    || math::max(lat_start, lat_end) < polygon.lat_min || math::min(lat_start, lat_end) > polygon.lat_max
+	    || math::max(lon_start, lon_end) < polygon.lon_min || math::min(lon_start, lon_end) > polygon.lon_max) {
+		return;
+	}
+
+	const FenceVertex *vertices = &_vertices[polygon.vertex_offset];
+	const uint16_t *slab_starts = &_slab_starts[polygon.slab_offset];
+	const double d_lat = lat_end - lat_start;
+	const double d_lon = lon_end - lon_start;
+
+	// edges spanning several slabs are found multiple times, insertCrossing() discards the duplicates
+	const int first_slab = slabIndex(polygon, math::min(lon_start, lon_end));
+	const int last_slab = slabIndex(polygon, math::max(lon_start, lon_end));
+
+	for (int edge = slab_starts[first_slab]; edge < slab_starts[last_slab + 1]; ++edge) {
+		const unsigned i = _slab_edges[edge];
+		const unsigned j = (i == 0) ? polygon.vertex_count - 1 : i - 1;
+		const FenceVertex &vertex_i = vertices[i];
+		const FenceVertex &vertex_j = vertices[j];
+
+		// intersect start + t * d with vertex_j + u * e, parallel edges are skipped
+		double t;
+
+		if (geometry::segmentIntersection(lat_start, lon_start, d_lat, d_lon, vertex_j.lat, vertex_j.lon,
+						  vertex_i.lat - vertex_j.lat, vertex_i.lon - vertex_j.lon, DBL_EPSILON * DBL_EPSILON, t)) {
+			insertCrossing(static_cast<float>(t), crossings, num_crossings, overflow);
+		}
+	}
+}
+
+void Geofence::addCircleCrossings(const PolygonInfo &polygon, double lat_start, double lon_start, double lat_end,
+				  double lon_end, float crossings[MAX_PATH_CROSSINGS], int &num_crossings, bool &overflow)
+{
+	if (!polygon.valid_frame) {
+		return;
+	}
+
+	if (!_projection_reference.isInitialized()) {
+		_projection_reference.initReference(lat_start, lon_start, hrt_absolute_time());
+	}
+
+	const FenceVertex &center = _vertices[polygon.vertex_offset];
+	const matrix::Vector2f start = _projection_reference.project(lat_start, lon_start);
+	const matrix::Vector2f end = _projection_reference.project(lat_end, lon_end);
+	const matrix::Vector2f offset = start - _projection_reference.project(center.lat, center.lon);
+	const matrix::Vector2f direction = end - start;
+
+	// |offset + t * direction| = radius
+	const float a = direction.norm_squared();
+	const float b = 2.f * offset.dot(direction);
+	const float c = offset.norm_squared() - polygon.circle_radius * polygon.circle_radius;
+	const float discriminant = b * b - 4.f * a * c;
+
+	if (a < FLT_EPSILON || discriminant < 0.f) {
+		return;
+	}
+
+	const float sqrt_discriminant = sqrtf(discriminant);
+
+	const float solutions[2] {(-b - sqrt_discriminant) / (2.f * a), (-b + sqrt_discriminant) / (2.f * a)};
+
+	for (const float t : solutions) {
+		if (t >= 0.f && t <= 1.f) {
+			insertCrossing(t, crossings, num_crossings, overflow);
+		}
+	}
+}
+
+void Geofence::insertCrossing(float t, float crossings[MAX_PATH_CROSSINGS], int &num_crossings, bool &overflow)
+{
+	int index = num_crossings;
+
+	while (index > 0 && crossings[index - 1] >= t) {
+		--index;
+	}
+
+	if (index < num_crossings && !(crossings[index] > t)) {
+		// duplicate
+		return;
+	}
+
+	if (num_crossings == MAX_PATH_CROSSINGS) {
+		// keep the closest ones
+		overflow = true;
+
+		if (index == MAX_PATH_CROSSINGS) {
+			return;
+		}
+
+		--num_crossings;
+	}
+
+	for (int i = num_crossings; i > index; --i) {
+		crossings[i] = crossings[i - 1];
+	}
+
+	crossings[index] = t;
+	++num_crossings;
+}
+
 bool Geofence::checkPointAgainstPolygonCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
 {
 	bool checksPass = true;
@@ -439,46 +763,27 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 	 * Only supports non-complex polygons (not self intersecting)
 	 */
 
-	mission_fence_point_s temp_vertex_i{};
-	mission_fence_point_s temp_vertex_j{};
-	bool c = false;
-
-	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
-
-		dm_item_t fence_dataman_id{static_cast<dm_item_t>(_stats.dataman_id)};
-		bool success = _dataman_cache.loadWait(fence_dataman_id, polygon.dataman_index + i,
-						       reinterpret_cast<uint8_t *>(&temp_vertex_i), sizeof(mission_fence_point_s));
-
-		if (!success) {
-			break;
-		}
-
-		success = _dataman_cache.loadWait(fence_dataman_id, polygon.dataman_index + j,
-						  reinterpret_cast<uint8_t *>(&temp_vertex_j), sizeof(mission_fence_point_s));
-
-		if (!success) {
-			break;
-		}
+	if (!polygon.valid_frame) {
+		return false;
+	}
 
-		switch (temp_vertex_i.frame) {
-		case NAV_FRAME_GLOBAL:
-		case NAV_FRAME_GLOBAL_INT:
-		case NAV_FRAME_GLOBAL_RELATIVE_ALT:
-		case NAV_FRAME_GLOBAL_RELATIVE_ALT_INT:
-			break;
+	// no edge can toggle the result outside of the bounding box
+	if (lat < polygon.lat_min || lat > polygon.lat_max || lon < polygon.lon_min || lon > polygon.lon_max) {
+		return false;
+	}
 
-		default:
-			// TODO: handle different frames
-			PX4_ERR("Frame type %i not supported", (int)temp_vertex_i.frame);
-			return c;
+	const FenceVertex *vertices = &_vertices[polygon.vertex_offset];
+	const uint16_t *slab_starts = &_slab_starts[polygon.slab_offset];
+	const int slab = slabIndex(polygon, lon);
+	bool c = false;
 
-		}
+	for (int edge = slab_starts[slab]; edge < slab_starts[slab + 1]; ++edge) {
+		const unsigned i = _slab_edges[edge];
+		const unsigned j = (i == 0) ? polygon.vertex_count - 1 : i - 1;
+		const FenceVertex &vertex_i = vertices[i];
+		const FenceVertex &vertex_j = vertices[j];
 
-		if (((double)temp_vertex_i.lon >= lon) != ((double)temp_vertex_j.lon >= lon) &&
-		    (lat <= (double)(temp_vertex_j.lat - temp_vertex_i.lat) * (lon - (double)temp_vertex_i.lon) /
-		     (double)(temp_vertex_j.lon - temp_vertex_i.lon) + (double)temp_vertex_i.lat)) {
-			c = !c;
-		}
+		c ^= geometry::edgeCrossesRay(lat, lon, vertex_i.lat, vertex_i.lon, vertex_j.lat, vertex_j.lon);
 	}
 
 	return c;
@@ -487,28 +792,11 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
 {
 
-	mission_fence_point_s circle_point{};
-	bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), polygon.dataman_index,
-					       reinterpret_cast<uint8_t *>(&circle_point), sizeof(mission_fence_point_s));
-
-	if (!success) {
-		PX4_ERR("dm_read failed");
+	if (!polygon.valid_frame) {
 		return false;
 	}
 
-	switch (circle_point.frame) {
-	case NAV_FRAME_GLOBAL:
-	case NAV_FRAME_GLOBAL_INT:
-	case NAV_FRAME_GLOBAL_RELATIVE_ALT:
-	case NAV_FRAME_GLOBAL_RELATIVE_ALT_INT:
-		break;
-
-	default:
-		// TODO: handle different frames
-		PX4_ERR("Frame type %i not supported", (int)circle_point.frame);
-		return false;
-
-	}
+	const FenceVertex &circle_point = _vertices[polygon.vertex_offset];
 
 	if (!_projection_reference.isInitialized()) {
 		_projection_reference.initReference(lat, lon, hrt_absolute_time());
@@ -518,7 +806,7 @@ bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon,
 	_projection_reference.project(lat, lon, x1, y1);
 	_projection_reference.project(circle_point.lat, circle_point.lon, x2, y2);
 	float dx = x1 - x2, dy = y1 - y2;
-	return dx * dx + dy * dy < circle_point.circle_radius * circle_point.circle_radius;
+	return dx * dx + dy * dy < polygon.circle_radius * polygon.circle_radius;
 }
 
 bool
@@ -109,6 +109,17 @@ public:
 
 	virtual bool isInsidePolygonOrCircle(double lat, double lon, float altitude);
 
+	/**
+	 * @brief find the first violation of the polygons and circles along a straight horizontal path
+	 *
+	 * Intersects the path with the polygon edges and circles instead of sampling it,
+	 * so the whole path is checked at the cost of a few point tests.
+	 *
+	 * @return distance [m] from the start to the first point outside the fence, or a negative value if the whole path is inside
+	 */
+	virtual float distanceToFenceBreachAlongPath(double lat_start, double lon_start, double lat_end, double lon_end,
+			float altitude);
+
 	bool valid();
 
 	/**
@@ -164,11 +175,28 @@ private:
 			uint16_t vertex_count;
 			float circle_radius;
 		};
+		uint16_t vertex_offset; ///< index of the first vertex (or the circle center) in _vertices
+		uint16_t slab_offset; ///< index of the first slab in _slab_starts (polygons only)
+		uint16_t num_slabs; ///< number of longitude slabs the bounding box is divided into (polygons only)
+		bool valid_frame; ///< all vertices use a supported frame
+		double lat_min, lat_max, lon_min, lon_max; ///< bounding box (polygons only)
+	};
+
+	struct FenceVertex {
+		double lat;
+		double lon;
 	};
 
 	Navigator   *_navigator{nullptr};
 	PolygonInfo *_polygons{nullptr};
 
+	// In-memory copy of the fence vertices, built once per fence update.
+	// Each polygon's bounding box is divided into uniform longitude slabs, each listing the edges
+	// spanning it, so a point test only needs to look at the edges of one slab.
+	FenceVertex *_vertices{nullptr};
+	uint16_t *_slab_starts{nullptr}; ///< per polygon num_slabs + 1 offsets into _slab_edges
+	uint16_t *_slab_edges{nullptr}; ///< edge (index of its end vertex within the polygon) lists of all slabs
+
 	mission_stats_entry_s _stats;
 	DatamanState _dataman_state{DatamanState::UpdateRequestWait};
 	DatamanState _error_state{DatamanState::UpdateRequestWait};
@@ -193,6 +221,30 @@ private:
 	 */
 	void _updateFence();
 
+	/**
+	 * Load the vertices of all polygons and circles from the dataman cache and build the slab index
+	 * @return false on failure, the fence is then empty
+	 */
+	bool buildFenceCache();
+
+	void clearFenceCache();
+
+	/**
+	 * @return index of the longitude slab of a polygon containing lon (clamped)
+	 */
+	static int slabIndex(const PolygonInfo &polygon, double lon);
+
+	static constexpr int MAX_PATH_CROSSINGS = 32;
+
+	/**
+	 * Add the path parameters [0, 1] at which the path crosses a polygon or circle boundary (sorted and unique)
+	 */
+	void addPolygonCrossings(const PolygonInfo &polygon, double lat_start, double lon_start, double lat_end, double lon_end,
+				 float crossings[MAX_PATH_CROSSINGS], int &num_crossings, bool &overflow);
+	void addCircleCrossings(const PolygonInfo &polygon, double lat_start, double lon_start, double lat_end, double lon_end,
+				float crossings[MAX_PATH_CROSSINGS], int &num_crossings, bool &overflow);
+	static void insertCrossing(float t, float crossings[MAX_PATH_CROSSINGS], int &num_crossings, bool &overflow);
+
 
 	/**
 	 * Check if a single point is within a polygon
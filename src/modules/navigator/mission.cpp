@@ -279,9 +279,73 @@ void Mission::setActiveMissionItems()
 	}
 
 	publish_navigator_mission_item(); // for logging
+	publishMissionLookahead();
 	_navigator->set_position_setpoint_triplet_updated();
 }
 
+void Mission::publishMissionLookahead()
+{
+	mission_lookahead_s lookahead{};
+	lookahead.current_seq = _mission.current_seq;
+
+	const position_setpoint_triplet_s *pos_sp_triplet = _navigator->get_position_setpoint_triplet();
+
+	const bool fly_through_current = _vehicle_status_sub.get().vehicle_type == vehicle_status_s::VEHICLE_TYPE_ROTARY_WING
+					 && _work_item_type == WorkItemType::WORK_ITEM_TYPE_DEFAULT
+					 && _mission_item.nav_cmd == NAV_CMD_WAYPOINT
+					 && pos_sp_triplet->current.valid && pos_sp_triplet->next.valid;
+
+	if (fly_through_current) {
+		lookahead.lat[0] = pos_sp_triplet->current.lat;
+		lookahead.lon[0] = pos_sp_triplet->current.lon;
+		lookahead.alt[0] = pos_sp_triplet->current.alt;
+		lookahead.num_items = 1;
+
+		// same jump aware search as for the triplet, the first item found is the next setpoint
+		int32_t next_mission_items_index[mission_lookahead_s::MAX_ITEMS - 1];
+		size_t num_found_items;
+		getNextPositionItems(_mission.current_seq + 1, next_mission_items_index, num_found_items,
+				     mission_lookahead_s::MAX_ITEMS - 1);
+
+		const dm_item_t mission_dataman_id = static_cast<dm_item_t>(_mission.mission_dataman_id);
+
+		for (size_t i = 0U; i < num_found_items; i++) {
+			mission_item_s item;
+
+			if (!_dataman_cache.loadWait(mission_dataman_id, next_mission_items_index[i], reinterpret_cast<uint8_t *>(&item),
+						     sizeof(item), MAX_DATAMAN_LOAD_WAIT)) {
+				break;
+			}
+
+			if ((i == 0U) && ((fabs(item.lat - pos_sp_triplet->next.lat) > DBL_EPSILON)
+					  || (fabs(item.lon - pos_sp_triplet->next.lon) > DBL_EPSILON))) {
+				// the next setpoint doesn't come from the mission items (e.g. climb before the mission)
+				break;
+			}
+
+			lookahead.lat[lookahead.num_items] = item.lat;
+			lookahead.lon[lookahead.num_items] = item.lon;
+			lookahead.alt[lookahead.num_items] = get_absolute_altitude_for_item(item);
+			lookahead.num_items++;
+
+			const bool stop_at_item = (item.nav_cmd != NAV_CMD_WAYPOINT) || !item.autocontinue
+						  || (get_time_inside(item) > FLT_EPSILON) || item_has_timeout(item);
+
+			if (stop_at_item) {
+				break;
+			}
+		}
+
+		if (lookahead.num_items < 3) {
+			// nothing to plan beyond the triplet
+			lookahead.num_items = 0;
+		}
+	}
+
+	lookahead.timestamp = hrt_absolute_time();
+	_mission_lookahead_pub.publish(lookahead);
+}
+
 void Mission::handleTakeoff(WorkItemType &new_work_item_type, mission_item_s next_mission_items[],
 			    size_t &num_found_items)
 {
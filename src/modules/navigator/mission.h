@@ -51,6 +51,9 @@
 #include "mission_base.h"
 #include "navigation.h"
 
+#include <uORB/Publication.hpp>
+#include <uORB/topics/mission_lookahead.h>
+
 class Navigator;
 
 class Mission : public MissionBase
@@ -94,5 +97,13 @@ private:
 	void handleVtolTransition(WorkItemType &new_work_item_type, mission_item_s next_mission_items[],
 				  size_t &num_found_items);
 
+	/**
+	 * Publish the positions the vehicle flies through after the current setpoint, up to the first one it has
+	 * to stop at, so the multicopter trajectory can keep its speed over the next waypoint
+	 */
+	void publishMissionLookahead();
+
 	bool _need_mission_save{false};
+
+	uORB::Publication<mission_lookahead_s> _mission_lookahead_pub{ORB_ID(mission_lookahead)};
 };
@@ -51,7 +51,8 @@ MissionBase::MissionBase(Navigator *navigator, int32_t dataman_cache_size_signed
 	ModuleParams(navigator),
 	_dataman_cache_size_signed(dataman_cache_size_signed)
 {
-	_dataman_cache.resize(abs(dataman_cache_size_signed));
+	// a forward cache additionally keeps the items at the next jump target
+	_dataman_cache.resize(abs(dataman_cache_size_signed) + (dataman_cache_size_signed > 0 ? JUMP_TARGET_PREFETCH_ITEMS : 0));
 
 	// Reset _mission here, and listen on changes on the uorb topic instead of initialize from dataman.
 	_mission.mission_dataman_id = DM_KEY_WAYPOINTS_OFFBOARD_0;
@@ -68,6 +69,11 @@ MissionBase::MissionBase(Navigator *navigator, int32_t dataman_cache_size_signed
 	_mission_pub.advertise();
 }
 
+MissionBase::~MissionBase()
+{
+	perf_free(_transition_cache_miss_perf);
+}
+
 void
 MissionBase::updateDatamanCache()
 {
@@ -83,9 +89,46 @@ MissionBase::updateDatamanCache()
 		}
 
 		_load_mission_index = _mission.current_seq;
+		_jump_targets_prefetched = (_dataman_cache_size_signed <= 0);
 	}
 
 	_dataman_cache.update();
+
+	// the jump targets are only known once the items ahead are in the cache
+	if (!_jump_targets_prefetched && !_dataman_cache.isLoading()) {
+		prefetchJumpTargets();
+		_jump_targets_prefetched = true;
+	}
+}
+
+void MissionBase::prefetchJumpTargets()
+{
+	const dm_item_t mission_dataman_id = static_cast<dm_item_t>(_mission.mission_dataman_id);
+	const int32_t end_index = math::min(_load_mission_index + _dataman_cache_size_signed, int32_t(_mission.count));
+
+	for (int32_t index = _load_mission_index; index < end_index; index++) {
+		mission_item_s mission_item;
+
+		// only look at what is cached, never wait here
+		if (!_dataman_cache.loadWait(mission_dataman_id, index, reinterpret_cast<uint8_t *>(&mission_item), sizeof(mission_item))) {
+			continue;
+		}
+
+		if ((mission_item.nav_cmd == NAV_CMD_DO_JUMP)
+		    && (mission_item.do_jump_current_count < mission_item.do_jump_repeat_count)
+		    && (mission_item.do_jump_mission_index >= 0) && (mission_item.do_jump_mission_index < _mission.count)) {
+
+			const int32_t target_end = math::min(int32_t(mission_item.do_jump_mission_index) + JUMP_TARGET_PREFETCH_ITEMS,
+							     int32_t(_mission.count));
+
+			for (int32_t target = mission_item.do_jump_mission_index; target < target_end; target++) {
+				_dataman_cache.load(mission_dataman_id, target);
+			}
+
+			// the items after the jump are only reached once the jump is executed
+			break;
+		}
+	}
 }
 
 void MissionBase::updateMavlinkMission()
@@ -125,6 +168,8 @@ void MissionBase::onMissionUpdate(bool has_mission_items_changed)
 		_dataman_cache.invalidate();
 		_load_mission_index = -1;
 
+		updateMissionIndex();
+
 		if (canRunMissionFeasibility()) {
 			_mission_checked = true;
 			check_mission_valid();
@@ -520,7 +565,14 @@ bool MissionBase::loadCurrentMissionItem()
 {
 	const dm_item_t dm_item = static_cast<dm_item_t>(_mission.mission_dataman_id);
 	bool success = _dataman_cache.loadWait(dm_item, _mission.current_seq, reinterpret_cast<uint8_t *>(&_mission_item),
-					       sizeof(mission_item_s), MAX_DATAMAN_LOAD_WAIT);
+					       sizeof(mission_item_s));
+
+	if (!success) {
+		// the prefetch did not keep up, the switch to this item waits on the storage
+		perf_count(_transition_cache_miss_perf);
+		success = _dataman_cache.loadWait(dm_item, _mission.current_seq, reinterpret_cast<uint8_t *>(&_mission_item),
+						  sizeof(mission_item_s), MAX_DATAMAN_LOAD_WAIT);
+	}
 
 	if (!success) {
 		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Mission item could not be set.\t");
@@ -1158,9 +1210,55 @@ int MissionBase::goToNextPositionItem(bool execute_jump)
 	}
 }
 
+void MissionBase::updateMissionIndex()
+{
+	MissionIndex &mission_index = _navigator->get_mission_index();
+
+	if (mission_index.isValidFor(_mission)) {
+		// already built by another mode for this mission
+		return;
+	}
+
+	if (!mission_index.reset(_mission)) {
+		PX4_ERR("Mission index alloc failed");
+		return;
+	}
+
+	const dm_item_t mission_dataman_id = static_cast<dm_item_t>(_mission.mission_dataman_id);
+
+	for (int32_t mission_item_index = 0; mission_item_index < _mission.count; mission_item_index++) {
+		mission_item_s mission;
+
+		bool success = _dataman_client.readSync(mission_dataman_id, mission_item_index, reinterpret_cast<uint8_t *>(&mission),
+							sizeof(mission_item_s));
+
+		if (!success) {
+			mission_index.invalidate();
+			return;
+		}
+
+		if (MissionBlock::item_contains_position(mission)) {
+			mission_index.addItem(mission_item_index, mission);
+		}
+	}
+
+	mission_index.build();
+}
+
 int MissionBase::setMissionToClosestItem(double lat, double lon, float alt, float home_alt,
 		const vehicle_status_s &vehicle_status)
 {
+	// do not consider land waypoints for a fw
+	const bool ignore_land = (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING)
+				 && !vehicle_status.is_vtol;
+
+	const MissionIndex &mission_index = _navigator->get_mission_index();
+
+	if (mission_index.isValidFor(_mission)) {
+		setMissionIndex(mission_index.closestItem(lat, lon, alt, home_alt, ignore_land));
+		return PX4_OK;
+	}
+
 	int32_t min_dist_index(-1);
 	float min_dist(FLT_MAX), dist_xy(FLT_MAX), dist_z(FLT_MAX);
 	const dm_item_t mission_dataman_id = static_cast<dm_item_t>(_mission.mission_dataman_id);
@@ -1180,10 +1278,7 @@ int MissionBase::setMissionToClosestItem(double lat, double lon, float alt, floa
 		}
 
 		if (MissionBlock::item_contains_position(mission)) {
-			// do not consider land waypoints for a fw
-			if (!((mission.nav_cmd == NAV_CMD_LAND) &&
-			      (vehicle_status.vehicle_type == vehicle_status_s::VEHICLE_TYPE_FIXED_WING) &&
-			      (!vehicle_status.is_vtol))) {
+			if (!((mission.nav_cmd == NAV_CMD_LAND) && ignore_land)) {
 				float dist = get_distance_to_point_global_wgs84(mission.lat, mission.lon,
 						MissionBlock::get_absolute_altitude_for_item(mission, home_alt),
 						lat,
@@ -43,6 +43,7 @@
 #include <drivers/drv_hrt.h>
 #include <px4_platform_common/module_params.h>
 #include <dataman_client/DatamanClient.hpp>
+#include <lib/perf/perf_counter.h>
 #include <uORB/topics/geofence_status.h>
 #include <uORB/topics/mission.h>
 #include <uORB/topics/navigator_mission_item.h>
@@ -66,7 +67,7 @@ class MissionBase : public MissionBlock, public ModuleParams
 {
 public:
 	MissionBase(Navigator *navigator, int32_t dataman_cache_size_signed, uint8_t navigator_state_id);
-	~MissionBase() override = default;
+	~MissionBase() override;
 
 	virtual void on_inactive() override;
 	virtual void on_inactivation() override;
@@ -181,6 +182,13 @@ protected:
 	 * @return PX4_OK if closest item is found and loaded, PX4_ERR otherwise
 	 */
 	int setMissionToClosestItem(double lat, double lon, float alt, float home_alt, const vehicle_status_s &vehicle_status);
+	/**
+	 * @brief Build the mission index of the navigator for the current mission if not done yet
+	 *
+	 * Reads all mission items once, so that the closest item and distance along the mission
+	 * queries later don't need to go through the dataman.
+	 */
+	void updateMissionIndex();
 	/**
 	 * @brief Initialize Mission
 	 *
@@ -334,10 +342,12 @@ protected:
 	int _mission_activation_index{-1};					/**< Index of the mission item that will bring the vehicle back to a mission waypoint */
 
 	int32_t _load_mission_index{-1}; /**< Mission inted of loaded mission items in dataman cache*/
+	bool _jump_targets_prefetched{true}; /**< The jump targets of the loaded mission items are requested in the dataman cache*/
 	int32_t _dataman_cache_size_signed; /**< Size of the dataman cache. A negativ value indicates that previous mission items should be loaded, a positiv value the next mission items*/
 
 	DatamanCache _dataman_cache{"mission_dm_cache_miss", 10}; /**< Dataman cache of mission items*/
 	DatamanClient	&_dataman_client = _dataman_cache.client(); /**< Dataman client*/
+	perf_counter_t _transition_cache_miss_perf{perf_alloc(PC_COUNT, "mission_transition_cache_miss")}; /**< Current mission item not cached when switching to it*/
 
 	uORB::Subscription _mission_sub{ORB_ID(mission)};	/**< mission subscription*/
 	uORB::SubscriptionData<vehicle_land_detected_s> _land_detected_sub{ORB_ID(vehicle_land_detected)};	/**< vehicle land detected subscription */
@@ -351,6 +361,16 @@ private:
 	 *
 	 */
 	static constexpr uint16_t MAX_JUMP_ITERATION{10u};
+	/**
+	 * @brief Number of mission items prefetched at the target of a DO_JUMP ahead in the dataman cache
+	 *
+	 */
+	static constexpr int32_t JUMP_TARGET_PREFETCH_ITEMS{2};
+	/**
+	 * @brief Request the items at the target of the first active DO_JUMP in the cached mission items
+	 *
+	 */
+	void prefetchJumpTargets();
 	/**
 	 * @brief Update Dataman cache
 	 *
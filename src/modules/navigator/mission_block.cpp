@@ -49,6 +49,9 @@
 #include <lib/geo/geo.h>
 #include <systemlib/mavlink_log.h>
 #include <mathlib/mathlib.h>
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+#include <lib/terrain_estimation/TerrainMapCache.hpp>
+#endif // CONFIG_LIB_TERRAIN_MAP
 #include <uORB/uORB.h>
 #include <uORB/topics/vehicle_command.h>
 #include <uORB/topics/vtol_vehicle_status.h>
@@ -986,7 +989,7 @@ void MissionBlock::startPrecLand(uint16_t land_precision)
 
 void MissionBlock::updateAltToAvoidTerrainCollisionAndRepublishTriplet(mission_item_s mission_item)
 {
-	// Avoid flying into terrain using the distance sensor. Enable through the parameter NAV_MIN_GND_DIST.
+	// Avoid flying into terrain using the distance sensor (and the terrain map if enabled). Enable through the parameter NAV_MIN_GND_DIST.
 	// Only active during commanded descents with vz>0 (to prevent climb-aways), excluding landing and VTOL transitions.
 	// It changes the altitude setpoint in the triplet to maintain the current altitude and republish the triplet.
 	// We also change the mission item altitude used for acceptance calculations to prevent getting stuck in a loop.
@@ -995,12 +998,26 @@ void MissionBlock::updateAltToAvoidTerrainCollisionAndRepublishTriplet(mission_i
 	// tracking the new altitude setpoint.
 	static constexpr float kAltitudeDifferenceForDescentCondition = 2.f;
 
+	bool terrain_too_close = _navigator->get_local_position()->dist_bottom_valid
+				 && _navigator->get_local_position()->dist_bottom < _navigator->get_nav_min_gnd_dist_param();
+
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+	// Look ahead: terrain mapped on a previous overflight at the setpoint that is closer than the minimum distance
+	// to the altitude the vehicle is descending to.
+	const position_setpoint_s &current_sp = _navigator->get_position_setpoint_triplet()->current;
+	float terrain_alt_at_setpoint = NAN;
+
+	if (current_sp.valid && TerrainMapCache::instance().lookup(current_sp.lat, current_sp.lon, terrain_alt_at_setpoint)) {
+		terrain_too_close = terrain_too_close
+				    || (get_absolute_altitude_for_item(mission_item) - terrain_alt_at_setpoint < _navigator->get_nav_min_gnd_dist_param());
+	}
+
+#endif // CONFIG_LIB_TERRAIN_MAP
 
 	if (_navigator->get_nav_min_gnd_dist_param() > FLT_EPSILON && _mission_item.nav_cmd != NAV_CMD_LAND
 	    && _mission_item.nav_cmd != NAV_CMD_VTOL_LAND && _mission_item.nav_cmd != NAV_CMD_DO_VTOL_TRANSITION
 	    && _mission_item.nav_cmd != NAV_CMD_IDLE
-	    && _navigator->get_local_position()->dist_bottom_valid
-	    && _navigator->get_local_position()->dist_bottom < _navigator->get_nav_min_gnd_dist_param()
+	    && terrain_too_close
 	    && _navigator->get_local_position()->vz > FLT_EPSILON
 	    && _navigator->get_global_position()->alt - get_absolute_altitude_for_item(mission_item) >
 	    kAltitudeDifferenceForDescentCondition) {
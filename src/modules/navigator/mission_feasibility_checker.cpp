@@ -75,80 +75,100 @@ MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
 
 	bool failed = false;
 
-	for (size_t i = 0; i < mission.count; i++) {
-		struct mission_item_s missionitem = {};
-
-		bool success = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i,
-							reinterpret_cast<uint8_t *>(&missionitem),
-							sizeof(mission_item_s));
-
-		if (!success) {
-			_navigator->get_mission_result()->warning = true;
-			/* not supposed to happen unless the datamanager can't access the SD card, etc. */
-			return false;
-		}
-
-		if (!_feasibility_checker.processNextItem(missionitem, i, mission.count)) {
-			failed = true;
-			break;
-		}
-
+	if (!checkMissionFeasibleItems(mission, home_valid, failed)) {
+		_navigator->get_mission_result()->warning = true;
+		/* not supposed to happen unless the datamanager can't access the SD card, etc. */
+		return false;
 	}
 
 	failed |= _feasibility_checker.someCheckFailed();
 
-	failed |= !checkMissionAgainstGeofence(mission, _navigator->get_home_position()->alt, home_valid);
-
 	_navigator->get_mission_result()->warning = failed;
 
 	return !failed;
 }
 
 bool
-MissionFeasibilityChecker::checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid)
+MissionFeasibilityChecker::checkMissionFeasibleItems(const mission_s &mission, bool home_valid, bool &failed)
 {
+	const float home_alt = _navigator->get_home_position()->alt;
+
+	bool check_items = true;
+	bool check_geofence = _navigator->get_geofence().valid();
+	bool geofence_ok = true;
+
 	if (_navigator->get_geofence().isHomeRequired() && !home_valid) {
 		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
 		events::send(events::ID("navigator_mis_geofence_no_home"), {events::Log::Error, events::LogInternal::Info},
 			     "Geofence requires a valid home position");
+		geofence_ok = false;
+		check_geofence = false;
+	}
+
+	mission_item_s *mission_items = new mission_item_s[DM_MAX_READ_RANGE];
+
+	if (mission_items == nullptr) {
+		PX4_ERR("alloc failed");
 		return false;
 	}
 
-	/* Check if all mission items are inside the geofence (if we have a valid geofence) */
-	if (_navigator->get_geofence().valid()) {
-		for (size_t i = 0; i < mission.count; i++) {
-			struct mission_item_s missionitem = {};
+	bool read_ok = true;
 
-			bool success = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i,
-								reinterpret_cast<uint8_t *>(&missionitem),
-								sizeof(mission_item_s));
+	// Read the items once in ranges and run the item and the geofence checks in the same pass
+	for (size_t i = 0; i < mission.count && (check_items || check_geofence); i += DM_MAX_READ_RANGE) {
 
-			if (!success) {
-				/* not supposed to happen unless the datamanager can't access the SD card, etc. */
-				return false;
-			}
+		const size_t num_items = math::min(static_cast<size_t>(DM_MAX_READ_RANGE), mission.count - i);
 
-			if (missionitem.altitude_is_relative && !home_valid) {
-				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
-				events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
-					     "Geofence requires a valid home position");
-				return false;
-			}
+		read_ok = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i, num_items,
+						   reinterpret_cast<uint8_t *>(mission_items), sizeof(mission_item_s));
 
-			// Geofence function checks against home altitude amsl
-			missionitem.altitude = missionitem.altitude_is_relative ? missionitem.altitude + home_alt : missionitem.altitude;
+		if (!read_ok) {
+			break;
+		}
 
-			if (MissionBlock::item_contains_position(missionitem) && !_navigator->get_geofence().checkPointAgainstAllGeofences(
-				    missionitem.lat, missionitem.lon, missionitem.altitude)) {
+		for (size_t k = 0; k < num_items; k++) {
+			if (check_items && !_feasibility_checker.processNextItem(mission_items[k], i + k, mission.count)) {
+				failed = true;
+				check_items = false;
+			}
 
-				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence violation for waypoint %zu\t", i + 1);
-				events::send<int16_t>(events::ID("navigator_mis_geofence_violation"), {events::Log::Error, events::LogInternal::Info},
-						      "Geofence violation for waypoint {1}",
-						      i + 1);
-				return false;
+			if (check_geofence && !checkItemAgainstGeofence(mission_items[k], i + k, home_alt, home_valid)) {
+				geofence_ok = false;
+				check_geofence = false;
 			}
 		}
 	}
 
+	delete[] mission_items;
+
+	failed |= !geofence_ok;
+
+	return read_ok;
+}
+
+bool
+MissionFeasibilityChecker::checkItemAgainstGeofence(const mission_item_s &mission_item, size_t index, float home_alt,
+		bool home_valid)
+{
+	if (mission_item.altitude_is_relative && !home_valid) {
+		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
+		events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
+			     "Geofence requires a valid home position");
+		return false;
+	}
+
+	// Geofence function checks against home altitude amsl
+	const float altitude = mission_item.altitude_is_relative ? mission_item.altitude + home_alt : mission_item.altitude;
+
+	if (MissionBlock::item_contains_position(mission_item) && !_navigator->get_geofence().checkPointAgainstAllGeofences(
+		    mission_item.lat, mission_item.lon, altitude)) {
+
+		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence violation for waypoint %zu\t", index + 1);
+		events::send<int16_t>(events::ID("navigator_mis_geofence_violation"), {events::Log::Error, events::LogInternal::Info},
+				      "Geofence violation for waypoint {1}",
+				      index + 1);
+		return false;
+	}
+
 	return true;
 }
@@ -56,7 +56,12 @@ private:
 	DatamanClient &_dataman_client;
 	FeasibilityChecker _feasibility_checker;
 
-	bool checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid);
+	/*
+	 * Run the item and geofence checks over all mission items, returns false if the items could not be read
+	 */
+	bool checkMissionFeasibleItems(const mission_s &mission, bool home_valid, bool &failed);
+
+	bool checkItemAgainstGeofence(const mission_item_s &mission_item, size_t index, float home_alt, bool home_valid);
 
 public:
 	MissionFeasibilityChecker(Navigator *navigator, DatamanClient &dataman_client) :
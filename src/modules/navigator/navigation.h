@@ -230,6 +230,17 @@ struct mission_fence_point_s {
 	uint8_t _padding0[5];				/**< padding struct size to alignment boundary  */
 };
 
+/**
+ * One row of cells of a terrain map tile (see TerrainMapCache).
+ * Corresponds to the DM_KEY_TERRAIN_MAP dataman item, the row within the tile is the item index modulo the tile size.
+ */
+struct terrain_map_row_s {
+	int32_t tile_lat;			/**< tile index in latitude */
+	int32_t tile_lon;			/**< tile index in longitude */
+	int16_t height[16];			/**< terrain altitude AMSL, in units of TerrainMapCache::HEIGHT_RESOLUTION */
+	uint8_t weight[16];			/**< number of range finder samples of the cell (saturating), 0 if unknown */
+};
+
 /**
  * @brief Position and yaw setpoint struct.
  * Used in RTL state machine.
@@ -56,8 +56,12 @@
 #include "navigation.h"
 
 #include "GeofenceBreachAvoidance/geofence_breach_avoidance.h"
+#include "MissionIndex/MissionIndex.hpp"
 
 #include <lib/adsb/AdsbConflict.h>
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+#include <dataman_client/DatamanClient.hpp>
+#endif // CONFIG_LIB_TERRAIN_MAP
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
@@ -176,6 +180,8 @@ public:
 
 	Geofence &get_geofence() { return _geofence; }
 
+	MissionIndex &get_mission_index() { return _mission_index; }
+
 	float get_loiter_radius() { return _param_nav_loiter_rad.get(); }
 
 	/**
@@ -342,6 +348,7 @@ private:
 	perf_counter_t	_loop_perf;			/**< loop performance counter */
 
 	Geofence	_geofence;			/**< class that handles the geofence */
+	MissionIndex	_mission_index;			/**< spatial index of the mission position items */
 	GeofenceBreachAvoidance _gf_breach_avoidance;
 	hrt_abstime _last_geofence_check{0};
 
@@ -385,6 +392,20 @@ private:
 
 	bool _is_capturing_images{false}; // keep track if we need to stop capturing images
 
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+	DatamanClient	_terrain_map_dataman_client{};
+	bool		_terrain_map_was_armed{false};
+
+	/**
+	 * Restore the terrain map of previous flights from dataman
+	 */
+	void load_terrain_map();
+
+	/**
+	 * Persist the terrain map tiles that changed in this flight
+	 */
+	void save_terrain_map();
+#endif // CONFIG_LIB_TERRAIN_MAP
 
 	// update subscriptions
 	void params_update();
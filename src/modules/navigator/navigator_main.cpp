@@ -54,6 +54,9 @@
 #include <lib/geo/geo.h>
 #include <lib/adsb/AdsbConflict.h>
 #include <lib/mathlib/mathlib.h>
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+#include <lib/terrain_estimation/TerrainMapCache.hpp>
+#endif // CONFIG_LIB_TERRAIN_MAP
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/events.h>
@@ -162,6 +165,10 @@ void Navigator::run()
 
 	params_update();
 
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+	load_terrain_map();
+#endif // CONFIG_LIB_TERRAIN_MAP
+
 	/* wakeup source(s) */
 	px4_pollfd_struct_t fds[3] {};
 
@@ -238,6 +245,16 @@ void Navigator::run()
 		_position_controller_status_sub.update();
 		_home_pos_sub.update(&_home_pos);
 
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+		const bool armed = (_vstatus.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+
+		if (_terrain_map_was_armed && !armed) {
+			save_terrain_map();
+		}
+
+		_terrain_map_was_armed = armed;
+#endif // CONFIG_LIB_TERRAIN_MAP
+
 		// Handle Vehicle commands
 		int vehicle_command_updates = 0;
 
@@ -983,20 +1000,24 @@ void Navigator::geofence_breach_check()
 			test_point_altitude = current_altitude + vertical_test_point_distance;
 		}
 
+		// with prediction, check the whole path to the test point and not only its end
+		const bool custom_fence_triggered = _geofence.getPredict() ?
+						    _geofence.distanceToFenceBreachAlongPath(current_latitude, current_longitude, test_point_latitude,
+								    test_point_longitude, test_point_altitude) >= 0.f :
+						    !_geofence.isInsidePolygonOrCircle(test_point_latitude, test_point_longitude, test_point_altitude);
+
 		if (_time_loitering_after_gf_breach > 0) {
 			// if we are in the loitering state after breaching a GF, only allow new ones to be set, but not unset
 			_geofence_result.geofence_max_dist_triggered |= !_geofence.isCloserThanMaxDistToHome(test_point_latitude,
 					test_point_longitude, test_point_altitude);
 			_geofence_result.geofence_max_alt_triggered |= !_geofence.isBelowMaxAltitude(test_point_altitude);
-			_geofence_result.geofence_custom_fence_triggered |= !_geofence.isInsidePolygonOrCircle(test_point_latitude,
-					test_point_longitude, test_point_altitude);
+			_geofence_result.geofence_custom_fence_triggered |= custom_fence_triggered;
 
 		} else {
 			_geofence_result.geofence_max_dist_triggered = !_geofence.isCloserThanMaxDistToHome(test_point_latitude,
 					test_point_longitude, test_point_altitude);
 			_geofence_result.geofence_max_alt_triggered = !_geofence.isBelowMaxAltitude(test_point_altitude);
-			_geofence_result.geofence_custom_fence_triggered = !_geofence.isInsidePolygonOrCircle(test_point_latitude,
-					test_point_longitude, test_point_altitude);
+			_geofence_result.geofence_custom_fence_triggered = custom_fence_triggered;
 		}
 
 		_last_geofence_check = hrt_absolute_time();
@@ -1254,6 +1275,51 @@ void Navigator::take_traffic_conflict_action()
 
 }
 
+#if defined(CONFIG_LIB_TERRAIN_MAP)
+void Navigator::load_terrain_map()
+{
+	TerrainMapCache &terrain_map = TerrainMapCache::instance();
+
+	for (uint32_t index = 0; index < DM_KEY_TERRAIN_MAP_MAX; index++) {
+		terrain_map_row_s row{};
+
+		// stop at the first failure, e.g. without persistent storage every read would time out
+		if (!_terrain_map_dataman_client.readSync(DM_KEY_TERRAIN_MAP, index, reinterpret_cast<uint8_t *>(&row),
+				sizeof(terrain_map_row_s), 100_ms)) {
+			break;
+		}
+
+		terrain_map.restoreRow(row, index % TerrainMapCache::TILE_CELLS);
+	}
+
+	if (terrain_map.numTilesUsed() > 0) {
+		PX4_INFO("terrain map: %d tiles restored", terrain_map.numTilesUsed());
+	}
+}
+
+void Navigator::save_terrain_map()
+{
+	TerrainMapCache &terrain_map = TerrainMapCache::instance();
+	terrain_map_row_s rows[TerrainMapCache::TILE_CELLS];
+
+	for (int slot = 0; slot < TerrainMapCache::NUM_TILES; slot++) {
+		if (!terrain_map.takeModifiedTile(slot, rows)) {
+			continue;
+		}
+
+		for (int row = 0; row < TerrainMapCache::TILE_CELLS; row++) {
+			const uint32_t index = slot * TerrainMapCache::TILE_CELLS + row;
+
+			if (!_terrain_map_dataman_client.writeSync(DM_KEY_TERRAIN_MAP, index, reinterpret_cast<uint8_t *>(&rows[row]),
+					sizeof(terrain_map_row_s))) {
+				PX4_ERR("terrain map save failed");
+				return;
+			}
+		}
+	}
+}
+#endif // CONFIG_LIB_TERRAIN_MAP
+
 void Navigator::run_fake_traffic()
 {
 
@@ -1263,8 +1329,11 @@ void Navigator::run_fake_traffic()
 
 void Navigator::check_traffic()
 {
-	if (_traffic_sub.updated()) {
-		_traffic_sub.copy(&_adsb_conflict._transponder_report);
+	int traffic_updates = 0;
+
+	// check every queued report, in dense airspace many aircraft report within a navigator cycle
+	while ((traffic_updates < transponder_report_s::ORB_QUEUE_LENGTH) && _traffic_sub.update(&_adsb_conflict._transponder_report)) {
+		traffic_updates++;
 
 		uint16_t required_flags = transponder_report_s::PX4_ADSB_FLAGS_VALID_COORDS |
 					  transponder_report_s::PX4_ADSB_FLAGS_VALID_HEADING |
@@ -104,6 +104,7 @@ void RTL::updateDatamanCache()
 
 				_opaque_id = _stats.opaque_id;
 				_safe_points_updated = false;
+				_safe_point_cache_valid = false;
 
 				_dataman_cache_safepoint.invalidate();
 
@@ -213,11 +214,70 @@ void RTL::publishRemainingTimeEstimate()
 		default:
 			break;
 		}
+
+		// Direct returns to all the destinations RTL can choose from
+		const PositionYawSetpoint home{_home_pos_sub.get().lat, _home_pos_sub.get().lon, _home_pos_sub.get().alt, _home_pos_sub.get().yaw};
+		estimated_time.home_time_estimate = estimateReturnTime(home, 0.f, home);
+
+		if (_closest_safe_point_valid) {
+			estimated_time.safe_point_time_estimate = estimateReturnTime(_closest_safe_point, 0.f, _closest_safe_point);
+		}
+
+		if (_mission_land_position_valid) {
+			PositionYawSetpoint land_start = _mission_land_position;
+			float path_dist = 0.f;
+
+			// follow the mission from the land start if it is indexed
+			const MissionIndex &mission_index = _navigator->get_mission_index();
+			const mission_s &mission = _mission_sub.get();
+
+			if (mission_index.isValidFor(mission)) {
+				const int32_t land_start_index = mission_index.nextPosition(mission.land_start_index, _home_pos_sub.get().alt,
+								 land_start.lat, land_start.lon, land_start.alt);
+
+				if (land_start_index >= 0) {
+					path_dist = mission_index.distanceAlongMission(land_start_index, mission.land_index);
+				}
+			}
+
+			estimated_time.mission_land_time_estimate = estimateReturnTime(land_start, path_dist, _mission_land_position);
+		}
 	}
 
 	_rtl_time_estimate_pub.publish(estimated_time);
 }
 
+float RTL::estimateReturnTime(const PositionYawSetpoint &via, float path_dist, const PositionYawSetpoint &destination)
+{
+	_destination_time_estimator.update();
+	_destination_time_estimator.setVehicleType(_vehicle_status_sub.get().vehicle_type);
+	_destination_time_estimator.reset();
+
+	const float alt = _global_pos_sub.get().alt;
+	const float return_alt = max(alt, destination.alt + _param_rtl_return_alt.get());
+
+	matrix::Vector2f direction{};
+	get_vector_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, via.lat, via.lon,
+				    &direction(0), &direction(1));
+	const float dist_to_via = get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon,
+				  via.lat, via.lon);
+
+	if (path_dist > FLT_EPSILON) {
+		// cruise to the start of the path at return altitude, then follow it down to the destination
+		_destination_time_estimator.addDirectReturn(alt, return_alt, dist_to_via, direction, return_alt);
+
+		get_vector_to_next_waypoint(via.lat, via.lon, destination.lat, destination.lon, &direction(0), &direction(1));
+		_destination_time_estimator.addDistance(path_dist, direction, destination.alt - return_alt);
+
+	} else {
+		_destination_time_estimator.addDirectReturn(alt, return_alt, dist_to_via, direction, destination.alt);
+	}
+
+	const rtl_time_estimate_s estimate = _destination_time_estimator.getEstimate();
+
+	return estimate.valid ? estimate.time_estimate : NAN;
+}
+
 void RTL::on_activation()
 {
 	setRtlTypeAndDestination();
@@ -383,6 +443,9 @@ void RTL::findRtlDestination(DestinationType &destination_type, PositionYawSetpo
 	rtl_position.alt = _home_pos_sub.get().alt;
 	rtl_position.lat = _home_pos_sub.get().lat;
 	rtl_position.lon = _home_pos_sub.get().lon;
+
+	_mission_land_position_valid = false;
+	_closest_safe_point_valid = false;
 	rtl_position.yaw = _home_pos_sub.get().yaw;
 	destination_type = DestinationType::DESTINATION_TYPE_HOME;
 
@@ -422,6 +485,11 @@ void RTL::findRtlDestination(DestinationType &destination_type, PositionYawSetpo
 				     "Mission land item could not be read");
 		}
 
+		if (success) {
+			setLandPosAsDestination(_mission_land_position, land_mission_item);
+			_mission_land_position_valid = true;
+		}
+
 		float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, land_mission_item.lat, land_mission_item.lon)};
 
 		if ((dist + MIN_DIST_THRESHOLD) < min_dist) {
@@ -440,40 +508,32 @@ void RTL::findRtlDestination(DestinationType &destination_type, PositionYawSetpo
 
 	if (_safe_points_updated) {
 
-		_one_rally_point_has_land_approach = false;
-
-		for (int current_seq = 0; current_seq < _dataman_cache_safepoint.size(); ++current_seq) {
-			mission_item_s mission_safe_point;
+		updateSafePointCache();
 
-			bool success = _dataman_cache_safepoint.loadWait(static_cast<dm_item_t>(_stats.dataman_id), current_seq,
-					reinterpret_cast<uint8_t *>(&mission_safe_point),
-					sizeof(mission_item_s), 500_ms);
+		_one_rally_point_has_land_approach = false;
+		float closest_safe_point_dist{FLT_MAX};
 
-			if (!success) {
-				PX4_ERR("dm_read failed");
-				continue;
-			}
+		for (uint16_t i = 0; i < _num_cached_safe_points; ++i) {
+			const SafePointCacheEntry &safe_point = _safe_point_cache[i];
 
 			// Ignore safepoints which are too close to the homepoint
-			const float dist_to_home = get_distance_to_next_waypoint(_home_pos_sub.get().lat, _home_pos_sub.get().lon,
-						   mission_safe_point.lat, mission_safe_point.lon);
-
-			if (mission_safe_point.nav_cmd == NAV_CMD_RALLY_POINT && dist_to_home > MAX_DIST_FROM_HOME_FOR_LAND_APPROACHES) {
-				float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, mission_safe_point.lat, mission_safe_point.lon)};
+			if (safe_point.dist_to_home > MAX_DIST_FROM_HOME_FOR_LAND_APPROACHES) {
+				float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, safe_point.position.lat, safe_point.position.lon)};
 
-				PositionYawSetpoint safepoint_position;
-				setSafepointAsDestination(safepoint_position, mission_safe_point);
-
-				bool current_safe_point_has_approaches{hasVtolLandApproach(safepoint_position)};
+				if (dist < closest_safe_point_dist) {
+					closest_safe_point_dist = dist;
+					_closest_safe_point = safe_point.position;
+					_closest_safe_point_valid = true;
+				}
 
-				_one_rally_point_has_land_approach |= current_safe_point_has_approaches;
+				_one_rally_point_has_land_approach |= safe_point.has_land_approach;
 
 				if (((dist + MIN_DIST_THRESHOLD) < min_dist) && (!vtol_in_fw_mode || (_param_rtl_approach_force.get() == 0)
-						|| current_safe_point_has_approaches)) {
+						|| safe_point.has_land_approach)) {
 					min_dist = dist;
-					rtl_position = safepoint_position;
+					rtl_position = safe_point.position;
 					destination_type = DestinationType::DESTINATION_TYPE_SAFE_POINT;
-					safe_point_index = current_seq;
+					safe_point_index = safe_point.seq;
 				}
 			}
 		}
@@ -488,6 +548,51 @@ void RTL::findRtlDestination(DestinationType &destination_type, PositionYawSetpo
 	}
 }
 
+void RTL::updateSafePointCache()
+{
+	if (_safe_point_cache_valid && (_safe_point_cache_home_counter == _home_pos_sub.get().update_count)) {
+		return;
+	}
+
+	_num_cached_safe_points = 0;
+
+	for (int current_seq = 0; current_seq < _dataman_cache_safepoint.size(); ++current_seq) {
+		mission_item_s mission_safe_point;
+
+		bool success = _dataman_cache_safepoint.loadWait(static_cast<dm_item_t>(_stats.dataman_id), current_seq,
+				reinterpret_cast<uint8_t *>(&mission_safe_point),
+				sizeof(mission_item_s), 500_ms);
+
+		if (!success) {
+			PX4_ERR("dm_read failed");
+			continue;
+		}
+
+		if ((mission_safe_point.nav_cmd != NAV_CMD_RALLY_POINT) || (_num_cached_safe_points >= DM_KEY_SAFE_POINTS_MAX)) {
+			continue;
+		}
+
+		SafePointCacheEntry &safe_point = _safe_point_cache[_num_cached_safe_points];
+		safe_point.position.lat = static_cast<double>(NAN);
+		setSafepointAsDestination(safe_point.position, mission_safe_point);
+
+		// unsupported frame
+		if (!PX4_ISFINITE(safe_point.position.lat)) {
+			continue;
+		}
+
+		safe_point.dist_to_home = get_distance_to_next_waypoint(_home_pos_sub.get().lat, _home_pos_sub.get().lon,
+					  safe_point.position.lat, safe_point.position.lon);
+		safe_point.seq = current_seq;
+		safe_point.has_land_approach = hasVtolLandApproach(safe_point.position);
+
+		++_num_cached_safe_points;
+	}
+
+	_safe_point_cache_home_counter = _home_pos_sub.get().update_count;
+	_safe_point_cache_valid = true;
+}
+
 void RTL::setLandPosAsDestination(PositionYawSetpoint &rtl_position, mission_item_s &land_mission_item) const
 {
 	rtl_position.alt = land_mission_item.altitude_is_relative ?	land_mission_item.altitude +
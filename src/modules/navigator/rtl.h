@@ -138,6 +138,24 @@ private:
 	 */
 	void setSafepointAsDestination(PositionYawSetpoint &rtl_position, const mission_item_s &mission_safe_point) const;
 
+	/**
+	 * @brief Estimate the time of a return to a destination.
+	 *
+	 * Climb to the return altitude, cruise to the via position, then follow a path of the given length
+	 * down to the destination. Without a path (zero length) the via position is the destination.
+	 *
+	 * @param via Position where the path to the destination starts
+	 * @param path_dist Horizontal length of the path from the via position to the destination [m]
+	 * @param destination Destination of the return
+	 * @return time estimate [s], NAN if not available
+	 */
+	float estimateReturnTime(const PositionYawSetpoint &via, float path_dist, const PositionYawSetpoint &destination);
+
+	/**
+	 * @brief Rebuild the safe point cache if the safe points or the home position changed.
+	 */
+	void updateSafePointCache();
+
 	/**
 	 * @brief calculate return altitude from cone half angle
 	 *
@@ -205,6 +223,13 @@ private:
 	bool _home_has_land_approach;			///< Flag if the home position has a land approach defined
 	bool _one_rally_point_has_land_approach;	///< Flag if a rally point has a land approach defined
 
+	PositionYawSetpoint _closest_safe_point{};	///< closest safe point found by the last destination check
+	bool _closest_safe_point_valid{false};
+	PositionYawSetpoint _mission_land_position{};	///< mission landing found by the last destination check
+	bool _mission_land_position_valid{false};
+
+	RtlTimeEstimator _destination_time_estimator;	///< estimator for the destinations which are not selected
+
 	DatamanState _dataman_state{DatamanState::UpdateRequestWait};
 	DatamanState _error_state{DatamanState::UpdateRequestWait};
 	uint32_t _opaque_id{0}; ///< dataman safepoint id: if it does not match, safe points data was updated
@@ -212,6 +237,18 @@ private:
 	mutable DatamanCache _dataman_cache_safepoint{"rtl_dm_cache_miss_geo", 4};
 	DatamanClient	&_dataman_client_safepoint = _dataman_cache_safepoint.client();
 	bool _initiate_safe_points_updated{true}; ///< flag indicating if safe points update is needed
+
+	struct SafePointCacheEntry {
+		PositionYawSetpoint position;	///< destination of the rally point
+		float dist_to_home;		///< [m] horizontal distance to the home position
+		uint16_t seq;			///< index of the rally point in the safe points storage
+		bool has_land_approach;		///< rally point has VTOL land approaches defined
+	};
+
+	SafePointCacheEntry _safe_point_cache[DM_KEY_SAFE_POINTS_MAX] {}; ///< rally points, to find the closest one without the dataman
+	uint16_t _num_cached_safe_points{0};
+	uint32_t _safe_point_cache_home_counter{0};
+	bool _safe_point_cache_valid{false};
 	mutable DatamanCache _dataman_cache_landItem{"rtl_dm_cache_miss_land", 2};
 	uint32_t _mission_id = 0u;
 	uint32_t _safe_points_id = 0u;
@@ -192,9 +192,40 @@ void RtlMissionFast::setActiveMissionItems()
 
 rtl_time_estimate_s RtlMissionFast::calc_rtl_time_estimate()
 {
-	rtl_time_estimate_s time_estimate;
-	time_estimate.valid = false;
-	time_estimate.timestamp = hrt_absolute_time();
+	_rtl_time_estimator.update();
+	_rtl_time_estimator.setVehicleType(_vehicle_status_sub.get().vehicle_type);
+	_rtl_time_estimator.reset();
 
-	return time_estimate;
+	// Only estimated from the mission index, walking the mission through the dataman is too slow for long missions
+	const MissionIndex &mission_index = _navigator->get_mission_index();
+
+	if (hasMissionLandStart() && mission_index.isValidFor(_mission)) {
+		const int32_t start_index = isActive() ? _mission.current_seq : math::max(_mission_index_prior_rtl, INT32_C(0));
+		const float home_alt = _home_pos_sub.get().alt;
+
+		double next_lat, next_lon, land_lat, land_lon;
+		float next_alt, land_alt;
+		const int32_t next_index = mission_index.nextPosition(start_index, home_alt, next_lat, next_lon, next_alt);
+		const int32_t land_index = mission_index.nextPosition(_mission.land_index, home_alt, land_lat, land_lon, land_alt);
+
+		if (next_index >= 0 && land_index >= next_index) {
+			// Go to the next position item of the mission
+			matrix::Vector2f direction{};
+			get_vector_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, next_lat, next_lon,
+						    &direction(0), &direction(1));
+
+			const float hor_dist = get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon,
+					       next_lat, next_lon);
+
+			_rtl_time_estimator.addDistance(hor_dist, direction, next_alt - _global_pos_sub.get().alt);
+
+			// Follow the mission up to the landing, the wind is only considered along the direct line
+			get_vector_to_next_waypoint(next_lat, next_lon, land_lat, land_lon, &direction(0), &direction(1));
+
+			_rtl_time_estimator.addDistance(mission_index.distanceAlongMission(next_index, land_index), direction,
+							land_alt - next_alt);
+		}
+	}
+
+	return _rtl_time_estimator.getEstimate();
 }
@@ -43,6 +43,8 @@
 
 #include "rtl_base.h"
 
+#include <lib/rtl/rtl_time_estimator.h>
+
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/home_position.h>
 #include <uORB/topics/rtl_time_estimate.h>
@@ -66,5 +68,7 @@ private:
 
 	int _mission_index_prior_rtl{-1};
 
+	RtlTimeEstimator _rtl_time_estimator;
+
 	uORB::SubscriptionData<home_position_s> _home_pos_sub{ORB_ID(home_position)};		/**< home position subscription */
 };
@@ -77,7 +77,7 @@
 
 #define REG_TO_BOOL(_reg) 	((bool)(_reg))
 
-#define PX4IO_PROTOCOL_VERSION		5
+#define PX4IO_PROTOCOL_VERSION		6
 
 /* maximum allowable sizes on this protocol version */
 #define PX4IO_PROTOCOL_MAX_CONTROL_COUNT	8	/**< The protocol does not support more than set here, individual units might support less - see PX4IO_P_CONFIG_CONTROL_COUNT */
@@ -123,6 +123,9 @@
 #define PX4IO_P_STATUS_VSERVO			6	/* [2] servo rail voltage in mV */
 #define PX4IO_P_STATUS_VRSSI			7	/* [2] RSSI voltage */
 
+/* registers from PX4IO_P_STATUS_FLAGS on, returned in the reply to PKT_CODE_WRITE_STATUS */
+#define PX4IO_P_STATUS_REPLY_COUNT		(PX4IO_P_STATUS_VRSSI - PX4IO_P_STATUS_FLAGS + 1)
+
 /* array of PWM servo output values, microseconds */
 #define PX4IO_PAGE_SERVOS			3	/* 0..CONFIG_ACTUATOR_COUNT-1 */
 
@@ -233,6 +236,7 @@ struct IOPacket {
 
 #define PKT_CODE_READ		0x00	/* FMU->IO read transaction */
 #define PKT_CODE_WRITE		0x40	/* FMU->IO write transaction */
+#define PKT_CODE_WRITE_STATUS	0x80	/* FMU->IO write transaction, the reply carries the status registers */
 #define PKT_CODE_SUCCESS	0x00	/* IO->FMU success reply */
 #define PKT_CODE_CORRUPT	0x40	/* IO->FMU bad packet reply */
 #define PKT_CODE_ERROR		0x80	/* IO->FMU register op error reply */
@@ -177,7 +177,7 @@ rx_handle_packet(void)
 		return;
 	}
 
-	if (PKT_CODE(dma_packet) == PKT_CODE_WRITE) {
+	if (PKT_CODE(dma_packet) == PKT_CODE_WRITE || PKT_CODE(dma_packet) == PKT_CODE_WRITE_STATUS) {
 
 		/* it's a blind write - pass it on */
 		if (registers_set(dma_packet.page, dma_packet.offset, &dma_packet.regs[0], PKT_COUNT(dma_packet))) {
@@ -187,6 +187,24 @@ rx_handle_packet(void)
 
 			dma_packet.count_code = PKT_CODE_ERROR;
 
+		} else if (PKT_CODE(dma_packet) == PKT_CODE_WRITE_STATUS) {
+
+			/* reply with the status registers, saves the FMU a separate read */
+			unsigned count;
+			uint16_t *registers;
+
+			if (registers_get(PX4IO_PAGE_STATUS, PX4IO_P_STATUS_FLAGS, &registers, &count) < 0) {
+				dma_packet.count_code = PKT_CODE_ERROR;
+
+			} else {
+				if (count > PX4IO_P_STATUS_REPLY_COUNT) {
+					count = PX4IO_P_STATUS_REPLY_COUNT;
+				}
+
+				memcpy((void *)&dma_packet.regs[0], registers, count * 2);
+				dma_packet.count_code = count | PKT_CODE_SUCCESS;
+			}
+
 		} else {
 			dma_packet.count_code = PKT_CODE_SUCCESS;
 		}
@@ -42,6 +42,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <px4_platform_common/defines.h>
+#include <px4_platform_common/getopt.h>
 #include <px4_platform_common/posix.h>
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/time.h>
@@ -54,6 +55,7 @@
 #include <fstream>
 #include <iostream>
 #include <math.h>
+#include <queue>
 #include <time.h>
 #include <sstream>
 #include <stdio.h>
@@ -298,7 +300,7 @@ Replay::readFileDefinitions(std::ifstream &file)
 			break;
 
 		case (int)ULogMessageType::ADD_LOGGED_MSG:
-			_data_section_start = file.tellg() - (streamoff)ULOG_MSG_HEADER_LEN;
+			_data_section_start = (streamoff)file.tellg() - ULOG_MSG_HEADER_LEN;
 			return true;
 
 		case (int)ULogMessageType::INFO: //skip
@@ -418,33 +420,24 @@ string Replay::getOrbFields(const orb_metadata *meta)
 	return format;
 }
 
-Replay::ReadAndAndAddSubResult
-Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
+bool
+Replay::addSubscription(uint64_t offset)
 {
-	_read_buffer.reserve(msg_size + 1);
-	uint8_t *message = _read_buffer.data();
-	streampos this_message_pos = file.tellg() - (streamoff)ULOG_MSG_HEADER_LEN;
-	file.read((char *)message, msg_size);
-	message[msg_size] = 0;
+	const uint8_t *message = _file.message(offset) + ULOG_MSG_HEADER_LEN;
+	const uint16_t msg_size = _file.messageSize(offset);
 
-	if (!file) {
-		return ReadAndAndAddSubResult::kFailure;
-	}
-
-	if (file.tellg() <= _subscription_file_pos) { //already read this subscription
-		return ReadAndAndAddSubResult::kIgnoringMsg;
+	if (msg_size < 3) {
+		return false;
 	}
 
-	_subscription_file_pos = file.tellg();
-
 	uint8_t multi_id = *(uint8_t *)message;
 	uint16_t msg_id = ((uint16_t)message[1]) | (((uint16_t)message[2]) << 8);
-	string topic_name((char *)message + 3);
+	string topic_name((const char *)message + 3, strnlen((const char *)message + 3, msg_size - 3));
 	const orb_metadata *orb_meta = findTopic(topic_name);
 
 	if (!orb_meta) {
 		PX4_WARN("Topic %s not found internally. Will ignore it", topic_name.c_str());
-		return ReadAndAndAddSubResult::kIgnoringMsg;
+		return false;
 	}
 
 	CompatBase *compat = nullptr;
@@ -520,7 +513,7 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 				}
 			}
 
-			return ReadAndAndAddSubResult::kIgnoringMsg; // not a fatal error
+			return false; // not a fatal error
 		}
 	}
 
@@ -535,30 +528,20 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 
 	if (!timestamp_found) {
 		delete subscription;
-		return ReadAndAndAddSubResult::kIgnoringMsg;
+		return false;
 	}
 
 	if (field_size != 8) {
 		PX4_ERR("Unsupported timestamp with size %i, ignoring the topic %s", field_size, orb_meta->o_name);
 		delete subscription;
-		return ReadAndAndAddSubResult::kIgnoringMsg;
+		return false;
 	}
 
 	//find first data message (and the timestamp)
-	streampos cur_pos = file.tellg();
-	subscription->next_read_pos = this_message_pos; //this will be skipped
-
-	if (!nextDataMessage(file, *subscription, msg_id)) {
-		delete subscription;
-		return ReadAndAndAddSubResult::kFailure;
-	}
-
-	file.seekg(cur_pos);
-
-	if (!subscription->orb_meta) {
+	if (!findDataMessage(*subscription, msg_id, findStartIndex(*subscription, msg_id))) {
 		//no message found. This is not a fatal error
 		delete subscription;
-		return ReadAndAndAddSubResult::kIgnoringMsg;
+		return false;
 	}
 
 	PX4_DEBUG("adding subscription for %s (msg_id %i)", subscription->orb_meta->o_name, msg_id);
@@ -568,11 +551,16 @@ Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
 		_subscriptions.resize(msg_id + 1);
 	}
 
+	if (_subscriptions[msg_id]) { // msg_id used twice, keep the first one
+		delete subscription;
+		return false;
+	}
+
 	_subscriptions[msg_id] = subscription;
 
 	onSubscriptionAdded(*_subscriptions[msg_id], msg_id);
 
-	return ReadAndAndAddSubResult::kSuccess;
+	return true;
 }
 
 bool
@@ -606,37 +594,33 @@ Replay::findFieldOffset(const string &format, const string &field_name, int &off
 	return false;
 }
 
-bool
-Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position)
+void
+Replay::handleAdditionalMessages(uint64_t end_position)
 {
-	ulog_message_header_s message_header;
+	const std::vector<uint64_t> &messages = _file.additionalMessages();
 
-	while (file.tellg() < end_position) {
-		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+	for (; _next_additional_message < messages.size() && messages[_next_additional_message] < end_position;
+	     ++_next_additional_message) {
 
-		if (!file) {
-			return false;
-		}
+		const uint64_t offset = messages[_next_additional_message];
+		const uint8_t *message = _file.message(offset);
+		const uint16_t msg_size = _file.messageSize(offset);
 
-		switch (message_header.msg_type) {
+		switch (message[2]) {
 		case (int)ULogMessageType::PARAMETER:
-			if (!readAndApplyParameter(file, message_header.msg_size)) {
-				return false;
-			}
-
+			applyParameter(message + ULOG_MSG_HEADER_LEN, msg_size);
 			break;
 
 		case (int)ULogMessageType::DROPOUT:
-			readDropout(file, message_header.msg_size);
-			break;
+			if (msg_size >= sizeof(uint16_t)) {
+				uint16_t duration;
+				memcpy(&duration, message + ULOG_MSG_HEADER_LEN, sizeof(duration));
+				PX4_ERR("Dropout in replayed log, %i ms", (int)duration);
+			}
 
-		default: //skip all others
-			file.seekg(message_header.msg_size, ios::cur);
 			break;
 		}
 	}
-
-	return true;
 }
 
 bool
@@ -650,7 +634,18 @@ Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
 		return false;
 	}
 
+	return applyParameter(message, msg_size);
+}
+
+bool
+Replay::applyParameter(const uint8_t *message, uint16_t msg_size)
+{
 	uint8_t key_len = message[0];
+
+	if (1 + key_len + sizeof(float) > msg_size) {
+		return false;
+	}
+
 	string key((char *)message + 1, key_len);
 
 	size_t pos = key.find(' ');
@@ -683,99 +678,67 @@ Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::readDropout(std::ifstream &file, uint16_t msg_size)
+Replay::findDataMessage(Subscription &subscription, int msg_id, size_t index)
 {
-	uint16_t duration;
-	file.read((char *)&duration, sizeof(duration));
+	if (findDataMessage(subscription.orb_meta, subscription.timestamp_offset, msg_id, index, subscription.next_read_pos,
+			    subscription.next_timestamp)) {
+		subscription.next_index = index;
+		return true;
+	}
 
-	PX4_ERR("Dropout in replayed log, %i ms", (int)duration);
-	return file.good();
+	//no more data messages for this subscription
+	subscription.orb_meta = nullptr;
+	return false;
 }
 
 bool
-Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id)
+Replay::findDataMessage(const orb_metadata *orb_meta, int timestamp_offset, int msg_id, size_t &index,
+			uint64_t &read_pos, uint64_t &timestamp) const
 {
-	ulog_message_header_s message_header;
-	file.seekg(subscription.next_read_pos);
-	//ignore the first message (it's data we already read)
-	file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+	const std::vector<uint64_t> &messages = _file.dataMessages(msg_id);
+	const uint16_t expected_size = orb_meta->o_size_no_padding + 2;
 
-	if (file) {
-		file.seekg(message_header.msg_size, ios::cur);
-	}
-
-	uint16_t file_msg_id;
-	bool done = false;
-
-	while (file && !done) {
-		streampos cur_pos = file.tellg();
-		file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
+	for (; index < messages.size(); ++index) {
+		const uint64_t offset = messages[index];
 
-		if (!file) {
-			break;
+		if (_file.messageSize(offset) != expected_size) { //sanity check failed!
+			PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
+				orb_meta->o_name, _file.messageSize(offset), expected_size);
+			continue;
 		}
 
-		if (((streamoff)cur_pos) + ULOG_MSG_HEADER_LEN + message_header.msg_size > _read_until_file_position) {
-			file.setstate(std::ios::eofbit);
-			break;
-		}
+		read_pos = offset;
+		memcpy(&timestamp, _file.message(offset) + ULOG_MSG_HEADER_LEN + 2 + timestamp_offset, sizeof(timestamp));
 
-		switch (message_header.msg_type) {
-		case (int)ULogMessageType::ADD_LOGGED_MSG:
-			readAndAddSubscription(file, message_header.msg_size);
-			break;
+		return _end_time_offset == 0 || timestamp <= _file_start_time + _end_time_offset;
+	}
 
-		case (int)ULogMessageType::DATA:
-			file.read((char *)&file_msg_id, sizeof(file_msg_id));
-
-			if (file) {
-				if (msg_id == file_msg_id) {
-					if (message_header.msg_size == subscription.orb_meta->o_size_no_padding + 2) {
-						subscription.next_read_pos = cur_pos;
-						file.seekg(subscription.timestamp_offset, ios::cur);
-						file.read((char *)&subscription.next_timestamp, sizeof(subscription.next_timestamp));
-						done = true;
-
-					} else { //sanity check failed!
-						PX4_ERR("data message %s has wrong size %i (expected %i). Skipping",
-							subscription.orb_meta->o_name, message_header.msg_size,
-							subscription.orb_meta->o_size_no_padding + 2);
-						file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
-					}
+	return false;
+}
 
-				} else { //not the one we are looking for
-					file.seekg(message_header.msg_size - sizeof(file_msg_id), ios::cur);
-				}
-			}
+size_t
+Replay::findStartIndex(const Subscription &subscription, int msg_id) const
+{
+	if (_start_time_offset == 0) {
+		return 0;
+	}
 
-			break;
+	// the data messages of a topic are in chronological order
+	const std::vector<uint64_t> &messages = _file.dataMessages(msg_id);
+	const uint64_t start_time = _file_start_time + _start_time_offset;
+	const size_t timestamp_end = ULOG_MSG_HEADER_LEN + 2 + subscription.timestamp_offset + sizeof(uint64_t);
 
-		case (int)ULogMessageType::REMOVE_LOGGED_MSG: //skip these
-		case (int)ULogMessageType::PARAMETER:
-		case (int)ULogMessageType::DROPOUT:
-		case (int)ULogMessageType::INFO:
-		case (int)ULogMessageType::INFO_MULTIPLE:
-		case (int)ULogMessageType::SYNC:
-		case (int)ULogMessageType::LOGGING:
-		case (int)ULogMessageType::PARAMETER_DEFAULT:
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
+	auto it = std::lower_bound(messages.begin(), messages.end(), start_time, [&](uint64_t offset, uint64_t t) {
+		uint64_t timestamp = 0;
 
-		default:
-			//this really should not happen
-			PX4_ERR("unknown log message type %i, size %i (offset %i)",
-				(int)message_header.msg_type, (int)message_header.msg_size, (int)file.tellg());
-			file.seekg(message_header.msg_size, ios::cur);
-			break;
+		if ((size_t)(ULOG_MSG_HEADER_LEN + _file.messageSize(offset)) >= timestamp_end) {
+			memcpy(&timestamp, _file.message(offset) + timestamp_end - sizeof(uint64_t), sizeof(timestamp));
 		}
-	}
 
-	if (file.eof()) { //no more data messages for this subscription
-		subscription.orb_meta = nullptr;
-		file.clear();
-	}
+		return timestamp < t;
+	});
 
-	return file.good();
+	return it - messages.begin();
 }
 
 const orb_metadata *
@@ -891,6 +854,26 @@ Replay::run()
 		return;
 	}
 
+	replay_file.close();
+
+	if (!_file.open(_replay_file)) {
+		return;
+	}
+
+	const hrt_abstime index_start = hrt_absolute_time();
+	_file.buildIndex(_data_section_start, _read_until_file_position);
+
+	if (_file.numCompressedMessages() > 0) {
+		PX4_WARN("Log contains %u delta compressed messages, which are not replayed (convert it with Tools/ulog_decompress.py)",
+			 _file.numCompressedMessages());
+	}
+
+	for (uint64_t offset : _file.subscriptionMessages()) {
+		addSubscription(offset);
+	}
+
+	PX4_INFO("Indexed %.1f MB in %.3f s", (double)(_file.size() / 1.e6), (double)(hrt_elapsed_time(&index_start) / 1.e6));
+
 	_speed_factor = 1.f;
 	const char *speedup = getenv("PX4_SIM_SPEED_FACTOR");
 
@@ -904,68 +887,30 @@ Replay::run()
 
 	PX4_INFO("Replay in progress...");
 
-	ulog_message_header_s message_header;
-	replay_file.seekg(_data_section_start);
-
-	//we know the next message must be an ADD_LOGGED_MSG
-	ReadAndAndAddSubResult res;
-
-	do {
-		replay_file.read((char *)&message_header, ULOG_MSG_HEADER_LEN);
-		res = readAndAddSubscription(replay_file, message_header.msg_size);
-
-		if (res == ReadAndAndAddSubResult::kFailure) {
-			PX4_ERR("Failed to read subscription");
-			return;
-		}
-
-	} while (res != ReadAndAndAddSubResult::kSuccess);
-
 	const uint64_t timestamp_offset = getTimestampOffset();
 	uint32_t nr_published_messages = 0;
-	streampos last_additional_message_pos = _data_section_start;
-
-	while (!should_exit() && replay_file) {
 
-		//Find the next message to publish. Messages from different subscriptions don't need
-		//to be in chronological order, so we need to check all subscriptions
-		uint64_t next_file_time = 0;
-		int next_msg_id = -1;
-		bool first_time = true;
+	if (!startReader()) {
+		PX4_ERR("failed to start reader thread");
+	}
 
-		for (size_t i = 0; i < _subscriptions.size(); ++i) {
-			const Subscription *subscription = _subscriptions[i];
+	while (_reader_running && !should_exit()) {
 
-			if (!subscription) {
-				continue;
-			}
+		QueuedMessage &message = frontMessage();
 
-			if (subscription->orb_meta && !subscription->ignored) {
-				if (first_time || subscription->next_timestamp < next_file_time) {
-					first_time = false;
-					next_msg_id = (int)i;
-					next_file_time = subscription->next_timestamp;
-				}
-			}
-		}
-
-		if (next_msg_id == -1) {
+		if (message.msg_id == -1) {
 			break; //no active subscription anymore. We're done.
 		}
 
-		Subscription &sub = *_subscriptions[next_msg_id];
+		Subscription &sub = *_subscriptions[message.msg_id];
+		sub.next_index = message.index;
+		sub.next_read_pos = message.read_pos;
+		sub.next_timestamp = message.timestamp;
 
-		if (next_file_time == 0 || next_file_time < _file_start_time) {
-			//someone didn't set the timestamp properly. Consider the message invalid
-			nextDataMessage(replay_file, sub, next_msg_id);
-			continue;
-		}
+		const uint64_t next_file_time = message.timestamp;
 
 		//handle additional messages between last and next published data
-		replay_file.seekg(last_additional_message_pos);
-		streampos next_additional_message_pos = sub.next_read_pos;
-		readAndHandleAdditionalMessages(replay_file, next_additional_message_pos);
-		last_additional_message_pos = next_additional_message_pos;
+		handleAdditionalMessages(sub.next_read_pos);
 
 		// Perform scheduled parameter changes
 		while (_next_param_change < _dynamic_parameter_schedule.size() &&
@@ -981,18 +926,19 @@ Replay::run()
 		const uint64_t publish_timestamp = handleTopicDelay(next_file_time, timestamp_offset);
 
 		// It's time to publish
-		readTopicDataToBuffer(sub, replay_file);
-		memcpy(_read_buffer.data() + sub.timestamp_offset, &publish_timestamp, sizeof(uint64_t)); //adjust the timestamp
+		memcpy(message.data.data() + sub.timestamp_offset, &publish_timestamp, sizeof(uint64_t)); //adjust the timestamp
 
-		if (handleTopicUpdate(sub, _read_buffer.data(), replay_file)) {
+		if (handleTopicUpdate(sub, message.data.data())) {
 			++nr_published_messages;
 		}
 
-		nextDataMessage(replay_file, sub, next_msg_id);
+		popMessage();
 
 		// TODO: output status (eg. every sec), including total duration...
 	}
 
+	stopReader();
+
 	for (auto &subscription : _subscriptions) {
 		if (!subscription) {
 			continue;
@@ -1016,8 +962,9 @@ Replay::run()
 
 	onExitMainLoop();
 
+	_file.close();
+
 	if (!should_exit()) {
-		replay_file.close();
 		px4_shutdown_request();
 		// we need to ensure the shutdown logic gets updated and eventually triggers shutdown
 		hrt_abstime t = hrt_absolute_time();
@@ -1032,17 +979,187 @@ Replay::run()
 }
 
 void
-Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file)
+Replay::readTopicDataToBuffer(const Subscription &sub)
 {
-	const size_t msg_read_size = sub.orb_meta->o_size_no_padding;
 	const size_t msg_write_size = sub.orb_meta->o_size;
 	_read_buffer.reserve(msg_write_size);
-	replay_file.seekg(sub.next_read_pos + (streamoff)(ULOG_MSG_HEADER_LEN + 2)); //skip header & msg id
-	replay_file.read((char *)_read_buffer.data(), msg_read_size);
+	readTopicData(sub.orb_meta, sub.compat, sub.next_read_pos, _read_buffer.data());
+}
+
+void
+Replay::readTopicData(const orb_metadata *orb_meta, CompatBase *compat, uint64_t read_pos, uint8_t *buffer) const
+{
+	memcpy(buffer, _file.message(read_pos) + ULOG_MSG_HEADER_LEN + 2, orb_meta->o_size_no_padding); //skip header & msg id
+
+	if (compat) {
+		const void *converted = compat->apply(buffer);
+
+		if (converted != buffer) {
+			memcpy(buffer, converted, orb_meta->o_size);
+		}
+	}
+}
+
+bool
+Replay::startReader()
+{
+	// the queue slots are sized for the largest replayed topic
+	size_t max_size = 0;
+	_reader_cursors.assign(_subscriptions.size(), ReaderCursor{});
+
+	for (size_t i = 0; i < _subscriptions.size(); ++i) {
+		const Subscription *sub = _subscriptions[i];
+
+		if (sub && sub->orb_meta && !sub->ignored) {
+			ReaderCursor &cursor = _reader_cursors[i];
+			cursor.orb_meta = sub->orb_meta;
+			cursor.timestamp_offset = sub->timestamp_offset;
+			cursor.compat = sub->compat;
+			cursor.index = sub->next_index;
+			cursor.read_pos = sub->next_read_pos;
+			cursor.timestamp = sub->next_timestamp;
+			max_size = std::max(max_size, (size_t)sub->orb_meta->o_size);
+		}
+	}
+
+	_queue.resize(QUEUE_SIZE);
+
+	for (QueuedMessage &message : _queue) {
+		message.data.resize(max_size);
+	}
+
+	_queue_head = 0;
+	_queue_tail = 0;
+	_reader_stop = false;
+	_reader_running = pthread_create(&_reader_thread, nullptr, &Replay::readerThreadEntry, this) == 0;
+
+	return _reader_running;
+}
+
+void
+Replay::stopReader()
+{
+	if (!_reader_running) {
+		return;
+	}
+
+	pthread_mutex_lock(&_queue_mutex);
+	_reader_stop = true;
+	pthread_cond_broadcast(&_queue_cond);
+	pthread_mutex_unlock(&_queue_mutex);
+
+	pthread_join(_reader_thread, nullptr);
+	_reader_running = false;
+}
+
+void *
+Replay::readerThreadEntry(void *arg)
+{
+	static_cast<Replay *>(arg)->readerThread();
+	return nullptr;
+}
+
+void
+Replay::readerThread()
+{
+	// Messages from different subscriptions don't need to be in chronological order, so the next message
+	// is the one with the smallest timestamp over all subscriptions (the lowest msg_id on a tie)
+	using NextMessage = std::pair<uint64_t, uint16_t>;
+	std::priority_queue<NextMessage, std::vector<NextMessage>, std::greater<NextMessage>> next_messages;
+
+	for (size_t i = 0; i < _reader_cursors.size(); ++i) {
+		if (_reader_cursors[i].orb_meta) {
+			next_messages.emplace(_reader_cursors[i].timestamp, (uint16_t)i);
+		}
+	}
+
+	while (!next_messages.empty()) {
+		const uint16_t msg_id = next_messages.top().second;
+		next_messages.pop();
+		ReaderCursor &cursor = _reader_cursors[msg_id];
+
+		// someone didn't set the timestamp properly. Consider the message invalid
+		if (cursor.timestamp != 0 && cursor.timestamp >= _file_start_time) {
+			QueuedMessage *message = acquireQueueSlot();
+
+			if (!message) {
+				return;
+			}
+
+			message->msg_id = msg_id;
+			message->index = cursor.index;
+			message->read_pos = cursor.read_pos;
+			message->timestamp = cursor.timestamp;
+			readTopicData(cursor.orb_meta, cursor.compat, cursor.read_pos, message->data.data());
+			commitQueueSlot();
+		}
+
+		++cursor.index;
+
+		if (findDataMessage(cursor.orb_meta, cursor.timestamp_offset, msg_id, cursor.index, cursor.read_pos,
+				    cursor.timestamp)) {
+			next_messages.emplace(cursor.timestamp, msg_id);
+		}
+	}
+
+	QueuedMessage *message = acquireQueueSlot();
+
+	if (message) {
+		message->msg_id = -1;
+		commitQueueSlot();
+	}
+}
+
+Replay::QueuedMessage *
+Replay::acquireQueueSlot()
+{
+	pthread_mutex_lock(&_queue_mutex);
+
+	while (_queue_head - _queue_tail >= QUEUE_SIZE && !_reader_stop) {
+		pthread_cond_wait(&_queue_cond, &_queue_mutex);
+	}
+
+	QueuedMessage *message = _reader_stop ? nullptr : &_queue[_queue_head % QUEUE_SIZE];
+	pthread_mutex_unlock(&_queue_mutex);
+
+	return message;
+}
+
+void
+Replay::commitQueueSlot()
+{
+	pthread_mutex_lock(&_queue_mutex);
+	++_queue_head;
+	pthread_cond_broadcast(&_queue_cond);
+	pthread_mutex_unlock(&_queue_mutex);
+}
+
+Replay::QueuedMessage &
+Replay::frontMessage()
+{
+	pthread_mutex_lock(&_queue_mutex);
+
+	while (_queue_head == _queue_tail) {
+		pthread_cond_wait(&_queue_cond, &_queue_mutex);
+	}
+
+	QueuedMessage &message = _queue[_queue_tail % QUEUE_SIZE];
+	pthread_mutex_unlock(&_queue_mutex);
+
+	return message;
+}
+
+void
+Replay::popMessage()
+{
+	pthread_mutex_lock(&_queue_mutex);
+	++_queue_tail;
+	pthread_cond_broadcast(&_queue_cond);
+	pthread_mutex_unlock(&_queue_mutex);
 }
 
 bool
-Replay::handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file)
+Replay::handleTopicUpdate(Subscription &sub, void *data)
 {
 	return publishTopic(sub, data);
 }
@@ -1081,10 +1198,6 @@ Replay::publishTopic(Subscription &sub, void *data)
 {
 	bool published = false;
 
-	if (sub.compat) {
-		data = sub.compat->apply(data);
-	}
-
 	if (sub.orb_advert) {
 		orb_publish(sub.orb_meta, sub.orb_advert, data);
 		published = true;
@@ -1202,6 +1315,34 @@ Replay::applyParams(bool quiet)
 Replay *
 Replay::instantiate(int argc, char *argv[])
 {
+	float start_time = 0.f;
+	float end_time = 0.f;
+
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "s:e:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 's':
+			start_time = strtof(myoptarg, nullptr);
+			break;
+
+		case 'e':
+			end_time = strtof(myoptarg, nullptr);
+			break;
+
+		default:
+			print_usage("unrecognized flag");
+			return nullptr;
+		}
+	}
+
+	if (start_time < 0.f || end_time < 0.f || (end_time > 0.f && end_time <= start_time)) {
+		print_usage("invalid time range");
+		return nullptr;
+	}
+
 	// check the replay mode
 	const char *replay_mode = getenv(replay::ENV_MODE);
 
@@ -1215,6 +1356,11 @@ Replay::instantiate(int argc, char *argv[])
 		instance = new Replay();
 	}
 
+	if (instance) {
+		instance->_start_time_offset = (uint64_t)(start_time * 1e6f);
+		instance->_end_time_offset = (uint64_t)(end_time * 1e6f);
+	}
+
 	return instance;
 }
 
@@ -1237,6 +1383,9 @@ the log file to be replayed. The second is the mode, specified via `replay_mode`
 - Generic otherwise: this can be used to replay any module(s), but the replay will be done with the same speed as the
   log was recorded.
 
+Optionally only a time range of the log is replayed (`-s` and `-e`, in seconds since the start of the log).
+The log is memory mapped and indexed once, so seeking to the start of the range is fast.
+
 The module is typically used together with uORB publisher rules, to specify which messages should be replayed.
 The replay module will just publish all messages that are found in the log. It also applies the parameters from
 the log.
@@ -1247,6 +1396,8 @@ page.
 
 	PRINT_MODULE_USAGE_NAME("replay", "system");
 	PRINT_MODULE_USAGE_COMMAND_DESCR("start", "Start replay, using log file from ENV variable 'replay'");
+	PRINT_MODULE_USAGE_PARAM_FLOAT('s', 0.f, 0.f, 1e9f, "Start time relative to the log start [s]", true);
+	PRINT_MODULE_USAGE_PARAM_FLOAT('e', 0.f, 0.f, 1e9f, "End time relative to the log start [s] (0 = until the end)", true);
 	PRINT_MODULE_USAGE_COMMAND_DESCR("trystart", "Same as 'start', but silently exit if no log file given");
 	PRINT_MODULE_USAGE_COMMAND_DESCR("tryapplyparams", "Try to apply the parameters from the log file");
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
@@ -36,11 +36,13 @@
 #include <algorithm>
 #include <fstream>
 #include <map>
+#include <pthread.h>
 #include <vector>
 #include <set>
 #include <string>
 
 #include "definitions.hpp"
+#include "ULogMappedFile.hpp"
 
 #include <px4_platform_common/module.h>
 #include <uORB/topics/uORBTopics.hpp>
@@ -52,9 +54,11 @@ namespace px4
 /**
  * @class Replay
  * Parses an ULog file and replays it in 'real-time'. The timestamp of each replayed message is offset
- * to match the starting time of replay. It keeps a stream for each subscription to find the next message
- * to replay. This is necessary because data messages from different subscriptions don't need to be in
- * monotonic increasing order.
+ * to match the starting time of replay. The file is memory mapped and indexed once, and each subscription
+ * keeps its position in the index of its data messages to find the next message to replay. This is
+ * necessary because data messages from different subscriptions don't need to be in monotonic increasing order.
+ * A reader thread determines the publication order and decodes the upcoming messages into a queue, while
+ * the main thread publishes them (and waits for the replayed modules).
  */
 class Replay : public ModuleBase<Replay>
 {
@@ -135,7 +139,8 @@ protected:
 
 		bool ignored = false; ///< if true, it will not be considered for publication in the main loop
 
-		std::streampos next_read_pos;
+		uint64_t next_read_pos{0}; ///< file offset of the next data message
+		size_t next_index{0}; ///< index of the next data message in the file index of the msg_id
 		uint64_t next_timestamp; ///< timestamp of the file
 
 		CompatBase *compat = nullptr;
@@ -190,28 +195,29 @@ protected:
 	 * handle the publication of a topic update
 	 * @return true if published, false otherwise
 	 */
-	virtual bool handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file);
+	virtual bool handleTopicUpdate(Subscription &sub, void *data);
 
 	/**
-	 * read a topic from the file (offset given by the subscription) into _read_buffer
+	 * read a topic from the file (offset given by the subscription) into _read_buffer and apply the compatibility
+	 * conversion
 	 */
-	void readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file);
+	void readTopicDataToBuffer(const Subscription &sub);
 
 	/**
-	 * Find next data message for this subscription, starting with the stored file offset.
-	 * Skip the first message, and if found, read the timestamp and store the new file offset.
-	 * This also takes care of new subscriptions and parameter updates. When reaching EOF,
-	 * the subscription is set to invalid.
-	 * File seek position is arbitrary after this call.
-	 * @return false on file error
+	 * Find the next data message for this subscription after the current one and read its timestamp.
+	 * When reaching the end of the file (or of the replayed time range), the subscription is set to invalid.
+	 * @return false if there are no more messages
 	 */
-	bool nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id);
+	bool nextDataMessage(Subscription &subscription, int msg_id)
+	{
+		return findDataMessage(subscription, msg_id, subscription.next_index + 1);
+	}
 
 	virtual uint64_t getTimestampOffset()
 	{
 		//we update the timestamps from the file by a constant offset to match
 		//the current replay time
-		return _replay_start_time - _file_start_time;
+		return _replay_start_time - (_file_start_time + _start_time_offset);
 	}
 
 	std::vector<Subscription *> _subscriptions;
@@ -242,15 +248,72 @@ private:
 
 	uint64_t _file_start_time;
 	uint64_t _replay_start_time;
-	std::streampos _data_section_start; ///< first ADD_LOGGED_MSG message
-
-	/** keep track of file position to avoid adding a subscription multiple times. */
-	std::streampos _subscription_file_pos = 0;
+	uint64_t _data_section_start; ///< first ADD_LOGGED_MSG message
 
 	int64_t _read_until_file_position = 1ULL << 60; ///< read limit if log contains appended data
 
+	ULogMappedFile _file;
+	size_t _next_additional_message{0}; ///< index into _file.additionalMessages()
+
+	uint64_t _start_time_offset{0}; ///< replayed time range relative to the file start time [us], 0 = unlimited
+	uint64_t _end_time_offset{0};
+
 	float _accumulated_delay{0.f};
 
+	/**
+	 * Upcoming data message of the main loop, decoded by the reader thread
+	 */
+	struct QueuedMessage {
+		int msg_id{-1}; ///< -1 marks the end of the replay
+		size_t index{0};
+		uint64_t read_pos{0};
+		uint64_t timestamp{0};
+		std::vector<uint8_t> data;
+	};
+
+	/**
+	 * Read position of the reader thread for a subscription. The reader thread only uses these and
+	 * does not touch the subscriptions, which belong to the main thread
+	 */
+	struct ReaderCursor {
+		const orb_metadata *orb_meta{nullptr}; ///< nullptr if not replayed in the main loop
+		int timestamp_offset{0};
+		CompatBase *compat{nullptr};
+		size_t index{0};
+		uint64_t read_pos{0};
+		uint64_t timestamp{0};
+	};
+
+	static constexpr size_t QUEUE_SIZE = 64;
+
+	std::vector<QueuedMessage> _queue;
+	std::vector<ReaderCursor> _reader_cursors;
+	size_t _queue_head{0}; ///< number of messages written by the reader thread
+	size_t _queue_tail{0}; ///< number of messages consumed by the main thread
+	bool _reader_stop{false};
+	bool _reader_running{false};
+	pthread_t _reader_thread{};
+	pthread_mutex_t _queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+	pthread_cond_t _queue_cond = PTHREAD_COND_INITIALIZER;
+
+	bool startReader();
+	void stopReader();
+	static void *readerThreadEntry(void *arg);
+	void readerThread();
+
+	/** reader thread: wait for a free queue slot, returns nullptr if the reader is stopped */
+	QueuedMessage *acquireQueueSlot();
+	void commitQueueSlot();
+
+	/** main thread: wait for the next decoded message */
+	QueuedMessage &frontMessage();
+	void popMessage();
+
+	/**
+	 * Copy the payload of a data message and apply the compatibility conversion
+	 */
+	void readTopicData(const orb_metadata *orb_meta, CompatBase *compat, uint64_t read_pos, uint8_t *buffer) const;
+
 	bool readFileHeader(std::ifstream &file);
 
 	/**
@@ -263,8 +326,31 @@ private:
 	///file parsing methods. They return false, when further parsing should be aborted.
 	bool readFormat(std::ifstream &file, uint16_t msg_size);
 
-	enum class ReadAndAndAddSubResult : uint8_t { kSuccess, kIgnoringMsg, kFailure };
-	ReadAndAndAddSubResult readAndAddSubscription(std::ifstream &file, uint16_t msg_size);
+	/**
+	 * Add a subscription for an ADD_LOGGED_MSG message and find its first data message
+	 * @param offset file offset of the message
+	 * @return true if added, false if the topic is ignored
+	 */
+	bool addSubscription(uint64_t offset);
+
+	/**
+	 * Find the first valid data message for a subscription, starting at an index position.
+	 * @return false if there are no more messages (the subscription is set to invalid)
+	 */
+	bool findDataMessage(Subscription &subscription, int msg_id, size_t index);
+
+	/**
+	 * Find the first valid data message of a msg_id, starting at index (updated to the found position)
+	 * @return false if there are no more messages
+	 */
+	bool findDataMessage(const orb_metadata *orb_meta, int timestamp_offset, int msg_id, size_t &index,
+			     uint64_t &read_pos, uint64_t &timestamp) const;
+
+	/**
+	 * Get the index of the first data message of a msg_id at or after the replay start time
+	 */
+	size_t findStartIndex(const Subscription &subscription, int msg_id) const;
+
 	bool readFlagBits(std::ifstream &file, uint16_t msg_size);
 
 	/**
@@ -275,14 +361,13 @@ private:
 	bool readDefinitionsAndApplyParams(std::ifstream &file);
 
 	/**
-	 * Read and handle additional messages starting at current file position, while position < end_position.
+	 * Handle the additional messages after the previously handled ones, while position < end_position.
 	 * This handles dropout and parameter update messages.
 	 * We need to handle these separately, because they have no timestamp. We look at the file position instead.
-	 * @return false on file error
 	 */
-	bool readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position);
-	bool readDropout(std::ifstream &file, uint16_t msg_size);
+	void handleAdditionalMessages(uint64_t end_position);
 	bool readAndApplyParameter(std::ifstream &file, uint16_t msg_size);
+	bool applyParameter(const uint8_t *message, uint16_t msg_size);
 
 	static const orb_metadata *findTopic(const std::string &name);
 
@@ -0,0 +1,205 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "ULogMappedFile.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <px4_platform_common/log.h>
+#include <logger/messages.h>
+
+namespace px4
+{
+
+static constexpr uint8_t sync_magic[8] {0x2F, 0x73, 0x13, 0x20, 0x25, 0x0C, 0xBB, 0x12};
+
+ULogMappedFile::~ULogMappedFile()
+{
+	close();
+}
+
+bool ULogMappedFile::open(const char *file_name)
+{
+	close();
+
+	_fd = ::open(file_name, O_RDONLY);
+
+	if (_fd < 0) {
+		PX4_ERR("failed to open %s (%i)", file_name, errno);
+		return false;
+	}
+
+	struct stat st;
+
+	if (fstat(_fd, &st) != 0 || st.st_size == 0) {
+		PX4_ERR("failed to get the size of %s", file_name);
+		close();
+		return false;
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, _fd, 0);
+
+	if (data == MAP_FAILED) {
+		PX4_ERR("failed to map %s (%i)", file_name, errno);
+		close();
+		return false;
+	}
+
+	// indexing reads the whole file once, replay mostly moves forward as well
+	madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+	_data = (const uint8_t *)data;
+	_size = st.st_size;
+	return true;
+}
+
+void ULogMappedFile::close()
+{
+	if (_data) {
+		munmap((void *)_data, _size);
+		_data = nullptr;
+		_size = 0;
+	}
+
+	if (_fd >= 0) {
+		::close(_fd);
+		_fd = -1;
+	}
+
+	_data_messages.clear();
+	_subscription_messages.clear();
+	_additional_messages.clear();
+	_num_compressed_messages = 0;
+	_num_resyncs = 0;
+}
+
+uint64_t ULogMappedFile::findSync(uint64_t offset, uint64_t end) const
+{
+	const uint64_t sync_size = ULOG_MSG_HEADER_LEN + sizeof(sync_magic);
+
+	for (; offset + sync_size <= end; ++offset) {
+		if (_data[offset + ULOG_MSG_HEADER_LEN] == sync_magic[0]
+		    && _data[offset + 2] == (uint8_t)ULogMessageType::SYNC
+		    && memcmp(_data + offset + ULOG_MSG_HEADER_LEN, sync_magic, sizeof(sync_magic)) == 0) {
+			return offset;
+		}
+	}
+
+	return end;
+}
+
+void ULogMappedFile::buildIndex(uint64_t data_section_start, uint64_t end)
+{
+	if (end > _size) {
+		end = _size;
+	}
+
+	uint64_t offset = data_section_start;
+
+	while (offset + ULOG_MSG_HEADER_LEN <= end) {
+		const uint16_t msg_size = messageSize(offset);
+		const uint8_t msg_type = _data[offset + 2];
+		const uint64_t next = offset + ULOG_MSG_HEADER_LEN + msg_size;
+
+		// a message exceeding the end is either corrupt or the incompletely written last message
+		bool valid = next <= end;
+
+		switch (valid ? msg_type : 0) {
+		case (uint8_t)ULogMessageType::DATA:
+			if (msg_size < sizeof(uint16_t)) {
+				valid = false;
+
+			} else {
+				const uint16_t msg_id = _data[offset + 3] | (_data[offset + 4] << 8);
+
+				if (_data_messages.size() <= msg_id) {
+					_data_messages.resize(msg_id + 1);
+				}
+
+				_data_messages[msg_id].push_back(offset);
+			}
+
+			break;
+
+		case (uint8_t)ULogMessageType::ADD_LOGGED_MSG:
+			_subscription_messages.push_back(offset);
+			break;
+
+		case (uint8_t)ULogMessageType::PARAMETER:
+		case (uint8_t)ULogMessageType::DROPOUT:
+			_additional_messages.push_back(offset);
+			break;
+
+		case (uint8_t)ULogMessageType::DATA_COMPRESSED:
+			_num_compressed_messages++;
+			break;
+
+		case (uint8_t)ULogMessageType::REMOVE_LOGGED_MSG:
+		case (uint8_t)ULogMessageType::INFO:
+		case (uint8_t)ULogMessageType::INFO_MULTIPLE:
+		case (uint8_t)ULogMessageType::SYNC:
+		case (uint8_t)ULogMessageType::LOGGING:
+		case (uint8_t)ULogMessageType::LOGGING_TAGGED:
+		case (uint8_t)ULogMessageType::PARAMETER_DEFAULT:
+			break;
+
+		default:
+			valid = false;
+			break;
+		}
+
+		if (valid) {
+			offset = next;
+
+		} else {
+			// corrupt data (e.g. an incompletely written buffer): continue at the next sync message
+			const uint64_t sync_offset = findSync(offset + 1, end);
+
+			if (sync_offset < end) {
+				PX4_WARN("invalid message type %i, size %i (offset %llu), continuing at offset %llu",
+					 (int)msg_type, (int)msg_size, (unsigned long long)offset, (unsigned long long)sync_offset);
+				_num_resyncs++;
+			}
+
+			offset = sync_offset;
+		}
+	}
+}
+
+} // namespace px4
@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace px4
+{
+
+/**
+ * @class ULogMappedFile
+ * Read-only memory mapping of an ULog file, with an index of the data section built in a single pass:
+ * the file offsets of the data messages per msg_id, of the subscriptions (ADD_LOGGED_MSG) and of the
+ * messages without timestamp that need to be handled in file order (parameter changes and dropouts).
+ * If the data section is corrupt at some point, indexing continues at the next sync message.
+ */
+class ULogMappedFile
+{
+public:
+	ULogMappedFile() = default;
+	~ULogMappedFile();
+
+	ULogMappedFile(const ULogMappedFile &) = delete;
+	ULogMappedFile &operator=(const ULogMappedFile &) = delete;
+
+	bool open(const char *file_name);
+	void close();
+
+	bool isOpen() const { return _data != nullptr; }
+
+	/**
+	 * Index the data section
+	 * @param data_section_start file offset of the first ADD_LOGGED_MSG message
+	 * @param end file offset after the last message to index (e.g. start of appended data)
+	 */
+	void buildIndex(uint64_t data_section_start, uint64_t end);
+
+	uint64_t size() const { return _size; }
+
+	/**
+	 * Get a pointer to the message at a file offset (starting with the ULog message header).
+	 * The offset must be an indexed one.
+	 */
+	const uint8_t *message(uint64_t offset) const { return _data + offset; }
+
+	/** payload size of the message at a file offset, excluding the header */
+	uint16_t messageSize(uint64_t offset) const { return (uint16_t)(_data[offset] | (_data[offset + 1] << 8)); }
+
+	/** file offsets of the data messages of a msg_id, in file order */
+	const std::vector<uint64_t> &dataMessages(uint16_t msg_id) const
+	{
+		return msg_id < _data_messages.size() ? _data_messages[msg_id] : _no_messages;
+	}
+
+	/** file offsets of the ADD_LOGGED_MSG messages, in file order */
+	const std::vector<uint64_t> &subscriptionMessages() const { return _subscription_messages; }
+
+	/** file offsets of the PARAMETER and DROPOUT messages, in file order */
+	const std::vector<uint64_t> &additionalMessages() const { return _additional_messages; }
+
+	unsigned numCompressedMessages() const { return _num_compressed_messages; }
+	unsigned numResyncs() const { return _num_resyncs; }
+
+private:
+	/**
+	 * Find the next sync message
+	 * @return file offset of the sync message, end if none found
+	 */
+	uint64_t findSync(uint64_t offset, uint64_t end) const;
+
+	int _fd{-1};
+	const uint8_t *_data{nullptr};
+	uint64_t _size{0};
+
+	std::vector<std::vector<uint64_t>> _data_messages;
+	std::vector<uint64_t> _subscription_messages;
+	std::vector<uint64_t> _additional_messages;
+	const std::vector<uint64_t> _no_messages;
+
+	unsigned _num_compressed_messages{0};
+	unsigned _num_resyncs{0};
+};
+
+} // namespace px4
@@ -46,25 +46,38 @@ RoverAckermann::RoverAckermann() :
 
 bool RoverAckermann::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	if (!_rover_control_pipeline.registerCallbacks()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
 	return true;
 }
 
 void RoverAckermann::updateParams()
 {
 	ModuleParams::updateParams();
+
+	// lateral acceleration per unit of v^2 * tan(steering angle) of the bicycle model
+	_wheel_base_inv = _param_ra_wheel_base.get() > FLT_EPSILON ? 1.f / _param_ra_wheel_base.get() : 0.f;
+
+	_rover_control_pipeline.setLookaheadMax(_param_pp_lookahd_max.get());
 }
 
 void RoverAckermann::Run()
 {
 	if (should_exit()) {
-		ScheduleClear();
+		_rover_control_pipeline.unregisterCallbacks();
 		exit_and_cleanup();
 		return;
 	}
 
 	updateSubscriptions();
 
+	const float vehicle_yaw = _rover_control_pipeline.yaw();
+	const float vehicle_forward_speed = _rover_control_pipeline.forwardSpeed();
+	const Vector2f &curr_pos_ned = _rover_control_pipeline.positionNed();
+
 	// Generate and publish speed and steering setpoints
 	hrt_abstime timestamp = hrt_absolute_time();
 
@@ -122,23 +135,22 @@ void RoverAckermann::Run()
 
 				} else { // Course control if the steering input is zero (keep driving on a straight line)
 					if (!_course_control) {
-						_pos_ctl_course_direction = Vector2f(cos(_vehicle_yaw), sin(_vehicle_yaw));
-						_pos_ctl_start_position_ned = _curr_pos_ned;
+						_pos_ctl_course_direction = Vector2f(cos(vehicle_yaw), sin(vehicle_yaw));
+						_pos_ctl_start_position_ned = curr_pos_ned;
 						_course_control = true;
 					}
 
-					// Construct a 'target waypoint' for course control s.t. it is never within the maximum lookahead of the rover
-					const float vector_scaling = sqrtf(powf(_param_pp_lookahd_max.get(),
-										2) + powf(_posctl_pure_pursuit.getCrosstrackError(), 2)) + _posctl_pure_pursuit.getDistanceOnLineSegment();
-					const Vector2f target_waypoint_ned = _pos_ctl_start_position_ned + sign(
-							rover_ackermann_setpoint.forward_speed_setpoint) *
-									     vector_scaling * _pos_ctl_course_direction;
+					// Drive along the course in the direction of the speed setpoint
+					const Vector2f course_direction = static_cast<float>(sign(rover_ackermann_setpoint.forward_speed_setpoint)) *
+									  _pos_ctl_course_direction;
+					const Vector2f target_waypoint_ned = _rover_control_pipeline.courseControlTarget(_posctl_pure_pursuit,
+									     _pos_ctl_start_position_ned, course_direction);
 					// Calculate steering setpoint
 					const float steering_setpoint = _ackermann_guidance.calcDesiredSteering(_posctl_pure_pursuit,
-									target_waypoint_ned, _pos_ctl_start_position_ned, _curr_pos_ned, _param_ra_wheel_base.get(),
-									rover_ackermann_setpoint.forward_speed_setpoint, _vehicle_yaw, _param_ra_max_steer_angle.get(), _armed);
-					rover_ackermann_setpoint.lateral_acceleration_setpoint = powf(_vehicle_forward_speed,
-							2.f) * tanf(steering_setpoint) / _param_ra_wheel_base.get();
+									target_waypoint_ned, _pos_ctl_start_position_ned, curr_pos_ned, _param_ra_wheel_base.get(),
+									rover_ackermann_setpoint.forward_speed_setpoint, vehicle_yaw, _param_ra_max_steer_angle.get(), _armed);
+					rover_ackermann_setpoint.lateral_acceleration_setpoint = vehicle_forward_speed * vehicle_forward_speed *
+							tanf(steering_setpoint) * _wheel_base_inv;
 				}
 
 				_rover_ackermann_setpoint_pub.publish(rover_ackermann_setpoint);
@@ -148,7 +160,7 @@ void RoverAckermann::Run()
 
 	case vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION:
 	case vehicle_status_s::NAVIGATION_STATE_AUTO_RTL:
-		_ackermann_guidance.computeGuidance(_vehicle_forward_speed, _vehicle_yaw, _nav_state, _armed);
+		_ackermann_guidance.computeGuidance(vehicle_forward_speed, vehicle_yaw, _nav_state, _armed);
 		break;
 
 	default: // Unimplemented nav states will stop the rover
@@ -167,13 +179,15 @@ void RoverAckermann::Run()
 		_ackermann_control.resetControllers();
 	}
 
-	_ackermann_control.computeMotorCommands(_vehicle_forward_speed, _vehicle_yaw, _vehicle_lateral_acceleration);
+	_ackermann_control.computeMotorCommands(vehicle_forward_speed, vehicle_yaw, _vehicle_lateral_acceleration);
 
 }
 
 void RoverAckermann::updateSubscriptions()
 {
 	if (_parameter_update_sub.updated()) {
+		parameter_update_s parameter_update;
+		_parameter_update_sub.copy(&parameter_update);
 		updateParams();
 	}
 
@@ -190,35 +204,26 @@ void RoverAckermann::updateSubscriptions()
 		_armed = vehicle_status.arming_state == 2;
 	}
 
-	if (_vehicle_attitude_sub.updated()) {
-		vehicle_attitude_s vehicle_attitude{};
-		_vehicle_attitude_sub.copy(&vehicle_attitude);
-		_vehicle_attitude_quaternion = matrix::Quatf(vehicle_attitude.q);
-		_vehicle_yaw = matrix::Eulerf(_vehicle_attitude_quaternion).psi();
-	}
+	_rover_control_pipeline.updateState();
 
-	if (_vehicle_local_position_sub.updated()) {
-		vehicle_local_position_s vehicle_local_position{};
-		_vehicle_local_position_sub.copy(&vehicle_local_position);
+	if (_rover_control_pipeline.localPositionUpdated()) {
+		const Vector3f &acceleration_ned = _rover_control_pipeline.accelerationNed();
 
-		if (PX4_ISFINITE(vehicle_local_position.ax)) {
-			_ax_filter.update(vehicle_local_position.ax);
+		if (PX4_ISFINITE(acceleration_ned(0))) {
+			_ax_filter.update(acceleration_ned(0));
 		}
 
-		if (PX4_ISFINITE(vehicle_local_position.ay)) {
-			_ay_filter.update(vehicle_local_position.ay);
+		if (PX4_ISFINITE(acceleration_ned(1))) {
+			_ay_filter.update(acceleration_ned(1));
 		}
 
-		if (PX4_ISFINITE(vehicle_local_position.az)) {
-			_az_filter.update(vehicle_local_position.az);
+		if (PX4_ISFINITE(acceleration_ned(2))) {
+			_az_filter.update(acceleration_ned(2));
 		}
 
-		_curr_pos_ned = Vector2f(vehicle_local_position.x, vehicle_local_position.y);
-		Vector3f velocity_in_local_frame(vehicle_local_position.vx, vehicle_local_position.vy, vehicle_local_position.vz);
-		Vector3f velocity_in_body_frame = _vehicle_attitude_quaternion.rotateVectorInverse(velocity_in_local_frame);
-		_vehicle_forward_speed = fabsf(velocity_in_body_frame(0)) > SPEED_THRESHOLD ? velocity_in_body_frame(0) : 0.f;
 		Vector3f acceleration_in_local_frame(_ax_filter.getState(), _ay_filter.getState(), _az_filter.getState());
-		Vector3f acceleration_in_body_frame = _vehicle_attitude_quaternion.rotateVectorInverse(acceleration_in_local_frame);
+		Vector3f acceleration_in_body_frame = _rover_control_pipeline.attitude().rotateVectorInverse(
+				acceleration_in_local_frame);
 		_vehicle_lateral_acceleration = acceleration_in_body_frame(1);
 	}
 }
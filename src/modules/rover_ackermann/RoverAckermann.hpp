@@ -40,6 +40,7 @@
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <lib/pure_pursuit/PurePursuit.hpp>
+#include <lib/rover_control/RoverControlPipeline.hpp>
 
 // uORB includes
 #include <uORB/Publication.hpp>
@@ -48,8 +49,6 @@
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/vehicle_status.h>
 #include <uORB/topics/rover_ackermann_setpoint.h>
-#include <uORB/topics/vehicle_local_position.h>
-#include <uORB/topics/vehicle_attitude.h>
 
 
 // Standard library includes
@@ -66,8 +65,6 @@ using namespace time_literals;
 // Constants
 static constexpr float STICK_DEADZONE =
 	0.1f; // [0, 1] Percentage of stick input range that will be interpreted as zero around the stick centered value
-static constexpr float SPEED_THRESHOLD =
-	0.1f; // [m/s] The minimum threshold for the speed measurement not to be interpreted as zero
 
 class RoverAckermann : public ModuleBase<RoverAckermann>, public ModuleParams,
 	public px4::ScheduledWorkItem
@@ -106,28 +103,24 @@ private:
 	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
 	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
-	uORB::Subscription _vehicle_local_position_sub{ORB_ID(vehicle_local_position)};
-	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
 
 	// uORB publications
 	uORB::Publication<rover_ackermann_setpoint_s> _rover_ackermann_setpoint_pub{ORB_ID(rover_ackermann_setpoint)};
 
 	// Class instances
+	RoverControlPipeline _rover_control_pipeline{this};
 	RoverAckermannGuidance _ackermann_guidance{this};
 	RoverAckermannControl _ackermann_control{this};
 	PurePursuit _posctl_pure_pursuit{this}; // Pure pursuit library
 
 	// Variables
-	matrix::Quatf _vehicle_attitude_quaternion{};
 	int _nav_state{0};
-	float _vehicle_forward_speed{0.f};
-	float _vehicle_yaw{0.f};
 	bool _armed{false};
 	bool _course_control{false};
 	Vector2f _pos_ctl_course_direction{};
 	Vector2f _pos_ctl_start_position_ned{};
-	Vector2f _curr_pos_ned{};
 	float _vehicle_lateral_acceleration{0.f};
+	float _wheel_base_inv{0.f}; // Cached ackermann kinematics [1/m]
 	AlphaFilter<float> _ax_filter;
 	AlphaFilter<float> _ay_filter;
 	AlphaFilter<float> _az_filter;
@@ -43,7 +43,11 @@ RoverDifferential::RoverDifferential() :
 
 bool RoverDifferential::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	if (!_rover_control_pipeline.registerCallbacks()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
 	return true;
 }
 
@@ -51,18 +55,31 @@ void RoverDifferential::updateParams()
 {
 	ModuleParams::updateParams();
 	_max_yaw_rate = _param_rd_max_yaw_rate.get() * M_DEG_TO_RAD_F;
+
+	// speed difference of the wheels for a yaw rate, normalized by the speed difference at full throttle
+	_yaw_rate_to_speed_diff_normalized = 0.f;
+
+	if (_max_yaw_rate > FLT_EPSILON && _param_rd_max_thr_yaw_r.get() > FLT_EPSILON) {
+		_yaw_rate_to_speed_diff_normalized = _param_rd_wheel_track.get() / (2.f * _param_rd_max_thr_yaw_r.get());
+	}
+
+	_rover_control_pipeline.setLookaheadMax(_param_pp_lookahd_max.get());
 }
 
 void RoverDifferential::Run()
 {
 	if (should_exit()) {
-		ScheduleClear();
+		_rover_control_pipeline.unregisterCallbacks();
 		exit_and_cleanup();
 		return;
 	}
 
 	updateSubscriptions();
 
+	const float vehicle_yaw = _rover_control_pipeline.yaw();
+	const float vehicle_forward_speed = _rover_control_pipeline.forwardSpeed();
+	const Vector2f &curr_pos_ned = _rover_control_pipeline.positionNed();
+
 	// Generate and publish attitude, rate and speed setpoints
 	hrt_abstime timestamp = hrt_absolute_time();
 
@@ -77,12 +94,11 @@ void RoverDifferential::Run()
 				rover_differential_setpoint.forward_speed_setpoint_normalized = manual_control_setpoint.throttle;
 				rover_differential_setpoint.yaw_setpoint = NAN;
 
-				if (_max_yaw_rate > FLT_EPSILON && _param_rd_max_thr_yaw_r.get() > FLT_EPSILON) {
+				if (_yaw_rate_to_speed_diff_normalized > FLT_EPSILON) {
 					const float scaled_yaw_rate_input = math::interpolate<float>(manual_control_setpoint.roll,
 									    -1.f, 1.f, -_max_yaw_rate, _max_yaw_rate);
-					const float speed_diff = scaled_yaw_rate_input * _param_rd_wheel_track.get() / 2.f;
-					rover_differential_setpoint.speed_diff_setpoint_normalized = math::interpolate<float>(speed_diff,
-							-_param_rd_max_thr_yaw_r.get(), _param_rd_max_thr_yaw_r.get(), -1.f, 1.f);
+					rover_differential_setpoint.speed_diff_setpoint_normalized = math::constrain(scaled_yaw_rate_input *
+							_yaw_rate_to_speed_diff_normalized, -1.f, 1.f);
 
 				} else {
 					rover_differential_setpoint.speed_diff_setpoint_normalized = manual_control_setpoint.roll;
@@ -131,7 +147,7 @@ void RoverDifferential::Run()
 
 				} else { // Closed loop yaw control if the yaw rate input is zero (keep current yaw)
 					if (!_yaw_ctl) {
-						_stab_desired_yaw = _vehicle_yaw;
+						_stab_desired_yaw = vehicle_yaw;
 						_yaw_ctl = true;
 					}
 
@@ -166,20 +182,19 @@ void RoverDifferential::Run()
 
 				} else { // Course control if the yaw rate input is zero (keep driving on a straight line)
 					if (!_yaw_ctl) {
-						_pos_ctl_course_direction = Vector2f(cos(_vehicle_yaw), sin(_vehicle_yaw));
-						_pos_ctl_start_position_ned = _curr_pos_ned;
+						_pos_ctl_course_direction = Vector2f(cos(vehicle_yaw), sin(vehicle_yaw));
+						_pos_ctl_start_position_ned = curr_pos_ned;
 						_yaw_ctl = true;
 					}
 
-					// Construct a 'target waypoint' for course control s.t. it is never within the maximum lookahead of the rover
-					const float vector_scaling = sqrtf(powf(_param_pp_lookahd_max.get(),
-										2) + powf(_posctl_pure_pursuit.getCrosstrackError(), 2)) + _posctl_pure_pursuit.getDistanceOnLineSegment();
-					const Vector2f target_waypoint_ned = _pos_ctl_start_position_ned + sign(
-							rover_differential_setpoint.forward_speed_setpoint) *
-									     vector_scaling * _pos_ctl_course_direction;
+					// Drive along the course in the direction of the speed setpoint
+					const Vector2f course_direction = static_cast<float>(sign(rover_differential_setpoint.forward_speed_setpoint)) *
+									  _pos_ctl_course_direction;
+					const Vector2f target_waypoint_ned = _rover_control_pipeline.courseControlTarget(_posctl_pure_pursuit,
+									     _pos_ctl_start_position_ned, course_direction);
 					// Calculate yaw setpoint
 					const float yaw_setpoint = _posctl_pure_pursuit.calcDesiredHeading(target_waypoint_ned,
-								   _pos_ctl_start_position_ned, _curr_pos_ned, fabsf(_vehicle_forward_speed));
+								   _pos_ctl_start_position_ned, curr_pos_ned, fabsf(vehicle_forward_speed));
 					rover_differential_setpoint.yaw_setpoint = sign(rover_differential_setpoint.forward_speed_setpoint) >= 0 ?
 							yaw_setpoint : matrix::wrap_pi(M_PI_F + yaw_setpoint); // Flip yaw setpoint when driving backwards
 					rover_differential_setpoint.yaw_rate_setpoint = NAN;
@@ -193,7 +208,7 @@ void RoverDifferential::Run()
 
 	case vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION:
 	case vehicle_status_s::NAVIGATION_STATE_AUTO_RTL:
-		_rover_differential_guidance.computeGuidance(_vehicle_yaw, _vehicle_forward_speed, _nav_state);
+		_rover_differential_guidance.computeGuidance(vehicle_yaw, vehicle_forward_speed, _nav_state);
 		break;
 
 	default: // Unimplemented nav states will stop the rover
@@ -214,7 +229,7 @@ void RoverDifferential::Run()
 		_yaw_ctl = false;
 	}
 
-	_rover_differential_control.computeMotorCommands(_vehicle_yaw, _vehicle_yaw_rate, _vehicle_forward_speed);
+	_rover_differential_control.computeMotorCommands(vehicle_yaw, _vehicle_yaw_rate, vehicle_forward_speed);
 
 }
 
@@ -240,27 +255,10 @@ void RoverDifferential::updateSubscriptions()
 		_armed = vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED;
 	}
 
-	if (_vehicle_angular_velocity_sub.updated()) {
-		vehicle_angular_velocity_s vehicle_angular_velocity{};
-		_vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity);
-		_vehicle_yaw_rate = fabsf(vehicle_angular_velocity.xyz[2]) > YAW_RATE_THRESHOLD ? vehicle_angular_velocity.xyz[2] : 0.f;
-	}
+	_rover_control_pipeline.updateState();
 
-	if (_vehicle_attitude_sub.updated()) {
-		vehicle_attitude_s vehicle_attitude{};
-		_vehicle_attitude_sub.copy(&vehicle_attitude);
-		_vehicle_attitude_quaternion = matrix::Quatf(vehicle_attitude.q);
-		_vehicle_yaw = matrix::Eulerf(_vehicle_attitude_quaternion).psi();
-	}
-
-	if (_vehicle_local_position_sub.updated()) {
-		vehicle_local_position_s vehicle_local_position{};
-		_vehicle_local_position_sub.copy(&vehicle_local_position);
-		_curr_pos_ned = Vector2f(vehicle_local_position.x, vehicle_local_position.y);
-		Vector3f velocity_in_local_frame(vehicle_local_position.vx, vehicle_local_position.vy, vehicle_local_position.vz);
-		Vector3f velocity_in_body_frame = _vehicle_attitude_quaternion.rotateVectorInverse(velocity_in_local_frame);
-		_vehicle_forward_speed = fabsf(velocity_in_body_frame(0)) > SPEED_THRESHOLD ? velocity_in_body_frame(0) : 0.f;
-	}
+	const float yaw_rate = _rover_control_pipeline.yawRate();
+	_vehicle_yaw_rate = fabsf(yaw_rate) > YAW_RATE_THRESHOLD ? yaw_rate : 0.f;
 }
 
 int RoverDifferential::task_spawn(int argc, char *argv[])
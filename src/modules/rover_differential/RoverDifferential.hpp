@@ -40,6 +40,7 @@
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <lib/pure_pursuit/PurePursuit.hpp>
+#include <lib/rover_control/RoverControlPipeline.hpp>
 
 // uORB includes
 #include <uORB/Publication.hpp>
@@ -47,9 +48,6 @@
 #include <uORB/topics/manual_control_setpoint.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/vehicle_status.h>
-#include <uORB/topics/vehicle_angular_velocity.h>
-#include <uORB/topics/vehicle_attitude.h>
-#include <uORB/topics/vehicle_local_position.h>
 #include <uORB/topics/rover_differential_setpoint.h>
 
 // Standard libraries
@@ -66,8 +64,6 @@ static constexpr float STICK_DEADZONE =
 	0.1f; // [0, 1] Percentage of stick input range that will be interpreted as zero around the stick centered value
 static constexpr float YAW_RATE_THRESHOLD =
 	0.02f; // [rad/s] The minimum threshold for the yaw rate measurement not to be interpreted as zero
-static constexpr float SPEED_THRESHOLD =
-	0.1f; // [m/s] The minimum threshold for the speed measurement not to be interpreted as zero
 
 class RoverDifferential : public ModuleBase<RoverDifferential>, public ModuleParams,
 	public px4::ScheduledWorkItem
@@ -101,26 +97,21 @@ private:
 	// uORB Subscriptions
 	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
 	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
-	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
-	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
-	uORB::Subscription _vehicle_local_position_sub{ORB_ID(vehicle_local_position)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 
 	// uORB Publications
 	uORB::Publication<rover_differential_setpoint_s> _rover_differential_setpoint_pub{ORB_ID(rover_differential_setpoint)};
 
 	// Instances
+	RoverControlPipeline _rover_control_pipeline{this};
 	RoverDifferentialGuidance _rover_differential_guidance{this};
 	RoverDifferentialControl _rover_differential_control{this};
 	PurePursuit _posctl_pure_pursuit{this}; // Pure pursuit library
 
 	// Variables
-	Vector2f _curr_pos_ned{};
-	matrix::Quatf _vehicle_attitude_quaternion{};
 	float _vehicle_yaw_rate{0.f};
-	float _vehicle_forward_speed{0.f};
-	float _vehicle_yaw{0.f};
 	float _max_yaw_rate{0.f};
+	float _yaw_rate_to_speed_diff_normalized{0.f}; // Cached differential drive kinematics, 0 if not configured
 	int _nav_state{0};
 	bool _armed{false};
 	bool _yaw_ctl{false}; // Indicates if the rover is doing yaw or yaw rate control in Stabilized and Position mode
@@ -45,7 +45,11 @@ RoverMecanum::RoverMecanum() :
 
 bool RoverMecanum::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	if (!_rover_control_pipeline.registerCallbacks()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
 	return true;
 }
 
@@ -54,18 +58,30 @@ void RoverMecanum::updateParams()
 	ModuleParams::updateParams();
 
 	_max_yaw_rate = _param_rm_max_yaw_rate.get() * M_DEG_TO_RAD_F;
+
+	// speed difference of the wheels for a yaw rate, normalized by the speed difference at full throttle
+	_yaw_rate_to_speed_diff_normalized = 0.f;
+
+	if (_max_yaw_rate > FLT_EPSILON && _param_rm_max_thr_yaw_r.get() > FLT_EPSILON) {
+		_yaw_rate_to_speed_diff_normalized = _param_rm_wheel_track.get() / (2.f * _param_rm_max_thr_yaw_r.get());
+	}
+
+	_rover_control_pipeline.setLookaheadMax(_param_pp_lookahd_max.get());
 }
 
 void RoverMecanum::Run()
 {
 	if (should_exit()) {
-		ScheduleClear();
+		_rover_control_pipeline.unregisterCallbacks();
 		exit_and_cleanup();
 		return;
 	}
 
 	updateSubscriptions();
 
+	const float vehicle_yaw = _rover_control_pipeline.yaw();
+	const Vector2f &curr_pos_ned = _rover_control_pipeline.positionNed();
+
 	// Generate and publish attitude and velocity setpoints
 	hrt_abstime timestamp = hrt_absolute_time();
 
@@ -82,12 +98,11 @@ void RoverMecanum::Run()
 				rover_mecanum_setpoint.lateral_speed_setpoint_normalized = manual_control_setpoint.roll;
 				rover_mecanum_setpoint.yaw_rate_setpoint = NAN;
 
-				if (_max_yaw_rate > FLT_EPSILON && _param_rm_max_thr_yaw_r.get() > FLT_EPSILON) {
+				if (_yaw_rate_to_speed_diff_normalized > FLT_EPSILON) {
 					const float scaled_yaw_rate_input = math::interpolate<float>(manual_control_setpoint.yaw,
 									    -1.f, 1.f, -_max_yaw_rate, _max_yaw_rate);
-					const float speed_diff = scaled_yaw_rate_input * _param_rm_wheel_track.get() / 2.f;
-					rover_mecanum_setpoint.speed_diff_setpoint_normalized = math::interpolate<float>(speed_diff,
-							-_param_rm_max_thr_yaw_r.get(), _param_rm_max_thr_yaw_r.get(), -1.f, 1.f);
+					rover_mecanum_setpoint.speed_diff_setpoint_normalized = math::constrain(scaled_yaw_rate_input *
+							_yaw_rate_to_speed_diff_normalized, -1.f, 1.f);
 
 				} else {
 					rover_mecanum_setpoint.speed_diff_setpoint_normalized = manual_control_setpoint.yaw;
@@ -142,7 +157,7 @@ void RoverMecanum::Run()
 				} else { // Closed loop yaw control
 
 					if (!_yaw_ctl) {
-						_desired_yaw = _vehicle_yaw;
+						_desired_yaw = vehicle_yaw;
 						_yaw_ctl = true;
 					}
 
@@ -199,21 +214,20 @@ void RoverMecanum::Run()
 					const float desired_velocity_magnitude = velocity.norm();
 
 					if (!_yaw_ctl) {
-						_desired_yaw = _vehicle_yaw;
+						_desired_yaw = vehicle_yaw;
 						_yaw_ctl = true;
-						_pos_ctl_start_position_ned = _curr_pos_ned;
-						const Vector3f pos_ctl_course_direction_local = _vehicle_attitude_quaternion.rotateVector(velocity.normalized());
+						_pos_ctl_start_position_ned = curr_pos_ned;
+						const Vector3f pos_ctl_course_direction_local = _rover_control_pipeline.attitude().rotateVector(
+									velocity.normalized());
 						_pos_ctl_course_direction = Vector2f(pos_ctl_course_direction_local(0), pos_ctl_course_direction_local(1));
 
 					}
 
-					// Construct a 'target waypoint' for course control s.t. it is never within the maximum lookahead of the rover
-					const float vector_scaling = sqrtf(powf(_param_pp_lookahd_max.get(),
-										2) + powf(_posctl_pure_pursuit.getCrosstrackError(), 2)) + _posctl_pure_pursuit.getDistanceOnLineSegment();
-					const Vector2f target_waypoint_ned = _pos_ctl_start_position_ned + vector_scaling * _pos_ctl_course_direction;
+					const Vector2f target_waypoint_ned = _rover_control_pipeline.courseControlTarget(_posctl_pure_pursuit,
+									     _pos_ctl_start_position_ned, _pos_ctl_course_direction);
 					const float desired_heading = _posctl_pure_pursuit.calcDesiredHeading(target_waypoint_ned, _pos_ctl_start_position_ned,
-								      _curr_pos_ned, desired_velocity_magnitude);
-					const float heading_error = matrix::wrap_pi(desired_heading - _vehicle_yaw);
+								      curr_pos_ned, desired_velocity_magnitude);
+					const float heading_error = matrix::wrap_pi(desired_heading - vehicle_yaw);
 					const Vector2f desired_velocity = desired_velocity_magnitude * Vector2f(cosf(heading_error), sinf(heading_error));
 					rover_mecanum_setpoint.forward_speed_setpoint = desired_velocity(0);
 					rover_mecanum_setpoint.lateral_speed_setpoint = desired_velocity(1);
@@ -227,7 +241,7 @@ void RoverMecanum::Run()
 
 	case vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION:
 	case vehicle_status_s::NAVIGATION_STATE_AUTO_RTL:
-		_rover_mecanum_guidance.computeGuidance(_vehicle_yaw, _nav_state);
+		_rover_mecanum_guidance.computeGuidance(vehicle_yaw, _nav_state);
 		break;
 
 	default: // Unimplemented nav states will stop the rover
@@ -249,8 +263,8 @@ void RoverMecanum::Run()
 		_yaw_ctl = false;
 	}
 
-	_rover_mecanum_control.computeMotorCommands(_vehicle_yaw, _vehicle_yaw_rate, _vehicle_forward_speed,
-			_vehicle_lateral_speed);
+	_rover_mecanum_control.computeMotorCommands(vehicle_yaw, _vehicle_yaw_rate, _rover_control_pipeline.forwardSpeed(),
+			_rover_control_pipeline.lateralSpeed());
 
 }
 
@@ -272,7 +286,7 @@ void RoverMecanum::updateSubscriptions()
 
 			if (vehicle_status.nav_state == vehicle_status_s::NAVIGATION_STATE_AUTO_MISSION
 			    || vehicle_status.nav_state == vehicle_status_s::NAVIGATION_STATE_AUTO_RTL) {
-				_rover_mecanum_guidance.setDesiredYaw(_vehicle_yaw);
+				_rover_mecanum_guidance.setDesiredYaw(_rover_control_pipeline.yaw());
 			}
 		}
 
@@ -280,39 +294,19 @@ void RoverMecanum::updateSubscriptions()
 		_armed = vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED;
 	}
 
-	if (_vehicle_local_position_sub.updated()) {
-		vehicle_local_position_s vehicle_local_position{};
-		_vehicle_local_position_sub.copy(&vehicle_local_position);
-		_curr_pos_ned = Vector2f(vehicle_local_position.x, vehicle_local_position.y);
-		Vector3f velocity_in_local_frame(vehicle_local_position.vx, vehicle_local_position.vy, vehicle_local_position.vz);
-		Vector3f velocity_in_body_frame = _vehicle_attitude_quaternion.rotateVectorInverse(velocity_in_local_frame);
-		// Apply threshold to the velocity measurement to cut off measurement noise when standing still
-		_vehicle_forward_speed = fabsf(velocity_in_body_frame(0)) > SPEED_THRESHOLD ? velocity_in_body_frame(0) : 0.f;
-		_vehicle_lateral_speed = fabsf(velocity_in_body_frame(1)) > SPEED_THRESHOLD ? velocity_in_body_frame(1) : 0.f;
-	}
-
-	if (_vehicle_angular_velocity_sub.updated()) {
-		vehicle_angular_velocity_s vehicle_angular_velocity{};
-		_vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity);
+	_rover_control_pipeline.updateState();
 
-		// Apply threshold to the yaw rate measurement if the rover is standing still to avoid stuttering due to closed loop yaw(rate) control
-		if ((fabsf(_vehicle_forward_speed) > FLT_EPSILON && fabsf(_vehicle_lateral_speed) > FLT_EPSILON)
-		    || fabsf(vehicle_angular_velocity.xyz[2]) > YAW_RATE_THRESHOLD) {
-			_vehicle_yaw_rate = vehicle_angular_velocity.xyz[2];
+	// Apply threshold to the yaw rate measurement if the rover is standing still to avoid stuttering due to closed loop yaw(rate) control
+	const float yaw_rate = _rover_control_pipeline.yawRate();
+	const float forward_speed = _rover_control_pipeline.forwardSpeed();
+	const float lateral_speed = _rover_control_pipeline.lateralSpeed();
 
-		} else {
-			_vehicle_yaw_rate = 0.f;
-		}
+	if ((fabsf(forward_speed) > FLT_EPSILON && fabsf(lateral_speed) > FLT_EPSILON) || fabsf(yaw_rate) > YAW_RATE_THRESHOLD) {
+		_vehicle_yaw_rate = yaw_rate;
 
+	} else {
+		_vehicle_yaw_rate = 0.f;
 	}
-
-	if (_vehicle_attitude_sub.updated()) {
-		vehicle_attitude_s vehicle_attitude{};
-		_vehicle_attitude_sub.copy(&vehicle_attitude);
-		_vehicle_attitude_quaternion = matrix::Quatf(vehicle_attitude.q);
-		_vehicle_yaw = matrix::Eulerf(_vehicle_attitude_quaternion).psi();
-	}
-
 }
 
 int RoverMecanum::task_spawn(int argc, char *argv[])
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file DeltaAngleWindow.hpp
+ *
+ * History of integrated gyro delta angles (e.g. from vehicle_imu) that can
+ * be queried for the rotation over an arbitrary time window. Samples that
+ * only partially overlap the window are included proportionally.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <mathlib/mathlib.h>
+#include <matrix/math.hpp>
+
+namespace sensors
+{
+
+template<int N>
+class DeltaAngleWindow
+{
+public:
+	/**
+	 * Add a delta angle integrated over the dt_us before timestamp_sample.
+	 * Samples older than the newest one are ignored.
+	 */
+	void put(hrt_abstime timestamp_sample, const matrix::Vector3f &delta_angle, uint32_t dt_us)
+	{
+		if (dt_us == 0 || timestamp_sample < dt_us || (_count > 0 && timestamp_sample <= _samples[newest()].timestamp_sample)) {
+			return;
+		}
+
+		_samples[_head] = Sample{timestamp_sample, dt_us, delta_angle};
+		_head = (_head + 1) % N;
+
+		if (_count < N) {
+			_count++;
+		}
+	}
+
+	void reset() { _count = 0; }
+
+	/**
+	 * @return timestamp up to which delta angles are available, 0 if empty
+	 */
+	hrt_abstime newest_timestamp() const { return (_count > 0) ? _samples[newest()].timestamp_sample : 0; }
+
+	/**
+	 * Rotation over [t_start, t_end]. Gaps of up to max_gap_ratio of the window
+	 * (dropped samples, start of the history) are filled with the average rate.
+	 *
+	 * @return false if the history does not cover the window sufficiently
+	 */
+	bool integrate(hrt_abstime t_start, hrt_abstime t_end, matrix::Vector3f &delta_angle, float max_gap_ratio = 0.1f) const
+	{
+		delta_angle.zero();
+
+		if (t_end <= t_start || _count == 0) {
+			return false;
+		}
+
+		uint64_t covered_us = 0;
+
+		for (int i = 0; i < _count; i++) {
+			const Sample &sample = _samples[(_head - 1 - i + N) % N];
+			const hrt_abstime sample_start = sample.timestamp_sample - sample.dt_us;
+
+			if (sample.timestamp_sample <= t_start) {
+				// all older samples are before the window
+				break;
+			}
+
+			if (sample_start >= t_end) {
+				continue;
+			}
+
+			const hrt_abstime overlap_start = math::max(sample_start, t_start);
+			const hrt_abstime overlap_end = math::min(sample.timestamp_sample, t_end);
+			const uint32_t overlap_us = overlap_end - overlap_start;
+
+			delta_angle += sample.delta_angle * ((float)overlap_us / (float)sample.dt_us);
+			covered_us += overlap_us;
+		}
+
+		const uint64_t window_us = t_end - t_start;
+
+		if (covered_us == 0 || (float)(window_us - covered_us) > max_gap_ratio * (float)window_us) {
+			delta_angle.zero();
+			return false;
+		}
+
+		if (covered_us < window_us) {
+			delta_angle *= (float)window_us / (float)covered_us;
+		}
+
+		return true;
+	}
+
+private:
+	struct Sample {
+		hrt_abstime timestamp_sample;
+		uint32_t dt_us;
+		matrix::Vector3f delta_angle;
+	};
+
+	int newest() const { return (_head - 1 + N) % N; }
+
+	Sample _samples[N] {};
+	int _head{0};
+	int _count{0};
+};
+
+} // namespace sensors
@@ -0,0 +1,115 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the delta angle window integration
+ * Run this test only using make tests TESTFILTER=DeltaAngleWindow
+ */
+
+#include <gtest/gtest.h>
+
+#include "DeltaAngleWindow.hpp"
+
+using matrix::Vector3f;
+using sensors::DeltaAngleWindow;
+
+static constexpr uint32_t DT_US = 4000; // 250 Hz
+static const Vector3f RATE{0.5f, -1.f, 2.f}; // rad/s
+
+static void fill(DeltaAngleWindow<32> &window, hrt_abstime start, int samples, int skip = -1)
+{
+	for (int i = 1; i <= samples; i++) {
+		if (i != skip) {
+			window.put(start + i * DT_US, RATE * (DT_US * 1e-6f), DT_US);
+		}
+	}
+}
+
+TEST(DeltaAngleWindow, empty)
+{
+	DeltaAngleWindow<32> window;
+	Vector3f delta_angle;
+	EXPECT_FALSE(window.integrate(1000, 2000, delta_angle));
+	EXPECT_EQ(window.newest_timestamp(), 0);
+}
+
+TEST(DeltaAngleWindow, alignedWindow)
+{
+	DeltaAngleWindow<32> window;
+	fill(window, 100000, 20);
+
+	Vector3f delta_angle;
+	ASSERT_TRUE(window.integrate(100000 + 2 * DT_US, 100000 + 7 * DT_US, delta_angle));
+	EXPECT_TRUE(delta_angle == RATE * (5 * DT_US * 1e-6f));
+}
+
+TEST(DeltaAngleWindow, partialSamples)
+{
+	DeltaAngleWindow<32> window;
+	fill(window, 100000, 20);
+
+	// 10 ms window starting and ending inside a sample
+	Vector3f delta_angle;
+	ASSERT_TRUE(window.integrate(100000 + 1500, 100000 + 11500, delta_angle));
+	EXPECT_TRUE(delta_angle == RATE * 10e-3f);
+}
+
+TEST(DeltaAngleWindow, notCovered)
+{
+	DeltaAngleWindow<32> window;
+	fill(window, 100000, 10);
+
+	// window ends 20 ms after the newest sample
+	Vector3f delta_angle;
+	EXPECT_FALSE(window.integrate(100000 + 5 * DT_US, 100000 + 15 * DT_US, delta_angle));
+
+	// window older than the history (only the newest 32 are kept)
+	fill(window, 100000 + 10 * DT_US, 40);
+	EXPECT_FALSE(window.integrate(100000, 100000 + 5 * DT_US, delta_angle));
+}
+
+TEST(DeltaAngleWindow, droppedSample)
+{
+	DeltaAngleWindow<32> window;
+
+	// one missing sample in a 15 sample window is filled with the average rate
+	fill(window, 100000, 20, 10);
+
+	Vector3f delta_angle;
+	ASSERT_TRUE(window.integrate(100000 + 2 * DT_US, 100000 + 17 * DT_US, delta_angle));
+	EXPECT_TRUE(delta_angle == RATE * (15 * DT_US * 1e-6f));
+
+	// but not in a 3 sample window
+	EXPECT_FALSE(window.integrate(100000 + 8 * DT_US, 100000 + 11 * DT_US, delta_angle));
+}
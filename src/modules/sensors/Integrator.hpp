@@ -75,6 +75,48 @@ public:
 		}
 	}
 
+	/**
+	 * Put a block of equally spaced samples (eg. a sensor FIFO) into the integral.
+	 * The block counts as a single sample for set_reset_samples().
+	 *
+	 * @param x, y, z	Samples, the last one is the most recent.
+	 * @param N		Number of samples.
+	 * @param dt		Interval between samples in seconds.
+	 * @param scale		Scale applied to the samples.
+	 */
+	template<typename T>
+	inline void put(const T x[], const T y[], const T z[], const int N, const float dt, const float scale = 1.f)
+	{
+		if (N <= 0) {
+			return;
+		}
+
+		const matrix::Vector3f last_val{x[N - 1] *scale, y[N - 1] *scale, z[N - 1] *scale};
+
+		if ((dt > DT_MIN) && (_integral_dt + N * dt < DT_MAX)) {
+			// trapezoidal integration: dt * (0.5 * previous + x[0] + ... + x[N - 2] + 0.5 * x[N - 1])
+			float sum_x = 0.f;
+			float sum_y = 0.f;
+			float sum_z = 0.f;
+
+			for (int n = 0; n < N - 1; n++) {
+				sum_x += x[n];
+				sum_y += y[n];
+				sum_z += z[n];
+			}
+
+			const matrix::Vector3f sum{sum_x * scale, sum_y * scale, sum_z * scale};
+			_alpha += ((_last_val + last_val) * 0.5f + sum) * dt;
+			_integral_dt += N * dt;
+			_integrated_samples++;
+
+		} else {
+			reset();
+		}
+
+		_last_val = last_val;
+	}
+
 	/**
 	 * Set reset interval during runtime. This won't reset the integrator.
 	 *
@@ -186,6 +228,58 @@ public:
 		}
 	}
 
+	/**
+	 * Put a block of equally spaced samples (eg. a sensor FIFO) into the integral, including the coning
+	 * corrections of every sample. Same result as put() for each sample, but the integrator state is kept
+	 * in local variables during the loop.
+	 * The block counts as a single sample for set_reset_samples().
+	 *
+	 * @param x, y, z	Samples, the last one is the most recent.
+	 * @param N		Number of samples.
+	 * @param dt		Interval between samples in seconds.
+	 * @param scale		Scale applied to the samples.
+	 */
+	template<typename T>
+	inline void put(const T x[], const T y[], const T z[], const int N, const float dt, const float scale = 1.f)
+	{
+		if (N <= 0) {
+			return;
+		}
+
+		if ((dt > DT_MIN) && (_integral_dt + N * dt < DT_MAX)) {
+			matrix::Vector3f alpha{_alpha};
+			matrix::Vector3f beta{_beta};
+			matrix::Vector3f last_val{_last_val};
+			matrix::Vector3f last_alpha{_last_alpha};
+			matrix::Vector3f last_delta_alpha{_last_delta_alpha};
+
+			for (int n = 0; n < N; n++) {
+				const matrix::Vector3f val{x[n] *scale, y[n] *scale, z[n] *scale};
+
+				// trapezoidal integration and coning corrections (see put())
+				const matrix::Vector3f delta_alpha{(val + last_val) *dt * 0.5f};
+				beta += ((last_alpha + last_delta_alpha * (1.f / 6.f)) % delta_alpha) * 0.5f;
+				last_delta_alpha = delta_alpha;
+				last_alpha = alpha;
+				alpha += delta_alpha;
+				last_val = val;
+			}
+
+			_alpha = alpha;
+			_beta = beta;
+			_last_val = last_val;
+			_last_alpha = last_alpha;
+			_last_delta_alpha = last_delta_alpha;
+
+			_integral_dt += N * dt;
+			_integrated_samples++;
+
+		} else {
+			reset();
+			_last_val = matrix::Vector3f{x[N - 1] *scale, y[N - 1] *scale, z[N - 1] *scale};
+		}
+	}
+
 	void reset()
 	{
 		Integrator::reset();
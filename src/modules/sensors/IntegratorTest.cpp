@@ -0,0 +1,149 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the sensor integrators
+ * Run this test only using make tests TESTFILTER=Integrator
+ */
+
+#include <gtest/gtest.h>
+
+#include "Integrator.hpp"
+
+using matrix::Vector3f;
+using sensors::Integrator;
+using sensors::IntegratorConing;
+
+static constexpr int N = 32;
+static constexpr float DT = 125e-6f; // 8 kHz
+static constexpr float SCALE = 1e-3f;
+
+class IntegratorTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		// coning motion: rotating rate vector plus noise-like content
+		for (int n = 0; n < N; n++) {
+			_x[n] = 1000.f * sinf(0.3f * n) + 37 * (n % 5);
+			_y[n] = 1000.f * cosf(0.3f * n) - 23 * (n % 7);
+			_z[n] = 200 + 11 * (n % 3);
+		}
+	}
+
+	int16_t _x[N] {};
+	int16_t _y[N] {};
+	int16_t _z[N] {};
+};
+
+TEST_F(IntegratorTest, batchSameAsSingleSamples)
+{
+	Integrator single;
+	Integrator batch;
+
+	for (int block = 0; block < 2; block++) {
+		for (int n = 0; n < N; n++) {
+			single.put(Vector3f{_x[n] * SCALE, _y[n] * SCALE, _z[n] * SCALE}, DT);
+		}
+
+		batch.put(_x, _y, _z, N, DT, SCALE);
+	}
+
+	EXPECT_NEAR(single.integral_dt(), batch.integral_dt(), 1e-6f);
+
+	Vector3f integral_single;
+	Vector3f integral_batch;
+	uint16_t dt_single = 0;
+	uint16_t dt_batch = 0;
+	ASSERT_TRUE(single.reset(integral_single, dt_single));
+	ASSERT_TRUE(batch.reset(integral_batch, dt_batch));
+
+	EXPECT_EQ(dt_single, dt_batch);
+	EXPECT_NEAR((integral_single - integral_batch).norm(), 0.f, 1e-6f);
+}
+
+TEST_F(IntegratorTest, coningBatchSameAsSingleSamples)
+{
+	IntegratorConing single;
+	IntegratorConing batch;
+
+	for (int block = 0; block < 2; block++) {
+		for (int n = 0; n < N; n++) {
+			single.put(Vector3f{_x[n] * SCALE, _y[n] * SCALE, _z[n] * SCALE}, DT);
+		}
+
+		batch.put(_x, _y, _z, N, DT, SCALE);
+	}
+
+	EXPECT_GT(single.accumulated_coning_corrections().norm(), 0.f);
+	EXPECT_NEAR((single.accumulated_coning_corrections() - batch.accumulated_coning_corrections()).norm(), 0.f, 1e-9f);
+
+	Vector3f integral_single;
+	Vector3f integral_batch;
+	uint16_t dt_single = 0;
+	uint16_t dt_batch = 0;
+	ASSERT_TRUE(single.reset(integral_single, dt_single));
+	ASSERT_TRUE(batch.reset(integral_batch, dt_batch));
+
+	EXPECT_EQ(dt_single, dt_batch);
+	EXPECT_NEAR((integral_single - integral_batch).norm(), 0.f, 1e-6f);
+}
+
+TEST_F(IntegratorTest, batchCountsAsOneSample)
+{
+	IntegratorConing integrator;
+	integrator.set_reset_interval(1'000'000); // 1 s, only the sample count matters
+	integrator.set_reset_samples(2);
+
+	integrator.put(_x, _y, _z, N, DT, SCALE);
+	EXPECT_FALSE(integrator.integral_ready());
+
+	integrator.put(_x, _y, _z, N, DT, SCALE);
+	EXPECT_TRUE(integrator.integral_ready());
+}
+
+TEST_F(IntegratorTest, batchInvalidIntervalResets)
+{
+	IntegratorConing integrator;
+	integrator.put(_x, _y, _z, N, DT, SCALE);
+	EXPECT_GT(integrator.integral_dt(), 0.f);
+
+	// would exceed the maximum integration time
+	integrator.put(_x, _y, _z, N, Integrator::DT_MAX / N, SCALE);
+	EXPECT_FLOAT_EQ(integrator.integral_dt(), 0.f);
+
+	// continues from the last sample of the rejected block
+	integrator.put(_x, _y, _z, N, DT, SCALE);
+	EXPECT_NEAR(integrator.integral_dt(), N * DT, 1e-6f);
+}
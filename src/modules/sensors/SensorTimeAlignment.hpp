@@ -0,0 +1,144 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SensorTimeAlignment.hpp
+ *
+ * Aligns the sample timestamps of a sensor to its own sample clock.
+ *
+ * Drivers timestamp each published burst of samples with the host time of the data ready
+ * interrupt or FIFO read, which includes interrupt and scheduling jitter. Internally the
+ * sensor samples at a fixed (but drifting) period, so the timestamps are modeled as
+ * t[n] = t0 + n * T and tracked with an alpha-beta filter. The returned
+ * timestamps are smooth, follow the actual sensor clock drift and stay locked to the host
+ * time on average.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <mathlib/mathlib.h>
+
+namespace sensors
+{
+
+class SensorTimeAlignment
+{
+public:
+	SensorTimeAlignment() = default;
+	~SensorTimeAlignment() = default;
+
+	// errors larger than this are considered a discontinuity (restart, dropped data) and reset the alignment
+	static constexpr float RESET_ERROR_US{2000.f};
+
+	/**
+	 * Reset to the raw timestamps, eg after a data gap.
+	 * The estimated sample interval is kept.
+	 */
+	void reset()
+	{
+		_timestamp_aligned = 0;
+		_fraction_us = 0.f;
+	}
+
+	/**
+	 * Update with the next raw timestamp.
+	 *
+	 * @param timestamp_sample raw host timestamp of the last sample in the burst
+	 * @param samples number of sensor samples since the previous update
+	 * @return aligned timestamp
+	 */
+	hrt_abstime update(const hrt_abstime &timestamp_sample, int samples)
+	{
+		if ((samples < 1) || (_timestamp_aligned == 0) || (timestamp_sample < _timestamp_raw_last)) {
+			_timestamp_raw_last = timestamp_sample;
+			_timestamp_aligned = timestamp_sample;
+			_fraction_us = 0.f;
+			return timestamp_sample;
+		}
+
+		if (!PX4_ISFINITE(_sample_interval_us)) {
+			// initialize the sample interval from the first raw interval
+			_sample_interval_us = (timestamp_sample - _timestamp_raw_last) / static_cast<float>(samples);
+		}
+
+		_timestamp_raw_last = timestamp_sample;
+
+		// predicted time since the last aligned timestamp and the raw timestamp error
+		const float delta_predicted_us = _fraction_us + samples * _sample_interval_us;
+		const float error_us = static_cast<float>(timestamp_sample - _timestamp_aligned) - delta_predicted_us;
+
+		if (!(fabsf(error_us) < RESET_ERROR_US) || !(_sample_interval_us > 0.f)) {
+			_sample_interval_us = NAN;
+			_update_count = 0;
+			_timestamp_aligned = timestamp_sample;
+			_fraction_us = 0.f;
+			_reset_count++;
+			return timestamp_sample;
+		}
+
+		// phase and period correction, expanding memory gains until converged to the steady state gains
+		const float k = static_cast<float>(math::min(_update_count, static_cast<uint32_t>(1000)) + 2);
+		const float alpha = math::max(ALPHA, 2.f * (2.f * k - 1.f) / (k * (k + 1.f)));
+		const float beta = math::max(BETA, 6.f / (k * (k + 1.f)));
+		_update_count++;
+
+		_sample_interval_us += beta * error_us / samples;
+		const float delta_us = delta_predicted_us + alpha * error_us;
+
+		const float delta_us_integer = floorf(delta_us);
+		_timestamp_aligned += static_cast<hrt_abstime>(delta_us_integer);
+		_fraction_us = delta_us - delta_us_integer;
+
+		return _timestamp_aligned;
+	}
+
+	float sample_interval_us() const { return _sample_interval_us; }
+	uint32_t reset_count() const { return _reset_count; }
+
+private:
+	// steady state gains for the phase (ALPHA) and period (BETA) corrections per update, critically damped
+	static constexpr float ALPHA{0.02f};
+	static constexpr float BETA{ALPHA *ALPHA / 4.f};
+
+	hrt_abstime _timestamp_raw_last{0};
+	hrt_abstime _timestamp_aligned{0};
+	float _fraction_us{0.f};
+
+	float _sample_interval_us{NAN};
+
+	uint32_t _update_count{0};
+	uint32_t _reset_count{0};
+};
+
+} // namespace sensors
@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Test code for the sensor timestamp alignment
+ * Run this test only using make tests TESTFILTER=SensorTimeAlignment
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "SensorTimeAlignment.hpp"
+
+using sensors::SensorTimeAlignment;
+
+static constexpr int SAMPLES = 8;
+static constexpr double SAMPLE_INTERVAL_NOMINAL_US = 125.0; // 8 kHz
+static constexpr double SAMPLE_INTERVAL_US = SAMPLE_INTERVAL_NOMINAL_US * 1.003; // 0.3% slow sensor clock
+
+TEST(SensorTimeAlignmentTest, jitterRemoved)
+{
+	SensorTimeAlignment alignment;
+
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<double> jitter(0.0, 80.0); // interrupt and scheduling latency
+
+	const double t0 = 1e6;
+	double error_max_aligned = 0;
+	double error_max_raw = 0;
+
+	for (int n = 1; n <= 5000; n++) {
+		const double timestamp_true = t0 + n * SAMPLES * SAMPLE_INTERVAL_US;
+		const hrt_abstime timestamp_raw = timestamp_true + jitter(gen);
+
+		const hrt_abstime timestamp_aligned = alignment.update(timestamp_raw, SAMPLES);
+
+		if (n > 500) {
+			error_max_raw = fmax(error_max_raw, fabs(timestamp_raw - timestamp_true - 40.0));
+			error_max_aligned = fmax(error_max_aligned, fabs(timestamp_aligned - timestamp_true - 40.0));
+		}
+	}
+
+	EXPECT_EQ(alignment.reset_count(), 0u);
+	EXPECT_NEAR(alignment.sample_interval_us(), SAMPLE_INTERVAL_US, 0.01);
+
+	// aligned timestamps follow the true sample times (offset by the mean latency)
+	EXPECT_GT(error_max_raw, 35.0);
+	EXPECT_LT(error_max_aligned, 10.0);
+}
+
+TEST(SensorTimeAlignmentTest, monotonic)
+{
+	SensorTimeAlignment alignment;
+
+	std::mt19937 gen(2);
+	std::uniform_real_distribution<double> jitter(0.0, 100.0);
+
+	hrt_abstime timestamp_aligned_last = 0;
+
+	for (int n = 1; n <= 2000; n++) {
+		const hrt_abstime timestamp_raw = 1e6 + n * SAMPLES * SAMPLE_INTERVAL_NOMINAL_US + jitter(gen);
+		const hrt_abstime timestamp_aligned = alignment.update(timestamp_raw, SAMPLES);
+
+		ASSERT_GT(timestamp_aligned, timestamp_aligned_last);
+		timestamp_aligned_last = timestamp_aligned;
+	}
+}
+
+TEST(SensorTimeAlignmentTest, discontinuityResets)
+{
+	SensorTimeAlignment alignment;
+
+	hrt_abstime timestamp = 1e6;
+
+	for (int n = 0; n < 100; n++) {
+		timestamp += SAMPLES * SAMPLE_INTERVAL_NOMINAL_US;
+		alignment.update(timestamp, SAMPLES);
+	}
+
+	// sensor restart, 10 ms without data
+	timestamp += 10000;
+	EXPECT_EQ(alignment.update(timestamp, SAMPLES), timestamp);
+	EXPECT_EQ(alignment.reset_count(), 1u);
+
+	// explicit reset, data gap with the interval kept
+	alignment.reset();
+	timestamp += 3 * SAMPLES * SAMPLE_INTERVAL_NOMINAL_US;
+	EXPECT_EQ(alignment.update(timestamp, SAMPLES), timestamp);
+}
@@ -222,6 +222,24 @@ PARAM_DEFINE_INT32(SENS_EXT_I2C_PRB, 1);
  */
 PARAM_DEFINE_INT32(SENS_IMU_MODE, 1);
 
+/**
+ * Sensors hub IMU fusion
+ *
+ * Instead of the data of the selected IMU, publish the weighted mean of all
+ * healthy IMUs in sensor_combined. Only samples within the same integration
+ * period as the selected IMU are used, weighted with their inverse squared
+ * vibration metric. The voter keeps detecting faults and excludes failed
+ * and clipping sensors.
+ *
+ * Constant differences between the IMUs (residual biases) show up as steps
+ * when an IMU is added to or removed from the mean.
+ *
+ * @boolean
+ * @category system
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_IMU_FUSE, 0);
+
 /**
  * Enable internal barometers
  *
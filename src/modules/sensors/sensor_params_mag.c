@@ -104,6 +104,19 @@ PARAM_DEFINE_INT32(SENS_MAG_AUTOROT, 1);
  */
 PARAM_DEFINE_FLOAT(SENS_MAG_RATE, 15.0f);
 
+/**
+ * Magnetometer batched processing.
+ *
+ * If enabled the magnetometer aggregation only wakes up once per publication
+ * interval (SENS_MAG_RATE) instead of on every sample of the selected sensor,
+ * and processes the queued samples of all instances at once.
+ * The batch size is limited by the sensor_mag queue depth.
+ *
+ * @boolean
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_MAG_BATCH, 0);
+
 /**
  * Sensors hub mag mode
  *
@@ -113,6 +113,15 @@ Sensors::~Sensors()
 
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+
+	if (_vehicle_distance_sensor) {
+		_vehicle_distance_sensor->Stop();
+		delete _vehicle_distance_sensor;
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 
 	if (_vehicle_gps_position) {
@@ -242,6 +251,10 @@ int Sensors::parameters_update()
 	InitializeVehicleAirData();
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+	InitializeVehicleDistanceSensor();
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 	InitializeVehicleGPSPosition();
 #endif // CONFIG_SENSORS_VEHICLE_GPS_POSITION
@@ -432,6 +445,23 @@ void Sensors::InitializeVehicleAirData()
 }
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+void Sensors::InitializeVehicleDistanceSensor()
+{
+	if (_vehicle_distance_sensor == nullptr) {
+		uORB::Subscription distance_sensor_sub{ORB_ID(distance_sensor)};
+
+		if (distance_sensor_sub.advertised()) {
+			_vehicle_distance_sensor = new VehicleDistanceSensor();
+
+			if (_vehicle_distance_sensor) {
+				_vehicle_distance_sensor->Start();
+			}
+		}
+	}
+}
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 void Sensors::InitializeVehicleGPSPosition()
 {
@@ -553,6 +583,16 @@ void Sensors::Run()
 
 #endif // CONFIG_SENSORS_VEHICLE_AIR_DATA
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+		const int n_distance_sensor = orb_group_count(ORB_ID(distance_sensor));
+
+		if (n_distance_sensor != _n_distance_sensor) {
+			_n_distance_sensor = n_distance_sensor;
+			updated = true;
+		}
+
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 		const int n_gps = orb_group_count(ORB_ID(sensor_gps));
 
@@ -732,6 +772,15 @@ int Sensors::print_status()
 	_vehicle_angular_velocity.PrintStatus();
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+
+	if (_vehicle_distance_sensor) {
+		PX4_INFO_RAW("\n");
+		_vehicle_distance_sensor->PrintStatus();
+	}
+
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 
 	if (_vehicle_gps_position) {
@@ -74,6 +74,10 @@
 # include "vehicle_angular_velocity/VehicleAngularVelocity.hpp"
 #endif // CONFIG_SENSORS_VEHICLE_ANGULAR_VELOCITY
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+# include "vehicle_distance_sensor/VehicleDistanceSensor.hpp"
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 # include "vehicle_gps_position/VehicleGPSPosition.hpp"
 #endif // CONFIG_SENSORS_VEHICLE_GPS_POSITION
@@ -124,6 +128,8 @@ private:
 
 	void		InitializeVehicleAirData();
 
+	void		InitializeVehicleDistanceSensor();
+
 	void		InitializeVehicleGPSPosition();
 
 	void		InitializeVehicleIMU();
@@ -241,6 +247,11 @@ private:
 	uint8_t _n_mag{0};
 #endif // CONFIG_SENSORS_VEHICLE_MAGNETOMETER
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+	VehicleDistanceSensor *_vehicle_distance_sensor {nullptr};
+	uint8_t _n_distance_sensor{0};
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
+
 #if defined(CONFIG_SENSORS_VEHICLE_GPS_POSITION)
 	VehicleGPSPosition *_vehicle_gps_position {nullptr};
 	uint8_t _n_gps{0};
@@ -104,6 +104,10 @@ bool VehicleAirData::ParametersUpdate(bool force)
 
 		updateParams();
 
+		if (!_param_sens_baro_batch.get()) {
+			UpdateBatching(1);
+		}
+
 		// update priority
 		for (int instance = 0; instance < MAX_SENSOR_COUNT; instance++) {
 
@@ -131,6 +135,20 @@ bool VehicleAirData::ParametersUpdate(bool force)
 	return false;
 }
 
+void VehicleAirData::UpdateBatching(int samples)
+{
+	// leave headroom in the queue for timing jitter and faster secondary instances
+	const uint8_t batch_samples = math::constrain(samples, 1, sensor_baro_s::ORB_QUEUE_LENGTH - 1);
+
+	if (batch_samples != _batch_samples) {
+		_batch_samples = batch_samples;
+
+		for (auto &sub : _sensor_sub) {
+			sub.set_required_updates(_batch_samples);
+		}
+	}
+}
+
 void VehicleAirData::Run()
 {
 	perf_begin(_cycle_perf);
@@ -285,6 +303,11 @@ void VehicleAirData::Run()
 
 					_last_publication_timestamp[instance] = time_now_us;
 
+					if (_param_sens_baro_batch.get() && (instance == _selected_sensor_sub_index)) {
+						// only wake up once per publication interval, all queued samples of every instance are processed then
+						UpdateBatching(_data_sum_count[instance]);
+					}
+
 					// reset
 					_timestamp_sample_sum[instance] = 0;
 					_data_sum[instance] = 0;
@@ -77,6 +77,7 @@ private:
 	void AirTemperatureUpdate();
 	void CheckFailover(const hrt_abstime &time_now_us);
 	bool ParametersUpdate(bool force = false);
+	void UpdateBatching(int samples);
 	void UpdateStatus();
 
 	static constexpr int MAX_SENSOR_COUNT = 4;
@@ -121,11 +122,14 @@ private:
 
 	int8_t _selected_sensor_sub_index{-1};
 
+	uint8_t _batch_samples{1}; // queued samples required to wake up (SENS_BARO_BATCH)
+
 	float _air_temperature_celsius{20.f}; // initialize with typical 20degC ambient temperature
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::SENS_BARO_QNH>) _param_sens_baro_qnh,
-		(ParamFloat<px4::params::SENS_BARO_RATE>) _param_sens_baro_rate
+		(ParamFloat<px4::params::SENS_BARO_RATE>) _param_sens_baro_rate,
+		(ParamBool<px4::params::SENS_BARO_BATCH>) _param_sens_baro_batch
 	)
 };
 }; // namespace sensors
@@ -53,3 +53,16 @@ PARAM_DEFINE_FLOAT(SENS_BARO_QNH, 1013.25f);
  * @unit Hz
  */
 PARAM_DEFINE_FLOAT(SENS_BARO_RATE, 20.0f);
+
+/**
+ * Baro batched processing.
+ *
+ * If enabled the barometer aggregation only wakes up once per publication
+ * interval (SENS_BARO_RATE) instead of on every sample of the selected sensor,
+ * and processes the queued samples of all instances at once.
+ * The batch size is limited by the sensor_baro queue depth.
+ *
+ * @boolean
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_BARO_BATCH, 0);
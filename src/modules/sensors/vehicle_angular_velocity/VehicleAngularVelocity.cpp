@@ -56,6 +56,7 @@ VehicleAngularVelocity::~VehicleAngularVelocity()
 	perf_free(_cycle_perf);
 	perf_free(_filter_reset_perf);
 	perf_free(_selection_changed_perf);
+	perf_free(_fifo_borrow_overrun_perf);
 
 #if !defined(CONSTRAINED_FLASH)
 	delete[] _dynamic_notch_filter_esc_rpm;
@@ -130,9 +131,11 @@ bool VehicleAngularVelocity::UpdateSampleRate()
 			_filter_sample_rate_hz = sample_rate_hz;
 			_update_sample_rate = false;
 
-			if (_param_imu_gyro_ratemax.get() > 0.f) {
+			const int32_t publish_rate_configured = ConfiguredPublishRate();
+
+			if (publish_rate_configured > 0) {
 				// determine number of sensor samples that will get closest to the desired rate
-				const float configured_interval_us = 1e6f / _param_imu_gyro_ratemax.get();
+				const float configured_interval_us = 1e6f / publish_rate_configured;
 				const float publish_interval_us = 1e6f / publish_rate_hz;
 
 				const uint8_t samples = roundf(configured_interval_us / publish_interval_us);
@@ -159,6 +162,31 @@ bool VehicleAngularVelocity::UpdateSampleRate()
 	return PX4_ISFINITE(_filter_sample_rate_hz) && (_filter_sample_rate_hz > 0);
 }
 
+bool VehicleAngularVelocity::VehicleStatusUpdate()
+{
+	vehicle_status_s vehicle_status;
+
+	if (_vehicle_status_sub.update(&vehicle_status)) {
+		const bool armed = (vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED);
+
+		if (armed != _armed) {
+			_armed = armed;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32_t VehicleAngularVelocity::ConfiguredPublishRate() const
+{
+	if (!_armed && (_param_imu_gyro_rateidl.get() > 0)) {
+		return math::min(_param_imu_gyro_rateidl.get(), _param_imu_gyro_ratemax.get());
+	}
+
+	return _param_imu_gyro_ratemax.get();
+}
+
 void VehicleAngularVelocity::ResetFilters(const hrt_abstime &time_now_us)
 {
 	if ((_filter_sample_rate_hz > 0) && PX4_ISFINITE(_filter_sample_rate_hz)) {
@@ -371,6 +399,7 @@ void VehicleAngularVelocity::ParametersUpdate(bool force)
 
 		const bool nf0_enabled_prev = (_param_imu_gyro_nf0_frq.get() > 0.f) && (_param_imu_gyro_nf0_bw.get() > 0.f);
 		const bool nf1_enabled_prev = (_param_imu_gyro_nf1_frq.get() > 0.f) && (_param_imu_gyro_nf1_bw.get() > 0.f);
+		const int32_t publish_rate_prev = ConfiguredPublishRate();
 
 		updateParams();
 
@@ -396,6 +425,10 @@ void VehicleAngularVelocity::ParametersUpdate(bool force)
 			_param_imu_gyro_ratemax.commit_no_notification();
 		}
 
+		if (ConfiguredPublishRate() != publish_rate_prev) {
+			_update_sample_rate = true;
+		}
+
 		// gyro low pass cutoff frequency changed
 		for (auto &lp : _lp_filter_velocity) {
 			if (fabsf(lp.get_cutoff_freq() - _param_imu_gyro_cutoff.get()) > 0.01f) {
@@ -566,65 +599,85 @@ void VehicleAngularVelocity::DisableDynamicNotchFFT()
 #endif // !CONSTRAINED_FLASH
 }
 
-void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_now_us, bool force)
+void VehicleAngularVelocity::UpdateDynamicNotchEscRpmFrequency(size_t esc, float esc_hz, const hrt_abstime &timestamp,
+		bool force, bool axis_init[3])
 {
 #if !defined(CONSTRAINED_FLASH)
-	const bool enabled = _dynamic_notch_filter_esc_rpm && (_param_imu_gyro_dnf_en.get() & DynamicNotch::EscRpm);
+	const float bandwidth_hz = _param_imu_gyro_dnf_bw.get();
+	const float freq_min = math::max(_param_imu_gyro_dnf_min.get(), bandwidth_hz);
 
-	if (enabled && (_esc_status_sub.updated() || force)) {
+	const bool force_update = force || !_esc_available[esc]; // force parameter update or notch was previously disabled
 
-		bool axis_init[3] {false, false, false};
+	for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
+		// as RPM drops leave the notch filter "parked" at the minimum rather than disabling
+		//  keep harmonics separated by half the notch filter bandwidth
+		const float frequency_hz = math::max(esc_hz * (harmonic + 1), freq_min + (harmonic * 0.5f * bandwidth_hz));
 
-		esc_status_s esc_status;
+		// update filter parameters if frequency changed or forced
+		for (int axis = 0; axis < 3; axis++) {
+			auto &nf = _dynamic_notch_filter_esc_rpm[harmonic][axis][esc];
 
-		if (_esc_status_sub.copy(&esc_status) && (time_now_us < esc_status.timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
+			const float notch_freq_delta = fabsf(nf.getNotchFreq() - frequency_hz);
 
-			const float bandwidth_hz = _param_imu_gyro_dnf_bw.get();
-			const float freq_min = math::max(_param_imu_gyro_dnf_min.get(), bandwidth_hz);
+			const bool notch_freq_changed = (notch_freq_delta > 0.1f);
 
-			for (size_t esc = 0; esc < math::min(esc_status.esc_count, (uint8_t)MAX_NUM_ESCS); esc++) {
-				const esc_report_s &esc_report = esc_status.esc[esc];
+			// only allow initializing one new filter per axis each iteration
+			const bool allow_update = !axis_init[axis] || (nf.initialized() && notch_freq_delta < nf.getBandwidth());
 
-				const bool esc_connected = (esc_status.esc_online_flags & (1 << esc)) || (esc_report.esc_rpm != 0);
+			if ((force_update || notch_freq_changed) && allow_update) {
+				if (nf.setParameters(_filter_sample_rate_hz, frequency_hz, bandwidth_hz)) {
+					perf_count(_dynamic_notch_filter_esc_rpm_update_perf);
 
-				// only update if ESC RPM range seems valid
-				if (esc_connected && (time_now_us < esc_report.timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
+					if (!nf.initialized()) {
+						perf_count(_dynamic_notch_filter_esc_rpm_init_perf);
+						axis_init[axis] = true;
+					}
+				}
+			}
+		}
+	}
 
-					const float esc_hz = abs(esc_report.esc_rpm) / 60.f;
+	_esc_available.set(esc, true);
+	_last_esc_rpm_notch_update[esc] = timestamp;
+#endif // !CONSTRAINED_FLASH
+}
 
-					const bool force_update = force || !_esc_available[esc]; // force parameter update or notch was previously disabled
+void VehicleAngularVelocity::UpdateDynamicNotchEscRpm(const hrt_abstime &time_now_us, bool force)
+{
+#if !defined(CONSTRAINED_FLASH)
+	const bool enabled = _dynamic_notch_filter_esc_rpm && (_param_imu_gyro_dnf_en.get() & DynamicNotch::EscRpm);
 
-					for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-						// as RPM drops leave the notch filter "parked" at the minimum rather than disabling
-						//  keep harmonics separated by half the notch filter bandwidth
-						const float frequency_hz = math::max(esc_hz * (harmonic + 1), freq_min + (harmonic * 0.5f * bandwidth_hz));
+	// the high rate esc_rpm (bidirectional DShot) takes precedence over esc_status while it's available
+	const bool esc_rpm_recent = (_last_esc_rpm_timestamp != 0)
+				    && (time_now_us < _last_esc_rpm_timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT);
 
-						// update filter parameters if frequency changed or forced
-						for (int axis = 0; axis < 3; axis++) {
-							auto &nf = _dynamic_notch_filter_esc_rpm[harmonic][axis][esc];
+	if (enabled && (_esc_rpm_sub.updated() || (!esc_rpm_recent && _esc_status_sub.updated()) || force)) {
 
-							const float notch_freq_delta = fabsf(nf.getNotchFreq() - frequency_hz);
+		bool axis_init[3] {false, false, false};
 
-							const bool notch_freq_changed = (notch_freq_delta > 0.1f);
+		esc_rpm_s esc_rpm;
+		esc_status_s esc_status;
 
-							// only allow initializing one new filter per axis each iteration
-							const bool allow_update = !axis_init[axis] || (nf.initialized() && notch_freq_delta < nf.getBandwidth());
+		if (_esc_rpm_sub.copy(&esc_rpm) && (time_now_us < esc_rpm.timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
 
-							if ((force_update || notch_freq_changed) && allow_update) {
-								if (nf.setParameters(_filter_sample_rate_hz, frequency_hz, bandwidth_hz)) {
-									perf_count(_dynamic_notch_filter_esc_rpm_update_perf);
+			_last_esc_rpm_timestamp = esc_rpm.timestamp;
 
-									if (!nf.initialized()) {
-										perf_count(_dynamic_notch_filter_esc_rpm_init_perf);
-										axis_init[axis] = true;
-									}
-								}
-							}
-						}
-					}
+			for (size_t esc = 0; esc < math::min(esc_rpm.esc_count, (uint8_t)MAX_NUM_ESCS); esc++) {
+				if (esc_rpm.esc_online_flags & (1 << esc)) {
+					UpdateDynamicNotchEscRpmFrequency(esc, fabsf(esc_rpm.rpm[esc]) / 60.f, esc_rpm.timestamp, force, axis_init);
+				}
+			}
 
-					_esc_available.set(esc, true);
-					_last_esc_rpm_notch_update[esc] = esc_report.timestamp;
+		} else if (_esc_status_sub.copy(&esc_status) && (time_now_us < esc_status.timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
+
+			for (size_t esc = 0; esc < math::min(esc_status.esc_count, (uint8_t)MAX_NUM_ESCS); esc++) {
+				const esc_report_s &esc_report = esc_status.esc[esc];
+
+				const bool esc_connected = (esc_status.esc_online_flags & (1 << esc)) || (esc_report.esc_rpm != 0);
+
+				// only update if ESC RPM range seems valid
+				if (esc_connected && (time_now_us < esc_report.timestamp + DYNAMIC_NOTCH_FITLER_TIMEOUT)) {
+					UpdateDynamicNotchEscRpmFrequency(esc, abs(esc_report.esc_rpm) / 60.f, esc_report.timestamp, force, axis_init);
 				}
 			}
 		}
@@ -722,8 +775,9 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+Vector3f VehicleAngularVelocity::FilterAngularVelocity(float *const data[3], int N)
 {
+	// all three axes are filtered together by each filter of the chain (applyArray3)
 #if !defined(CONSTRAINED_FLASH)
 
 	// Apply dynamic notch filter from ESC RPM
@@ -731,9 +785,13 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 		for (int esc = 0; esc < MAX_NUM_ESCS; esc++) {
 			if (_esc_available[esc]) {
 				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
-					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
-					}
+					math::NotchFilter<float> *const nf[3] {
+						&_dynamic_notch_filter_esc_rpm[harmonic][0][esc],
+						&_dynamic_notch_filter_esc_rpm[harmonic][1][esc],
+						&_dynamic_notch_filter_esc_rpm[harmonic][2][esc]
+					};
+
+					math::NotchFilter<float>::applyArray3(nf, data, N);
 				}
 			}
 		}
@@ -742,42 +800,60 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 	// Apply dynamic notch filter from FFT
 	if (_dynamic_notch_fft_available) {
 		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
-			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
-			}
+			math::NotchFilter<float> *const nf[3] {
+				&_dynamic_notch_filter_fft[0][peak],
+				&_dynamic_notch_filter_fft[1][peak],
+				&_dynamic_notch_filter_fft[2][peak]
+			};
+
+			math::NotchFilter<float>::applyArray3(nf, data, N);
 		}
 	}
 
 #endif // !CONSTRAINED_FLASH
 
 	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
-	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
-	}
+	math::NotchFilter<float> *const nf0[3] {
+		&_notch_filter0_velocity[0],
+		&_notch_filter0_velocity[1],
+		&_notch_filter0_velocity[2]
+	};
+	math::NotchFilter<float>::applyArray3(nf0, data, N);
 
 	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
-	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
-	}
+	math::NotchFilter<float> *const nf1[3] {
+		&_notch_filter1_velocity[0],
+		&_notch_filter1_velocity[1],
+		&_notch_filter1_velocity[2]
+	};
+	math::NotchFilter<float>::applyArray3(nf1, data, N);
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	math::LowPassFilter2p<float> *const lp[3] {&_lp_filter_velocity[0], &_lp_filter_velocity[1], &_lp_filter_velocity[2]};
+	math::LowPassFilter2p<float>::applyArray3(lp, data, N);
 
 	// return last filtered sample
-	return data[N - 1];
+	return Vector3f{data[0][N - 1], data[1][N - 1], data[2][N - 1]};
 }
 
 float VehicleAngularVelocity::FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N)
 {
 	// angular acceleration: Differentiate & apply specific angular acceleration (D-term) low-pass (IMU_DGYRO_CUTOFF)
 	float angular_acceleration_filtered = 0.f;
+	float angular_acceleration_sum = 0.f;
 
 	for (int n = 0; n < N; n++) {
 		const float angular_acceleration = (data[n] - _angular_velocity_raw_prev(axis)) * inverse_dt_s;
 		angular_acceleration_filtered = _lp_filter_acceleration[axis].update(angular_acceleration);
+		angular_acceleration_sum += angular_acceleration_filtered;
 		_angular_velocity_raw_prev(axis) = data[n];
 	}
 
+	if (_param_imu_dgyro_batch.get() && (N > 1)) {
+		// mean over the FIFO batch (IMU_DGYRO_BATCH)
+		return angular_acceleration_sum / N;
+	}
+
 	return angular_acceleration_filtered;
 }
 
@@ -795,6 +871,11 @@ void VehicleAngularVelocity::Run()
 	// update corrections first to set _selected_sensor
 	const bool selection_updated = SensorSelectionUpdate(time_now_us);
 
+	// arming state changes the publication rate when IMU_GYRO_RATEIDL is set
+	if (VehicleStatusUpdate() && (_param_imu_gyro_rateidl.get() > 0)) {
+		_update_sample_rate = true;
+	}
+
 	if (selection_updated || _update_sample_rate) {
 		if (!UpdateSampleRate()) {
 			// sensor sample rate required to run
@@ -824,36 +905,53 @@ void VehicleAngularVelocity::Run()
 		// process all outstanding fifo messages
 		int sensor_sub_updates = 0;
 		sensor_gyro_fifo_s sensor_fifo_data;
+		const sensor_gyro_fifo_s *fifo;
+
+		// borrow the FIFO messages in place where possible instead of copying them
+		while ((sensor_sub_updates < sensor_gyro_fifo_s::ORB_QUEUE_LENGTH)
+		       && (fifo = _sensor_gyro_fifo_sub.borrow_or_update(&sensor_fifo_data))) {
 
-		while ((sensor_sub_updates < sensor_gyro_fifo_s::ORB_QUEUE_LENGTH) && _sensor_gyro_fifo_sub.update(&sensor_fifo_data)) {
 			sensor_sub_updates++;
 
-			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
-			const int N = sensor_fifo_data.samples;
+			const float inverse_dt_s = 1e6f / fifo->dt;
+			const int N = fifo->samples;
 			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
 
-			if ((sensor_fifo_data.dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
+			if ((fifo->dt > 0) && (N > 0) && (N <= FIFO_SIZE_MAX)) {
 				Vector3f angular_velocity_uncalibrated;
 				Vector3f angular_acceleration_uncalibrated;
 
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
+				const int16_t *raw_data_array[] {fifo->x, fifo->y, fifo->z};
+				const float scale = fifo->scale;
+				const hrt_abstime timestamp_sample = fifo->timestamp_sample;
 
-				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
-					float data[FIFO_SIZE_MAX];
+				// copy raw int16 sensor samples to float arrays for filtering
+				float data[3][FIFO_SIZE_MAX];
 
+				for (int axis = 0; axis < 3; axis++) {
 					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
+						data[axis][n] = scale * raw_data_array[axis][n];
 					}
+				}
 
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
+				if (!_sensor_gyro_fifo_sub.borrow_valid(fifo, &sensor_fifo_data)) {
+					// overwritten by the publisher while converting, drop it
+					perf_count(_fifo_borrow_overrun_perf);
+					continue;
+				}
+
+				float *const data_axis[3] {data[0], data[1], data[2]};
+
+				// save last filtered sample
+				angular_velocity_uncalibrated = FilterAngularVelocity(data_axis, N);
+
+				for (int axis = 0; axis < 3; axis++) {
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis], N);
 				}
 
 				// Publish
 				if (!_sensor_gyro_fifo_sub.updated()) {
-					if (CalibrateAndPublish(sensor_fifo_data.timestamp_sample,
+					if (CalibrateAndPublish(timestamp_sample,
 								angular_velocity_uncalibrated,
 								angular_acceleration_uncalibrated)) {
 
@@ -885,15 +983,15 @@ void VehicleAngularVelocity::Run()
 				Vector3f angular_velocity_uncalibrated;
 				Vector3f angular_acceleration_uncalibrated;
 
-				float raw_data_array[] {sensor_data.x, sensor_data.y, sensor_data.z};
+				// copy sensor sample to float arrays for filtering
+				float data[3][1] {{sensor_data.x}, {sensor_data.y}, {sensor_data.z}};
+				float *const data_axis[3] {data[0], data[1], data[2]};
 
-				for (int axis = 0; axis < 3; axis++) {
-					// copy sensor sample to float array for filtering
-					float data[1] {raw_data_array[axis]};
+				// save last filtered sample
+				angular_velocity_uncalibrated = FilterAngularVelocity(data_axis);
 
-					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data);
-					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data);
+				for (int axis = 0; axis < 3; axis++) {
+					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data[axis]);
 				}
 
 				// Publish
@@ -961,6 +1059,7 @@ void VehicleAngularVelocity::PrintStatus()
 	perf_print_counter(_cycle_perf);
 	perf_print_counter(_filter_reset_perf);
 	perf_print_counter(_selection_changed_perf);
+	perf_print_counter(_fifo_borrow_overrun_perf);
 #if !defined(CONSTRAINED_FLASH)
 	perf_print_counter(_dynamic_notch_filter_esc_rpm_disable_perf);
 	perf_print_counter(_dynamic_notch_filter_esc_rpm_init_perf);
@@ -47,6 +47,7 @@
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/esc_rpm.h>
 #include <uORB/topics/esc_status.h>
 #include <uORB/topics/estimator_selector_status.h>
 #include <uORB/topics/estimator_sensor_bias.h>
@@ -56,6 +57,7 @@
 #include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_status.h>
 
 using namespace time_literals;
 
@@ -78,7 +80,7 @@ private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
+	inline matrix::Vector3f FilterAngularVelocity(float *const data[3], int N = 1);
 	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
 
 	void DisableDynamicNotchEscRpm();
@@ -89,9 +91,16 @@ private:
 	void SensorBiasUpdate(bool force = false);
 	bool SensorSelectionUpdate(const hrt_abstime &time_now_us, bool force = false);
 	void UpdateDynamicNotchEscRpm(const hrt_abstime &time_now_us, bool force = false);
+	void UpdateDynamicNotchEscRpmFrequency(size_t esc, float esc_hz, const hrt_abstime &timestamp, bool force,
+					       bool axis_init[3]);
 	void UpdateDynamicNotchFFT(const hrt_abstime &time_now_us, bool force = false);
 	bool UpdateSampleRate();
 
+	bool VehicleStatusUpdate();
+
+	// desired publication rate, lowered while disarmed if IMU_GYRO_RATEIDL is set
+	int32_t ConfiguredPublishRate() const;
+
 	// scaled appropriately for current sensor
 	matrix::Vector3f GetResetAngularVelocity() const;
 	matrix::Vector3f GetResetAngularAcceleration() const;
@@ -102,7 +111,9 @@ private:
 
 	uORB::Subscription _estimator_selector_status_sub{ORB_ID(estimator_selector_status)};
 	uORB::Subscription _estimator_sensor_bias_sub{ORB_ID(estimator_sensor_bias)};
+	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 #if !defined(CONSTRAINED_FLASH)
+	uORB::Subscription _esc_rpm_sub {ORB_ID(esc_rpm)};
 	uORB::Subscription _esc_status_sub {ORB_ID(esc_status)};
 	uORB::Subscription _sensor_gyro_fft_sub {ORB_ID(sensor_gyro_fft)};
 #endif // !CONSTRAINED_FLASH
@@ -151,6 +162,7 @@ private:
 	int _esc_rpm_harmonics{0};
 	px4::Bitset<MAX_NUM_ESCS> _esc_available{};
 	hrt_abstime _last_esc_rpm_notch_update[MAX_NUM_ESCS] {};
+	hrt_abstime _last_esc_rpm_timestamp{0}; ///< last esc_rpm, preferred over esc_status while recent
 
 	perf_counter_t _dynamic_notch_filter_esc_rpm_disable_perf{nullptr};
 	perf_counter_t _dynamic_notch_filter_esc_rpm_init_perf{nullptr};
@@ -176,10 +188,12 @@ private:
 	bool _reset_filters{true};
 	bool _fifo_available{false};
 	bool _update_sample_rate{true};
+	bool _armed{false};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": gyro filter")};
 	perf_counter_t _filter_reset_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro filter reset")};
 	perf_counter_t _selection_changed_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro selection changed")};
+	perf_counter_t _fifo_borrow_overrun_perf{perf_alloc(PC_COUNT, MODULE_NAME": gyro FIFO borrow overrun")};
 
 	DEFINE_PARAMETERS(
 #if !defined(CONSTRAINED_FLASH)
@@ -194,7 +208,9 @@ private:
 		(ParamFloat<px4::params::IMU_GYRO_NF1_FRQ>) _param_imu_gyro_nf1_frq,
 		(ParamFloat<px4::params::IMU_GYRO_NF1_BW>) _param_imu_gyro_nf1_bw,
 		(ParamInt<px4::params::IMU_GYRO_RATEMAX>) _param_imu_gyro_ratemax,
-		(ParamFloat<px4::params::IMU_DGYRO_CUTOFF>) _param_imu_dgyro_cutoff
+		(ParamInt<px4::params::IMU_GYRO_RATEIDL>) _param_imu_gyro_rateidl,
+		(ParamFloat<px4::params::IMU_DGYRO_CUTOFF>) _param_imu_dgyro_cutoff,
+		(ParamBool<px4::params::IMU_DGYRO_BATCH>) _param_imu_dgyro_batch
 	)
 };
 
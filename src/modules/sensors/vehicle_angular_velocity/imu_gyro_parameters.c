@@ -139,6 +139,29 @@ PARAM_DEFINE_FLOAT(IMU_GYRO_CUTOFF, 40.0f);
 */
 PARAM_DEFINE_INT32(IMU_GYRO_RATEMAX, 400);
 
+/**
+* Gyro control data publication rate while disarmed
+*
+* If enabled the gyro control data (vehicle_angular_velocity) publication rate is lowered
+* to this rate while the vehicle is disarmed, and restored to IMU_GYRO_RATEMAX on arming.
+* This reduces the CPU load of the sensor pipeline and rate controllers during long idle periods on ground.
+*
+* Note: sensor data is still read and filtered at the full raw rate, so the filter state is
+* valid immediately after arming.
+*
+* Set to 0 to disable.
+*
+* @min 0
+* @max 400
+* @value 0 Disabled
+* @value 100 100 Hz
+* @value 250 250 Hz
+* @value 400 400 Hz
+* @unit Hz
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_RATEIDL, 0);
+
 /**
 * Cutoff frequency for angular acceleration (D-Term filter)
 *
@@ -204,3 +227,16 @@ PARAM_DEFINE_INT32(IMU_GYRO_DNF_HMC, 3);
 * @unit Hz
 */
 PARAM_DEFINE_FLOAT(IMU_GYRO_DNF_MIN, 25.f);
+
+/**
+* Average the angular acceleration over the gyro FIFO batch
+*
+* With FIFO gyros, the angular acceleration (D-term) is differentiated and filtered
+* at the full sensor rate. If enabled, the published value is the mean over all samples
+* of a batch instead of only the last one. This improves the D-term signal to noise ratio
+* without increasing the publication rate, at the cost of half a batch of delay.
+*
+* @boolean
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_DGYRO_BATCH, 0);
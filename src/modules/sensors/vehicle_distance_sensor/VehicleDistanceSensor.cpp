@@ -0,0 +1,192 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "VehicleDistanceSensor.hpp"
+
+#include <lib/mathlib/mathlib.h>
+
+namespace sensors
+{
+
+VehicleDistanceSensor::VehicleDistanceSensor() :
+	ModuleParams(nullptr),
+	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
+{
+}
+
+VehicleDistanceSensor::~VehicleDistanceSensor()
+{
+	Stop();
+	perf_free(_cycle_perf);
+}
+
+bool VehicleDistanceSensor::Start()
+{
+	// force initial updates
+	ParametersUpdate(true);
+
+	for (auto &sub : _distance_sensor_subs) {
+		sub.registerCallback();
+	}
+
+	ScheduleNow();
+	return true;
+}
+
+void VehicleDistanceSensor::Stop()
+{
+	Deinit();
+
+	// clear all registered callbacks
+	for (auto &sub : _distance_sensor_subs) {
+		sub.unregisterCallback();
+	}
+}
+
+void VehicleDistanceSensor::ParametersUpdate(bool force)
+{
+	// Check if parameters have changed
+	if (_parameter_update_sub.updated() || force) {
+		// clear update
+		parameter_update_s param_update;
+		_parameter_update_sub.copy(&param_update);
+
+		updateParams();
+	}
+}
+
+void VehicleDistanceSensor::Run()
+{
+	perf_begin(_cycle_perf);
+
+	ParametersUpdate();
+
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		distance_sensor_s distance_sensor;
+
+		while (_distance_sensor_subs[i].update(&distance_sensor)) {
+			validate(_state[i], distance_sensor);
+
+			distance_sensor.timestamp = hrt_absolute_time();
+			_vehicle_distance_sensor_pubs[i].publish(distance_sensor);
+		}
+	}
+
+	perf_end(_cycle_perf);
+}
+
+bool VehicleDistanceSensor::validate(SensorState &state, distance_sensor_s &distance_sensor)
+{
+	if (distance_sensor.device_id != state.device_id) {
+		// new or replaced sensor, start over
+		state = SensorState{};
+		state.device_id = distance_sensor.device_id;
+	}
+
+	const float distance = distance_sensor.current_distance;
+	bool accepted = false;
+
+	if (!PX4_ISFINITE(distance)
+	    || (distance < distance_sensor.min_distance)
+	    || (distance > distance_sensor.max_distance)
+	    || (distance_sensor.signal_quality == 0)) {
+
+		state.rejected_range++;
+
+	} else {
+		// outliers are part of the median window as well, so that a real step is accepted
+		// once it is in the majority of the samples
+		state.median.insert(distance);
+
+		if (state.median_samples < MEDIAN_WINDOW) {
+			state.median_samples++;
+			accepted = true;
+
+		} else {
+			const float median = state.median.median();
+			const float deviation = distance - median;
+			const float gate = math::max(_param_sens_dist_ogate.get(), _param_sens_dist_orel.get() * median);
+
+			accepted = fabsf(deviation) <= gate;
+
+			if (accepted) {
+				state.variance += 0.1f * (deviation * deviation - state.variance);
+
+			} else {
+				state.rejected_outlier++;
+			}
+		}
+	}
+
+	state.accepted_history = (state.accepted_history << 1) | (accepted ? 1 : 0);
+
+	if (!accepted) {
+		distance_sensor.signal_quality = 0;
+		return false;
+	}
+
+	state.accepted++;
+
+	if (distance_sensor.signal_quality < 0) {
+		// unknown quality: fraction of the recent samples that were accepted
+		const int history_length = math::min((int)(state.accepted + state.rejected_range + state.rejected_outlier), 16);
+		const int quality = (math::countSetBits(state.accepted_history) * 100) / history_length;
+		distance_sensor.signal_quality = math::constrain(quality, 1, 100);
+	}
+
+	if ((distance_sensor.variance <= 0.f) && (state.variance > 0.f)) {
+		// unknown variance: measured spread around the median
+		distance_sensor.variance = state.variance;
+	}
+
+	return true;
+}
+
+void VehicleDistanceSensor::PrintStatus()
+{
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		const SensorState &state = _state[i];
+
+		if (state.device_id != 0) {
+			PX4_INFO_RAW("[vehicle_distance_sensor] %d: device id %" PRIu32 ", accepted: %" PRIu32 ", out of range: %" PRIu32
+				     ", outliers: %" PRIu32 ", std dev: %.3f m\n",
+				     i, state.device_id, state.accepted, state.rejected_range, state.rejected_outlier,
+				     (double)sqrtf(state.variance));
+		}
+	}
+
+	perf_print_counter(_cycle_perf);
+}
+
+}; // namespace sensors
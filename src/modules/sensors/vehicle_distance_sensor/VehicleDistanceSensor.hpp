@@ -0,0 +1,127 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <lib/mathlib/math/filter/MedianFilter.hpp>
+#include <lib/perf/perf_counter.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module_params.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/distance_sensor.h>
+#include <uORB/topics/parameter_update.h>
+
+using namespace time_literals;
+
+namespace sensors
+{
+
+/**
+ * Validates every distance_sensor instance once and publishes the result as
+ * vehicle_distance_sensor (same instance order):
+ *  - readings outside of the sensor range are invalid
+ *  - readings that deviate from the median of the last samples by more than
+ *    SENS_DIST_OGATE or SENS_DIST_OREL are rejected as outliers
+ * Invalid readings are published with signal_quality 0. An unknown quality
+ * is replaced by the recent acceptance ratio and an unknown variance by the
+ * measured spread around the median.
+ */
+class VehicleDistanceSensor : public ModuleParams, public px4::ScheduledWorkItem
+{
+public:
+	VehicleDistanceSensor();
+	~VehicleDistanceSensor() override;
+
+	bool Start();
+	void Stop();
+
+	void PrintStatus();
+
+private:
+	void Run() override;
+
+	void ParametersUpdate(bool force = false);
+
+	static constexpr int MAX_SENSOR_COUNT = 4;
+	static constexpr int MEDIAN_WINDOW = 5;
+
+	struct SensorState {
+		math::MedianFilter<float, MEDIAN_WINDOW> median{};
+		uint8_t median_samples{0};
+
+		float variance{0.f};		///< low pass filtered squared deviation from the median [m^2]
+		uint16_t accepted_history{0};	///< one bit per recent sample, set if accepted
+
+		uint32_t device_id{0};
+		uint32_t accepted{0};
+		uint32_t rejected_range{0};
+		uint32_t rejected_outlier{0};
+	};
+
+	/**
+	 * @return true if the reading is accepted, false if it was marked invalid
+	 */
+	bool validate(SensorState &state, distance_sensor_s &distance_sensor);
+
+	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
+
+	uORB::SubscriptionCallbackWorkItem _distance_sensor_subs[MAX_SENSOR_COUNT] {
+		{this, ORB_ID(distance_sensor), 0},
+		{this, ORB_ID(distance_sensor), 1},
+		{this, ORB_ID(distance_sensor), 2},
+		{this, ORB_ID(distance_sensor), 3},
+	};
+
+	uORB::PublicationMulti<distance_sensor_s> _vehicle_distance_sensor_pubs[MAX_SENSOR_COUNT] {
+		{ORB_ID(vehicle_distance_sensor)},
+		{ORB_ID(vehicle_distance_sensor)},
+		{ORB_ID(vehicle_distance_sensor)},
+		{ORB_ID(vehicle_distance_sensor)},
+	};
+
+	SensorState _state[MAX_SENSOR_COUNT] {};
+
+	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": distance sensor cycle")};
+
+	DEFINE_PARAMETERS(
+		(ParamFloat<px4::params::SENS_DIST_OGATE>) _param_sens_dist_ogate,
+		(ParamFloat<px4::params::SENS_DIST_OREL>) _param_sens_dist_orel
+	)
+};
+
+}; // namespace sensors
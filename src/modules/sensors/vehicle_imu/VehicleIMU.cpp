@@ -286,15 +286,25 @@ bool VehicleIMU::UpdateAccel()
 	sensor_accel_s accel;
 
 	if (_sensor_accel_sub.update(&accel)) {
-		if (_sensor_accel_sub.get_last_generation() != _accel_last_generation + 1) {
+		const bool generation_gap = (_sensor_accel_sub.get_last_generation() != _accel_last_generation + 1);
+
+		if (generation_gap) {
+			_accel_time_alignment.reset();
+		}
+
+		// host timestamp of the last sample, optionally aligned to the sensor sample clock
+		const hrt_abstime timestamp_sample = _param_imu_time_align.get() ?
+						     _accel_time_alignment.update(accel.timestamp_sample, accel.samples) : accel.timestamp_sample;
+
+		if (generation_gap) {
 			_data_gap = true;
 			perf_count(_accel_generation_gap_perf);
 
 		} else {
 			// collect sample interval average for filters
-			if (accel.timestamp_sample > _accel_timestamp_sample_last) {
+			if (timestamp_sample > _accel_timestamp_sample_last) {
 				if (_accel_timestamp_sample_last != 0) {
-					const float interval_us = accel.timestamp_sample - _accel_timestamp_sample_last;
+					const float interval_us = timestamp_sample - _accel_timestamp_sample_last;
 
 					_accel_mean_interval_us.update(interval_us);
 					_accel_fifo_mean_interval_us.update(interval_us / math::max(accel.samples, (uint8_t)1));
@@ -348,12 +358,16 @@ bool VehicleIMU::UpdateAccel()
 		}
 
 
-		const float dt = (accel.timestamp_sample - _accel_timestamp_sample_last) * 1e-6f;
-		_accel_timestamp_sample_last = accel.timestamp_sample;
+		const float dt = (timestamp_sample - _accel_timestamp_sample_last) * 1e-6f;
+		_accel_timestamp_sample_last = timestamp_sample;
 
 		const Vector3f accel_raw{accel.x, accel.y, accel.z};
 		_raw_accel_mean.update(accel_raw);
-		_accel_integrator.put(accel_raw, dt);
+
+		// integrate the raw FIFO samples as a block if available (after a gap the full interval is needed)
+		if (_data_gap || !IntegrateFIFO(_sensor_accel_fifo_sub, accel, _accel_integrator)) {
+			_accel_integrator.put(accel_raw, dt);
+		}
 
 		updated = true;
 
@@ -415,16 +429,26 @@ bool VehicleIMU::UpdateGyro()
 	sensor_gyro_s gyro;
 
 	if (_sensor_gyro_sub.update(&gyro)) {
-		if (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1) {
+		const bool generation_gap = (_sensor_gyro_sub.get_last_generation() != _gyro_last_generation + 1);
+
+		if (generation_gap) {
+			_gyro_time_alignment.reset();
+		}
+
+		// host timestamp of the last sample, optionally aligned to the sensor sample clock
+		const hrt_abstime timestamp_sample = _param_imu_time_align.get() ?
+						     _gyro_time_alignment.update(gyro.timestamp_sample, gyro.samples) : gyro.timestamp_sample;
+
+		if (generation_gap) {
 			_data_gap = true;
 			perf_count(_gyro_generation_gap_perf);
 
 		} else {
 			// collect sample interval average for filters
-			if (gyro.timestamp_sample > _gyro_timestamp_sample_last) {
+			if (timestamp_sample > _gyro_timestamp_sample_last) {
 				if (_gyro_timestamp_sample_last != 0) {
 
-					const float interval_us = gyro.timestamp_sample - _gyro_timestamp_sample_last;
+					const float interval_us = timestamp_sample - _gyro_timestamp_sample_last;
 
 					_gyro_mean_interval_us.update(interval_us);
 					_gyro_fifo_mean_interval_us.update(interval_us / math::max(gyro.samples, (uint8_t)1));
@@ -456,9 +480,9 @@ bool VehicleIMU::UpdateGyro()
 
 		_gyro_last_generation = _sensor_gyro_sub.get_last_generation();
 
-		const float dt = (gyro.timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
+		const float dt = (timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
 
-		_gyro_timestamp_sample_last = gyro.timestamp_sample;
+		_gyro_timestamp_sample_last = timestamp_sample;
 		_gyro_timestamp_last = gyro.timestamp;
 
 		_gyro_calibration.set_device_id(gyro.device_id);
@@ -482,7 +506,11 @@ bool VehicleIMU::UpdateGyro()
 
 		const Vector3f gyro_raw{gyro.x, gyro.y, gyro.z};
 		_raw_gyro_mean.update(gyro_raw);
-		_gyro_integrator.put(gyro_raw, dt);
+
+		// integrate the raw FIFO samples as a block if available (after a gap the full interval is needed)
+		if (_data_gap || !IntegrateFIFO(_sensor_gyro_fifo_sub, gyro, _gyro_integrator)) {
+			_gyro_integrator.put(gyro_raw, dt);
+		}
 
 		updated = true;
 
@@ -34,6 +34,7 @@
 #pragma once
 
 #include <Integrator.hpp>
+#include <SensorTimeAlignment.hpp>
 
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/mathlib/math/WelfordMean.hpp>
@@ -53,7 +54,9 @@
 #include <uORB/topics/estimator_sensor_bias.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/sensor_accel.h>
+#include <uORB/topics/sensor_accel_fifo.h>
 #include <uORB/topics/sensor_gyro.h>
+#include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/vehicle_control_mode.h>
 #include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/vehicle_imu_status.h>
@@ -86,6 +89,69 @@ private:
 
 	void UpdateIntegratorConfiguration();
 
+	template<typename T>
+	struct FIFOSubscription {
+		explicit FIFOSubscription(ORB_ID id) : sub{id} {}
+
+		uORB::Subscription sub;
+		T fifo{};
+		uint32_t device_id{0};
+		bool pending{false};
+	};
+
+	/**
+	 * Integrate the raw samples of the FIFO message belonging to report (published right before it)
+	 * as a block, instead of the (averaged) report.
+	 *
+	 * @return true if integrated, false if the report needs to be integrated instead
+	 */
+	template<typename T, typename Report, typename IntegratorT>
+	bool IntegrateFIFO(FIFOSubscription<T> &fifo_sub, const Report &report, IntegratorT &integrator)
+	{
+		if (fifo_sub.device_id != report.device_id) {
+			// find the FIFO instance of this sensor, if any
+			fifo_sub.device_id = report.device_id;
+			fifo_sub.pending = false;
+			fifo_sub.sub.unsubscribe();
+
+			for (uint8_t i = 0; i < ORB_MULTI_MAX_INSTANCES; i++) {
+				uORB::Subscription sub{fifo_sub.sub.orb_id(), i};
+
+				if (sub.copy(&fifo_sub.fifo) && (fifo_sub.fifo.device_id == report.device_id)) {
+					fifo_sub.sub.ChangeInstance(i);
+					fifo_sub.sub.subscribe();
+					break;
+				}
+			}
+		}
+
+		if (!fifo_sub.sub.valid()) {
+			return false;
+		}
+
+		static constexpr int FIFO_SIZE_MAX = sizeof(fifo_sub.fifo.x) / sizeof(fifo_sub.fifo.x[0]);
+
+		while (fifo_sub.pending || fifo_sub.sub.update(&fifo_sub.fifo)) {
+			fifo_sub.pending = false;
+
+			if (fifo_sub.fifo.timestamp_sample > report.timestamp_sample) {
+				// belongs to a later report
+				fifo_sub.pending = true;
+				return false;
+			}
+
+			if ((fifo_sub.fifo.timestamp_sample == report.timestamp_sample) && (fifo_sub.fifo.samples == report.samples)
+			    && (fifo_sub.fifo.samples > 0) && (fifo_sub.fifo.samples <= FIFO_SIZE_MAX) && (fifo_sub.fifo.dt > 0.f)) {
+
+				integrator.put(fifo_sub.fifo.x, fifo_sub.fifo.y, fifo_sub.fifo.z, fifo_sub.fifo.samples,
+					       fifo_sub.fifo.dt * 1e-6f, fifo_sub.fifo.scale);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	inline void UpdateAccelVibrationMetrics(const matrix::Vector3f &acceleration);
 	inline void UpdateGyroVibrationMetrics(const matrix::Vector3f &angular_velocity);
 
@@ -109,6 +175,9 @@ private:
 	uORB::Subscription _sensor_accel_sub;
 	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub;
 
+	FIFOSubscription<sensor_accel_fifo_s> _sensor_accel_fifo_sub{ORB_ID::sensor_accel_fifo};
+	FIFOSubscription<sensor_gyro_fifo_s> _sensor_gyro_fifo_sub{ORB_ID::sensor_gyro_fifo};
+
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 
 	calibration::Accelerometer _accel_calibration{};
@@ -121,6 +190,9 @@ private:
 
 	hrt_abstime _accel_timestamp_sample_last{0};
 	hrt_abstime _gyro_timestamp_sample_last{0};
+
+	SensorTimeAlignment _accel_time_alignment{};
+	SensorTimeAlignment _gyro_time_alignment{};
 	hrt_abstime _gyro_timestamp_last{0};
 
 	math::WelfordMeanVector<float, 3> _raw_accel_mean{};
@@ -201,7 +273,8 @@ private:
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::IMU_INTEG_RATE>) _param_imu_integ_rate,
 		(ParamBool<px4::params::SENS_IMU_AUTOCAL>) _param_sens_imu_autocal,
-		(ParamBool<px4::params::SENS_IMU_CLPNOTI>) _param_sens_imu_notify_clipping
+		(ParamBool<px4::params::SENS_IMU_CLPNOTI>) _param_sens_imu_notify_clipping,
+		(ParamBool<px4::params::IMU_TIME_ALIGN>) _param_imu_time_align
 	)
 };
 
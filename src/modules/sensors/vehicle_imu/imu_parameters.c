@@ -49,6 +49,19 @@
 */
 PARAM_DEFINE_INT32(IMU_INTEG_RATE, 200);
 
+/**
+ * IMU timestamp alignment
+ *
+ * Align the accel and gyro sample timestamps to the sensor sample clock. The raw
+ * timestamps include interrupt and scheduling latency, the aligned timestamps are
+ * estimated from the sensor sample count and track the sensor clock drift.
+ * This reduces the integration interval jitter of vehicle_imu.
+ *
+ * @boolean
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(IMU_TIME_ALIGN, 0);
+
 /**
  * IMU auto calibration
  *
@@ -104,6 +104,10 @@ bool VehicleMagnetometer::ParametersUpdate(bool force)
 
 		updateParams();
 
+		if (!_param_sens_mag_batch.get()) {
+			UpdateBatching(1);
+		}
+
 		// Legacy QGC support: CAL_MAG_SIDES required to display the correct UI
 		// Force it to be a copy of the new SENS_MAG_SIDES
 		if (_param_cal_mag_sides.get() != _param_sens_mag_sides.get()) {
@@ -415,6 +419,20 @@ void VehicleMagnetometer::UpdatePowerCompensation()
 	}
 }
 
+void VehicleMagnetometer::UpdateBatching(int samples)
+{
+	// leave headroom in the queue for timing jitter and faster secondary instances
+	const uint8_t batch_samples = math::constrain(samples, 1, sensor_mag_s::ORB_QUEUE_LENGTH - 1);
+
+	if (batch_samples != _batch_samples) {
+		_batch_samples = batch_samples;
+
+		for (auto &sub : _sensor_sub) {
+			sub.set_required_updates(_batch_samples);
+		}
+	}
+}
+
 void VehicleMagnetometer::Run()
 {
 	perf_begin(_cycle_perf);
@@ -461,12 +479,18 @@ void VehicleMagnetometer::Run()
 		}
 
 		if (_advertised[uorb_index]) {
+			// drain the queue first, then calibrate all samples of this instance together
+			static constexpr int QUEUE_LENGTH = sensor_mag_s::ORB_QUEUE_LENGTH;
+			sensor_mag_s reports[QUEUE_LENGTH];
+			float data[3][QUEUE_LENGTH];
 			int sensor_mag_updates = 0;
-			sensor_mag_s report;
+			int count = 0;
 
-			while ((sensor_mag_updates < sensor_mag_s::ORB_QUEUE_LENGTH) && _sensor_sub[uorb_index].update(&report)) {
+			while ((sensor_mag_updates < QUEUE_LENGTH) && _sensor_sub[uorb_index].update(&reports[count])) {
 				sensor_mag_updates++;
 
+				const sensor_mag_s &report = reports[count];
+
 				if (_calibration[uorb_index].device_id() != report.device_id) {
 					_calibration[uorb_index].set_device_id(report.device_id);
 					_priority[uorb_index] = _calibration[uorb_index].priority();
@@ -489,19 +513,29 @@ void VehicleMagnetometer::Run()
 						ParametersUpdate(true);
 					}
 
-					const Vector3f vect{_calibration[uorb_index].Correct(Vector3f{report.x, report.y, report.z}) - _calibration_estimator_bias[uorb_index]};
+					data[0][count] = report.x;
+					data[1][count] = report.y;
+					data[2][count] = report.z;
+					count++;
+				}
+			}
 
-					float mag_array[3] {vect(0), vect(1), vect(2)};
-					_voter.put(uorb_index, report.timestamp, mag_array, report.error_count, _priority[uorb_index]);
+			_calibration[uorb_index].Correct(data, count);
 
-					_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
-					_data_sum[uorb_index] += vect;
-					_data_sum_count[uorb_index]++;
+			for (int i = 0; i < count; i++) {
+				const sensor_mag_s &report = reports[i];
+				const Vector3f vect{Vector3f{data[0][i], data[1][i], data[2][i]} - _calibration_estimator_bias[uorb_index]};
 
-					_last_data[uorb_index] = vect;
+				float mag_array[3] {vect(0), vect(1), vect(2)};
+				_voter.put(uorb_index, report.timestamp, mag_array, report.error_count, _priority[uorb_index]);
 
-					updated[uorb_index] = true;
-				}
+				_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
+				_data_sum[uorb_index] += vect;
+				_data_sum_count[uorb_index]++;
+
+				_last_data[uorb_index] = vect;
+
+				updated[uorb_index] = true;
 			}
 		}
 	}
@@ -582,6 +616,11 @@ void VehicleMagnetometer::Run()
 
 					_last_publication_timestamp[instance] = timestamp_sample;
 
+					if (_param_sens_mag_batch.get() && (instance == _selected_sensor_sub_index)) {
+						// only wake up once per publication interval, all queued samples of every instance are processed then
+						UpdateBatching(_data_sum_count[instance]);
+					}
+
 					// reset
 					_timestamp_sample_sum[instance] = 0;
 					_data_sum[instance].zero();
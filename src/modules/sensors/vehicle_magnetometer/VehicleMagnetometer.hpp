@@ -82,6 +82,7 @@ private:
 
 	void CheckFailover(const hrt_abstime &time_now_us);
 	bool ParametersUpdate(bool force = false);
+	void UpdateBatching(int samples);
 	void UpdateStatus();
 
 	void Publish(uint8_t instance, bool multi = false);
@@ -173,12 +174,15 @@ private:
 
 	int8_t _selected_sensor_sub_index{-1};
 
+	uint8_t _batch_samples{1}; // queued samples required to wake up (SENS_MAG_BATCH)
+
 	bool _armed{false};
 
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::CAL_MAG_COMP_TYP>) _param_mag_comp_typ,
 		(ParamBool<px4::params::SENS_MAG_MODE>) _param_sens_mag_mode,
 		(ParamFloat<px4::params::SENS_MAG_RATE>) _param_sens_mag_rate,
+		(ParamBool<px4::params::SENS_MAG_BATCH>) _param_sens_mag_batch,
 		(ParamBool<px4::params::SENS_MAG_AUTOCAL>) _param_sens_mag_autocal,
 		(ParamInt<px4::params::CAL_MAG_SIDES>) _param_cal_mag_sides,
 		(ParamInt<px4::params::SENS_MAG_SIDES>) _param_sens_mag_sides
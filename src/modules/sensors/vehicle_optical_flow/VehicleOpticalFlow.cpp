@@ -43,13 +43,14 @@ using namespace time_literals;
 
 static constexpr uint32_t SENSOR_TIMEOUT{300_ms};
 
+// how long a flow sample waits for the IMU data covering its integration window
+static constexpr uint32_t IMU_WAIT_TIMEOUT{20_ms};
+
 VehicleOpticalFlow::VehicleOpticalFlow() :
 	ModuleParams(nullptr),
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
 {
 	_vehicle_optical_flow_pub.advertise();
-
-	_gyro_integrator.set_reset_samples(1);
 }
 
 VehicleOpticalFlow::~VehicleOpticalFlow()
@@ -62,8 +63,7 @@ bool VehicleOpticalFlow::Start()
 {
 	_sensor_flow_sub.registerCallback();
 
-	_sensor_gyro_sub.registerCallback();
-	_sensor_gyro_sub.set_required_updates(sensor_gyro_s::ORB_QUEUE_LENGTH / 2);
+	_vehicle_imu_sub.registerCallback();
 
 	_sensor_selection_sub.registerCallback();
 
@@ -77,7 +77,7 @@ void VehicleOpticalFlow::Stop()
 
 	// clear all registered callbacks
 	_sensor_flow_sub.unregisterCallback();
-	_sensor_gyro_sub.unregisterCallback();
+	_vehicle_imu_sub.unregisterCallback();
 	_sensor_selection_sub.unregisterCallback();
 }
 
@@ -104,12 +104,27 @@ void VehicleOpticalFlow::Run()
 	UpdateDistanceSensor();
 
 	if (!_delta_angle_available) {
-		UpdateSensorGyro();
+		UpdateVehicleImu();
+	}
+
+	if (!_flow_pending && _sensor_flow_sub.update(&_sensor_optical_flow)) {
+		_flow_pending = true;
+	}
+
+	if (_flow_pending && !_delta_angle_available
+	    && (_delta_angle_window.newest_timestamp() < _sensor_optical_flow.timestamp_sample)
+	    && (hrt_elapsed_time(&_sensor_optical_flow.timestamp_sample) < IMU_WAIT_TIMEOUT)) {
+
+		// wait for the vehicle_imu sample covering the end of the flow integration window
+		ScheduleDelayed(10_ms);
+		perf_end(_cycle_perf);
+		return;
 	}
 
-	sensor_optical_flow_s sensor_optical_flow;
+	if (_flow_pending) {
+		_flow_pending = false;
 
-	if (_sensor_flow_sub.update(&sensor_optical_flow)) {
+		const sensor_optical_flow_s &sensor_optical_flow = _sensor_optical_flow;
 
 		// clear data accumulation if there's a gap in data
 		const uint64_t integration_gap_threshold_us = sensor_optical_flow.integration_timespan_us * 2;
@@ -122,10 +137,9 @@ void VehicleOpticalFlow::Run()
 
 
 		const hrt_abstime timestamp_oldest = sensor_optical_flow.timestamp_sample - sensor_optical_flow.integration_timespan_us;
-		const hrt_abstime timestamp_newest = sensor_optical_flow.timestamp;
 
 		// delta angle
-		//  - from sensor_optical_flow if available, otherwise use synchronized sensor_gyro if available
+		//  - from sensor_optical_flow if available, otherwise integrate vehicle_imu over the flow integration window
 		if (sensor_optical_flow.delta_angle_available && Vector2f(sensor_optical_flow.delta_angle).isAllFinite()) {
 			// passthrough integrated gyro if available
 			Vector3f delta_angle(sensor_optical_flow.delta_angle);
@@ -145,30 +159,14 @@ void VehicleOpticalFlow::Run()
 		} else {
 			_delta_angle_available = false;
 
-			// integrate synchronized gyro
-			gyroSample gyro_sample;
+			Vector3f delta_angle;
 
-			while (_gyro_buffer.pop_oldest(timestamp_oldest, timestamp_newest, &gyro_sample)) {
-
-				_gyro_integrator.put(gyro_sample.data, gyro_sample.dt);
-
-				float min_interval_s = (sensor_optical_flow.integration_timespan_us * 1e-6f) * 0.99f;
-
-				if (_gyro_integrator.integral_dt() > min_interval_s) {
-					//PX4_INFO("integral dt: %.6f, min interval: %.6f", (double)_gyro_integrator.integral_dt(),(double) min_interval_s);
-					break;
-				}
-			}
-
-			Vector3f delta_angle{NAN, NAN, NAN};
-			uint16_t delta_angle_dt;
-
-			if (_gyro_integrator.reset(delta_angle, delta_angle_dt)) {
+			if (_delta_angle_window.integrate(timestamp_oldest, sensor_optical_flow.timestamp_sample, delta_angle)) {
 				_delta_angle += delta_angle;
 
 			} else {
-				// force integrator reset
-				_gyro_integrator.reset();
+				// not covered by the IMU history, let the consumer fall back to its own gyro
+				_delta_angle.setAll(NAN);
 			}
 		}
 
@@ -381,7 +379,8 @@ void VehicleOpticalFlow::UpdateDistanceSensor()
 		if (distance_sensor.orientation == distance_sensor_s::ROTATION_DOWNWARD_FACING) {
 
 			if ((distance_sensor.current_distance >= distance_sensor.min_distance)
-			    && (distance_sensor.current_distance <= distance_sensor.max_distance)) {
+			    && (distance_sensor.current_distance <= distance_sensor.max_distance)
+			    && (distance_sensor.signal_quality != 0)) {
 
 				rangeSample sample;
 				sample.time_us = distance_sensor.timestamp;
@@ -404,66 +403,40 @@ void VehicleOpticalFlow::UpdateDistanceSensor()
 	}
 }
 
-void VehicleOpticalFlow::UpdateSensorGyro()
+void VehicleOpticalFlow::UpdateVehicleImu()
 {
 	if (_sensor_selection_sub.updated()) {
 		sensor_selection_s sensor_selection{};
 		_sensor_selection_sub.copy(&sensor_selection);
 
 		for (uint8_t i = 0; i < MAX_SENSOR_COUNT; i++) {
-			uORB::SubscriptionData<sensor_gyro_s> sensor_gyro_sub{ORB_ID(sensor_gyro), i};
+			uORB::SubscriptionData<vehicle_imu_s> vehicle_imu_sub{ORB_ID(vehicle_imu), i};
 
-			if (sensor_gyro_sub.advertised()
-			    && (sensor_gyro_sub.get().timestamp != 0)
-			    && (sensor_gyro_sub.get().device_id != 0)
-			    && (hrt_elapsed_time(&sensor_gyro_sub.get().timestamp) < 1_s)) {
+			if (vehicle_imu_sub.advertised()
+			    && (vehicle_imu_sub.get().timestamp != 0)
+			    && (vehicle_imu_sub.get().gyro_device_id != 0)
+			    && (hrt_elapsed_time(&vehicle_imu_sub.get().timestamp) < 1_s)) {
 
-				if (sensor_gyro_sub.get().device_id == sensor_selection.gyro_device_id) {
-					if (_sensor_gyro_sub.ChangeInstance(i) && _sensor_gyro_sub.registerCallback()) {
+				if (vehicle_imu_sub.get().gyro_device_id == sensor_selection.gyro_device_id) {
+					if (_vehicle_imu_sub.ChangeInstance(i) && _vehicle_imu_sub.registerCallback()) {
 
-						_gyro_calibration.set_device_id(sensor_gyro_sub.get().device_id);
-						PX4_DEBUG("selecting sensor_gyro:%" PRIu8 " %" PRIu32, i, sensor_gyro_sub.get().device_id);
+						_delta_angle_window.reset();
+						PX4_DEBUG("selecting vehicle_imu:%" PRIu8 " %" PRIu32, i, vehicle_imu_sub.get().gyro_device_id);
 						break;
 
 					} else {
-						PX4_ERR("unable to register callback for sensor_gyro:%" PRIu8 " %" PRIu32, i, sensor_gyro_sub.get().device_id);
+						PX4_ERR("unable to register callback for vehicle_imu:%" PRIu8 " %" PRIu32, i, vehicle_imu_sub.get().gyro_device_id);
 					}
 				}
 			}
 		}
 	}
 
-	// buffer
-	bool sensor_gyro_lost_printed = false;
-	int gyro_updates = 0;
-
-	while (_sensor_gyro_sub.updated() && (gyro_updates < sensor_gyro_s::ORB_QUEUE_LENGTH)) {
-		gyro_updates++;
-		const unsigned last_generation = _sensor_gyro_sub.get_last_generation();
-		sensor_gyro_s sensor_gyro;
-
-		if (_sensor_gyro_sub.copy(&sensor_gyro)) {
-
-			if (_sensor_gyro_sub.get_last_generation() != last_generation + 1) {
-				if (!sensor_gyro_lost_printed) {
-					PX4_ERR("sensor_gyro lost, generation %u -> %u", last_generation, _sensor_gyro_sub.get_last_generation());
-					sensor_gyro_lost_printed = true;
-				}
-			}
-
-			_gyro_calibration.set_device_id(sensor_gyro.device_id);
-			_gyro_calibration.SensorCorrectionsUpdate();
-
-			const float dt_s = (sensor_gyro.timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
-			_gyro_timestamp_sample_last = sensor_gyro.timestamp_sample;
+	// vehicle_imu delta angles are already calibrated and coning corrected
+	vehicle_imu_s vehicle_imu;
 
-			gyroSample gyro_sample;
-			gyro_sample.time_us = sensor_gyro.timestamp_sample;
-			gyro_sample.data = _gyro_calibration.Correct(Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z});
-			gyro_sample.dt = dt_s;
-
-			_gyro_buffer.push(gyro_sample);
-		}
+	if (_vehicle_imu_sub.update(&vehicle_imu)) {
+		_delta_angle_window.put(vehicle_imu.timestamp_sample, Vector3f{vehicle_imu.delta_angle}, vehicle_imu.delta_angle_dt);
 	}
 }
 
@@ -480,8 +453,6 @@ void VehicleOpticalFlow::ClearAccumulatedData()
 
 	_quality_sum = 0;
 	_accumulated_count = 0;
-
-	_gyro_integrator.reset();
 }
 
 void VehicleOpticalFlow::PrintStatus()
@@ -36,12 +36,12 @@
 #include "data_validator/DataValidatorGroup.hpp"
 #include "RingBuffer.hpp"
 
-#include <Integrator.hpp>
+#include <DeltaAngleWindow.hpp>
 
+#include <lib/conversion/rotation.h>
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/matrix/matrix/math.hpp>
 #include <lib/perf/perf_counter.h>
-#include <lib/sensor_calibration/Gyroscope.hpp>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_config.h>
@@ -52,10 +52,10 @@
 #include <uORB/SubscriptionMultiArray.hpp>
 #include <uORB/topics/distance_sensor.h>
 #include <uORB/topics/parameter_update.h>
-#include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_optical_flow.h>
 #include <uORB/topics/sensor_selection.h>
 #include <uORB/topics/vehicle_attitude.h>
+#include <uORB/topics/vehicle_imu.h>
 #include <uORB/topics/vehicle_optical_flow.h>
 #include <uORB/topics/vehicle_optical_flow_vel.h>
 
@@ -76,33 +76,38 @@ public:
 private:
 	void ClearAccumulatedData();
 	void UpdateDistanceSensor();
-	void UpdateSensorGyro();
+	void UpdateVehicleImu();
 
 	void Run() override;
 
 	void ParametersUpdate();
 	void SensorCorrectionsUpdate(bool force = false);
 
-	static constexpr int MAX_SENSOR_COUNT = 3;
+	static constexpr int MAX_SENSOR_COUNT = 4;
 
 	uORB::Publication<vehicle_optical_flow_s> _vehicle_optical_flow_pub{ORB_ID(vehicle_optical_flow)};
 	uORB::Publication<vehicle_optical_flow_vel_s> _vehicle_optical_flow_vel_pub{ORB_ID(vehicle_optical_flow_vel)};
 
 	uORB::Subscription _params_sub{ORB_ID(parameter_update)};
 
+#if defined(CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR)
+	// range checked and outlier filtered by VehicleDistanceSensor
+	uORB::SubscriptionMultiArray<distance_sensor_s> _distance_sensor_subs{ORB_ID::vehicle_distance_sensor};
+#else
 	uORB::SubscriptionMultiArray<distance_sensor_s> _distance_sensor_subs{ORB_ID::distance_sensor};
+#endif // CONFIG_SENSORS_VEHICLE_DISTANCE_SENSOR
 
 	uORB::Subscription _vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
 
 	uORB::SubscriptionCallbackWorkItem _sensor_flow_sub{this, ORB_ID(sensor_optical_flow)};
-	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub{this, ORB_ID(sensor_gyro)};
+	uORB::SubscriptionCallbackWorkItem _vehicle_imu_sub{this, ORB_ID(vehicle_imu)};
 	uORB::SubscriptionCallbackWorkItem _sensor_selection_sub{this, ORB_ID(sensor_selection)};
 
-	sensors::IntegratorConing _gyro_integrator{};
+	// about 200 ms of vehicle_imu delta angles
+	sensors::DeltaAngleWindow<50> _delta_angle_window{};
 
-	hrt_abstime _gyro_timestamp_sample_last{0};
-
-	calibration::Gyroscope _gyro_calibration{};
+	sensor_optical_flow_s _sensor_optical_flow{};
+	bool _flow_pending{false};
 
 	perf_counter_t _cycle_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 
@@ -122,18 +127,11 @@ private:
 
 	bool _delta_angle_available{false};
 
-	struct gyroSample {
-		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
-		matrix::Vector3f data{};
-		float dt{0.f};
-	};
-
 	struct rangeSample {
 		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
 		float data{};
 	};
 
-	RingBuffer<gyroSample, 32> _gyro_buffer{};
 	RingBuffer<rangeSample, 5> _range_buffer{};
 
 	DEFINE_PARAMETERS(
@@ -178,6 +178,9 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 
 			_last_accel_timestamp[uorb_index] = imu_report.timestamp_sample;
 
+			_accel_vibration_metric[uorb_index] = imu_status.accel_vibration_metric;
+			_gyro_vibration_metric[uorb_index] = imu_status.gyro_vibration_metric;
+
 			_accel.voter.put(uorb_index, imu_report.timestamp, _last_sensor_data[uorb_index].accelerometer_m_s2,
 					 imu_status.accel_error_count, _accel.priority[uorb_index]);
 
@@ -239,6 +242,10 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 		raw.gyro_clipping             = _last_sensor_data[gyro_best_index].gyro_clipping;
 		raw.gyro_calibration_count    = _last_sensor_data[gyro_best_index].gyro_calibration_count;
 
+		if (_param_sens_imu_fuse.get()) {
+			imuFuse(raw, accel_best_index, gyro_best_index);
+		}
+
 		if ((accel_best_index != _accel.last_best_vote) || (_selection.accel_device_id != _accel_device_id[accel_best_index])) {
 			_accel.last_best_vote = (uint8_t)accel_best_index;
 			_selection.accel_device_id = _accel_device_id[accel_best_index];
@@ -285,6 +292,63 @@ void VotedSensorsUpdate::imuPoll(struct sensor_combined_s &raw)
 	}
 }
 
+void VotedSensorsUpdate::imuFuse(sensor_combined_s &raw, int accel_best_index, int gyro_best_index)
+{
+	// lower bound of the vibration metrics to keep the weights bounded
+	static constexpr float ACCEL_VIBRATION_MIN = 0.01f; // m/s/s
+	static constexpr float GYRO_VIBRATION_MIN = 0.001f; // rad/s
+
+	Vector3f accel_sum{};
+	Vector3f gyro_sum{};
+	float accel_weight_sum = 0.f;
+	float gyro_weight_sum = 0.f;
+
+	_accel_fused_count = 0;
+	_gyro_fused_count = 0;
+
+	for (int i = 0; i < MAX_SENSOR_COUNT; i++) {
+		const sensor_combined_s &data = _last_sensor_data[i];
+
+		// time alignment: only use samples of the same integration period as the selected IMU
+		const int64_t accel_dt = (int64_t)data.timestamp - (int64_t)_last_sensor_data[accel_best_index].timestamp;
+		const int64_t gyro_dt = (int64_t)data.timestamp - (int64_t)_last_sensor_data[gyro_best_index].timestamp;
+
+		// the voter remains the fault detection, only fuse healthy sensors (and always the selected one)
+		if ((_accel_device_id[i] != 0) && (_accel.priority[i] > 0) && (data.accelerometer_clipping == 0)
+		    && ((i == accel_best_index) || ((_accel.voter.get_sensor_state(i) == DataValidator::ERROR_FLAG_NO_ERROR)
+				&& (fabsf((float)accel_dt) <= (float)raw.accelerometer_integral_dt)))) {
+
+			const float vibration = math::max(_accel_vibration_metric[i], ACCEL_VIBRATION_MIN);
+			const float weight = 1.f / (vibration * vibration);
+
+			accel_sum += Vector3f{data.accelerometer_m_s2} * weight;
+			accel_weight_sum += weight;
+			_accel_fused_count++;
+		}
+
+		if ((_gyro_device_id[i] != 0) && (_gyro.priority[i] > 0) && (data.gyro_clipping == 0)
+		    && ((i == gyro_best_index) || ((_gyro.voter.get_sensor_state(i) == DataValidator::ERROR_FLAG_NO_ERROR)
+				&& (fabsf((float)gyro_dt) <= (float)raw.gyro_integral_dt)))) {
+
+			const float vibration = math::max(_gyro_vibration_metric[i], GYRO_VIBRATION_MIN);
+			const float weight = 1.f / (vibration * vibration);
+
+			gyro_sum += Vector3f{data.gyro_rad} * weight;
+			gyro_weight_sum += weight;
+			_gyro_fused_count++;
+		}
+	}
+
+	// keep the data of the selected sensor if all are clipping
+	if (accel_weight_sum > 0.f) {
+		(accel_sum / accel_weight_sum).copyTo(raw.accelerometer_m_s2);
+	}
+
+	if (gyro_weight_sum > 0.f) {
+		(gyro_sum / gyro_weight_sum).copyTo(raw.gyro_rad);
+	}
+}
+
 bool VotedSensorsUpdate::checkFailover(SensorData &sensor, const char *sensor_name,
 				       events::px4::enums::sensor_type_t sensor_type)
 {
@@ -394,6 +458,11 @@ void VotedSensorsUpdate::printStatus()
 	PX4_INFO_RAW("\n");
 	PX4_INFO_RAW("selected accel: %" PRIu32 " (%" PRIu8 ")\n", _selection.accel_device_id, _accel.last_best_vote);
 	_accel.voter.print();
+
+	if (_param_sens_imu_fuse.get()) {
+		PX4_INFO_RAW("\n");
+		PX4_INFO_RAW("fused accels: %" PRIu8 ", fused gyros: %" PRIu8 "\n", _accel_fused_count, _gyro_fused_count);
+	}
 }
 
 void VotedSensorsUpdate::sensorsPoll(sensor_combined_s &raw)
@@ -130,6 +130,12 @@ private:
 	 */
 	void imuPoll(sensor_combined_s &raw);
 
+	/**
+	 * Replace the data of the selected IMU in raw by the weighted mean of all healthy IMUs sampled
+	 * within the same integration period. The weights are the inverse squared vibration metrics.
+	 */
+	void imuFuse(sensor_combined_s &raw, int accel_best_index, int gyro_best_index);
+
 	/**
 	 * Check & handle failover of a sensor
 	 * @return true if a switch occured (could be for a non-critical reason)
@@ -174,12 +180,19 @@ private:
 
 	uint64_t _last_accel_timestamp[MAX_SENSOR_COUNT] {};	/**< latest full timestamp */
 
+	float _accel_vibration_metric[MAX_SENSOR_COUNT] {};	/**< latest accel vibration metric (m/s/s) */
+	float _gyro_vibration_metric[MAX_SENSOR_COUNT] {};	/**< latest gyro vibration metric (rad/s) */
+
+	uint8_t _accel_fused_count{0};			/**< number of accels fused in the last sample */
+	uint8_t _gyro_fused_count{0};			/**< number of gyros fused in the last sample */
+
 	sensor_selection_s _selection {};		/**< struct containing the sensor selection to be published to the uORB */
 
 	bool _parameter_update{false};
 
 	DEFINE_PARAMETERS(
-		(ParamBool<px4::params::SENS_IMU_MODE>) _param_sens_imu_mode
+		(ParamBool<px4::params::SENS_IMU_MODE>) _param_sens_imu_mode,
+		(ParamBool<px4::params::SENS_IMU_FUSE>) _param_sens_imu_fuse
 	)
 };
 
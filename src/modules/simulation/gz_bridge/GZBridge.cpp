@@ -44,13 +44,14 @@
 #include <string>
 
 GZBridge::GZBridge(const char *world, const char *name, const char *model,
-		   const char *pose_str) :
+		   const char *pose_str, bool shared_memory) :
 	ModuleParams(nullptr),
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::rate_ctrl),
 	_world_name(world),
 	_model_name(name),
 	_model_sim(model),
-	_model_pose(pose_str)
+	_model_pose(pose_str),
+	_use_shared_memory(shared_memory)
 {
 	pthread_mutex_init(&_node_mutex, nullptr);
 
@@ -59,6 +60,11 @@ GZBridge::GZBridge(const char *world, const char *name, const char *model,
 
 GZBridge::~GZBridge()
 {
+	if (_shared_memory_thread_running) {
+		_shared_memory_thread_should_exit.store(true);
+		pthread_join(_shared_memory_thread, nullptr);
+	}
+
 	// TODO: unsubscribe
 
 	for (auto &sub_topic : _node.SubscribedTopics()) {
@@ -178,12 +184,29 @@ int GZBridge::init()
 		}
 	}
 
-	// clock
-	std::string clock_topic = "/world/" + _world_name + "/clock";
+	if (_use_shared_memory) {
+		// clock, IMU and ESC outputs through shared memory, everything else stays on gz-transport
+		if (!_shared_memory.open(_model_name)) {
+			return PX4_ERROR;
+		}
+
+		_mixing_interface_esc._shared_memory = _shared_memory.segment();
 
-	if (!_node.Subscribe(clock_topic, &GZBridge::clockCallback, this)) {
-		PX4_ERR("failed to subscribe to %s", clock_topic.c_str());
-		return PX4_ERROR;
+		if (pthread_create(&_shared_memory_thread, nullptr, &GZBridge::sharedMemoryThread, this) != 0) {
+			PX4_ERR("failed to start shared memory thread");
+			return PX4_ERROR;
+		}
+
+		_shared_memory_thread_running = true;
+
+	} else {
+		// clock
+		std::string clock_topic = "/world/" + _world_name + "/clock";
+
+		if (!_node.Subscribe(clock_topic, &GZBridge::clockCallback, this)) {
+			PX4_ERR("failed to subscribe to %s", clock_topic.c_str());
+			return PX4_ERROR;
+		}
 	}
 
 	// pose: /world/$WORLD/pose/info
@@ -197,7 +220,7 @@ int GZBridge::init()
 	// IMU: /world/$WORLD/model/$MODEL/link/base_link/sensor/imu_sensor/imu
 	std::string imu_topic = "/world/" + _world_name + "/model/" + _model_name + "/link/base_link/sensor/imu_sensor/imu";
 
-	if (!_node.Subscribe(imu_topic, &GZBridge::imuCallback, this)) {
+	if (!_use_shared_memory && !_node.Subscribe(imu_topic, &GZBridge::imuCallback, this)) {
 		PX4_ERR("failed to subscribe to %s", imu_topic.c_str());
 		return PX4_ERROR;
 	}
@@ -279,6 +302,7 @@ int GZBridge::task_spawn(int argc, char *argv[])
 	const char *model_pose = nullptr;
 	const char *model_sim = nullptr;
 	const char *px4_instance = nullptr;
+	bool shared_memory = false;
 	std::string model_name_std;
 
 
@@ -287,7 +311,7 @@ int GZBridge::task_spawn(int argc, char *argv[])
 	int ch;
 	const char *myoptarg = nullptr;
 
-	while ((ch = px4_getopt(argc, argv, "w:m:p:i:n:", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "w:m:p:i:n:s", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 		case 'w':
 			// world
@@ -314,6 +338,10 @@ int GZBridge::task_spawn(int argc, char *argv[])
 			px4_instance = myoptarg;
 			break;
 
+		case 's':
+			shared_memory = true;
+			break;
+
 		case '?':
 			error_flag = true;
 			break;
@@ -349,7 +377,7 @@ int GZBridge::task_spawn(int argc, char *argv[])
 
 	PX4_INFO("world: %s, model name: %s, simulation model: %s", world_name, model_name, model_sim);
 
-	GZBridge *instance = new GZBridge(world_name, model_name, model_sim, model_pose);
+	GZBridge *instance = new GZBridge(world_name, model_name, model_sim, model_pose, shared_memory);
 
 	if (instance) {
 		_object.store(instance);
@@ -488,13 +516,19 @@ void GZBridge::imuCallback(const gz::msgs::IMU &imu)
 		updateClock(imu.header().stamp().sec(), imu.header().stamp().nsec());
 	}
 
+	publishImu(time_us,
+		   gz::math::Vector3d(imu.linear_acceleration().x(), imu.linear_acceleration().y(), imu.linear_acceleration().z()),
+		   gz::math::Vector3d(imu.angular_velocity().x(), imu.angular_velocity().y(), imu.angular_velocity().z()));
+
+	pthread_mutex_unlock(&_node_mutex);
+}
+
+void GZBridge::publishImu(uint64_t time_us, const gz::math::Vector3d &accel_flu, const gz::math::Vector3d &gyro_flu)
+{
 	// FLU -> FRD
 	static const auto q_FLU_to_FRD = gz::math::Quaterniond(0, 1, 0, 0);
 
-	gz::math::Vector3d accel_b = q_FLU_to_FRD.RotateVector(gz::math::Vector3d(
-					     imu.linear_acceleration().x(),
-					     imu.linear_acceleration().y(),
-					     imu.linear_acceleration().z()));
+	gz::math::Vector3d accel_b = q_FLU_to_FRD.RotateVector(accel_flu);
 
 	// publish accel
 	sensor_accel_s sensor_accel{};
@@ -514,10 +548,7 @@ void GZBridge::imuCallback(const gz::msgs::IMU &imu)
 	_sensor_accel_pub.publish(sensor_accel);
 
 
-	gz::math::Vector3d gyro_b = q_FLU_to_FRD.RotateVector(gz::math::Vector3d(
-					    imu.angular_velocity().x(),
-					    imu.angular_velocity().y(),
-					    imu.angular_velocity().z()));
+	gz::math::Vector3d gyro_b = q_FLU_to_FRD.RotateVector(gyro_flu);
 
 	// publish gyro
 	sensor_gyro_s sensor_gyro{};
@@ -535,8 +566,53 @@ void GZBridge::imuCallback(const gz::msgs::IMU &imu)
 	sensor_gyro.temperature = NAN;
 	sensor_gyro.samples = 1;
 	_sensor_gyro_pub.publish(sensor_gyro);
+}
 
-	pthread_mutex_unlock(&_node_mutex);
+void *GZBridge::sharedMemoryThread(void *arg)
+{
+	static_cast<GZBridge *>(arg)->sharedMemoryLoop();
+	return nullptr;
+}
+
+void GZBridge::sharedMemoryLoop()
+{
+	gz_shm::Segment *segment = _shared_memory.segment();
+
+	while (!_shared_memory_thread_should_exit.load()) {
+		bool idle = true;
+
+		pthread_mutex_lock(&_node_mutex);
+
+		const uint64_t clock_us = segment->clock_us.load(std::memory_order_acquire);
+
+		if (clock_us > _world_time_us.load()) {
+			updateClock(clock_us / 1000000, (clock_us % 1000000) * 1000);
+			idle = false;
+		}
+
+		gz_shm::ImuSample sample;
+
+		while (segment->imu.pop(sample)) {
+			if (sample.time_us > _world_time_us.load()) {
+				updateClock(sample.time_us / 1000000, (sample.time_us % 1000000) * 1000);
+			}
+
+			if (hrt_absolute_time() != 0) {
+				publishImu(sample.time_us,
+					   gz::math::Vector3d(sample.linear_acceleration[0], sample.linear_acceleration[1], sample.linear_acceleration[2]),
+					   gz::math::Vector3d(sample.angular_velocity[0], sample.angular_velocity[1], sample.angular_velocity[2]));
+			}
+
+			idle = false;
+		}
+
+		pthread_mutex_unlock(&_node_mutex);
+
+		if (idle) {
+			// wall clock sleep, the simulation time only advances through this loop
+			system_usleep(50);
+		}
+	}
 }
 
 void GZBridge::poseInfoCallback(const gz::msgs::Pose_V &pose)
@@ -1030,6 +1106,8 @@ void GZBridge::Run()
 
 int GZBridge::print_status()
 {
+	PX4_INFO("transport: %s", _use_shared_memory ? "shared memory" : "gz-transport");
+
 	PX4_INFO_RAW("ESC outputs:\n");
 	_mixing_interface_esc.mixingOutput().printStatus();
 
@@ -1066,6 +1144,7 @@ int GZBridge::print_usage(const char *reason)
 	PRINT_MODULE_USAGE_PARAM_STRING('n', nullptr, nullptr, "Model name", false);
 	PRINT_MODULE_USAGE_PARAM_STRING('i', nullptr, nullptr, "PX4 instance", false);
 	PRINT_MODULE_USAGE_PARAM_STRING('w', nullptr, nullptr, "World name", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('s', "Shared memory transport for clock, IMU and ESC outputs (needs plugin support)", true);
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
 
 	return 0;
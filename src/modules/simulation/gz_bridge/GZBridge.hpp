@@ -36,6 +36,7 @@
 #include "GZMixingInterfaceESC.hpp"
 #include "GZMixingInterfaceServo.hpp"
 #include "GZMixingInterfaceWheel.hpp"
+#include "GZSharedMemory.hpp"
 
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/defines.h>
@@ -80,7 +81,7 @@ using namespace time_literals;
 class GZBridge : public ModuleBase<GZBridge>, public ModuleParams, public px4::ScheduledWorkItem
 {
 public:
-	GZBridge(const char *world, const char *name, const char *model, const char *pose_str);
+	GZBridge(const char *world, const char *name, const char *model, const char *pose_str, bool shared_memory);
 	~GZBridge() override;
 
 	/** @see ModuleBase */
@@ -110,12 +111,17 @@ private:
 	void airspeedCallback(const gz::msgs::AirSpeed &air_speed);
 	void barometerCallback(const gz::msgs::FluidPressure &air_pressure);
 	void imuCallback(const gz::msgs::IMU &imu);
+	void publishImu(uint64_t time_us, const gz::math::Vector3d &accel_flu, const gz::math::Vector3d &gyro_flu);
 	void poseInfoCallback(const gz::msgs::Pose_V &pose);
 	void odometryCallback(const gz::msgs::OdometryWithCovariance &odometry);
 	void navSatCallback(const gz::msgs::NavSat &nav_sat);
 	void laserScantoLidarSensorCallback(const gz::msgs::LaserScan &scan);
 	void laserScanCallback(const gz::msgs::LaserScan &scan);
 
+	// polls the clock and IMU rings of the shared memory transport
+	static void *sharedMemoryThread(void *arg);
+	void sharedMemoryLoop();
+
 	/**
 	 * @brief Call Entityfactory service
 	 *
@@ -204,5 +210,11 @@ private:
 
 	float _temperature{288.15};  // 15 degrees
 
+	const bool _use_shared_memory;
+	GZSharedMemory _shared_memory;
+	pthread_t _shared_memory_thread{};
+	bool _shared_memory_thread_running{false};
+	px4::atomic<bool> _shared_memory_thread_should_exit{false};
+
 	gz::transport::Node _node;
 };
@@ -74,7 +74,18 @@ bool GZMixingInterfaceESC::updateOutputs(bool stop_motors, uint16_t outputs[MAX_
 		}
 	}
 
-	if (active_output_count > 0) {
+	if (active_output_count > 0 && _shared_memory) {
+		gz_shm::EscCommand command{};
+		command.time_us = hrt_absolute_time();
+		command.count = math::min(active_output_count, (unsigned)gz_shm::MAX_ESC_OUTPUTS);
+
+		for (unsigned i = 0; i < command.count; i++) {
+			command.velocity[i] = outputs[i];
+		}
+
+		return _shared_memory->esc.push(command);
+
+	} else if (active_output_count > 0) {
 		gz::msgs::Actuators rotor_velocity_message;
 		rotor_velocity_message.mutable_velocity()->Resize(active_output_count, 0);
 
@@ -35,6 +35,8 @@
 
 #include <lib/mixer_module/mixer_module.hpp>
 
+#include "GZSharedMemory.hpp"
+
 #include <gz/msgs.hh>
 #include <gz/transport.hh>
 
@@ -83,6 +85,8 @@ private:
 
 	gz::transport::Node::Publisher _actuators_pub;
 
+	gz_shm::Segment *_shared_memory{nullptr}; // set by GZBridge if the shared memory transport is used
+
 	uORB::Publication<esc_status_s> _esc_status_pub{ORB_ID(esc_status)};
 
 };
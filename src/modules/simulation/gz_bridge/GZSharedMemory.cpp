@@ -0,0 +1,118 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "GZSharedMemory.hpp"
+
+#include <px4_platform_common/log.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool GZSharedMemory::open(const std::string &model_name)
+{
+	close();
+
+	_name = "/px4_gz_" + model_name;
+
+	int fd = shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+	_created = (fd >= 0);
+
+	if (!_created && errno == EEXIST) {
+		fd = shm_open(_name.c_str(), O_RDWR, 0600);
+	}
+
+	if (fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", _name.c_str(), errno);
+		return false;
+	}
+
+	// a new segment is zero filled, which is the empty state of the rings
+	if (_created && ftruncate(fd, sizeof(gz_shm::Segment)) != 0) {
+		PX4_ERR("ftruncate %s failed (%i)", _name.c_str(), errno);
+		::close(fd);
+		shm_unlink(_name.c_str());
+		_created = false;
+		return false;
+	}
+
+	struct stat st {};
+
+	if (fstat(fd, &st) != 0 || st.st_size != (off_t)sizeof(gz_shm::Segment)) {
+		PX4_ERR("%s has an unexpected size", _name.c_str());
+		::close(fd);
+		return false;
+	}
+
+	void *ptr = mmap(nullptr, sizeof(gz_shm::Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+
+	if (ptr == MAP_FAILED) {
+		PX4_ERR("mmap %s failed (%i)", _name.c_str(), errno);
+		return false;
+	}
+
+	_segment = static_cast<gz_shm::Segment *>(ptr);
+
+	if (_created || _segment->magic == 0) {
+		_segment->version = gz_shm::VERSION;
+		_segment->magic = gz_shm::MAGIC;
+
+	} else if (_segment->magic != gz_shm::MAGIC || _segment->version != gz_shm::VERSION) {
+		PX4_ERR("%s layout version %" PRIu32 ", expected %" PRIu32, _name.c_str(), _segment->version, gz_shm::VERSION);
+		close();
+		return false;
+	}
+
+	PX4_INFO("shared memory transport %s", _name.c_str());
+	return true;
+}
+
+void GZSharedMemory::close()
+{
+	if (_segment) {
+		munmap(_segment, sizeof(gz_shm::Segment));
+		_segment = nullptr;
+	}
+
+	if (_created) {
+		// the plugin keeps its mapping, only the name is removed
+		shm_unlink(_name.c_str());
+		_created = false;
+	}
+}
@@ -0,0 +1,135 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+
+// Shared memory transport between the Gazebo plugin and GZBridge for the high-rate streams (clock, IMU and ESC
+// outputs). The segment only contains plain structs and lock-free single producer, single consumer rings, so
+// both processes can use it without serialization. The layout is shared with the plugin, bump VERSION on changes.
+namespace gz_shm
+{
+
+static constexpr uint32_t MAGIC = 0x5834475a; // "ZG4X"
+static constexpr uint32_t VERSION = 1;
+static constexpr int MAX_ESC_OUTPUTS = 16;
+
+// IMU sample in the FLU body frame, same as gz::msgs::IMU
+struct ImuSample {
+	uint64_t time_us;                 // simulation time of the sample
+	double linear_acceleration[3];    // [m/s^2]
+	double angular_velocity[3];       // [rad/s]
+};
+
+// rotor velocity commands, same as gz::msgs::Actuators on /<model>/command/motor_speed
+struct EscCommand {
+	uint64_t time_us;
+	uint32_t count;
+	double velocity[MAX_ESC_OUTPUTS];
+};
+
+template<typename T, uint32_t N>
+struct Ring {
+	static_assert((N & (N - 1)) == 0, "ring size must be a power of 2");
+	static_assert(std::atomic<uint32_t>::is_always_lock_free, "ring indices must be lock-free");
+
+	std::atomic<uint32_t> head;       // written by the producer only
+	std::atomic<uint32_t> tail;       // written by the consumer only
+	T items[N];
+
+	// returns false if the ring is full, the item is dropped
+	bool push(const T &item)
+	{
+		const uint32_t h = head.load(std::memory_order_relaxed);
+
+		if (h - tail.load(std::memory_order_acquire) >= N) {
+			return false;
+		}
+
+		items[h & (N - 1)] = item;
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T &item)
+	{
+		const uint32_t t = tail.load(std::memory_order_relaxed);
+
+		if (t == head.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		item = items[t & (N - 1)];
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+};
+
+struct Segment {
+	uint32_t magic;
+	uint32_t version;
+	std::atomic<uint64_t> clock_us;   // simulation time, written by the plugin every world step
+	Ring<ImuSample, 64> imu;          // plugin -> PX4
+	Ring<EscCommand, 16> esc;         // PX4 -> plugin
+};
+
+} // namespace gz_shm
+
+class GZSharedMemory
+{
+public:
+	GZSharedMemory() = default;
+	~GZSharedMemory() { close(); }
+
+	GZSharedMemory(const GZSharedMemory &) = delete;
+	GZSharedMemory &operator=(const GZSharedMemory &) = delete;
+
+	/**
+	 * Create or attach to the segment /px4_gz_<model_name>, whichever process comes first creates it.
+	 * @return false if the segment cannot be mapped or was created with a different layout
+	 */
+	bool open(const std::string &model_name);
+
+	void close();
+
+	gz_shm::Segment *segment() { return _segment; }
+
+private:
+	gz_shm::Segment *_segment{nullptr};
+	std::string _name;
+	bool _created{false};
+};
@@ -55,7 +55,19 @@ using namespace time_literals;
 
 Sih::Sih() :
 	ModuleParams(nullptr)
-{}
+{
+	_param_ca_rotor_count = param_find("CA_ROTOR_COUNT");
+
+	for (int i = 0; i < NB_MOTORS; ++i) {
+		char buffer[17];
+		snprintf(buffer, sizeof(buffer), "CA_ROTOR%u_PX", i);
+		_rotor_param_handles[i].position_x = param_find(buffer);
+		snprintf(buffer, sizeof(buffer), "CA_ROTOR%u_PY", i);
+		_rotor_param_handles[i].position_y = param_find(buffer);
+		snprintf(buffer, sizeof(buffer), "CA_ROTOR%u_KM", i);
+		_rotor_param_handles[i].moment_ratio = param_find(buffer);
+	}
+}
 
 Sih::~Sih()
 {
@@ -107,8 +119,13 @@ void Sih::lockstep_loop()
 		rate = 400;
 	}
 
-	// 200 - 2000 Hz
-	int sim_interval_us = math::constrain(int(roundf(1e6f / rate)), 500, 5000);
+	if (_sih_imu_rate.get() > 0) {
+		rate = _sih_imu_rate.get();
+	}
+
+	// 200 - 8000 Hz, the simulation time is not bound to the wall clock
+	int sim_interval_us = math::constrain(int(roundf(1e6f / rate)), 125, 5000);
+	configure_imu_fifo(sim_interval_us);
 
 	float speed_factor = 1.f;
 	const char *speedup = getenv("PX4_SIM_SPEED_FACTOR");
@@ -117,11 +134,36 @@ void Sih::lockstep_loop()
 		speed_factor = atof(speedup);
 	}
 
-	int rt_interval_us = int(roundf(sim_interval_us / speed_factor));
+	// a speed factor of 0 runs as fast as possible (headless CI flights)
+	int rt_interval_us = (speed_factor > 0.f) ? int(roundf(sim_interval_us / speed_factor)) : 0;
+
+	// maximum number of simulation steps per lockstep handshake
+	int batch_steps = 1;
+	const char *batch = getenv("PX4_SIM_LOCKSTEP_BATCH");
+
+	if (batch) {
+		batch_steps = math::max(atoi(batch), 1);
+	}
 
 	PX4_INFO("Simulation loop with %d Hz (%d us sim time interval)", rate, sim_interval_us);
-	PX4_INFO("Simulation with %.1fx speedup. Loop with (%d us wall time interval)", (double)speed_factor, rt_interval_us);
+
+	if (rt_interval_us > 0) {
+		PX4_INFO("Simulation with %.1fx speedup. Loop with (%d us wall time interval)", (double)speed_factor, rt_interval_us);
+
+	} else {
+		PX4_INFO("Simulation as fast as possible");
+	}
+
+	if (_fifo_samples > 1) {
+		PX4_INFO("IMU FIFO with %d samples", _fifo_samples);
+	}
+
+	if (batch_steps > 1) {
+		PX4_INFO("Lockstep handshake every %d steps if no thread is due", batch_steps);
+	}
+
 	uint64_t pre_compute_wall_time_us;
+	int steps_since_handshake = 0;
 
 	while (!should_exit()) {
 		pre_compute_wall_time_us = micros();
@@ -146,7 +188,13 @@ void Sih::lockstep_loop()
 			sleep_time = math::max(0, sim_interval_us - (int)(current_wall_time_us - pre_compute_wall_time_us));
 
 		} else {
-			px4_lockstep_wait_for_components();
+			// skip the handshake as long as no thread waits for a time within the next step
+			if (++steps_since_handshake >= batch_steps
+			    || px4_lockstep_next_deadline() <= _current_simulation_time_us + sim_interval_us) {
+				px4_lockstep_wait_for_components();
+				steps_since_handshake = 0;
+			}
+
 			current_wall_time_us = micros();
 			sleep_time = math::max(0, rt_interval_us - (int)(current_wall_time_us - pre_compute_wall_time_us));
 		}
@@ -172,8 +220,13 @@ void Sih::realtime_loop()
 		rate = 250;
 	}
 
+	if (_sih_imu_rate.get() > 0) {
+		rate = _sih_imu_rate.get();
+	}
+
 	// 200 - 2000 Hz
 	int interval_us = math::constrain(int(roundf(1e6f / rate)), 500, 5000);
+	configure_imu_fifo(interval_us);
 
 	px4_sem_init(&_data_semaphore, 0, 0);
 	hrt_call_every(&_timer_call, interval_us, interval_us, timer_callback, &_data_semaphore);
@@ -278,6 +331,57 @@ void Sih::parameters_updated()
 	_distance_snsr_override = _sih_distance_snsr_override.get();
 
 	_T_TAU = _sih_thrust_tau.get();
+
+	update_rotor_geometry();
+}
+
+void Sih::update_rotor_geometry()
+{
+	int32_t rotor_count = 0;
+
+	if (_param_ca_rotor_count == PARAM_INVALID || param_get(_param_ca_rotor_count, &rotor_count) != PX4_OK
+	    || rotor_count <= 0) {
+		// keep the quadrotor X geometry
+		return;
+	}
+
+	_rotor_count = math::min((int)rotor_count, (int)NB_MOTORS);
+
+	float position_x[NB_MOTORS] {};
+	float position_y[NB_MOTORS] {};
+	float moment_ratio[NB_MOTORS] {};
+	float max_x = 0.f;
+	float max_y = 0.f;
+	float max_km = 0.f;
+
+	for (int i = 0; i < _rotor_count; ++i) {
+		param_get(_rotor_param_handles[i].position_x, &position_x[i]);
+		param_get(_rotor_param_handles[i].position_y, &position_y[i]);
+		param_get(_rotor_param_handles[i].moment_ratio, &moment_ratio[i]);
+		max_x = math::max(max_x, fabsf(position_x[i]));
+		max_y = math::max(max_y, fabsf(position_y[i]));
+		max_km = math::max(max_km, fabsf(moment_ratio[i]));
+	}
+
+	// the CA geometry only sets the shape, the arm lengths and the rotor torque are given by the SIH parameters
+	for (int i = 0; i < _rotor_count; ++i) {
+		_rotor_roll[i] = (max_y > FLT_EPSILON) ? -position_y[i] / max_y : 0.f;
+		_rotor_pitch[i] = (max_x > FLT_EPSILON) ? position_x[i] / max_x : 0.f;
+		_rotor_yaw[i] = (max_km > FLT_EPSILON) ? moment_ratio[i] / max_km : 0.f;
+	}
+}
+
+void Sih::configure_imu_fifo(int interval_us)
+{
+	_fifo_samples = math::constrain(FIFO_INTERVAL_US / interval_us, 1, (int)(sizeof(_gyro_fifo.x) / sizeof(_gyro_fifo.x[0])));
+
+	if (_fifo_samples > 1) {
+		// 16 g and 2000 deg/s full scale range
+		_px4_accel.set_scale(16.f * CONSTANTS_ONE_G / 32768.f);
+		_px4_gyro.set_scale(math::radians(2000.f) / 32768.f);
+		_accel_fifo.dt = interval_us;
+		_gyro_fifo.dt = interval_us;
+	}
 }
 
 void Sih::init_variables()
@@ -292,7 +396,9 @@ void Sih::init_variables()
 	_q_E = Quatf(Eulerf(0.f, -M_PI_2_F, 0.f));
 	_w_B = Vector3f(0.0f, 0.0f, 0.0f);
 
-	_u[0] = _u[1] = _u[2] = _u[3] = 0.0f;
+	for (int i = 0; i < NB_MOTORS; i++) {
+		_u[i] = 0.0f;
+	}
 }
 
 void Sih::read_motors(const float dt)
@@ -317,10 +423,20 @@ void Sih::read_motors(const float dt)
 void Sih::generate_force_and_torques()
 {
 	if (_vehicle == VehicleType::MC) {
-		_T_B = Vector3f(0.0f, 0.0f, -_T_MAX * (+_u[0] + _u[1] + _u[2] + _u[3]));
-		_Mt_B = Vector3f(_L_ROLL * _T_MAX * (-_u[0] + _u[1] + _u[2] - _u[3]),
-				 _L_PITCH * _T_MAX * (+_u[0] - _u[1] + _u[2] - _u[3]),
-				 _Q_MAX * (+_u[0] + _u[1] - _u[2] - _u[3]));
+		float thrust = 0.f;
+		float roll = 0.f;
+		float pitch = 0.f;
+		float yaw = 0.f;
+
+		for (int i = 0; i < _rotor_count; i++) {
+			thrust += _u[i];
+			roll += _rotor_roll[i] * _u[i];
+			pitch += _rotor_pitch[i] * _u[i];
+			yaw += _rotor_yaw[i] * _u[i];
+		}
+
+		_T_B = Vector3f(0.0f, 0.0f, -_T_MAX * thrust);
+		_Mt_B = Vector3f(_L_ROLL * _T_MAX * roll, _L_PITCH * _T_MAX * pitch, _Q_MAX * yaw);
 		_Fa_E = -_KDV * _v_E;   // first order drag to slow down the aircraft
 		_Ma_B = -_KDW * _w_B;   // first order angular damper
 
@@ -527,9 +643,32 @@ void Sih::reconstruct_sensors_signals(const hrt_abstime &time_now_us)
 	const Vector3f earth_spin_rate_B = R_E2B * Vector3f(0.f, 0.f, CONSTANTS_EARTH_SPIN_RATE);
 	Vector3f gyro = _w_B + earth_spin_rate_B + gyro_noise;
 
-	// update IMU every iteration
-	_px4_accel.update(time_now_us, accel(0), accel(1), accel(2));
-	_px4_gyro.update(time_now_us, gyro(0), gyro(1), gyro(2));
+	if (_fifo_samples > 1) {
+		// batch the samples of the last millisecond like a real IMU FIFO
+		const float accel_scale = 32768.f / (16.f * CONSTANTS_ONE_G);
+		const float gyro_scale = 32768.f / math::radians(2000.f);
+		const int n = _gyro_fifo.samples;
+
+		_accel_fifo.x[n] = (int16_t)math::constrain(roundf(accel(0) * accel_scale), -32768.f, 32767.f);
+		_accel_fifo.y[n] = (int16_t)math::constrain(roundf(accel(1) * accel_scale), -32768.f, 32767.f);
+		_accel_fifo.z[n] = (int16_t)math::constrain(roundf(accel(2) * accel_scale), -32768.f, 32767.f);
+		_gyro_fifo.x[n] = (int16_t)math::constrain(roundf(gyro(0) * gyro_scale), -32768.f, 32767.f);
+		_gyro_fifo.y[n] = (int16_t)math::constrain(roundf(gyro(1) * gyro_scale), -32768.f, 32767.f);
+		_gyro_fifo.z[n] = (int16_t)math::constrain(roundf(gyro(2) * gyro_scale), -32768.f, 32767.f);
+		_accel_fifo.samples = _gyro_fifo.samples = n + 1;
+
+		if (n + 1 >= _fifo_samples) {
+			_accel_fifo.timestamp_sample = _gyro_fifo.timestamp_sample = time_now_us;
+			_px4_accel.updateFIFO(_accel_fifo);
+			_px4_gyro.updateFIFO(_gyro_fifo);
+			_accel_fifo.samples = _gyro_fifo.samples = 0;
+		}
+
+	} else {
+		// update IMU every iteration
+		_px4_accel.update(time_now_us, accel(0), accel(1), accel(2));
+		_px4_gyro.update(time_now_us, gyro(0), gyro(1), gyro(2));
+	}
 }
 
 void Sih::send_airspeed(const hrt_abstime &time_now_us)
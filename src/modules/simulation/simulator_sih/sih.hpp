@@ -134,7 +134,8 @@ private:
 	uORB::Subscription _actuator_out_sub{ORB_ID(actuator_outputs)};
 
 	// hard constants
-	static constexpr uint16_t NB_MOTORS = 6;
+	static constexpr uint16_t NB_MOTORS = 12;                  // maximum CA_ROTOR_COUNT
+	static constexpr int FIFO_INTERVAL_US = 1000;              // IMU FIFO publication interval above 1 kHz
 	static constexpr float T1_C = 15.0f;                        // ground temperature in Celsius
 	static constexpr float T1_K = T1_C - atmosphere::kAbsoluteNullCelsius;   // ground temperature in Kelvin
 	static constexpr float TEMP_GRADIENT = -6.5f / 1000.0f;    // temperature gradient in degrees per metre
@@ -150,6 +151,12 @@ private:
 	// read the motor signals outputted from the mixer
 	void read_motors(const float dt);
 
+	// multicopter rotor geometry from the control allocation parameters
+	void update_rotor_geometry();
+
+	// number of IMU samples per FIFO publication for a simulation step interval
+	void configure_imu_fifo(int interval_us);
+
 	// generate the motors thrust and torque in the body frame
 	void generate_force_and_torques();
 
@@ -220,6 +227,26 @@ private:
 
 	float       _u[NB_MOTORS] {};         // thruster signals
 
+	// multicopter rotor geometry, normalized to [-1, 1] and scaled by SIH_L_ROLL, SIH_L_PITCH and SIH_Q_MAX
+	int         _rotor_count{4};
+	float       _rotor_roll[NB_MOTORS] {-1.f, 1.f, 1.f, -1.f};
+	float       _rotor_pitch[NB_MOTORS] {1.f, -1.f, 1.f, -1.f};
+	float       _rotor_yaw[NB_MOTORS] {1.f, 1.f, -1.f, -1.f};
+
+	struct RotorParamHandles {
+		param_t position_x;
+		param_t position_y;
+		param_t moment_ratio;
+	};
+
+	param_t _param_ca_rotor_count{PARAM_INVALID};
+	RotorParamHandles _rotor_param_handles[NB_MOTORS] {};
+
+	// IMU samples batched into the FIFO topics when stepping faster than 1 kHz
+	int _fifo_samples{1};
+	sensor_accel_fifo_s _accel_fifo{};
+	sensor_gyro_fifo_s _gyro_fifo{};
+
 	enum class VehicleType {MC, FW, TS};
 	VehicleType _vehicle = VehicleType::MC;
 
@@ -300,6 +327,7 @@ private:
 		(ParamFloat<px4::params::SIH_DISTSNSR_MAX>) _sih_distance_snsr_max,
 		(ParamFloat<px4::params::SIH_DISTSNSR_OVR>) _sih_distance_snsr_override,
 		(ParamFloat<px4::params::SIH_T_TAU>) _sih_thrust_tau,
-		(ParamInt<px4::params::SIH_VEHICLE_TYPE>) _sih_vtype
+		(ParamInt<px4::params::SIH_VEHICLE_TYPE>) _sih_vtype,
+		(ParamInt<px4::params::SIH_IMU_RATE>) _sih_imu_rate
 	)
 };
@@ -172,6 +172,8 @@ PARAM_DEFINE_FLOAT(SIH_Q_MAX, 0.1f);
  *
  * This value can be measured with a ruler.
  * This corresponds to half the distance between the left and right motors.
+ * For a multicopter the rotor layout comes from CA_ROTOR_COUNT and CA_ROTORn_PY,
+ * scaled such that the outermost rotors are at this distance.
  *
  * @unit m
  * @min 0.0
@@ -188,6 +190,8 @@ PARAM_DEFINE_FLOAT(SIH_L_ROLL, 0.2f);
  *
  * This value can be measured with a ruler.
  * This corresponds to half the distance between the front and rear motors.
+ * For a multicopter the rotor layout comes from CA_ROTOR_COUNT and CA_ROTORn_PX,
+ * scaled such that the outermost rotors are at this distance.
  *
  * @unit m
  * @min 0.0
@@ -336,3 +340,20 @@ PARAM_DEFINE_FLOAT(SIH_T_TAU, 0.05f);
  * @group Simulation In Hardware
  */
 PARAM_DEFINE_INT32(SIH_VEHICLE_TYPE, 0);
+
+/**
+ * IMU sample rate
+ *
+ * Rate of the simulation step and of the simulated accelerometer and gyroscope.
+ * Above 1 kHz the samples are published in 1 ms batches on sensor_accel_fifo and
+ * sensor_gyro_fifo, like a real IMU driver. Without lockstep the rate is limited to 2 kHz.
+ *
+ * Set to 0 to derive the rate from IMU_GYRO_RATEMAX and IMU_INTEG_RATE.
+ *
+ * @min 0
+ * @max 8000
+ * @unit Hz
+ * @reboot_required true
+ * @group Simulation In Hardware
+ */
+PARAM_DEFINE_INT32(SIH_IMU_RATE, 0);
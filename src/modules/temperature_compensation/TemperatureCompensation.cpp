@@ -433,12 +433,12 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
 		_accel_data.last_temperature[topic_instance] = temperature;
+
+		// Calculate and update the offsets
+		calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
 		return 2;
 	}
 
@@ -459,12 +459,12 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
 		_gyro_data.last_temperature[topic_instance] = temperature;
+
+		// Calculate and update the offsets
+		calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
 		return 2;
 	}
 
@@ -485,12 +485,12 @@ int TemperatureCompensation::update_offsets_mag(int topic_instance, float temper
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > 1.0f) {
 		_mag_data.last_temperature[topic_instance] = temperature;
+
+		// Calculate and update the offsets
+		calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
 		return 2;
 	}
 
@@ -511,12 +511,12 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only re-evaluate the polynomial if the temperature delta is large enough to warrant a new publication
 	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
 		_baro_data.last_temperature[topic_instance] = temperature;
+
+		// Calculate and update the offsets
+		calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
 		return 2;
 	}
 
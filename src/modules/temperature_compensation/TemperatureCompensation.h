@@ -89,7 +89,7 @@ public:
 	 * @param offsets returns offsets that were applied (length = 3, except for baro), depending on return value
 	 * @return -1: error: correction enabled, but no sensor mapping set (@see set_sendor_id_gyro)
 	 *         0: no changes (correction not enabled),
-	 *         1: corrections applied but no changes to offsets,
+	 *         1: corrections applied but no changes to offsets (offsets left untouched),
 	 *         2: corrections applied and offsets updated
 	 */
 	int update_offsets_accel(int topic_instance, float temperature, float *offsets);
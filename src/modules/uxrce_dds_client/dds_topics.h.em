@@ -21,17 +21,22 @@ import os
 #include <uxr/client/client.h>
 #include <ucdr/microcdr.h>
 
+#include <float.h>
+#include <string.h>
+
+#include <drivers/drv_hrt.h>
 #include <mathlib/mathlib.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/sem.h>
 #include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/uORB.h>
 @[for include in type_includes]@
 #include <uORB/ucdr/@(include).h>
 #include <uORB/topics/@(include).h>
 @[end for]@
 
-#define UXRCE_DEFAULT_POLL_RATE 10
-
 typedef bool (*UcdrSerializeMethod)(const void* data, ucdrBuffer& buf, int64_t time_offset);
 
 static constexpr int max_topic_size = 512;
@@ -39,52 +44,224 @@ static constexpr int max_topic_size = 512;
 static_assert(sizeof(@(pub['simple_base_type'])_s) <= max_topic_size, "topic too large, increase max_topic_size");
 @[    end for]@
 
+struct SendTopicsSubs;
+
+// Subscription that adds its topic to the ready list of SendTopicsSubs on new publications
+class SendSubscriptionCallback : public uORB::SubscriptionCallback
+{
+public:
+	SendSubscriptionCallback(const orb_metadata *meta, uint8_t instance) :
+		SubscriptionCallback(meta, 0, instance)
+	{
+	}
+
+	void call() override;
+
+	SendTopicsSubs *subs{nullptr};
+	uint16_t index{0};
+};
+
 struct SendSubscription {
-	const struct orb_metadata *orb_meta;
+	SendSubscriptionCallback subscription;
 	uxrObjectId data_writer;
 	const char* dds_type_name;
 	const char* topic;
 	uint32_t topic_size;
 	UcdrSerializeMethod ucdr_serialize_method;
+	uint16_t default_interval_ms; ///< rate limit from dds_topics.yaml
+	uint16_t interval_ms;         ///< current rate limit, 0 = no limit
 };
 
 // Subscribers for messages to send
 struct SendTopicsSubs {
-	SendSubscription send_subscriptions[@(len(publications))] = {
+	static constexpr unsigned num_topics = @(len(publications));
+	static constexpr unsigned num_ready_words = (num_topics + 31) / 32;
+
+	SendSubscription send_subscriptions[num_topics] = {
 @[    for pub in publications]@
-			{ ORB_ID(@(pub['topic_simple'])),
+			{ {ORB_ID(@(pub['orb_topic_simple'])), @(pub['instance'])},
 			  uxr_object_id(0, UXR_INVALID_ID),
 			  "@(pub['dds_type'])",
 			  "@(pub['topic'])",
 			  ucdr_topic_size_@(pub['simple_base_type'])(),
 			  &ucdr_serialize_@(pub['simple_base_type']),
+			  @(pub['interval_ms']),
+			  @(pub['interval_ms']),
 			},
 @[    end for]@
 	};
 
-	px4_pollfd_struct_t fds[@(len(publications))] {};
+	// ready list: one bit per topic, set by the subscription callbacks (publisher context) and consumed by update()
+	px4::atomic<uint32_t> ready[num_ready_words] {};
+	px4::atomic_bool ready_wakeup_pending{false};
+	px4_sem_t ready_sem;
 
 	uint32_t num_payload_sent{};
+	uint32_t num_frames_sent{};        ///< number of flushes of the best-effort stream with data
+
+	// batching: >0 to pack multiple topics into one transport frame, until this many bytes are pending
+	uint32_t batch_max_bytes{0};
+	uint32_t batch_pending_bytes{0};
+	hrt_abstime batch_start{0};        ///< time when the first pending topic was serialized
+
+	SendTopicsSubs()
+	{
+		px4_sem_init(&ready_sem, 0, 0);
+		px4_sem_setprotocol(&ready_sem, SEM_PRIO_NONE);
+	}
+
+	~SendTopicsSubs()
+	{
+		for (unsigned idx = 0; idx < num_topics; ++idx) {
+			send_subscriptions[idx].subscription.unregisterCallback();
+		}
+
+		px4_sem_destroy(&ready_sem);
+	}
 
 	void init();
 	void update(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId best_effort_stream_id, uxrObjectId participant_id, const char *client_namespace);
 	void reset();
+
+	/**
+	 * Mark a topic as updated and wake up wait_ready(). Can be called from any thread.
+	 */
+	void set_ready(unsigned idx)
+	{
+		ready[idx / 32].fetch_or(1u << (idx % 32));
+
+		if (!ready_wakeup_pending.load()) {
+			ready_wakeup_pending.store(true);
+			px4_sem_post(&ready_sem);
+		}
+	}
+
+	/**
+	 * @return true if at least one topic is in the ready list
+	 */
+	bool any_ready() const
+	{
+		for (unsigned word = 0; word < num_ready_words; ++word) {
+			if (ready[word].load() != 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Wait until a topic got updated
+	 * @param timeout_us maximum time to wait, 0 to return immediately
+	 * @return true if there are updated topics
+	 */
+	bool wait_ready(uint32_t timeout_us);
+
+	/**
+	 * @return true if batched data should be sent now, due to the byte budget or because it has been pending for max_delay
+	 */
+	bool batch_due(hrt_abstime now, hrt_abstime max_delay) const
+	{
+		return batch_pending_bytes > 0 && (batch_pending_bytes >= batch_max_bytes || now - batch_start >= max_delay);
+	}
+
+	/**
+	 * Send all pending data in one frame
+	 */
+	void flush(uxrSession *session)
+	{
+		uxr_flash_output_streams(session);
+		++num_frames_sent;
+		batch_pending_bytes = 0;
+	}
+
+	/**
+	 * Change the rate limit of a topic at runtime
+	 * @param topic DDS topic name, e.g. /fmu/out/sensor_combined
+	 * @param rate_limit maximum rate [Hz], 0 for no limit, negative to reset to the default
+	 * @return false if the topic is not bridged
+	 */
+	bool set_rate_limit(const char *topic, float rate_limit);
 };
 
+void SendSubscriptionCallback::call()
+{
+	// only queue the topic if there is data to send (respecting the rate limit)
+	if (updated()) {
+		subs->set_ready(index);
+	}
+}
+
 void SendTopicsSubs::init() {
-	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
-		fds[idx].fd = orb_subscribe(send_subscriptions[idx].orb_meta);
-		fds[idx].events = POLLIN;
-		orb_set_interval(fds[idx].fd, UXRCE_DEFAULT_POLL_RATE);
+	for (unsigned idx = 0; idx < num_topics; ++idx) {
+		SendSubscriptionCallback &subscription = send_subscriptions[idx].subscription;
+		subscription.subs = this;
+		subscription.index = idx;
+		subscription.set_interval_ms(send_subscriptions[idx].interval_ms);
+		subscription.registerCallback();
+
+		// already published data is sent as well, like for a new poll subscription
+		set_ready(idx);
+	}
+}
+
+bool SendTopicsSubs::wait_ready(uint32_t timeout_us) {
+	if (timeout_us > 0 && !any_ready()) {
+		struct timespec ts;
+#if defined(__PX4_NUTTX)
+		px4_clock_gettime(CLOCK_REALTIME, &ts);
+#else
+		// lockstep aware, see px4_poll()
+		px4_clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+
+		const unsigned billion = (1000 * 1000 * 1000);
+		uint64_t nsecs = ts.tv_nsec + (uint64_t)timeout_us * 1000;
+		ts.tv_sec += nsecs / billion;
+		ts.tv_nsec = nsecs % billion;
+
+		px4_sem_timedwait(&ready_sem, &ts);
+	}
+
+	ready_wakeup_pending.store(false);
+	return any_ready();
+}
+
+bool SendTopicsSubs::set_rate_limit(const char *topic, float rate_limit) {
+	for (unsigned idx = 0; idx < num_topics; ++idx) {
+		SendSubscription &sub = send_subscriptions[idx];
+
+		if (strcmp(sub.topic, topic) == 0) {
+			if (rate_limit < 0.f) {
+				sub.interval_ms = sub.default_interval_ms;
+
+			} else if (rate_limit > 1000.f || rate_limit < FLT_EPSILON) {
+				sub.interval_ms = 0;
+
+			} else {
+				sub.interval_ms = math::min(roundf(1000.f / rate_limit), (float)UINT16_MAX);
+			}
+
+			sub.subscription.set_interval_ms(sub.interval_ms);
+
+			return true;
+		}
 	}
+
+	return false;
 }
 
 void SendTopicsSubs::reset() {
 	num_payload_sent = 0;
-	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
+	num_frames_sent = 0;
+	batch_pending_bytes = 0;
+	for (unsigned idx = 0; idx < num_topics; ++idx) {
 		send_subscriptions[idx].data_writer = uxr_object_id(0, UXR_INVALID_ID);
-		orb_unsubscribe(fds[idx].fd);
-		fds[idx].fd = -1;
+		send_subscriptions[idx].subscription.unregisterCallback();
+	}
+
+	for (unsigned word = 0; word < num_ready_words; ++word) {
+		ready[word].store(0);
 	}
 };
 
@@ -94,34 +271,61 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 	alignas(sizeof(uint64_t)) char topic_data[max_topic_size];
 
-	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
-		if (fds[idx].revents & POLLIN) {
-			// Topic updated, copy data and send
-			orb_copy(send_subscriptions[idx].orb_meta, fds[idx].fd, &topic_data);
-			if (send_subscriptions[idx].data_writer.id == UXR_INVALID_ID) {
+	for (unsigned word = 0; word < num_ready_words; ++word) {
+		// take the whole word, topics published from now on are handled in the next update
+		uint32_t ready_bits = ready[word].fetch_and(0);
+
+		while (ready_bits != 0) {
+			const unsigned idx = word * 32 + __builtin_ctz(ready_bits);
+			ready_bits &= ready_bits - 1;
+
+			SendSubscription &sub = send_subscriptions[idx];
+
+			if (!sub.subscription.update(&topic_data)) {
+				// already sent or rate limited
+				continue;
+			}
+
+			if (sub.data_writer.id == UXR_INVALID_ID) {
 				// data writer not created yet
-				create_data_writer(session, reliable_out_stream_id, participant_id, static_cast<ORB_ID>(send_subscriptions[idx].orb_meta->o_id), client_namespace, send_subscriptions[idx].topic,
-								   send_subscriptions[idx].dds_type_name, send_subscriptions[idx].data_writer);
+				create_data_writer(session, reliable_out_stream_id, participant_id, static_cast<ORB_ID>(sub.subscription.get_topic()->o_id), client_namespace, sub.topic,
+								   sub.dds_type_name, sub.data_writer);
 			}
 
-			if (send_subscriptions[idx].data_writer.id != UXR_INVALID_ID) {
+			if (sub.data_writer.id != UXR_INVALID_ID) {
 
 				ucdrBuffer ub;
-				uint32_t topic_size = send_subscriptions[idx].topic_size;
-				if (uxr_prepare_output_stream(session, best_effort_stream_id, send_subscriptions[idx].data_writer, &ub, topic_size) != UXR_INVALID_REQUEST_ID) {
-					send_subscriptions[idx].ucdr_serialize_method(&topic_data, ub, time_offset_us);
-					// TODO: fill up the MTU and then flush, which reduces the packet overhead
-					uxr_flash_output_streams(session);
+				uint32_t topic_size = sub.topic_size;
+				uint16_t request_id = uxr_prepare_output_stream(session, best_effort_stream_id, sub.data_writer, &ub, topic_size);
+
+				if (request_id == UXR_INVALID_REQUEST_ID && batch_pending_bytes > 0) {
+					// the frame is full: send it and start a new one
+					flush(session);
+					request_id = uxr_prepare_output_stream(session, best_effort_stream_id, sub.data_writer, &ub, topic_size);
+				}
+
+				if (request_id != UXR_INVALID_REQUEST_ID) {
+					sub.ucdr_serialize_method(&topic_data, ub, time_offset_us);
 					num_payload_sent += topic_size;
 
+					if (batch_max_bytes == 0) {
+						flush(session);
+
+					} else {
+						if (batch_pending_bytes == 0) {
+							batch_start = hrt_absolute_time();
+						}
+
+						batch_pending_bytes += topic_size;
+					}
+
 				} else {
-					//PX4_ERR("Error uxr_prepare_output_stream UXR_INVALID_REQUEST_ID %s", send_subscriptions[idx].subscription.get_topic()->o_name);
+					//PX4_ERR("Error uxr_prepare_output_stream UXR_INVALID_REQUEST_ID %s", sub.subscription.get_topic()->o_name);
 				}
 
 			} else {
-				//PX4_ERR("Error UXR_INVALID_ID %s", send_subscriptions[idx].subscription.get_topic()->o_name);
+				//PX4_ERR("Error UXR_INVALID_ID %s", sub.subscription.get_topic()->o_name);
 			}
-
 		}
 	}
 }
@@ -99,10 +99,30 @@ def process_message_type(msg_type):
     # topic_simple: eg vehicle_status
     msg_type['topic_simple'] = msg_type['topic'].split('/')[-1]
 
+def process_publication(pub):
+    # optional uORB instance: the topic name is <orb topic>_<instance>
+    pub['instance'] = int(pub.get('instance', 0))
+    pub['orb_topic_simple'] = pub['topic_simple']
+    if pub['instance'] != 0:
+        suffix = '_' + str(pub['instance'])
+        if not pub['topic_simple'].endswith(suffix):
+            raise ValueError("topic {} with instance {} must end with '{}'".format(pub['topic'], pub['instance'], suffix))
+        pub['orb_topic_simple'] = pub['topic_simple'][:-len(suffix)]
+
+    # optional rate limit [Hz], converted to the uORB interval [ms] (0 = no limit)
+    rate_limit = float(pub.get('rate_limit', default_rate_limit))
+    if rate_limit < 0:
+        raise ValueError("topic {}: rate_limit must be >= 0".format(pub['topic']))
+    pub['interval_ms'] = int(round(1000. / rate_limit)) if rate_limit > 0 else 0
+
+# default publication rate limit [Hz]
+default_rate_limit = 100
+
 pubs_not_empty = msg_map['publications'] is not None
 if pubs_not_empty:
     for p in msg_map['publications']:
         process_message_type(p)
+        process_publication(p)
 
 merged_em_globals['publications'] = msg_map['publications'] if pubs_not_empty else []
 
@@ -0,0 +1,270 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "shm_transport.h"
+
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+#include <px4_platform_common/log.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+using namespace uxrce_dds_shm;
+
+static constexpr uint32_t RING_MASK = RING_SIZE - 1;
+
+UxrceddsShmTransport::UxrceddsShmTransport(const char *name)
+{
+	strncpy(_name, name ? name : DEFAULT_NAME, sizeof(_name) - 1);
+}
+
+UxrceddsShmTransport::~UxrceddsShmTransport()
+{
+	if (_initialized) {
+		uxr_close_custom_transport(&_transport);
+	}
+
+	// the segment itself is kept, so that the Agent can stay attached while the client reconnects
+	close();
+}
+
+bool UxrceddsShmTransport::init()
+{
+	// no framing: the rings preserve the message boundaries
+	uxr_set_custom_transport_callbacks(&_transport, false, &open_callback, &close_callback, &write_callback,
+					   &read_callback);
+	_initialized = uxr_init_custom_transport(&_transport, this);
+	return _initialized;
+}
+
+int UxrceddsShmTransport::bytes_available() const
+{
+	if (_segment == nullptr) {
+		return 0;
+	}
+
+	return _segment->to_client.head.load() - _segment->to_client.tail.load();
+}
+
+bool UxrceddsShmTransport::open_callback(uxrCustomTransport *transport)
+{
+	return static_cast<UxrceddsShmTransport *>(transport->args)->open();
+}
+
+bool UxrceddsShmTransport::close_callback(uxrCustomTransport *transport)
+{
+	static_cast<UxrceddsShmTransport *>(transport->args)->close();
+	return true;
+}
+
+size_t UxrceddsShmTransport::write_callback(uxrCustomTransport *transport, const uint8_t *buf, size_t len,
+		uint8_t *error)
+{
+	return static_cast<UxrceddsShmTransport *>(transport->args)->write(buf, len, error);
+}
+
+size_t UxrceddsShmTransport::read_callback(uxrCustomTransport *transport, uint8_t *buf, size_t len, int timeout,
+		uint8_t *error)
+{
+	return static_cast<UxrceddsShmTransport *>(transport->args)->read(buf, len, timeout, error);
+}
+
+bool UxrceddsShmTransport::open()
+{
+	_fd = shm_open(_name, O_RDWR | O_CREAT, 0666);
+
+	if (_fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", _name, errno);
+		return false;
+	}
+
+	if (ftruncate(_fd, sizeof(ShmSegment)) != 0) {
+		PX4_ERR("ftruncate %s failed (%i)", _name, errno);
+		close();
+		return false;
+	}
+
+	void *segment = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+
+	if (segment == MAP_FAILED) {
+		PX4_ERR("mmap %s failed (%i)", _name, errno);
+		close();
+		return false;
+	}
+
+	_segment = static_cast<ShmSegment *>(segment);
+
+	// (re-)initialize, the Agent does not access the segment until the magic is set
+	_segment->magic.store(0);
+	_segment->version = SHM_VERSION;
+
+	ShmRing *rings[] {&_segment->to_agent, &_segment->to_client};
+
+	for (ShmRing *ring : rings) {
+		ring->head.store(0);
+		ring->tail.store(0);
+		ring->reader_waiting.store(0);
+		sem_init(&ring->data_available, 1, 0);
+	}
+
+	_segment->magic.store(SHM_MAGIC);
+
+	return true;
+}
+
+void UxrceddsShmTransport::close()
+{
+	if (_segment != nullptr) {
+		munmap(_segment, sizeof(ShmSegment));
+		_segment = nullptr;
+	}
+
+	if (_fd >= 0) {
+		::close(_fd);
+		_fd = -1;
+	}
+}
+
+size_t UxrceddsShmTransport::write(const uint8_t *buf, size_t len, uint8_t *error)
+{
+	if (_segment == nullptr || len >= WRAP_MARKER) {
+		*error = 1;
+		return 0;
+	}
+
+	ShmRing &ring = _segment->to_agent;
+
+	const uint32_t head = ring.head.load();
+	const uint32_t tail = ring.tail.load();
+	const uint32_t required = sizeof(uint16_t) + len;
+
+	// messages are not split, skip the rest of the ring if it doesn't fit
+	const uint32_t contiguous = RING_SIZE - (head & RING_MASK);
+	const uint32_t skip = (contiguous < required) ? contiguous : 0;
+
+	if (RING_SIZE - (head - tail) < skip + required) {
+		// Agent is not reading, drop the message (like UDP would)
+		*error = 1;
+		return 0;
+	}
+
+	if (skip >= sizeof(uint16_t)) {
+		memcpy(&ring.data[head & RING_MASK], &WRAP_MARKER, sizeof(uint16_t));
+	}
+
+	const uint32_t start = (head + skip) & RING_MASK;
+	const uint16_t length = len;
+	memcpy(&ring.data[start], &length, sizeof(uint16_t));
+	memcpy(&ring.data[start + sizeof(uint16_t)], buf, len);
+
+	ring.head.store(head + skip + required);
+
+	if (ring.reader_waiting.load()) {
+		sem_post(&ring.data_available);
+	}
+
+	return len;
+}
+
+size_t UxrceddsShmTransport::read(uint8_t *buf, size_t len, int timeout_ms, uint8_t *error)
+{
+	if (_segment == nullptr) {
+		*error = 1;
+		return 0;
+	}
+
+	ShmRing &ring = _segment->to_client;
+	bool waited = false;
+
+	while (true) {
+		const uint32_t tail = ring.tail.load();
+
+		if (ring.head.load() != tail) {
+			const uint32_t start = tail & RING_MASK;
+			const uint32_t contiguous = RING_SIZE - start;
+			uint16_t length = WRAP_MARKER;
+
+			if (contiguous >= sizeof(uint16_t)) {
+				memcpy(&length, &ring.data[start], sizeof(uint16_t));
+			}
+
+			if (length == WRAP_MARKER) {
+				ring.tail.store(tail + contiguous);
+				continue;
+			}
+
+			size_t copied = 0;
+
+			if (length <= len) {
+				memcpy(buf, &ring.data[start + sizeof(uint16_t)], length);
+				copied = length;
+
+			} else {
+				*error = 1;
+			}
+
+			ring.tail.store(tail + sizeof(uint16_t) + length);
+			return copied;
+		}
+
+		if (waited || timeout_ms <= 0) {
+			return 0;
+		}
+
+		// the Agent runs in real time, so this is not lockstep aware (unlike px4_sem_timedwait)
+		struct timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		const unsigned billion = (1000 * 1000 * 1000);
+		uint64_t nsecs = ts.tv_nsec + (uint64_t)timeout_ms * 1000 * 1000;
+		ts.tv_sec += nsecs / billion;
+		ts.tv_nsec = nsecs % billion;
+
+		ring.reader_waiting.store(1);
+
+		// check again after announcing the wait, the Agent might have written in the meantime
+		if (ring.head.load() == tail) {
+			sem_timedwait(&ring.data_available, &ts);
+		}
+
+		ring.reader_waiting.store(0);
+		waited = true;
+	}
+}
+
+#endif // UXRCE_DDS_CLIENT_SHM
@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file shm_transport.h
+ *
+ * Shared memory transport for the uXRCE-DDS client, for an Agent running on the same host (SITL or PX4 on Linux).
+ *
+ * The segment (POSIX shared memory object, e.g. /dev/shm/px4_uxrce_dds) is created and initialized by the client
+ * and contains one message ring per direction. Each ring has a single producer and a single consumer, the indices
+ * are free running and only written by their owner, so no locks are needed. A message is stored as a 16 bit length
+ * followed by the payload. Messages do not wrap around the end of the ring: if the remaining space is too small,
+ * the producer writes a length of WRAP_MARKER (if there is space for it) and continues at the start.
+ * The consumer sets 'reader_waiting' before blocking on the process-shared semaphore, the producer only posts it
+ * in that case, so there are no syscalls while both sides are busy.
+ *
+ * The Agent needs a custom transport implementing the same layout (see ShmSegment), it waits for 'magic' to be
+ * SHM_MAGIC before using the segment. The client resets 'magic' to 0 while (re-)initializing the segment.
+ */
+
+#pragma once
+
+#if defined(__PX4_LINUX)
+# define UXRCE_DDS_CLIENT_SHM 1
+#endif
+
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+#include <px4_platform_common/atomic.h>
+
+#include <uxr/client/client.h>
+
+#include <semaphore.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace uxrce_dds_shm
+{
+
+static constexpr uint32_t SHM_MAGIC = 0x50583444; // "PX4D"
+static constexpr uint32_t SHM_VERSION = 1;
+static constexpr uint32_t RING_SIZE = 64 * 1024;  // needs to be a power of 2
+static constexpr uint16_t WRAP_MARKER = UINT16_MAX;
+
+static_assert((RING_SIZE & (RING_SIZE - 1)) == 0, "RING_SIZE must be a power of 2");
+
+struct ShmRing {
+	px4::atomic<uint32_t> head;           ///< write index, only modified by the producer
+	px4::atomic<uint32_t> tail;           ///< read index, only modified by the consumer
+	px4::atomic<uint32_t> reader_waiting; ///< set by the consumer while it blocks on data_available
+	sem_t data_available;                 ///< process-shared, posted by the producer
+	uint8_t data[RING_SIZE];
+};
+
+struct ShmSegment {
+	px4::atomic<uint32_t> magic;
+	uint32_t version;
+	ShmRing to_agent;
+	ShmRing to_client;
+};
+
+} // namespace uxrce_dds_shm
+
+class UxrceddsShmTransport
+{
+public:
+	static constexpr const char *DEFAULT_NAME = "/px4_uxrce_dds";
+
+	explicit UxrceddsShmTransport(const char *name);
+	~UxrceddsShmTransport();
+
+	/**
+	 * Create and map the shared memory segment and set up the XRCE custom transport
+	 * @return true on success
+	 */
+	bool init();
+
+	uxrCommunication *comm() { return &_transport.comm; }
+
+	/**
+	 * @return number of bytes pending from the Agent
+	 */
+	int bytes_available() const;
+
+	const char *name() const { return _name; }
+
+private:
+	static bool open_callback(uxrCustomTransport *transport);
+	static bool close_callback(uxrCustomTransport *transport);
+	static size_t write_callback(uxrCustomTransport *transport, const uint8_t *buf, size_t len, uint8_t *error);
+	static size_t read_callback(uxrCustomTransport *transport, uint8_t *buf, size_t len, int timeout, uint8_t *error);
+
+	bool open();
+	void close();
+	size_t write(const uint8_t *buf, size_t len, uint8_t *error);
+	size_t read(uint8_t *buf, size_t len, int timeout_ms, uint8_t *error);
+
+	uxrCustomTransport _transport{};
+	bool _initialized{false};
+
+	char _name[32] {};
+	int _fd{-1};
+	uxrce_dds_shm::ShmSegment *_segment{nullptr};
+};
+
+#endif // UXRCE_DDS_CLIENT_SHM
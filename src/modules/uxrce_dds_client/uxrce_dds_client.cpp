@@ -180,6 +180,29 @@ bool UxrceddsClient::init()
 
 #endif // UXRCE_DDS_CLIENT_UDP
 
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+	if (_transport == Transport::Shm) {
+		_transport_shm = new UxrceddsShmTransport(_device);
+
+		if (_transport_shm && _transport_shm->init()) {
+
+			PX4_INFO("init shared memory %s", _transport_shm->name());
+
+			_comm = _transport_shm->comm();
+
+			return true;
+
+		} else {
+			PX4_ERR("init shared memory %s failed", _device);
+		}
+
+		delete _transport_shm;
+		_transport_shm = nullptr;
+	}
+
+#endif // UXRCE_DDS_CLIENT_SHM
+
 	return false;
 }
 
@@ -206,6 +229,13 @@ void UxrceddsClient::deinit()
 
 #endif // UXRCE_DDS_CLIENT_UDP
 
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+	delete _transport_shm;
+	_transport_shm = nullptr;
+
+#endif // UXRCE_DDS_CLIENT_SHM
+
 	_comm = nullptr;
 }
 
@@ -483,6 +513,22 @@ void UxrceddsClient::handleMessageFormatRequest()
 	}
 }
 
+void UxrceddsClient::handleTopicRateLimitRequest()
+{
+	dds_topic_rate_limit_s rate_limit;
+
+	if (_dds_topic_rate_limit_sub.update(&rate_limit)) {
+		rate_limit.topic_name[sizeof(rate_limit.topic_name) - 1] = '\0';
+
+		if (_subs->set_rate_limit(rate_limit.topic_name, rate_limit.rate_limit)) {
+			PX4_INFO("rate limit of %s set to %.1f Hz", rate_limit.topic_name, (double)rate_limit.rate_limit);
+
+		} else {
+			PX4_WARN("rate limit: %s is not a bridged topic", rate_limit.topic_name);
+		}
+	}
+}
+
 void UxrceddsClient::syncSystemClock(uxrSession *session)
 {
 	struct timespec ts = {};
@@ -552,79 +598,132 @@ void UxrceddsClient::run()
 		}
 
 		hrt_abstime last_sync_session = 0;
+		hrt_abstime last_sync_request = 0;
+		bool sync_request_pending = false;
 		hrt_abstime last_status_update = hrt_absolute_time();
 		hrt_abstime last_ping = hrt_absolute_time();
 		int num_pings_missed = 0;
 		bool had_ping_reply = false;
 		uint32_t last_num_payload_sent{};
 		uint32_t last_num_payload_received{};
-		int poll_error_counter = 0;
+		uint32_t last_num_frames_sent{};
 
 		_subs->init();
 		_subs_initialized = true;
 
+		// batching of multiple topics into one frame, limited by the transport MTU
+		const hrt_abstime batch_max_delay = math::max(_param_uxrce_dds_btch_t.get(), 0) * 1_ms;
+		_subs->batch_max_bytes = 0;
+
+		if (batch_max_delay > 0) {
+			uint32_t mtu = UXR_CONFIG_SERIAL_TRANSPORT_MTU;
+#if defined(UXRCE_DDS_CLIENT_UDP)
+
+			if (_transport_udp != nullptr) {
+				mtu = UXR_CONFIG_UDP_TRANSPORT_MTU;
+			}
+
+#endif
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+			if (_transport_shm != nullptr) {
+				mtu = UXR_CONFIG_CUSTOM_TRANSPORT_MTU;
+			}
+
+#endif
+			const uint32_t batch_bytes = _param_uxrce_dds_btch_b.get();
+			_subs->batch_max_bytes = (batch_bytes > 0) ? math::min(batch_bytes, mtu) : mtu;
+		}
+
 		while (!should_exit() && _connected) {
 			perf_begin(_loop_perf);
 			perf_count(_loop_interval_perf);
 
-			int orb_poll_timeout_ms = 10;
+			uint32_t wait_timeout_us = 10_ms;
 
 			int bytes_available = 0;
 
-			if (ioctl(_fd, FIONREAD, (unsigned long)&bytes_available) == OK) {
-				if (bytes_available > 10) {
-					orb_poll_timeout_ms = 0;
-				}
+			if (ioctl(_fd, FIONREAD, (unsigned long)&bytes_available) != OK) {
+				bytes_available = 0;
 			}
 
-			/* Wait for topic updates for max 10 ms */
-			int poll = px4_poll(_subs->fds, (sizeof(_subs->fds) / sizeof(_subs->fds[0])), orb_poll_timeout_ms);
+#if defined(UXRCE_DDS_CLIENT_SHM)
 
-			/* Handle the poll results */
-			if (poll > 0) {
-				_subs->update(&session, _reliable_out, _best_effort_out, _participant_id, _client_namespace);
+			if (_transport_shm != nullptr) {
+				bytes_available = _transport_shm->bytes_available();
+			}
 
-			} else {
-				if (poll < 0) {
-					// poll error
-					if (poll_error_counter < 10 || poll_error_counter % 50 == 0) {
-						// prevent flooding
-						PX4_ERR("ERROR while polling uorbs: %d", poll);
-					}
+#endif // UXRCE_DDS_CLIENT_SHM
 
-					poll_error_counter++;
-				}
+			if (bytes_available > 10) {
+				wait_timeout_us = 0;
+			}
+
+			if (_subs->batch_pending_bytes > 0) {
+				// do not hold back pending data longer than the batching delay
+				const hrt_abstime batch_elapsed = hrt_elapsed_time(&_subs->batch_start);
+				const uint32_t batch_remaining_us = (batch_elapsed < batch_max_delay) ? batch_max_delay - batch_elapsed : 0;
+				wait_timeout_us = math::min(wait_timeout_us, batch_remaining_us);
+			}
+
+			/* Wait for topic updates for max 10 ms, then only visit the updated topics */
+			if (_subs->wait_ready(wait_timeout_us)) {
+				_subs->update(&session, _reliable_out, _best_effort_out, _participant_id, _client_namespace);
 			}
 
-			// run session with 0 timeout (non-blocking)
-			uxr_run_session_timeout(&session, 0);
+			// send the batch when full or due, or early if there is incoming data to process
+			if (_subs->batch_due(hrt_absolute_time(), batch_max_delay)
+			    || (_subs->batch_pending_bytes > 0 && bytes_available > 0)) {
+				_subs->flush(&session);
+			}
+
+			// run session with 0 timeout (non-blocking), this flushes the output streams as well,
+			// so it's deferred while a batch is pending
+			if (_subs->batch_pending_bytes == 0) {
+				uxr_run_session_timeout(&session, 0);
+			}
 
 			// check if there are available replies
 			process_replies();
 
-			// time sync session
-			if (_synchronize_timestamps && hrt_elapsed_time(&last_sync_session) > 1_s) {
+			// time sync session: the request is sent without waiting for the reply, so that the data path is not blocked.
+			// The reply is handled by uxr_run_session_timeout() (on_time()), which sets session.synchronized.
+			if (_synchronize_timestamps) {
+				if (sync_request_pending && session.synchronized) {
+					sync_request_pending = false;
 
-				if (uxr_sync_session(&session, 10) && _timesync.sync_converged()) {
-					//PX4_INFO("synchronized with time offset %-5" PRId64 "ns", session.time_offset);
-					last_sync_session = hrt_absolute_time();
+					if (_timesync.sync_converged()) {
+						//PX4_INFO("synchronized with time offset %-5" PRId64 "ns", session.time_offset);
+						last_sync_session = hrt_absolute_time();
 
-					if (_param_uxrce_dds_syncc.get() > 0) {
-						syncSystemClock(&session);
+						if (_param_uxrce_dds_syncc.get() > 0) {
+							syncSystemClock(&session);
+						}
 					}
-				}
 
-				if (!_timesync_converged && _timesync.sync_converged()) {
-					PX4_INFO("time sync converged");
+					if (!_timesync_converged && _timesync.sync_converged()) {
+						PX4_INFO("time sync converged");
 
-				} else if (_timesync_converged && !_timesync.sync_converged()) {
-					PX4_WARN("time sync no longer converged");
+					} else if (_timesync_converged && !_timesync.sync_converged()) {
+						PX4_WARN("time sync no longer converged");
+					}
+
+					_timesync_converged = _timesync.sync_converged();
 				}
 
-				_timesync_converged = _timesync.sync_converged();
+				// retry faster until converged
+				const hrt_abstime sync_interval = (hrt_elapsed_time(&last_sync_session) > 1_s) ? 100_ms : 1_s;
+
+				if (hrt_elapsed_time(&last_sync_request) > sync_interval) {
+					session.synchronized = false;
+					uxr_sync_session(&session, 0);
+					sync_request_pending = true;
+					last_sync_request = hrt_absolute_time();
+				}
 			}
 
 			handleMessageFormatRequest();
+			handleTopicRateLimitRequest();
 
 			// Check for a ping response
 			/* PONG_IN_SESSION_STATUS */
@@ -638,6 +737,8 @@ void UxrceddsClient::run()
 				float dt = (now - last_status_update) / 1e6f;
 				_last_payload_tx_rate = (_subs->num_payload_sent - last_num_payload_sent) / dt;
 				_last_payload_rx_rate = (_pubs->num_payload_received - last_num_payload_received) / dt;
+				_last_frame_tx_rate = (_subs->num_frames_sent - last_num_frames_sent) / dt;
+				last_num_frames_sent = _subs->num_frames_sent;
 				last_num_payload_sent = _subs->num_payload_sent;
 				last_num_payload_received = _pubs->num_payload_received;
 				last_status_update = now;
@@ -660,7 +761,8 @@ void UxrceddsClient::run()
 						++num_pings_missed;
 					}
 
-					int timeout_ms = 1'000; // 1 second
+					// don't wait for the reply, session.on_pong_flag is checked above
+					int timeout_ms = 0;
 					uint8_t attempts = 1;
 					uxr_ping_agent_session(&session, timeout_ms, attempts);
 
@@ -901,9 +1003,19 @@ int UxrceddsClient::print_status()
 		PX4_INFO("Using transport:     serial");
 	}
 
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+	if (_transport_shm != nullptr) {
+		PX4_INFO("Using transport:     shared memory (%s)", _transport_shm->name());
+	}
+
+#endif
+
 	if (_connected) {
 		PX4_INFO("Payload tx:          %i B/s", _last_payload_tx_rate);
 		PX4_INFO("Payload rx:          %i B/s", _last_payload_rx_rate);
+		PX4_INFO("Frames tx:           %i /s (%i B/frame)", _last_frame_tx_rate,
+			 _last_frame_tx_rate > 0 ? _last_payload_tx_rate / _last_frame_tx_rate : 0);
 	}
 
 	PX4_INFO("timesync converged: %s", _timesync.sync_converged() ? "true" : "false");
@@ -943,6 +1055,12 @@ UxrceddsClient *UxrceddsClient::instantiate(int argc, char *argv[])
 			} else if (!strcmp(myoptarg, "udp")) {
 				transport = Transport::Udp;
 
+#if defined(UXRCE_DDS_CLIENT_SHM)
+
+			} else if (!strcmp(myoptarg, "shm")) {
+				transport = Transport::Shm;
+#endif // UXRCE_DDS_CLIENT_SHM
+
 			} else {
 				PX4_ERR("unknown transport: %s", myoptarg);
 				error_flag = true;
@@ -1040,15 +1158,20 @@ int UxrceddsClient::print_usage(const char *reason)
 ### Description
 UXRCE-DDS Client used to communicate uORB topics with an Agent over serial or UDP.
 
+On Linux an Agent running on the same host can also be connected through shared memory (`-t shm`), which avoids the
+socket syscalls and kernel copies of UDP loopback. The Agent needs a custom transport for the segment layout
+described in shm_transport.h.
+
 ### Examples
 $ uxrce_dds_client start -t serial -d /dev/ttyS3 -b 921600
 $ uxrce_dds_client start -t udp -h 127.0.0.1 -p 15555
+$ uxrce_dds_client start -t shm -d /px4_uxrce_dds
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("uxrce_dds_client", "system");
 	PRINT_MODULE_USAGE_COMMAND("start");
-	PRINT_MODULE_USAGE_PARAM_STRING('t', "udp", "serial|udp", "Transport protocol", true);
-	PRINT_MODULE_USAGE_PARAM_STRING('d', nullptr, "<file:dev>", "serial device", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('t', "udp", "serial|udp|shm", "Transport protocol", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('d', nullptr, "<file:dev>", "serial device, or shared memory name (default /px4_uxrce_dds)", true);
 	PRINT_MODULE_USAGE_PARAM_INT('b', 0, 0, 3000000, "Baudrate (can also be p:<param_name>)", true);
 	PRINT_MODULE_USAGE_PARAM_STRING('h', nullptr, "<IP>", "Agent IP. If not provided, defaults to UXRCE_DDS_AG_IP", true);
 	PRINT_MODULE_USAGE_PARAM_INT('p', -1, 0, 65535, "Agent listening port. If not provided, defaults to UXRCE_DDS_PRT", true);
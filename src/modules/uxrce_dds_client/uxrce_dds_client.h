@@ -38,6 +38,7 @@
 
 #include <src/modules/uxrce_dds_client/dds_topics.h>
 
+#include <uORB/topics/dds_topic_rate_limit.h>
 #include <uORB/topics/message_format_request.h>
 #include <uORB/topics/message_format_response.h>
 #include <uORB/Subscription.hpp>
@@ -50,6 +51,7 @@
 # define UXRCE_DDS_CLIENT_UDP 1
 #endif
 
+#include "shm_transport.h"
 #include "srv_base.h"
 
 #define MAX_NUM_REPLIERS 5
@@ -61,7 +63,8 @@ class UxrceddsClient : public ModuleBase<UxrceddsClient>, public ModuleParams
 public:
 	enum class Transport {
 		Serial,
-		Udp
+		Udp,
+		Shm
 	};
 
 	UxrceddsClient(Transport transport, const char *device, int baudrate, const char *host, const char *port,
@@ -127,8 +130,14 @@ private:
 
 	void handleMessageFormatRequest();
 
+	/**
+	 * Apply rate limit changes of bridged topics, requested via /fmu/in/dds_topic_rate_limit
+	 */
+	void handleTopicRateLimitRequest();
+
 	uORB::Publication<message_format_response_s> _message_format_response_pub{ORB_ID(message_format_response)};
 	uORB::Subscription _message_format_request_sub{ORB_ID(message_format_request)};
+	uORB::Subscription _dds_topic_rate_limit_sub{ORB_ID(dds_topic_rate_limit)};
 
 	/** Synchronizes the system clock if the time is off by more than 5 seconds */
 	void syncSystemClock(uxrSession *session);
@@ -161,6 +170,10 @@ private:
 	uxrUDPTransport *_transport_udp{nullptr};
 #endif // UXRCE_DDS_CLIENT_UDP
 
+#if defined(UXRCE_DDS_CLIENT_SHM)
+	UxrceddsShmTransport *_transport_shm {nullptr};
+#endif // UXRCE_DDS_CLIENT_SHM
+
 	SendTopicsSubs *_subs{nullptr};
 	RcvTopicsPubs *_pubs{nullptr};
 
@@ -181,6 +194,7 @@ private:
 
 	int _last_payload_tx_rate{}; ///< in B/s
 	int _last_payload_rx_rate{}; ///< in B/s
+	int _last_frame_tx_rate{}; ///< best-effort frames with data per second
 
 	bool _connected{false};
 	bool _session_created{false};
@@ -197,6 +211,8 @@ private:
 		(ParamInt<px4::params::UXRCE_DDS_KEY>) _param_uxrce_key,
 		(ParamInt<px4::params::UXRCE_DDS_PTCFG>) _param_uxrce_dds_ptcfg,
 		(ParamInt<px4::params::UXRCE_DDS_SYNCC>) _param_uxrce_dds_syncc,
-		(ParamInt<px4::params::UXRCE_DDS_SYNCT>) _param_uxrce_dds_synct
+		(ParamInt<px4::params::UXRCE_DDS_SYNCT>) _param_uxrce_dds_synct,
+		(ParamInt<px4::params::UXRCE_DDS_BTCH_T>) _param_uxrce_dds_btch_t,
+		(ParamInt<px4::params::UXRCE_DDS_BTCH_B>) _param_uxrce_dds_btch_b
 	)
 };
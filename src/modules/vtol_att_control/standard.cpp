@@ -51,6 +51,7 @@ using namespace matrix;
 Standard::Standard(VtolAttitudeControl *attc) :
 	VtolType(attc)
 {
+	parameters_update();
 }
 
 void
@@ -60,6 +61,11 @@ Standard::parameters_update()
 
 	// make sure that pusher ramp in backtransition is smaller than back transition (max) duration
 	_param_vt_b_trans_ramp.set(math::min(_param_vt_b_trans_ramp.get(), _param_vt_b_trans_dur.get()));
+
+	updateTransitionSchedule();
+
+	_airspeed_trans_blend_margin = getTransitionAirspeed() - getBlendAirspeed();
+	_pitch_offset_fw = math::radians(_param_fw_psp_off.get());
 }
 
 void Standard::update_vtol_state()
@@ -212,8 +218,6 @@ void Standard::update_transition_state()
 			_last_time_pusher_transition_update = now;
 		}
 
-		_airspeed_trans_blend_margin = getTransitionAirspeed() - getBlendAirspeed();
-
 		// do blending of mc and fw controls if a blending airspeed has been provided and the minimum transition time has passed
 		if (_airspeed_trans_blend_margin > 0.0f &&
 		    PX4_ISFINITE(_airspeed_validated->calibrated_airspeed_m_s) &&
@@ -232,7 +236,7 @@ void Standard::update_transition_state()
 		}
 
 		// ramp up FW_PSP_OFF
-		pitch_body = math::radians(_param_fw_psp_off.get()) * (1.0f - mc_weight);
+		pitch_body = _pitch_offset_fw * (1.0f - mc_weight);
 		_v_att_sp->thrust_body[0] = _pusher_throttle;
 		const Quatf q_sp(Eulerf(roll_body, pitch_body, yaw_body));
 		q_sp.copyTo(_v_att_sp->q_d);
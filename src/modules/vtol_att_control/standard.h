@@ -76,6 +76,7 @@ private:
 
 	float _pusher_throttle{0.0f};
 	float _airspeed_trans_blend_margin{0.0f};
+	float _pitch_offset_fw{0.0f};	// [rad] FW_PSP_OFF
 	hrt_abstime _last_time_pusher_transition_update{0};
 
 	void parameters_update() override;
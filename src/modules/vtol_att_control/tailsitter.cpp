@@ -47,6 +47,7 @@ using namespace matrix;
 Tailsitter::Tailsitter(VtolAttitudeControl *attc) :
 	VtolType(attc)
 {
+	parameters_update();
 }
 
 void
@@ -54,6 +55,12 @@ Tailsitter::parameters_update()
 {
 	VtolType::updateParams();
 
+	updateTransitionSchedule();
+
+	// pitching rates, constrained to at least 0.1s transition time
+	_front_trans_pitch_rate = M_PI_2_F / math::max(_param_vt_f_trans_dur.get(), 0.1f);
+	_back_trans_pitch_rate = M_PI_2_F / math::max(_param_vt_b_trans_dur.get(), 0.1f);
+	_front_trans_tilt_max = M_PI_2_F - math::radians(_param_fw_psp_off.get());
 }
 
 void Tailsitter::update_vtol_state()
@@ -211,22 +218,16 @@ void Tailsitter::update_transition_state()
 
 	if (_vtol_mode == vtol_mode::TRANSITION_FRONT_P1) {
 
-		// calculate pitching rate - and constrain to at least 0.1s transition time
-		const float trans_pitch_rate = M_PI_2_F / math::max(_param_vt_f_trans_dur.get(), 0.1f);
-
-		if (tilt < M_PI_2_F - math::radians(_param_fw_psp_off.get())) {
+		if (tilt < _front_trans_tilt_max) {
 			_q_trans_sp = Quatf(AxisAnglef(_trans_rot_axis,
-						       _time_since_trans_start * trans_pitch_rate)) * _q_trans_start;
+						       _time_since_trans_start * _front_trans_pitch_rate)) * _q_trans_start;
 		}
 
 	} else if (_vtol_mode == vtol_mode::TRANSITION_BACK) {
 
-		// calculate pitching rate - and constrain to at least 0.1s transition time
-		const float trans_pitch_rate = M_PI_2_F / math::max(_param_vt_b_trans_dur.get(), 0.1f);
-
 		if (tilt > 0.01f) {
 			_q_trans_sp = Quatf(AxisAnglef(_trans_rot_axis,
-						       _time_since_trans_start * trans_pitch_rate)) * _q_trans_start;
+						       _time_since_trans_start * _back_trans_pitch_rate)) * _q_trans_start;
 		}
 	}
 
@@ -88,6 +88,10 @@ private:
 	matrix::Quatf _q_trans_sp;
 	matrix::Vector3f _trans_rot_axis;
 
+	float _front_trans_pitch_rate{0.f};	// [rad/s]
+	float _back_trans_pitch_rate{0.f};	// [rad/s]
+	float _front_trans_tilt_max{0.f};	// [rad] tilt at which the front transition pitching stops
+
 	void parameters_update() override;
 
 	bool isFrontTransitionCompletedBase() override;
@@ -51,12 +51,21 @@ using namespace matrix;
 Tiltrotor::Tiltrotor(VtolAttitudeControl *attc) :
 	VtolType(attc)
 {
+	parameters_update();
 }
 
 void
 Tiltrotor::parameters_update()
 {
 	VtolType::updateParams();
+
+	updateTransitionSchedule();
+
+	_front_trans_p1_tilt_rate = fabsf(_param_vt_tilt_trans.get() - _param_vt_tilt_mc.get()) /
+				    _param_vt_f_trans_dur.get();
+	_front_trans_p2_tilt_rate = fabsf(_param_vt_tilt_fw.get() - _param_vt_tilt_trans.get()) /
+				    _param_vt_trans_p2_dur.get();
+	_back_trans_tilt_dur = math::max(_param_vt_bt_tilt_dur.get(), 0.1f);
 }
 
 void Tiltrotor::update_vtol_state()
@@ -236,9 +245,7 @@ void Tiltrotor::update_transition_state()
 
 		// tilt rotors forward up to certain angle
 		if (_tilt_control <= _param_vt_tilt_trans.get()) {
-			const float ramped_up_tilt = _param_vt_tilt_mc.get() +
-						     fabsf(_param_vt_tilt_trans.get() - _param_vt_tilt_mc.get()) *
-						     _time_since_trans_start / _param_vt_f_trans_dur.get() ;
+			const float ramped_up_tilt = _param_vt_tilt_mc.get() + _front_trans_p1_tilt_rate * _time_since_trans_start;
 
 			// only allow increasing tilt (tilt in hover can already be non-zero)
 			_tilt_control = math::max(_tilt_control, ramped_up_tilt);
@@ -266,9 +273,8 @@ void Tiltrotor::update_transition_state()
 
 	} else if (_vtol_mode == vtol_mode::TRANSITION_FRONT_P2) {
 		// the plane is ready to go into fixed wing mode, tilt the rotors forward completely
-		_tilt_control = math::constrain(_param_vt_tilt_trans.get() +
-						fabsf(_param_vt_tilt_fw.get() - _param_vt_tilt_trans.get()) * _time_since_trans_start /
-						_param_vt_trans_p2_dur.get(), _param_vt_tilt_trans.get(), _param_vt_tilt_fw.get());
+		_tilt_control = math::constrain(_param_vt_tilt_trans.get() + _front_trans_p2_tilt_rate * _time_since_trans_start,
+						_param_vt_tilt_trans.get(), _param_vt_tilt_fw.get());
 
 		_mc_roll_weight = 0.0f;
 		_mc_yaw_weight = 0.0f;
@@ -285,8 +291,7 @@ void Tiltrotor::update_transition_state()
 		// tilt rotors back once motors are idle
 		if (_time_since_trans_start > BACKTRANS_THROTTLE_DOWNRAMP_DUR_S) {
 
-			float progress = (_time_since_trans_start - BACKTRANS_THROTTLE_DOWNRAMP_DUR_S) / math::max(_param_vt_bt_tilt_dur.get(),
-					 0.1f);
+			float progress = (_time_since_trans_start - BACKTRANS_THROTTLE_DOWNRAMP_DUR_S) / _back_trans_tilt_dur;
 			progress = math::constrain(progress, 0.0f, 1.0f);
 			_tilt_control = moveLinear(_param_vt_tilt_fw.get(), _param_vt_tilt_mc.get(), progress);
 		}
@@ -84,6 +84,10 @@ private:
 
 	float _tilt_control{0.0f};		/**< actuator value for the tilt servo */
 
+	float _front_trans_p1_tilt_rate{0.0f};	/**< tilt change per second in front transition part 1 */
+	float _front_trans_p2_tilt_rate{0.0f};	/**< tilt change per second in front transition part 2 */
+	float _back_trans_tilt_dur{0.1f};	/**< [s] duration of the back transition tilting */
+
 	void parameters_update() override;
 	float timeUntilMotorsAreUp();
 	float moveLinear(float start, float stop, float progress);
@@ -361,7 +361,7 @@ VtolAttitudeControl::Run()
 		vehicle_air_data_s air_data;
 
 		if (_vehicle_air_data_sub.update(&air_data)) {
-			_air_density = air_data.rho;
+			_vtol_type->updateAirDensity(air_data.rho);
 		}
 
 		_vtol_type->handleEkfResets();
@@ -50,7 +50,6 @@
 #pragma once
 
 #include <drivers/drv_hrt.h>
-#include <lib/atmosphere/atmosphere.h>
 #include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 #include <matrix/math.hpp>
@@ -120,7 +119,6 @@ public:
 
 	void reset_immediate_transition() {_immediate_transition = false;}
 
-	float getAirDensity() const { return _air_density; }
 
 	struct vehicle_torque_setpoint_s		*get_vehicle_torque_setpoint_virtual_mc() {return &_vehicle_torque_setpoint_virtual_mc;}
 	struct vehicle_torque_setpoint_s		*get_vehicle_torque_setpoint_virtual_fw() {return &_vehicle_torque_setpoint_virtual_fw;}
@@ -207,7 +205,6 @@ private:
 	vtol_vehicle_status_s 			_vtol_vehicle_status{};
 	float _home_position_z{NAN};
 
-	float _air_density{atmosphere::kAirDensitySeaLevelStandardAtmos};	// [kg/m^3]
 
 #if !defined(ENABLE_LOCKSTEP_SCHEDULER)
 	hrt_abstime _last_run_timestamp {0};
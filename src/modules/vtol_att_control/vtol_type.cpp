@@ -96,6 +96,48 @@ void VtolType::parameters_update()
 	_param_vt_arsp_trans.set(math::max(_param_vt_arsp_trans.get(), _param_vt_arsp_blend.get()));
 	// make sure that openloop transition time is above minimum time
 	_param_vt_f_tr_ol_tm.set(math::max(_param_vt_f_tr_ol_tm.get(), _param_vt_trans_min_tm.get()));
+
+	updateTransitionSchedule();
+}
+
+void VtolType::updateTransitionSchedule()
+{
+	updateFrontTransitionTimes();
+
+	// Since the stall airspeed increases with vehicle weight, we increase the transition airspeed
+	// by the same factor.
+	float weight_ratio = 1.0f;
+
+	if (_param_weight_base.get() > FLT_EPSILON && _param_weight_gross.get() > FLT_EPSILON) {
+		weight_ratio = math::constrain(_param_weight_gross.get() /
+					       _param_weight_base.get(), kMinWeightRatio, kMaxWeightRatio);
+	}
+
+	_transition_airspeed = sqrtf(weight_ratio) * _param_vt_arsp_trans.get();
+
+	_pitch_setpoint_min = math::radians(_param_vt_pitch_min.get());
+	_sin_pitch_setpoint_min = sinf(_pitch_setpoint_min);
+	_land_pitch_setpoint_min = math::radians(_param_vt_lnd_pitch_min.get());
+	_sin_land_pitch_setpoint_min = sinf(_land_pitch_setpoint_min);
+
+	_qc_pitch_max = fabsf(math::radians(static_cast<float>(_param_vt_fw_qc_p.get())));
+	_qc_roll_max = fabsf(math::radians(static_cast<float>(_param_vt_fw_qc_r.get())));
+}
+
+void VtolType::updateAirDensity(float rho)
+{
+	if (fabsf(rho - _air_density) > FLT_EPSILON) {
+		_air_density = rho;
+		updateFrontTransitionTimes();
+	}
+}
+
+void VtolType::updateFrontTransitionTimes()
+{
+	const float time_factor = computeFrontTransitionTimeFactor();
+	_front_trans_time_min = time_factor * _param_vt_trans_min_tm.get();
+	_front_trans_time_openloop = time_factor * _param_vt_f_tr_ol_tm.get();
+	_front_trans_timeout = time_factor * _param_vt_trans_timeout.get();
 }
 
 void VtolType::update_mc_state()
@@ -307,7 +349,7 @@ bool VtolType::isPitchExceeded()
 	if (_param_vt_fw_qc_p.get() > 0) {
 		Eulerf euler = Quatf(_v_att->q);
 
-		if (fabsf(euler.theta()) > fabsf(math::radians(static_cast<float>(_param_vt_fw_qc_p.get())))) {
+		if (fabsf(euler.theta()) > _qc_pitch_max) {
 			return true;
 		}
 	}
@@ -321,7 +363,7 @@ bool VtolType::isRollExceeded()
 	if (_param_vt_fw_qc_r.get() > 0) {
 		Eulerf euler = Quatf(_v_att->q);
 
-		if (fabsf(euler.phi()) > fabsf(math::radians(static_cast<float>(_param_vt_fw_qc_r.get())))) {
+		if (fabsf(euler.phi()) > _qc_roll_max) {
 			return true;
 		}
 	}
@@ -498,12 +540,14 @@ float VtolType::pusher_assist()
 	// normalized pusher support throttle (standard VTOL) or tilt (tiltrotor), initialize to 0
 	float forward_thrust = 0.0f;
 
-	float pitch_setpoint_min = math::radians(_param_vt_pitch_min.get());
+	float pitch_setpoint_min = _pitch_setpoint_min;
+	float sin_pitch_setpoint_min = _sin_pitch_setpoint_min;
 
 	if (_attc->get_pos_sp_triplet()->current.valid
 	    && _attc->get_pos_sp_triplet()->current.type == position_setpoint_s::SETPOINT_TYPE_LAND) {
-		pitch_setpoint_min = math::radians(
-					     _param_vt_lnd_pitch_min.get()); // set min pitch during LAND (usually lower to generate less lift)
+		// set min pitch during LAND (usually lower to generate less lift)
+		pitch_setpoint_min = _land_pitch_setpoint_min;
+		sin_pitch_setpoint_min = _sin_land_pitch_setpoint_min;
 	}
 
 	// only allow pitching down up to threshold, the rest of the desired
@@ -513,7 +557,7 @@ float VtolType::pusher_assist()
 		// desired roll angle in heading frame stays the same
 		const float roll_new = -asinf(body_z_sp(1));
 
-		forward_thrust = (sinf(pitch_setpoint_min) - sinf(pitch_setpoint)) * _param_vt_fwd_thrust_sc.get();
+		forward_thrust = (sin_pitch_setpoint_min - sinf(pitch_setpoint)) * _param_vt_fwd_thrust_sc.get();
 		// limit forward actuation to [0, 0.9]
 		forward_thrust = math::constrain(forward_thrust, 0.0f, 0.9f);
 
@@ -543,7 +587,7 @@ float VtolType::pusher_assist()
 
 }
 
-float VtolType::getFrontTransitionTimeFactor() const
+float VtolType::computeFrontTransitionTimeFactor() const
 {
 	// assumptions: transition_time = transition_true_airspeed / average_acceleration (thrust)
 	// transition_true_airspeed ~ sqrt(rho0 / rh0)
@@ -552,7 +596,7 @@ float VtolType::getFrontTransitionTimeFactor() const
 
 	// low value: hot day at 4000m AMSL with some margin
 	// high value: cold day at 0m AMSL with some margin
-	const float rho = math::constrain(_attc->getAirDensity(), 0.7f, 1.5f);
+	const float rho = math::constrain(_air_density, 0.7f, 1.5f);
 
 	if (PX4_ISFINITE(rho)) {
 		float rho0_over_rho = atmosphere::kAirDensitySeaLevelStandardAtmos / rho;
@@ -564,31 +608,22 @@ float VtolType::getFrontTransitionTimeFactor() const
 
 float VtolType::getMinimumFrontTransitionTime() const
 {
-	return getFrontTransitionTimeFactor() * _param_vt_trans_min_tm.get();
+	return _front_trans_time_min;
 }
 
 float VtolType::getFrontTransitionTimeout() const
 {
-	return getFrontTransitionTimeFactor() * _param_vt_trans_timeout.get();
+	return _front_trans_timeout;
 }
 
 float VtolType::getOpenLoopFrontTransitionTime() const
 {
-	return getFrontTransitionTimeFactor() * _param_vt_f_tr_ol_tm.get();
+	return _front_trans_time_openloop;
 }
+
 float VtolType::getTransitionAirspeed() const
 {
-	// Since the stall airspeed increases with vehicle weight, we increase the transition airspeed
-	// by the same factor.
-
-	float weight_ratio = 1.0f;
-
-	if (_param_weight_base.get() > FLT_EPSILON && _param_weight_gross.get() > FLT_EPSILON) {
-		weight_ratio = math::constrain(_param_weight_gross.get() /
-					       _param_weight_base.get(), kMinWeightRatio, kMaxWeightRatio);
-	}
-
-	return sqrtf(weight_ratio) * _param_vt_arsp_trans.get();
+	return _transition_airspeed;
 }
 
 float VtolType::getBlendAirspeed() const
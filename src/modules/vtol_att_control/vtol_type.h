@@ -44,6 +44,7 @@
 #define VTOL_TYPE_H
 
 #include <drivers/drv_hrt.h>
+#include <lib/atmosphere/atmosphere.h>
 #include <lib/mathlib/mathlib.h>
 #include <px4_platform_common/module_params.h>
 
@@ -251,6 +252,13 @@ public:
 
 	virtual void parameters_update() = 0;
 
+	/**
+	 * @brief Rescales the front transition times for a new air density.
+	 *
+	 * @param rho Air density [kg/m^3]
+	 */
+	void updateAirDensity(float rho);
+
 
 	/**
 	 * @brief Resets the transition timer states.
@@ -324,6 +332,24 @@ protected:
 
 	int _altitude_reset_counter{0};
 
+	/**
+	 * Precomputes the parameter and air density derived transition values, call after
+	 * the parameters of the derived type have been updated.
+	 */
+	void updateTransitionSchedule();
+
+	// transition schedule, updated on parameter and air density changes only
+	float _front_trans_time_min{0.f};		// [s]
+	float _front_trans_time_openloop{0.f};	// [s]
+	float _front_trans_timeout{0.f};		// [s]
+	float _transition_airspeed{0.f};		// [m/s]
+	float _pitch_setpoint_min{0.f};			// [rad]
+	float _sin_pitch_setpoint_min{0.f};
+	float _land_pitch_setpoint_min{0.f};	// [rad]
+	float _sin_land_pitch_setpoint_min{0.f};
+	float _qc_pitch_max{0.f};				// [rad]
+	float _qc_roll_max{0.f};				// [rad]
+
 	DEFINE_PARAMETERS_CUSTOM_PARENT(ModuleParams,
 					(ParamBool<px4::params::VT_ELEV_MC_LOCK>) _param_vt_elev_mc_lock,
 					(ParamFloat<px4::params::VT_FW_MIN_ALT>) _param_vt_fw_min_alt,
@@ -369,10 +395,14 @@ private:
 
 	void stopBlendingThrottleAfterFrontTransition() { _throttle_blend_start_ts = 0; }
 
+	float _air_density{atmosphere::kAirDensitySeaLevelStandardAtmos};	// [kg/m^3]
+
 	/**
 	 * @return Transition time scale factor for density.
 	*/
-	float getFrontTransitionTimeFactor() const;
+	float computeFrontTransitionTimeFactor() const;
+
+	void updateFrontTransitionTimes();
 
 };
 
@@ -42,6 +42,7 @@
 #pragma once
 
 #include "zenoh_publisher.hpp"
+#include "../zenoh_config.hpp"
 #include <uORB/Subscription.hpp>
 #include <dds_serializer.h>
 
@@ -60,9 +61,27 @@ public:
 
 	~uORB_Zenoh_Publisher() override = default;
 
+	void setOptions(const Zenoh_Topic_Options &options)
+	{
+		_raw = options.raw;
+
+		// update() runs on POLLIN, the subscription interval throttles it
+		if (options.rate_limit > 0) {
+			orb_set_interval(_uorb_sub, 1000 / options.rate_limit);
+		}
+	}
+
 	// Update the uORB Subscription and broadcast a Zenoh ROS2 message
 	virtual int8_t update() override
 	{
+		if (_raw) {
+			uint8_t buf[ZENOH_RAW_HEADER_SIZE + _uorb_meta->o_size];
+			memcpy(buf, zenoh_raw_magic, sizeof(zenoh_raw_magic));
+			memcpy(&buf[ZENOH_RAW_MAGIC_SIZE], &_uorb_meta->message_hash, sizeof(uint32_t));
+			orb_copy(_uorb_meta, _uorb_sub, &buf[ZENOH_RAW_HEADER_SIZE]);
+			return publish(buf, sizeof(buf));
+		}
+
 		uint8_t data[_uorb_meta->o_size];
 		orb_copy(_uorb_meta, _uorb_sub, data);
 
@@ -94,7 +113,7 @@ public:
 
 	void print()
 	{
-		printf("uORB %s -> ", _uorb_meta->o_name);
+		printf("uORB %s (%s) -> ", _uorb_meta->o_name, _raw ? "raw" : "cdr");
 		Zenoh_Publisher::print();
 	}
 
@@ -102,4 +121,5 @@ private:
 	const orb_metadata *_uorb_meta;
 	int _uorb_sub;
 	const uint32_t *_cdr_ops;
+	bool _raw{false};
 };
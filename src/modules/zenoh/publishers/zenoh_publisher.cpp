@@ -58,14 +58,20 @@ int Zenoh_Publisher::undeclare_publisher()
 	return 0;
 }
 
-int Zenoh_Publisher::declare_publisher(z_owned_session_t s, const char *keyexpr)
+int Zenoh_Publisher::declare_publisher(z_owned_session_t s, const char *keyexpr, bool express)
 {
 	strncpy(this->_topic, keyexpr, sizeof(this->_topic));
+	_express = express;
 
 	z_view_keyexpr_t ke;
 	z_view_keyexpr_from_str(&ke, this->_topic);
 
-	if (z_declare_publisher(&_pub, z_loan(s), z_loan(ke), NULL) < 0) {
+	// Express publications are sent right away instead of being batched with other messages
+	z_publisher_options_t options;
+	z_publisher_options_default(&options);
+	options.is_express = express;
+
+	if (z_declare_publisher(&_pub, z_loan(s), z_loan(ke), &options) < 0) {
 		printf("Unable to declare publisher for key expression!\n");
 		return -1;
 	}
@@ -86,10 +92,32 @@ int8_t Zenoh_Publisher::publish(const uint8_t *buf, int size)
 
 	z_owned_bytes_t payload;
 	z_bytes_serialize_from_slice(&payload, buf, size);
-	return z_publisher_put(z_loan(_pub), z_move(payload), &options);
+	int8_t ret = z_publisher_put(z_loan(_pub), z_move(payload), &options);
+
+	if (ret >= 0) {
+		_msgs_sent++;
+		_bytes_sent += size;
+	}
+
+	return ret;
 }
 
 void Zenoh_Publisher::print()
 {
-	printf("Topic: %s\n", this->_topic);
+	const hrt_abstime now = hrt_absolute_time();
+	const float dt = (_last_print != 0) ? (now - _last_print) * 1e-6f : 0.f;
+
+	printf("Topic: %s (%s)\n", this->_topic, _express ? "express" : "batched");
+
+	if (dt > 0.f) {
+		printf("\tsent: %" PRIu32 " msgs, %" PRIu64 " B, %.1f msgs/s, %.1f B/s\n", _msgs_sent, _bytes_sent,
+		       (double)((_msgs_sent - _last_print_msgs) / dt), (double)((_bytes_sent - _last_print_bytes) / dt));
+
+	} else {
+		printf("\tsent: %" PRIu32 " msgs, %" PRIu64 " B\n", _msgs_sent, _bytes_sent);
+	}
+
+	_last_print = now;
+	_last_print_msgs = _msgs_sent;
+	_last_print_bytes = _bytes_sent;
 }
@@ -44,6 +44,7 @@
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/log.h>
 
+#include <drivers/drv_hrt.h>
 #include <lib/parameters/param.h>
 #include <containers/List.hpp>
 #include <zenoh-pico.h>
@@ -54,7 +55,7 @@ public:
 	Zenoh_Publisher();
 	virtual ~Zenoh_Publisher();
 
-	virtual int declare_publisher(z_owned_session_t s, const char *keyexpr);
+	virtual int declare_publisher(z_owned_session_t s, const char *keyexpr, bool express = false);
 
 	virtual int undeclare_publisher();
 
@@ -66,5 +67,15 @@ protected:
 	int8_t publish(const uint8_t *, int size);
 
 	z_owned_publisher_t _pub;
+	bool _express{false};
+
+	uint32_t _msgs_sent{0};
+	uint64_t _bytes_sent{0};
+
+	// throughput since the previous print()
+	hrt_abstime _last_print{0};
+	uint32_t _last_print_msgs{0};
+	uint64_t _last_print_bytes{0};
+
 	char _topic[60]; // The Topic name is somewhere is the Zenoh stack as well but no good api to fetch it.
 };
@@ -60,6 +60,11 @@ public:
 
 	~uORB_Zenoh_Subscriber() override = default;
 
+	void setOptions(const Zenoh_Topic_Options &options) override
+	{
+		_raw = options.raw;
+	}
+
 	// Update the uORB Subscription and broadcast a Zenoh ROS2 message
 	void data_handler(const z_loaned_sample_t *sample)
 	{
@@ -68,6 +73,17 @@ public:
 		const z_loaned_bytes_t *payload = z_sample_payload(sample);
 		size_t len = z_bytes_len(payload);
 
+		if (_raw) {
+			if (!read_raw(payload, len, data)) {
+				_raw_rejected++;
+				return;
+			}
+
+			fix_timestamp(data);
+			orb_publish(_uorb_meta, _uorb_pub_handle, &data);
+			return;
+		}
+
 		dds_istream_t is = {.m_buffer = (unsigned char *)(payload), .m_size = static_cast<int>(len),
 				    .m_index = 4, .m_xcdr_version = DDSI_RTPS_CDR_ENC_VERSION_2
 				   };
@@ -93,7 +109,11 @@ public:
 
 	void print()
 	{
-		Zenoh_Subscriber::print("uORB", _uorb_meta->o_name);
+		Zenoh_Subscriber::print(_raw ? "uORB (raw)" : "uORB", _uorb_meta->o_name);
+
+		if (_raw_rejected > 0) {
+			printf("\trejected: %" PRIu32 " (size or message hash mismatch)\n", _raw_rejected);
+		}
 	}
 
 protected:
@@ -104,7 +124,38 @@ protected:
 	}
 
 private:
+	// Copy a raw uORB payload, rejected if it was published for a different message definition
+	bool read_raw(const z_loaned_bytes_t *payload, size_t len, char *data)
+	{
+		if (len != ZENOH_RAW_HEADER_SIZE + _uorb_meta->o_size) {
+			return false;
+		}
+
+		z_owned_slice_t slice;
+
+		if (z_bytes_deserialize_into_slice(payload, &slice) < 0) {
+			return false;
+		}
+
+		const uint8_t *buf = z_slice_data(z_loan(slice));
+		uint32_t message_hash;
+		memcpy(&message_hash, &buf[ZENOH_RAW_MAGIC_SIZE], sizeof(message_hash));
+
+		const bool valid = (z_slice_len(z_loan(slice)) == len)
+				   && (memcmp(buf, zenoh_raw_magic, sizeof(zenoh_raw_magic)) == 0)
+				   && (message_hash == _uorb_meta->message_hash);
+
+		if (valid) {
+			memcpy(data, &buf[ZENOH_RAW_HEADER_SIZE], _uorb_meta->o_size);
+		}
+
+		z_drop(z_move(slice));
+		return valid;
+	}
+
 	const orb_metadata *_uorb_meta;
 	orb_advert_t _uorb_pub_handle;
 	const uint32_t *_cdr_ops;
+	bool _raw{false};
+	uint32_t _raw_rejected{0};
 };
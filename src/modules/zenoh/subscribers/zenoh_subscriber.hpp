@@ -52,6 +52,8 @@
 #include <dds/cdr/dds_cdrstream.h>
 #include <dds_serializer.h>
 
+#include "../zenoh_config.hpp"
+
 class Zenoh_Subscriber : public ListNode<Zenoh_Subscriber *>
 {
 public:
@@ -64,6 +66,8 @@ public:
 
 	virtual void data_handler(const z_loaned_sample_t *sample);
 
+	virtual void setOptions(const Zenoh_Topic_Options &options) {}
+
 	virtual void print();
 
 protected:
@@ -122,12 +122,14 @@ void ZENOH::run()
 	{
 		char topic[TOPIC_INFO_SIZE];
 		char type[TOPIC_INFO_SIZE];
+		Zenoh_Topic_Options options;
 
 		for (i = 0; i < _sub_count; i++) {
-			z_config.getSubscriberMapping(topic, type);
+			z_config.getSubscriberMapping(topic, type, &options);
 			_zenoh_subscribers[i] = genSubscriber(type);
 
 			if (_zenoh_subscribers[i] != 0) {
+				_zenoh_subscribers[i]->setOptions(options);
 				_zenoh_subscribers[i]->declare_subscriber(s, topic);
 			}
 
@@ -149,13 +151,15 @@ void ZENOH::run()
 	{
 		char topic[TOPIC_INFO_SIZE];
 		char type[TOPIC_INFO_SIZE];
+		Zenoh_Topic_Options options;
 
 		for (i = 0; i < _pub_count; i++) {
-			z_config.getPublisherMapping(topic, type);
+			z_config.getPublisherMapping(topic, type, &options);
 			_zenoh_publishers[i] = genPublisher(type);
 
 			if (_zenoh_publishers[i] != 0) {
-				_zenoh_publishers[i]->declare_publisher(s, topic);
+				_zenoh_publishers[i]->setOptions(options);
+				_zenoh_publishers[i]->declare_publisher(s, topic, options.express);
 				_zenoh_publishers[i]->setPollFD(&pfds[i]);
 			}
 		}
@@ -179,6 +183,11 @@ void ZENOH::run()
 			//PX4_INFO("Zenoh poll timeout\n");
 
 		} else {
+#if defined(Z_FEATURE_BATCHING) && Z_FEATURE_BATCHING == 1
+			// Non-express publications of this poll cycle go out in as few transport frames as possible
+			zp_batch_start(z_loan(s));
+#endif
+
 			for (i = 0; i < _pub_count; i++) {
 				if (pfds[i].revents & POLLIN) {
 					ret = _zenoh_publishers[i]->update();
@@ -189,6 +198,10 @@ void ZENOH::run()
 					}
 				}
 			}
+
+#if defined(Z_FEATURE_BATCHING) && Z_FEATURE_BATCHING == 1
+			zp_batch_stop(z_loan(s));
+#endif
 		}
 	}
 
@@ -244,8 +257,13 @@ Zenoh demo bridge
 	PRINT_MODULE_USAGE_COMMAND("stop");
 	PRINT_MODULE_USAGE_COMMAND("status");
 	PRINT_MODULE_USAGE_COMMAND("config");
-	PX4_INFO_RAW("     addpublisher  <zenoh_topic> <uorb_topic>  Publish uORB topic to Zenoh\n");
-	PX4_INFO_RAW("     addsubscriber <zenoh_topic> <uorb_topic>  Publish Zenoh topic to uORB\n");
+	PX4_INFO_RAW("     addpublisher  <zenoh_topic> <uorb_topic> [rate] [express|batched] [cdr|raw]\n");
+	PX4_INFO_RAW("                                               Publish uORB topic to Zenoh\n");
+	PX4_INFO_RAW("          [rate]    maximum rate in Hz, 0 (default) publishes every update\n");
+	PX4_INFO_RAW("          [express] send right away instead of batching with other topics\n");
+	PX4_INFO_RAW("          [raw]     raw uORB encoding, only for links between PX4 instances\n");
+	PX4_INFO_RAW("     addsubscriber <zenoh_topic> <uorb_topic> [cdr|raw]\n");
+	PX4_INFO_RAW("                                               Publish Zenoh topic to uORB\n");
 	PX4_INFO_RAW("     net           <mode> <locator>            Zenoh network mode\n");
 	PX4_INFO_RAW("          <mode>    values: client|peer   \n");
 	PX4_INFO_RAW("          <locator> client: locator address e.g. tcp/10.41.10.1:7447#iface=eth0\n");
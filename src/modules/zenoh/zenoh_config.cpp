@@ -92,7 +92,7 @@ Zenoh_Config::~Zenoh_Config()
 	}
 }
 
-int Zenoh_Config::AddPubSub(char *topic, char *datatype, const char *filename)
+int Zenoh_Config::AddPubSub(char *topic, char *datatype, const char *filename, const Zenoh_Topic_Options &options)
 {
 	{
 		char f_topic[TOPIC_INFO_SIZE];
@@ -116,7 +116,8 @@ int Zenoh_Config::AddPubSub(char *topic, char *datatype, const char *filename)
 			FILE *fp = fopen(filename, "a");
 
 			if (fp) {
-				fprintf(fp, "%s;%s\n", topic, datatype);
+				fprintf(fp, "%s;%s;%u;%s;%s\n", topic, datatype, options.rate_limit, options.express ? "express" : "batched",
+					options.raw ? "raw" : "cdr");
 
 			} else {
 				return -1;
@@ -163,9 +164,14 @@ int Zenoh_Config::cli(int argc, char *argv[])
 			SetNetworkConfig(argv[2], 0);
 		}
 
-	} else if (argc == 4) {
+	} else if (argc >= 4) {
+		Zenoh_Topic_Options options;
+
 		if (strcmp(argv[1], "addpublisher") == 0) {
-			if (AddPubSub(argv[2], argv[3], ZENOH_PUB_CONFIG_PATH) > 0) {
+			if (parseTopicOptions(argc - 4, &argv[4], options) != 0) {
+				printf("Invalid publisher options\n");
+
+			} else if (AddPubSub(argv[2], argv[3], ZENOH_PUB_CONFIG_PATH, options) > 0) {
 				printf("Added %s %s to publishers\n", argv[2], argv[3]);
 
 			} else {
@@ -173,14 +179,17 @@ int Zenoh_Config::cli(int argc, char *argv[])
 			}
 
 		} else if (strcmp(argv[1], "addsubscriber") == 0) {
-			if (AddPubSub(argv[2], argv[3], ZENOH_SUB_CONFIG_PATH) > 0) {
+			if (parseTopicOptions(argc - 4, &argv[4], options) != 0 || options.rate_limit != 0 || options.express) {
+				printf("Invalid subscriber options\n");
+
+			} else if (AddPubSub(argv[2], argv[3], ZENOH_SUB_CONFIG_PATH, options) > 0) {
 				printf("Added %s -> uORB %s to subscribers\n", argv[2], argv[3]);
 
 			} else {
 				printf("Could not add %s -> uORB %s to subscribers\n",  argv[2], argv[3]);
 			}
 
-		} else if (strcmp(argv[1], "net") == 0) {
+		} else if (strcmp(argv[1], "net") == 0 && argc == 4) {
 			SetNetworkConfig(argv[2], argv[3]);
 		}
 	}
@@ -189,6 +198,36 @@ int Zenoh_Config::cli(int argc, char *argv[])
 	return 0;
 }
 
+int Zenoh_Config::parseTopicOptions(int argc, char *argv[], Zenoh_Topic_Options &options)
+{
+	for (int i = 0; i < argc; i++) {
+		if (strcmp(argv[i], "express") == 0) {
+			options.express = true;
+
+		} else if (strcmp(argv[i], "batched") == 0) {
+			options.express = false;
+
+		} else if (strcmp(argv[i], "raw") == 0) {
+			options.raw = true;
+
+		} else if (strcmp(argv[i], "cdr") == 0) {
+			options.raw = false;
+
+		} else {
+			char *end;
+			const long rate = strtol(argv[i], &end, 10);
+
+			if (*end != '\0' || rate < 0 || rate > UINT16_MAX) {
+				return -1;
+			}
+
+			options.rate_limit = rate;
+		}
+	}
+
+	return 0;
+}
+
 const char *Zenoh_Config::get_csv_field(char *line, int num)
 {
 	const char *tok;
@@ -262,7 +301,7 @@ int Zenoh_Config::getLineCount(const char *filename)
 }
 
 // Very rudamentary here but we've to wait for a more advanced param system
-int Zenoh_Config::getPubSubMapping(char *topic, char *type, const char *filename)
+int Zenoh_Config::getPubSubMapping(char *topic, char *type, const char *filename, Zenoh_Topic_Options *options)
 {
 	char buffer[MAX_LINE_SIZE];
 
@@ -273,11 +312,28 @@ int Zenoh_Config::getPubSubMapping(char *topic, char *type, const char *filename
 	if (fp_mapping) {
 		while (fgets(buffer, MAX_LINE_SIZE, fp_mapping) != NULL) {
 			if (buffer[0] != '\n') {
-				const char *config_type = get_csv_field(buffer, 2);
-				const char *config_topic = get_csv_field(buffer, 1);
+				// <topic>;<type>[;<rate limit>;<express|batched>;<raw|cdr>]
+				const char *fields[5] {};
+				int num_fields = 0;
+
+				for (char *tok = strtok(buffer, ";\n"); tok && num_fields < 5; tok = strtok(NULL, ";\n")) {
+					fields[num_fields++] = tok;
+				}
+
+				if (num_fields < 2) {
+					continue;
+				}
+
+				strncpy(topic, fields[0], TOPIC_INFO_SIZE);
+				strncpy(type, fields[1], TOPIC_INFO_SIZE);
+
+				if (options) {
+					*options = Zenoh_Topic_Options{};
+					options->rate_limit = fields[2] ? atoi(fields[2]) : 0;
+					options->express = fields[3] && strcmp(fields[3], "express") == 0;
+					options->raw = fields[4] && strcmp(fields[4], "raw") == 0;
+				}
 
-				strncpy(type, config_type, TOPIC_INFO_SIZE);
-				strncpy(topic, config_topic, TOPIC_INFO_SIZE);
 				return 1;
 			}
 
@@ -319,19 +375,23 @@ void Zenoh_Config::dump_config()
 	{
 		char topic[TOPIC_INFO_SIZE];
 		char type[TOPIC_INFO_SIZE];
+		Zenoh_Topic_Options options;
 
 		printf("Publisher config:\n");
 
-		while (getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH) > 0) {
+		while (getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH, &options) > 0) {
 			printf("Topic: %s\n", topic);
 			printf("Type: %s\n", type);
+			printf("Rate limit: %u Hz, %s, %s\n", options.rate_limit, options.express ? "express" : "batched",
+			       options.raw ? "raw" : "cdr");
 		}
 
 		printf("\nSubscriber config:\n");
 
-		while (getPubSubMapping(topic, type, ZENOH_SUB_CONFIG_PATH) > 0) {
+		while (getPubSubMapping(topic, type, ZENOH_SUB_CONFIG_PATH, &options) > 0) {
 			printf("Topic: %s\n", topic);
 			printf("Type: %s\n", type);
+			printf("Encoding: %s\n", options.raw ? "raw" : "cdr");
 		}
 	}
 }
@@ -58,7 +58,20 @@
 #define NET_LOCATOR_SIZE 64
 #define NET_CONFIG_LINE_SIZE NET_MODE_SIZE + NET_LOCATOR_SIZE
 #define TOPIC_INFO_SIZE 64
-#define MAX_LINE_SIZE 2*TOPIC_INFO_SIZE
+#define MAX_LINE_SIZE 2*TOPIC_INFO_SIZE + 32
+
+// Optional per-topic settings, the csv columns after <topic>;<type>
+struct Zenoh_Topic_Options {
+	uint16_t rate_limit{0};  ///< maximum publication rate [Hz], 0 = every update
+	bool express{false};     ///< send immediately instead of batching with other publications
+	bool raw{false};         ///< raw uORB encoding (PX4 to PX4 links only) instead of ROS2 CDR
+};
+
+// Raw uORB encoding: magic, version and orb_metadata::message_hash (little endian), followed by the uORB struct.
+// Only valid between PX4 instances built from the same message definitions and for the same architecture.
+#define ZENOH_RAW_MAGIC_SIZE 4
+static constexpr uint8_t zenoh_raw_magic[ZENOH_RAW_MAGIC_SIZE] {'P', 'X', '4', 1};
+#define ZENOH_RAW_HEADER_SIZE (ZENOH_RAW_MAGIC_SIZE + sizeof(uint32_t))
 
 class Zenoh_Config
 {
@@ -77,19 +90,20 @@ public:
 	{
 		return getLineCount(ZENOH_SUB_CONFIG_PATH);
 	}
-	int getPublisherMapping(char *topic, char *type)
+	int getPublisherMapping(char *topic, char *type, Zenoh_Topic_Options *options = nullptr)
 	{
-		return getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH);
+		return getPubSubMapping(topic, type, ZENOH_PUB_CONFIG_PATH, options);
 	}
-	int getSubscriberMapping(char *topic, char *type)
+	int getSubscriberMapping(char *topic, char *type, Zenoh_Topic_Options *options = nullptr)
 	{
-		return getPubSubMapping(topic, type, ZENOH_SUB_CONFIG_PATH);
+		return getPubSubMapping(topic, type, ZENOH_SUB_CONFIG_PATH, options);
 	}
 
 
 private:
-	int getPubSubMapping(char *topic, char *type, const char *filename);
-	int AddPubSub(char *topic, char *datatype, const char *filename);
+	int getPubSubMapping(char *topic, char *type, const char *filename, Zenoh_Topic_Options *options = nullptr);
+	int AddPubSub(char *topic, char *datatype, const char *filename, const Zenoh_Topic_Options &options);
+	int parseTopicOptions(int argc, char *argv[], Zenoh_Topic_Options &options);
 	int SetNetworkConfig(char *mode, char *locator);
 	int getLineCount(const char *filename);
 
@@ -0,0 +1,68 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file microbench.h
+ * Result reporting shared by the microbenchmarks.
+ */
+
+#pragma once
+
+#include <perf/perf_counter.h>
+
+namespace microbench
+{
+
+/**
+ * Enable the machine readable result lines, one per benchmark:
+ * MICROBENCH_RESULT {"board": ..., "suite": ..., "name": ..., "events": ..., "mean_us": ..., "ns_per_op": ...}
+ * These are parsed by test/sitl_benchmark/microbench_report.py.
+ */
+void set_json_output(bool enable);
+
+/**
+ * Name of the benchmark file that is running, reported as the suite of the results.
+ */
+void set_suite(const char *suite);
+
+/**
+ * Print the perf counter of a benchmark and, if enabled, its result line.
+ *
+ * @param perf elapsed time counter, one event per measured block
+ * @param name name of the benchmark, unique within the suite
+ * @param ops_per_event number of operations in a measured block
+ */
+void report(perf_counter_t perf, const char *name, unsigned ops_per_event = 1);
+
+} // namespace microbench
@@ -33,19 +33,30 @@
 
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/log.h>
+#include <lib/version/version.h>
 
 #include <stdio.h>
 #include <string.h>
 #include <fcntl.h>
 #include <errno.h>
 
+#include "microbench.h"
+
 __BEGIN_DECLS
 
 extern int test_microbench_atomic(int argc, char *argv[]);
+extern int test_microbench_control_allocation(int argc, char *argv[]);
+extern int test_microbench_crc(int argc, char *argv[]);
+extern int test_microbench_ekf(int argc, char *argv[]);
+extern int test_microbench_filter(int argc, char *argv[]);
+extern int test_microbench_geometry(int argc, char *argv[]);
+extern int test_microbench_file(int argc, char *argv[]);
 extern int test_microbench_hrt(int argc, char *argv[]);
 extern int test_microbench_math(int argc, char *argv[]);
 extern int test_microbench_matrix(int argc, char *argv[]);
+extern int test_microbench_param(int argc, char *argv[]);
 extern int test_microbench_uorb(int argc, char *argv[]);
+extern int test_microbench_work_queue(int argc, char *argv[]);
 
 __END_DECLS
 
@@ -64,18 +75,66 @@ const struct {
 	{"all",		microbench_all,		OPT_NOALLTEST},
 
 	{"microbench_atomic",	test_microbench_atomic,	0},
+#if defined(CONFIG_MODULES_CONTROL_ALLOCATOR)
+	{"microbench_control_allocation",	test_microbench_control_allocation,	0},
+#endif
+	{"microbench_crc",	test_microbench_crc,	0},
+#if defined(CONFIG_MODULES_EKF2)
+	{"microbench_ekf",	test_microbench_ekf,	0},
+#endif
+	{"microbench_file",	test_microbench_file,	0},
+	{"microbench_filter",	test_microbench_filter,	0},
+	{"microbench_geometry",	test_microbench_geometry,	0},
 	{"microbench_hrt",	test_microbench_hrt,	0},
 	{"microbench_math",	test_microbench_math,	0},
 	{"microbench_matrix",	test_microbench_matrix,	0},
+	{"microbench_param",	test_microbench_param,	0},
 	{"microbench_uorb",	test_microbench_uorb,	0},
+	{"microbench_work_queue",	test_microbench_work_queue,	0},
 
 	{"null",			nullptr, 		0}
 };
 
 #define NMICROBENCHMARKS (sizeof(microbenchmarks) / sizeof(microbenchmarks[0]))
 
+namespace microbench
+{
+
+static bool json_output = false;
+static const char *current_suite = "";
+
+void set_json_output(bool enable)
+{
+	json_output = enable;
+}
+
+void set_suite(const char *suite)
+{
+	current_suite = suite;
+}
+
+void report(perf_counter_t perf, const char *name, unsigned ops_per_event)
+{
+	perf_print_counter(perf);
+
+	if (json_output) {
+		const float mean_us = perf_mean(perf);
+		const float ns_per_op = (ops_per_event > 0) ? mean_us * 1000.f / ops_per_event : 0.f;
+
+		printf("MICROBENCH_RESULT {\"board\": \"%s\", \"suite\": \"%s\", \"name\": \"%s\", \"events\": %llu, "
+		       "\"mean_us\": %.4f, \"ns_per_op\": %.2f}\n",
+		       px4_board_name(), current_suite, name, (unsigned long long)perf_event_count(perf),
+		       (double)mean_us, (double)ns_per_op);
+		fflush(stdout);
+	}
+}
+
+} // namespace microbench
+
 static int microbench_help(int argc, char *argv[])
 {
+	printf("Usage: microbench [-j] <test>\n");
+	printf("  -j\tprint machine readable result lines (MICROBENCH_RESULT {...})\n\n");
 	printf("Available tests:\n");
 
 	for (int i = 0; microbenchmarks[i].name; i++) {
@@ -111,6 +170,8 @@ static int microbench_runner(unsigned option)
 			fflush(stdout);
 
 			/* Execute test */
+			microbench::set_suite(microbenchmarks[i].name);
+
 			if (microbenchmarks[i].fn(1, args) != 0) {
 				fprintf(stderr, "  [%s] \t\tFAIL\n", microbenchmarks[i].name);
 				fflush(stderr);
@@ -144,6 +205,16 @@ static int microbench_runner(unsigned option)
 
 extern "C" __EXPORT int microbench_main(int argc, char *argv[])
 {
+	// -j: print the results as machine readable lines as well
+	if (argc >= 2 && !strcmp(argv[1], "-j")) {
+		microbench::set_json_output(true);
+		argc--;
+		argv++;
+
+	} else {
+		microbench::set_json_output(false);
+	}
+
 	if (argc < 2) {
 		PX4_WARN("missing test name - 'microbench help' for a list of tests");
 		return 1;
@@ -151,6 +222,8 @@ extern "C" __EXPORT int microbench_main(int argc, char *argv[])
 
 	for (size_t i = 0; microbenchmarks[i].name; i++) {
 		if (!strcmp(microbenchmarks[i].name, argv[1])) {
+			microbench::set_suite(microbenchmarks[i].name);
+
 			if (microbenchmarks[i].fn(argc - 1, argv + 1) == 0) {
 				PX4_INFO("%s PASSED", microbenchmarks[i].name);
 				return 0;
@@ -38,6 +38,8 @@
 
 #include <unit_test.h>
 
+#include "microbench.h"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -68,7 +70,7 @@ namespace MicroBenchAtomic
 			unlock(); \
 			reset(); \
 		} \
-		perf_print_counter(p); \
+		microbench::report(p, name); \
 		perf_free(p); \
 	} while (0)
 
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_control_allocation.cpp
+ * Microbenchmark of the control allocation algorithms for a multicopter.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <ControlAllocation/ControlAllocationBoxQP.hpp>
+#include <ControlAllocation/ControlAllocationSequentialDesaturation.hpp>
+
+namespace MicroBenchControlAllocation
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			next_setpoint(i); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+		} \
+		microbench::report(p, name); \
+		perf_free(p); \
+	} while (0)
+
+using ActuatorVector = ControlAllocation::ActuatorVector;
+using EffectivenessMatrix = matrix::Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS>;
+
+// octocopter X (the allocation cost grows with the number of actuators)
+static constexpr int NUM_ROTORS = 8;
+
+class MicroBenchControlAllocation : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_sequential_desaturation();
+	bool time_box_qp();
+
+	void setup(ControlAllocation &allocation);
+	void next_setpoint(int i);
+
+	EffectivenessMatrix _effectiveness{};
+	matrix::Vector<float, ControlAllocation::NUM_AXES> _control_sp{};
+};
+
+bool MicroBenchControlAllocation::run_tests()
+{
+	for (int i = 0; i < NUM_ROTORS; i++) {
+		const float angle = M_TWOPI_F * (i + 0.5f) / NUM_ROTORS;
+		const float x = cosf(angle);
+		const float y = sinf(angle);
+		const float direction = (i % 2 == 0) ? 1.f : -1.f;
+
+		_effectiveness(ControlAllocation::ControlAxis::ROLL, i) = -y;
+		_effectiveness(ControlAllocation::ControlAxis::PITCH, i) = x;
+		_effectiveness(ControlAllocation::ControlAxis::YAW, i) = 0.05f * direction;
+		_effectiveness(ControlAllocation::ControlAxis::THRUST_Z, i) = -1.f;
+	}
+
+	ut_run_test(time_sequential_desaturation);
+	ut_run_test(time_box_qp);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_control_allocation, MicroBenchControlAllocation)
+
+void MicroBenchControlAllocation::setup(ControlAllocation &allocation)
+{
+	ActuatorVector actuator_min;
+	ActuatorVector actuator_max;
+
+	for (int i = 0; i < NUM_ROTORS; i++) {
+		actuator_max(i) = 1.f;
+	}
+
+	allocation.setEffectivenessMatrix(_effectiveness, ActuatorVector{}, ActuatorVector{}, NUM_ROTORS, true);
+	allocation.setActuatorMin(actuator_min);
+	allocation.setActuatorMax(actuator_max);
+}
+
+void MicroBenchControlAllocation::next_setpoint(int i)
+{
+	// sweep through setpoints that saturate some of the motors
+	const float phase = 0.01f * i;
+	_control_sp(ControlAllocation::ControlAxis::ROLL) = 0.6f * sinf(phase);
+	_control_sp(ControlAllocation::ControlAxis::PITCH) = 0.6f * cosf(phase);
+	_control_sp(ControlAllocation::ControlAxis::YAW) = 0.3f * sinf(3.f * phase);
+	_control_sp(ControlAllocation::ControlAxis::THRUST_Z) = -0.5f - 0.4f * sinf(0.5f * phase);
+}
+
+bool MicroBenchControlAllocation::time_sequential_desaturation()
+{
+	ControlAllocationSequentialDesaturation allocation;
+	setup(allocation);
+
+	PERF("ControlAllocationSequentialDesaturation allocate", allocation.setControlSetpoint(_control_sp);
+	     allocation.allocate(), 1000);
+
+	PERF("ControlAllocationPseudoInverse setEffectivenessMatrix",
+	     allocation.setEffectivenessMatrix(_effectiveness, ActuatorVector{}, ActuatorVector{}, NUM_ROTORS, true);
+	     allocation.allocate(), 100);
+
+	return true;
+}
+
+bool MicroBenchControlAllocation::time_box_qp()
+{
+	ControlAllocationBoxQP allocation;
+	setup(allocation);
+
+	PERF("ControlAllocationBoxQP allocate", allocation.setControlSetpoint(_control_sp); allocation.allocate(), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchControlAllocation
@@ -0,0 +1,126 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_crc.cpp
+ * Microbenchmark of the CRC implementations: bitwise, the byte table of
+ * crc32part(), px4_crc32() in software and with the CRC unit (if available),
+ * each over a 1 KiB buffer. The results are per byte.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <stdlib.h>
+
+#include <crc32.h>
+#include <drivers/drv_hrt.h>
+#include <lib/crc/crc.h>
+#include <lib/crc/px4_crc.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+namespace MicroBenchCrc
+{
+
+static constexpr size_t BUFFER_SIZE = 1024;
+static constexpr int REPETITIONS = 100;
+
+#define PERF(name, op) do { \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int rep = 0; rep < REPETITIONS; rep++) { \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+		} \
+		microbench::report(p, name, BUFFER_SIZE); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchCrc : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_crc32();
+	bool time_crc8();
+
+	uint8_t _buffer[BUFFER_SIZE];
+	volatile uint32_t _crc32{0};
+	volatile uint8_t _crc8{0};
+};
+
+bool MicroBenchCrc::run_tests()
+{
+	for (size_t i = 0; i < BUFFER_SIZE; i++) {
+		_buffer[i] = (uint8_t)rand();
+	}
+
+	ut_run_test(time_crc32);
+	ut_run_test(time_crc8);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_crc, MicroBenchCrc)
+
+bool MicroBenchCrc::time_crc32()
+{
+	const uint32_t expected = crc32part(_buffer, BUFFER_SIZE, 0);
+
+	ut_compare("px4_crc32 sw", px4_crc32_sw(0, _buffer, BUFFER_SIZE), expected);
+	ut_compare("px4_crc32", px4_crc32(0, _buffer, BUFFER_SIZE), expected);
+
+	PERF("crc32 bitwise (1 KiB)", _crc32 = crc32_signature(0, BUFFER_SIZE, _buffer));
+	PERF("crc32part (1 KiB)", _crc32 = crc32part(_buffer, BUFFER_SIZE, 0));
+	PERF("px4_crc32 sw (1 KiB)", _crc32 = px4_crc32_sw(0, _buffer, BUFFER_SIZE));
+
+	if (px4_crc32_hw_available()) {
+		PERF("px4_crc32 hw (1 KiB)", _crc32 = px4_crc32(0, _buffer, BUFFER_SIZE));
+	}
+
+	return true;
+}
+
+bool MicroBenchCrc::time_crc8()
+{
+	PERF("crc8 smbus (1 KiB)", _crc8 = px4_crc8_smbus(0, _buffer, BUFFER_SIZE));
+
+	return true;
+}
+
+} // namespace MicroBenchCrc
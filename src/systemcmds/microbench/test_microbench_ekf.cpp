@@ -0,0 +1,199 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_ekf.cpp
+ * Microbenchmark of the EKF update: prediction only and prediction with baro fusion.
+ * For the full sensor set and real data see ekf2_replay_benchmark.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <modules/ekf2/EKF/ekf.h>
+
+namespace MicroBenchEKF
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+static constexpr uint64_t IMU_INTERVAL_US = 1000;
+static constexpr uint64_t BARO_INTERVAL_US = 20000;
+
+class MicroBenchEKF : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_ekf_predict();
+	bool time_ekf_baro_fusion();
+
+	// feed one IMU sample and optionally a baro sample into the filter
+	void step(Ekf &ekf, bool baro);
+	void run(Ekf &ekf, const char *name, bool baro, int count);
+
+	uint64_t _time_us{0};
+};
+
+bool MicroBenchEKF::run_tests()
+{
+	ut_run_test(time_ekf_predict);
+	ut_run_test(time_ekf_baro_fusion);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_ekf, MicroBenchEKF)
+
+void MicroBenchEKF::step(Ekf &ekf, bool baro)
+{
+	_time_us += IMU_INTERVAL_US;
+
+	// at rest and level
+	imuSample imu_sample{};
+	imu_sample.time_us = _time_us;
+	imu_sample.delta_ang_dt = IMU_INTERVAL_US * 1e-6f;
+	imu_sample.delta_vel_dt = IMU_INTERVAL_US * 1e-6f;
+	imu_sample.delta_vel = matrix::Vector3f(0.f, 0.f, -CONSTANTS_ONE_G) * imu_sample.delta_vel_dt;
+	ekf.setIMUData(imu_sample);
+
+#if defined(CONFIG_EKF2_BAROMETER)
+
+	if (baro && (_time_us % BARO_INTERVAL_US == 0)) {
+		baroSample baro_sample{};
+		baro_sample.time_us = _time_us;
+		baro_sample.hgt = 100.f;
+		ekf.setBaroData(baro_sample);
+	}
+
+#endif // CONFIG_EKF2_BAROMETER
+}
+
+void MicroBenchEKF::run(Ekf &ekf, const char *name, bool baro, int count)
+{
+	perf_counter_t p = perf_alloc(PC_ELAPSED, name);
+
+	for (int i = 0; i < count; i++) {
+		step(ekf, baro);
+
+		if ((i % 100) == 0) {
+			px4_usleep(1);
+		}
+
+		lock();
+		perf_begin(p);
+		ekf.update();
+		perf_end(p);
+		unlock();
+	}
+
+	microbench::report(p, name);
+	perf_free(p);
+}
+
+bool MicroBenchEKF::time_ekf_predict()
+{
+	Ekf *ekf = new Ekf();
+
+	if (ekf == nullptr) {
+		return false;
+	}
+
+	_time_us = 0;
+	ekf->init(_time_us);
+
+	// tilt alignment
+	for (int i = 0; i < 2000; i++) {
+		step(*ekf, false);
+		ekf->update();
+	}
+
+	run(*ekf, "Ekf::update (predict)", false, 2000);
+
+	delete ekf;
+
+	return true;
+}
+
+bool MicroBenchEKF::time_ekf_baro_fusion()
+{
+#if defined(CONFIG_EKF2_BAROMETER)
+	Ekf *ekf = new Ekf();
+
+	if (ekf == nullptr) {
+		return false;
+	}
+
+	_time_us = 0;
+	ekf->init(_time_us);
+
+	// tilt alignment and baro height initialization
+	for (int i = 0; i < 2000; i++) {
+		step(*ekf, true);
+		ekf->update();
+	}
+
+	run(*ekf, "Ekf::update (predict and baro fusion at 50 Hz)", true, 2000);
+
+	delete ekf;
+#endif // CONFIG_EKF2_BAROMETER
+
+	return true;
+}
+
+} // namespace MicroBenchEKF
@@ -0,0 +1,148 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_file.cpp
+ * Microbenchmark of the file writes done by the logger: aligned 4 KiB chunks
+ * with a periodic fsync, to the log storage.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/micro_hal.h>
+#include <px4_platform_common/posix.h>
+
+namespace MicroBenchFile
+{
+
+static constexpr size_t CHUNK_SIZE = 4096; // LogWriterFile::_min_write_chunk
+static constexpr int NUM_CHUNKS = 256;
+static constexpr int FSYNC_INTERVAL = 100; // the logger syncs every 100 polls
+static const char *FILENAME = PX4_STORAGEDIR "/microbench_file.bin";
+
+class MicroBenchFile : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_logger_write();
+};
+
+bool MicroBenchFile::run_tests()
+{
+	ut_run_test(time_logger_write);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_file, MicroBenchFile)
+
+bool MicroBenchFile::time_logger_write()
+{
+	uint8_t *chunk = (uint8_t *)px4_cache_aligned_alloc(CHUNK_SIZE);
+
+	if (chunk == nullptr) {
+		PX4_ERR("alloc failed");
+		return false;
+	}
+
+	for (size_t i = 0; i < CHUNK_SIZE; i++) {
+		chunk[i] = (uint8_t)rand();
+	}
+
+	const int fd = ::open(FILENAME, O_CREAT | O_WRONLY | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("can't open %s (%i)", FILENAME, errno);
+		free(chunk);
+		return false;
+	}
+
+	perf_counter_t write_perf = perf_alloc(PC_ELAPSED, "logger write 4 KiB");
+	perf_counter_t fsync_perf = perf_alloc(PC_ELAPSED, "logger fsync");
+	bool ok = true;
+
+	const hrt_abstime start = hrt_absolute_time();
+
+	for (int i = 0; i < NUM_CHUNKS && ok; i++) {
+		perf_begin(write_perf);
+		ok = (::write(fd, chunk, CHUNK_SIZE) == (ssize_t)CHUNK_SIZE);
+		perf_end(write_perf);
+
+		if ((i % FSYNC_INTERVAL) == FSYNC_INTERVAL - 1) {
+			perf_begin(fsync_perf);
+			::fsync(fd);
+			perf_end(fsync_perf);
+		}
+	}
+
+	perf_begin(fsync_perf);
+	::fsync(fd);
+	perf_end(fsync_perf);
+
+	const float elapsed_s = hrt_elapsed_time(&start) * 1e-6f;
+
+	::close(fd);
+	::unlink(FILENAME);
+	free(chunk);
+
+	if (ok) {
+		microbench::report(write_perf, "logger write 4 KiB");
+		microbench::report(fsync_perf, "logger fsync");
+		printf("%.1f KiB/s\n", (double)(NUM_CHUNKS * CHUNK_SIZE / 1024.f / elapsed_s));
+
+	} else {
+		PX4_ERR("write failed (%i)", errno);
+	}
+
+	perf_free(write_perf);
+	perf_free(fsync_perf);
+
+	return ok;
+}
+
+} // namespace MicroBenchFile
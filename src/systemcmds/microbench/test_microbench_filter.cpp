@@ -0,0 +1,194 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_filter.cpp
+ * Microbenchmark of the gyro filter chain (notch and low-pass filters).
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/mathlib/math/filter/LowPassFilter2p.hpp>
+#include <lib/mathlib/math/filter/NotchFilter.hpp>
+
+namespace MicroBenchFilter
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int rep = 0; rep < 10; rep++) { \
+			px4_usleep(1000); \
+			lock(); \
+			perf_begin(p); \
+			for (int i = 0; i < (count)/10; i++) { \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+			} \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		microbench::report(p, name, (count) / 10 * 10); \
+		perf_free(p); \
+	} while (0)
+
+// 8 kHz gyro FIFO processed at 1 kHz, 8 ESCs with 3 RPM harmonics each and two static notches
+static constexpr int NUM_SAMPLES = 8;
+static constexpr int NUM_NOTCH = 8 * 3 + 2;
+
+class MicroBenchFilter : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_gyro_filter_chain();
+
+	void reset();
+
+	void filterPerAxis();
+	void filterInterleaved();
+
+	math::NotchFilter<float> _notch[3][NUM_NOTCH] {};
+	math::LowPassFilter2p<float> _lp[3] {};
+
+	float _data[3][NUM_SAMPLES] {};
+};
+
+bool MicroBenchFilter::run_tests()
+{
+	ut_run_test(time_gyro_filter_chain);
+
+	return (_tests_failed == 0);
+}
+
+template<typename T>
+T random(T min, T max)
+{
+	const T scale = rand() / (T) RAND_MAX; /* [0, 1.0] */
+	return min + scale * (max - min);      /* [min, max] */
+}
+
+void MicroBenchFilter::reset()
+{
+	srand(time(nullptr));
+
+	for (int axis = 0; axis < 3; axis++) {
+		for (int i = 0; i < NUM_NOTCH; i++) {
+			_notch[axis][i].setParameters(8000.f, random(80.f, 800.f), 20.f);
+		}
+
+		_lp[axis].set_cutoff_frequency(8000.f, 40.f);
+
+		for (int n = 0; n < NUM_SAMPLES; n++) {
+			_data[axis][n] = random(-1.f, 1.f);
+		}
+	}
+}
+
+void MicroBenchFilter::filterPerAxis()
+{
+	for (int axis = 0; axis < 3; axis++) {
+		for (int i = 0; i < NUM_NOTCH; i++) {
+			if (_notch[axis][i].getNotchFreq() > 0.f) {
+				_notch[axis][i].applyArray(_data[axis], NUM_SAMPLES);
+			}
+		}
+
+		_lp[axis].applyArray(_data[axis], NUM_SAMPLES);
+	}
+}
+
+void MicroBenchFilter::filterInterleaved()
+{
+	float *const data[3] {_data[0], _data[1], _data[2]};
+
+	for (int i = 0; i < NUM_NOTCH; i++) {
+		math::NotchFilter<float> *const nf[3] {&_notch[0][i], &_notch[1][i], &_notch[2][i]};
+		math::NotchFilter<float>::applyArray3(nf, data, NUM_SAMPLES);
+	}
+
+	math::LowPassFilter2p<float> *const lp[3] {&_lp[0], &_lp[1], &_lp[2]};
+	math::LowPassFilter2p<float>::applyArray3(lp, data, NUM_SAMPLES);
+}
+
+bool MicroBenchFilter::time_gyro_filter_chain()
+{
+	PERF("gyro filter chain 26 notch + lpf, 3 axes x 8 samples, per axis", filterPerAxis(), 1000);
+	PERF("gyro filter chain 26 notch + lpf, 3 axes x 8 samples, interleaved axes", filterInterleaved(), 1000);
+	return true;
+}
+
+ut_declare_test_c(test_microbench_filter, MicroBenchFilter)
+
+} // namespace MicroBenchFilter
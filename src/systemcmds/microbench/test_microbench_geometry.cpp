@@ -0,0 +1,297 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_geometry.cpp
+ * Microbenchmarks of the geometry kernels used by the geofence and collision prevention.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <float.h>
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+
+#include <drivers/drv_hrt.h>
+#include <lib/geo/geometry_kernels.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+namespace MicroBenchGeometry
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int rep = 0; rep < 10; rep++) { \
+			px4_usleep(1000); \
+			lock(); \
+			perf_begin(p); \
+			for (int i = 0; i < (count)/10; i++) { \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+				op; \
+			} \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		microbench::report(p, name, (count) / 10 * 10); \
+		perf_free(p); \
+	} while (0)
+
+static constexpr int VERTEX_COUNT = 64;
+static constexpr int BIN_COUNT = 72;
+
+class MicroBenchGeometry : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	bool time_point_in_polygon();
+	bool time_segment_intersection();
+	bool time_bin_directions();
+
+	void reset();
+
+	bool insidePolygonDivision();
+	bool segmentIntersectionsDivision();
+	bool segmentIntersectionsKernel();
+	float binDirectionsTrig();
+	float binDirectionsRotation();
+
+	double _lat[VERTEX_COUNT];
+	double _lon[VERTEX_COUNT];
+	float _bin_cos[BIN_COUNT];
+	float _bin_sin[BIN_COUNT];
+	uint16_t _distances[BIN_COUNT];
+
+	volatile double _point_lat;
+	volatile double _point_lon;
+	volatile float _yaw;
+
+	volatile bool _inside;
+	volatile float _out;
+	volatile int _index;
+};
+
+bool MicroBenchGeometry::run_tests()
+{
+	ut_run_test(time_point_in_polygon);
+	ut_run_test(time_segment_intersection);
+	ut_run_test(time_bin_directions);
+
+	return (_tests_failed == 0);
+}
+
+template<typename T>
+T random(T min, T max)
+{
+	const T scale = rand() / (T) RAND_MAX; /* [0, 1.0] */
+	return min + scale * (max - min);      /* [min, max] */
+}
+
+void MicroBenchGeometry::reset()
+{
+	srand(time(nullptr));
+
+	// star shaped polygon of about 100 m around a random center
+	const double center_lat = random(-60.0, 60.0);
+	const double center_lon = random(-180.0, 180.0);
+
+	for (int i = 0; i < VERTEX_COUNT; i++) {
+		const double angle = 2.0 * M_PI * i / VERTEX_COUNT;
+		const double radius = random(0.0005, 0.001);
+		_lat[i] = center_lat + radius * cos(angle);
+		_lon[i] = center_lon + radius * sin(angle);
+	}
+
+	_point_lat = center_lat + random(-0.001, 0.001);
+	_point_lon = center_lon + random(-0.001, 0.001);
+	_yaw = random(-M_PI_F, M_PI_F);
+
+	geometry::binDirections(_bin_cos, _bin_sin, BIN_COUNT, 2.f * M_PI_F / BIN_COUNT);
+
+	for (int i = 0; i < BIN_COUNT; i++) {
+		_distances[i] = rand();
+	}
+}
+
+ut_declare_test_c(test_microbench_geometry, MicroBenchGeometry)
+
+bool MicroBenchGeometry::insidePolygonDivision()
+{
+	const double lat = _point_lat;
+	const double lon = _point_lon;
+	bool c = false;
+
+	for (int i = 0, j = VERTEX_COUNT - 1; i < VERTEX_COUNT; j = i++) {
+		if ((_lon[i] >= lon) != (_lon[j] >= lon) &&
+		    (lat <= (_lat[j] - _lat[i]) * (lon - _lon[i]) / (_lon[j] - _lon[i]) + _lat[i])) {
+			c = !c;
+		}
+	}
+
+	return c;
+}
+
+bool MicroBenchGeometry::segmentIntersectionsDivision()
+{
+	const double d_lat = _point_lat - _lat[0];
+	const double d_lon = _point_lon - _lon[0];
+	bool intersects = false;
+
+	for (int i = 1, j = 0; i < VERTEX_COUNT; j = i++) {
+		const double e_lat = _lat[i] - _lat[j];
+		const double e_lon = _lon[i] - _lon[j];
+		const double denominator = d_lat * e_lon - d_lon * e_lat;
+
+		if (fabs(denominator) < DBL_EPSILON * DBL_EPSILON) {
+			continue;
+		}
+
+		const double a_lat = _lat[j] - _lat[0];
+		const double a_lon = _lon[j] - _lon[0];
+		const double t = (a_lat * e_lon - a_lon * e_lat) / denominator;
+		const double u = (a_lat * d_lon - a_lon * d_lat) / denominator;
+
+		intersects |= (t >= 0.0 && t <= 1.0 && u >= 0.0 && u <= 1.0);
+	}
+
+	return intersects;
+}
+
+bool MicroBenchGeometry::segmentIntersectionsKernel()
+{
+	const double d_lat = _point_lat - _lat[0];
+	const double d_lon = _point_lon - _lon[0];
+	bool intersects = false;
+
+	for (int i = 1, j = 0; i < VERTEX_COUNT; j = i++) {
+		double t;
+		intersects |= geometry::segmentIntersection(_lat[0], _lon[0], d_lat, d_lon, _lat[j], _lon[j],
+				_lat[i] - _lat[j], _lon[i] - _lon[j], DBL_EPSILON * DBL_EPSILON, t);
+	}
+
+	return intersects;
+}
+
+float MicroBenchGeometry::binDirectionsTrig()
+{
+	float sum = 0.f;
+
+	for (int i = 0; i < BIN_COUNT; i++) {
+		const float angle = _yaw + i * (2.f * M_PI_F / BIN_COUNT);
+		sum += _distances[i] * cosf(angle) + sinf(angle);
+	}
+
+	return sum;
+}
+
+float MicroBenchGeometry::binDirectionsRotation()
+{
+	const float yaw = _yaw;
+	const float cos_yaw = cosf(yaw);
+	const float sin_yaw = sinf(yaw);
+	float sum = 0.f;
+
+	for (int i = 0; i < BIN_COUNT; i++) {
+		float x;
+		float y;
+		geometry::rotateDirection(_bin_cos[i], _bin_sin[i], cos_yaw, sin_yaw, x, y);
+		sum += _distances[i] * x + y;
+	}
+
+	return sum;
+}
+
+bool MicroBenchGeometry::time_point_in_polygon()
+{
+	PERF("pnpoly 64 vertices division (1k ops)", _inside = insidePolygonDivision(), 1000);
+	PERF("pnpoly 64 vertices kernel (1k ops)", _inside = geometry::insidePolygon(_lat, _lon, VERTEX_COUNT, (double)_point_lat,
+			(double)_point_lon), 1000);
+
+	return true;
+}
+
+bool MicroBenchGeometry::time_segment_intersection()
+{
+	PERF("segment vs 63 edges inline (1k ops)", _inside = segmentIntersectionsDivision(), 1000);
+	PERF("segment vs 63 edges kernel (1k ops)", _inside = segmentIntersectionsKernel(), 1000);
+
+	return true;
+}
+
+bool MicroBenchGeometry::time_bin_directions()
+{
+	PERF("72 bin directions cosf/sinf (1k ops)", _out = binDirectionsTrig(), 1000);
+	PERF("72 bin directions rotation (1k ops)", _out = binDirectionsRotation(), 1000);
+	PERF("72 bin min index (1k ops)", _index = geometry::minIndex(_distances, BIN_COUNT), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchGeometry
@@ -38,6 +38,8 @@
 
 #include <unit_test.h>
 
+#include "microbench.h"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -82,7 +84,7 @@ void unlock()
 			unlock(); \
 			reset(); \
 		} \
-		perf_print_counter(p); \
+		microbench::report(p, name); \
 		perf_free(p); \
 	} while (0)
 
@@ -94,6 +96,7 @@ public:
 private:
 
 	bool time_px4_hrt();
+	bool time_hrt_call();
 
 	void reset();
 
@@ -118,6 +121,7 @@ private:
 bool MicroBenchHRT::run_tests()
 {
 	ut_run_test(time_px4_hrt);
+	ut_run_test(time_hrt_call);
 
 	return (_tests_failed == 0);
 }
@@ -148,4 +152,27 @@ bool MicroBenchHRT::time_px4_hrt()
 	return true;
 }
 
+bool MicroBenchHRT::time_hrt_call()
+{
+	// populate the callout queue so that entering and cancelling is measured on a non-trivial queue
+	static constexpr int QUEUED_CALLS = 64;
+	static struct hrt_call queued[QUEUED_CALLS] {};
+	static struct hrt_call probe {};
+
+	for (int i = 0; i < QUEUED_CALLS; i++) {
+		hrt_call_after(&queued[i], 1000000 + i * 1000, nullptr, nullptr);
+	}
+
+	PERF("hrt_call_after()", hrt_call_after(&probe, 500000 + (u_64 % 1000000), nullptr, nullptr), 1000);
+	PERF("hrt_cancel() + hrt_call_after()", hrt_cancel(&probe); hrt_call_after(&probe, 500000 + (u_64 % 1000000), nullptr, nullptr), 1000);
+
+	hrt_cancel(&probe);
+
+	for (int i = 0; i < QUEUED_CALLS; i++) {
+		hrt_cancel(&queued[i]);
+	}
+
+	return true;
+}
+
 } // namespace MicroBenchHRT
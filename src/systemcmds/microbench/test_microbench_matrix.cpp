@@ -38,6 +38,8 @@
 
 #include <unit_test.h>
 
+#include "microbench.h"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -84,7 +86,7 @@ void unlock()
 			unlock(); \
 			reset(); \
 		} \
-		perf_print_counter(p); \
+		microbench::report(p, name); \
 		perf_free(p); \
 	} while (0)
 
@@ -108,6 +110,7 @@ private:
 	matrix::Matrix<float, 16, 6> A16;
 	matrix::Matrix<float, 6, 16> B16;
 	matrix::Matrix<float, 6, 16> B16_4;
+	matrix::SquareMatrix<float, 6> BBt16;
 };
 
 bool MicroBenchMatrix::run_tests()
@@ -145,6 +148,8 @@ void MicroBenchMatrix::reset()
 			B16_4(j, i) = random(-10.0, 10.0);
 		}
 	}
+
+	BBt16 = B16 * B16.transpose();
 }
 
 bool MicroBenchMatrix::time_matrix_euler()
@@ -172,6 +177,8 @@ bool MicroBenchMatrix::time_matrix_pseduo_inverse()
 {
 	PERF("matrix 6x16 pseudo inverse (all non-zero columns)", matrix::geninv(B16, A16), 100);
 	PERF("matrix 6x16 pseudo inverse (4 non-zero columns)", matrix::geninv(B16_4, A16), 100);
+	PERF("matrix 6x16 Gram matrix B * B^T", BBt16 = B16 * B16.transpose(), 100);
+	PERF("matrix 6x16 pseudo inverse from Gram matrix (all non-zero columns)", matrix::pinvGram(B16, BBt16, A16), 100);
 	return true;
 }
 
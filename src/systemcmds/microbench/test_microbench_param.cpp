@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file test_microbench_param.cpp
+ * Microbenchmark parameter access.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <parameters/param.h>
+
+namespace MicroBenchParam
+{
+
+#define PERF(name, op, count) do { \
+		px4_usleep(100); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+		} \
+		microbench::report(p, name); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchParam : public UnitTest
+{
+public:
+	bool run_tests() override;
+
+private:
+
+	bool time_param_get();
+	bool time_param_find();
+
+	void lock()
+	{
+#ifdef __PX4_NUTTX
+		_flags = px4_enter_critical_section();
+#endif
+	}
+
+	void unlock()
+	{
+#ifdef __PX4_NUTTX
+		px4_leave_critical_section(_flags);
+#endif
+	}
+
+#ifdef __PX4_NUTTX
+	irqstate_t _flags {};
+#endif
+
+	param_t find_param(param_type_t type);
+
+	int32_t _value_int32{};
+	float _value_float{};
+};
+
+bool MicroBenchParam::run_tests()
+{
+	ut_run_test(time_param_get);
+	ut_run_test(time_param_find);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_param, MicroBenchParam)
+
+param_t MicroBenchParam::find_param(param_type_t type)
+{
+	for (unsigned i = 0; i < param_count(); i++) {
+		const param_t param = param_for_index(i);
+
+		if (param_type(param) == type) {
+			return param;
+		}
+	}
+
+	return PARAM_INVALID;
+}
+
+bool MicroBenchParam::time_param_get()
+{
+	const param_t param_int32 = find_param(PARAM_TYPE_INT32);
+	const param_t param_float = find_param(PARAM_TYPE_FLOAT);
+
+	ut_assert_true(param_int32 != PARAM_INVALID);
+	ut_assert_true(param_float != PARAM_INVALID);
+
+	PERF("param_get int32", param_get(param_int32, &_value_int32), 1000);
+	PERF("param_get float", param_get(param_float, &_value_float), 1000);
+
+	// a changed parameter is stored in the user config layer
+	ut_assert_true(param_set_no_notification(param_float, &_value_float) == PX4_OK);
+	PERF("param_get float (changed)", param_get(param_float, &_value_float), 1000);
+	param_reset_no_notification(param_float);
+
+	return true;
+}
+
+bool MicroBenchParam::time_param_find()
+{
+	const char *name = param_name(param_for_index(param_count() / 2));
+
+	PERF("param_find", volatile param_t param = param_find_no_notification(name), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchParam
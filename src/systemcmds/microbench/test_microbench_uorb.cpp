@@ -38,6 +38,8 @@
 
 #include <unit_test.h>
 
+#include "microbench.h"
+
 #include <time.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -46,9 +48,13 @@
 #include <perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/tasks.h>
 
+#include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/sensor_accel.h>
+#include <uORB/topics/sensor_combined.h>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fifo.h>
 #include <uORB/topics/vehicle_local_position.h>
@@ -89,7 +95,7 @@ void unlock()
 			unlock(); \
 			reset(); \
 		} \
-		perf_print_counter(p); \
+		microbench::report(p, name); \
 		perf_free(p); \
 	} while (0)
 
@@ -102,9 +108,15 @@ private:
 
 	bool time_px4_uorb();
 	bool time_px4_uorb_direct();
+	bool time_px4_uorb_contended();
+
+	static int copy_task_entry(int argc, char *argv[]);
 
 	void reset();
 
+	static px4::atomic<bool> _copy_task_should_exit;
+	static px4::atomic<bool> _copy_task_running;
+
 	failsafe_flags_s status;
 	vehicle_local_position_s lpos;
 	sensor_gyro_s gyro;
@@ -115,6 +127,7 @@ bool MicroBenchORB::run_tests()
 {
 	ut_run_test(time_px4_uorb);
 	ut_run_test(time_px4_uorb_direct);
+	ut_run_test(time_px4_uorb_contended);
 
 	return (_tests_failed == 0);
 }
@@ -246,4 +259,95 @@ bool MicroBenchORB::time_px4_uorb_direct()
 	return true;
 }
 
+px4::atomic<bool> MicroBenchORB::_copy_task_should_exit{false};
+px4::atomic<bool> MicroBenchORB::_copy_task_running{false};
+
+int MicroBenchORB::copy_task_entry(int argc, char *argv[])
+{
+	uORB::Subscription sensor_combined_sub{ORB_ID(sensor_combined)};
+	sensor_combined_s sensor_combined{};
+
+	_copy_task_running.store(true);
+
+	while (!_copy_task_should_exit.load()) {
+		// copy as fast as possible to contend with the publisher
+		for (int i = 0; i < 100; i++) {
+			sensor_combined_sub.copy(&sensor_combined);
+		}
+
+		px4_usleep(1);
+	}
+
+	_copy_task_running.store(false);
+
+	return 0;
+}
+
+bool MicroBenchORB::time_px4_uorb_contended()
+{
+#if defined(CONFIG_ORB_SEQLOCK)
+	printf("single-slot copy mode: seqlock\n");
+#else
+	printf("single-slot copy mode: locked\n");
+#endif // CONFIG_ORB_SEQLOCK
+
+	uORB::Publication<sensor_combined_s> sensor_combined_pub{ORB_ID(sensor_combined)};
+	sensor_combined_s sensor_combined{};
+	sensor_combined_pub.publish(sensor_combined);
+
+	perf_counter_t uncontended = perf_alloc(PC_ELAPSED, "uORB::Publication publish sensor_combined (uncontended)");
+
+	for (int i = 0; i < 1000; i++) {
+		sensor_combined.timestamp = hrt_absolute_time();
+		perf_begin(uncontended);
+		sensor_combined_pub.publish(sensor_combined);
+		perf_end(uncontended);
+		px4_usleep(1);
+	}
+
+	microbench::report(uncontended, "uORB::Publication publish sensor_combined (uncontended)");
+	perf_free(uncontended);
+
+	_copy_task_should_exit.store(false);
+
+	// two readers competing with the publisher (e.g. logger and mavlink)
+	int copy_tasks[2] {-1, -1};
+
+	for (auto &task : copy_tasks) {
+		char *const args[1] = { nullptr };
+		task = px4_task_spawn_cmd("microbench_copy", SCHED_DEFAULT, SCHED_PRIORITY_DEFAULT, 2000,
+					  (px4_main_t)&MicroBenchORB::copy_task_entry, args);
+
+		if (task < 0) {
+			_copy_task_should_exit.store(true);
+			return false;
+		}
+	}
+
+	while (!_copy_task_running.load()) {
+		px4_usleep(1000);
+	}
+
+	perf_counter_t contended = perf_alloc(PC_ELAPSED, "uORB::Publication publish sensor_combined (contended)");
+
+	for (int i = 0; i < 1000; i++) {
+		sensor_combined.timestamp = hrt_absolute_time();
+		perf_begin(contended);
+		sensor_combined_pub.publish(sensor_combined);
+		perf_end(contended);
+		px4_usleep(1);
+	}
+
+	microbench::report(contended, "uORB::Publication publish sensor_combined (contended)");
+	perf_free(contended);
+
+	_copy_task_should_exit.store(true);
+
+	while (_copy_task_running.load()) {
+		px4_usleep(1000);
+	}
+
+	return true;
+}
+
 } // namespace MicroBenchORB
@@ -0,0 +1,259 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2024 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_work_queue.cpp
+ * Microbenchmark work queue scheduling.
+ */
+
+#include <unit_test.h>
+
+#include "microbench.h"
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/tasks.h>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+
+namespace MicroBenchWorkQueue
+{
+
+class MicroBenchWorkItem : public px4::WorkItem
+{
+public:
+	explicit MicroBenchWorkItem(const char *name) : WorkItem(name, px4::wq_configurations::test1) {}
+	~MicroBenchWorkItem() override = default;
+
+	void Run() override { runs.fetch_add(1); }
+
+	px4::atomic<uint32_t> runs{0};
+};
+
+// measures the time from ScheduleNow() until Run() on the work queue thread
+class MicroBenchLatencyWorkItem : public px4::WorkItem
+{
+public:
+	MicroBenchLatencyWorkItem(const char *name, perf_counter_t latency) :
+		WorkItem(name, px4::wq_configurations::test1), _latency(latency) {}
+	~MicroBenchLatencyWorkItem() override = default;
+
+	void schedule()
+	{
+		_scheduled.store(hrt_absolute_time());
+		ScheduleNow();
+	}
+
+	void Run() override
+	{
+		perf_set_elapsed(_latency, hrt_absolute_time() - _scheduled.load());
+		runs.fetch_add(1);
+	}
+
+	px4::atomic<uint32_t> runs{0};
+
+private:
+	perf_counter_t _latency;
+	px4::atomic<hrt_abstime> _scheduled{0};
+};
+
+class MicroBenchWorkQueue : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+
+	bool time_schedule_now();
+	bool time_schedule_now_contended();
+	bool time_schedule_latency();
+
+	static int schedule_task_entry(int argc, char *argv[]);
+
+	static px4::atomic<bool> _schedule_task_should_exit;
+	static px4::atomic<int> _schedule_tasks_running;
+	static px4::atomic<uint32_t> _schedule_count;
+};
+
+px4::atomic<bool> MicroBenchWorkQueue::_schedule_task_should_exit{true};
+px4::atomic<int> MicroBenchWorkQueue::_schedule_tasks_running{0};
+px4::atomic<uint32_t> MicroBenchWorkQueue::_schedule_count{0};
+
+bool MicroBenchWorkQueue::run_tests()
+{
+	ut_run_test(time_schedule_now);
+	ut_run_test(time_schedule_now_contended);
+	ut_run_test(time_schedule_latency);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_work_queue, MicroBenchWorkQueue)
+
+bool MicroBenchWorkQueue::time_schedule_now()
+{
+	MicroBenchWorkItem item{"microbench_wq"};
+
+	perf_counter_t uncontended = perf_alloc(PC_ELAPSED, "WorkItem ScheduleNow (uncontended)");
+
+	for (int i = 0; i < 1000; i++) {
+		perf_begin(uncontended);
+		item.ScheduleNow();
+		perf_end(uncontended);
+		px4_usleep(1);
+	}
+
+	microbench::report(uncontended, "WorkItem ScheduleNow (uncontended)");
+	perf_free(uncontended);
+
+	// let the last run finish before the item is destroyed
+	px4_usleep(10000);
+
+	return item.runs.load() > 0;
+}
+
+int MicroBenchWorkQueue::schedule_task_entry(int argc, char *argv[])
+{
+	MicroBenchWorkItem item{"microbench_wq_sched"};
+
+	_schedule_tasks_running.fetch_add(1);
+
+	while (!_schedule_task_should_exit.load()) {
+		// schedule as fast as possible to contend with the other producers
+		for (int i = 0; i < 100; i++) {
+			item.ScheduleNow();
+		}
+
+		_schedule_count.fetch_add(100);
+		px4_usleep(1);
+	}
+
+	// let the last run finish before the item is destroyed
+	px4_usleep(10000);
+
+	_schedule_tasks_running.fetch_sub(1);
+
+	return 0;
+}
+
+bool MicroBenchWorkQueue::time_schedule_now_contended()
+{
+	MicroBenchWorkItem item{"microbench_wq"};
+
+	_schedule_task_should_exit.store(false);
+	_schedule_count.store(0);
+
+	// producers competing on the same queue (e.g. sensor drivers and uORB callbacks)
+	static constexpr int NUM_TASKS = 3;
+
+	for (int i = 0; i < NUM_TASKS; i++) {
+		char *const args[1] = { nullptr };
+		int task = px4_task_spawn_cmd("microbench_sched", SCHED_DEFAULT, SCHED_PRIORITY_DEFAULT, 2000,
+					      (px4_main_t)&MicroBenchWorkQueue::schedule_task_entry, args);
+
+		if (task < 0) {
+			_schedule_task_should_exit.store(true);
+
+			while (_schedule_tasks_running.load() > 0) {
+				px4_usleep(1000);
+			}
+
+			return false;
+		}
+	}
+
+	while (_schedule_tasks_running.load() < NUM_TASKS) {
+		px4_usleep(1000);
+	}
+
+	perf_counter_t contended = perf_alloc(PC_ELAPSED, "WorkItem ScheduleNow (contended)");
+
+	const hrt_abstime start = hrt_absolute_time();
+	const uint32_t count_start = _schedule_count.load();
+
+	for (int i = 0; i < 1000; i++) {
+		perf_begin(contended);
+		item.ScheduleNow();
+		perf_end(contended);
+		px4_usleep(1);
+	}
+
+	const float elapsed_s = hrt_elapsed_time(&start) * 1e-6f;
+	const uint32_t schedules = _schedule_count.load() - count_start;
+
+	microbench::report(contended, "WorkItem ScheduleNow (contended)");
+	perf_free(contended);
+
+	printf("%d producers: %.0f schedules/s\n", NUM_TASKS, (double)(schedules / elapsed_s));
+
+	_schedule_task_should_exit.store(true);
+
+	while (_schedule_tasks_running.load() > 0) {
+		px4_usleep(1000);
+	}
+
+	px4_usleep(10000);
+
+	return item.runs.load() > 0;
+}
+
+bool MicroBenchWorkQueue::time_schedule_latency()
+{
+	perf_counter_t latency = perf_alloc(PC_ELAPSED, "WorkItem ScheduleNow to Run latency");
+
+	{
+		MicroBenchLatencyWorkItem item{"microbench_wq_latency", latency};
+
+		for (int i = 0; i < 1000; i++) {
+			item.schedule();
+			// wait for the run, the next schedule must not be merged into a pending one
+			px4_usleep(500);
+		}
+
+		// let the last run finish before the item is destroyed
+		px4_usleep(10000);
+
+		if (item.runs.load() == 0) {
+			perf_free(latency);
+			return false;
+		}
+	}
+
+	microbench::report(latency, "WorkItem ScheduleNow to Run latency");
+	perf_free(latency);
+
+	return true;
+}
+
+} // namespace MicroBenchWorkQueue
@@ -144,6 +144,7 @@ $ reboot
 	PRINT_MODULE_USAGE_COMMAND_DESCR("show-for-airframe", "Show changed params for airframe config");
 
 	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print status of parameter system");
+	PRINT_MODULE_USAGE_PARAM_FLAG('v', "Verbose: print the parameter calls per task (CONFIG_PARAM_ACCESS_PROFILER)", true);
 
 	PRINT_MODULE_USAGE_COMMAND_DESCR("set", "Set parameter to a value");
 	PRINT_MODULE_USAGE_ARG("<param_name> <value>", "Parameter name and value to set", false);
@@ -288,6 +289,11 @@ param_main(int argc, char *argv[])
 
 		if (!strcmp(argv[1], "status")) {
 			param_print_status();
+
+			if (argc >= 3 && !strcmp(argv[2], "-v")) {
+				param_print_access_profile();
+			}
+
 			return PX4_OK;
 		}
 
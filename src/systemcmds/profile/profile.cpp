@@ -0,0 +1,328 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file profile.cpp
+ *
+ * Sampling profiler frontend: starts the platform profiler and streams the
+ * samples into a file, which Tools/profile_flamegraph.py turns into folded
+ * stacks.
+ *
+ * File format (little endian):
+ *  header: "PX4PROF\0", uint32 version, uint32 sampling interval [us]
+ *  'T' record: int32 pid, char name[16], for every task before its first sample
+ *  'S' record: uint64 timestamp [us], int32 pid, uint64 pc, uint64 lr
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/posix.h>
+#include <px4_platform_common/profiler.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace time_literals;
+
+static constexpr int TASK_STACK_SIZE = PX4_STACK_ADJUSTED(1600);
+
+static constexpr uint32_t FILE_VERSION = 1;
+static constexpr size_t TASK_NAME_LENGTH = 16;
+
+class Profile : public ModuleBase<Profile>
+{
+public:
+	Profile(int fd, uint32_t interval_us) : _fd(fd), _interval_us(interval_us) {}
+	~Profile() override;
+
+	/** @see ModuleBase */
+	static int task_spawn(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static Profile *instantiate(int argc, char *argv[]);
+
+	/** @see ModuleBase */
+	static int custom_command(int argc, char *argv[]) { return print_usage("unknown command"); }
+
+	/** @see ModuleBase */
+	static int print_usage(const char *reason = nullptr);
+
+	/** @see ModuleBase::run() */
+	void run() override;
+
+	/** @see ModuleBase::print_status() */
+	int print_status() override;
+
+private:
+	void drain();
+	void writeTask(int32_t pid);
+	void write(const void *data, size_t length);
+
+	static constexpr size_t READ_CHUNK = 64;
+	static constexpr size_t MAX_KNOWN_TASKS = 64;
+
+	int _fd{-1};
+	uint32_t _interval_us{0};
+
+	px4_profiler_sample_s _samples[READ_CHUNK];
+
+	int32_t _known_tasks[MAX_KNOWN_TASKS];
+	size_t _num_known_tasks{0};
+
+	uint32_t _written{0};
+	bool _write_error{false};
+};
+
+Profile::~Profile()
+{
+	if (_fd >= 0) {
+		close(_fd);
+	}
+}
+
+void Profile::write(const void *data, size_t length)
+{
+	if (!_write_error && ::write(_fd, data, length) != (ssize_t)length) {
+		PX4_ERR("write failed (%i)", errno);
+		_write_error = true;
+	}
+}
+
+void Profile::writeTask(int32_t pid)
+{
+	for (size_t i = 0; i < _num_known_tasks; i++) {
+		if (_known_tasks[i] == pid) {
+			return;
+		}
+	}
+
+	// when the table is full, the name is written again for every sample of an unknown task
+	if (_num_known_tasks < MAX_KNOWN_TASKS) {
+		_known_tasks[_num_known_tasks++] = pid;
+	}
+
+	uint8_t record[1 + sizeof(int32_t) + TASK_NAME_LENGTH] {};
+	record[0] = 'T';
+	memcpy(&record[1], &pid, sizeof(pid));
+
+	char name[TASK_NAME_LENGTH + 1] {};
+
+	if (px4_profiler_task_name(pid, name, sizeof(name)) != 0) {
+		snprintf(name, sizeof(name), "%d", (int)pid);
+	}
+
+	memcpy(&record[1 + sizeof(int32_t)], name, TASK_NAME_LENGTH);
+	write(record, sizeof(record));
+}
+
+void Profile::drain()
+{
+	size_t count;
+
+	while ((count = px4_profiler_read(_samples, READ_CHUNK)) > 0) {
+		for (size_t i = 0; i < count; i++) {
+			const px4_profiler_sample_s &sample = _samples[i];
+			writeTask(sample.pid);
+
+			const uint64_t pc = sample.pc;
+			const uint64_t lr = sample.lr;
+
+			uint8_t record[1 + sizeof(uint64_t) + sizeof(int32_t) + 2 * sizeof(uint64_t)];
+			record[0] = 'S';
+			memcpy(&record[1], &sample.timestamp, sizeof(uint64_t));
+			memcpy(&record[9], &sample.pid, sizeof(int32_t));
+			memcpy(&record[13], &pc, sizeof(uint64_t));
+			memcpy(&record[21], &lr, sizeof(uint64_t));
+			write(record, sizeof(record));
+		}
+
+		_written += count;
+	}
+}
+
+void Profile::run()
+{
+	uint8_t header[8 + 2 * sizeof(uint32_t)] {};
+	memcpy(header, "PX4PROF", 8);
+	memcpy(&header[8], &FILE_VERSION, sizeof(uint32_t));
+	memcpy(&header[12], &_interval_us, sizeof(uint32_t));
+	write(header, sizeof(header));
+
+	while (!should_exit() && !_write_error) {
+		px4_usleep(50_ms);
+		drain();
+	}
+
+	px4_profiler_stop();
+	drain();
+	fsync(_fd);
+
+	uint32_t recorded;
+	uint32_t dropped;
+	px4_profiler_stats(&recorded, &dropped);
+	PX4_INFO("stopped, %" PRIu32 " samples written, %" PRIu32 " dropped", _written, dropped);
+}
+
+int Profile::print_status()
+{
+	uint32_t recorded;
+	uint32_t dropped;
+	px4_profiler_stats(&recorded, &dropped);
+
+	PX4_INFO("sampling at %" PRIu32 " Hz", 1000000 / _interval_us);
+	PX4_INFO("%" PRIu32 " samples recorded, %" PRIu32 " written, %" PRIu32 " dropped", recorded, _written, dropped);
+
+	if (_write_error) {
+		PX4_ERR("write error");
+	}
+
+	return 0;
+}
+
+int Profile::task_spawn(int argc, char *argv[])
+{
+	_task_id = px4_task_spawn_cmd("profile", SCHED_DEFAULT,
+				      SCHED_PRIORITY_DEFAULT, TASK_STACK_SIZE,
+				      (px4_main_t)&run_trampoline, (char *const *)argv);
+
+	if (_task_id < 0) {
+		_task_id = -1;
+		return -errno;
+	}
+
+	return 0;
+}
+
+Profile *Profile::instantiate(int argc, char *argv[])
+{
+	int rate = 1000;
+	int buffer_samples = 1024;
+	const char *filename = PX4_STORAGEDIR "/profile.bin";
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "r:b:f:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'r':
+			rate = strtol(myoptarg, nullptr, 10);
+			break;
+
+		case 'b':
+			buffer_samples = strtol(myoptarg, nullptr, 10);
+			break;
+
+		case 'f':
+			filename = myoptarg;
+			break;
+
+		default:
+			print_usage("unrecognized flag");
+			return nullptr;
+		}
+	}
+
+	if (rate < 1 || rate > 10000 || buffer_samples < 1) {
+		print_usage("invalid rate or buffer size");
+		return nullptr;
+	}
+
+	const int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("can't open %s (%i)", filename, errno);
+		return nullptr;
+	}
+
+	const uint32_t interval_us = 1000000 / rate;
+	Profile *profile = new Profile(fd, interval_us);
+
+	if (profile == nullptr) {
+		close(fd);
+		return nullptr;
+	}
+
+	const int ret = px4_profiler_start(interval_us, buffer_samples);
+
+	if (ret != 0) {
+		PX4_ERR("start failed (%i)", ret);
+		delete profile;
+		return nullptr;
+	}
+
+	PX4_INFO("writing to %s", filename);
+	return profile;
+}
+
+int Profile::print_usage(const char *reason)
+{
+	if (reason) {
+		PX4_WARN("%s\n", reason);
+	}
+
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Sampling profiler: a timer interrupt records the program counter (and the link register, if available)
+of the running task at a fixed rate. The samples are written to a file, which can be converted into a
+flame graph on the host with:
+
+$ Tools/profile_flamegraph.py -e build/<target>/<target>.elf profile.bin > profile.folded
+
+On NuttX the interrupted context is sampled from the HRT interrupt, on Linux SIGPROF is used.
+
+### Example
+$ profile start -r 2000
+$ profile stop
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("profile", "command");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("start", "Start sampling");
+	PRINT_MODULE_USAGE_PARAM_INT('r', 1000, 1, 10000, "Sampling rate [Hz]", true);
+	PRINT_MODULE_USAGE_PARAM_INT('b', 1024, 1, 65536, "Sample buffer size", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('f', PX4_STORAGEDIR "/profile.bin", "<file>", "Output file", true);
+	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+
+	return 0;
+}
+
+extern "C" __EXPORT int profile_main(int argc, char *argv[])
+{
+	return Profile::main(argc, argv);
+}
@@ -47,10 +47,12 @@
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/getopt.h>
 #include <px4_platform_common/log.h>
+#include <px4_platform_common/time.h>
 
 #include <drivers/drv_hrt.h>
 
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
+#define MIN(a,b) ((a) < (b) ? (a) : (b))
 
 typedef struct sdb_config {
 	int num_runs; ///< number of runs
@@ -58,12 +60,15 @@ typedef struct sdb_config {
 	bool synchronized; ///< call fsync after each block?
 	int unaligned;
 	unsigned int total_blocks_written;
+	int log_rate; ///< emulated logging rate for the logger mode [KB/s]
 } sdb_config_t;
 
 /** sequential write speed test */
 static void write_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
 /** sequential read speed test */
 static int read_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
+/** logger write pattern test with buffer size recommendation */
+static void logger_test(int fd, int mission_fd, sdb_config_t *cfg, uint8_t *block, int block_size);
 
 /**
  * Measure the time for fsync.
@@ -73,13 +78,35 @@ static int read_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size);
 static inline unsigned int time_fsync(int fd);
 
 static const char *BENCHMARK_FILE = PX4_STORAGEDIR"/benchmark.tmp";
+static const char *BENCHMARK_MISSION_FILE = PX4_STORAGEDIR"/benchmark_mission.tmp";
+
+// same as the logger: writes are multiples of this size, and fsync is called at least once per second
+static constexpr int LOGGER_WRITE_CHUNK = 4096;
+static constexpr hrt_abstime LOGGER_FSYNC_INTERVAL = 1000000;
+// the mission log is written by the same thread with small writes
+static constexpr hrt_abstime LOGGER_MISSION_INTERVAL = 100000;
+
+// upper bounds of the write time histogram [ms], the last bin takes everything above
+static constexpr unsigned int STALL_BINS_MS[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000};
+static constexpr int NUM_STALL_BINS = sizeof(STALL_BINS_MS) / sizeof(STALL_BINS_MS[0]) + 1;
 
 static void usage()
 {
-	PRINT_MODULE_DESCRIPTION("Test the speed of an SD Card");
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Test the speed of an SD Card.
+
+With -l the write pattern of the logger is emulated instead of a sequential write: data
+arrives at a fixed rate (-R), is written in multiples of 4 KB with an fsync every second,
+interleaved with small writes to a second file like the mission log. The time of every
+write is put into a histogram, and the largest backlog is used to recommend a logger
+buffer size (logger start -b, LOGGER_BUF in the startup scripts) for this card.
+)DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME_SIMPLE("sd_bench", "command");
-	PRINT_MODULE_USAGE_PARAM_INT('b', 4096, 1, 1000000, "Block size for each read/write", true);
+	PRINT_MODULE_USAGE_PARAM_INT('b', 4096, 1, 1000000, "Block size for each read/write (largest write with -l, default 16384)",
+				     true);
 	PRINT_MODULE_USAGE_PARAM_INT('r', 5, 1, 1000, "Number of runs", true);
 	PRINT_MODULE_USAGE_PARAM_INT('d', 2000, 1, 100000, "Duration of a run in ms", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('k', "Keep the test file", true);
@@ -87,13 +114,17 @@ static void usage()
 	PRINT_MODULE_USAGE_PARAM_FLAG('u', "Test performance with unaligned data", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('U', "Test performance with forced byte unaligned data", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('v', "Verify data and block number", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('l', "Emulate the logger write pattern and recommend a logger buffer size", true);
+	PRINT_MODULE_USAGE_PARAM_INT('R', 100, 1, 100000, "Logging rate in KB/s for -l", true);
 }
 
 extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 {
 	int block_size = 4096;
+	bool block_size_set = false;
 	bool verify = false;
 	bool keep = false;
+	bool logger_mode = false;
 	int myoptind = 1;
 	int ch;
 	const char *myoptarg = nullptr;
@@ -102,13 +133,15 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 	cfg.num_runs = 5;
 	cfg.run_duration = 2000;
 	cfg.unaligned = 0;
+	cfg.log_rate = 100;
 	uint8_t *block = nullptr;
 	uint8_t *block_alloc = nullptr;
 
-	while ((ch = px4_getopt(argc, argv, "b:r:d:ksuUv", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "b:r:d:ksuUvlR:", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 		case 'b':
 			block_size = strtol(myoptarg, nullptr, 0);
+			block_size_set = true;
 			break;
 
 		case 'r':
@@ -139,6 +172,14 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 			verify = true;
 			break;
 
+		case 'l':
+			logger_mode = true;
+			break;
+
+		case 'R':
+			cfg.log_rate = strtol(myoptarg, nullptr, 0);
+			break;
+
 		default:
 			usage();
 			return -1;
@@ -146,11 +187,20 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 		}
 	}
 
-	if (block_size <= 0 || cfg.num_runs <= 0) {
+	if (logger_mode && !block_size_set) {
+		block_size = 4 * LOGGER_WRITE_CHUNK;
+	}
+
+	if (block_size <= 0 || cfg.num_runs <= 0 || cfg.log_rate <= 0) {
 		PX4_ERR("invalid argument");
 		return -1;
 	}
 
+	if (logger_mode && block_size < LOGGER_WRITE_CHUNK) {
+		PX4_ERR("block size must be at least %i with -l", LOGGER_WRITE_CHUNK);
+		return -1;
+	}
+
 	int bench_fd = open(BENCHMARK_FILE, O_CREAT | (verify ? O_RDWR : O_WRONLY) | O_TRUNC, PX4_O_MODE_666);
 
 	if (bench_fd < 0) {
@@ -158,6 +208,18 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 		return -1;
 	}
 
+	int mission_fd = -1;
+
+	if (logger_mode) {
+		mission_fd = open(BENCHMARK_MISSION_FILE, O_CREAT | O_WRONLY | O_TRUNC, PX4_O_MODE_666);
+
+		if (mission_fd < 0) {
+			PX4_ERR("Can't open benchmark file %s", BENCHMARK_MISSION_FILE);
+			close(bench_fd);
+			return -1;
+		}
+	}
+
 	//create some data block
 	if (cfg.unaligned == 0) {
 		block_alloc = (uint8_t *)px4_cache_aligned_alloc(block_size);
@@ -182,6 +244,11 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 	if (!block) {
 		PX4_ERR("Failed to allocate memory block");
 		close(bench_fd);
+
+		if (mission_fd >= 0) {
+			close(mission_fd);
+		}
+
 		return -1;
 	}
 
@@ -189,20 +256,34 @@ extern "C" __EXPORT int sd_bench_main(int argc, char *argv[])
 		block[i] = (uint8_t)i;
 	}
 
-	PX4_INFO("Using block size = %i bytes, sync=%i", block_size, (int)cfg.synchronized);
-	write_test(bench_fd, &cfg, block, block_size);
+	if (logger_mode) {
+		PX4_INFO("Using max write size = %i bytes, logging rate = %i KB/s", block_size, cfg.log_rate);
+		logger_test(bench_fd, mission_fd, &cfg, block, block_size);
 
-	if (verify) {
-		fsync(bench_fd);
-		lseek(bench_fd, 0, SEEK_SET);
-		read_test(bench_fd, &cfg, block, block_size);
+	} else {
+		PX4_INFO("Using block size = %i bytes, sync=%i", block_size, (int)cfg.synchronized);
+		write_test(bench_fd, &cfg, block, block_size);
+
+		if (verify) {
+			fsync(bench_fd);
+			lseek(bench_fd, 0, SEEK_SET);
+			read_test(bench_fd, &cfg, block, block_size);
+		}
 	}
 
 	free(block_alloc);
 	close(bench_fd);
 
+	if (mission_fd >= 0) {
+		close(mission_fd);
+	}
+
 	if (!keep) {
 		unlink(BENCHMARK_FILE);
+
+		if (mission_fd >= 0) {
+			unlink(BENCHMARK_MISSION_FILE);
+		}
 	}
 
 	return 0;
@@ -367,3 +448,133 @@ int read_test(int fd, sdb_config_t *cfg, uint8_t *block, int block_size)
 	free(block_alloc);
 	return 0;
 }
+
+static void add_to_histogram(unsigned int *histogram, unsigned int time_ms)
+{
+	int bin = 0;
+
+	while (bin < NUM_STALL_BINS - 1 && time_ms >= STALL_BINS_MS[bin]) {
+		++bin;
+	}
+
+	++histogram[bin];
+}
+
+void logger_test(int fd, int mission_fd, sdb_config_t *cfg, uint8_t *block, int block_size)
+{
+	PX4_INFO("");
+	PX4_INFO("Testing Logger Write Pattern...");
+
+	const uint64_t rate_bytes_per_s = (uint64_t)cfg->log_rate * 1024;
+	const int max_write = block_size / LOGGER_WRITE_CHUNK * LOGGER_WRITE_CHUNK;
+
+	unsigned int histogram[NUM_STALL_BINS] {};
+	unsigned int max_max_write_time = 0;
+	uint64_t max_max_backlog = 0;
+	uint64_t produced = 0;
+	uint64_t written = 0;
+	unsigned int mission_writes = 0;
+
+	const hrt_abstime test_start = hrt_absolute_time();
+	hrt_abstime last_fsync = test_start;
+	hrt_abstime last_mission_write = test_start;
+
+	for (int run = 0; run < cfg->num_runs; ++run) {
+		const hrt_abstime start = hrt_absolute_time();
+		const uint64_t written_start = written;
+		unsigned int max_write_time = 0;
+		uint64_t max_backlog = 0;
+
+		while ((int64_t)hrt_elapsed_time(&start) < cfg->run_duration * 1000) {
+			const hrt_abstime now = hrt_absolute_time();
+
+			// everything the logger would have produced by now and did not get to write yet
+			produced = rate_bytes_per_s * (now - test_start) / 1000000;
+			const uint64_t backlog = produced - written;
+			max_backlog = MAX(max_backlog, backlog);
+
+			const bool call_fsync = now - last_fsync > LOGGER_FSYNC_INTERVAL;
+			const bool mission_write = now - last_mission_write > LOGGER_MISSION_INTERVAL;
+
+			if (backlog < (uint64_t)LOGGER_WRITE_CHUNK && !call_fsync && !mission_write) {
+				// like the logger waiting for data
+				px4_usleep(1000);
+				continue;
+			}
+
+			if (mission_write) {
+				// a few small messages at a time, size varying between writes
+				const size_t mission_size = 64 + (mission_writes * 97) % 448;
+				const hrt_abstime write_start = hrt_absolute_time();
+
+				if (write(mission_fd, block, mission_size) != (ssize_t)mission_size) {
+					PX4_ERR("Write error: %d", errno);
+					return;
+				}
+
+				add_to_histogram(histogram, hrt_elapsed_time(&write_start) / 1000);
+				last_mission_write = now;
+				++mission_writes;
+			}
+
+			const hrt_abstime write_start = hrt_absolute_time();
+
+			if (backlog >= (uint64_t)LOGGER_WRITE_CHUNK) {
+				const size_t write_size = MIN(backlog, (uint64_t)max_write) / LOGGER_WRITE_CHUNK * LOGGER_WRITE_CHUNK;
+
+				if (write(fd, block, write_size) != (ssize_t)write_size) {
+					PX4_ERR("Write error: %d", errno);
+					return;
+				}
+
+				written += write_size;
+			}
+
+			if (call_fsync) {
+				fsync(fd);
+				fsync(mission_fd);
+				last_fsync = now;
+			}
+
+			const unsigned int write_time = hrt_elapsed_time(&write_start) / 1000;
+			add_to_histogram(histogram, write_time);
+			max_write_time = MAX(max_write_time, write_time);
+		}
+
+		const double elapsed = hrt_elapsed_time(&start) / 1.e6;
+		PX4_INFO("  Run %2i: %8.2lf KB/s, max write time: %i ms, max backlog: %i KB", run,
+			 (double)(written - written_start) / elapsed / 1024., max_write_time, (int)(max_backlog / 1024));
+
+		max_max_write_time = MAX(max_max_write_time, max_write_time);
+		max_max_backlog = MAX(max_max_backlog, max_backlog);
+	}
+
+	PX4_INFO("  Overall max write time: %i ms, max backlog: %i KB", max_max_write_time, (int)(max_max_backlog / 1024));
+
+	PX4_INFO("");
+	PX4_INFO("Write time histogram (write + fsync):");
+
+	for (int bin = 0; bin < NUM_STALL_BINS; ++bin) {
+		if (bin < NUM_STALL_BINS - 1) {
+			PX4_INFO("  < %4u ms: %u", STALL_BINS_MS[bin], histogram[bin]);
+
+		} else {
+			PX4_INFO("  >=%4u ms: %u", STALL_BINS_MS[bin - 1], histogram[bin]);
+		}
+	}
+
+	PX4_INFO("");
+
+	if (produced - written > 2 * (uint64_t)max_write) {
+		// the backlog kept growing, no buffer is large enough
+		PX4_WARN("The card can not sustain %i KB/s, reduce the logging rate (SDLOG_PROFILE)", cfg->log_rate);
+
+	} else {
+		// the logger needs to hold the largest backlog plus the data that arrives while a write is in progress,
+		// with 50% margin on top
+		const uint64_t required = max_max_backlog + rate_bytes_per_s * max_max_write_time / 1000;
+		const unsigned int recommended_kb = (unsigned int)((required * 3 / 2 + 1023) / 1024) + LOGGER_WRITE_CHUNK / 1024;
+		PX4_INFO("Recommended logger buffer for %i KB/s: %u KB (logger start -b %u, LOGGER_BUF)", cfg->log_rate,
+			 recommended_kb, recommended_kb);
+	}
+}
@@ -0,0 +1,377 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file startgroup.cpp
+ *
+ * Concurrent startup of modules during boot. Commands are started in background tasks that belong to a
+ * named group, optionally after another group has finished, and the startup script can wait for a group
+ * where its modules are needed.
+ */
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/tasks.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__PX4_NUTTX)
+#include <builtin/builtin.h>
+#include <sys/wait.h>
+#else
+#include <platforms/posix/apps.h>
+#endif
+
+namespace startgroup
+{
+
+static constexpr int MAX_GROUPS = 8;
+static constexpr int MAX_COMMANDS = 16;   ///< maximum number of commands running at the same time
+static constexpr int MAX_ARGS = 16;
+static constexpr int MAX_LINE = 128;
+static constexpr int GROUP_NAME_LEN = 16;
+
+struct Group {
+	char name[GROUP_NAME_LEN];
+	int pending;
+	int finished;
+	int failed;
+	hrt_abstime start_time;
+	hrt_abstime end_time;
+};
+
+struct Command {
+	bool used;
+	int group;
+	int dependency;   ///< group to wait for before running, -1 if none
+	int argc;
+	char *argv[MAX_ARGS + 1];
+	char line[MAX_LINE];
+};
+
+static Group groups[MAX_GROUPS] {};
+static int num_groups = 0;
+static Command commands[MAX_COMMANDS] {};
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+
+// must be called with the mutex held
+static int find_group(const char *name, bool create)
+{
+	for (int i = 0; i < num_groups; i++) {
+		if (strcmp(groups[i].name, name) == 0) {
+			return i;
+		}
+	}
+
+	if (!create || num_groups >= MAX_GROUPS || strlen(name) >= GROUP_NAME_LEN) {
+		return -1;
+	}
+
+	Group &group = groups[num_groups];
+	strncpy(group.name, name, GROUP_NAME_LEN - 1);
+	group.name[GROUP_NAME_LEN - 1] = '\0';
+	group.start_time = hrt_absolute_time();
+	return num_groups++;
+}
+
+// must be called with the mutex held
+static void wait_for_group(int group)
+{
+	while (groups[group].pending > 0) {
+		pthread_cond_wait(&cond, &mutex);
+	}
+}
+
+static int execute(int argc, char *argv[])
+{
+#if defined(__PX4_NUTTX)
+	int status = PX4_ERROR;
+	const int pid = exec_builtin(argv[0], argv, nullptr, 0);
+
+	if (pid < 0 || waitpid(pid, &status, 0) < 0) {
+		PX4_ERR("failed to run %s", argv[0]);
+		return PX4_ERROR;
+	}
+
+	return status;
+#else
+	apps_map_type apps;
+	init_app_map(apps);
+	const auto app = apps.find(argv[0]);
+
+	if (app == apps.end()) {
+		PX4_ERR("%s: command not found", argv[0]);
+		return PX4_ERROR;
+	}
+
+	return app->second(argc, argv);
+#endif
+}
+
+static int worker_main(int argc, char *argv[])
+{
+	// argv[1]: command slot
+	if (argc < 2) {
+		return PX4_ERROR;
+	}
+
+	Command &command = commands[atoi(argv[1])];
+
+	pthread_mutex_lock(&mutex);
+
+	if (command.dependency >= 0) {
+		wait_for_group(command.dependency);
+	}
+
+	pthread_mutex_unlock(&mutex);
+
+	const int ret = execute(command.argc, command.argv);
+
+	pthread_mutex_lock(&mutex);
+
+	Group &group = groups[command.group];
+
+	if (ret != 0) {
+		PX4_ERR("%s: '%s' failed (%i)", group.name, command.argv[0], ret);
+		group.failed++;
+	}
+
+	group.finished++;
+	group.pending--;
+	group.end_time = hrt_absolute_time();
+	command.used = false;
+
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&mutex);
+
+	return ret;
+}
+
+static int run(const char *group_name, const char *dependency_name, int argc, char *argv[])
+{
+	if (argc < 1 || argc > MAX_ARGS) {
+		PX4_ERR("invalid command");
+		return PX4_ERROR;
+	}
+
+	pthread_mutex_lock(&mutex);
+
+	const int group = find_group(group_name, true);
+	const int dependency = dependency_name ? find_group(dependency_name, false) : -1;
+	int slot = -1;
+
+	for (int i = 0; i < MAX_COMMANDS && group >= 0; i++) {
+		if (!commands[i].used) {
+			slot = i;
+			break;
+		}
+	}
+
+	if (group < 0 || slot < 0 || (dependency_name && dependency < 0) || dependency == group) {
+		pthread_mutex_unlock(&mutex);
+		PX4_ERR("cannot add '%s' to %s", argv[0], group_name);
+		return PX4_ERROR;
+	}
+
+	// copy the arguments into the slot, they have to outlive this command
+	Command &command = commands[slot];
+	size_t pos = 0;
+
+	for (int i = 0; i < argc; i++) {
+		const size_t len = strlen(argv[i]) + 1;
+
+		if (pos + len > sizeof(command.line)) {
+			pthread_mutex_unlock(&mutex);
+			PX4_ERR("command too long");
+			return PX4_ERROR;
+		}
+
+		memcpy(&command.line[pos], argv[i], len);
+		command.argv[i] = &command.line[pos];
+		pos += len;
+	}
+
+	command.argv[argc] = nullptr;
+	command.argc = argc;
+	command.group = group;
+	command.dependency = dependency;
+	command.used = true;
+
+	if (groups[group].pending == 0) {
+		groups[group].start_time = hrt_absolute_time();
+	}
+
+	groups[group].pending++;
+
+	pthread_mutex_unlock(&mutex);
+
+	char slot_str[4];
+	snprintf(slot_str, sizeof(slot_str), "%i", slot);
+	char *const worker_argv[] = {slot_str, nullptr};
+
+	// on NuttX the command runs in its own task, the worker only waits for it
+#if defined(__PX4_NUTTX)
+	static constexpr int stack_size = PX4_STACK_ADJUSTED(1200);
+#else
+	static constexpr int stack_size = 8192;
+#endif
+
+	const px4_task_t task = px4_task_spawn_cmd("startgroup", SCHED_DEFAULT, SCHED_PRIORITY_DEFAULT, stack_size,
+			       worker_main, worker_argv);
+
+	if (task < 0) {
+		pthread_mutex_lock(&mutex);
+		groups[group].pending--;
+		command.used = false;
+		pthread_cond_broadcast(&cond);
+		pthread_mutex_unlock(&mutex);
+		PX4_ERR("task start failed");
+		return PX4_ERROR;
+	}
+
+	return PX4_OK;
+}
+
+static int wait(const char *group_name)
+{
+	int failed = 0;
+
+	pthread_mutex_lock(&mutex);
+
+	if (group_name) {
+		const int group = find_group(group_name, false);
+
+		if (group < 0) {
+			pthread_mutex_unlock(&mutex);
+			PX4_ERR("unknown group %s", group_name);
+			return PX4_ERROR;
+		}
+
+		wait_for_group(group);
+		failed = groups[group].failed;
+
+	} else {
+		for (int i = 0; i < num_groups; i++) {
+			wait_for_group(i);
+			failed += groups[i].failed;
+		}
+	}
+
+	pthread_mutex_unlock(&mutex);
+
+	return failed == 0 ? PX4_OK : PX4_ERROR;
+}
+
+static void status()
+{
+	pthread_mutex_lock(&mutex);
+
+	for (int i = 0; i < num_groups; i++) {
+		const Group &group = groups[i];
+		const hrt_abstime end = (group.pending > 0) ? hrt_absolute_time() : group.end_time;
+		PX4_INFO("%-*s pending: %i, finished: %i, failed: %i, %.1f ms", GROUP_NAME_LEN, group.name, group.pending,
+			 group.finished, group.failed, (double)((end > group.start_time) ? (end - group.start_time) : 0) * 1e-3);
+	}
+
+	pthread_mutex_unlock(&mutex);
+}
+
+static void usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Concurrent startup of modules during boot.
+
+Each command is started in a background task and belongs to a named group. A command can depend on
+another group, and then only runs after all the commands of that group have finished. The startup script
+waits for a group before starting the modules that need it, e.g. before the navigator for dataman.
+
+Drivers on the same bus or modules that depend on each other without declaring it must not be added
+to different groups.
+
+### Examples
+$ startgroup run storage dataman start
+$ startgroup run sensors -d storage gps start
+$ startgroup wait storage
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME_SIMPLE("startgroup", "command");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("run", "Run a command in the background");
+	PRINT_MODULE_USAGE_ARG("<group>", "Group name", false);
+	PRINT_MODULE_USAGE_PARAM_STRING('d', nullptr, "<group>", "Wait for this group to finish before running", true);
+	PRINT_MODULE_USAGE_ARG("<command> [args...]", "Command to run", false);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("wait", "Wait until all commands of a group (or of all groups) have finished");
+	PRINT_MODULE_USAGE_ARG("<group>", "Group name", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print the state and duration of the groups");
+}
+
+} // namespace startgroup
+
+extern "C" __EXPORT int startgroup_main(int argc, char *argv[])
+{
+	if (argc >= 4 && strcmp(argv[1], "run") == 0) {
+		// the options are parsed manually, everything after the command name belongs to the command
+		const char *dependency = nullptr;
+		int first_arg = 3;
+
+		if (strcmp(argv[3], "-d") == 0) {
+			if (argc < 6) {
+				startgroup::usage();
+				return PX4_ERROR;
+			}
+
+			dependency = argv[4];
+			first_arg = 5;
+		}
+
+		return startgroup::run(argv[2], dependency, argc - first_arg, &argv[first_arg]);
+
+	} else if (argc >= 2 && strcmp(argv[1], "wait") == 0) {
+		return startgroup::wait(argc >= 3 ? argv[2] : nullptr);
+
+	} else if (argc >= 2 && strcmp(argv[1], "status") == 0) {
+		startgroup::status();
+		return PX4_OK;
+	}
+
+	startgroup::usage();
+	return PX4_ERROR;
+}
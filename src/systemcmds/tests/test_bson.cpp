@@ -37,6 +37,8 @@
  */
 
 #include <px4_platform_common/defines.h>
+#include <px4_platform_common/posix.h>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
@@ -55,7 +57,7 @@ static const int64_t sample_big_int = (int64_t)INT_MAX + 123LL;
 static const double sample_double = 2.5f;
 static const char *sample_string = "this is a test";
 static const uint8_t sample_data[256] = {0};
-//static const char *sample_filename = "/fs/microsd/bson.test";
+static const char *sample_filename = PX4_STORAGEDIR "/bson.test";
 
 static int
 encode(bson_encoder_t encoder)
@@ -295,5 +297,43 @@ test_bson(int argc, char *argv[])
 	decode(&decoder);
 	free(buf);
 
+	/* encode data to a file through a buffer */
+	int fd = ::open(sample_filename, O_RDWR | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("FAIL: open %s", sample_filename);
+		return 1;
+	}
+
+	uint8_t file_buffer[64];
+
+	if (bson_encoder_init_buf_file(&encoder, fd, file_buffer, sizeof(file_buffer))) {
+		PX4_ERR("FAIL: bson_encoder_init_buf_file");
+		::close(fd);
+		return 1;
+	}
+
+	encode(&encoder);
+
+	/* decode it through a buffer smaller than a node, so names and data cross the refills */
+	uint8_t small_buffer[20];
+
+	if ((lseek(fd, 0, SEEK_SET) != 0)
+	    || bson_decoder_init_buf_file(&decoder, fd, small_buffer, sizeof(small_buffer), decode_callback)) {
+		PX4_ERR("FAIL: bson_decoder_init_buf_file");
+		::close(fd);
+		return 1;
+	}
+
+	decode(&decoder);
+	::close(fd);
+	unlink(sample_filename);
+
+	if (decoder.total_decoded_size != decoder.total_document_size) {
+		PX4_ERR("FAIL: decoder: decoded %" PRIi32 " of %" PRIi32 " bytes", decoder.total_decoded_size,
+			decoder.total_document_size);
+		return 1;
+	}
+
 	return PX4_OK;
 }
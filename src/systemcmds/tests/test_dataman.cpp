@@ -86,6 +86,7 @@ private:
 	bool testAsyncWriteBufferOverflow();
 	bool testAsyncMutipleClients();
 	bool testAsyncWriteReadAllItemsMaxSize();
+	bool testAsyncReadRange();
 	bool testAsyncClearAll();
 
 	//Cache
@@ -822,6 +823,65 @@ DatamanTest::testAsyncWriteReadAllItemsMaxSize()
 	return success;
 }
 
+bool
+DatamanTest::testAsyncReadRange()
+{
+	const dm_item_t item = DM_KEY_WAYPOINTS_OFFBOARD_0;
+	uint8_t buffer_range[DM_MAX_READ_RANGE * DM_MAX_DATA_SIZE];
+
+	for (uint32_t index = 0U; index < DM_MAX_READ_RANGE; ++index) {
+
+		for (uint32_t i = 0; i < g_per_item_size[item]; ++i) {
+			_buffer_write[i] = (uint8_t)((index + i) % UINT8_MAX);
+		}
+
+		if (!_dataman_client1.writeSync(item, index, _buffer_write, g_per_item_size[item])) {
+			PX4_ERR("writeSync failed for index %" PRIu32 "!", index);
+			return false;
+		}
+	}
+
+	bool success = _dataman_client1.readAsync(item, 0U, DM_MAX_READ_RANGE, buffer_range, g_per_item_size[item]);
+
+	if (!success) {
+		return false;
+	}
+
+	hrt_abstime start_time = hrt_absolute_time();
+
+	//While loop represents a task
+	while (!_dataman_client1.lastOperationCompleted(_response_success)) {
+
+		_dataman_client1.update();
+
+		if (hrt_elapsed_time(&start_time) > 5_s) {
+			PX4_ERR("Test timeout!");
+			return false;
+		}
+
+		//Simulate rescheduling the task after a 1 ms delay to allow time for the dataman task to operate.
+		px4_usleep(1_ms);
+	}
+
+	if (!_response_success) {
+		return false;
+	}
+
+	for (uint32_t index = 0U; index < DM_MAX_READ_RANGE; ++index) {
+		for (uint32_t i = 0; i < g_per_item_size[item]; ++i) {
+
+			const uint8_t expected = (uint8_t)((index + i) % UINT8_MAX);
+
+			if (buffer_range[index * g_per_item_size[item] + i] != expected) {
+				PX4_ERR("range read failed at index = %" PRIu32 ", element= %" PRIu32, index, i);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 bool
 DatamanTest::testAsyncClearAll()
 {
@@ -1138,6 +1198,7 @@ bool DatamanTest::run_tests()
 	ut_run_test(testAsyncWriteBufferOverflow);
 	ut_run_test(testAsyncMutipleClients);
 	ut_run_test(testAsyncWriteReadAllItemsMaxSize);
+	ut_run_test(testAsyncReadRange);
 	ut_run_test(testAsyncClearAll);
 
 	ut_run_test(testCache);
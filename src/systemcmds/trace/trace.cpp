@@ -0,0 +1,280 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file trace.cpp
+ *
+ * Control the scheduling trace (px4_platform_common/trace.h) and export the
+ * recorded events as CSV, which Tools/trace_to_chrome.py converts into the
+ * Chrome trace format (chrome://tracing, Perfetto).
+ */
+
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/getopt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/module.h>
+#include <px4_platform_common/posix.h>
+#include <px4_platform_common/trace.h>
+
+#include <uORB/topics/uORBTopics.hpp>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *const event_names[PX4_TRACE_EVENT_COUNT] = {
+	"wq_add",
+	"run_start",
+	"run_end",
+	"hrt_callout",
+	"publish",
+	"isr_enter",
+	"isr_exit",
+};
+
+static void print_usage()
+{
+	PRINT_MODULE_DESCRIPTION(
+		R"DESCR_STR(
+### Description
+Scheduling trace: records work queue scheduling and runs, HRT callouts, the publications of selected
+uORB topics and (if enabled in NuttX) interrupt handlers into a ring buffer per CPU. The oldest events
+are overwritten, so the trace can run continuously and be dumped after the event of interest.
+
+The dump is a CSV file, convert it for chrome://tracing or https://ui.perfetto.dev with:
+
+$ Tools/trace_to_chrome.py trace.csv -o trace.json
+
+### Example
+$ trace start -t sensor_gyro,vehicle_angular_velocity
+$ trace dump
+)DESCR_STR");
+
+	PRINT_MODULE_USAGE_NAME("trace", "command");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("start", "Start recording");
+	PRINT_MODULE_USAGE_PARAM_INT('b', 4096, 16, 65536, "Ring size per CPU [events]", true);
+	PRINT_MODULE_USAGE_PARAM_STRING('t', nullptr, "<topic1,topic2,...>", "uORB topics to record publications of", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("stop", "Stop recording");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "Print the state and number of recorded events");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("dump", "Stop recording and write the events to a file");
+	PRINT_MODULE_USAGE_PARAM_STRING('f', PX4_STORAGEDIR "/trace.csv", "<file>", "Output file", true);
+}
+
+static bool select_topics(char *topics)
+{
+	const orb_metadata *const *orb_topics = orb_get_topics();
+
+	for (char *saveptr = nullptr, *name = strtok_r(topics, ",", &saveptr); name != nullptr;
+	     name = strtok_r(nullptr, ",", &saveptr)) {
+
+		bool found = false;
+
+		for (size_t i = 0; i < orb_topics_count(); i++) {
+			if (strcmp(orb_topics[i]->o_name, name) == 0) {
+				px4_trace_select_topic(orb_topics[i]->o_id, true);
+				found = true;
+			}
+		}
+
+		if (!found) {
+			PX4_ERR("unknown topic %s", name);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int start(int argc, char *argv[])
+{
+	int records = 4096;
+	char *topics = nullptr;
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "b:t:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'b':
+			records = strtol(myoptarg, nullptr, 10);
+			break;
+
+		case 't':
+			topics = (char *)myoptarg;
+			break;
+
+		default:
+			print_usage();
+			return -1;
+		}
+	}
+
+	if (records < 16) {
+		print_usage();
+		return -1;
+	}
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		px4_trace_select_topic(i, false);
+	}
+
+	if (topics && !select_topics(topics)) {
+		return -1;
+	}
+
+	const int ret = px4_trace_start(records);
+
+	if (ret != 0) {
+		PX4_ERR("start failed (%i)", ret);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void write_record(FILE *file, const px4_trace_record_s &record)
+{
+	if (record.event >= PX4_TRACE_EVENT_COUNT) {
+		return;
+	}
+
+	fprintf(file, "%" PRIu64 ",%u,%s,", record.timestamp, record.cpu, event_names[record.event]);
+
+	switch (record.event) {
+	case PX4_TRACE_HRT_CALLOUT:
+	case PX4_TRACE_ISR_ENTER:
+	case PX4_TRACE_ISR_EXIT:
+		// code address, to be symbolized on the host
+		fprintf(file, "0x%" PRIxPTR ",", record.name);
+		break;
+
+	default:
+		fprintf(file, "%s,", record.name ? (const char *)record.name : "");
+		break;
+	}
+
+	fprintf(file, "%s,%" PRIu32 "\n", record.context ? (const char *)record.context : "", record.arg);
+}
+
+static int dump(int argc, char *argv[])
+{
+	const char *filename = PX4_STORAGEDIR "/trace.csv";
+	int myoptind = 1;
+	int ch;
+	const char *myoptarg = nullptr;
+
+	while ((ch = px4_getopt(argc, argv, "f:", &myoptind, &myoptarg)) != EOF) {
+		switch (ch) {
+		case 'f':
+			filename = myoptarg;
+			break;
+
+		default:
+			print_usage();
+			return -1;
+		}
+	}
+
+	if (px4_trace_running()) {
+		px4_trace_stop();
+		// let events that are being recorded on other CPUs complete
+		px4_usleep(1000);
+	}
+
+	FILE *file = fopen(filename, "w");
+
+	if (file == nullptr) {
+		PX4_ERR("can't open %s (%i)", filename, errno);
+		return -1;
+	}
+
+	fprintf(file, "timestamp,cpu,event,name,context,arg\n");
+
+	px4_trace_record_s records[32];
+	size_t total = 0;
+
+	for (unsigned ring = 0; ring < px4_trace_ring_count(); ring++) {
+		size_t index = 0;
+		size_t count;
+
+		while ((count = px4_trace_read(ring, &index, records, sizeof(records) / sizeof(records[0]))) > 0) {
+			for (size_t i = 0; i < count; i++) {
+				write_record(file, records[i]);
+			}
+
+			total += count;
+		}
+	}
+
+	fclose(file);
+	PX4_INFO("%zu events written to %s", total, filename);
+	return 0;
+}
+
+static void status()
+{
+	PX4_INFO("%s", px4_trace_running() ? "running" : "stopped");
+
+	for (unsigned ring = 0; ring < px4_trace_ring_count(); ring++) {
+		PX4_INFO("CPU %u: %" PRIu32 " events", ring, px4_trace_recorded(ring));
+	}
+}
+
+extern "C" __EXPORT int trace_main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		print_usage();
+		return -1;
+	}
+
+	if (strcmp(argv[1], "start") == 0) {
+		return start(argc - 1, argv + 1);
+
+	} else if (strcmp(argv[1], "stop") == 0) {
+		px4_trace_stop();
+		return 0;
+
+	} else if (strcmp(argv[1], "status") == 0) {
+		status();
+		return 0;
+
+	} else if (strcmp(argv[1], "dump") == 0) {
+		return dump(argc - 1, argv + 1);
+	}
+
+	print_usage();
+	return -1;
+}
@@ -37,6 +37,39 @@
 
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/module.h>
+#include <px4_platform_common/vehicle_namespace.h>
+
+#if defined(CONFIG_ORB_NAMESPACES) && (CONFIG_ORB_NAMESPACES > 1)
+#include <stdlib.h>
+#include <platforms/posix/apps.h>
+
+static int run_in_namespace(int argc, char *argv[])
+{
+	const uint8_t previous_namespace = px4::vehicle_namespace();
+	const int vehicle_namespace = atoi(argv[0]);
+
+	if (vehicle_namespace < 0 || !px4::set_vehicle_namespace(vehicle_namespace)) {
+		PX4_ERR("invalid namespace %s (0-%i)", argv[0], px4::VEHICLE_NAMESPACES - 1);
+		return -1;
+	}
+
+	apps_map_type apps;
+	init_app_map(apps);
+
+	auto app = apps.find(argv[1]);
+
+	if (app == apps.end()) {
+		px4::set_vehicle_namespace(previous_namespace);
+		PX4_ERR("unknown command %s", argv[1]);
+		return -1;
+	}
+
+	// the command and everything it spawns uses the topics of the namespace
+	const int ret = app->second(argc - 1, argv + 1);
+	px4::set_vehicle_namespace(previous_namespace);
+	return ret;
+}
+#endif
 
 extern "C" { __EXPORT int uorb_main(int argc, char *argv[]); }
 
@@ -59,6 +92,22 @@ int uorb_main(int argc, char *argv[])
 		return uorb_top(argv + 2, argc - 2);
 	}
 
+#if defined(CONFIG_ORB_COMMUNICATOR)
+
+	else if (!strcmp(argv[1], "remote") && argc > 2) {
+		return uorb_remote(argv + 2, argc - 2);
+	}
+
+#endif
+
+#if defined(CONFIG_ORB_NAMESPACES) && (CONFIG_ORB_NAMESPACES > 1)
+
+	else if (!strcmp(argv[1], "namespace") && argc > 3) {
+		return run_in_namespace(argc - 2, argv + 2);
+	}
+
+#endif
+
 	usage();
 	return 0;
 }
@@ -84,6 +133,16 @@ modules are allowed to publish which topics. This is used for system-wide replay
 ### Examples
 Monitor topic publication rates. Besides `top`, this is an important command for general system inspection:
 $ uorb top
+
+With CONFIG_ORB_NAMESPACES, several vehicles can run in one process, each with its own set of topics.
+Start the modules of the second vehicle in namespace 1:
+$ uorb namespace 1 ekf2 start
+$ uorb namespace 1 uorb top
+
+With CONFIG_ORB_COMMUNICATOR, send only the changes of vehicle_status to the other processor, at least once a second
+in full, and of failsafe_flags only two of the fields:
+$ uorb remote vehicle_status onchange keepalive 1000
+$ uorb remote failsafe_flags onchange fields angular_velocity_invalid,attitude_invalid
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("uorb", "communication");
@@ -91,5 +150,12 @@ $ uorb top
 	PRINT_MODULE_USAGE_COMMAND_DESCR("top", "Monitor topic publication rates");
 	PRINT_MODULE_USAGE_PARAM_FLAG('a', "print all instead of only currently publishing topics with subscribers", true);
 	PRINT_MODULE_USAGE_PARAM_FLAG('1', "run only once, then exit", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('l', "print publication interval and copy latency (needs CONFIG_ORB_TOPIC_STATISTICS)", true);
 	PRINT_MODULE_USAGE_ARG("<filter1> [<filter2>]", "topic(s) to match (implies -a)", true);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("remote",
+					 "Configure or show how a topic is sent to the remote side (needs CONFIG_ORB_COMMUNICATOR)");
+	PRINT_MODULE_USAGE_ARG("<topic> [full|delta|onchange] [keepalive <ms>] [fields <f1,f2,..>]",
+			       "full: every publication as a whole (default), delta: only changed bytes, onchange: skip unchanged", false);
+	PRINT_MODULE_USAGE_COMMAND_DESCR("namespace", "Run a command in a vehicle namespace (needs CONFIG_ORB_NAMESPACES)");
+	PRINT_MODULE_USAGE_ARG("<namespace> <command> [<args>]", "Namespace, command and its arguments", false);
 }
@@ -45,7 +45,35 @@ extern "C" {
 int
 work_queue_main(int argc, char *argv[])
 {
-	if (argc != 2) {
+	if (argc < 2) {
+		usage();
+		return 1;
+	}
+
+	if (!strcmp(argv[1], "affinity") && (argc >= 4)) {
+		const uint32_t cpu_affinity = strtoul(argv[3], nullptr, 0);
+		int policy = SCHED_FIFO;
+
+		if (argc >= 5) {
+			if (!strcmp(argv[4], "rr")) {
+				policy = SCHED_RR;
+
+			} else if (!strcmp(argv[4], "other")) {
+				policy = SCHED_OTHER;
+
+			} else if (strcmp(argv[4], "fifo")) {
+				usage();
+				return 1;
+			}
+		}
+
+		return px4::WorkQueueSetScheduling(argv[2], cpu_affinity, policy) == PX4_OK ? 0 : 1;
+
+	} else if (!strcmp(argv[1], "status") && (argc == 3) && !strcmp(argv[2], "-v")) {
+		px4::WorkQueueManagerStatus(true);
+		return 0;
+
+	} else if (argc != 2) {
 		usage();
 		return 1;
 	}
@@ -78,9 +106,25 @@ usage()
 
 Command-line tool to show work queue status.
 
+On Linux the work queue threads can be pinned to a set of CPUs (e.g. an isolated core) and given
+a scheduling policy. This can be done in the startup script before the modules are started.
+The status shows the actual CPU affinity and scheduling of each thread.
+
+If built with CONFIG_WORK_QUEUE_RUNTIME_STATISTICS, `status -v` additionally shows the execution time and
+the queue wait time (from scheduling until the start of the run) percentiles of each work item.
+
+### Examples
+Pin the rate controller and the first estimator instance to CPU 3:
+$ work_queue affinity wq:rate_ctrl 0x8
+$ work_queue affinity wq:INS0 0x8 fifo
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("work_queue", "system");
 	PRINT_MODULE_USAGE_COMMAND("start");
-	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
+	PRINT_MODULE_USAGE_COMMAND_DESCR("affinity", "Set CPU affinity and scheduling policy of a work queue (Linux only)");
+	PRINT_MODULE_USAGE_ARG("<name> <cpu mask> [fifo|rr|other]", "Work queue name, CPU bitmask (0: all CPUs), policy (default fifo)", false);
+	PRINT_MODULE_USAGE_COMMAND("stop");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("status", "print status info");
+	PRINT_MODULE_USAGE_PARAM_FLAG('v', "Include execution and queue wait time statistics", true);
 }
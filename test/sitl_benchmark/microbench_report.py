@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Collect the results of 'microbench -j' into a JSON report and compare it
+against a baseline, so that CI can track the microbenchmarks per commit and
+per board.
+
+The results are the MICROBENCH_RESULT lines in the console output. They can be
+produced by running SITL (--run, e.g. with the px4_sitl_test build) or taken
+from a captured console of a board (e.g. 'microbench -j all' in the MAVLink
+shell).
+
+Example:
+    make px4_sitl_test
+    ./test/sitl_benchmark/microbench_report.py --run build/px4_sitl_test -o microbench.json
+    ./test/sitl_benchmark/microbench_report.py console.log --compare microbench.json --threshold 10
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+from typing import Dict, Iterable
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+PX4_SOURCE_DIR = os.path.realpath(os.path.join(SCRIPT_DIR, '..', '..'))
+
+REPORT_VERSION = 1
+RESULT_PREFIX = 'MICROBENCH_RESULT '
+
+
+def run_sitl(build_dir: str, timeout_s: float) -> str:
+    """ run the microbenchmarks in SITL and return the console output """
+    work_dir = os.path.join(build_dir, 'rootfs')
+    os.makedirs(work_dir, exist_ok=True)
+    result = subprocess.run(
+        [os.path.join(build_dir, 'bin', 'px4'),
+         '-s', os.path.join(PX4_SOURCE_DIR, 'posix-configs', 'SITL', 'init', 'test', 'test_microbench'),
+         '-t', os.path.join(PX4_SOURCE_DIR, 'test_data'),
+         os.path.join(PX4_SOURCE_DIR, 'ROMFS', 'px4fmu_test')],
+        cwd=work_dir, stdin=subprocess.DEVNULL, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+        universal_newlines=True, errors='replace', timeout=timeout_s)
+    return result.stdout
+
+
+def parse_results(lines: Iterable[str]) -> dict:
+    board = None
+    results: Dict[str, dict] = {}
+
+    for line in lines:
+        index = line.find(RESULT_PREFIX)
+
+        if index < 0:
+            continue
+
+        try:
+            result = json.loads(line[index + len(RESULT_PREFIX):])
+
+        except ValueError:
+            continue  # interleaved with other output
+
+        board = result.pop('board', board)
+        key = '{}/{}'.format(result.pop('suite', ''), result.pop('name'))
+        results[key] = result
+
+    return {
+        'version': REPORT_VERSION,
+        'board': board,
+        'git': subprocess.run(['git', 'describe', '--always', '--dirty'], cwd=PX4_SOURCE_DIR,
+                              stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                              universal_newlines=True).stdout.strip(),
+        'results': results,
+    }
+
+
+def compare(report: dict, baseline: dict, threshold: float) -> int:
+    """ print the change of the time per operation, returns the number of regressions above the threshold [%] """
+    if report['board'] != baseline['board']:
+        print('Warning: comparing board {} against baseline of {}'.format(report['board'], baseline['board']),
+              file=sys.stderr)
+
+    regressions = 0
+
+    for key in sorted(set(report['results']) | set(baseline['results'])):
+        new = report['results'].get(key, {}).get('ns_per_op')
+        old = baseline['results'].get(key, {}).get('ns_per_op')
+
+        if new is None or old is None:
+            print('  {:<70} {}'.format(key, 'new' if old is None else 'removed'))
+            continue
+
+        change = (new - old) / old * 100 if old else 0.0
+        mark = ''
+
+        if change > threshold:
+            mark = ' REGRESSION'
+            regressions += 1
+
+        print('  {:<70} {:>12.2f} -> {:>12.2f} ns ({:+.1f}%){}'.format(key, old, new, change, mark))
+
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('logs', nargs='*', help='console output with MICROBENCH_RESULT lines (- for stdin)')
+    parser.add_argument('--run', metavar='BUILD_DIR', help='run the microbenchmarks in this SITL build')
+    parser.add_argument('-t', '--timeout', type=float, default=600, help='timeout for --run [s]')
+    parser.add_argument('-o', '--output', help='write the JSON report to this file (default: stdout)')
+    parser.add_argument('--compare', help='baseline JSON report to compare against')
+    parser.add_argument('--threshold', type=float, default=10,
+                        help='fail if the time per operation increased by more than this [%%]')
+    args = parser.parse_args()
+
+    lines = []
+
+    if args.run:
+        try:
+            lines += run_sitl(args.run, args.timeout).splitlines()
+
+        except (OSError, subprocess.TimeoutExpired) as e:
+            print('Error: {}'.format(e), file=sys.stderr)
+            return 1
+
+    for log in args.logs:
+        if log == '-':
+            lines += sys.stdin.read().splitlines()
+
+        else:
+            with open(log, errors='replace') as f:
+                lines += f.read().splitlines()
+
+    report = parse_results(lines)
+
+    if not report['results']:
+        print('Error: no MICROBENCH_RESULT lines found', file=sys.stderr)
+        return 1
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=2)
+
+    elif not args.compare:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+
+        regressions = compare(report, baseline, args.threshold)
+
+        if regressions:
+            print('{} benchmark(s) regressed by more than {}%'.format(regressions, args.threshold), file=sys.stderr)
+            return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""
+SITL throughput benchmark: run N SIH vehicles headless in one go, fly each for a
+given simulated duration and report the real-time factor and the CPU time per
+thread (modules and work queues) as JSON.
+
+Example:
+    make px4_sitl_default
+    ./test/sitl_benchmark/sihsim_benchmark.py -n 4 -d 60 -o report.json
+    ./test/sitl_benchmark/sihsim_benchmark.py -n 4 -d 60 --compare report.json
+"""
+
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import signal
+import subprocess
+import sys
+import time
+from typing import Dict, List, Optional
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+PX4_SOURCE_DIR = os.path.realpath(os.path.join(SCRIPT_DIR, '..', '..'))
+
+REPORT_VERSION = 1
+
+
+class Vehicle:
+    """ one px4 instance running SIH """
+
+    def __init__(self, build_dir: str, instance: int, model: str, speed_factor: float, work_dir: str):
+        self.build_dir = build_dir
+        self.instance = instance
+        self.work_dir = os.path.join(work_dir, 'instance_{}'.format(instance))
+        self.log_filename = os.path.join(self.work_dir, 'out.log')
+        self.env = os.environ.copy()
+        self.env['PX4_SIM_MODEL'] = 'sihsim_' + model
+        self.env['PX4_SIMULATOR'] = 'sihsim'
+        self.env['PX4_SIM_SPEED_FACTOR'] = str(speed_factor)
+        self.env['HEADLESS'] = '1'
+        self.process: Optional[subprocess.Popen] = None
+
+    def start(self) -> None:
+        shutil.rmtree(self.work_dir, ignore_errors=True)
+        os.makedirs(self.work_dir)
+        self.log_fd = open(self.log_filename, 'w')
+        self.process = subprocess.Popen(
+            [os.path.join(self.build_dir, 'bin', 'px4'), '-i', str(self.instance),
+             '-d', os.path.join(self.build_dir, 'etc')],
+            cwd=self.work_dir, env=self.env, stdin=subprocess.DEVNULL,
+            stdout=self.log_fd, stderr=subprocess.STDOUT)
+
+    def stop(self) -> None:
+        if self.process is None:
+            return
+
+        if self.process.poll() is None:
+            self.process.send_signal(signal.SIGINT)
+
+            try:
+                self.process.wait(timeout=10)
+
+            except subprocess.TimeoutExpired:
+                self.process.kill()
+                self.process.wait()
+
+        self.log_fd.close()
+        self.process = None
+
+    def command(self, *args: str) -> str:
+        """ run a px4 command on this instance via the px4 client """
+        result = subprocess.run(
+            [os.path.join(self.build_dir, 'bin', 'px4-' + args[0]), '--instance', str(self.instance)] + list(args[1:]),
+            cwd=self.work_dir, stdin=subprocess.DEVNULL, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+            universal_newlines=True, timeout=30)
+        return result.stdout
+
+    def log_contains(self, text: str) -> bool:
+        with open(self.log_filename, 'r', errors='replace') as f:
+            return text in f.read()
+
+    def sim_time_us(self) -> Optional[int]:
+        """ current (simulated) time, from the timestamp of the latest sensor sample """
+        output = self.command('listener', 'sensor_combined', '-n', '1')
+        match = re.search(r'timestamp: (\d+)', output)
+        return int(match.group(1)) if match else None
+
+    def thread_cpu_times(self) -> Dict[str, float]:
+        """ CPU time [s] per thread name of this px4 process (Linux only) """
+        times: Dict[str, float] = {}
+        clock_ticks = os.sysconf('SC_CLK_TCK')
+        task_dir = '/proc/{}/task'.format(self.process.pid)
+
+        for tid in os.listdir(task_dir):
+            try:
+                with open(os.path.join(task_dir, tid, 'stat')) as f:
+                    stat = f.read()
+
+            except OSError:
+                continue  # thread exited
+
+            # the name is in parentheses and can contain spaces
+            name = stat[stat.index('(') + 1:stat.rindex(')')]
+            fields = stat[stat.rindex(')') + 2:].split()
+            cpu = (int(fields[11]) + int(fields[12])) / clock_ticks  # utime + stime
+            times[name] = times.get(name, 0.0) + cpu
+
+        return times
+
+    def work_queue_rates(self) -> Dict[str, Dict[str, float]]:
+        """ run rate [Hz] and interval [us] per work item """
+        rates: Dict[str, Dict[str, float]] = {}
+        queue = ''
+
+        for line in self.command('work_queue', 'status').splitlines():
+            match = re.match(r'^[|\\]__\s*\d+\)\s+(\S+)', line)
+
+            if match:
+                queue = match.group(1)
+                continue
+
+            match = re.search(r'[|\\]__\s*\d+\)\s+(\S+)\s+([\d.]+) Hz\s+([\d.]+) us', line)
+
+            if match:
+                rates['{}/{}'.format(queue, match.group(1))] = {
+                    'rate_hz': float(match.group(2)), 'interval_us': float(match.group(3))}
+
+        return rates
+
+
+def wait_for(vehicles: List[Vehicle], text: str, timeout_s: float) -> None:
+    deadline = time.monotonic() + timeout_s
+    pending = list(vehicles)
+
+    while pending:
+        pending = [v for v in pending if not v.log_contains(text)]
+
+        for vehicle in pending:
+            if vehicle.process.poll() is not None:
+                raise RuntimeError('instance {} exited (see {})'.format(vehicle.instance, vehicle.log_filename))
+
+        if time.monotonic() > deadline:
+            raise RuntimeError('timeout waiting for "{}" on instance(s) {}'.format(
+                text, ', '.join(str(v.instance) for v in pending)))
+
+        time.sleep(0.2)
+
+
+def run_benchmark(args: argparse.Namespace) -> dict:
+    vehicles = [Vehicle(args.build_dir, i, args.model, args.speed_factor, args.work_dir)
+                for i in range(args.vehicles)]
+
+    try:
+        for vehicle in vehicles:
+            vehicle.start()
+
+        wait_for(vehicles, 'Ready for takeoff', args.timeout)
+
+        for vehicle in vehicles:
+            vehicle.command('commander', 'takeoff')
+
+        wall_start = time.monotonic()
+        sim_start = [v.sim_time_us() for v in vehicles]
+        cpu_start = [v.thread_cpu_times() for v in vehicles]
+
+        # the vehicles take off and hold, until the simulated duration elapsed on all of them
+        while True:
+            time.sleep(0.5)
+            sim_now = [v.sim_time_us() for v in vehicles]
+
+            if all(s is not None and s0 is not None and s - s0 >= args.duration * 1e6
+                   for s, s0 in zip(sim_now, sim_start)):
+                break
+
+            if time.monotonic() - wall_start > args.timeout + args.duration * 10:
+                raise RuntimeError('timeout running the benchmark')
+
+        wall_elapsed = time.monotonic() - wall_start
+        cpu_end = [v.thread_cpu_times() for v in vehicles]
+        instances = []
+
+        for vehicle, s0, s1, c0, c1 in zip(vehicles, sim_start, sim_now, cpu_start, cpu_end):
+            sim_elapsed = (s1 - s0) / 1e6
+            threads = {name: round(cpu - c0.get(name, 0.0), 3) for name, cpu in c1.items()}
+            instances.append({
+                'instance': vehicle.instance,
+                'sim_time_s': round(sim_elapsed, 3),
+                'real_time_factor': round(sim_elapsed / wall_elapsed, 3),
+                'cpu_s': round(sum(threads.values()), 3),
+                'thread_cpu_s': dict(sorted(threads.items(), key=lambda item: -item[1])),
+                'work_queues': vehicle.work_queue_rates(),
+            })
+
+    finally:
+        for vehicle in vehicles:
+            vehicle.stop()
+
+    rtfs = [i['real_time_factor'] for i in instances]
+
+    return {
+        'version': REPORT_VERSION,
+        'config': {
+            'vehicles': args.vehicles,
+            'model': args.model,
+            'duration_s': args.duration,
+            'speed_factor': args.speed_factor,
+            'host': platform.node(),
+            'cpus': os.cpu_count(),
+            'git': subprocess.run(['git', 'describe', '--always', '--dirty'], cwd=PX4_SOURCE_DIR,
+                                  stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                                  universal_newlines=True).stdout.strip(),
+        },
+        'wall_time_s': round(wall_elapsed, 3),
+        'real_time_factor_min': min(rtfs),
+        'real_time_factor_mean': round(sum(rtfs) / len(rtfs), 3),
+        'cpu_s_total': round(sum(i['cpu_s'] for i in instances), 3),
+        'instances': instances,
+    }
+
+
+def compare(report: dict, baseline: dict) -> None:
+    """ print the relative change of the main metrics and of the per-thread CPU time of instance 0 """
+    def change(new: float, old: float) -> str:
+        return '{:+.1f}%'.format((new - old) / old * 100) if old else 'n/a'
+
+    for key in ['real_time_factor_min', 'real_time_factor_mean', 'cpu_s_total']:
+        print('{:<24} {:>10} -> {:>10} ({})'.format(key, baseline[key], report[key], change(report[key], baseline[key])))
+
+    new_threads = report['instances'][0]['thread_cpu_s']
+    old_threads = baseline['instances'][0]['thread_cpu_s']
+
+    for name in sorted(set(new_threads) | set(old_threads), key=lambda n: -new_threads.get(n, 0.0)):
+        new = new_threads.get(name, 0.0)
+        old = old_threads.get(name, 0.0)
+        print('  {:<22} {:>10.3f} -> {:>10.3f} ({})'.format(name, old, new, change(new, old)))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-n', '--vehicles', type=int, default=int(os.environ.get('PX4_BENCH_VEHICLES', 4)),
+                        help='number of SIH vehicles (env PX4_BENCH_VEHICLES)')
+    parser.add_argument('-d', '--duration', type=float, default=float(os.environ.get('PX4_BENCH_DURATION', 60)),
+                        help='simulated flight duration [s] (env PX4_BENCH_DURATION)')
+    parser.add_argument('-m', '--model', default='quadx', help='sihsim model (quadx, airplane, xvert)')
+    parser.add_argument('-s', '--speed-factor', type=float, default=0,
+                        help='PX4_SIM_SPEED_FACTOR, 0 runs as fast as possible')
+    parser.add_argument('-b', '--build-dir', default=os.path.join(PX4_SOURCE_DIR, 'build', 'px4_sitl_default'))
+    parser.add_argument('-w', '--work-dir', default=None, help='instance directories (default: <build-dir>/benchmark)')
+    parser.add_argument('-t', '--timeout', type=float, default=120, help='startup timeout [s]')
+    parser.add_argument('-o', '--output', help='write the JSON report to this file (default: stdout)')
+    parser.add_argument('--compare', help='baseline JSON report to compare against')
+    args = parser.parse_args()
+
+    if not sys.platform.startswith('linux'):
+        print('per-thread CPU accounting requires Linux (/proc)', file=sys.stderr)
+        return 1
+
+    if args.work_dir is None:
+        args.work_dir = os.path.join(args.build_dir, 'benchmark')
+
+    baseline = None
+
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+
+    try:
+        report = run_benchmark(args)
+
+    except RuntimeError as e:
+        print('Error: {}'.format(e), file=sys.stderr)
+        return 1
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=2)
+
+    else:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+
+    if baseline:
+        compare(report, baseline)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())